@@ -0,0 +1,314 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-arena-unittest.c
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-18 22:10
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  Easeds 区域分配器单元测试实现文件, 包含了对齐/标记回滚/重置复用/动态数组适配和 malloc 对比测试.
+ *
+ * @History:
+ *  2026年10月18日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#include "easeds-unittest.h"
+
+// 项目内部头文件
+#include "easeds-arena.h"
+#include "easeds-array.h"
+#include "easeds-utils.h"
+
+// 基本功能测试: 分配对齐, 内容互不覆盖, 重置后复用内存块
+static void test_easeds_arena_basic(void **state)
+{
+    easeds_unused(state);
+
+    enum { COUNT = 2000 };
+
+    struct easeds_arena *arena = easeds_arena_create("basic", 4096);
+    uint8_t             *ptrs[COUNT];
+    uint32_t             sizes[COUNT];
+    uint64_t             chunks = 0;
+    assert_non_null(arena);
+
+    for (uint32_t round = 0; round < 3; round++) {
+        uint64_t seed = 88172645463325252ULL;
+        for (uint32_t i = 0; i < COUNT; i++) {
+            seed ^= seed << 13;
+            seed ^= seed >> 7;
+            seed ^= seed << 17;
+            sizes[i] = (uint32_t)(seed % 200) + 1;
+            ptrs[i]  = easeds_arena_alloc(arena, sizes[i]);
+            assert_non_null(ptrs[i]);
+            assert_int_equal((uintptr_t)ptrs[i] % EASEDS_ARENA_ALIGN, 0);
+            memset(ptrs[i], (int)(i & 0xFF), sizes[i]);
+        }
+        for (uint32_t i = 0; i < COUNT; i++) {
+            assert_int_equal(ptrs[i][0], i & 0xFF);
+            assert_int_equal(ptrs[i][sizes[i] - 1], i & 0xFF);
+        }
+
+        // 第一轮之后不再申请新的内存块
+        struct easeds_arena_stats stats;
+        easeds_arena_stats(arena, &stats);
+        if (round == 0) {
+            chunks = stats.chunks;
+            assert_true(chunks > 1);
+        }
+        assert_int_equal(stats.chunks, chunks);
+        assert_true(stats.used > 0);
+        assert_true(stats.peak >= stats.used);
+
+        easeds_arena_reset(arena);
+        easeds_arena_stats(arena, &stats);
+        assert_int_equal(stats.used, 0);
+    }
+
+    // calloc 清零, strdup 复制
+    uint8_t *zero = easeds_arena_calloc(arena, 64);
+    assert_non_null(zero);
+    for (uint32_t i = 0; i < 64; i++) {
+        assert_int_equal(zero[i], 0);
+    }
+    char *dup = easeds_arena_strdup(arena, "arena string");
+    assert_non_null(dup);
+    assert_string_equal(dup, "arena string");
+
+    easeds_arena_destroy(arena);
+}
+
+// 操作测试: 嵌套标记回滚, 动态数组从 arena 分配
+static void test_easeds_arena_operations(void **state)
+{
+    easeds_unused(state);
+
+    struct easeds_arena *arena = easeds_arena_create("operations", 1024);
+    assert_non_null(arena);
+
+    // 嵌套标记, 回滚后同样的分配得到同样的地址
+    struct easeds_arena_mark outer, inner;
+    assert_non_null(easeds_arena_alloc(arena, 100));
+    assert_int_equal(easeds_arena_mark(arena, &outer), EASEDS_OK);
+    void *a = easeds_arena_alloc(arena, 300);
+    assert_int_equal(easeds_arena_mark(arena, &inner), EASEDS_OK);
+    void *b = easeds_arena_alloc(arena, 500);
+    for (uint32_t i = 0; i < 20; i++) {
+        assert_non_null(easeds_arena_alloc(arena, 700)); /* 跨越多个内存块 */
+    }
+
+    assert_int_equal(easeds_arena_restore(arena, &inner), EASEDS_OK);
+    assert_ptr_equal(easeds_arena_alloc(arena, 500), b);
+    assert_int_equal(easeds_arena_restore(arena, &outer), EASEDS_OK);
+    assert_ptr_equal(easeds_arena_alloc(arena, 300), a);
+
+    struct easeds_arena_stats stats;
+    easeds_arena_stats(arena, &stats);
+    assert_int_equal(stats.used, 400);
+    uint64_t chunks = stats.chunks;
+
+    // 回滚之后再次分配复用已有内存块
+    for (uint32_t i = 0; i < 20; i++) {
+        assert_non_null(easeds_arena_alloc(arena, 700));
+    }
+    easeds_arena_stats(arena, &stats);
+    assert_int_equal(stats.chunks, chunks);
+    easeds_arena_reset(arena);
+
+    // 动态数组从 arena 分配, 扩容时在最后一次分配上原地扩展
+    const struct easeds_allocator *allocator = easeds_arena_allocator(arena);
+    struct easeds_array           *array =
+        easeds_array_create_alloc("arena", sizeof(uint64_t), 4, allocator);
+    assert_non_null(array);
+    assert_ptr_equal(array->allocator, allocator);
+
+    for (uint64_t i = 0; i < 10000; i++) {
+        assert_int_equal(easeds_array_push_back(array, &i), EASEDS_OK);
+    }
+    for (uint32_t i = 0; i < 10000; i++) {
+        void *element = NULL;
+        assert_int_equal(easeds_array_get(array, i, &element), EASEDS_OK);
+        assert_int_equal(*(uint64_t *)element, i);
+    }
+    assert_int_equal(easeds_array_resize(array, 10000), EASEDS_OK);
+
+    // 两个数组交替扩容时不能原地扩展, 内容复制到新位置
+    struct easeds_array *other = easeds_array_create_alloc("other", sizeof(uint32_t), 2, allocator);
+    assert_non_null(other);
+    for (uint32_t i = 0; i < 1000; i++) {
+        uint64_t v = i * 3;
+        assert_int_equal(easeds_array_push_back(other, &i), EASEDS_OK);
+        assert_int_equal(easeds_array_push_back(array, &v), EASEDS_OK);
+    }
+    for (uint32_t i = 0; i < 1000; i++) {
+        void *element = NULL;
+        assert_int_equal(easeds_array_get(other, i, &element), EASEDS_OK);
+        assert_int_equal(*(uint32_t *)element, i);
+        assert_int_equal(easeds_array_get(array, 10000 + i, &element), EASEDS_OK);
+        assert_int_equal(*(uint64_t *)element, i * 3);
+    }
+
+    // 数组销毁不需要逐个释放, 重置 arena 一次回收
+    easeds_array_destroy(other);
+    easeds_array_destroy(array);
+    easeds_arena_reset(arena);
+    easeds_arena_stats(arena, &stats);
+    assert_int_equal(stats.used, 0);
+
+    easeds_arena_destroy(arena);
+}
+
+// 边界测试: 大于内存块的分配, 大对齐, 零字节分配, 重置后跳过放不下的空块
+static void test_easeds_arena_boundary(void **state)
+{
+    easeds_unused(state);
+
+    struct easeds_arena *arena = easeds_arena_create("boundary", 256);
+    assert_non_null(arena);
+
+    // 零字节分配返回有效地址, 不消耗空间
+    void *zero = easeds_arena_alloc(arena, 0);
+    assert_non_null(zero);
+    assert_ptr_equal(easeds_arena_alloc(arena, 16), zero);
+
+    // 大对齐
+    for (uint64_t align = 1; align <= EASEDS_ARENA_MAX_ALIGN; align <<= 1) {
+        uint8_t *ptr = easeds_arena_alloc_aligned(arena, 24, align);
+        assert_non_null(ptr);
+        assert_int_equal((uintptr_t)ptr % align, 0);
+        memset(ptr, 0xA5, 24);
+    }
+
+    // 大于内存块的分配单独申请一个足够大的块
+    uint8_t *big = easeds_arena_alloc(arena, 100000);
+    assert_non_null(big);
+    memset(big, 0x5A, 100000);
+    struct easeds_arena_stats stats;
+    easeds_arena_stats(arena, &stats);
+    assert_true(stats.reserved >= 100000 + 256);
+
+    // 重置后小分配复用第一个块, 大分配跳过放不下的空块, 复用大块
+    easeds_arena_reset(arena);
+    uint64_t chunks = stats.chunks;
+    for (uint32_t i = 0; i < 10; i++) {
+        assert_non_null(easeds_arena_alloc(arena, 64));
+    }
+    assert_non_null(easeds_arena_alloc(arena, 90000));
+    easeds_arena_stats(arena, &stats);
+    assert_int_equal(stats.chunks, chunks);
+
+    easeds_arena_destroy(arena);
+}
+
+// 错误测试: 空指针, 非法对齐, 非法标记
+static void test_easeds_arena_error(void **state)
+{
+    easeds_unused(state);
+
+    struct easeds_arena_mark mark = {0};
+    assert_null(easeds_arena_create("error", UINT64_MAX));
+    assert_null(easeds_arena_alloc(NULL, 8));
+    assert_null(easeds_arena_calloc(NULL, 8));
+    assert_null(easeds_arena_strdup(NULL, "x"));
+    assert_int_equal(easeds_arena_mark(NULL, &mark), EASEDS_ERROR);
+    assert_int_equal(easeds_arena_restore(NULL, &mark), EASEDS_ERROR);
+    assert_null(easeds_arena_allocator(NULL));
+    easeds_arena_reset(NULL);
+    easeds_arena_stats(NULL, NULL);
+    easeds_arena_destroy(NULL);
+
+    struct easeds_arena *arena = easeds_arena_create("error", 0);
+    assert_non_null(arena);
+    assert_null(easeds_arena_alloc_aligned(arena, 8, 0));
+    assert_null(easeds_arena_alloc_aligned(arena, 8, 3));
+    assert_null(easeds_arena_alloc_aligned(arena, 8, EASEDS_ARENA_MAX_ALIGN * 2));
+    assert_null(easeds_arena_alloc(arena, UINT64_MAX));
+    assert_null(easeds_arena_strdup(arena, NULL));
+    assert_int_equal(easeds_arena_mark(arena, NULL), EASEDS_ERROR);
+    assert_int_equal(easeds_arena_restore(arena, NULL), EASEDS_ERROR);
+    assert_int_equal(easeds_arena_restore(arena, &mark), EASEDS_ERROR);
+    easeds_arena_destroy(arena);
+}
+
+// 性能测试: 模拟请求处理, 每个请求若干次小分配, 请求结束时 arena 重置, 对比逐个 malloc/free
+static void test_easeds_arena_perf(void **state)
+{
+    easeds_unused(state);
+
+    enum { REQUESTS = 20000, ALLOCS = 64 };
+
+    struct easeds_arena *arena = easeds_arena_create("perf", 0);
+    void                *ptrs[ALLOCS];
+    uint64_t             seed = 88172645463325252ULL;
+    assert_non_null(arena);
+
+    int64_t start = easeds_get_current_time_ns();
+    for (uint32_t r = 0; r < REQUESTS; r++) {
+        for (uint32_t i = 0; i < ALLOCS; i++) {
+            seed ^= seed << 13;
+            seed ^= seed >> 7;
+            seed ^= seed << 17;
+            ptrs[i] = easeds_arena_alloc(arena, seed % 256 + 8);
+            *(uint64_t *)ptrs[i] = i;
+        }
+        easeds_arena_reset(arena);
+    }
+    int64_t arena_ns = easeds_get_current_time_ns() - start;
+
+    seed  = 88172645463325252ULL;
+    start = easeds_get_current_time_ns();
+    for (uint32_t r = 0; r < REQUESTS; r++) {
+        for (uint32_t i = 0; i < ALLOCS; i++) {
+            seed ^= seed << 13;
+            seed ^= seed >> 7;
+            seed ^= seed << 17;
+            ptrs[i] = malloc(seed % 256 + 8);
+            *(uint64_t *)ptrs[i] = i;
+        }
+        for (uint32_t i = 0; i < ALLOCS; i++) {
+            free(ptrs[i]);
+        }
+    }
+    int64_t malloc_ns = easeds_get_current_time_ns() - start;
+
+    // 动态数组从 arena 和从 malloc 分配的对比
+    const struct easeds_allocator *allocator = easeds_arena_allocator(arena);
+    int64_t                        array_ns[2];
+    for (uint32_t k = 0; k < 2; k++) {
+        start = easeds_get_current_time_ns();
+        for (uint32_t r = 0; r < REQUESTS / 10; r++) {
+            struct easeds_array *array =
+                easeds_array_create_alloc("perf", sizeof(uint64_t), 4, k == 0 ? allocator : NULL);
+            for (uint64_t i = 0; i < 256; i++) {
+                easeds_array_push_back(array, &i);
+            }
+            easeds_array_destroy(array);
+            easeds_arena_reset(arena);
+        }
+        array_ns[k] = easeds_get_current_time_ns() - start;
+    }
+
+    struct easeds_arena_stats stats;
+    easeds_arena_stats(arena, &stats);
+    MEASURE("[arena perf]: %u requests x %u allocs, arena %.1f ns/alloc, "
+            "malloc+free %.1f ns/alloc, array 256 push arena %.1f us, malloc %.1f us, chunks %lu.",
+        REQUESTS, ALLOCS, (double)arena_ns / (REQUESTS * ALLOCS),
+        (double)malloc_ns / (REQUESTS * ALLOCS), (double)array_ns[0] / (REQUESTS / 10) / 1000.0,
+        (double)array_ns[1] / (REQUESTS / 10) / 1000.0, stats.chunks);
+
+    easeds_arena_destroy(arena);
+}
+
+// 注册单元测试用例
+EASEDS_UNITTEST_REGISTER(easeds_unittest_arena){
+    cmocka_unit_test(test_easeds_arena_basic),
+    cmocka_unit_test(test_easeds_arena_operations),
+    cmocka_unit_test(test_easeds_arena_boundary),
+    cmocka_unit_test(test_easeds_arena_error),
+    cmocka_unit_test(test_easeds_arena_perf),
+    easeds_unit_test_end,
+};
@@ -0,0 +1,316 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-arena.c
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-18 22:10
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  区域分配器(Arena)实现文件.
+ *
+ * @History:
+ *  2026年10月18日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#include "easeds-arena.h"
+
+// 标准库头文件
+#include <stdlib.h>
+#include <string.h>
+
+// 项目内部头文件
+#include "easeds-environment.h"
+#include "easeds-log.h"
+
+/* 单次分配的字节数上限, 避免计算块大小时溢出 */
+#define ARENA_MAX_ALLOC (1ULL << 48)
+
+// 申请一个数据区至少为 size 字节的内存块, 失败返回NULL
+static struct easeds_arena_chunk *arena_chunk_alloc(struct easeds_arena *arena, uint64_t size)
+{
+    uint64_t                   bytes = size > arena->chunk_size ? size : arena->chunk_size;
+    struct easeds_arena_chunk *chunk = __easeds_malloc(sizeof(struct easeds_arena_chunk) + bytes);
+    if (unlikely(chunk == NULL)) {
+        EASEDS_ERR("[arena_chunk_alloc]: Malloc chunk with %lu bytes failed.", bytes);
+        return NULL;
+    }
+
+    chunk->next = NULL;
+    chunk->size = bytes;
+    arena->stats.chunks++;
+    arena->stats.reserved += bytes;
+    return chunk;
+}
+
+// 在内存块中从 offset 开始按 align 对齐放置 size 字节, 放得下返回对齐后的偏移, 否则返回 UINT64_MAX
+static inline uint64_t arena_chunk_fit(
+    struct easeds_arena_chunk *chunk, uint64_t offset, uint64_t size, uint64_t align)
+{
+    uintptr_t base  = (uintptr_t)chunk->data;
+    uint64_t  start = (uint64_t)(((base + offset + align - 1) & ~(uintptr_t)(align - 1)) - base);
+
+    return start <= chunk->size && chunk->size - start >= size ? start : UINT64_MAX;
+}
+
+// 当前块放不下时转到后续块, 跳过放不下的空闲块, 都不合适时申请新块插入到当前块后面
+static void *arena_alloc_slow(struct easeds_arena *arena, uint64_t size, uint64_t align)
+{
+    struct easeds_arena_chunk *chunk = arena->current->next;
+    uint64_t                   start = UINT64_MAX;
+
+    /* 后续块都是重置或回滚后留下的空块, 放不下的块暂时跳过, 留在链表中供以后使用 */
+    while (chunk != NULL) {
+        start = arena_chunk_fit(chunk, 0, size, align);
+        if (start != UINT64_MAX) {
+            break;
+        }
+        chunk = chunk->next;
+    }
+
+    if (chunk == NULL) {
+        chunk = arena_chunk_alloc(arena, size + align - 1);
+        if (unlikely(chunk == NULL)) {
+            return NULL;
+        }
+        chunk->next          = arena->current->next;
+        arena->current->next = chunk;
+        start                = arena_chunk_fit(chunk, 0, size, align);
+    } else if (chunk != arena->current->next) {
+        /* 把找到的块移动到当前块后面, 保持"当前块之前都是已用块"的顺序 */
+        struct easeds_arena_chunk *prev = arena->current->next;
+        while (prev->next != chunk) {
+            prev = prev->next;
+        }
+        prev->next           = chunk->next;
+        chunk->next          = arena->current->next;
+        arena->current->next = chunk;
+    }
+
+    arena->current = chunk;
+    arena->offset  = start + size;
+    return chunk->data + start;
+}
+
+// 分配器接口: 分配
+static void *arena_allocator_alloc(void *ctx, size_t size)
+{
+    return easeds_arena_alloc(ctx, size);
+}
+
+// 分配器接口: 重新分配, 最后一次分配且当前块剩余空间足够时原地扩展
+static void *arena_allocator_realloc(void *ctx, void *ptr, size_t old_size, size_t size)
+{
+    struct easeds_arena *arena = ctx;
+
+    if (ptr == NULL) {
+        return easeds_arena_alloc(arena, size);
+    }
+
+    if (ptr == arena->last) {
+        uint64_t start = (uint64_t)((uint8_t *)ptr - arena->current->data);
+        if (arena->current->size - start >= size) {
+            arena->offset = start + size;
+            arena->stats.used += size - old_size;
+            arena->stats.peak = arena->stats.used > arena->stats.peak ? arena->stats.used
+                                                                       : arena->stats.peak;
+            return ptr;
+        }
+    }
+
+    void *new_ptr = easeds_arena_alloc(arena, size);
+    if (likely(new_ptr != NULL)) {
+        memcpy(new_ptr, ptr, old_size < size ? old_size : size);
+    }
+    return new_ptr;
+}
+
+// 分配器接口: 释放, 只有最后一次分配可以回收空间
+static void arena_allocator_free(void *ctx, void *ptr, size_t size)
+{
+    struct easeds_arena *arena = ctx;
+
+    if (ptr != NULL && ptr == arena->last) {
+        arena->offset = (uint64_t)((uint8_t *)ptr - arena->current->data);
+        arena->stats.used -= size;
+        arena->last = NULL;
+    }
+}
+
+// 创建 arena, chunk_size 为内存块大小, 为0时使用 EASEDS_ARENA_CHUNK_SIZE, 失败返回NULL
+struct easeds_arena *easeds_arena_create(const char *name, uint64_t chunk_size)
+{
+    if (unlikely(chunk_size > ARENA_MAX_ALLOC)) {
+        EASEDS_ERR("[easeds_arena_create]: Invalid chunk size %lu.", chunk_size);
+        return NULL;
+    }
+
+    struct easeds_arena *arena = __easeds_malloc(sizeof(struct easeds_arena));
+    if (unlikely(arena == NULL)) {
+        EASEDS_ERR("[easeds_arena_create]: Malloc arena failed.");
+        return NULL;
+    }
+
+    memset(arena, 0, sizeof(struct easeds_arena));
+    arena->name       = name;
+    arena->chunk_size = chunk_size != 0 ? chunk_size : EASEDS_ARENA_CHUNK_SIZE;
+    arena->head       = arena_chunk_alloc(arena, arena->chunk_size);
+    if (unlikely(arena->head == NULL)) {
+        __easeds_free(arena);
+        return NULL;
+    }
+
+    arena->current              = arena->head;
+    arena->allocator.alloc_fn   = arena_allocator_alloc;
+    arena->allocator.realloc_fn = arena_allocator_realloc;
+    arena->allocator.free_fn    = arena_allocator_free;
+    arena->allocator.ctx        = arena;
+
+    PFL_DEBUG("[easeds_arena_create]: name=%s, chunk_size=%lu.", name != NULL ? name : "(null)",
+        arena->chunk_size);
+    return arena;
+}
+
+// 销毁 arena, 释放所有内存块, 从 arena 分配的内存全部失效
+void easeds_arena_destroy(struct easeds_arena *arena)
+{
+    if (unlikely(arena == NULL)) {
+        return;
+    }
+
+    struct easeds_arena_chunk *chunk = arena->head;
+    while (chunk != NULL) {
+        struct easeds_arena_chunk *next = chunk->next;
+        __easeds_free(chunk);
+        chunk = next;
+    }
+    __easeds_free(arena);
+}
+
+// 按 align 对齐分配 size 字节, align 必须是不超过 EASEDS_ARENA_MAX_ALIGN 的 2 的幂, 失败返回NULL
+void *easeds_arena_alloc_aligned(struct easeds_arena *arena, uint64_t size, uint64_t align)
+{
+    if (unlikely(arena == NULL || align == 0 || (align & (align - 1)) != 0
+                 || align > EASEDS_ARENA_MAX_ALIGN || size > ARENA_MAX_ALLOC)) {
+        EASEDS_ERR("[easeds_arena_alloc_aligned]: Invalid arena, size %lu or align %lu.", size,
+            align);
+        return NULL;
+    }
+
+    void    *ptr   = NULL;
+    uint64_t start = arena_chunk_fit(arena->current, arena->offset, size, align);
+    if (likely(start != UINT64_MAX)) {
+        arena->offset = start + size;
+        ptr           = arena->current->data + start;
+    } else {
+        ptr = arena_alloc_slow(arena, size, align);
+        if (unlikely(ptr == NULL)) {
+            return NULL;
+        }
+    }
+
+    arena->last = ptr;
+    arena->stats.used += size;
+    arena->stats.peak = arena->stats.used > arena->stats.peak ? arena->stats.used
+                                                               : arena->stats.peak;
+    return ptr;
+}
+
+// 按 EASEDS_ARENA_ALIGN 对齐分配 size 字节, size 为0时返回一个不可访问的有效地址, 失败返回NULL
+void *easeds_arena_alloc(struct easeds_arena *arena, uint64_t size)
+{
+    return easeds_arena_alloc_aligned(arena, size, EASEDS_ARENA_ALIGN);
+}
+
+// 分配 size 字节并清零, 失败返回NULL
+void *easeds_arena_calloc(struct easeds_arena *arena, uint64_t size)
+{
+    void *ptr = easeds_arena_alloc(arena, size);
+    if (likely(ptr != NULL)) {
+        memset(ptr, 0, size);
+    }
+    return ptr;
+}
+
+// 复制以 '\0' 结尾的字符串到 arena, 失败返回NULL
+char *easeds_arena_strdup(struct easeds_arena *arena, const char *str)
+{
+    if (unlikely(str == NULL)) {
+        EASEDS_ERR("[easeds_arena_strdup]: Invalid string pointer.");
+        return NULL;
+    }
+
+    uint64_t len = strlen(str) + 1;
+    char    *dup = easeds_arena_alloc_aligned(arena, len, 1);
+    if (likely(dup != NULL)) {
+        memcpy(dup, str, len);
+    }
+    return dup;
+}
+
+// 保存当前分配位置到 mark, 成功返回0, 失败返回-1
+int32_t easeds_arena_mark(struct easeds_arena *arena, struct easeds_arena_mark *mark)
+{
+    if (unlikely(arena == NULL || mark == NULL)) {
+        EASEDS_ERR("[easeds_arena_mark]: Invalid arena or mark pointer.");
+        return -1;
+    }
+
+    mark->chunk  = arena->current;
+    mark->offset = arena->offset;
+    mark->used   = arena->stats.used;
+    return 0;
+}
+
+// 回滚到 mark 保存的分配位置, 标记之后的分配全部失效, 成功返回0, 失败返回-1
+int32_t easeds_arena_restore(struct easeds_arena *arena, const struct easeds_arena_mark *mark)
+{
+    if (unlikely(arena == NULL || mark == NULL || mark->chunk == NULL
+                 || mark->offset > mark->chunk->size)) {
+        EASEDS_ERR("[easeds_arena_restore]: Invalid arena or mark.");
+        return -1;
+    }
+
+    /* 标记块之后的块变成空块, 块本身仍在链表中, 后续分配按顺序复用 */
+    arena->current    = mark->chunk;
+    arena->offset     = mark->offset;
+    arena->stats.used = mark->used;
+    arena->last       = NULL;
+    return 0;
+}
+
+// 重置 arena, 所有分配失效, 保留内存块供后续分配复用
+void easeds_arena_reset(struct easeds_arena *arena)
+{
+    if (unlikely(arena == NULL)) {
+        return;
+    }
+
+    arena->current    = arena->head;
+    arena->offset     = 0;
+    arena->stats.used = 0;
+    arena->last       = NULL;
+}
+
+// 获取分配器接口, 生命周期和 arena 相同, arena 为NULL时返回NULL
+const struct easeds_allocator *easeds_arena_allocator(struct easeds_arena *arena)
+{
+    if (unlikely(arena == NULL)) {
+        return NULL;
+    }
+
+    return &arena->allocator;
+}
+
+// 获取统计信息
+void easeds_arena_stats(struct easeds_arena *arena, struct easeds_arena_stats *stats)
+{
+    if (unlikely(arena == NULL || stats == NULL)) {
+        return;
+    }
+
+    *stats = arena->stats;
+}
@@ -0,0 +1,141 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-arena.h
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-18 22:10
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  区域分配器(Arena), 在内存块内按偏移递增分配, 支持对齐分配, 标记/回滚和整体重置.
+ *
+ * @History:
+ *  2026年10月18日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#ifndef __EASEDS_ARENA_H__
+#define __EASEDS_ARENA_H__
+
+/* C 标准库头文件 */
+#include <stddef.h>
+#include <stdint.h>
+
+/* 项目内部头文件 */
+#include "easeds-public.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 默认内存块大小 */
+#define EASEDS_ARENA_CHUNK_SIZE (64 * 1024)
+
+/* 默认对齐字节数, 和 malloc 的对齐保证一致 */
+#define EASEDS_ARENA_ALIGN 16
+
+/* 对齐字节数上限 */
+#define EASEDS_ARENA_MAX_ALIGN 4096
+
+/* 内存块, 数据区紧跟在头部后面, 按 EASEDS_ARENA_ALIGN 对齐 */
+struct easeds_arena_chunk {
+    struct easeds_arena_chunk *next;   /* 下一个内存块 */
+    uint64_t                   size;   /* 数据区字节数 */
+    uint8_t                    data[]; /* 数据区 */
+};
+
+/* 分配位置标记, 回滚到标记后, 标记之后的分配全部失效 */
+struct easeds_arena_mark {
+    struct easeds_arena_chunk *chunk;  /* 标记时的当前内存块 */
+    uint64_t                   offset; /* 标记时的块内偏移 */
+    uint64_t                   used;   /* 标记时已分配的字节数 */
+};
+
+/* arena 统计信息 */
+struct easeds_arena_stats {
+    uint64_t chunks;   /* 内存块数量 */
+    uint64_t reserved; /* 内存块数据区总字节数 */
+    uint64_t used;     /* 自上次重置以来分配出去的字节数, 不含对齐填充 */
+    uint64_t peak;     /* used 的历史最大值 */
+};
+
+/**
+ * 实现一个区域分配器, 用于生命周期相同的一批对象(如单个请求内的数据), 替代逐个 malloc/free.
+ *  (1) 内存按块向系统申请, 块按申请顺序组成链表, 分配只在当前块内递增偏移, 当前块不足时转到下一块,
+ *      没有下一块或下一块放不下时申请新块插入到当前块后面, 超过块大小的请求单独申请一个足够大的块.
+ *  (2) 分配支持 2 的幂对齐, 默认按 EASEDS_ARENA_ALIGN 对齐.
+ *  (3) 标记保存当前块和偏移, 回滚时恢复, 标记之后的分配一次性失效, 标记可以嵌套, 必须按后进先出回滚.
+ *  (4) 重置把当前位置回到第一个块开头, 保留所有块供后续分配复用, 不向系统归还内存.
+ *  (5) 通过 easeds_arena_allocator 获取 struct easeds_allocator 接口, easeds_array 等容器可以从 arena 分配;
+ *      释放只在对象是最后一次分配时回收空间, 重新分配在最后一次分配上原地扩展, 否则复制到新位置.
+ *  (6) 非线程安全, 需要用户自行保证线程安全性.
+ */
+struct easeds_arena {
+    const char                *name;       /* 名称, 预留字段, 可用于调试和日志输出 */
+    struct easeds_arena_chunk *head;       /* 第一个内存块 */
+    struct easeds_arena_chunk *current;    /* 当前分配的内存块 */
+    uint64_t                   offset;     /* 当前块内的分配偏移 */
+    uint64_t                   chunk_size; /* 新申请内存块的默认数据区大小 */
+    void                      *last;       /* 最后一次分配的地址, 用于原地扩展和回收 */
+    struct easeds_arena_stats  stats;      /* 统计信息 */
+    struct easeds_allocator    allocator;  /* 分配器接口 */
+};
+
+/**
+ * 常见 arena 操作函数:
+ *
+ * 函数名                       功能描述
+ * ------------------------     ------------------------------------------------------
+ * easeds_arena_create          创建 arena, 指定内存块大小, 失败返回NULL
+ * easeds_arena_destroy         销毁 arena, 释放所有内存块
+ * easeds_arena_alloc           按默认对齐分配内存, 失败返回NULL
+ * easeds_arena_alloc_aligned   按指定对齐分配内存, 失败返回NULL
+ * easeds_arena_calloc          分配并清零内存, 失败返回NULL
+ * easeds_arena_strdup          复制字符串到 arena, 失败返回NULL
+ * easeds_arena_mark            保存当前分配位置
+ * easeds_arena_restore         回滚到保存的分配位置
+ * easeds_arena_reset           重置 arena, 保留内存块复用
+ * easeds_arena_allocator       获取分配器接口, 用于 easeds_array_create_alloc 等
+ * easeds_arena_stats           获取统计信息
+ */
+
+// 创建 arena, chunk_size 为内存块大小, 为0时使用 EASEDS_ARENA_CHUNK_SIZE, 失败返回NULL
+struct easeds_arena *easeds_arena_create(const char *name, uint64_t chunk_size);
+
+// 销毁 arena, 释放所有内存块, 从 arena 分配的内存全部失效
+void easeds_arena_destroy(struct easeds_arena *arena);
+
+// 按 EASEDS_ARENA_ALIGN 对齐分配 size 字节, size 为0时返回一个不可访问的有效地址, 失败返回NULL
+void *easeds_arena_alloc(struct easeds_arena *arena, uint64_t size);
+
+// 按 align 对齐分配 size 字节, align 必须是不超过 EASEDS_ARENA_MAX_ALIGN 的 2 的幂, 失败返回NULL
+void *easeds_arena_alloc_aligned(struct easeds_arena *arena, uint64_t size, uint64_t align);
+
+// 分配 size 字节并清零, 失败返回NULL
+void *easeds_arena_calloc(struct easeds_arena *arena, uint64_t size);
+
+// 复制以 '\0' 结尾的字符串到 arena, 失败返回NULL
+char *easeds_arena_strdup(struct easeds_arena *arena, const char *str);
+
+// 保存当前分配位置到 mark, 成功返回0, 失败返回-1
+int32_t easeds_arena_mark(struct easeds_arena *arena, struct easeds_arena_mark *mark);
+
+// 回滚到 mark 保存的分配位置, 标记之后的分配全部失效, 成功返回0, 失败返回-1
+int32_t easeds_arena_restore(struct easeds_arena *arena, const struct easeds_arena_mark *mark);
+
+// 重置 arena, 所有分配失效, 保留内存块供后续分配复用
+void easeds_arena_reset(struct easeds_arena *arena);
+
+// 获取分配器接口, 生命周期和 arena 相同, arena 为NULL时返回NULL
+const struct easeds_allocator *easeds_arena_allocator(struct easeds_arena *arena);
+
+// 获取统计信息
+void easeds_arena_stats(struct easeds_arena *arena, struct easeds_arena_stats *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __EASEDS_ARENA_H__ */
@@ -25,6 +25,49 @@
 // 项目内部头文件
 #include "easeds-log.h"
 
+// 从数组的分配器申请内存
+static inline void *array_mem_alloc(const struct easeds_allocator *allocator, size_t size)
+{
+    if (allocator == NULL) {
+        return __easeds_malloc(size);
+    }
+    return allocator->alloc_fn(allocator->ctx, size);
+}
+
+// 从数组的分配器重新申请内存, 失败时原内存保持不变
+static inline void *array_mem_realloc(
+    const struct easeds_allocator *allocator, void *ptr, size_t old_size, size_t size)
+{
+    if (allocator == NULL) {
+        return realloc(ptr, size);
+    }
+    return allocator->realloc_fn(allocator->ctx, ptr, old_size, size);
+}
+
+// 释放数组分配器申请的内存
+static inline void array_mem_free(const struct easeds_allocator *allocator, void *ptr, size_t size)
+{
+    if (allocator == NULL) {
+        __easeds_free(ptr);
+        return;
+    }
+    allocator->free_fn(allocator->ctx, ptr, size);
+}
+
+// 扩容或缩容元素内存, 成功返回0, 失败返回-1
+static int32_t array_mem_grow(struct easeds_array *array, uint32_t new_capacity)
+{
+    void *new_elements = array_mem_realloc(array->allocator, array->elements,
+        (size_t)array->element_size * array->capacity, (size_t)array->element_size * new_capacity);
+    if (unlikely(new_elements == NULL)) {
+        return -1;
+    }
+
+    array->elements = new_elements;
+    array->capacity = new_capacity;
+    return 0;
+}
+
 /**
  * @description: 创建一个动态数组, 返回数组指针, 失败返回NULL.
  * @param name 数组名称, 预留字段, 可用于调试和日志输出
@@ -34,26 +77,42 @@
  */
 struct easeds_array *easeds_array_create(
     const char *name, uint32_t element_size, uint32_t initial_capacity)
+{
+    return easeds_array_create_alloc(name, element_size, initial_capacity, NULL);
+}
+
+/**
+ * @description: 使用指定的内存分配器创建动态数组, 数组结构体和元素内存都从分配器申请.
+ * @param name 数组名称, 预留字段, 可用于调试和日志输出
+ * @param element_size 元素大小, 单位字节
+ * @param initial_capacity 初始容量, 如果为0则使用默认初始容量
+ * @param allocator 内存分配器, 为NULL时使用 __easeds_malloc, 生命周期需要长于数组
+ * @return 成功返回数组指针, 失败返回NULL
+ */
+struct easeds_array *easeds_array_create_alloc(const char *name, uint32_t element_size,
+    uint32_t initial_capacity, const struct easeds_allocator *allocator)
 {
     if (initial_capacity == 0) {
         initial_capacity = EASEDS_ARRAY_DEFAULT_INITIAL_CAPACITY;    // 默认初始容量
     }
 
     struct easeds_array *array =
-        (struct easeds_array *)__easeds_malloc(sizeof(struct easeds_array));
+        (struct easeds_array *)array_mem_alloc(allocator, sizeof(struct easeds_array));
     if (unlikely(array == NULL)) {
         EASEDS_ERR("[easeds_array_create]: Failed to allocate memory for array struct.");
         return NULL;
     }
 
-    array->elements = __easeds_malloc(element_size * initial_capacity);
+    array->elements = array_mem_alloc(allocator, (size_t)element_size * initial_capacity);
     if (unlikely(array->elements == NULL)) {
         EASEDS_ERR("[easeds_array_create]: Failed to allocate memory for array elements.");
-        __easeds_free(array);
+        array_mem_free(allocator, array, sizeof(struct easeds_array));
         return NULL;
     }
 
     // 初始化数组元信息
+    array->name         = name;
+    array->allocator    = allocator;
     array->element_size = element_size;
     array->size         = 0;
     array->capacity     = initial_capacity;
@@ -71,8 +130,11 @@ void easeds_array_destroy(struct easeds_array *array)
         return;
     }
 
-    __easeds_free(array->elements); /* 释放元素内存 */
-    __easeds_free(array);           /* 释放数组结构体内存 */
+    const struct easeds_allocator *allocator = array->allocator;
+    size_t                         bytes     = (size_t)array->element_size * array->capacity;
+
+    array_mem_free(allocator, array->elements, bytes);             /* 释放元素内存 */
+    array_mem_free(allocator, array, sizeof(struct easeds_array)); /* 释放数组结构体内存 */
 
     PFL_DEBUG("Destroyed array.");
 }
@@ -100,14 +162,11 @@ int32_t easeds_array_push_back(struct easeds_array *array, const void *element)
     /* 如果数组已满, 则需要扩容 */
     if (array->size >= array->capacity) {
         uint32_t new_capacity = array->capacity * 2; /* 扩容为原来的两倍 */
-        void    *new_elements = realloc(array->elements, array->element_size * new_capacity);
-        if (unlikely(new_elements == NULL)) {
+        if (unlikely(array_mem_grow(array, new_capacity) != 0)) {
             EASEDS_ERR(
                 "[easeds_array_push_back]: Failed to reallocate memory for array expansion.");
             return -1;
         }
-        array->elements = new_elements;
-        array->capacity = new_capacity;
         PFL_DEBUG("Expanded array capacity to %u.", new_capacity);
     }
 
@@ -159,13 +218,10 @@ int32_t easeds_array_insert(struct easeds_array *array, uint32_t index, const vo
     /* 如果数组已满, 则需要扩容 */
     if (array->size >= array->capacity) {
         uint32_t new_capacity = array->capacity * 2; /* 扩容为原来的两倍 */
-        void    *new_elements = realloc(array->elements, array->element_size * new_capacity);
-        if (unlikely(new_elements == NULL)) {
+        if (unlikely(array_mem_grow(array, new_capacity) != 0)) {
             EASEDS_ERR("[easeds_array_insert]: Failed to reallocate memory for array expansion.");
             return -1;
         }
-        array->elements = new_elements;
-        array->capacity = new_capacity;
         PFL_DEBUG("Expanded array capacity to %u.", new_capacity);
     }
 
@@ -274,6 +330,34 @@ uint32_t easeds_array_capacity(struct easeds_array *array)
     return array->capacity;
 }
 
+// 调整数组容量, 新容量不能小于当前元素数量, 成功返回0, 失败返回-1
+int32_t easeds_array_resize(struct easeds_array *array, uint32_t new_capacity)
+{
+    if (unlikely(array == NULL)) {
+        EASEDS_ERR("[easeds_array_resize]: Invalid array pointer.");
+        return -1;
+    }
+
+    if (new_capacity == 0 || new_capacity < array->size) {
+        EASEDS_ERR("[easeds_array_resize]: Invalid capacity %u, size is %u.", new_capacity,
+            array->size);
+        return -1;
+    }
+
+    if (new_capacity == array->capacity) {
+        return 0;
+    }
+
+    if (unlikely(array_mem_grow(array, new_capacity) != 0)) {
+        EASEDS_ERR("[easeds_array_resize]: Failed to reallocate memory for capacity %u.",
+            new_capacity);
+        return -1;
+    }
+
+    PFL_DEBUG("Resized array capacity to %u.", new_capacity);
+    return 0;
+}
+
 // 遍历数组元素, 对每个元素执行指定的回调函数
 void easeds_array_foreach(
     struct easeds_array *array, void (*callback)(void *element, void *user_data), void *user_data)
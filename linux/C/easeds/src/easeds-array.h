@@ -40,14 +40,16 @@ extern "C" {
  *  (5) 数组支持销毁操作, 释放数组内存, 包括元素内存和数组结构体内存.
  *  (6) 数组非线程安全, 需要用户自行保证线程安全性.
  *  (7) 支持可定位性, 支持 Debug 日志.
+ *  (8) 可以指定内存分配器(如 arena), 数组结构体和元素内存都从分配器申请, 未指定时使用 __easeds_malloc.
  */
 struct easeds_array {
-    const char *name;         /* 数组名称, 预留字段, 可用于调试和日志输出 */
-    void       *elements;     /* 指向元素的指针 */
-    uint32_t    element_size; /* 元素大小 */
-    uint32_t    size;         /* 当前元素数量 */
-    uint32_t    capacity;     /* 数组容量 */
-    uint32_t    flags;        /* 数组标志位, 预留字段 */
+    const char                    *name;         /* 数组名称, 预留字段, 可用于调试和日志输出 */
+    void                          *elements;     /* 指向元素的指针 */
+    const struct easeds_allocator *allocator;    /* 内存分配器, NULL 表示使用 __easeds_malloc */
+    uint32_t                       element_size; /* 元素大小 */
+    uint32_t                       size;         /* 当前元素数量 */
+    uint32_t                       capacity;     /* 数组容量 */
+    uint32_t                       flags;        /* 数组标志位, 预留字段 */
 };
 
 // 动态数组默认初始容量
@@ -59,6 +61,7 @@ struct easeds_array {
  * 函数名                       功能描述
  * ------------------------     ------------------------------------------------------
  * easeds_array_create          创建一个动态数组, 返回数组指针, 失败返回NULL
+ * easeds_array_create_alloc    使用指定的内存分配器创建动态数组, 失败返回NULL
  * easeds_array_destroy         销毁动态数组, 释放内存
  * easeds_array_clear           清空动态数组, 删除所有元素, 但不释放内存
  * easeds_array_size            获取数组当前元素数量
@@ -79,6 +82,10 @@ struct easeds_array {
 struct easeds_array *easeds_array_create(
     const char *name, uint32_t element_size, uint32_t initial_capacity);
 
+// 使用指定的内存分配器创建动态数组, allocator 为NULL时等同于 easeds_array_create, 失败返回NULL
+struct easeds_array *easeds_array_create_alloc(const char *name, uint32_t element_size,
+    uint32_t initial_capacity, const struct easeds_allocator *allocator);
+
 // 销毁动态数组, 释放内存
 void easeds_array_destroy(struct easeds_array *array);
 
@@ -0,0 +1,463 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-art-unittest.c
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-18 20:20
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  Easeds 自适应基数树单元测试实现文件, 包含了增删查/区间遍历/节点类型变化/与哈希和树的性能对比.
+ *
+ * @History:
+ *  2026年10月18日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#include "easeds-unittest.h"
+
+// 项目内部头文件
+#include "easeds-art.h"
+#include "easeds-bptree.h"
+#include "easeds-cache.h"
+#include "easeds-tree.h"
+#include "easeds-utils.h"
+
+#define ART_TEST_VALUE(key) ((void *)(uintptr_t)((key) ^ 0x5A5A5A5AULL))
+
+// 红黑树对照节点, 用于性能对比
+struct art_rb_node {
+    RB_ENTRY(art_rb_node) entry;
+    uint64_t key;
+};
+
+static int32_t art_rb_cmp(const struct art_rb_node *a, const struct art_rb_node *b)
+{
+    return (a->key > b->key) - (a->key < b->key);
+}
+
+RB_HEAD(art_rb_tree, art_rb_node);
+RB_GENERATE_STATIC(art_rb_tree, art_rb_node, entry, art_rb_cmp)
+
+/* 区间遍历的检查上下文 */
+struct art_range_ctx {
+    uint64_t last;  /* 上一个键, 检查升序 */
+    uint64_t count; /* 遍历数量 */
+    uint64_t sum;   /* 键的累加和 */
+    bool     ok;    /* 值和顺序是否正确 */
+    uint8_t  pad[7];
+};
+
+static void art_range_cb(uint64_t key, void *value, void *user_data)
+{
+    struct art_range_ctx *ctx = user_data;
+
+    if (value != ART_TEST_VALUE(key) || (ctx->count != 0 && key <= ctx->last)) {
+        ctx->ok = false;
+    }
+    ctx->last = key;
+    ctx->count++;
+    ctx->sum += key;
+}
+
+static void art_count_cb(uint64_t key, void *value, void *user_data)
+{
+    easeds_unused(key);
+    easeds_unused(value);
+    (*(uint64_t *)user_data)++;
+}
+
+static uint64_t art_next_rand(uint64_t *seed)
+{
+    *seed ^= *seed << 13;
+    *seed ^= *seed >> 7;
+    *seed ^= *seed << 17;
+    return *seed;
+}
+
+// 区间遍历并和逐个比较的结果对照
+static void art_check_range(struct easeds_art *tree, const uint64_t *keys, const bool *alive,
+    uint32_t count, uint64_t low, uint64_t high)
+{
+    struct art_range_ctx ctx    = {.ok = true};
+    uint64_t             expect = 0, expect_sum = 0;
+
+    for (uint32_t i = 0; i < count; i++) {
+        if (alive[i] && keys[i] >= low && keys[i] <= high) {
+            expect++;
+            expect_sum += keys[i];
+        }
+    }
+
+    assert_int_equal(easeds_art_range(tree, low, high, art_range_cb, &ctx), expect);
+    assert_true(ctx.ok);
+    assert_int_equal(ctx.count, expect);
+    assert_int_equal(ctx.sum, expect_sum);
+}
+
+// 基本功能测试: 插入覆盖, 查找, 最小最大键, 区间遍历, 删除
+static void test_easeds_art_basic(void **state)
+{
+    easeds_unused(state);
+
+    const uint64_t keys[] = {0x1122334455667788ULL, 0x1122334455667799ULL, 0x1122334400000000ULL,
+        0x1122FFFF00000000ULL, 42, 0xFF00000000000000ULL, 43};
+    const uint32_t nkeys  = sizeof(keys) / sizeof(keys[0]);
+
+    struct easeds_art *tree = easeds_art_create("basic");
+    assert_non_null(tree);
+    assert_int_equal(easeds_art_size(tree), 0);
+    assert_int_equal(easeds_art_min(tree, NULL, NULL), EASEDS_ERROR);
+
+    for (uint32_t i = 0; i < nkeys; i++) {
+        assert_int_equal(easeds_art_insert(tree, keys[i], ART_TEST_VALUE(keys[i])), EASEDS_OK);
+        assert_int_equal(easeds_art_verify(tree), EASEDS_OK);
+    }
+    assert_int_equal(easeds_art_size(tree), nkeys);
+
+    void *value = NULL;
+    for (uint32_t i = 0; i < nkeys; i++) {
+        assert_int_equal(easeds_art_find(tree, keys[i], &value), EASEDS_OK);
+        assert_true(value == ART_TEST_VALUE(keys[i]));
+    }
+    assert_int_equal(easeds_art_find(tree, 0x1122334455667700ULL, NULL), EASEDS_ERROR);
+    assert_int_equal(easeds_art_find(tree, 0x1122330000000000ULL, NULL), EASEDS_ERROR);
+    assert_int_equal(easeds_art_find(tree, 44, NULL), EASEDS_ERROR);
+
+    // 覆盖旧值, 数量不变
+    assert_int_equal(easeds_art_insert(tree, 42, ART_TEST_VALUE(0)), EASEDS_OK);
+    assert_int_equal(easeds_art_size(tree), nkeys);
+    assert_int_equal(easeds_art_find(tree, 42, &value), EASEDS_OK);
+    assert_true(value == ART_TEST_VALUE(0));
+    assert_int_equal(easeds_art_insert(tree, 42, ART_TEST_VALUE(42)), EASEDS_OK);
+
+    uint64_t key = 0;
+    assert_int_equal(easeds_art_min(tree, &key, &value), EASEDS_OK);
+    assert_int_equal(key, 42);
+    assert_int_equal(easeds_art_max(tree, &key, NULL), EASEDS_OK);
+    assert_int_equal(key, 0xFF00000000000000ULL);
+
+    // 区间遍历, 升序
+    struct art_range_ctx ctx = {.ok = true};
+    assert_int_equal(
+        easeds_art_range(tree, 0x1122334400000000ULL, 0x11223344FFFFFFFFULL, art_range_cb, &ctx),
+        3);
+    assert_true(ctx.ok);
+    assert_int_equal(ctx.last, 0x1122334455667799ULL);
+    ctx = (struct art_range_ctx){.ok = true};
+    assert_int_equal(easeds_art_range(tree, 0, UINT64_MAX, art_range_cb, &ctx), nkeys);
+    assert_true(ctx.ok);
+    assert_int_equal(easeds_art_range(tree, 44, 0x1122334400000000ULL - 1, art_range_cb, &ctx), 0);
+
+    for (uint32_t i = 0; i < nkeys; i++) {
+        assert_int_equal(easeds_art_remove(tree, keys[i], &value), EASEDS_OK);
+        assert_true(value == ART_TEST_VALUE(keys[i]));
+        assert_int_equal(easeds_art_remove(tree, keys[i], NULL), EASEDS_ERROR);
+        assert_int_equal(easeds_art_verify(tree), EASEDS_OK);
+    }
+    assert_int_equal(easeds_art_size(tree), 0);
+    assert_null(tree->root);
+    assert_int_equal(easeds_art_memory(tree), 0);
+
+    easeds_art_destroy(tree);
+}
+
+// 基本功能测试: 随机键和聚集键混合插入删除, 区间遍历和逐个比较对照
+static void test_easeds_art_operations(void **state)
+{
+    easeds_unused(state);
+
+    const uint32_t count = 50000;
+    uint64_t      *keys  = malloc(count * sizeof(uint64_t));
+    bool          *alive = calloc(count, sizeof(bool));
+    assert_non_null(keys);
+    assert_non_null(alive);
+
+    struct easeds_art *tree = easeds_art_create("ops");
+    assert_non_null(tree);
+
+    // 三分之一完全随机, 三分之一聚集在少数高位前缀下, 三分之一为连续键, 重复的键重新生成
+    uint64_t seed = 0x2545F4914F6CDD1DULL;
+    for (uint32_t i = 0; i < count; i++) {
+        do {
+            uint64_t r = art_next_rand(&seed);
+            keys[i]    = i % 3 == 0   ? r
+                         : i % 3 == 1 ? (r & 0x0300000000FFFFFFULL) | 0xABCD000000000000ULL
+                                      : 0x7700000000000000ULL + i;
+        } while (easeds_art_find(tree, keys[i], NULL) == EASEDS_OK);
+        assert_int_equal(easeds_art_insert(tree, keys[i], ART_TEST_VALUE(keys[i])), EASEDS_OK);
+        alive[i] = true;
+    }
+    assert_int_equal(easeds_art_size(tree), count);
+    assert_int_equal(easeds_art_verify(tree), EASEDS_OK);
+    assert_true(tree->nodes[EASEDS_ART_NODE256] > 0);
+
+    const uint64_t ranges[][2] = {
+        {0, UINT64_MAX},
+        {0xABCD000000000000ULL, 0xABCD0000FFFFFFFFULL},
+        {0x7700000000000000ULL + 100, 0x7700000000000000ULL + 30000},
+        {0x1234, 0x8000000000000000ULL},
+        {0xABCD0100007FFFFFULL, 0xABCD0200000000FFULL},
+        {UINT64_MAX - 1000, UINT64_MAX},
+    };
+    for (uint32_t r = 0; r < sizeof(ranges) / sizeof(ranges[0]); r++) {
+        art_check_range(tree, keys, alive, count, ranges[r][0], ranges[r][1]);
+    }
+
+    // 随机删除约一半
+    for (uint32_t n = 0; n < count; n++) {
+        uint32_t i     = (uint32_t)(art_next_rand(&seed) % count);
+        void    *value = NULL;
+        int32_t  ret   = easeds_art_remove(tree, keys[i], &value);
+        if (alive[i]) {
+            assert_int_equal(ret, EASEDS_OK);
+            assert_true(value == ART_TEST_VALUE(keys[i]));
+            alive[i] = false;
+        } else {
+            assert_int_equal(ret, EASEDS_ERROR);
+        }
+        if (n % 5000 == 0) {
+            assert_int_equal(easeds_art_verify(tree), EASEDS_OK);
+        }
+    }
+    assert_int_equal(easeds_art_verify(tree), EASEDS_OK);
+
+    uint64_t left = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        left += alive[i];
+        int32_t ret = easeds_art_find(tree, keys[i], NULL);
+        assert_int_equal(ret, alive[i] ? EASEDS_OK : EASEDS_ERROR);
+    }
+    assert_int_equal(easeds_art_size(tree), left);
+    for (uint32_t r = 0; r < sizeof(ranges) / sizeof(ranges[0]); r++) {
+        art_check_range(tree, keys, alive, count, ranges[r][0], ranges[r][1]);
+    }
+
+    // 全部删除后没有残留节点
+    for (uint32_t i = 0; i < count; i++) {
+        easeds_art_remove(tree, keys[i], NULL);
+    }
+    assert_int_equal(easeds_art_size(tree), 0);
+    assert_int_equal(easeds_art_memory(tree), 0);
+    assert_int_equal(easeds_art_verify(tree), EASEDS_OK);
+
+    easeds_art_destroy(tree);
+    free(alive);
+    free(keys);
+}
+
+// 边界测试: 0 和最大键, 单层 256 分支的升级降级, 压缩路径分裂和合并
+static void test_easeds_art_boundary(void **state)
+{
+    easeds_unused(state);
+
+    struct easeds_art *tree = easeds_art_create("boundary");
+    assert_non_null(tree);
+
+    assert_int_equal(easeds_art_insert(tree, 0, ART_TEST_VALUE(0)), EASEDS_OK);
+    assert_int_equal(easeds_art_insert(tree, UINT64_MAX, ART_TEST_VALUE(UINT64_MAX)), EASEDS_OK);
+    uint64_t key = 1;
+    assert_int_equal(easeds_art_min(tree, &key, NULL), EASEDS_OK);
+    assert_int_equal(key, 0);
+    assert_int_equal(easeds_art_max(tree, &key, NULL), EASEDS_OK);
+    assert_int_equal(key, UINT64_MAX);
+    assert_true(tree->root != NULL && tree->root->prefix_len == 0);
+
+    // 只有最低字节不同的 256 个键, 最低层节点依次升级, 上层为 7 字节压缩路径
+    for (uint64_t b = 1; b < 256; b++) {
+        assert_int_equal(easeds_art_insert(tree, b, ART_TEST_VALUE(b)), EASEDS_OK);
+    }
+    assert_int_equal(easeds_art_verify(tree), EASEDS_OK);
+    assert_int_equal(tree->nodes[EASEDS_ART_NODE256], 1);
+    uint64_t counted = 0;
+    assert_int_equal(easeds_art_range(tree, 16, 31, art_count_cb, &counted), 16);
+    assert_int_equal(counted, 16);
+
+    // 倒序删除, 节点依次降级, 最后合并回根节点
+    for (uint64_t b = 255; b > 0; b--) {
+        assert_int_equal(easeds_art_remove(tree, b, NULL), EASEDS_OK);
+        if (b % 8 == 0) {
+            assert_int_equal(easeds_art_verify(tree), EASEDS_OK);
+        }
+    }
+    assert_int_equal(easeds_art_verify(tree), EASEDS_OK);
+    assert_int_equal(tree->nodes[EASEDS_ART_NODE256] + tree->nodes[EASEDS_ART_NODE48]
+                         + tree->nodes[EASEDS_ART_NODE16],
+        0);
+    assert_int_equal(tree->nodes[EASEDS_ART_NODE4], 1);
+
+    // 在压缩路径中间分裂, 删除后重新合并
+    assert_int_equal(easeds_art_insert(tree, 0x0000FF0000000000ULL, NULL), EASEDS_OK);
+    assert_int_equal(easeds_art_insert(tree, 0x0000FF0000000001ULL, NULL), EASEDS_OK);
+    assert_int_equal(easeds_art_insert(tree, 0x0000FF0100000000ULL, NULL), EASEDS_OK);
+    assert_int_equal(easeds_art_verify(tree), EASEDS_OK);
+    assert_int_equal(easeds_art_remove(tree, 0x0000FF0100000000ULL, NULL), EASEDS_OK);
+    assert_int_equal(easeds_art_verify(tree), EASEDS_OK);
+    assert_int_equal(easeds_art_find(tree, 0x0000FF0000000001ULL, NULL), EASEDS_OK);
+    assert_int_equal(easeds_art_range(tree, 1, UINT64_MAX - 1, art_count_cb, &counted), 2);
+
+    // 清空后复用, 空区间
+    easeds_art_clear(tree);
+    assert_int_equal(easeds_art_size(tree), 0);
+    assert_int_equal(easeds_art_memory(tree), 0);
+    assert_int_equal(easeds_art_range(tree, 0, UINT64_MAX, art_count_cb, &counted), 0);
+    assert_int_equal(easeds_art_insert(tree, 7, NULL), EASEDS_OK);
+    assert_int_equal(easeds_art_range(tree, 8, 6, art_count_cb, &counted), 0);
+    easeds_art_destroy(tree);
+}
+
+// 失效测试: 非法参数
+static void test_easeds_art_error(void **state)
+{
+    easeds_unused(state);
+
+    void *value = NULL;
+    assert_int_equal(easeds_art_insert(NULL, 1, NULL), EASEDS_ERROR);
+    assert_int_equal(easeds_art_remove(NULL, 1, NULL), EASEDS_ERROR);
+    assert_int_equal(easeds_art_find(NULL, 1, &value), EASEDS_ERROR);
+    assert_int_equal(easeds_art_min(NULL, NULL, NULL), EASEDS_ERROR);
+    assert_int_equal(easeds_art_max(NULL, NULL, NULL), EASEDS_ERROR);
+    assert_int_equal(easeds_art_range(NULL, 0, 1, art_count_cb, NULL), 0);
+    assert_int_equal(easeds_art_verify(NULL), EASEDS_ERROR);
+    assert_int_equal(easeds_art_size(NULL), 0);
+    assert_int_equal(easeds_art_memory(NULL), 0);
+    easeds_art_destroy(NULL);
+
+    struct easeds_art *tree = easeds_art_create("error");
+    assert_non_null(tree);
+    assert_int_equal(easeds_art_insert(tree, 1, NULL), EASEDS_OK);
+    assert_int_equal(easeds_art_range(tree, 0, 1, NULL, NULL), 0);
+    assert_int_equal(easeds_art_find(tree, 2, &value), EASEDS_ERROR);
+    assert_int_equal(easeds_art_remove(tree, 2, &value), EASEDS_ERROR);
+    assert_int_equal(easeds_art_max(tree, NULL, &value), EASEDS_OK);
+    easeds_art_destroy(tree);
+}
+
+// 性能测试: 随机键和连续键, 对比 B+ 树, 红黑树和哈希表
+static void test_easeds_art_perf(void **state)
+{
+    easeds_unused(state);
+
+    const uint32_t      count = 1000000;
+    uint64_t           *keys  = malloc(count * sizeof(uint64_t));
+    struct art_rb_node *nodes = malloc(count * sizeof(struct art_rb_node));
+    assert_non_null(keys);
+    assert_non_null(nodes);
+
+    for (uint32_t pattern = 0; pattern < 2; pattern++) {
+        const char *name = pattern == 0 ? "random" : "sequential";
+        uint64_t    seed = 88172645463325252ULL;
+        for (uint32_t i = 0; i < count; i++) {
+            keys[i] = pattern == 0 ? art_next_rand(&seed) : 1000000000ULL + i;
+        }
+
+        struct easeds_art    *art    = easeds_art_create("perf");
+        struct easeds_bptree *bptree = easeds_bptree_create("perf");
+        struct easeds_cache *hash = easeds_cache_create("perf", EASEDS_CACHE_CLOCK,
+            EASEDS_CACHE_BY_COUNT, count);
+        struct art_rb_tree rb = RB_HEAD_INITIALIZER(rb);
+        assert_non_null(art);
+        assert_non_null(bptree);
+        assert_non_null(hash);
+
+        int64_t start = easeds_get_current_time_ns();
+        for (uint32_t i = 0; i < count; i++) {
+            assert_int_equal(easeds_art_insert(art, keys[i], ART_TEST_VALUE(keys[i])), EASEDS_OK);
+        }
+        int64_t art_insert = easeds_get_current_time_ns() - start;
+
+        start = easeds_get_current_time_ns();
+        for (uint32_t i = 0; i < count; i++) {
+            assert_int_equal(easeds_bptree_insert(bptree, keys[i], NULL), EASEDS_OK);
+        }
+        int64_t bptree_insert = easeds_get_current_time_ns() - start;
+
+        start = easeds_get_current_time_ns();
+        for (uint32_t i = 0; i < count; i++) {
+            nodes[i].key = keys[i];
+            RB_INSERT(art_rb_tree, &rb, &nodes[i]);
+        }
+        int64_t rb_insert = easeds_get_current_time_ns() - start;
+
+        start = easeds_get_current_time_ns();
+        for (uint32_t i = 0; i < count; i++) {
+            assert_int_equal(
+                easeds_cache_put(hash, &keys[i], sizeof(uint64_t), NULL, 1), EASEDS_OK);
+        }
+        int64_t hash_insert = easeds_get_current_time_ns() - start;
+
+        // 按另一种随机顺序查找
+        uint32_t *order = malloc(count * sizeof(uint32_t));
+        assert_non_null(order);
+        for (uint32_t i = 0; i < count; i++) {
+            order[i] = (uint32_t)(((uint64_t)i * 2654435761ULL) % count);
+        }
+
+        start = easeds_get_current_time_ns();
+        for (uint32_t i = 0; i < count; i++) {
+            assert_int_equal(easeds_art_find(art, keys[order[i]], NULL), EASEDS_OK);
+        }
+        int64_t art_find = easeds_get_current_time_ns() - start;
+
+        start = easeds_get_current_time_ns();
+        for (uint32_t i = 0; i < count; i++) {
+            assert_int_equal(easeds_bptree_find(bptree, keys[order[i]], NULL), EASEDS_OK);
+        }
+        int64_t bptree_find = easeds_get_current_time_ns() - start;
+
+        start = easeds_get_current_time_ns();
+        for (uint32_t i = 0; i < count; i++) {
+            struct art_rb_node find = {.key = keys[order[i]]};
+            assert_non_null(RB_FIND(art_rb_tree, &rb, &find));
+        }
+        int64_t rb_find = easeds_get_current_time_ns() - start;
+
+        start = easeds_get_current_time_ns();
+        for (uint32_t i = 0; i < count; i++) {
+            assert_true(easeds_cache_contains(hash, &keys[order[i]], sizeof(uint64_t)));
+        }
+        int64_t hash_find = easeds_get_current_time_ns() - start;
+
+        // 全区间有序遍历
+        uint64_t scanned = 0;
+        start            = easeds_get_current_time_ns();
+        assert_int_equal(easeds_art_range(art, 0, UINT64_MAX, art_count_cb, &scanned), count);
+        int64_t art_scan = easeds_get_current_time_ns() - start;
+
+        assert_int_equal(easeds_art_verify(art), EASEDS_OK);
+        uint64_t memory = easeds_art_memory(art);
+        MEASURE("[art perf]: %s %u keys, insert ns/op: art %.1f, bptree %.1f, rbtree %.1f, "
+                "hash %.1f.",
+            name, count, (double)art_insert / count, (double)bptree_insert / count,
+            (double)rb_insert / count, (double)hash_insert / count);
+        MEASURE("[art perf]: %s %u keys, find ns/op: art %.1f, bptree %.1f, rbtree %.1f, "
+                "hash %.1f.",
+            name, count, (double)art_find / count, (double)bptree_find / count,
+            (double)rb_find / count, (double)hash_find / count);
+        MEASURE("[art perf]: %s, art scan %.2f ns/key, memory %.1f bytes/key, nodes n4=%lu "
+                "n16=%lu n48=%lu n256=%lu.",
+            name, (double)art_scan / count, (double)memory / count, art->nodes[EASEDS_ART_NODE4],
+            art->nodes[EASEDS_ART_NODE16], art->nodes[EASEDS_ART_NODE48],
+            art->nodes[EASEDS_ART_NODE256]);
+
+        free(order);
+        easeds_cache_destroy(hash);
+        easeds_bptree_destroy(bptree);
+        easeds_art_destroy(art);
+    }
+
+    free(nodes);
+    free(keys);
+}
+
+// 注册单元测试用例
+EASEDS_UNITTEST_REGISTER(easeds_unittest_art){
+    cmocka_unit_test(test_easeds_art_basic),
+    cmocka_unit_test(test_easeds_art_operations),
+    cmocka_unit_test(test_easeds_art_boundary),
+    cmocka_unit_test(test_easeds_art_error),
+    cmocka_unit_test(test_easeds_art_perf),
+    easeds_unit_test_end,
+};
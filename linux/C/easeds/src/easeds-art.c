@@ -0,0 +1,919 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-art.c
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-18 19:50
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  自适应基数树(Adaptive Radix Tree)实现文件.
+ *
+ * @History:
+ *  2026年10月18日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#include "easeds-art.h"
+
+// 标准库头文件
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+// 项目内部头文件
+#include "easeds-log.h"
+
+/* 叶子指针最低位标记为 1, 叶子按 8 字节对齐分配, 最低位总是空闲 */
+#define ART_IS_LEAF(node)  (((uintptr_t)(node) & 1) != 0)
+#define ART_LEAF(node)     ((struct easeds_art_leaf *)((uintptr_t)(node) & ~(uintptr_t)1))
+#define ART_LEAF_PTR(leaf) ((struct easeds_art_node *)((uintptr_t)(leaf) | 1))
+
+/* 各类型节点结构体大小 */
+static const uint32_t art_node_size[EASEDS_ART_TYPES] = {
+    sizeof(struct easeds_art_leaf),
+    sizeof(struct easeds_art_node4),
+    sizeof(struct easeds_art_node16),
+    sizeof(struct easeds_art_node48),
+    sizeof(struct easeds_art_node256),
+};
+
+/* 各类型节点的子节点容量 */
+static const uint32_t art_node_capacity[EASEDS_ART_TYPES] = {0, 4, 16, 48, 256};
+
+/* 删除子节点后降级的阈值, 和升级点错开避免抖动, NODE4 只剩一个子节点时直接和子节点合并 */
+static const uint32_t art_shrink_threshold[EASEDS_ART_TYPES] = {0, 1, 3, 12, 40};
+
+// 获取键在第 depth 层的字节, 按大端顺序, depth 必须小于 8
+static inline uint8_t art_key_byte(uint64_t key, uint32_t depth)
+{
+    return (uint8_t)(key >> (56 - 8 * depth));
+}
+
+// 分配指定类型的空内部节点, 失败返回NULL
+static struct easeds_art_node *art_node_alloc(struct easeds_art *tree, uint8_t type)
+{
+    struct easeds_art_node *node = __easeds_malloc(art_node_size[type]);
+    if (unlikely(node == NULL)) {
+        EASEDS_ERR("[art_node_alloc]: Malloc node type %u failed.", type);
+        return NULL;
+    }
+
+    /* 子节点数组和 NODE48 下标表都需要清零 */
+    memset(node, 0, art_node_size[type]);
+    node->type = type;
+
+    tree->memory += art_node_size[type];
+    tree->nodes[type]++;
+    return node;
+}
+
+// 释放单个内部节点, 不处理子节点
+static void art_node_free(struct easeds_art *tree, struct easeds_art_node *node)
+{
+    tree->memory -= art_node_size[node->type];
+    tree->nodes[node->type]--;
+    __easeds_free(node);
+}
+
+// 分配叶子, 返回带标记的指针, 失败返回NULL
+static struct easeds_art_node *art_leaf_alloc(struct easeds_art *tree, uint64_t key, void *value)
+{
+    struct easeds_art_leaf *leaf = __easeds_malloc(sizeof(struct easeds_art_leaf));
+    if (unlikely(leaf == NULL)) {
+        EASEDS_ERR("[art_leaf_alloc]: Malloc leaf for key %lu failed.", key);
+        return NULL;
+    }
+
+    leaf->key   = key;
+    leaf->value = value;
+    tree->memory += sizeof(struct easeds_art_leaf);
+    tree->nodes[EASEDS_ART_LEAF]++;
+    return ART_LEAF_PTR(leaf);
+}
+
+// 释放叶子, 参数为带标记的指针
+static void art_leaf_free(struct easeds_art *tree, struct easeds_art_node *node)
+{
+    tree->memory -= sizeof(struct easeds_art_leaf);
+    tree->nodes[EASEDS_ART_LEAF]--;
+    __easeds_free(ART_LEAF(node));
+}
+
+// 查找边字节对应的子节点槽位, 不存在返回NULL
+static struct easeds_art_node **art_find_child(struct easeds_art_node *node, uint8_t byte)
+{
+    switch (node->type) {
+    case EASEDS_ART_NODE4: {
+        struct easeds_art_node4 *n4 = (struct easeds_art_node4 *)node;
+        for (uint32_t i = 0; i < node->count; i++) {
+            if (n4->keys[i] == byte) {
+                return &n4->children[i];
+            }
+        }
+        return NULL;
+    }
+    case EASEDS_ART_NODE16: {
+        struct easeds_art_node16 *n16 = (struct easeds_art_node16 *)node;
+#ifdef __SSE2__
+        /* 一次比较 16 个边字节, 屏蔽掉 count 之后的无效位 */
+        __m128i  keys = _mm_loadu_si128((const __m128i *)n16->keys);
+        __m128i  cmp  = _mm_cmpeq_epi8(keys, _mm_set1_epi8((char)byte));
+        uint32_t mask = (uint32_t)_mm_movemask_epi8(cmp) & ((1U << node->count) - 1);
+        return mask != 0 ? &n16->children[__builtin_ctz(mask)] : NULL;
+#else
+        for (uint32_t i = 0; i < node->count; i++) {
+            if (n16->keys[i] == byte) {
+                return &n16->children[i];
+            }
+        }
+        return NULL;
+#endif
+    }
+    case EASEDS_ART_NODE48: {
+        struct easeds_art_node48 *n48  = (struct easeds_art_node48 *)node;
+        uint8_t                   slot = n48->index[byte];
+        return slot != 0 ? &n48->children[slot - 1] : NULL;
+    }
+    case EASEDS_ART_NODE256: {
+        struct easeds_art_node256 *n256 = (struct easeds_art_node256 *)node;
+        return n256->children[byte] != NULL ? &n256->children[byte] : NULL;
+    }
+    default:
+        return NULL;
+    }
+}
+
+// 按边字节升序迭代子节点, pos 为迭代状态(初始为0), 没有更多子节点返回NULL
+static struct easeds_art_node *art_child_iter(
+    struct easeds_art_node *node, uint32_t *pos, uint8_t *byte)
+{
+    switch (node->type) {
+    case EASEDS_ART_NODE4: {
+        struct easeds_art_node4 *n4 = (struct easeds_art_node4 *)node;
+        if (*pos >= node->count) {
+            return NULL;
+        }
+        *byte = n4->keys[*pos];
+        return n4->children[(*pos)++];
+    }
+    case EASEDS_ART_NODE16: {
+        struct easeds_art_node16 *n16 = (struct easeds_art_node16 *)node;
+        if (*pos >= node->count) {
+            return NULL;
+        }
+        *byte = n16->keys[*pos];
+        return n16->children[(*pos)++];
+    }
+    case EASEDS_ART_NODE48: {
+        struct easeds_art_node48 *n48 = (struct easeds_art_node48 *)node;
+        while (*pos < 256) {
+            uint8_t b = (uint8_t)(*pos)++;
+            if (n48->index[b] != 0) {
+                *byte = b;
+                return n48->children[n48->index[b] - 1];
+            }
+        }
+        return NULL;
+    }
+    case EASEDS_ART_NODE256: {
+        struct easeds_art_node256 *n256 = (struct easeds_art_node256 *)node;
+        while (*pos < 256) {
+            uint8_t b = (uint8_t)(*pos)++;
+            if (n256->children[b] != NULL) {
+                *byte = b;
+                return n256->children[b];
+            }
+        }
+        return NULL;
+    }
+    default:
+        return NULL;
+    }
+}
+
+// 获取边字节最大的子节点, 用于查找最大键
+static struct easeds_art_node *art_last_child(struct easeds_art_node *node)
+{
+    switch (node->type) {
+    case EASEDS_ART_NODE4:
+        return ((struct easeds_art_node4 *)node)->children[node->count - 1];
+    case EASEDS_ART_NODE16:
+        return ((struct easeds_art_node16 *)node)->children[node->count - 1];
+    case EASEDS_ART_NODE48: {
+        struct easeds_art_node48 *n48 = (struct easeds_art_node48 *)node;
+        for (uint32_t b = 256; b-- > 0;) {
+            if (n48->index[b] != 0) {
+                return n48->children[n48->index[b] - 1];
+            }
+        }
+        return NULL;
+    }
+    case EASEDS_ART_NODE256: {
+        struct easeds_art_node256 *n256 = (struct easeds_art_node256 *)node;
+        for (uint32_t b = 256; b-- > 0;) {
+            if (n256->children[b] != NULL) {
+                return n256->children[b];
+            }
+        }
+        return NULL;
+    }
+    default:
+        return NULL;
+    }
+}
+
+// 在有序键数组中插入边字节和子节点, 数组必须还有空位
+static void art_sorted_put(uint8_t *keys, struct easeds_art_node **children, uint32_t count,
+    uint8_t byte, struct easeds_art_node *child)
+{
+    uint32_t i = count;
+
+    while (i > 0 && keys[i - 1] > byte) {
+        keys[i]     = keys[i - 1];
+        children[i] = children[i - 1];
+        i--;
+    }
+    keys[i]     = byte;
+    children[i] = child;
+}
+
+// 在节点中添加子节点, 节点必须还有空位且边字节不存在
+static void art_node_put(struct easeds_art_node *node, uint8_t byte, struct easeds_art_node *child)
+{
+    switch (node->type) {
+    case EASEDS_ART_NODE4: {
+        struct easeds_art_node4 *n4 = (struct easeds_art_node4 *)node;
+        art_sorted_put(n4->keys, n4->children, node->count, byte, child);
+        break;
+    }
+    case EASEDS_ART_NODE16: {
+        struct easeds_art_node16 *n16 = (struct easeds_art_node16 *)node;
+        art_sorted_put(n16->keys, n16->children, node->count, byte, child);
+        break;
+    }
+    case EASEDS_ART_NODE48: {
+        struct easeds_art_node48 *n48  = (struct easeds_art_node48 *)node;
+        uint32_t                  slot = 0;
+        while (n48->children[slot] != NULL) {
+            slot++;
+        }
+        n48->children[slot] = child;
+        n48->index[byte]    = (uint8_t)(slot + 1);
+        break;
+    }
+    case EASEDS_ART_NODE256: {
+        struct easeds_art_node256 *n256 = (struct easeds_art_node256 *)node;
+        n256->children[byte]            = child;
+        break;
+    }
+    default:
+        return;
+    }
+    node->count++;
+}
+
+// 从节点中摘除边字节对应的子节点, 边字节必须存在
+static void art_node_drop(struct easeds_art_node *node, uint8_t byte)
+{
+    switch (node->type) {
+    case EASEDS_ART_NODE4:
+    case EASEDS_ART_NODE16: {
+        uint8_t                 *keys;
+        struct easeds_art_node **children;
+        if (node->type == EASEDS_ART_NODE4) {
+            keys     = ((struct easeds_art_node4 *)node)->keys;
+            children = ((struct easeds_art_node4 *)node)->children;
+        } else {
+            keys     = ((struct easeds_art_node16 *)node)->keys;
+            children = ((struct easeds_art_node16 *)node)->children;
+        }
+        uint32_t i = 0;
+        while (i < node->count && keys[i] != byte) {
+            i++;
+        }
+        for (; i + 1 < node->count; i++) {
+            keys[i]     = keys[i + 1];
+            children[i] = children[i + 1];
+        }
+        break;
+    }
+    case EASEDS_ART_NODE48: {
+        struct easeds_art_node48 *n48       = (struct easeds_art_node48 *)node;
+        n48->children[n48->index[byte] - 1] = NULL;
+        n48->index[byte]                    = 0;
+        break;
+    }
+    case EASEDS_ART_NODE256: {
+        struct easeds_art_node256 *n256 = (struct easeds_art_node256 *)node;
+        n256->children[byte]            = NULL;
+        break;
+    }
+    default:
+        return;
+    }
+    node->count--;
+}
+
+// 把节点替换为另一种类型, 迁移压缩路径和子节点, 成功返回0, 失败返回-1且原节点不变
+static int32_t art_node_retype(struct easeds_art *tree, struct easeds_art_node **ref, uint8_t type)
+{
+    struct easeds_art_node *node = *ref;
+    struct easeds_art_node *copy = art_node_alloc(tree, type);
+    if (unlikely(copy == NULL)) {
+        return -1;
+    }
+
+    copy->prefix_len = node->prefix_len;
+    memcpy(copy->prefix, node->prefix, sizeof(node->prefix));
+
+    struct easeds_art_node *child;
+    uint32_t                pos  = 0;
+    uint8_t                 byte = 0;
+    while ((child = art_child_iter(node, &pos, &byte)) != NULL) {
+        art_node_put(copy, byte, child);
+    }
+
+    art_node_free(tree, node);
+    *ref = copy;
+    return 0;
+}
+
+// 添加子节点, 节点已满时先升级为更大的类型, 成功返回0, 失败返回-1
+static int32_t art_add_child(struct easeds_art *tree, struct easeds_art_node **ref, uint8_t byte,
+    struct easeds_art_node *child)
+{
+    struct easeds_art_node *node = *ref;
+
+    if (node->count == art_node_capacity[node->type]) {
+        if (unlikely(art_node_retype(tree, ref, (uint8_t)(node->type + 1)) != 0)) {
+            return -1;
+        }
+        node = *ref;
+    }
+
+    art_node_put(node, byte, child);
+    return 0;
+}
+
+// 摘除子节点, 只剩一个子节点时和子节点合并, 子节点数量低于阈值时降级
+static void art_remove_child(struct easeds_art *tree, struct easeds_art_node **ref, uint8_t byte)
+{
+    struct easeds_art_node *node = *ref;
+
+    art_node_drop(node, byte);
+    if (node->count == 1) {
+        uint32_t                pos   = 0;
+        uint8_t                 edge  = 0;
+        struct easeds_art_node *child = art_child_iter(node, &pos, &edge);
+        if (unlikely(child == NULL)) {
+            return;
+        }
+
+        /* 内部子节点的压缩路径变为: 节点 prefix + 边字节 + 子节点 prefix, 叶子保存完整键不需要 */
+        if (!ART_IS_LEAF(child)) {
+            uint32_t len = node->prefix_len + 1U;
+            memmove(child->prefix + len, child->prefix, child->prefix_len);
+            memcpy(child->prefix, node->prefix, node->prefix_len);
+            child->prefix[node->prefix_len] = edge;
+            child->prefix_len               = (uint8_t)(child->prefix_len + len);
+        }
+        art_node_free(tree, node);
+        *ref = child;
+    } else if (node->count <= art_shrink_threshold[node->type]) {
+        art_node_retype(tree, ref, (uint8_t)(node->type - 1));
+    }
+}
+
+// 比较节点的压缩路径和键从 depth 开始的字节, 返回相同的字节数
+static inline uint32_t art_prefix_match(struct easeds_art_node *node, uint64_t key, uint32_t depth)
+{
+    uint32_t i = 0;
+
+    while (i < node->prefix_len && node->prefix[i] == art_key_byte(key, depth + i)) {
+        i++;
+    }
+    return i;
+}
+
+// 叶子和新键冲突, 新建 NODE4 持有两者的公共字节作为压缩路径, 成功返回0, 失败返回-1
+static int32_t art_split_leaf(struct easeds_art *tree, struct easeds_art_node **ref,
+    uint32_t depth, struct easeds_art_node *leaf)
+{
+    uint64_t                old  = ART_LEAF(*ref)->key;
+    uint64_t                key  = ART_LEAF(leaf)->key;
+    uint32_t                diff = (uint32_t)__builtin_clzll(old ^ key) / 8;
+    struct easeds_art_node *node = art_node_alloc(tree, EASEDS_ART_NODE4);
+    if (unlikely(node == NULL)) {
+        return -1;
+    }
+
+    for (uint32_t i = depth; i < diff; i++) {
+        node->prefix[i - depth] = art_key_byte(key, i);
+    }
+    node->prefix_len = (uint8_t)(diff - depth);
+    art_node_put(node, art_key_byte(old, diff), *ref);
+    art_node_put(node, art_key_byte(key, diff), leaf);
+    *ref = node;
+    return 0;
+}
+
+// 压缩路径在 same 处和新键不同, 新建 NODE4 持有公共部分, 成功返回0, 失败返回-1
+static int32_t art_split_prefix(struct easeds_art *tree, struct easeds_art_node **ref,
+    uint32_t depth, uint32_t same, struct easeds_art_node *leaf)
+{
+    struct easeds_art_node *node   = *ref;
+    struct easeds_art_node *parent = art_node_alloc(tree, EASEDS_ART_NODE4);
+    if (unlikely(parent == NULL)) {
+        return -1;
+    }
+
+    parent->prefix_len = (uint8_t)same;
+    memcpy(parent->prefix, node->prefix, same);
+
+    /* 原节点去掉公共部分和边字节 */
+    uint8_t  edge = node->prefix[same];
+    uint32_t rest = node->prefix_len - same - 1;
+    memmove(node->prefix, node->prefix + same + 1, rest);
+    node->prefix_len = (uint8_t)rest;
+
+    art_node_put(parent, edge, node);
+    art_node_put(parent, art_key_byte(ART_LEAF(leaf)->key, depth + same), leaf);
+    *ref = parent;
+    return 0;
+}
+
+// 递归释放子树
+static void art_free_tree(struct easeds_art *tree, struct easeds_art_node *node)
+{
+    if (ART_IS_LEAF(node)) {
+        art_leaf_free(tree, node);
+        return;
+    }
+
+    struct easeds_art_node *child;
+    uint32_t                pos  = 0;
+    uint8_t                 byte = 0;
+    while ((child = art_child_iter(node, &pos, &byte)) != NULL) {
+        art_free_tree(tree, child);
+    }
+    art_node_free(tree, node);
+}
+
+// 创建一棵空的自适应基数树, 失败返回NULL
+struct easeds_art *easeds_art_create(const char *name)
+{
+    struct easeds_art *tree = __easeds_malloc(sizeof(struct easeds_art));
+    if (unlikely(tree == NULL)) {
+        EASEDS_ERR("[easeds_art_create]: Malloc tree failed.");
+        return NULL;
+    }
+
+    memset(tree, 0, sizeof(struct easeds_art));
+    tree->name = name;
+
+    PFL_DEBUG("[easeds_art_create]: name=%s.", name != NULL ? name : "(null)");
+    return tree;
+}
+
+// 销毁自适应基数树, 释放所有节点, 值由用户管理
+void easeds_art_destroy(struct easeds_art *tree)
+{
+    if (unlikely(tree == NULL)) {
+        return;
+    }
+
+    easeds_art_clear(tree);
+    __easeds_free(tree);
+}
+
+// 清空自适应基数树, 释放所有节点, 树结构体本身保留
+void easeds_art_clear(struct easeds_art *tree)
+{
+    if (unlikely(tree == NULL)) {
+        return;
+    }
+
+    if (tree->root != NULL) {
+        art_free_tree(tree, tree->root);
+        tree->root = NULL;
+    }
+    tree->size = 0;
+}
+
+// 获取键值对数量
+uint64_t easeds_art_size(struct easeds_art *tree)
+{
+    return tree != NULL ? tree->size : 0;
+}
+
+// 获取节点和叶子占用的字节数, 不包含树结构体本身
+uint64_t easeds_art_memory(struct easeds_art *tree)
+{
+    return tree != NULL ? tree->memory : 0;
+}
+
+// 插入键值对, 键已存在时覆盖旧值, 成功返回0, 失败返回-1
+int32_t easeds_art_insert(struct easeds_art *tree, uint64_t key, void *value)
+{
+    if (unlikely(tree == NULL)) {
+        EASEDS_ERR("[easeds_art_insert]: Invalid tree.");
+        return -1;
+    }
+
+    /* 先下降到插入位置, 只比较压缩路径和边字节 */
+    struct easeds_art_node **ref   = &tree->root;
+    struct easeds_art_node  *node  = NULL;
+    uint32_t                 depth = 0;
+    uint32_t                 same  = 0;
+    while (true) {
+        node = *ref;
+        if (node == NULL) {
+            break;
+        }
+        if (ART_IS_LEAF(node)) {
+            if (ART_LEAF(node)->key == key) {
+                ART_LEAF(node)->value = value;
+                return 0;
+            }
+            break;
+        }
+
+        same = art_prefix_match(node, key, depth);
+        if (same < node->prefix_len) {
+            break;
+        }
+        depth += node->prefix_len;
+
+        struct easeds_art_node **child = art_find_child(node, art_key_byte(key, depth));
+        if (child == NULL) {
+            break;
+        }
+        ref = child;
+        depth++;
+    }
+
+    struct easeds_art_node *leaf = art_leaf_alloc(tree, key, value);
+    if (unlikely(leaf == NULL)) {
+        return -1;
+    }
+
+    int32_t ret = 0;
+    if (node == NULL) {
+        *ref = leaf;
+    } else if (ART_IS_LEAF(node)) {
+        ret = art_split_leaf(tree, ref, depth, leaf);
+    } else if (same < node->prefix_len) {
+        ret = art_split_prefix(tree, ref, depth, same, leaf);
+    } else {
+        ret = art_add_child(tree, ref, art_key_byte(key, depth), leaf);
+    }
+
+    if (unlikely(ret != 0)) {
+        art_leaf_free(tree, leaf);
+        return -1;
+    }
+
+    tree->size++;
+    return 0;
+}
+
+// 删除键值对, value 非空时返回被删除的值, 成功返回0, 键不存在返回-1
+int32_t easeds_art_remove(struct easeds_art *tree, uint64_t key, void **value)
+{
+    if (unlikely(tree == NULL)) {
+        return -1;
+    }
+
+    /* 记录父节点槽位和边字节, 删除叶子后需要修整父节点 */
+    struct easeds_art_node **ref        = &tree->root;
+    struct easeds_art_node **parent_ref = NULL;
+    struct easeds_art_node  *node;
+    uint32_t                 depth = 0;
+    uint8_t                  edge  = 0;
+    while (true) {
+        node = *ref;
+        if (node == NULL) {
+            return -1;
+        }
+        if (ART_IS_LEAF(node)) {
+            if (ART_LEAF(node)->key != key) {
+                return -1;
+            }
+            break;
+        }
+
+        if (art_prefix_match(node, key, depth) != node->prefix_len) {
+            return -1;
+        }
+        depth += node->prefix_len;
+
+        struct easeds_art_node **child = art_find_child(node, art_key_byte(key, depth));
+        if (child == NULL) {
+            return -1;
+        }
+        parent_ref = ref;
+        ref        = child;
+        edge       = art_key_byte(key, depth);
+        depth++;
+    }
+
+    if (value != NULL) {
+        *value = ART_LEAF(node)->value;
+    }
+    art_leaf_free(tree, node);
+
+    if (parent_ref == NULL) {
+        *ref = NULL;
+    } else {
+        art_remove_child(tree, parent_ref, edge);
+    }
+
+    tree->size--;
+    return 0;
+}
+
+// 查找键对应的值, value 非空时返回找到的值, 成功返回0, 键不存在返回-1
+int32_t easeds_art_find(struct easeds_art *tree, uint64_t key, void **value)
+{
+    if (unlikely(tree == NULL)) {
+        return -1;
+    }
+
+    /* 内部节点只比较压缩路径和边字节, 最后在叶子上比较完整的键 */
+    struct easeds_art_node *node  = tree->root;
+    uint32_t                depth = 0;
+    while (node != NULL && !ART_IS_LEAF(node)) {
+        if (art_prefix_match(node, key, depth) != node->prefix_len) {
+            return -1;
+        }
+        depth += node->prefix_len;
+
+        struct easeds_art_node **child = art_find_child(node, art_key_byte(key, depth));
+        if (child == NULL) {
+            return -1;
+        }
+        node = *child;
+        depth++;
+    }
+
+    if (node == NULL || ART_LEAF(node)->key != key) {
+        return -1;
+    }
+
+    if (value != NULL) {
+        *value = ART_LEAF(node)->value;
+    }
+    return 0;
+}
+
+// 获取最小或最大的叶子, 空树返回NULL
+static struct easeds_art_leaf *art_extreme(struct easeds_art *tree, bool max)
+{
+    struct easeds_art_node *node = tree->root;
+
+    while (node != NULL && !ART_IS_LEAF(node)) {
+        if (max) {
+            node = art_last_child(node);
+        } else {
+            uint32_t pos  = 0;
+            uint8_t  byte = 0;
+            node          = art_child_iter(node, &pos, &byte);
+        }
+    }
+
+    return node != NULL ? ART_LEAF(node) : NULL;
+}
+
+// 获取最小键值对, key/value 非空时返回结果, 成功返回0, 空树返回-1
+int32_t easeds_art_min(struct easeds_art *tree, uint64_t *key, void **value)
+{
+    if (unlikely(tree == NULL)) {
+        return -1;
+    }
+
+    struct easeds_art_leaf *leaf = art_extreme(tree, false);
+    if (leaf == NULL) {
+        return -1;
+    }
+
+    if (key != NULL) {
+        *key = leaf->key;
+    }
+    if (value != NULL) {
+        *value = leaf->value;
+    }
+    return 0;
+}
+
+// 获取最大键值对, key/value 非空时返回结果, 成功返回0, 空树返回-1
+int32_t easeds_art_max(struct easeds_art *tree, uint64_t *key, void **value)
+{
+    if (unlikely(tree == NULL)) {
+        return -1;
+    }
+
+    struct easeds_art_leaf *leaf = art_extreme(tree, true);
+    if (leaf == NULL) {
+        return -1;
+    }
+
+    if (key != NULL) {
+        *key = leaf->key;
+    }
+    if (value != NULL) {
+        *value = leaf->value;
+    }
+    return 0;
+}
+
+/* 区间遍历的上下文 */
+struct art_range {
+    uint64_t low;
+    uint64_t high;
+    void (*callback)(uint64_t key, void *value, void *user_data);
+    void    *user_data;
+    uint64_t count;
+};
+
+// 按升序遍历子树, path 为子树内所有键共同的高 depth 字节, 和区间不相交的子树直接跳过
+static void art_range_walk(
+    struct art_range *range, struct easeds_art_node *node, uint64_t path, uint32_t depth)
+{
+    if (ART_IS_LEAF(node)) {
+        struct easeds_art_leaf *leaf = ART_LEAF(node);
+        if (leaf->key >= range->low && leaf->key <= range->high) {
+            range->callback(leaf->key, leaf->value, range->user_data);
+            range->count++;
+        }
+        return;
+    }
+
+    for (uint32_t i = 0; i < node->prefix_len; i++) {
+        path |= (uint64_t)node->prefix[i] << (56 - 8 * (depth + i));
+    }
+    depth += node->prefix_len;
+
+    /* 子节点子树覆盖 [child_path, child_path | span] 区间 */
+    uint64_t span = depth + 1 >= EASEDS_ART_KEY_BYTES ? 0 : UINT64_MAX >> (8 * (depth + 1));
+    struct easeds_art_node *child;
+    uint32_t                pos  = 0;
+    uint8_t                 byte = 0;
+    while ((child = art_child_iter(node, &pos, &byte)) != NULL) {
+        uint64_t child_path = path | (uint64_t)byte << (56 - 8 * depth);
+        if (child_path > range->high) {
+            break;
+        }
+        if ((child_path | span) < range->low) {
+            continue;
+        }
+        art_range_walk(range, child, child_path, depth + 1);
+    }
+}
+
+// 按升序遍历 [low, high] 区间内的键值对, 对每个键值对执行回调函数, 返回遍历数量
+uint64_t easeds_art_range(struct easeds_art *tree, uint64_t low, uint64_t high,
+    void (*callback)(uint64_t key, void *value, void *user_data), void *user_data)
+{
+    if (unlikely(tree == NULL || callback == NULL)) {
+        EASEDS_ERR("[easeds_art_range]: Invalid tree or callback.");
+        return 0;
+    }
+
+    if (tree->root == NULL || low > high) {
+        return 0;
+    }
+
+    struct art_range range = {
+        .low       = low,
+        .high      = high,
+        .callback  = callback,
+        .user_data = user_data,
+        .count     = 0,
+    };
+    art_range_walk(&range, tree->root, 0, 0);
+    return range.count;
+}
+
+/* 校验时累计的统计信息 */
+struct art_check {
+    uint64_t memory;
+    uint64_t nodes[EASEDS_ART_TYPES];
+};
+
+// 递归校验子树, path 为子树内所有键共同的高 depth 字节, 正确返回0, 异常返回-1
+static int32_t art_verify_node(
+    struct easeds_art_node *node, uint64_t path, uint32_t depth, struct art_check *check)
+{
+    if (ART_IS_LEAF(node)) {
+        uint64_t key  = ART_LEAF(node)->key;
+        uint64_t mask = depth >= EASEDS_ART_KEY_BYTES ? UINT64_MAX : ~(UINT64_MAX >> (8 * depth));
+        if ((key & mask) != path) {
+            EASEDS_ERR("[easeds_art_verify]: Leaf key 0x%lx not under path 0x%lx.", key, path);
+            return -1;
+        }
+        check->memory += sizeof(struct easeds_art_leaf);
+        check->nodes[EASEDS_ART_LEAF]++;
+        return 0;
+    }
+
+    if (node->type == EASEDS_ART_LEAF || node->type >= EASEDS_ART_TYPES
+        || node->count > art_node_capacity[node->type]
+        || node->count <= art_shrink_threshold[node->type]) {
+        EASEDS_ERR("[easeds_art_verify]: Invalid node type %u count %u.", node->type, node->count);
+        return -1;
+    }
+
+    if (depth + node->prefix_len >= EASEDS_ART_KEY_BYTES) {
+        EASEDS_ERR("[easeds_art_verify]: Prefix length %u too long at depth %u.", node->prefix_len,
+            depth);
+        return -1;
+    }
+
+    if (node->type == EASEDS_ART_NODE48) {
+        struct easeds_art_node48 *n48  = (struct easeds_art_node48 *)node;
+        uint64_t                  used = 0;
+        for (uint32_t b = 0; b < 256; b++) {
+            uint8_t slot = n48->index[b];
+            if (slot == 0) {
+                continue;
+            }
+            if (slot > 48 || n48->children[slot - 1] == NULL || (used & (1ULL << (slot - 1)))) {
+                EASEDS_ERR("[easeds_art_verify]: Invalid node48 slot %u for byte %u.", slot, b);
+                return -1;
+            }
+            used |= 1ULL << (slot - 1);
+        }
+    }
+
+    check->memory += art_node_size[node->type];
+    check->nodes[node->type]++;
+
+    for (uint32_t i = 0; i < node->prefix_len; i++) {
+        path |= (uint64_t)node->prefix[i] << (56 - 8 * (depth + i));
+    }
+    depth += node->prefix_len;
+
+    struct easeds_art_node *child;
+    uint32_t                pos   = 0;
+    uint32_t                count = 0;
+    uint32_t                last  = 0;
+    uint8_t                 byte  = 0;
+    while ((child = art_child_iter(node, &pos, &byte)) != NULL) {
+        if (count != 0 && byte <= last) {
+            EASEDS_ERR("[easeds_art_verify]: Child bytes not ascending, %u after %u.", byte,
+                last);
+            return -1;
+        }
+        uint64_t child_path = path | (uint64_t)byte << (56 - 8 * depth);
+        if (art_verify_node(child, child_path, depth + 1, check) != 0) {
+            return -1;
+        }
+        last = byte;
+        count++;
+    }
+
+    if (count != node->count) {
+        EASEDS_ERR("[easeds_art_verify]: Node count %u but found %u children.", node->count,
+            count);
+        return -1;
+    }
+
+    return 0;
+}
+
+// 校验树结构不变量(路径和键一致, 节点类型和子节点数量, 统计信息), 正确返回0, 异常返回-1
+int32_t easeds_art_verify(struct easeds_art *tree)
+{
+    struct art_check check;
+
+    if (unlikely(tree == NULL)) {
+        return -1;
+    }
+
+    memset(&check, 0, sizeof(check));
+    if (tree->root != NULL && art_verify_node(tree->root, 0, 0, &check) != 0) {
+        return -1;
+    }
+
+    if (check.nodes[EASEDS_ART_LEAF] != tree->size || check.memory != tree->memory) {
+        EASEDS_ERR("[easeds_art_verify]: Size %lu/%lu or memory %lu/%lu mismatch.",
+            check.nodes[EASEDS_ART_LEAF], tree->size, check.memory, tree->memory);
+        return -1;
+    }
+
+    for (uint32_t i = 0; i < EASEDS_ART_TYPES; i++) {
+        if (check.nodes[i] != tree->nodes[i]) {
+            EASEDS_ERR("[easeds_art_verify]: Node type %u count %lu, expected %lu.", i,
+                check.nodes[i], tree->nodes[i]);
+            return -1;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,163 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-art.h
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-18 19:50
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  自适应基数树(Adaptive Radix Tree), 键为 64 位无符号整数, 支持有序的区间遍历.
+ *
+ * @History:
+ *  2026年10月18日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#ifndef __EASEDS_ART_H__
+#define __EASEDS_ART_H__
+
+/* C 标准库头文件 */
+#include <stdbool.h>
+#include <stdint.h>
+
+/* 项目内部头文件 */
+#include "easeds-public.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 64 位键按大端顺序拆分为 8 个字节, 每层内部节点消耗一个字节 */
+#define EASEDS_ART_KEY_BYTES 8
+
+/* 节点类型, 叶子通过指针最低位标记, 不占用类型 */
+enum easeds_art_type {
+    EASEDS_ART_LEAF    = 0, /* 叶子, 只用于统计 */
+    EASEDS_ART_NODE4   = 1, /* 最多 4 个子节点, 有序键数组 */
+    EASEDS_ART_NODE16  = 2, /* 最多 16 个子节点, 有序键数组, SIMD 查找 */
+    EASEDS_ART_NODE48  = 3, /* 最多 48 个子节点, 256 字节下标表 */
+    EASEDS_ART_NODE256 = 4, /* 最多 256 个子节点, 直接寻址 */
+    EASEDS_ART_TYPES   = 5, /* 节点类型数量 */
+};
+
+/* 叶子, 保存完整的键, 子节点指针最低位为 1 时指向叶子 */
+struct easeds_art_leaf {
+    uint64_t key;   /* 键 */
+    void    *value; /* 值 */
+};
+
+/* 内部节点公共头部, 压缩路径最长 7 字节, 直接存放在头部中 */
+struct easeds_art_node {
+    uint8_t  type;                         /* 节点类型, enum easeds_art_type */
+    uint8_t  prefix_len;                   /* 压缩路径长度 */
+    uint16_t count;                        /* 子节点数量 */
+    uint32_t pad;                          /* 对齐填充 */
+    uint8_t  prefix[EASEDS_ART_KEY_BYTES]; /* 压缩路径 */
+};
+
+struct easeds_art_node4 {
+    struct easeds_art_node  base;        /* 公共头部 */
+    uint8_t                 keys[4];     /* 有序边字节 */
+    uint32_t                pad;         /* 对齐填充 */
+    struct easeds_art_node *children[4]; /* 子节点 */
+};
+
+struct easeds_art_node16 {
+    struct easeds_art_node  base;         /* 公共头部 */
+    uint8_t                 keys[16];     /* 有序边字节, 可以一次加载到 SIMD 寄存器 */
+    struct easeds_art_node *children[16]; /* 子节点 */
+};
+
+struct easeds_art_node48 {
+    struct easeds_art_node  base;         /* 公共头部 */
+    uint8_t                 index[256];   /* 边字节到子节点槽位的映射, 0 表示不存在 */
+    struct easeds_art_node *children[48]; /* 子节点 */
+};
+
+struct easeds_art_node256 {
+    struct easeds_art_node  base;          /* 公共头部 */
+    struct easeds_art_node *children[256]; /* 子节点, 按边字节直接寻址 */
+};
+
+/**
+ * 实现一个面向 64 位整数键的自适应基数树, 查找最多访问 8 层, 与键数量无关, 不需要键比较.
+ *  (1) 键按大端字节序逐层分解, 中序遍历即为键的升序, 支持有序的区间遍历和最小/最大键.
+ *  (2) 内部节点按子节点数量在 NODE4/NODE16/NODE48/NODE256 之间自动升级和降级.
+ *      NODE16 使用 SSE2 一次比较 16 个边字节, 没有 SSE2 时退化为顺序比较.
+ *  (3) 路径压缩: 只有一个子节点的路径合并到下层节点的 prefix 中, 稀疏的键不会产生长链.
+ *  (4) 延迟展开: 子树只有一个键时直接存放叶子, 叶子通过指针最低位标记.
+ *  (5) 连续的键(如自增连接 ID)会形成稠密的 NODE256, 查找退化为几次数组寻址.
+ *  (6) 非线程安全, 需要用户自行保证线程安全性.
+ */
+struct easeds_art {
+    const char             *name;                    /* 名称, 预留字段, 可用于调试和日志 */
+    struct easeds_art_node *root;                    /* 根节点, NULL 表示空树 */
+    uint64_t                size;                    /* 键值对数量 */
+    uint64_t                memory;                  /* 节点和叶子占用的字节数 */
+    uint64_t                nodes[EASEDS_ART_TYPES]; /* 各类型节点数量, 叶子计入 LEAF */
+};
+
+/**
+ * 常见自适应基数树操作函数:
+ *
+ * 函数名                       功能描述
+ * ------------------------     ------------------------------------------------------
+ * easeds_art_create            创建一棵空的自适应基数树, 失败返回NULL
+ * easeds_art_destroy           销毁自适应基数树, 释放所有节点
+ * easeds_art_clear             清空自适应基数树, 释放所有节点, 树结构体本身保留
+ * easeds_art_size              获取键值对数量
+ * easeds_art_memory            获取节点和叶子占用的字节数
+ * easeds_art_insert            插入键值对, 键已存在时覆盖旧值, 成功返回0, 失败返回-1
+ * easeds_art_remove            删除键值对, 成功返回0, 键不存在返回-1
+ * easeds_art_find              查找键对应的值, 成功返回0, 键不存在返回-1
+ * easeds_art_min               获取最小键值对, 成功返回0, 空树返回-1
+ * easeds_art_max               获取最大键值对, 成功返回0, 空树返回-1
+ * easeds_art_range             按升序遍历 [low, high] 区间内的键值对, 返回遍历数量
+ * easeds_art_verify            校验树结构不变量, 正确返回0, 异常返回-1
+ */
+
+// 创建一棵空的自适应基数树, 失败返回NULL
+struct easeds_art *easeds_art_create(const char *name);
+
+// 销毁自适应基数树, 释放所有节点, 值由用户管理
+void easeds_art_destroy(struct easeds_art *tree);
+
+// 清空自适应基数树, 释放所有节点, 树结构体本身保留
+void easeds_art_clear(struct easeds_art *tree);
+
+// 获取键值对数量
+uint64_t easeds_art_size(struct easeds_art *tree);
+
+// 获取节点和叶子占用的字节数, 不包含树结构体本身
+uint64_t easeds_art_memory(struct easeds_art *tree);
+
+// 插入键值对, 键已存在时覆盖旧值, 成功返回0, 失败返回-1
+int32_t easeds_art_insert(struct easeds_art *tree, uint64_t key, void *value);
+
+// 删除键值对, value 非空时返回被删除的值, 成功返回0, 键不存在返回-1
+int32_t easeds_art_remove(struct easeds_art *tree, uint64_t key, void **value);
+
+// 查找键对应的值, value 非空时返回找到的值, 成功返回0, 键不存在返回-1
+int32_t easeds_art_find(struct easeds_art *tree, uint64_t key, void **value);
+
+// 获取最小键值对, key/value 非空时返回结果, 成功返回0, 空树返回-1
+int32_t easeds_art_min(struct easeds_art *tree, uint64_t *key, void **value);
+
+// 获取最大键值对, key/value 非空时返回结果, 成功返回0, 空树返回-1
+int32_t easeds_art_max(struct easeds_art *tree, uint64_t *key, void **value);
+
+// 按升序遍历 [low, high] 区间内的键值对, 对每个键值对执行回调函数, 返回遍历数量
+uint64_t easeds_art_range(struct easeds_art *tree, uint64_t low, uint64_t high,
+    void (*callback)(uint64_t key, void *value, void *user_data), void *user_data);
+
+// 校验树结构不变量(路径和键一致, 节点类型和子节点数量, 统计信息), 正确返回0, 异常返回-1
+int32_t easeds_art_verify(struct easeds_art *tree);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __EASEDS_ART_H__ */
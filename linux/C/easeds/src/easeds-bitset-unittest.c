@@ -0,0 +1,394 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-bitset-unittest.c
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-18 21:20
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  Easeds 位图单元测试实现文件, 包含了置位/扫描/批量运算/rank/select 与逐位实现的对照和性能测试.
+ *
+ * @History:
+ *  2026年10月18日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#include "easeds-unittest.h"
+
+// 项目内部头文件
+#include "easeds-bitset.h"
+#include "easeds-utils.h"
+
+static uint64_t bitset_next_rand(uint64_t *seed)
+{
+    *seed ^= *seed << 13;
+    *seed ^= *seed >> 7;
+    *seed ^= *seed << 17;
+    return *seed;
+}
+
+// 和逐位的参考模型逐项对照: 测试, 计数, 扫描, rank, select
+static void bitset_check_model(struct easeds_bitset *bitset, const bool *model, uint64_t size)
+{
+    uint64_t count = 0;
+
+    for (uint64_t i = 0; i < size; i++) {
+        assert_true(easeds_bitset_test(bitset, i) == model[i]);
+        assert_int_equal(easeds_bitset_rank(bitset, i), count);
+        if (model[i]) {
+            assert_int_equal(easeds_bitset_select(bitset, count), i);
+            count++;
+        }
+    }
+    assert_int_equal(easeds_bitset_count(bitset), count);
+    assert_int_equal(easeds_bitset_rank(bitset, size), count);
+    assert_int_equal(easeds_bitset_select(bitset, count), EASEDS_BITSET_NONE);
+
+    // 按 find_next 遍历的结果和逐位遍历一致
+    uint64_t next_set = easeds_bitset_find_next_set(bitset, 0);
+    uint64_t next_clr = easeds_bitset_find_next_clear(bitset, 0);
+    for (uint64_t i = 0; i < size; i++) {
+        if (model[i]) {
+            assert_int_equal(next_set, i);
+            next_set = easeds_bitset_find_next_set(bitset, i + 1);
+        } else {
+            assert_int_equal(next_clr, i);
+            next_clr = easeds_bitset_find_next_clear(bitset, i + 1);
+        }
+    }
+    assert_int_equal(next_set, EASEDS_BITSET_NONE);
+    assert_int_equal(next_clr, EASEDS_BITSET_NONE);
+}
+
+// 基本功能测试: 置位, 清零, 翻转, 计数, 扫描
+static void test_easeds_bitset_basic(void **state)
+{
+    easeds_unused(state);
+
+    struct easeds_bitset *bitset = easeds_bitset_create("basic", 1000);
+    assert_non_null(bitset);
+    assert_int_equal(easeds_bitset_size(bitset), 1000);
+    assert_int_equal(easeds_bitset_count(bitset), 0);
+    assert_int_equal((uintptr_t)bitset->words % EASEDS_CACHE_LINE_SIZE, 0);
+    assert_int_equal(easeds_bitset_find_next_set(bitset, 0), EASEDS_BITSET_NONE);
+    assert_int_equal(easeds_bitset_find_next_clear(bitset, 0), 0);
+
+    const uint64_t bits[] = {0, 1, 63, 64, 511, 512, 700, 999};
+    for (uint32_t i = 0; i < sizeof(bits) / sizeof(bits[0]); i++) {
+        assert_int_equal(easeds_bitset_set(bitset, bits[i]), EASEDS_OK);
+        assert_true(easeds_bitset_test(bitset, bits[i]));
+    }
+    assert_int_equal(easeds_bitset_count(bitset), 8);
+    assert_false(easeds_bitset_test(bitset, 2));
+
+    // 重复置位不改变计数
+    assert_int_equal(easeds_bitset_set(bitset, 63), EASEDS_OK);
+    assert_int_equal(easeds_bitset_count(bitset), 8);
+
+    assert_int_equal(easeds_bitset_find_next_set(bitset, 2), 63);
+    assert_int_equal(easeds_bitset_find_next_set(bitset, 65), 511);
+    assert_int_equal(easeds_bitset_find_next_set(bitset, 701), 999);
+    assert_int_equal(easeds_bitset_find_next_clear(bitset, 0), 2);
+    assert_int_equal(easeds_bitset_find_next_clear(bitset, 63), 65);
+
+    assert_int_equal(easeds_bitset_rank(bitset, 64), 3);
+    assert_int_equal(easeds_bitset_rank(bitset, 65), 4);
+    assert_int_equal(easeds_bitset_select(bitset, 0), 0);
+    assert_int_equal(easeds_bitset_select(bitset, 4), 511);
+    assert_int_equal(easeds_bitset_select(bitset, 7), 999);
+    assert_int_equal(easeds_bitset_select(bitset, 8), EASEDS_BITSET_NONE);
+
+    // 修改后 rank 表失效, 重新查询得到新结果
+    assert_int_equal(easeds_bitset_clear(bitset, 1), EASEDS_OK);
+    assert_false(easeds_bitset_test(bitset, 1));
+    assert_int_equal(easeds_bitset_rank(bitset, 65), 3);
+    assert_int_equal(easeds_bitset_select(bitset, 1), 63);
+    assert_int_equal(easeds_bitset_toggle(bitset, 1), EASEDS_OK);
+    assert_int_equal(easeds_bitset_toggle(bitset, 999), EASEDS_OK);
+    assert_true(easeds_bitset_test(bitset, 1));
+    assert_false(easeds_bitset_test(bitset, 999));
+    assert_int_equal(easeds_bitset_count(bitset), 7);
+    assert_int_equal(easeds_bitset_select(bitset, 6), 700);
+
+    easeds_bitset_set_all(bitset);
+    assert_int_equal(easeds_bitset_count(bitset), 1000);
+    assert_int_equal(easeds_bitset_find_next_clear(bitset, 0), EASEDS_BITSET_NONE);
+    assert_int_equal(easeds_bitset_select(bitset, 999), 999);
+
+    easeds_bitset_clear_all(bitset);
+    assert_int_equal(easeds_bitset_count(bitset), 0);
+    assert_int_equal(easeds_bitset_rank(bitset, 1000), 0);
+
+    easeds_bitset_destroy(bitset);
+}
+
+// 操作测试: 随机修改和批量运算, 与参考模型对照
+static void test_easeds_bitset_operations(void **state)
+{
+    easeds_unused(state);
+
+    const uint64_t size  = 10007;
+    bool          *model = calloc(size, sizeof(bool));
+    bool          *other = calloc(size, sizeof(bool));
+    assert_non_null(model);
+    assert_non_null(other);
+
+    struct easeds_bitset *bitset = easeds_bitset_create("ops", size);
+    struct easeds_bitset *src    = easeds_bitset_create("src", size);
+    assert_non_null(bitset);
+    assert_non_null(src);
+
+    // 随机修改, 密度从稀疏逐渐变为稠密, 覆盖长串全零和全一的区间
+    uint64_t seed = 88172645463325252ULL;
+    for (uint32_t round = 0; round < 4; round++) {
+        for (uint32_t i = 0; i < 4000; i++) {
+            uint64_t pos = bitset_next_rand(&seed) % size;
+            uint64_t op  = bitset_next_rand(&seed) % 4;
+            if (op <= round) {
+                assert_int_equal(easeds_bitset_set(bitset, pos), EASEDS_OK);
+                model[pos] = true;
+            } else if (op == 3) {
+                assert_int_equal(easeds_bitset_toggle(bitset, pos), EASEDS_OK);
+                model[pos] = !model[pos];
+            } else {
+                assert_int_equal(easeds_bitset_clear(bitset, pos), EASEDS_OK);
+                model[pos] = false;
+            }
+        }
+        bitset_check_model(bitset, model, size);
+    }
+
+    // 批量运算: 每种运算都和逐位结果对照
+    for (uint32_t op = 0; op < 4; op++) {
+        for (uint64_t i = 0; i < size; i++) {
+            other[i] = (bitset_next_rand(&seed) & 3) == 0;
+            if (other[i]) {
+                assert_int_equal(easeds_bitset_set(src, i), EASEDS_OK);
+            } else {
+                assert_int_equal(easeds_bitset_clear(src, i), EASEDS_OK);
+            }
+        }
+
+        switch (op) {
+        case 0:
+            assert_int_equal(easeds_bitset_or(bitset, src), EASEDS_OK);
+            for (uint64_t i = 0; i < size; i++) {
+                model[i] = model[i] || other[i];
+            }
+            break;
+        case 1:
+            assert_int_equal(easeds_bitset_xor(bitset, src), EASEDS_OK);
+            for (uint64_t i = 0; i < size; i++) {
+                model[i] = model[i] != other[i];
+            }
+            break;
+        case 2:
+            assert_int_equal(easeds_bitset_andnot(bitset, src), EASEDS_OK);
+            for (uint64_t i = 0; i < size; i++) {
+                model[i] = model[i] && !other[i];
+            }
+            break;
+        default:
+            assert_int_equal(easeds_bitset_and(bitset, src), EASEDS_OK);
+            for (uint64_t i = 0; i < size; i++) {
+                model[i] = model[i] && other[i];
+            }
+            break;
+        }
+        bitset_check_model(bitset, model, size);
+        bitset_check_model(src, other, size);
+    }
+
+    free(model);
+    free(other);
+    easeds_bitset_destroy(bitset);
+    easeds_bitset_destroy(src);
+}
+
+// 边界测试: 单个位, 整字, 整缓存行, 跨缓存行一位, 填充位不受影响
+static void test_easeds_bitset_boundary(void **state)
+{
+    easeds_unused(state);
+
+    const uint64_t sizes[] = {1, 63, 64, 65, 511, 512, 513, 2048};
+    for (uint32_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        uint64_t              size   = sizes[s];
+        struct easeds_bitset *bitset = easeds_bitset_create("boundary", size);
+        assert_non_null(bitset);
+
+        // 越过末尾的操作全部失败或返回空结果
+        assert_int_equal(easeds_bitset_set(bitset, size), EASEDS_ERROR);
+        assert_int_equal(easeds_bitset_clear(bitset, size), EASEDS_ERROR);
+        assert_int_equal(easeds_bitset_toggle(bitset, size), EASEDS_ERROR);
+        assert_false(easeds_bitset_test(bitset, size));
+        assert_int_equal(easeds_bitset_find_next_set(bitset, size), EASEDS_BITSET_NONE);
+        assert_int_equal(easeds_bitset_find_next_clear(bitset, size), EASEDS_BITSET_NONE);
+
+        // 最后一位
+        assert_int_equal(easeds_bitset_set(bitset, size - 1), EASEDS_OK);
+        assert_int_equal(easeds_bitset_find_next_set(bitset, 0), size - 1);
+        assert_int_equal(easeds_bitset_select(bitset, 0), size - 1);
+        assert_int_equal(easeds_bitset_rank(bitset, size - 1), 0);
+        assert_int_equal(easeds_bitset_rank(bitset, UINT64_MAX), 1);
+
+        // 全部置位后填充位仍为0, 找不到清零位, 取反后为空
+        easeds_bitset_set_all(bitset);
+        assert_int_equal(easeds_bitset_count(bitset), size);
+        assert_int_equal(easeds_bitset_find_next_clear(bitset, 0), EASEDS_BITSET_NONE);
+        assert_int_equal(easeds_bitset_select(bitset, size - 1), size - 1);
+        assert_int_equal(easeds_bitset_select(bitset, size), EASEDS_BITSET_NONE);
+
+        struct easeds_bitset *full = easeds_bitset_create("full", size);
+        assert_non_null(full);
+        easeds_bitset_set_all(full);
+        assert_int_equal(easeds_bitset_xor(bitset, full), EASEDS_OK);
+        assert_int_equal(easeds_bitset_count(bitset), 0);
+        assert_int_equal(easeds_bitset_find_next_set(bitset, 0), EASEDS_BITSET_NONE);
+        assert_int_equal(easeds_bitset_find_next_clear(bitset, size - 1), size - 1);
+
+        easeds_bitset_destroy(full);
+        easeds_bitset_destroy(bitset);
+    }
+}
+
+// 错误处理测试: 非法大小, 空指针, 位数不同的运算
+static void test_easeds_bitset_error(void **state)
+{
+    easeds_unused(state);
+
+    assert_null(easeds_bitset_create("bad", 0));
+    assert_null(easeds_bitset_create("bad", UINT64_MAX));
+
+    easeds_bitset_destroy(NULL);
+    easeds_bitset_set_all(NULL);
+    easeds_bitset_clear_all(NULL);
+    assert_int_equal(easeds_bitset_size(NULL), 0);
+    assert_int_equal(easeds_bitset_set(NULL, 0), EASEDS_ERROR);
+    assert_int_equal(easeds_bitset_clear(NULL, 0), EASEDS_ERROR);
+    assert_int_equal(easeds_bitset_toggle(NULL, 0), EASEDS_ERROR);
+    assert_false(easeds_bitset_test(NULL, 0));
+    assert_int_equal(easeds_bitset_count(NULL), 0);
+    assert_int_equal(easeds_bitset_find_next_set(NULL, 0), EASEDS_BITSET_NONE);
+    assert_int_equal(easeds_bitset_find_next_clear(NULL, 0), EASEDS_BITSET_NONE);
+    assert_int_equal(easeds_bitset_rank(NULL, 0), 0);
+    assert_int_equal(easeds_bitset_select(NULL, 0), EASEDS_BITSET_NONE);
+
+    struct easeds_bitset *a = easeds_bitset_create("a", 100);
+    struct easeds_bitset *b = easeds_bitset_create("b", 101);
+    assert_non_null(a);
+    assert_non_null(b);
+    assert_int_equal(easeds_bitset_set(a, 5), EASEDS_OK);
+
+    // 位数不同时运算失败, 目标位图不变
+    easeds_bitset_set_all(b);
+    assert_int_equal(easeds_bitset_and(a, b), EASEDS_ERROR);
+    assert_int_equal(easeds_bitset_or(a, b), EASEDS_ERROR);
+    assert_int_equal(easeds_bitset_xor(a, b), EASEDS_ERROR);
+    assert_int_equal(easeds_bitset_andnot(a, b), EASEDS_ERROR);
+    assert_int_equal(easeds_bitset_or(a, NULL), EASEDS_ERROR);
+    assert_int_equal(easeds_bitset_or(NULL, a), EASEDS_ERROR);
+    assert_int_equal(easeds_bitset_count(a), 1);
+    assert_true(easeds_bitset_test(a, 5));
+
+    easeds_bitset_destroy(a);
+    easeds_bitset_destroy(b);
+}
+
+// 性能测试: 逐位循环与 popcount/ctz 扫描, 批量运算, rank/select
+static void test_easeds_bitset_perf(void **state)
+{
+    easeds_unused(state);
+
+    const uint64_t        size   = 1ULL << 24;
+    struct easeds_bitset *bitset = easeds_bitset_create("perf", size);
+    struct easeds_bitset *other  = easeds_bitset_create("other", size);
+    assert_non_null(bitset);
+    assert_non_null(other);
+
+    // 约 1% 的槽位被占用
+    uint64_t seed = 88172645463325252ULL;
+    for (uint64_t i = 0; i < size / 100; i++) {
+        easeds_bitset_set(bitset, bitset_next_rand(&seed) % size);
+        easeds_bitset_set(other, bitset_next_rand(&seed) % size);
+    }
+
+    int64_t  start    = easeds_get_current_time_ns();
+    uint64_t by_bit   = 0;
+    uint64_t checksum = 0;
+    for (uint64_t i = 0; i < size; i++) {
+        if (easeds_bitset_test(bitset, i)) {
+            by_bit++;
+            checksum += i;
+        }
+    }
+    int64_t loop_ns = easeds_get_current_time_ns() - start;
+
+    start           = easeds_get_current_time_ns();
+    uint64_t count  = easeds_bitset_count(bitset);
+    int64_t  pop_ns = easeds_get_current_time_ns() - start;
+    assert_int_equal(count, by_bit);
+
+    start            = easeds_get_current_time_ns();
+    uint64_t scanned = 0;
+    uint64_t sum     = 0;
+    uint64_t pos     = easeds_bitset_find_next_set(bitset, 0);
+    while (pos != EASEDS_BITSET_NONE) {
+        scanned++;
+        sum += pos;
+        pos = easeds_bitset_find_next_set(bitset, pos + 1);
+    }
+    int64_t scan_ns = easeds_get_current_time_ns() - start;
+    assert_int_equal(scanned, count);
+    assert_int_equal(sum, checksum);
+
+    const uint32_t rounds = 16;
+    start                 = easeds_get_current_time_ns();
+    for (uint32_t r = 0; r < rounds; r++) {
+        assert_int_equal(easeds_bitset_xor(bitset, other), EASEDS_OK);
+    }
+    int64_t bulk_ns = easeds_get_current_time_ns() - start;
+    assert_int_equal(easeds_bitset_count(bitset), count);
+
+    // 第一次调用时构建 rank 表, 之后按随机位置查询
+    start = easeds_get_current_time_ns();
+    assert_int_equal(easeds_bitset_rank(bitset, size), count);
+    int64_t build_ns = easeds_get_current_time_ns() - start;
+
+    const uint32_t queries = 1000000;
+    uint64_t       acc     = 0;
+    start                  = easeds_get_current_time_ns();
+    for (uint32_t i = 0; i < queries; i++) {
+        acc += easeds_bitset_rank(bitset, bitset_next_rand(&seed) % size);
+    }
+    int64_t rank_ns = easeds_get_current_time_ns() - start;
+
+    start = easeds_get_current_time_ns();
+    for (uint32_t i = 0; i < queries; i++) {
+        acc += easeds_bitset_select(bitset, bitset_next_rand(&seed) % count);
+    }
+    int64_t select_ns = easeds_get_current_time_ns() - start;
+    assert_true(acc > 0);
+
+    MEASURE("[bitset perf]: %lu bits, %lu set, bit loop %.2f ms, popcount %.3f ms, "
+            "find_next_set scan %.3f ms.",
+        size, count, (double)loop_ns / 1e6, (double)pop_ns / 1e6, (double)scan_ns / 1e6);
+    MEASURE("[bitset perf]: xor %.1f GB/s, rank table build %.3f ms, rank %.1f ns/op, "
+            "select %.1f ns/op.",
+        (double)(size / 8 * rounds) / (double)bulk_ns, (double)build_ns / 1e6,
+        (double)rank_ns / queries, (double)select_ns / queries);
+
+    easeds_bitset_destroy(bitset);
+    easeds_bitset_destroy(other);
+}
+
+EASEDS_UNITTEST_REGISTER(easeds_unittest_bitset){
+    cmocka_unit_test(test_easeds_bitset_basic),
+    cmocka_unit_test(test_easeds_bitset_operations),
+    cmocka_unit_test(test_easeds_bitset_boundary),
+    cmocka_unit_test(test_easeds_bitset_error),
+    cmocka_unit_test(test_easeds_bitset_perf),
+    easeds_unit_test_end,
+};
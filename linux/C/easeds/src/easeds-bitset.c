@@ -0,0 +1,485 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-bitset.c
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-18 21:10
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  定长位图(Bitset)实现文件.
+ *
+ * @History:
+ *  2026年10月18日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#include "easeds-bitset.h"
+
+// 标准库头文件
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__AVX2__) || defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
+// 项目内部头文件
+#include "easeds-log.h"
+
+/* 位运算类型 */
+enum bitset_op {
+    BITSET_AND    = 0,
+    BITSET_OR     = 1,
+    BITSET_XOR    = 2,
+    BITSET_ANDNOT = 3,
+};
+
+// 获取位数组的字数量, 包含填充字
+static inline uint64_t bitset_words(struct easeds_bitset *bitset)
+{
+    return bitset->line_count * EASEDS_BITSET_LINE_WORDS;
+}
+
+// 统计 count 个字的置位数量, AVX2 使用 nibble 查表, 每轮用 SAD 累加到 64 位, 不会溢出
+static uint64_t bitset_popcount(const uint64_t *words, uint64_t count)
+{
+    uint64_t total = 0;
+    uint64_t i     = 0;
+
+#ifdef __AVX2__
+    const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 0, 1,
+        1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i low    = _mm256_set1_epi8(0x0F);
+    __m256i       acc    = _mm256_setzero_si256();
+    for (; i + 4 <= count; i += 4) {
+        __m256i v  = _mm256_loadu_si256((const __m256i *)(words + i));
+        __m256i lo = _mm256_shuffle_epi8(lookup, _mm256_and_si256(v, low));
+        __m256i hi = _mm256_shuffle_epi8(lookup, _mm256_and_si256(_mm256_srli_epi16(v, 4), low));
+        __m256i c  = _mm256_add_epi8(lo, hi);
+        acc        = _mm256_add_epi64(acc, _mm256_sad_epu8(c, _mm256_setzero_si256()));
+    }
+    total = (uint64_t)_mm256_extract_epi64(acc, 0) + (uint64_t)_mm256_extract_epi64(acc, 1)
+          + (uint64_t)_mm256_extract_epi64(acc, 2) + (uint64_t)_mm256_extract_epi64(acc, 3);
+#endif
+
+    for (; i < count; i++) {
+        total += (uint64_t)__builtin_popcountll(words[i]);
+    }
+    return total;
+}
+
+// 在单个字内查找第 k 个置位(从0开始计数), 调用者保证 k 小于字的置位数量
+static inline uint32_t bitset_select_word(uint64_t word, uint32_t k)
+{
+#ifdef __BMI2__
+    return (uint32_t)__builtin_ctzll(_pdep_u64(1ULL << k, word));
+#else
+    for (uint32_t i = 0; i < k; i++) {
+        word &= word - 1;
+    }
+    return (uint32_t)__builtin_ctzll(word);
+#endif
+}
+
+// 从第 index 个字开始查找第一个非零字, invert 为 true 时按取反后的值查找, 找不到返回字数量
+static uint64_t bitset_scan_words(struct easeds_bitset *bitset, uint64_t index, bool invert)
+{
+    const uint64_t  count = bitset_words(bitset);
+    const uint64_t *words = bitset->words;
+    const uint64_t  flip  = invert ? UINT64_MAX : 0;
+
+    /* 先逐字前进到 4 字对齐, 再按 256 位跳过全零(取反后全零)的区间 */
+    for (; index < count && (index & 3) != 0; index++) {
+        if ((words[index] ^ flip) != 0) {
+            return index;
+        }
+    }
+
+#ifdef __AVX2__
+    const __m256i vflip = _mm256_set1_epi64x((int64_t)flip);
+    for (; index + 4 <= count; index += 4) {
+        __m256i v = _mm256_xor_si256(_mm256_load_si256((const __m256i *)(words + index)), vflip);
+        if (!_mm256_testz_si256(v, v)) {
+            break;
+        }
+    }
+#endif
+
+    for (; index < count; index++) {
+        if ((words[index] ^ flip) != 0) {
+            return index;
+        }
+    }
+    return count;
+}
+
+// 构建 rank 表, 失败返回-1
+static int32_t bitset_build_rank(struct easeds_bitset *bitset)
+{
+    if (bitset->rank == NULL) {
+        bitset->rank = __easeds_malloc((bitset->line_count + 1) * sizeof(uint64_t));
+        if (unlikely(bitset->rank == NULL)) {
+            EASEDS_ERR("[bitset_build_rank]: Malloc rank table failed.");
+            return -1;
+        }
+    }
+
+    uint64_t total = 0;
+    for (uint64_t i = 0; i < bitset->line_count; i++) {
+        bitset->rank[i] = total;
+        total += bitset_popcount(bitset->words + i * EASEDS_BITSET_LINE_WORDS,
+            EASEDS_BITSET_LINE_WORDS);
+    }
+    bitset->rank[bitset->line_count] = total;
+    bitset->rank_valid               = true;
+    return 0;
+}
+
+// 按操作类型对两个位图逐字运算, 填充字参与运算, 结果中的填充位仍为0
+static void bitset_apply(struct easeds_bitset *dst, struct easeds_bitset *src, enum bitset_op op)
+{
+    const uint64_t  count = bitset_words(dst);
+    uint64_t       *d     = dst->words;
+    const uint64_t *s     = src->words;
+
+    /* 字数量总是缓存行的整数倍, 也是 4 的整数倍, 按 256 位处理没有尾部 */
+#ifdef __AVX2__
+#define BITSET_APPLY_LOOP(expr)                                                                    \
+    for (uint64_t i = 0; i < count; i += 4) {                                                      \
+        __m256i a = _mm256_load_si256((const __m256i *)(d + i));                                   \
+        __m256i b = _mm256_load_si256((const __m256i *)(s + i));                                   \
+        _mm256_store_si256((__m256i *)(d + i), expr);                                              \
+    }
+    switch (op) {
+    case BITSET_AND:
+        BITSET_APPLY_LOOP(_mm256_and_si256(a, b));
+        break;
+    case BITSET_OR:
+        BITSET_APPLY_LOOP(_mm256_or_si256(a, b));
+        break;
+    case BITSET_XOR:
+        BITSET_APPLY_LOOP(_mm256_xor_si256(a, b));
+        break;
+    case BITSET_ANDNOT:
+        BITSET_APPLY_LOOP(_mm256_andnot_si256(b, a));
+        break;
+    default:
+        break;
+    }
+#else
+#define BITSET_APPLY_LOOP(expr)                                                                    \
+    for (uint64_t i = 0; i < count; i++) {                                                         \
+        uint64_t a = d[i];                                                                         \
+        uint64_t b = s[i];                                                                         \
+        d[i]       = expr;                                                                         \
+    }
+    switch (op) {
+    case BITSET_AND:
+        BITSET_APPLY_LOOP(a & b);
+        break;
+    case BITSET_OR:
+        BITSET_APPLY_LOOP(a | b);
+        break;
+    case BITSET_XOR:
+        BITSET_APPLY_LOOP(a ^ b);
+        break;
+    case BITSET_ANDNOT:
+        BITSET_APPLY_LOOP(a & ~b);
+        break;
+    default:
+        break;
+    }
+#endif
+#undef BITSET_APPLY_LOOP
+
+    dst->rank_valid = false;
+}
+
+// 校验参数后执行位图运算, 成功返回0, 失败返回-1
+static int32_t bitset_binary(
+    struct easeds_bitset *dst, struct easeds_bitset *src, enum bitset_op op, const char *func)
+{
+    if (unlikely(dst == NULL || src == NULL)) {
+        EASEDS_ERR("[%s]: Invalid bitset pointer.", func);
+        return -1;
+    }
+
+    if (unlikely(dst->size != src->size)) {
+        EASEDS_ERR("[%s]: Size mismatch, %lu vs %lu.", func, dst->size, src->size);
+        return -1;
+    }
+
+    bitset_apply(dst, src, op);
+    return 0;
+}
+
+// 创建指定位数的位图, 所有位为0, 失败返回NULL
+struct easeds_bitset *easeds_bitset_create(const char *name, uint64_t size)
+{
+    if (unlikely(size == 0 || size > UINT64_MAX - EASEDS_BITSET_LINE_BITS)) {
+        EASEDS_ERR("[easeds_bitset_create]: Invalid size %lu.", size);
+        return NULL;
+    }
+
+    struct easeds_bitset *bitset = __easeds_malloc(sizeof(struct easeds_bitset));
+    if (unlikely(bitset == NULL)) {
+        EASEDS_ERR("[easeds_bitset_create]: Malloc bitset failed.");
+        return NULL;
+    }
+
+    memset(bitset, 0, sizeof(struct easeds_bitset));
+    bitset->name       = name;
+    bitset->size       = size;
+    bitset->line_count = (size + EASEDS_BITSET_LINE_BITS - 1) / EASEDS_BITSET_LINE_BITS;
+    bitset->words      = __easeds_aligned_alloc(
+        EASEDS_CACHE_LINE_SIZE, bitset->line_count * EASEDS_CACHE_LINE_SIZE);
+    if (unlikely(bitset->words == NULL)) {
+        EASEDS_ERR("[easeds_bitset_create]: Malloc %lu bits failed.", size);
+        __easeds_free(bitset);
+        return NULL;
+    }
+
+    memset(bitset->words, 0, bitset->line_count * EASEDS_CACHE_LINE_SIZE);
+
+    PFL_DEBUG("[easeds_bitset_create]: name=%s, size=%lu.", name != NULL ? name : "(null)", size);
+    return bitset;
+}
+
+// 销毁位图
+void easeds_bitset_destroy(struct easeds_bitset *bitset)
+{
+    if (unlikely(bitset == NULL)) {
+        return;
+    }
+
+    __easeds_free(bitset->rank);
+    __easeds_free(bitset->words);
+    __easeds_free(bitset);
+}
+
+// 获取位数量
+uint64_t easeds_bitset_size(struct easeds_bitset *bitset)
+{
+    return bitset != NULL ? bitset->size : 0;
+}
+
+// 将某一位置1, 成功返回0, 越界返回-1
+int32_t easeds_bitset_set(struct easeds_bitset *bitset, uint64_t pos)
+{
+    if (unlikely(bitset == NULL || pos >= bitset->size)) {
+        return -1;
+    }
+
+    bitset->words[pos >> 6] |= 1ULL << (pos & 63);
+    bitset->rank_valid = false;
+    return 0;
+}
+
+// 将某一位清0, 成功返回0, 越界返回-1
+int32_t easeds_bitset_clear(struct easeds_bitset *bitset, uint64_t pos)
+{
+    if (unlikely(bitset == NULL || pos >= bitset->size)) {
+        return -1;
+    }
+
+    bitset->words[pos >> 6] &= ~(1ULL << (pos & 63));
+    bitset->rank_valid = false;
+    return 0;
+}
+
+// 翻转某一位, 成功返回0, 越界返回-1
+int32_t easeds_bitset_toggle(struct easeds_bitset *bitset, uint64_t pos)
+{
+    if (unlikely(bitset == NULL || pos >= bitset->size)) {
+        return -1;
+    }
+
+    bitset->words[pos >> 6] ^= 1ULL << (pos & 63);
+    bitset->rank_valid = false;
+    return 0;
+}
+
+// 测试某一位是否为1, 越界返回false
+bool easeds_bitset_test(struct easeds_bitset *bitset, uint64_t pos)
+{
+    if (unlikely(bitset == NULL || pos >= bitset->size)) {
+        return false;
+    }
+
+    return (bitset->words[pos >> 6] >> (pos & 63)) & 1;
+}
+
+// 将所有位置1, 填充位保持为0
+void easeds_bitset_set_all(struct easeds_bitset *bitset)
+{
+    if (unlikely(bitset == NULL)) {
+        return;
+    }
+
+    uint64_t full = bitset->size >> 6;
+    memset(bitset->words, 0xFF, full * sizeof(uint64_t));
+    memset(bitset->words + full, 0, (bitset_words(bitset) - full) * sizeof(uint64_t));
+    if ((bitset->size & 63) != 0) {
+        bitset->words[full] = (1ULL << (bitset->size & 63)) - 1;
+    }
+    bitset->rank_valid = false;
+}
+
+// 将所有位清0
+void easeds_bitset_clear_all(struct easeds_bitset *bitset)
+{
+    if (unlikely(bitset == NULL)) {
+        return;
+    }
+
+    memset(bitset->words, 0, bitset->line_count * EASEDS_CACHE_LINE_SIZE);
+    bitset->rank_valid = false;
+}
+
+// 统计置位数量
+uint64_t easeds_bitset_count(struct easeds_bitset *bitset)
+{
+    if (unlikely(bitset == NULL)) {
+        return 0;
+    }
+
+    if (bitset->rank_valid) {
+        return bitset->rank[bitset->line_count];
+    }
+    return bitset_popcount(bitset->words, bitset_words(bitset));
+}
+
+// 从 from(包含)开始查找下一个置位, 找不到返回 EASEDS_BITSET_NONE
+uint64_t easeds_bitset_find_next_set(struct easeds_bitset *bitset, uint64_t from)
+{
+    if (unlikely(bitset == NULL || from >= bitset->size)) {
+        return EASEDS_BITSET_NONE;
+    }
+
+    /* 第一个字屏蔽 from 之前的位, 填充位总是0, 找到的位置不会超过 size */
+    uint64_t index = from >> 6;
+    uint64_t word  = bitset->words[index] & (UINT64_MAX << (from & 63));
+    if (word == 0) {
+        index = bitset_scan_words(bitset, index + 1, false);
+        if (index >= bitset_words(bitset)) {
+            return EASEDS_BITSET_NONE;
+        }
+        word = bitset->words[index];
+    }
+
+    return (index << 6) + (uint64_t)__builtin_ctzll(word);
+}
+
+// 从 from(包含)开始查找下一个清零位, 找不到返回 EASEDS_BITSET_NONE
+uint64_t easeds_bitset_find_next_clear(struct easeds_bitset *bitset, uint64_t from)
+{
+    if (unlikely(bitset == NULL || from >= bitset->size)) {
+        return EASEDS_BITSET_NONE;
+    }
+
+    /* 填充位取反后为1, 找到的位置需要和 size 比较 */
+    uint64_t index = from >> 6;
+    uint64_t word  = ~bitset->words[index] & (UINT64_MAX << (from & 63));
+    if (word == 0) {
+        index = bitset_scan_words(bitset, index + 1, true);
+        if (index >= bitset_words(bitset)) {
+            return EASEDS_BITSET_NONE;
+        }
+        word = ~bitset->words[index];
+    }
+
+    uint64_t pos = (index << 6) + (uint64_t)__builtin_ctzll(word);
+    return pos < bitset->size ? pos : EASEDS_BITSET_NONE;
+}
+
+// dst &= src, 两者位数必须相同, 成功返回0, 失败返回-1
+int32_t easeds_bitset_and(struct easeds_bitset *dst, struct easeds_bitset *src)
+{
+    return bitset_binary(dst, src, BITSET_AND, "easeds_bitset_and");
+}
+
+// dst |= src, 两者位数必须相同, 成功返回0, 失败返回-1
+int32_t easeds_bitset_or(struct easeds_bitset *dst, struct easeds_bitset *src)
+{
+    return bitset_binary(dst, src, BITSET_OR, "easeds_bitset_or");
+}
+
+// dst ^= src, 两者位数必须相同, 成功返回0, 失败返回-1
+int32_t easeds_bitset_xor(struct easeds_bitset *dst, struct easeds_bitset *src)
+{
+    return bitset_binary(dst, src, BITSET_XOR, "easeds_bitset_xor");
+}
+
+// dst &= ~src, 两者位数必须相同, 成功返回0, 失败返回-1
+int32_t easeds_bitset_andnot(struct easeds_bitset *dst, struct easeds_bitset *src)
+{
+    return bitset_binary(dst, src, BITSET_ANDNOT, "easeds_bitset_andnot");
+}
+
+// 统计 [0, pos) 区间内的置位数量, pos 超过位数时按位数计算, 按需构建 rank 表
+uint64_t easeds_bitset_rank(struct easeds_bitset *bitset, uint64_t pos)
+{
+    if (unlikely(bitset == NULL)) {
+        return 0;
+    }
+
+    pos = pos < bitset->size ? pos : bitset->size;
+
+    /* rank 表构建失败时退化为从头统计 */
+    uint64_t line  = pos / EASEDS_BITSET_LINE_BITS;
+    uint64_t total = 0;
+    if (likely(bitset->rank_valid || bitset_build_rank(bitset) == 0)) {
+        total = bitset->rank[line];
+    } else {
+        line = 0;
+    }
+
+    uint64_t first = line * EASEDS_BITSET_LINE_WORDS;
+    uint64_t last  = pos >> 6;
+    total += bitset_popcount(bitset->words + first, last - first);
+    if ((pos & 63) != 0) {
+        total += (uint64_t)__builtin_popcountll(bitset->words[last] & ((1ULL << (pos & 63)) - 1));
+    }
+    return total;
+}
+
+// 查找第 k 个置位(从0开始计数)的位置, 置位数量不足返回 EASEDS_BITSET_NONE, 按需构建 rank 表
+uint64_t easeds_bitset_select(struct easeds_bitset *bitset, uint64_t k)
+{
+    if (unlikely(bitset == NULL)) {
+        return EASEDS_BITSET_NONE;
+    }
+
+    /* 二分查找最后一个 rank[line] <= k 的缓存行, 构建失败时从第一个缓存行开始扫描 */
+    uint64_t line = 0;
+    if (likely(bitset->rank_valid || bitset_build_rank(bitset) == 0)) {
+        if (k >= bitset->rank[bitset->line_count]) {
+            return EASEDS_BITSET_NONE;
+        }
+
+        uint64_t low = 0, high = bitset->line_count;
+        while (high - low > 1) {
+            uint64_t mid = low + (high - low) / 2;
+            if (bitset->rank[mid] <= k) {
+                low = mid;
+            } else {
+                high = mid;
+            }
+        }
+        line = low;
+        k -= bitset->rank[line];
+    }
+
+    const uint64_t count = bitset_words(bitset);
+    for (uint64_t i = line * EASEDS_BITSET_LINE_WORDS; i < count; i++) {
+        uint64_t bits = (uint64_t)__builtin_popcountll(bitset->words[i]);
+        if (k < bits) {
+            return (i << 6) + bitset_select_word(bitset->words[i], (uint32_t)k);
+        }
+        k -= bits;
+    }
+    return EASEDS_BITSET_NONE;
+}
@@ -0,0 +1,145 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-bitset.h
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-18 21:10
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  定长位图(Bitset), 支持按字/AVX2 统计置位数量, 按 ctz 扫描下一个置位/清零位, 以及 rank/select.
+ *
+ * @History:
+ *  2026年10月18日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#ifndef __EASEDS_BITSET_H__
+#define __EASEDS_BITSET_H__
+
+/* C 标准库头文件 */
+#include <stdbool.h>
+#include <stdint.h>
+
+/* 项目内部头文件 */
+#include "easeds-environment.h"
+#include "easeds-public.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 扫描和 select 找不到结果时的返回值 */
+#define EASEDS_BITSET_NONE UINT64_MAX
+
+/* 位数组按缓存行分配, 每个缓存行 8 个字共 512 位, rank 表每个缓存行记录一项 */
+#define EASEDS_BITSET_LINE_WORDS (EASEDS_CACHE_LINE_SIZE / 8)
+#define EASEDS_BITSET_LINE_BITS  (EASEDS_CACHE_LINE_SIZE * 8)
+
+/**
+ * 实现一个定长位图, 用于大规模槽位占用状态等场景, 替代逐位循环.
+ *  (1) 位数组按缓存行对齐并补齐到整数个缓存行, 超出 size 的填充位始终为 0,
+ *      批量运算和统计可以直接处理整个缓存行, 不需要处理尾部.
+ *  (2) 置位数量统计按字使用 popcount 指令, 开启 AVX2 时每次处理 4 个字(nibble 查表 + SAD 累加).
+ *  (3) 查找下一个置位/清零位按字跳过, 在字内用 ctz 定位, 开启 AVX2 时一次检查 4 个全零字.
+ *  (4) 位图之间的 AND/OR/XOR/ANDNOT 按 256 位向量处理, 没有 AVX2 时按 64 位字处理.
+ *  (5) rank 表记录每个缓存行之前的置位数量, 在第一次调用 rank/select 时构建,
+ *      任何修改都会使其失效, 适合"构建一次, 多次查询"的大位图.
+ *  (6) 非线程安全, 需要用户自行保证线程安全性.
+ */
+struct easeds_bitset {
+    const char *name;       /* 名称, 预留字段, 可用于调试和日志 */
+    uint64_t   *words;      /* 位数组, 按缓存行对齐 */
+    uint64_t    size;       /* 位数量 */
+    uint64_t    line_count; /* 缓存行数量, 字数量为 line_count * EASEDS_BITSET_LINE_WORDS */
+    uint64_t   *rank;       /* rank 表, rank[i] 为第 i 个缓存行之前的置位数量, 共 line_count + 1 项 */
+    bool        rank_valid; /* rank 表是否和位数组一致 */
+    uint8_t     pad[7];     /* 对齐填充 */
+};
+
+/**
+ * 常见位图操作函数:
+ *
+ * 函数名                           功能描述
+ * ----------------------------     ------------------------------------------------------
+ * easeds_bitset_create             创建指定位数的位图, 所有位为0, 失败返回NULL
+ * easeds_bitset_destroy            销毁位图
+ * easeds_bitset_size               获取位数量
+ * easeds_bitset_set                将某一位置1, 成功返回0, 越界返回-1
+ * easeds_bitset_clear              将某一位清0, 成功返回0, 越界返回-1
+ * easeds_bitset_toggle             翻转某一位, 成功返回0, 越界返回-1
+ * easeds_bitset_test               测试某一位是否为1, 越界返回false
+ * easeds_bitset_set_all            将所有位置1
+ * easeds_bitset_clear_all          将所有位清0
+ * easeds_bitset_count              统计置位数量
+ * easeds_bitset_find_next_set      从指定位置开始查找下一个置位
+ * easeds_bitset_find_next_clear    从指定位置开始查找下一个清零位
+ * easeds_bitset_and                dst &= src, 成功返回0, 位数不同返回-1
+ * easeds_bitset_or                 dst |= src, 成功返回0, 位数不同返回-1
+ * easeds_bitset_xor                dst ^= src, 成功返回0, 位数不同返回-1
+ * easeds_bitset_andnot             dst &= ~src, 成功返回0, 位数不同返回-1
+ * easeds_bitset_rank               统计 [0, pos) 区间内的置位数量
+ * easeds_bitset_select             查找第 k 个置位(从0开始计数)的位置
+ */
+
+// 创建指定位数的位图, 所有位为0, 失败返回NULL
+struct easeds_bitset *easeds_bitset_create(const char *name, uint64_t size);
+
+// 销毁位图
+void easeds_bitset_destroy(struct easeds_bitset *bitset);
+
+// 获取位数量
+uint64_t easeds_bitset_size(struct easeds_bitset *bitset);
+
+// 将某一位置1, 成功返回0, 越界返回-1
+int32_t easeds_bitset_set(struct easeds_bitset *bitset, uint64_t pos);
+
+// 将某一位清0, 成功返回0, 越界返回-1
+int32_t easeds_bitset_clear(struct easeds_bitset *bitset, uint64_t pos);
+
+// 翻转某一位, 成功返回0, 越界返回-1
+int32_t easeds_bitset_toggle(struct easeds_bitset *bitset, uint64_t pos);
+
+// 测试某一位是否为1, 越界返回false
+bool easeds_bitset_test(struct easeds_bitset *bitset, uint64_t pos);
+
+// 将所有位置1, 填充位保持为0
+void easeds_bitset_set_all(struct easeds_bitset *bitset);
+
+// 将所有位清0
+void easeds_bitset_clear_all(struct easeds_bitset *bitset);
+
+// 统计置位数量
+uint64_t easeds_bitset_count(struct easeds_bitset *bitset);
+
+// 从 from(包含)开始查找下一个置位, 找不到返回 EASEDS_BITSET_NONE
+uint64_t easeds_bitset_find_next_set(struct easeds_bitset *bitset, uint64_t from);
+
+// 从 from(包含)开始查找下一个清零位, 找不到返回 EASEDS_BITSET_NONE
+uint64_t easeds_bitset_find_next_clear(struct easeds_bitset *bitset, uint64_t from);
+
+// dst &= src, 两者位数必须相同, 成功返回0, 失败返回-1
+int32_t easeds_bitset_and(struct easeds_bitset *dst, struct easeds_bitset *src);
+
+// dst |= src, 两者位数必须相同, 成功返回0, 失败返回-1
+int32_t easeds_bitset_or(struct easeds_bitset *dst, struct easeds_bitset *src);
+
+// dst ^= src, 两者位数必须相同, 成功返回0, 失败返回-1
+int32_t easeds_bitset_xor(struct easeds_bitset *dst, struct easeds_bitset *src);
+
+// dst &= ~src, 两者位数必须相同, 成功返回0, 失败返回-1
+int32_t easeds_bitset_andnot(struct easeds_bitset *dst, struct easeds_bitset *src);
+
+// 统计 [0, pos) 区间内的置位数量, pos 超过位数时按位数计算, 按需构建 rank 表
+uint64_t easeds_bitset_rank(struct easeds_bitset *bitset, uint64_t pos);
+
+// 查找第 k 个置位(从0开始计数)的位置, 置位数量不足返回 EASEDS_BITSET_NONE, 按需构建 rank 表
+uint64_t easeds_bitset_select(struct easeds_bitset *bitset, uint64_t k);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __EASEDS_BITSET_H__ */
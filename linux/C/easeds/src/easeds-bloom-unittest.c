@@ -0,0 +1,454 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-bloom-unittest.c
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-18 20:50
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  Easeds 布隆过滤器单元测试实现文件, 包含了无假阴性/假阳性率/批量接口/合并/序列化/性能测试.
+ *
+ * @History:
+ *  2026年10月18日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#include "easeds-unittest.h"
+
+// 标准库头文件
+#include <math.h>
+
+// 项目内部头文件
+#include "easeds-bloom.h"
+#include "easeds-utils.h"
+
+static uint64_t bloom_next_rand(uint64_t *seed)
+{
+    *seed ^= *seed << 13;
+    *seed ^= *seed >> 7;
+    *seed ^= *seed << 17;
+    return *seed;
+}
+
+// 统计 [first, first + count) 区间内被判定为可能存在的整数键数量
+static uint64_t bloom_count_positive(struct easeds_bloom *bloom, uint64_t first, uint64_t count)
+{
+    uint64_t positive = 0;
+
+    for (uint64_t key = first; key < first + count; key++) {
+        positive += easeds_bloom_contains(bloom, &key, sizeof(key)) ? 1 : 0;
+    }
+    return positive;
+}
+
+// 基本功能测试: 插入查询, 计数, 清空
+static void test_easeds_bloom_basic(void **state)
+{
+    easeds_unused(state);
+
+    const char    *keys[] = {"user:1001", "user:1002", "session:abcdef", "metric.cpu.load",
+           "a", "a-much-longer-key-that-spans-several-hash-words"};
+    const uint32_t nkeys  = sizeof(keys) / sizeof(keys[0]);
+
+    struct easeds_bloom *bloom = easeds_bloom_create("basic", 1000, 0.01);
+    assert_non_null(bloom);
+    assert_int_equal(easeds_bloom_count(bloom), 0);
+    assert_true(bloom->hash_count >= 1 && bloom->hash_count <= EASEDS_BLOOM_MAX_HASHES);
+    assert_int_equal(easeds_bloom_memory(bloom), bloom->block_count * EASEDS_CACHE_LINE_SIZE);
+    assert_int_equal((uintptr_t)bloom->blocks % EASEDS_CACHE_LINE_SIZE, 0);
+
+    // 空过滤器对任何键都返回不存在
+    for (uint32_t i = 0; i < nkeys; i++) {
+        assert_false(easeds_bloom_contains(bloom, keys[i], (uint32_t)strlen(keys[i])));
+    }
+    assert_true(easeds_bloom_estimate_fpp(bloom) <= 0.0);
+
+    for (uint32_t i = 0; i < nkeys; i++) {
+        easeds_bloom_add(bloom, keys[i], (uint32_t)strlen(keys[i]));
+    }
+    assert_int_equal(easeds_bloom_count(bloom), nkeys);
+    for (uint32_t i = 0; i < nkeys; i++) {
+        assert_true(easeds_bloom_contains(bloom, keys[i], (uint32_t)strlen(keys[i])));
+    }
+
+    // 前缀和键本身是不同的键, 6 个键占满 1000 键容量的极小部分, 几乎不会误判
+    assert_false(easeds_bloom_contains(bloom, "user:100", 8));
+    assert_false(easeds_bloom_contains(bloom, "metric.cpu", 10));
+
+    // 哈希接口和键接口等价
+    uint64_t hash = easeds_hash_bytes("hash-only", 9);
+    easeds_bloom_add_hash(bloom, hash);
+    assert_true(easeds_bloom_contains_hash(bloom, hash));
+    assert_true(easeds_bloom_contains(bloom, "hash-only", 9));
+    assert_int_equal(easeds_bloom_count(bloom), nkeys + 1);
+
+    easeds_bloom_clear(bloom);
+    assert_int_equal(easeds_bloom_count(bloom), 0);
+    for (uint32_t i = 0; i < nkeys; i++) {
+        assert_false(easeds_bloom_contains(bloom, keys[i], (uint32_t)strlen(keys[i])));
+    }
+
+    easeds_bloom_destroy(bloom);
+}
+
+// 操作测试: 无假阴性, 假阳性率接近目标, 批量与单个一致, 合并, 序列化
+static void test_easeds_bloom_operations(void **state)
+{
+    easeds_unused(state);
+
+    const uint32_t count = 100000;
+    const double   fpp   = 0.01;
+
+    struct easeds_bloom *bloom = easeds_bloom_create("ops", count, fpp);
+    assert_non_null(bloom);
+    for (uint64_t key = 0; key < count; key++) {
+        easeds_bloom_add(bloom, &key, sizeof(key));
+    }
+
+    // 无假阴性
+    assert_int_equal(bloom_count_positive(bloom, 0, count), count);
+
+    // 假阳性率: 估算值不超过目标, 实测值在统计误差内接近目标
+    double estimate = easeds_bloom_estimate_fpp(bloom);
+    assert_true(estimate <= fpp);
+    uint64_t false_positive = bloom_count_positive(bloom, count, 4 * count);
+    double   measured       = (double)false_positive / (4.0 * count);
+    MEASURE("[bloom ops]: %u keys, blocks %lu, hashes %u, estimate fpp %.4f, measured %.4f.",
+        count, bloom->block_count, bloom->hash_count, estimate, measured);
+    assert_true(measured < fpp * 1.25);
+    assert_true(measured > fpp * 0.25);
+
+    // 批量查询和单个查询结果一致, 覆盖存在和不存在的键, 数量不是批大小的整数倍
+    const uint32_t batch   = 1000 + 7;
+    uint64_t      *bkeys   = malloc(batch * sizeof(uint64_t));
+    const void   **ptrs    = malloc(batch * sizeof(void *));
+    uint32_t      *lens    = malloc(batch * sizeof(uint32_t));
+    bool          *results = malloc(batch * sizeof(bool));
+    assert_non_null(bkeys);
+    assert_non_null(ptrs);
+    assert_non_null(lens);
+    assert_non_null(results);
+
+    uint64_t seed     = 88172645463325252ULL;
+    uint32_t expected = 0;
+    for (uint32_t i = 0; i < batch; i++) {
+        bkeys[i] = bloom_next_rand(&seed) % (2 * count);
+        ptrs[i]  = &bkeys[i];
+        lens[i]  = sizeof(uint64_t);
+        expected += easeds_bloom_contains(bloom, &bkeys[i], sizeof(uint64_t)) ? 1 : 0;
+    }
+    assert_int_equal(easeds_bloom_contains_batch(bloom, ptrs, lens, batch, results), expected);
+    for (uint32_t i = 0; i < batch; i++) {
+        assert_true(results[i] == easeds_bloom_contains(bloom, &bkeys[i], sizeof(uint64_t)));
+        if (bkeys[i] < count) {
+            assert_true(results[i]);
+        }
+    }
+
+    // 批量插入和逐个插入得到相同的位图
+    struct easeds_bloom *single = easeds_bloom_create("single", count, fpp);
+    struct easeds_bloom *multi  = easeds_bloom_create("multi", count, fpp);
+    assert_non_null(single);
+    assert_non_null(multi);
+    for (uint32_t i = 0; i < batch; i++) {
+        easeds_bloom_add(single, &bkeys[i], sizeof(uint64_t));
+    }
+    assert_int_equal(easeds_bloom_add_batch(multi, ptrs, lens, batch), EASEDS_OK);
+    assert_int_equal(easeds_bloom_count(multi), batch);
+    assert_memory_equal(single->blocks, multi->blocks, easeds_bloom_memory(single));
+
+    // 合并: 两半键分别插入后合并, 与插入全部键的过滤器位图相同
+    struct easeds_bloom *low  = easeds_bloom_create("low", count, fpp);
+    struct easeds_bloom *high = easeds_bloom_create("high", count, fpp);
+    assert_non_null(low);
+    assert_non_null(high);
+    for (uint64_t key = 0; key < count; key++) {
+        easeds_bloom_add(key < count / 2 ? low : high, &key, sizeof(key));
+    }
+    assert_int_equal(bloom_count_positive(low, 0, count / 2), count / 2);
+    assert_int_equal(easeds_bloom_merge(low, high), EASEDS_OK);
+    assert_int_equal(easeds_bloom_count(low), count);
+    assert_int_equal(bloom_count_positive(low, 0, count), count);
+    assert_memory_equal(low->blocks, bloom->blocks, easeds_bloom_memory(bloom));
+
+    // 序列化往返, 恢复的过滤器参数和位图完全一致
+    uint64_t size = easeds_bloom_serialize_size(bloom);
+    assert_int_equal(size, sizeof(struct easeds_bloom_header) + easeds_bloom_memory(bloom));
+    uint8_t *buffer = malloc(size);
+    assert_non_null(buffer);
+    assert_int_equal(easeds_bloom_serialize(bloom, buffer, size), EASEDS_OK);
+
+    struct easeds_bloom *copy = easeds_bloom_deserialize("copy", buffer, size);
+    assert_non_null(copy);
+    assert_int_equal(copy->block_count, bloom->block_count);
+    assert_int_equal(copy->hash_count, bloom->hash_count);
+    assert_int_equal(copy->count, bloom->count);
+    assert_int_equal(copy->expected, bloom->expected);
+    assert_memory_equal(&copy->fpp, &bloom->fpp, sizeof(double));
+    assert_memory_equal(copy->blocks, bloom->blocks, easeds_bloom_memory(bloom));
+    assert_int_equal(bloom_count_positive(copy, 0, count), count);
+    assert_int_equal(
+        bloom_count_positive(copy, count, count), bloom_count_positive(bloom, count, count));
+
+    free(buffer);
+    free(bkeys);
+    free(ptrs);
+    free(lens);
+    free(results);
+    easeds_bloom_destroy(copy);
+    easeds_bloom_destroy(low);
+    easeds_bloom_destroy(high);
+    easeds_bloom_destroy(single);
+    easeds_bloom_destroy(multi);
+    easeds_bloom_destroy(bloom);
+}
+
+// 边界测试: 最小容量, 极端假阳性率, 空键, 空批量, 非对齐缓冲区
+static void test_easeds_bloom_boundary(void **state)
+{
+    easeds_unused(state);
+
+    // 预期只有一个键, 至少分配一个块
+    struct easeds_bloom *bloom = easeds_bloom_create("one", 1, 0.5);
+    assert_non_null(bloom);
+    assert_int_equal(bloom->block_count, 1);
+    easeds_bloom_add(bloom, "k", 1);
+    assert_true(easeds_bloom_contains(bloom, "k", 1));
+    easeds_bloom_destroy(bloom);
+
+    // 极小的假阳性率, 探测位数受上限约束, 通过增加块数满足目标
+    bloom = easeds_bloom_create("tiny", 10000, 1e-9);
+    assert_non_null(bloom);
+    assert_true(bloom->hash_count <= EASEDS_BLOOM_MAX_HASHES);
+    for (uint64_t key = 0; key < 10000; key++) {
+        easeds_bloom_add(bloom, &key, sizeof(key));
+    }
+    assert_int_equal(bloom_count_positive(bloom, 0, 10000), 10000);
+    assert_true(easeds_bloom_estimate_fpp(bloom) <= 1e-9);
+    assert_int_equal(bloom_count_positive(bloom, 10000, 100000), 0);
+    easeds_bloom_destroy(bloom);
+
+    // 极大的假阳性率, 每块平均键数很多, 估算和块数搜索仍然很快
+    const double   loose[]    = {0.99, 0.999};
+    const uint64_t expected[] = {1000000, 1000000000};
+    for (uint32_t f = 0; f < 2; f++) {
+        for (uint32_t e = 0; e < 2; e++) {
+            int64_t start = easeds_get_current_time_ns();
+            bloom         = easeds_bloom_create("loose", expected[e], loose[f]);
+            int64_t cost  = easeds_get_current_time_ns() - start;
+            assert_non_null(bloom);
+            assert_true(cost < 100 * 1000 * 1000);
+            assert_true(easeds_bloom_estimate_fpp(bloom) < 1.0);
+            easeds_bloom_destroy(bloom);
+        }
+    }
+
+    // 超过预期数量后仍然没有假阴性, 估算的假阳性率随之升高
+    bloom = easeds_bloom_create("over", 1000, 0.01);
+    assert_non_null(bloom);
+    for (uint64_t key = 0; key < 10000; key++) {
+        easeds_bloom_add(bloom, &key, sizeof(key));
+    }
+    assert_int_equal(bloom_count_positive(bloom, 0, 10000), 10000);
+    assert_true(easeds_bloom_estimate_fpp(bloom) > 0.1);
+
+    // 空键是合法的键
+    easeds_bloom_add(bloom, NULL, 0);
+    assert_true(easeds_bloom_contains(bloom, NULL, 0));
+    assert_true(easeds_bloom_contains(bloom, "", 0));
+
+    // 空批量
+    assert_int_equal(easeds_bloom_add_batch(bloom, NULL, NULL, 0), EASEDS_OK);
+    assert_int_equal(easeds_bloom_contains_batch(bloom, NULL, NULL, 0, NULL), 0);
+
+    // 序列化到非对齐的缓冲区并恢复, 刚好等于所需大小
+    uint64_t size   = easeds_bloom_serialize_size(bloom);
+    uint8_t *buffer = malloc(size + 1);
+    assert_non_null(buffer);
+    assert_int_equal(easeds_bloom_serialize(bloom, buffer + 1, size), EASEDS_OK);
+    struct easeds_bloom *copy = easeds_bloom_deserialize(NULL, buffer + 1, size);
+    assert_non_null(copy);
+    assert_memory_equal(copy->blocks, bloom->blocks, easeds_bloom_memory(bloom));
+    assert_true(easeds_bloom_contains(copy, NULL, 0));
+
+    free(buffer);
+    easeds_bloom_destroy(copy);
+    easeds_bloom_destroy(bloom);
+}
+
+// 错误处理测试: 非法参数, 参数不同的合并, 损坏的序列化数据
+static void test_easeds_bloom_error(void **state)
+{
+    easeds_unused(state);
+
+    assert_null(easeds_bloom_create("bad", 0, 0.01));
+    assert_null(easeds_bloom_create("bad", 100, 0.0));
+    assert_null(easeds_bloom_create("bad", 100, 1.0));
+    assert_null(easeds_bloom_create("bad", 100, -0.5));
+    assert_null(easeds_bloom_create("bad", 100, NAN));
+
+    // 所需块数超过上限, 包括超出 uint64_t 范围的估算值
+    assert_null(easeds_bloom_create("huge", 1ULL << 40, 1e-300));
+    assert_null(easeds_bloom_create("huge", UINT64_MAX, 1e-300));
+
+    // 空指针不会崩溃
+    easeds_bloom_destroy(NULL);
+    easeds_bloom_clear(NULL);
+    easeds_bloom_add(NULL, "k", 1);
+    easeds_bloom_add_hash(NULL, 1);
+    assert_false(easeds_bloom_contains(NULL, "k", 1));
+    assert_false(easeds_bloom_contains_hash(NULL, 1));
+    assert_int_equal(easeds_bloom_count(NULL), 0);
+    assert_int_equal(easeds_bloom_memory(NULL), 0);
+    assert_int_equal(easeds_bloom_serialize_size(NULL), 0);
+
+    struct easeds_bloom *bloom = easeds_bloom_create("err", 1000, 0.01);
+    struct easeds_bloom *other = easeds_bloom_create("other", 100000, 0.01);
+    assert_non_null(bloom);
+    assert_non_null(other);
+
+    const void *key = "k";
+    uint32_t    len = 1;
+    bool        result;
+    assert_int_equal(easeds_bloom_add_batch(NULL, &key, &len, 1), EASEDS_ERROR);
+    assert_int_equal(easeds_bloom_add_batch(bloom, NULL, &len, 1), EASEDS_ERROR);
+    assert_int_equal(easeds_bloom_add_batch(bloom, &key, NULL, 1), EASEDS_ERROR);
+    assert_int_equal(easeds_bloom_contains_batch(bloom, &key, &len, 1, NULL), 0);
+    assert_int_equal(easeds_bloom_contains_batch(NULL, &key, &len, 1, &result), 0);
+
+    // 块数量不同不能合并, 目标过滤器保持不变
+    easeds_bloom_add(other, "k", 1);
+    assert_int_equal(easeds_bloom_merge(bloom, other), EASEDS_ERROR);
+    assert_int_equal(easeds_bloom_merge(bloom, NULL), EASEDS_ERROR);
+    assert_int_equal(easeds_bloom_merge(NULL, bloom), EASEDS_ERROR);
+    assert_int_equal(easeds_bloom_count(bloom), 0);
+
+    // 序列化缓冲区不足
+    easeds_bloom_add(bloom, "k", 1);
+    uint64_t size   = easeds_bloom_serialize_size(bloom);
+    uint8_t *buffer = malloc(size);
+    assert_non_null(buffer);
+    assert_int_equal(easeds_bloom_serialize(bloom, buffer, size - 1), EASEDS_ERROR);
+    assert_int_equal(easeds_bloom_serialize(bloom, NULL, size), EASEDS_ERROR);
+    assert_int_equal(easeds_bloom_serialize(NULL, buffer, size), EASEDS_ERROR);
+    assert_int_equal(easeds_bloom_serialize(bloom, buffer, size), EASEDS_OK);
+
+    // 截断, 多余数据, 空缓冲区
+    assert_null(easeds_bloom_deserialize("bad", buffer, size - 1));
+    assert_null(easeds_bloom_deserialize("bad", buffer, sizeof(struct easeds_bloom_header) - 1));
+    assert_null(easeds_bloom_deserialize("bad", NULL, size));
+
+    // 逐个破坏头部字段
+    struct easeds_bloom_header *header = (struct easeds_bloom_header *)buffer;
+    header->magic                      = 0x424C4F4DU;
+    assert_null(easeds_bloom_deserialize("bad", buffer, size));
+    header->magic   = EASEDS_BLOOM_MAGIC;
+    header->version = EASEDS_BLOOM_VERSION + 1;
+    assert_null(easeds_bloom_deserialize("bad", buffer, size));
+    header->version    = EASEDS_BLOOM_VERSION;
+    header->hash_count = 0;
+    assert_null(easeds_bloom_deserialize("bad", buffer, size));
+    header->hash_count = EASEDS_BLOOM_MAX_HASHES + 1;
+    assert_null(easeds_bloom_deserialize("bad", buffer, size));
+    header->hash_count  = (uint16_t)bloom->hash_count;
+    header->block_count = bloom->block_count + 1;
+    assert_null(easeds_bloom_deserialize("bad", buffer, size));
+    header->block_count = 0;
+    assert_null(easeds_bloom_deserialize("bad", buffer, size));
+
+    // 恢复原值后可以正常解析
+    header->block_count       = bloom->block_count;
+    struct easeds_bloom *copy = easeds_bloom_deserialize("copy", buffer, size);
+    assert_non_null(copy);
+    assert_true(easeds_bloom_contains(copy, "k", 1));
+
+    free(buffer);
+    easeds_bloom_destroy(copy);
+    easeds_bloom_destroy(other);
+    easeds_bloom_destroy(bloom);
+}
+
+// 性能测试: 单个和批量接口的插入查询耗时, 每个键占用的位数
+static void test_easeds_bloom_perf(void **state)
+{
+    easeds_unused(state);
+
+    const uint32_t count   = 1000000;
+    const double   rates[] = {0.01, 0.001};
+    uint64_t      *keys    = malloc(2 * count * sizeof(uint64_t));
+    const void   **ptrs    = malloc(2 * count * sizeof(void *));
+    uint32_t      *lens    = malloc(2 * count * sizeof(uint32_t));
+    bool          *results = malloc(2 * count * sizeof(bool));
+    assert_non_null(keys);
+    assert_non_null(ptrs);
+    assert_non_null(lens);
+    assert_non_null(results);
+
+    // 前一半为插入的键, 后一半为不存在的键
+    uint64_t seed = 88172645463325252ULL;
+    for (uint32_t i = 0; i < 2 * count; i++) {
+        keys[i] = bloom_next_rand(&seed);
+        ptrs[i] = &keys[i];
+        lens[i] = sizeof(uint64_t);
+    }
+
+    for (uint32_t r = 0; r < sizeof(rates) / sizeof(rates[0]); r++) {
+        struct easeds_bloom *single = easeds_bloom_create("single", count, rates[r]);
+        struct easeds_bloom *batch  = easeds_bloom_create("batch", count, rates[r]);
+        assert_non_null(single);
+        assert_non_null(batch);
+
+        int64_t start = easeds_get_current_time_ns();
+        for (uint32_t i = 0; i < count; i++) {
+            easeds_bloom_add(single, &keys[i], sizeof(uint64_t));
+        }
+        int64_t add_single = easeds_get_current_time_ns() - start;
+
+        start = easeds_get_current_time_ns();
+        assert_int_equal(easeds_bloom_add_batch(batch, ptrs, lens, count), EASEDS_OK);
+        int64_t add_batch = easeds_get_current_time_ns() - start;
+
+        uint32_t positive = 0;
+        start             = easeds_get_current_time_ns();
+        for (uint32_t i = 0; i < 2 * count; i++) {
+            positive += easeds_bloom_contains(single, &keys[i], sizeof(uint64_t)) ? 1 : 0;
+        }
+        int64_t find_single = easeds_get_current_time_ns() - start;
+
+        start = easeds_get_current_time_ns();
+        assert_int_equal(
+            easeds_bloom_contains_batch(batch, ptrs, lens, 2 * count, results), positive);
+        int64_t find_batch = easeds_get_current_time_ns() - start;
+
+        uint64_t memory = easeds_bloom_memory(single);
+        double   fp     = (double)(positive - count) / count;
+        MEASURE("[bloom perf]: fpp %.3f, %u keys, add ns/op: single %.1f, batch %.1f.", rates[r],
+            count, (double)add_single / count, (double)add_batch / count);
+        MEASURE("[bloom perf]: fpp %.3f, %u queries, contains ns/op: single %.1f, batch %.1f.",
+            rates[r], 2 * count, (double)find_single / (2 * count),
+            (double)find_batch / (2 * count));
+        MEASURE("[bloom perf]: fpp %.3f, hashes %u, %.2f bits/key, measured fpp %.5f.", rates[r],
+            single->hash_count, (double)memory * 8 / count, fp);
+        assert_true(fp < rates[r] * 1.25);
+
+        easeds_bloom_destroy(single);
+        easeds_bloom_destroy(batch);
+    }
+
+    free(keys);
+    free(ptrs);
+    free(lens);
+    free(results);
+}
+
+EASEDS_UNITTEST_REGISTER(easeds_unittest_bloom){
+    cmocka_unit_test(test_easeds_bloom_basic),
+    cmocka_unit_test(test_easeds_bloom_operations),
+    cmocka_unit_test(test_easeds_bloom_boundary),
+    cmocka_unit_test(test_easeds_bloom_error),
+    cmocka_unit_test(test_easeds_bloom_perf),
+    easeds_unit_test_end,
+};
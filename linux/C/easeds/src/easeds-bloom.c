@@ -0,0 +1,450 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-bloom.c
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-18 20:40
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  缓存行分块布隆过滤器(Blocked Bloom Filter)实现文件.
+ *
+ * @History:
+ *  2026年10月18日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#include "easeds-bloom.h"
+
+// 标准库头文件
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// 项目内部头文件
+#include "easeds-log.h"
+#include "easeds-utils.h"
+
+/* 批量接口每轮先哈希和预取的键数量 */
+#define BLOOM_BATCH 16
+
+/* 块数量上限, 块下标由哈希值高 32 位按乘法映射得到 */
+#define BLOOM_MAX_BLOCKS ((uint64_t)UINT32_MAX)
+
+/* 泊松求和窗口的半宽, 单位为标准差, 窗口外的概率低于 e^-50 */
+#define BLOOM_POISSON_SIGMAS 10.0
+
+// 按泊松分布估算分块过滤器的假阳性率, 每块平均 lambda 个键, 每个键 k 个探测位
+static double bloom_blocked_fpp(double lambda, uint32_t k)
+{
+    double spread = BLOOM_POISSON_SIGMAS * sqrt(lambda) + BLOOM_POISSON_SIGMAS;
+    double first  = floor(lambda - spread);
+    double last   = ceil(lambda + spread);
+    double total  = 0.0;
+
+    if (first < 0.0) {
+        first = 0.0;
+    }
+
+    /* 只对 lambda 附近的窗口求和. 首项由 lgamma 计算, 之后按 p(i+1) = p(i) * lambda / (i+1)
+     * 递推; 块内 i 个键时某一位仍为0的概率 r^i 同样递推, 避免逐项调用 exp/pow */
+    double p     = exp(first * log(lambda) - lambda - lgamma(first + 1.0));
+    double ratio = exp((double)k * log1p(-1.0 / EASEDS_BLOOM_BLOCK_BITS));
+    double empty = exp(first * log(ratio));
+    for (double i = first; i <= last; i += 1.0) {
+        double fill = 1.0 - empty;
+        double hit  = fill;
+        for (uint32_t j = 1; j < k; j++) {
+            hit *= fill;
+        }
+        total += p * hit;
+        p *= lambda / (i + 1.0);
+        empty *= ratio;
+    }
+
+    return total;
+}
+
+// 在指定块数量下选择假阳性率最低的探测位数, 返回对应的假阳性率
+static double bloom_best_hashes(uint64_t expected, uint64_t blocks, uint32_t *hash_count)
+{
+    double lambda = (double)expected / (double)blocks;
+    double best   = 1.0;
+
+    *hash_count = 1;
+    for (uint32_t k = 1; k <= EASEDS_BLOOM_MAX_HASHES; k++) {
+        double fpp = bloom_blocked_fpp(lambda, k);
+        if (fpp < best) {
+            best        = fpp;
+            *hash_count = k;
+        }
+    }
+
+    return best;
+}
+
+// 根据哈希值选择块, 高 32 位按乘法映射到 [0, block_count), 避免取模
+static inline uint64_t *bloom_block(struct easeds_bloom *bloom, uint64_t hash)
+{
+    uint64_t index = ((hash >> 32) * bloom->block_count) >> 32;
+    return bloom->blocks + index * EASEDS_BLOOM_BLOCK_WORDS;
+}
+
+// 根据哈希值生成块内的探测位掩码, 以哈希值为种子做乘法同余, 每次取最高 9 位作为探测位.
+// 双重哈希在 512 位的块内生成的是等差数列, 不同键的探测位重叠较多, 实测假阳性率明显偏高.
+static inline void bloom_mask(
+    struct easeds_bloom *bloom, uint64_t hash, uint64_t mask[EASEDS_BLOOM_BLOCK_WORDS])
+{
+    uint64_t state = hash;
+
+    memset(mask, 0, sizeof(uint64_t) * EASEDS_BLOOM_BLOCK_WORDS);
+    for (uint32_t i = 0; i < bloom->hash_count; i++) {
+        state        = state * 0x5851F42D4C957F2DULL + 0x14057B7EF767814FULL;
+        uint32_t bit = (uint32_t)(state >> 55);
+        mask[bit >> 6] |= 1ULL << (bit & 63);
+    }
+}
+
+// 使用已计算的 64 位哈希值插入
+void easeds_bloom_add_hash(struct easeds_bloom *bloom, uint64_t hash)
+{
+    uint64_t  mask[EASEDS_BLOOM_BLOCK_WORDS];
+    uint64_t *block;
+
+    if (unlikely(bloom == NULL)) {
+        return;
+    }
+
+    block = bloom_block(bloom, hash);
+    bloom_mask(bloom, hash, mask);
+    for (uint32_t i = 0; i < EASEDS_BLOOM_BLOCK_WORDS; i++) {
+        block[i] |= mask[i];
+    }
+    bloom->count++;
+}
+
+// 使用已计算的 64 位哈希值查询
+bool easeds_bloom_contains_hash(struct easeds_bloom *bloom, uint64_t hash)
+{
+    uint64_t  mask[EASEDS_BLOOM_BLOCK_WORDS];
+    uint64_t *block;
+    uint64_t  diff = 0;
+
+    if (unlikely(bloom == NULL)) {
+        return false;
+    }
+
+    block = bloom_block(bloom, hash);
+
+    /* 8 个字一起比较, 编译器可以向量化, 没有逐位的提前退出分支 */
+    bloom_mask(bloom, hash, mask);
+    for (uint32_t i = 0; i < EASEDS_BLOOM_BLOCK_WORDS; i++) {
+        diff |= mask[i] & ~block[i];
+    }
+    return diff == 0;
+}
+
+// 插入一个键
+void easeds_bloom_add(struct easeds_bloom *bloom, const void *key, uint32_t len)
+{
+    easeds_bloom_add_hash(bloom, easeds_hash_bytes(key, len));
+}
+
+// 查询一个键, 返回false表示一定不存在, 返回true表示可能存在
+bool easeds_bloom_contains(struct easeds_bloom *bloom, const void *key, uint32_t len)
+{
+    return easeds_bloom_contains_hash(bloom, easeds_hash_bytes(key, len));
+}
+
+// 批量插入 count 个键, 成功返回0, 参数无效返回-1
+int32_t easeds_bloom_add_batch(struct easeds_bloom *bloom, const void *const *keys,
+    const uint32_t *lens, uint32_t count)
+{
+    uint64_t hashes[BLOOM_BATCH];
+
+    if (unlikely(bloom == NULL || (count != 0 && (keys == NULL || lens == NULL)))) {
+        EASEDS_ERR("[easeds_bloom_add_batch]: Invalid bloom or keys pointer.");
+        return -1;
+    }
+
+    for (uint32_t base = 0; base < count; base += BLOOM_BATCH) {
+        uint32_t n = count - base < BLOOM_BATCH ? count - base : BLOOM_BATCH;
+
+        /* 先计算哈希并预取块, 探测时各块的访存已经并行发出 */
+        for (uint32_t i = 0; i < n; i++) {
+            hashes[i] = easeds_hash_bytes(keys[base + i], lens[base + i]);
+            __builtin_prefetch(bloom_block(bloom, hashes[i]), 1);
+        }
+        for (uint32_t i = 0; i < n; i++) {
+            easeds_bloom_add_hash(bloom, hashes[i]);
+        }
+    }
+
+    return 0;
+}
+
+// 批量查询 count 个键, 结果写入 results, 返回可能存在的键数量
+uint32_t easeds_bloom_contains_batch(struct easeds_bloom *bloom, const void *const *keys,
+    const uint32_t *lens, uint32_t count, bool *results)
+{
+    uint64_t hashes[BLOOM_BATCH];
+    uint32_t positive = 0;
+
+    if (unlikely(bloom == NULL
+                 || (count != 0 && (keys == NULL || lens == NULL || results == NULL)))) {
+        EASEDS_ERR("[easeds_bloom_contains_batch]: Invalid bloom or keys pointer.");
+        return 0;
+    }
+
+    for (uint32_t base = 0; base < count; base += BLOOM_BATCH) {
+        uint32_t n = count - base < BLOOM_BATCH ? count - base : BLOOM_BATCH;
+
+        for (uint32_t i = 0; i < n; i++) {
+            hashes[i] = easeds_hash_bytes(keys[base + i], lens[base + i]);
+            __builtin_prefetch(bloom_block(bloom, hashes[i]), 0);
+        }
+        for (uint32_t i = 0; i < n; i++) {
+            results[base + i] = easeds_bloom_contains_hash(bloom, hashes[i]);
+            positive += results[base + i] ? 1 : 0;
+        }
+    }
+
+    return positive;
+}
+
+// 按块数量和探测位数分配过滤器, 位图清零, 失败返回NULL
+static struct easeds_bloom *bloom_alloc(const char *name, uint64_t blocks, uint32_t hash_count)
+{
+    struct easeds_bloom *bloom = __easeds_malloc(sizeof(struct easeds_bloom));
+    if (unlikely(bloom == NULL)) {
+        EASEDS_ERR("[bloom_alloc]: Malloc bloom failed.");
+        return NULL;
+    }
+
+    memset(bloom, 0, sizeof(struct easeds_bloom));
+    bloom->blocks = __easeds_aligned_alloc(EASEDS_CACHE_LINE_SIZE, blocks * EASEDS_CACHE_LINE_SIZE);
+    if (unlikely(bloom->blocks == NULL)) {
+        EASEDS_ERR("[bloom_alloc]: Malloc %lu blocks failed.", blocks);
+        __easeds_free(bloom);
+        return NULL;
+    }
+
+    memset(bloom->blocks, 0, blocks * EASEDS_CACHE_LINE_SIZE);
+    bloom->name        = name;
+    bloom->block_count = blocks;
+    bloom->hash_count  = hash_count;
+    return bloom;
+}
+
+// 按预期键数量和目标假阳性率(0, 1)创建过滤器, 失败返回NULL
+struct easeds_bloom *easeds_bloom_create(const char *name, uint64_t expected, double fpp)
+{
+    uint32_t hash_count;
+    uint64_t blocks, low;
+    double   bits;
+    double   estimate;
+
+    if (unlikely(expected == 0 || !(fpp > 0.0 && fpp < 1.0))) {
+        EASEDS_ERR("[easeds_bloom_create]: Invalid expected %lu or fpp %f.", expected, fpp);
+        return NULL;
+    }
+
+    /* 以标准布隆过滤器的最优位数为起点, 分块后负载不均, 块数倍增直到满足目标,
+     * 再在最后一次不满足和满足之间二分, 找到满足目标的最小块数 */
+    bits = -(double)expected * log(fpp) / (M_LN2 * M_LN2) / EASEDS_BLOOM_BLOCK_BITS;
+    if (unlikely(!(bits < (double)BLOOM_MAX_BLOCKS))) {
+        /* 先以浮点数比较, 超出范围的浮点数转换为整数是未定义行为 */
+        EASEDS_ERR("[easeds_bloom_create]: Too many blocks for expected %lu.", expected);
+        return NULL;
+    }
+    blocks = (uint64_t)bits + 1;
+    low    = blocks - 1;
+    for (;;) {
+        estimate = bloom_best_hashes(expected, blocks, &hash_count);
+        if (estimate <= fpp) {
+            break;
+        }
+        if (unlikely(blocks == BLOOM_MAX_BLOCKS)) {
+            EASEDS_ERR("[easeds_bloom_create]: Too many blocks for expected %lu.", expected);
+            return NULL;
+        }
+        low    = blocks;
+        blocks = blocks * 2 < BLOOM_MAX_BLOCKS ? blocks * 2 : BLOOM_MAX_BLOCKS;
+    }
+
+    /* low 不满足目标(起点之前的块数不会满足), blocks 满足目标 */
+    while (low + 1 < blocks) {
+        uint64_t mid = low + (blocks - low) / 2;
+        if (bloom_best_hashes(expected, mid, &hash_count) <= fpp) {
+            blocks = mid;
+        } else {
+            low = mid;
+        }
+    }
+    bloom_best_hashes(expected, blocks, &hash_count);
+
+    struct easeds_bloom *bloom = bloom_alloc(name, blocks, hash_count);
+    if (unlikely(bloom == NULL)) {
+        return NULL;
+    }
+    bloom->expected = expected;
+    bloom->fpp      = fpp;
+
+    PFL_DEBUG("[easeds_bloom_create]: name=%s, expected=%lu, blocks=%lu, hashes=%u.",
+        name != NULL ? name : "(null)", expected, blocks, hash_count);
+    return bloom;
+}
+
+// 销毁过滤器
+void easeds_bloom_destroy(struct easeds_bloom *bloom)
+{
+    if (unlikely(bloom == NULL)) {
+        return;
+    }
+
+    __easeds_free(bloom->blocks);
+    __easeds_free(bloom);
+}
+
+// 清空过滤器, 块数量和探测位数保持不变
+void easeds_bloom_clear(struct easeds_bloom *bloom)
+{
+    if (unlikely(bloom == NULL)) {
+        return;
+    }
+
+    memset(bloom->blocks, 0, bloom->block_count * EASEDS_CACHE_LINE_SIZE);
+    bloom->count = 0;
+}
+
+// 获取已插入键数量
+uint64_t easeds_bloom_count(struct easeds_bloom *bloom)
+{
+    return bloom != NULL ? bloom->count : 0;
+}
+
+// 获取位图占用的字节数, 不包含过滤器结构体本身
+uint64_t easeds_bloom_memory(struct easeds_bloom *bloom)
+{
+    return bloom != NULL ? bloom->block_count * EASEDS_CACHE_LINE_SIZE : 0;
+}
+
+// 将 src 合并到 dst, 两者块数量和探测位数必须相同, 成功返回0, 失败返回-1
+int32_t easeds_bloom_merge(struct easeds_bloom *dst, struct easeds_bloom *src)
+{
+    if (unlikely(dst == NULL || src == NULL)) {
+        EASEDS_ERR("[easeds_bloom_merge]: Invalid bloom pointer.");
+        return -1;
+    }
+
+    if (unlikely(dst->block_count != src->block_count || dst->hash_count != src->hash_count)) {
+        EASEDS_ERR("[easeds_bloom_merge]: Geometry mismatch, blocks %lu/%lu, hashes %u/%u.",
+            dst->block_count, src->block_count, dst->hash_count, src->hash_count);
+        return -1;
+    }
+
+    uint64_t words = dst->block_count * EASEDS_BLOOM_BLOCK_WORDS;
+    for (uint64_t i = 0; i < words; i++) {
+        dst->blocks[i] |= src->blocks[i];
+    }
+
+    /* 两侧有重复键时计数偏大, 估算的假阳性率偏保守 */
+    dst->count += src->count;
+    return 0;
+}
+
+// 按当前键数量估算假阳性率
+double easeds_bloom_estimate_fpp(struct easeds_bloom *bloom)
+{
+    if (unlikely(bloom == NULL)) {
+        return 1.0;
+    }
+
+    if (bloom->count == 0) {
+        return 0.0;
+    }
+
+    return bloom_blocked_fpp((double)bloom->count / (double)bloom->block_count, bloom->hash_count);
+}
+
+// 获取序列化需要的缓冲区大小, 为头部加上位图大小
+uint64_t easeds_bloom_serialize_size(struct easeds_bloom *bloom)
+{
+    if (unlikely(bloom == NULL)) {
+        return 0;
+    }
+
+    return sizeof(struct easeds_bloom_header) + bloom->block_count * EASEDS_CACHE_LINE_SIZE;
+}
+
+// 序列化到缓冲区, 缓冲区大小不足返回-1, 成功返回0
+int32_t easeds_bloom_serialize(struct easeds_bloom *bloom, void *buffer, uint64_t size)
+{
+    struct easeds_bloom_header header;
+
+    if (unlikely(bloom == NULL || buffer == NULL)) {
+        EASEDS_ERR("[easeds_bloom_serialize]: Invalid bloom or buffer pointer.");
+        return -1;
+    }
+
+    if (unlikely(size < easeds_bloom_serialize_size(bloom))) {
+        EASEDS_ERR("[easeds_bloom_serialize]: Buffer size %lu too small.", size);
+        return -1;
+    }
+
+    memset(&header, 0, sizeof(header));
+    header.magic       = EASEDS_BLOOM_MAGIC;
+    header.version     = EASEDS_BLOOM_VERSION;
+    header.hash_count  = (uint16_t)bloom->hash_count;
+    header.block_count = bloom->block_count;
+    header.count       = bloom->count;
+    header.expected    = bloom->expected;
+    header.fpp         = bloom->fpp;
+
+    /* 缓冲区不要求对齐, 按字节拷贝 */
+    memcpy(buffer, &header, sizeof(header));
+    memcpy((uint8_t *)buffer + sizeof(header), bloom->blocks,
+        bloom->block_count * EASEDS_CACHE_LINE_SIZE);
+    return 0;
+}
+
+// 从缓冲区恢复过滤器, 缓冲区可以是任意对齐, 格式校验失败返回NULL
+struct easeds_bloom *easeds_bloom_deserialize(const char *name, const void *buffer,
+    uint64_t size)
+{
+    struct easeds_bloom_header header;
+
+    if (unlikely(buffer == NULL || size < sizeof(header))) {
+        EASEDS_ERR("[easeds_bloom_deserialize]: Invalid buffer or size %lu.", size);
+        return NULL;
+    }
+
+    memcpy(&header, buffer, sizeof(header));
+    if (unlikely(header.magic != EASEDS_BLOOM_MAGIC || header.version != EASEDS_BLOOM_VERSION)) {
+        EASEDS_ERR("[easeds_bloom_deserialize]: Bad magic 0x%x or version %u.", header.magic,
+            header.version);
+        return NULL;
+    }
+
+    if (unlikely(header.hash_count == 0 || header.hash_count > EASEDS_BLOOM_MAX_HASHES
+                 || header.block_count == 0 || header.block_count > BLOOM_MAX_BLOCKS
+                 || size != sizeof(header) + header.block_count * EASEDS_CACHE_LINE_SIZE)) {
+        EASEDS_ERR("[easeds_bloom_deserialize]: Bad geometry, blocks %lu, hashes %u, size %lu.",
+            header.block_count, header.hash_count, size);
+        return NULL;
+    }
+
+    struct easeds_bloom *bloom = bloom_alloc(name, header.block_count, header.hash_count);
+    if (unlikely(bloom == NULL)) {
+        return NULL;
+    }
+
+    memcpy(bloom->blocks, (const uint8_t *)buffer + sizeof(header),
+        header.block_count * EASEDS_CACHE_LINE_SIZE);
+    bloom->count    = header.count;
+    bloom->expected = header.expected;
+    bloom->fpp      = header.fpp;
+    return bloom;
+}
@@ -0,0 +1,157 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-bloom.h
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-18 20:40
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  缓存行分块布隆过滤器(Blocked Bloom Filter), 在昂贵的查找之前做廉价的否定判断.
+ *
+ * @History:
+ *  2026年10月18日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#ifndef __EASEDS_BLOOM_H__
+#define __EASEDS_BLOOM_H__
+
+/* C 标准库头文件 */
+#include <stdbool.h>
+#include <stdint.h>
+
+/* 项目内部头文件 */
+#include "easeds-environment.h"
+#include "easeds-public.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 每个块为一个缓存行, 8 个 64 位字共 512 位 */
+#define EASEDS_BLOOM_BLOCK_WORDS (EASEDS_CACHE_LINE_SIZE / 8)
+#define EASEDS_BLOOM_BLOCK_BITS  (EASEDS_CACHE_LINE_SIZE * 8)
+
+/* 每个键的最大探测位数 */
+#define EASEDS_BLOOM_MAX_HASHES 16
+
+/* 序列化格式的魔数和版本, 按主机字节序写入, 字节序不同的进程读取时魔数校验失败 */
+#define EASEDS_BLOOM_MAGIC   0x4D4F4C42U /* "BLOM" */
+#define EASEDS_BLOOM_VERSION 1
+
+/* 序列化头部, 后面紧跟 block_count 个块的位图 */
+struct easeds_bloom_header {
+    uint32_t magic;       /* 魔数, EASEDS_BLOOM_MAGIC */
+    uint16_t version;     /* 格式版本, EASEDS_BLOOM_VERSION */
+    uint16_t hash_count;  /* 每个键的探测位数 */
+    uint64_t block_count; /* 块数量 */
+    uint64_t count;       /* 已插入键数量 */
+    uint64_t expected;    /* 创建时的预期键数量 */
+    double   fpp;         /* 创建时的目标假阳性率 */
+};
+
+/**
+ * 实现一个缓存行分块的布隆过滤器, 用于在哈希表/磁盘等昂贵的查找之前快速排除不存在的键.
+ *  (1) 键的哈希值高 32 位选择一个 64 字节的块, 所有探测位都落在这个块内,
+ *      插入和查询都只访问一个缓存行, 不会像标准布隆过滤器那样产生 k 次随机访存.
+ *  (2) 块内探测位由哈希值做种子的乘法同余序列生成, 先合成 8 个字的掩码, 再与块整体比较.
+ *  (3) 分块会让各块负载不均, 假阳性率略高于同样大小的标准过滤器,
+ *      创建时按泊松分布估算实际假阳性率, 选择最优探测位数, 并增加块数直到满足目标.
+ *  (4) 批量接口先计算所有键的哈希并预取对应的块, 再统一探测, 隐藏内存访问延迟.
+ *  (5) 参数相同的两个过滤器可以按位或合并, 结果等价于两者键集合的并集.
+ *      可以序列化到连续的缓冲区, 在进程之间传递后直接恢复.
+ *  (6) 只能插入不能删除, 非线程安全, 需要用户自行保证线程安全性.
+ */
+struct easeds_bloom {
+    const char *name;        /* 名称, 预留字段, 可用于调试和日志 */
+    uint64_t   *blocks;      /* 位图, 按缓存行对齐, 每块 EASEDS_BLOOM_BLOCK_WORDS 个字 */
+    uint64_t    block_count; /* 块数量 */
+    uint64_t    expected;    /* 创建时的预期键数量 */
+    uint64_t    count;       /* 已插入键数量, 重复插入同一个键会重复计数 */
+    double      fpp;         /* 创建时的目标假阳性率 */
+    uint32_t    hash_count;  /* 每个键的探测位数 */
+    uint32_t    pad;         /* 对齐填充 */
+};
+
+/**
+ * 常见布隆过滤器操作函数:
+ *
+ * 函数名                           功能描述
+ * ----------------------------     ------------------------------------------------------
+ * easeds_bloom_create              按预期键数量和目标假阳性率创建过滤器, 失败返回NULL
+ * easeds_bloom_destroy             销毁过滤器
+ * easeds_bloom_clear               清空过滤器, 参数保持不变
+ * easeds_bloom_count               获取已插入键数量
+ * easeds_bloom_memory              获取位图占用的字节数
+ * easeds_bloom_add                 插入一个键
+ * easeds_bloom_contains            查询一个键, 不存在时一定返回false
+ * easeds_bloom_add_hash            使用已计算的哈希值插入
+ * easeds_bloom_contains_hash       使用已计算的哈希值查询
+ * easeds_bloom_add_batch           批量插入键
+ * easeds_bloom_contains_batch      批量查询键, 返回可能存在的数量
+ * easeds_bloom_merge               将另一个参数相同的过滤器合并进来, 成功返回0, 失败返回-1
+ * easeds_bloom_estimate_fpp        按当前键数量估算假阳性率
+ * easeds_bloom_serialize_size      获取序列化需要的缓冲区大小
+ * easeds_bloom_serialize           序列化到缓冲区, 成功返回0, 失败返回-1
+ * easeds_bloom_deserialize         从缓冲区恢复过滤器, 失败返回NULL
+ */
+
+// 按预期键数量和目标假阳性率(0, 1)创建过滤器, 失败返回NULL
+struct easeds_bloom *easeds_bloom_create(const char *name, uint64_t expected, double fpp);
+
+// 销毁过滤器
+void easeds_bloom_destroy(struct easeds_bloom *bloom);
+
+// 清空过滤器, 块数量和探测位数保持不变
+void easeds_bloom_clear(struct easeds_bloom *bloom);
+
+// 获取已插入键数量
+uint64_t easeds_bloom_count(struct easeds_bloom *bloom);
+
+// 获取位图占用的字节数, 不包含过滤器结构体本身
+uint64_t easeds_bloom_memory(struct easeds_bloom *bloom);
+
+// 插入一个键
+void easeds_bloom_add(struct easeds_bloom *bloom, const void *key, uint32_t len);
+
+// 查询一个键, 返回false表示一定不存在, 返回true表示可能存在
+bool easeds_bloom_contains(struct easeds_bloom *bloom, const void *key, uint32_t len);
+
+// 使用 easeds_hash_bytes 等已计算的 64 位哈希值插入, 哈希值必须分布均匀
+void easeds_bloom_add_hash(struct easeds_bloom *bloom, uint64_t hash);
+
+// 使用已计算的 64 位哈希值查询
+bool easeds_bloom_contains_hash(struct easeds_bloom *bloom, uint64_t hash);
+
+// 批量插入 count 个键, 成功返回0, 参数无效返回-1
+int32_t easeds_bloom_add_batch(struct easeds_bloom *bloom, const void *const *keys,
+    const uint32_t *lens, uint32_t count);
+
+// 批量查询 count 个键, 结果写入 results, 返回可能存在的键数量
+uint32_t easeds_bloom_contains_batch(struct easeds_bloom *bloom, const void *const *keys,
+    const uint32_t *lens, uint32_t count, bool *results);
+
+// 将 src 合并到 dst, 两者块数量和探测位数必须相同, 成功返回0, 失败返回-1
+int32_t easeds_bloom_merge(struct easeds_bloom *dst, struct easeds_bloom *src);
+
+// 按当前键数量估算假阳性率
+double easeds_bloom_estimate_fpp(struct easeds_bloom *bloom);
+
+// 获取序列化需要的缓冲区大小, 为头部加上位图大小
+uint64_t easeds_bloom_serialize_size(struct easeds_bloom *bloom);
+
+// 序列化到缓冲区, 缓冲区大小不足返回-1, 成功返回0
+int32_t easeds_bloom_serialize(struct easeds_bloom *bloom, void *buffer, uint64_t size);
+
+// 从缓冲区恢复过滤器, 缓冲区可以是任意对齐, 格式校验失败返回NULL
+struct easeds_bloom *easeds_bloom_deserialize(const char *name, const void *buffer,
+    uint64_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __EASEDS_BLOOM_H__ */
@@ -0,0 +1,341 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-bptree-unittest.c
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-18 11:25
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  Easeds B+ 树单元测试实现文件, 包含了插入/删除/查找/范围扫描/批量构建测试.
+ *
+ * @History:
+ *  2026年10月18日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#include "easeds-unittest.h"
+
+// 项目内部头文件
+#include "easeds-bptree.h"
+#include "easeds-utils.h"
+
+// 把整数键转换为指针值, 便于校验
+#define BPTREE_TEST_VALUE(key) ((void *)(uintptr_t)((key) * 3 + 1))
+
+// 基本功能测试: 创建, 插入, 查找, 删除, 销毁
+static void test_easeds_bptree_basic(void **state)
+{
+    easeds_unused(state);
+
+    struct easeds_bptree *tree = easeds_bptree_create("basic");
+    assert_non_null(tree);
+    assert_int_equal(easeds_bptree_size(tree), 0);
+    assert_int_equal(easeds_bptree_height(tree), 0);
+    assert_int_equal(easeds_bptree_verify(tree), 0);
+
+    for (uint64_t key = 0; key < 1000; key++) {
+        assert_int_equal(easeds_bptree_insert(tree, key, BPTREE_TEST_VALUE(key)), EASEDS_OK);
+    }
+    assert_int_equal(easeds_bptree_size(tree), 1000);
+    assert_int_equal(easeds_bptree_verify(tree), 0);
+    assert_true(easeds_bptree_height(tree) >= 2);
+
+    for (uint64_t key = 0; key < 1000; key++) {
+        void *value = NULL;
+        assert_int_equal(easeds_bptree_find(tree, key, &value), EASEDS_OK);
+        assert_ptr_equal(value, BPTREE_TEST_VALUE(key));
+    }
+    assert_int_equal(easeds_bptree_find(tree, 1000, NULL), EASEDS_ERROR);
+
+    // 覆盖已有键
+    assert_int_equal(easeds_bptree_insert(tree, 10, NULL), EASEDS_OK);
+    assert_int_equal(easeds_bptree_size(tree), 1000);
+
+    void *value = BPTREE_TEST_VALUE(0);
+    assert_int_equal(easeds_bptree_find(tree, 10, &value), EASEDS_OK);
+    assert_null(value);
+
+    for (uint64_t key = 0; key < 1000; key++) {
+        assert_int_equal(easeds_bptree_remove(tree, key, NULL), EASEDS_OK);
+    }
+    assert_int_equal(easeds_bptree_size(tree), 0);
+    assert_int_equal(easeds_bptree_height(tree), 0);
+    assert_int_equal(easeds_bptree_verify(tree), 0);
+    assert_int_equal(tree->node_count, 0);
+
+    easeds_bptree_destroy(tree);
+}
+
+struct bptree_range_ctx {
+    uint64_t expect; /* 期望的下一个键 */
+    uint64_t step;   /* 键步长 */
+    bool     ok;     /* 校验结果 */
+    uint8_t  pad[7]; /* 填充 */
+};
+
+static void bptree_range_cb(uint64_t key, void *value, void *user_data)
+{
+    struct bptree_range_ctx *ctx = user_data;
+
+    if (key != ctx->expect || value != BPTREE_TEST_VALUE(key)) {
+        ctx->ok = false;
+    }
+    ctx->expect += ctx->step;
+}
+
+// 基本功能测试: 随机插入删除, 迭代器, 范围扫描
+static void test_easeds_bptree_operations(void **state)
+{
+    easeds_unused(state);
+
+    const uint64_t        count = 20000;
+    struct easeds_bptree *tree  = easeds_bptree_create("operations");
+    assert_non_null(tree);
+
+    // 乱序插入偶数键 0, 2, 4, ...
+    for (uint64_t i = 0; i < count; i++) {
+        uint64_t key = ((i * 7919) % count) * 2;
+        assert_int_equal(easeds_bptree_insert(tree, key, BPTREE_TEST_VALUE(key)), EASEDS_OK);
+    }
+    assert_int_equal(easeds_bptree_verify(tree), 0);
+
+    // 迭代器顺序遍历
+    struct easeds_bptree_iter iter;
+    uint64_t                  key;
+    void                     *value;
+    uint64_t                  expect = 0;
+    easeds_bptree_iter_first(tree, &iter);
+    while (easeds_bptree_iter_next(&iter, &key, &value)) {
+        assert_int_equal(key, expect);
+        assert_ptr_equal(value, BPTREE_TEST_VALUE(key));
+        expect += 2;
+    }
+    assert_int_equal(expect, count * 2);
+
+    // 下界定位: 奇数键定位到下一个偶数键
+    easeds_bptree_iter_seek(tree, 1001, &iter);
+    assert_true(easeds_bptree_iter_next(&iter, &key, NULL));
+    assert_int_equal(key, 1002);
+    easeds_bptree_iter_seek(tree, count * 2, &iter);
+    assert_false(easeds_bptree_iter_next(&iter, &key, NULL));
+
+    // 范围扫描 [101, 2000], 命中 102..2000
+    struct bptree_range_ctx ctx = {.expect = 102, .step = 2, .ok = true};
+    assert_int_equal(easeds_bptree_range(tree, 101, 2000, bptree_range_cb, &ctx), 950);
+    assert_true(ctx.ok);
+
+    // 乱序删除一半键, 触发借位和合并
+    for (uint64_t i = 0; i < count; i += 2) {
+        uint64_t del = ((i * 7919) % count) * 2;
+        assert_int_equal(easeds_bptree_remove(tree, del, &value), EASEDS_OK);
+        assert_ptr_equal(value, BPTREE_TEST_VALUE(del));
+        assert_int_equal(easeds_bptree_remove(tree, del, NULL), EASEDS_ERROR);
+    }
+    assert_int_equal(easeds_bptree_size(tree), count / 2);
+    assert_int_equal(easeds_bptree_verify(tree), 0);
+
+    for (uint64_t i = 1; i < count; i += 2) {
+        uint64_t del = ((i * 7919) % count) * 2;
+        assert_int_equal(easeds_bptree_remove(tree, del, NULL), EASEDS_OK);
+        if (i % 1001 == 1) {
+            assert_int_equal(easeds_bptree_verify(tree), 0);
+        }
+    }
+    assert_int_equal(easeds_bptree_size(tree), 0);
+    assert_int_equal(easeds_bptree_verify(tree), 0);
+
+    easeds_bptree_destroy(tree);
+}
+
+// 基本功能测试: 从有序数组批量构建
+static void test_easeds_bptree_bulk_load(void **state)
+{
+    easeds_unused(state);
+
+    const uint32_t counts[] = {1, 15, 31, 32, 47, 62, 63, 993, 1024, 1025, 50000};
+
+    for (uint32_t c = 0; c < sizeof(counts) / sizeof(counts[0]); c++) {
+        struct easeds_array *pairs =
+            easeds_array_create("pairs", sizeof(struct easeds_bptree_pair), counts[c]);
+        assert_non_null(pairs);
+
+        for (uint32_t i = 0; i < counts[c]; i++) {
+            struct easeds_bptree_pair pair = {.key = (uint64_t)i * 5, .value = NULL};
+            pair.value                     = BPTREE_TEST_VALUE(pair.key);
+            assert_int_equal(easeds_array_push_back(pairs, &pair), EASEDS_OK);
+        }
+
+        struct easeds_bptree *tree = easeds_bptree_create("bulk");
+        assert_non_null(tree);
+        assert_int_equal(easeds_bptree_bulk_load(tree, pairs), EASEDS_OK);
+        assert_int_equal(easeds_bptree_size(tree), counts[c]);
+        assert_int_equal(easeds_bptree_verify(tree), 0);
+
+        // 批量构建后的树可以继续插入和删除
+        struct bptree_range_ctx ctx = {.expect = 0, .step = 5, .ok = true};
+        assert_int_equal(easeds_bptree_range(tree, 0, UINT64_MAX, bptree_range_cb, &ctx),
+            counts[c]);
+        assert_true(ctx.ok);
+
+        assert_int_equal(easeds_bptree_insert(tree, 3, NULL), EASEDS_OK);
+        assert_int_equal(easeds_bptree_remove(tree, 0, NULL), EASEDS_OK);
+        assert_int_equal(easeds_bptree_verify(tree), 0);
+
+        // 非空树不允许批量构建
+        assert_int_equal(easeds_bptree_bulk_load(tree, pairs), EASEDS_ERROR);
+
+        easeds_bptree_destroy(tree);
+        easeds_array_destroy(pairs);
+    }
+}
+
+// 边界测试: 最大最小键, 空树操作
+static void test_easeds_bptree_boundary(void **state)
+{
+    easeds_unused(state);
+
+    struct easeds_bptree *tree = easeds_bptree_create("boundary");
+    assert_non_null(tree);
+
+    struct easeds_bptree_iter iter;
+    easeds_bptree_iter_first(tree, &iter);
+    assert_false(easeds_bptree_iter_next(&iter, NULL, NULL));
+    easeds_bptree_iter_seek(tree, 0, &iter);
+    assert_false(easeds_bptree_iter_next(&iter, NULL, NULL));
+    assert_int_equal(easeds_bptree_remove(tree, 0, NULL), EASEDS_ERROR);
+
+    struct bptree_range_ctx ctx = {.expect = 0, .step = 1, .ok = true};
+    assert_int_equal(easeds_bptree_range(tree, 0, UINT64_MAX, bptree_range_cb, &ctx), 0);
+
+    // 最大最小键
+    assert_int_equal(easeds_bptree_insert(tree, UINT64_MAX, NULL), EASEDS_OK);
+    assert_int_equal(easeds_bptree_insert(tree, 0, NULL), EASEDS_OK);
+    for (uint64_t key = 1; key < 100; key++) {
+        assert_int_equal(easeds_bptree_insert(tree, UINT64_MAX - key, NULL), EASEDS_OK);
+    }
+    assert_int_equal(easeds_bptree_verify(tree), 0);
+    assert_int_equal(easeds_bptree_find(tree, UINT64_MAX, NULL), EASEDS_OK);
+    assert_int_equal(easeds_bptree_find(tree, 0, NULL), EASEDS_OK);
+
+    uint64_t key = 0;
+    easeds_bptree_iter_seek(tree, UINT64_MAX, &iter);
+    assert_true(easeds_bptree_iter_next(&iter, &key, NULL));
+    assert_true(key == UINT64_MAX);
+    assert_false(easeds_bptree_iter_next(&iter, &key, NULL));
+
+    // 区间上下界颠倒
+    assert_int_equal(easeds_bptree_range(tree, 10, 5, bptree_range_cb, &ctx), 0);
+
+    easeds_bptree_clear(tree);
+    assert_int_equal(easeds_bptree_size(tree), 0);
+    assert_int_equal(tree->node_count, 0);
+    assert_int_equal(easeds_bptree_verify(tree), 0);
+
+    easeds_bptree_destroy(tree);
+}
+
+// 失效测试: 空指针, 无序数组, 元素大小错误
+static void test_easeds_bptree_error(void **state)
+{
+    easeds_unused(state);
+
+    assert_int_equal(easeds_bptree_insert(NULL, 0, NULL), EASEDS_ERROR);
+    assert_int_equal(easeds_bptree_remove(NULL, 0, NULL), EASEDS_ERROR);
+    assert_int_equal(easeds_bptree_find(NULL, 0, NULL), EASEDS_ERROR);
+    assert_int_equal(easeds_bptree_bulk_load(NULL, NULL), EASEDS_ERROR);
+    assert_int_equal(easeds_bptree_size(NULL), 0);
+    assert_false(easeds_bptree_iter_next(NULL, NULL, NULL));
+
+    struct easeds_bptree *tree = easeds_bptree_create("error");
+    assert_non_null(tree);
+
+    struct easeds_array *wrong = easeds_array_create("wrong", sizeof(uint64_t), 4);
+    assert_non_null(wrong);
+    assert_int_equal(easeds_bptree_bulk_load(tree, wrong), EASEDS_ERROR);
+    easeds_array_destroy(wrong);
+
+    struct easeds_array *pairs =
+        easeds_array_create("unsorted", sizeof(struct easeds_bptree_pair), 4);
+    assert_non_null(pairs);
+    struct easeds_bptree_pair pair = {.key = 2, .value = NULL};
+    assert_int_equal(easeds_array_push_back(pairs, &pair), EASEDS_OK);
+    pair.key = 1;
+    assert_int_equal(easeds_array_push_back(pairs, &pair), EASEDS_OK);
+    assert_int_equal(easeds_bptree_bulk_load(tree, pairs), EASEDS_ERROR);
+    assert_int_equal(easeds_bptree_size(tree), 0);
+    assert_int_equal(tree->node_count, 0);
+    easeds_array_destroy(pairs);
+
+    easeds_bptree_destroy(tree);
+}
+
+// 性能测试: 随机插入/查找/范围扫描, 与批量构建对比
+static void test_easeds_bptree_perf(void **state)
+{
+    easeds_unused(state);
+
+    const uint64_t        count = 1000000;
+    struct easeds_bptree *tree  = easeds_bptree_create("perf");
+    assert_non_null(tree);
+
+    int64_t start = easeds_get_current_time_ns();
+    for (uint64_t i = 0; i < count; i++) {
+        uint64_t key = (i * 2654435761ULL) % count;
+        assert_int_equal(easeds_bptree_insert(tree, key, BPTREE_TEST_VALUE(key)), EASEDS_OK);
+    }
+    int64_t insert_ns = easeds_get_current_time_ns() - start;
+
+    start = easeds_get_current_time_ns();
+    for (uint64_t i = 0; i < count; i++) {
+        uint64_t key = (i * 40503ULL) % count;
+        assert_int_equal(easeds_bptree_find(tree, key, NULL), EASEDS_OK);
+    }
+    int64_t find_ns = easeds_get_current_time_ns() - start;
+
+    start                       = easeds_get_current_time_ns();
+    struct bptree_range_ctx ctx = {.expect = 0, .step = 1, .ok = true};
+    assert_int_equal(easeds_bptree_range(tree, 0, count, bptree_range_cb, &ctx), count);
+    int64_t scan_ns = easeds_get_current_time_ns() - start;
+    assert_true(ctx.ok);
+    assert_int_equal(easeds_bptree_verify(tree), 0);
+
+    // 批量构建
+    struct easeds_array *pairs =
+        easeds_array_create("perf", sizeof(struct easeds_bptree_pair), (uint32_t)count);
+    assert_non_null(pairs);
+    for (uint64_t i = 0; i < count; i++) {
+        struct easeds_bptree_pair pair = {.key = i, .value = BPTREE_TEST_VALUE(i)};
+        assert_int_equal(easeds_array_push_back(pairs, &pair), EASEDS_OK);
+    }
+
+    struct easeds_bptree *bulk = easeds_bptree_create("perf-bulk");
+    assert_non_null(bulk);
+    start = easeds_get_current_time_ns();
+    assert_int_equal(easeds_bptree_bulk_load(bulk, pairs), EASEDS_OK);
+    int64_t bulk_ns = easeds_get_current_time_ns() - start;
+    assert_int_equal(easeds_bptree_verify(bulk), 0);
+
+    MEASURE("[bptree perf]: %lu keys, height %u, nodes %lu, insert %.1f ns/op, find %.1f ns/op, "
+            "scan %.2f ns/op, bulk load %.2f ns/op.",
+        count, easeds_bptree_height(tree), tree->node_count, (double)insert_ns / (double)count,
+        (double)find_ns / (double)count, (double)scan_ns / (double)count,
+        (double)bulk_ns / (double)count);
+
+    easeds_bptree_destroy(bulk);
+    easeds_array_destroy(pairs);
+    easeds_bptree_destroy(tree);
+}
+
+// 注册单元测试用例
+EASEDS_UNITTEST_REGISTER(easeds_unittest_bptree){
+    cmocka_unit_test(test_easeds_bptree_basic),
+    cmocka_unit_test(test_easeds_bptree_operations),
+    cmocka_unit_test(test_easeds_bptree_bulk_load),
+    cmocka_unit_test(test_easeds_bptree_boundary),
+    cmocka_unit_test(test_easeds_bptree_error),
+    cmocka_unit_test(test_easeds_bptree_perf),
+    easeds_unit_test_end,
+};
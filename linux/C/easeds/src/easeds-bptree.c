@@ -0,0 +1,1020 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-bptree.c
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-18 10:36
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  缓存友好的内存 B+ 树有序映射实现.
+ *
+ * @History:
+ *  2026年10月18日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#include "easeds-bptree.h"
+
+// 标准库头文件
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+// 项目内部头文件
+#include "easeds-log.h"
+
+/**
+ * 节点布局, 叶子节点和内部节点大小相同, 都正好是 EASEDS_BPTREE_NODE_SIZE:
+ *  叶子节点: | count | leaf | next | keys[N] | values[N] |
+ *  内部节点: | count | leaf | keys[N] | children[N + 1] |
+ * 内部节点的 children[i] 子树中的键位于 [keys[i - 1], keys[i]) 区间.
+ */
+#define BPTREE_MAX_KEYS ((EASEDS_BPTREE_NODE_SIZE - 16) / 16)
+#define BPTREE_MIN_KEYS (BPTREE_MAX_KEYS / 2)
+
+/* 节点公共头部 */
+struct bptree_node {
+    uint32_t count; /* 键数量 */
+    uint32_t leaf;  /* 是否为叶子节点 */
+};
+
+/* 叶子节点 */
+struct bptree_leaf {
+    struct bptree_node  hdr;                     /* 公共头部 */
+    struct bptree_leaf *next;                    /* 右侧相邻叶子节点 */
+    uint64_t            keys[BPTREE_MAX_KEYS];   /* 键, 连续存放 */
+    void               *values[BPTREE_MAX_KEYS]; /* 值 */
+};
+
+/* 内部节点 */
+struct bptree_inner {
+    struct bptree_node  hdr;                           /* 公共头部 */
+    uint64_t            keys[BPTREE_MAX_KEYS];         /* 分隔键, 连续存放 */
+    struct bptree_node *children[BPTREE_MAX_KEYS + 1]; /* 子节点 */
+};
+
+_Static_assert(sizeof(struct bptree_leaf) == EASEDS_BPTREE_NODE_SIZE, "bptree leaf size");
+_Static_assert(sizeof(struct bptree_inner) == EASEDS_BPTREE_NODE_SIZE, "bptree inner size");
+
+#define BPTREE_LEAF(node)  ((struct bptree_leaf *)(void *)(node))
+#define BPTREE_INNER(node) ((struct bptree_inner *)(void *)(node))
+
+/* 插入递归返回值 */
+#define BPTREE_INSERTED 0 /* 插入新键, 没有分裂 */
+#define BPTREE_REPLACED 1 /* 键已存在, 覆盖旧值 */
+#define BPTREE_SPLITTED 2 /* 插入新键, 节点分裂 */
+
+/**
+ * 节点内查找: 统计 keys[0, count) 中小于 key(或者 inclusive 时小于等于 key)的数量.
+ * 键连续存放, 使用无分支计数代替二分查找, 避免分支预测失败, 31 个键只需要 8 次 AVX2 比较.
+ */
+static inline uint32_t bptree_node_search(
+    const uint64_t *keys, uint32_t count, uint64_t key, bool inclusive)
+{
+    uint32_t pos = 0;
+    uint32_t i   = 0;
+
+    /* inclusive 统计 <= key, 等价于统计 < key + 1, key 为最大值时所有键都满足 */
+    if (inclusive) {
+        if (unlikely(key == UINT64_MAX)) {
+            return count;
+        }
+        key++;
+    }
+
+#ifdef __AVX2__
+    /* AVX2 只有有符号 64 位比较, 翻转最高位后转换为无符号比较 */
+    const __m256i sign = _mm256_set1_epi64x(INT64_MIN);
+    const __m256i vkey = _mm256_xor_si256(_mm256_set1_epi64x((int64_t)key), sign);
+    for (; i + 4 <= count; i += 4) {
+        __m256i vk = _mm256_xor_si256(_mm256_loadu_si256((const __m256i *)(keys + i)), sign);
+        __m256i lt = _mm256_cmpgt_epi64(vkey, vk);
+        pos += (uint32_t)__builtin_popcount((uint32_t)_mm256_movemask_pd(_mm256_castsi256_pd(lt)));
+    }
+#endif
+
+    for (; i < count; i++) {
+        pos += (uint32_t)(keys[i] < key);
+    }
+
+    return pos;
+}
+
+// 申请一个节点, 按缓存行对齐
+static struct bptree_node *bptree_node_alloc(struct easeds_bptree *tree, bool leaf)
+{
+    struct bptree_node *node =
+        __easeds_aligned_alloc(EASEDS_CACHE_LINE_SIZE, EASEDS_BPTREE_NODE_SIZE);
+    if (unlikely(node == NULL)) {
+        EASEDS_ERR("[easeds_bptree]: Failed to allocate memory for node.");
+        return NULL;
+    }
+
+    node->count = 0;
+    node->leaf  = leaf ? 1 : 0;
+    if (leaf) {
+        BPTREE_LEAF(node)->next = NULL;
+    }
+    tree->node_count++;
+
+    return node;
+}
+
+/**
+ * 插入前预先申请分裂所需的节点, 保证插入过程中不会因为内存不足而中途失败.
+ * 分裂只会沿着从叶子节点向上连续已满的节点传播, 全部已满时额外需要一个新的根节点.
+ */
+#define BPTREE_STASH_MAX 32
+
+struct bptree_stash {
+    struct bptree_node *nodes[BPTREE_STASH_MAX]; /* 预申请的节点 */
+    uint32_t            count;                   /* 预申请节点数量 */
+    uint32_t            pad;                     /* 填充 */
+};
+
+// 从预申请节点中取出一个节点并初始化
+static struct bptree_node *bptree_stash_pop(
+    struct easeds_bptree *tree, struct bptree_stash *stash, bool leaf)
+{
+    easeds_assert(stash->count > 0);
+
+    struct bptree_node *node = stash->nodes[--stash->count];
+
+    node->count = 0;
+    node->leaf  = leaf ? 1 : 0;
+    if (leaf) {
+        BPTREE_LEAF(node)->next = NULL;
+    }
+    tree->node_count++;
+
+    return node;
+}
+
+// 统计插入 key 最多需要多少个新节点, 并预先申请, 成功返回0, 失败返回-1
+static int32_t bptree_stash_fill(
+    struct easeds_bptree *tree, uint64_t key, struct bptree_stash *stash)
+{
+    struct bptree_node *node   = tree->root;
+    uint32_t            needed = 0;
+
+    stash->count = 0;
+    stash->pad   = 0;
+
+    while (node != NULL) {
+        needed = node->count >= BPTREE_MAX_KEYS ? needed + 1 : 0;
+        if (node->leaf) {
+            break;
+        }
+        struct bptree_inner *inner = BPTREE_INNER(node);
+        node = inner->children[bptree_node_search(inner->keys, node->count, key, true)];
+    }
+
+    /* 从根节点到叶子节点全部已满, 根节点分裂需要额外的节点; 空树时为根叶子节点申请一个 */
+    if (needed == tree->height) {
+        needed++;
+    }
+    easeds_assert(needed <= BPTREE_STASH_MAX);
+
+    while (stash->count < needed) {
+        struct bptree_node *spare =
+            __easeds_aligned_alloc(EASEDS_CACHE_LINE_SIZE, EASEDS_BPTREE_NODE_SIZE);
+        if (unlikely(spare == NULL)) {
+            EASEDS_ERR("[easeds_bptree]: Failed to allocate memory for spare node.");
+            return -1;
+        }
+        stash->nodes[stash->count++] = spare;
+    }
+
+    return 0;
+}
+
+// 释放未使用的预申请节点
+static void bptree_stash_release(struct bptree_stash *stash)
+{
+    while (stash->count > 0) {
+        __easeds_free(stash->nodes[--stash->count]);
+    }
+}
+
+// 释放一个节点
+static void bptree_node_free(struct easeds_bptree *tree, struct bptree_node *node)
+{
+    __easeds_free(node);
+    tree->node_count--;
+}
+
+// 递归释放子树
+static void bptree_node_free_recursive(struct easeds_bptree *tree, struct bptree_node *node)
+{
+    if (!node->leaf) {
+        struct bptree_inner *inner = BPTREE_INNER(node);
+        for (uint32_t i = 0; i <= node->count; i++) {
+            bptree_node_free_recursive(tree, inner->children[i]);
+        }
+    }
+    bptree_node_free(tree, node);
+}
+
+/**
+ * @description: 创建一棵空的 B+ 树, 节点在第一次插入时才申请.
+ * @param name 名称, 预留字段, 可用于调试和日志输出
+ * @return 成功返回树指针, 失败返回NULL
+ */
+struct easeds_bptree *easeds_bptree_create(const char *name)
+{
+    struct easeds_bptree *tree = __easeds_malloc(sizeof(struct easeds_bptree));
+    if (unlikely(tree == NULL)) {
+        EASEDS_ERR("[easeds_bptree_create]: Failed to allocate memory for tree struct.");
+        return NULL;
+    }
+
+    tree->name       = name;
+    tree->root       = NULL;
+    tree->first_leaf = NULL;
+    tree->size       = 0;
+    tree->node_count = 0;
+    tree->height     = 0;
+    tree->flags      = 0;
+
+    PFL_DEBUG("Created bptree: node_size=%d, max_keys=%d.", EASEDS_BPTREE_NODE_SIZE,
+        BPTREE_MAX_KEYS);
+    return tree;
+}
+
+// 清空 B+ 树, 释放所有节点, 树结构体本身保留
+void easeds_bptree_clear(struct easeds_bptree *tree)
+{
+    if (unlikely(tree == NULL)) {
+        return;
+    }
+
+    if (tree->root != NULL) {
+        bptree_node_free_recursive(tree, tree->root);
+    }
+
+    tree->root       = NULL;
+    tree->first_leaf = NULL;
+    tree->size       = 0;
+    tree->height     = 0;
+
+    PFL_DEBUG("Cleared bptree, node count is %lu.", tree->node_count);
+}
+
+// 销毁 B+ 树, 释放所有节点
+void easeds_bptree_destroy(struct easeds_bptree *tree)
+{
+    if (unlikely(tree == NULL)) {
+        return;
+    }
+
+    easeds_bptree_clear(tree);
+    __easeds_free(tree);
+
+    PFL_DEBUG("Destroyed bptree.");
+}
+
+// 获取键值对数量
+uint64_t easeds_bptree_size(struct easeds_bptree *tree)
+{
+    if (unlikely(tree == NULL)) {
+        EASEDS_ERR("[easeds_bptree_size]: Invalid tree pointer.");
+        return 0;
+    }
+
+    return tree->size;
+}
+
+// 获取树高
+uint32_t easeds_bptree_height(struct easeds_bptree *tree)
+{
+    if (unlikely(tree == NULL)) {
+        EASEDS_ERR("[easeds_bptree_height]: Invalid tree pointer.");
+        return 0;
+    }
+
+    return tree->height;
+}
+
+// 从根节点下降到 key 所在的叶子节点
+static struct bptree_leaf *bptree_find_leaf(struct easeds_bptree *tree, uint64_t key)
+{
+    struct bptree_node *node = tree->root;
+
+    while (node != NULL && !node->leaf) {
+        struct bptree_inner *inner = BPTREE_INNER(node);
+        node = inner->children[bptree_node_search(inner->keys, node->count, key, true)];
+    }
+
+    return BPTREE_LEAF(node);
+}
+
+// 查找键对应的值, value 非空时返回找到的值, 成功返回0, 键不存在返回-1
+int32_t easeds_bptree_find(struct easeds_bptree *tree, uint64_t key, void **value)
+{
+    if (unlikely(tree == NULL)) {
+        EASEDS_ERR("[easeds_bptree_find]: Invalid tree pointer.");
+        return -1;
+    }
+
+    struct bptree_leaf *leaf = bptree_find_leaf(tree, key);
+    if (leaf == NULL) {
+        return -1;
+    }
+
+    uint32_t pos = bptree_node_search(leaf->keys, leaf->hdr.count, key, false);
+    if (pos >= leaf->hdr.count || leaf->keys[pos] != key) {
+        return -1;
+    }
+
+    if (value != NULL) {
+        *value = leaf->values[pos];
+    }
+    return 0;
+}
+
+/**
+ * 叶子节点插入, 节点已满时分裂为两个节点, 右侧节点的第一个键作为分隔键上提.
+ * @return BPTREE_INSERTED/BPTREE_REPLACED/BPTREE_SPLITTED
+ */
+static int32_t bptree_leaf_insert(struct easeds_bptree *tree, struct bptree_stash *stash,
+    struct bptree_leaf *leaf, uint64_t key, void *value, uint64_t *split_key,
+    struct bptree_node **split_node)
+{
+    uint32_t count = leaf->hdr.count;
+    uint32_t pos   = bptree_node_search(leaf->keys, count, key, false);
+
+    if (pos < count && leaf->keys[pos] == key) {
+        leaf->values[pos] = value;
+        return BPTREE_REPLACED;
+    }
+
+    if (count < BPTREE_MAX_KEYS) {
+        memmove(&leaf->keys[pos + 1], &leaf->keys[pos], (count - pos) * sizeof(uint64_t));
+        memmove(&leaf->values[pos + 1], &leaf->values[pos], (count - pos) * sizeof(void *));
+        leaf->keys[pos]   = key;
+        leaf->values[pos] = value;
+        leaf->hdr.count++;
+        return BPTREE_INSERTED;
+    }
+
+    /* 节点已满, 分裂: 左侧保留 (N + 1) / 2 个键, 右侧保存剩余的键 */
+    struct bptree_leaf *right      = BPTREE_LEAF(bptree_stash_pop(tree, stash, true));
+    const uint32_t      left_count = (BPTREE_MAX_KEYS + 1) / 2;
+    if (pos < left_count) {
+        /* 新键落在左侧, 先搬移 [left_count - 1, N) 到右侧, 再在左侧插入 */
+        uint32_t moved = count - (left_count - 1);
+        memcpy(right->keys, &leaf->keys[left_count - 1], moved * sizeof(uint64_t));
+        memcpy(right->values, &leaf->values[left_count - 1], moved * sizeof(void *));
+        right->hdr.count = moved;
+        leaf->hdr.count  = left_count - 1;
+        memmove(&leaf->keys[pos + 1], &leaf->keys[pos], (left_count - 1 - pos) * sizeof(uint64_t));
+        memmove(&leaf->values[pos + 1], &leaf->values[pos],
+            (left_count - 1 - pos) * sizeof(void *));
+        leaf->keys[pos]   = key;
+        leaf->values[pos] = value;
+        leaf->hdr.count++;
+    } else {
+        /* 新键落在右侧, 搬移 [left_count, N) 到右侧, 同时插入新键 */
+        uint32_t before = pos - left_count;
+        uint32_t after  = count - pos;
+        memcpy(right->keys, &leaf->keys[left_count], before * sizeof(uint64_t));
+        memcpy(right->values, &leaf->values[left_count], before * sizeof(void *));
+        right->keys[before]   = key;
+        right->values[before] = value;
+        memcpy(&right->keys[before + 1], &leaf->keys[pos], after * sizeof(uint64_t));
+        memcpy(&right->values[before + 1], &leaf->values[pos], after * sizeof(void *));
+        right->hdr.count = before + 1 + after;
+        leaf->hdr.count  = left_count;
+    }
+
+    right->next = leaf->next;
+    leaf->next  = right;
+
+    *split_key  = right->keys[0];
+    *split_node = &right->hdr;
+    return BPTREE_SPLITTED;
+}
+
+/**
+ * 内部节点在 idx 位置插入子节点分裂产生的分隔键和右侧子节点, 节点已满时继续分裂.
+ * @return BPTREE_INSERTED/BPTREE_SPLITTED
+ */
+static int32_t bptree_inner_insert(struct easeds_bptree *tree, struct bptree_stash *stash,
+    struct bptree_inner *inner, uint32_t idx, uint64_t *split_key,
+    struct bptree_node **split_node)
+{
+    uint32_t count = inner->hdr.count;
+
+    if (count < BPTREE_MAX_KEYS) {
+        memmove(&inner->keys[idx + 1], &inner->keys[idx], (count - idx) * sizeof(uint64_t));
+        memmove(&inner->children[idx + 2], &inner->children[idx + 1],
+            (count - idx) * sizeof(struct bptree_node *));
+        inner->keys[idx]         = *split_key;
+        inner->children[idx + 1] = *split_node;
+        inner->hdr.count++;
+        return BPTREE_INSERTED;
+    }
+
+    /* 节点已满, 先在临时缓冲区中完成插入, 再拆分为左右两个节点, 中间键上提 */
+    uint64_t            keys[BPTREE_MAX_KEYS + 1];
+    struct bptree_node *children[BPTREE_MAX_KEYS + 2];
+
+    memcpy(keys, inner->keys, idx * sizeof(uint64_t));
+    keys[idx] = *split_key;
+    memcpy(&keys[idx + 1], &inner->keys[idx], (count - idx) * sizeof(uint64_t));
+    memcpy(children, inner->children, (idx + 1) * sizeof(struct bptree_node *));
+    children[idx + 1] = *split_node;
+    memcpy(&children[idx + 2], &inner->children[idx + 1],
+        (count - idx) * sizeof(struct bptree_node *));
+
+    struct bptree_inner *right = BPTREE_INNER(bptree_stash_pop(tree, stash, false));
+
+    /* 共 N + 1 个键, 左侧保留 mid 个, keys[mid] 上提, 右侧保存 N - mid 个 */
+    const uint32_t mid         = (BPTREE_MAX_KEYS + 1) / 2;
+    const uint32_t right_count = BPTREE_MAX_KEYS - mid;
+
+    memcpy(inner->keys, keys, mid * sizeof(uint64_t));
+    memcpy(inner->children, children, (mid + 1) * sizeof(struct bptree_node *));
+    inner->hdr.count = mid;
+
+    memcpy(right->keys, &keys[mid + 1], right_count * sizeof(uint64_t));
+    memcpy(right->children, &children[mid + 1], (right_count + 1) * sizeof(struct bptree_node *));
+    right->hdr.count = right_count;
+
+    *split_key  = keys[mid];
+    *split_node = &right->hdr;
+    return BPTREE_SPLITTED;
+}
+
+// 递归插入, 子节点分裂时在当前节点插入分隔键
+static int32_t bptree_insert_recursive(struct easeds_bptree *tree, struct bptree_stash *stash,
+    struct bptree_node *node, uint64_t key, void *value, uint64_t *split_key,
+    struct bptree_node **split_node)
+{
+    if (node->leaf) {
+        return bptree_leaf_insert(
+            tree, stash, BPTREE_LEAF(node), key, value, split_key, split_node);
+    }
+
+    struct bptree_inner *inner = BPTREE_INNER(node);
+    uint32_t             idx   = bptree_node_search(inner->keys, node->count, key, true);
+
+    int32_t ret = bptree_insert_recursive(
+        tree, stash, inner->children[idx], key, value, split_key, split_node);
+    if (ret != BPTREE_SPLITTED) {
+        return ret;
+    }
+
+    return bptree_inner_insert(tree, stash, inner, idx, split_key, split_node);
+}
+
+// 插入键值对, 键已存在时覆盖旧值, 成功返回0, 失败返回-1
+int32_t easeds_bptree_insert(struct easeds_bptree *tree, uint64_t key, void *value)
+{
+    if (unlikely(tree == NULL)) {
+        EASEDS_ERR("[easeds_bptree_insert]: Invalid tree pointer.");
+        return -1;
+    }
+
+    struct bptree_stash stash;
+    if (unlikely(bptree_stash_fill(tree, key, &stash) != 0)) {
+        bptree_stash_release(&stash);
+        EASEDS_ERR("[easeds_bptree_insert]: Failed to insert key %lu.", key);
+        return -1;
+    }
+
+    /* 空树, 预申请节点全部就绪后再取出第一个叶子节点作为根节点, 失败时树保持为空 */
+    if (tree->root == NULL) {
+        struct bptree_node *leaf = bptree_stash_pop(tree, &stash, true);
+        tree->root               = leaf;
+        tree->first_leaf         = leaf;
+        tree->height             = 1;
+    }
+
+    uint64_t            split_key  = 0;
+    struct bptree_node *split_node = NULL;
+
+    int32_t ret =
+        bptree_insert_recursive(tree, &stash, tree->root, key, value, &split_key, &split_node);
+
+    /* 根节点分裂, 树长高一层 */
+    if (ret == BPTREE_SPLITTED) {
+        struct bptree_inner *root = BPTREE_INNER(bptree_stash_pop(tree, &stash, false));
+        root->keys[0]             = split_key;
+        root->children[0]         = tree->root;
+        root->children[1]         = split_node;
+        root->hdr.count           = 1;
+        tree->root                = root;
+        tree->height++;
+        PFL_DEBUG("Bptree root splitted, height is %u.", tree->height);
+    }
+
+    /* 键已存在时不会分裂, 预申请的节点需要释放 */
+    bptree_stash_release(&stash);
+    if (ret == BPTREE_REPLACED) {
+        return 0;
+    }
+
+    tree->size++;
+    return 0;
+}
+
+// 叶子子节点下溢修复: 优先向左右兄弟借一个键, 否则与兄弟合并
+static void bptree_fix_leaf(struct easeds_bptree *tree, struct bptree_inner *parent, uint32_t idx)
+{
+    struct bptree_leaf *child = BPTREE_LEAF(parent->children[idx]);
+    struct bptree_leaf *left  = idx > 0 ? BPTREE_LEAF(parent->children[idx - 1]) : NULL;
+    struct bptree_leaf *right =
+        idx < parent->hdr.count ? BPTREE_LEAF(parent->children[idx + 1]) : NULL;
+
+    if (left != NULL && left->hdr.count > BPTREE_MIN_KEYS) {
+        /* 从左兄弟借最后一个键 */
+        memmove(&child->keys[1], child->keys, child->hdr.count * sizeof(uint64_t));
+        memmove(&child->values[1], child->values, child->hdr.count * sizeof(void *));
+        left->hdr.count--;
+        child->keys[0]   = left->keys[left->hdr.count];
+        child->values[0] = left->values[left->hdr.count];
+        child->hdr.count++;
+        parent->keys[idx - 1] = child->keys[0];
+        return;
+    }
+
+    if (right != NULL && right->hdr.count > BPTREE_MIN_KEYS) {
+        /* 从右兄弟借第一个键 */
+        child->keys[child->hdr.count]   = right->keys[0];
+        child->values[child->hdr.count] = right->values[0];
+        child->hdr.count++;
+        right->hdr.count--;
+        memmove(right->keys, &right->keys[1], right->hdr.count * sizeof(uint64_t));
+        memmove(right->values, &right->values[1], right->hdr.count * sizeof(void *));
+        parent->keys[idx] = right->keys[0];
+        return;
+    }
+
+    /* 无法借位, 合并相邻的两个叶子节点, 统一处理为 (dst, src) 合并, src 位于 sep + 1 位置 */
+    uint32_t            sep = left != NULL ? idx - 1 : idx;
+    struct bptree_leaf *dst = BPTREE_LEAF(parent->children[sep]);
+    struct bptree_leaf *src = BPTREE_LEAF(parent->children[sep + 1]);
+
+    memcpy(&dst->keys[dst->hdr.count], src->keys, src->hdr.count * sizeof(uint64_t));
+    memcpy(&dst->values[dst->hdr.count], src->values, src->hdr.count * sizeof(void *));
+    dst->hdr.count += src->hdr.count;
+    dst->next = src->next;
+
+    memmove(&parent->keys[sep], &parent->keys[sep + 1],
+        (parent->hdr.count - sep - 1) * sizeof(uint64_t));
+    memmove(&parent->children[sep + 1], &parent->children[sep + 2],
+        (parent->hdr.count - sep - 1) * sizeof(struct bptree_node *));
+    parent->hdr.count--;
+
+    bptree_node_free(tree, &src->hdr);
+}
+
+// 内部子节点下溢修复: 通过父节点分隔键旋转借位, 否则与兄弟合并(分隔键下沉)
+static void bptree_fix_inner(struct easeds_bptree *tree, struct bptree_inner *parent, uint32_t idx)
+{
+    struct bptree_inner *child = BPTREE_INNER(parent->children[idx]);
+    struct bptree_inner *left  = idx > 0 ? BPTREE_INNER(parent->children[idx - 1]) : NULL;
+    struct bptree_inner *right =
+        idx < parent->hdr.count ? BPTREE_INNER(parent->children[idx + 1]) : NULL;
+
+    if (left != NULL && left->hdr.count > BPTREE_MIN_KEYS) {
+        /* 左兄弟的最后一个子节点移动到 child 最前面, 分隔键右旋 */
+        memmove(&child->keys[1], child->keys, child->hdr.count * sizeof(uint64_t));
+        memmove(&child->children[1], child->children,
+            (child->hdr.count + 1) * sizeof(struct bptree_node *));
+        child->keys[0]     = parent->keys[idx - 1];
+        child->children[0] = left->children[left->hdr.count];
+        child->hdr.count++;
+        parent->keys[idx - 1] = left->keys[left->hdr.count - 1];
+        left->hdr.count--;
+        return;
+    }
+
+    if (right != NULL && right->hdr.count > BPTREE_MIN_KEYS) {
+        /* 右兄弟的第一个子节点移动到 child 最后面, 分隔键左旋 */
+        child->keys[child->hdr.count]         = parent->keys[idx];
+        child->children[child->hdr.count + 1] = right->children[0];
+        child->hdr.count++;
+        parent->keys[idx] = right->keys[0];
+        memmove(right->keys, &right->keys[1], (right->hdr.count - 1) * sizeof(uint64_t));
+        memmove(right->children, &right->children[1],
+            right->hdr.count * sizeof(struct bptree_node *));
+        right->hdr.count--;
+        return;
+    }
+
+    /* 合并: dst + 分隔键 + src */
+    uint32_t             sep = left != NULL ? idx - 1 : idx;
+    struct bptree_inner *dst = BPTREE_INNER(parent->children[sep]);
+    struct bptree_inner *src = BPTREE_INNER(parent->children[sep + 1]);
+
+    dst->keys[dst->hdr.count] = parent->keys[sep];
+    memcpy(&dst->keys[dst->hdr.count + 1], src->keys, src->hdr.count * sizeof(uint64_t));
+    memcpy(&dst->children[dst->hdr.count + 1], src->children,
+        (src->hdr.count + 1) * sizeof(struct bptree_node *));
+    dst->hdr.count += src->hdr.count + 1;
+
+    memmove(&parent->keys[sep], &parent->keys[sep + 1],
+        (parent->hdr.count - sep - 1) * sizeof(uint64_t));
+    memmove(&parent->children[sep + 1], &parent->children[sep + 2],
+        (parent->hdr.count - sep - 1) * sizeof(struct bptree_node *));
+    parent->hdr.count--;
+
+    bptree_node_free(tree, &src->hdr);
+}
+
+// 递归删除, 子节点键数量低于下限时进行修复
+static int32_t bptree_remove_recursive(
+    struct easeds_bptree *tree, struct bptree_node *node, uint64_t key, void **value)
+{
+    if (node->leaf) {
+        struct bptree_leaf *leaf = BPTREE_LEAF(node);
+        uint32_t            pos  = bptree_node_search(leaf->keys, node->count, key, false);
+        if (pos >= node->count || leaf->keys[pos] != key) {
+            return -1;
+        }
+        if (value != NULL) {
+            *value = leaf->values[pos];
+        }
+        node->count--;
+        memmove(&leaf->keys[pos], &leaf->keys[pos + 1], (node->count - pos) * sizeof(uint64_t));
+        memmove(
+            &leaf->values[pos], &leaf->values[pos + 1], (node->count - pos) * sizeof(void *));
+        return 0;
+    }
+
+    struct bptree_inner *inner = BPTREE_INNER(node);
+    uint32_t             idx   = bptree_node_search(inner->keys, node->count, key, true);
+    struct bptree_node  *child = inner->children[idx];
+
+    if (bptree_remove_recursive(tree, child, key, value) != 0) {
+        return -1;
+    }
+
+    if (child->count < BPTREE_MIN_KEYS) {
+        if (child->leaf) {
+            bptree_fix_leaf(tree, inner, idx);
+        } else {
+            bptree_fix_inner(tree, inner, idx);
+        }
+    }
+
+    return 0;
+}
+
+// 删除键值对, value 非空时返回被删除的值, 成功返回0, 键不存在返回-1
+int32_t easeds_bptree_remove(struct easeds_bptree *tree, uint64_t key, void **value)
+{
+    if (unlikely(tree == NULL)) {
+        EASEDS_ERR("[easeds_bptree_remove]: Invalid tree pointer.");
+        return -1;
+    }
+
+    struct bptree_node *root = tree->root;
+    if (root == NULL || bptree_remove_recursive(tree, root, key, value) != 0) {
+        return -1;
+    }
+    tree->size--;
+
+    /* 根节点允许低于下限, 内部根节点没有键时树高降低一层, 叶子根节点为空时释放 */
+    if (!root->leaf && root->count == 0) {
+        tree->root = BPTREE_INNER(root)->children[0];
+        tree->height--;
+        bptree_node_free(tree, root);
+        PFL_DEBUG("Bptree root collapsed, height is %u.", tree->height);
+    } else if (root->leaf && root->count == 0) {
+        tree->root       = NULL;
+        tree->first_leaf = NULL;
+        tree->height     = 0;
+        bptree_node_free(tree, root);
+    }
+
+    return 0;
+}
+
+/**
+ * 将 total 个元素均匀分配到 nodes 个节点中, 返回第 index 个节点分配的数量.
+ * 均匀分配保证除了只有一个节点的情况, 每个节点都不低于半满.
+ */
+static uint32_t bptree_bulk_share(uint64_t total, uint64_t nodes, uint64_t index)
+{
+    return (uint32_t)(total / nodes + (index < total % nodes ? 1 : 0));
+}
+
+// 从有序数组批量构建, 元素类型为 struct easeds_bptree_pair, 要求树为空且键严格递增
+int32_t easeds_bptree_bulk_load(struct easeds_bptree *tree, struct easeds_array *pairs)
+{
+    if (unlikely(tree == NULL || pairs == NULL)) {
+        EASEDS_ERR("[easeds_bptree_bulk_load]: Invalid tree or array pointer.");
+        return -1;
+    }
+
+    if (pairs->element_size != sizeof(struct easeds_bptree_pair)) {
+        EASEDS_ERR("[easeds_bptree_bulk_load]: Invalid element size %u, expect %zu.",
+            pairs->element_size, sizeof(struct easeds_bptree_pair));
+        return -1;
+    }
+
+    if (tree->root != NULL) {
+        EASEDS_ERR("[easeds_bptree_bulk_load]: Tree is not empty, size is %lu.", tree->size);
+        return -1;
+    }
+
+    const struct easeds_bptree_pair *items = pairs->elements;
+    const uint64_t                   total = pairs->size;
+    if (total == 0) {
+        return 0;
+    }
+
+    /* 先校验有序性, 失败时不修改树 */
+    for (uint64_t i = 1; i < total; i++) {
+        if (items[i - 1].key >= items[i].key) {
+            EASEDS_ERR("[easeds_bptree_bulk_load]: Keys are not strictly increasing at %lu.", i);
+            return -1;
+        }
+    }
+
+    /* 每层节点指针和对应子树最小键, 逐层向上构建 */
+    uint64_t             level_count = (total + BPTREE_MAX_KEYS - 1) / BPTREE_MAX_KEYS;
+    struct bptree_node **level       = __easeds_malloc(level_count * sizeof(*level));
+    uint64_t            *min_keys    = __easeds_malloc(level_count * sizeof(*min_keys));
+    struct bptree_leaf  *prev        = NULL;
+    uint64_t             offset      = 0;
+    if (unlikely(level == NULL || min_keys == NULL)) {
+        EASEDS_ERR("[easeds_bptree_bulk_load]: Failed to allocate memory for level buffer.");
+        level_count = 0;
+        goto error;
+    }
+
+    /* 构建叶子层 */
+    for (uint64_t i = 0; i < level_count; i++) {
+        struct bptree_leaf *leaf = BPTREE_LEAF(bptree_node_alloc(tree, true));
+        if (unlikely(leaf == NULL)) {
+            level_count = i;
+            goto error;
+        }
+        uint32_t share = bptree_bulk_share(total, level_count, i);
+        for (uint32_t j = 0; j < share; j++) {
+            leaf->keys[j]   = items[offset + j].key;
+            leaf->values[j] = items[offset + j].value;
+        }
+        leaf->hdr.count = share;
+        offset += share;
+
+        if (prev != NULL) {
+            prev->next = leaf;
+        }
+        prev        = leaf;
+        level[i]    = &leaf->hdr;
+        min_keys[i] = leaf->keys[0];
+    }
+    tree->first_leaf = level[0];
+    tree->height     = 1;
+
+    /* 逐层构建内部节点, 直到只剩一个节点作为根节点, 原地覆盖 level 数组 */
+    while (level_count > 1) {
+        uint64_t parent_count = (level_count + BPTREE_MAX_KEYS) / (BPTREE_MAX_KEYS + 1);
+        uint64_t child        = 0;
+        for (uint64_t i = 0; i < parent_count; i++) {
+            struct bptree_inner *inner = BPTREE_INNER(bptree_node_alloc(tree, false));
+            if (unlikely(inner == NULL)) {
+                /* 已经挂接到父节点的子节点通过父节点递归释放, 剩余子节点单独释放 */
+                for (uint64_t j = child; j < level_count; j++) {
+                    bptree_node_free_recursive(tree, level[j]);
+                }
+                level_count = i;
+                goto error;
+            }
+            uint32_t share = bptree_bulk_share(level_count, parent_count, i);
+            uint64_t first = min_keys[child];
+            for (uint32_t j = 0; j < share; j++) {
+                inner->children[j] = level[child + j];
+                if (j > 0) {
+                    inner->keys[j - 1] = min_keys[child + j];
+                }
+            }
+            inner->hdr.count = share - 1;
+            child += share;
+
+            level[i]    = &inner->hdr;
+            min_keys[i] = first;
+        }
+        level_count = parent_count;
+        tree->height++;
+    }
+
+    tree->root = level[0];
+    tree->size = total;
+
+    __easeds_free(level);
+    __easeds_free(min_keys);
+
+    PFL_DEBUG("Bulk loaded bptree: size=%lu, height=%u, nodes=%lu.", tree->size, tree->height,
+        tree->node_count);
+    return 0;
+
+error:
+    if (level != NULL) {
+        for (uint64_t i = 0; i < level_count; i++) {
+            bptree_node_free_recursive(tree, level[i]);
+        }
+    }
+    __easeds_free(level);
+    __easeds_free(min_keys);
+    tree->first_leaf = NULL;
+    tree->height     = 0;
+    return -1;
+}
+
+// 迭代器定位到最小键
+void easeds_bptree_iter_first(struct easeds_bptree *tree, struct easeds_bptree_iter *iter)
+{
+    if (unlikely(tree == NULL || iter == NULL)) {
+        EASEDS_ERR("[easeds_bptree_iter_first]: Invalid tree or iter pointer.");
+        return;
+    }
+
+    iter->leaf  = tree->first_leaf;
+    iter->index = 0;
+    iter->pad   = 0;
+}
+
+// 迭代器定位到第一个 >= key 的位置(lower bound)
+void easeds_bptree_iter_seek(
+    struct easeds_bptree *tree, uint64_t key, struct easeds_bptree_iter *iter)
+{
+    if (unlikely(tree == NULL || iter == NULL)) {
+        EASEDS_ERR("[easeds_bptree_iter_seek]: Invalid tree or iter pointer.");
+        return;
+    }
+
+    struct bptree_leaf *leaf = bptree_find_leaf(tree, key);
+
+    iter->leaf  = leaf;
+    iter->index = leaf != NULL ? bptree_node_search(leaf->keys, leaf->hdr.count, key, false) : 0;
+    iter->pad   = 0;
+}
+
+// 获取迭代器当前键值对并前进一步, 遍历结束返回false
+bool easeds_bptree_iter_next(struct easeds_bptree_iter *iter, uint64_t *key, void **value)
+{
+    if (unlikely(iter == NULL)) {
+        EASEDS_ERR("[easeds_bptree_iter_next]: Invalid iter pointer.");
+        return false;
+    }
+
+    struct bptree_leaf *leaf = iter->leaf;
+
+    /* 当前叶子节点已经遍历完, 沿叶子链表前进 */
+    while (leaf != NULL && iter->index >= leaf->hdr.count) {
+        leaf        = leaf->next;
+        iter->index = 0;
+    }
+
+    iter->leaf = leaf;
+    if (leaf == NULL) {
+        return false;
+    }
+
+    if (key != NULL) {
+        *key = leaf->keys[iter->index];
+    }
+    if (value != NULL) {
+        *value = leaf->values[iter->index];
+    }
+    iter->index++;
+
+    return true;
+}
+
+// 遍历 [low, high] 区间内的键值对, 对每个键值对执行回调函数, 返回遍历数量
+uint64_t easeds_bptree_range(struct easeds_bptree *tree, uint64_t low, uint64_t high,
+    void (*callback)(uint64_t key, void *value, void *user_data), void *user_data)
+{
+    if (unlikely(tree == NULL || callback == NULL)) {
+        EASEDS_ERR("[easeds_bptree_range]: Invalid tree pointer or callback function.");
+        return 0;
+    }
+
+    if (low > high) {
+        return 0;
+    }
+
+    struct bptree_leaf *leaf = bptree_find_leaf(tree, low);
+    if (leaf == NULL) {
+        return 0;
+    }
+
+    uint64_t count = 0;
+    uint32_t pos   = bptree_node_search(leaf->keys, leaf->hdr.count, low, false);
+    for (; leaf != NULL; leaf = leaf->next, pos = 0) {
+        for (; pos < leaf->hdr.count; pos++) {
+            if (leaf->keys[pos] > high) {
+                return count;
+            }
+            callback(leaf->keys[pos], leaf->values[pos], user_data);
+            count++;
+        }
+    }
+
+    return count;
+}
+
+/**
+ * 递归校验子树, 子树中的键必须位于 [low, high) 区间(has_high 为 false 时无上界).
+ * @return 子树中的键数量, 校验失败返回 UINT64_MAX
+ */
+static uint64_t bptree_verify_recursive(struct bptree_node *node, uint32_t depth, uint32_t height,
+    bool is_root, uint64_t low, uint64_t high, bool has_high, struct bptree_leaf **prev_leaf)
+{
+    if (node->count > BPTREE_MAX_KEYS || (!is_root && node->count < BPTREE_MIN_KEYS)) {
+        EASEDS_ERR("[bptree verify]: Node %p count %u out of range.", (void *)node, node->count);
+        return UINT64_MAX;
+    }
+
+    if (node->leaf) {
+        struct bptree_leaf *leaf = BPTREE_LEAF(node);
+        if (depth != height) {
+            EASEDS_ERR("[bptree verify]: Leaf depth %u, but height %u.", depth, height);
+            return UINT64_MAX;
+        }
+        for (uint32_t i = 0; i < node->count; i++) {
+            if (leaf->keys[i] < low || (has_high && leaf->keys[i] >= high) ||
+                (i > 0 && leaf->keys[i - 1] >= leaf->keys[i])) {
+                EASEDS_ERR("[bptree verify]: Leaf key %lu out of order.", leaf->keys[i]);
+                return UINT64_MAX;
+            }
+        }
+        /* 叶子链表顺序必须和中序遍历顺序一致 */
+        if (*prev_leaf != NULL && (*prev_leaf)->next != leaf) {
+            EASEDS_ERR("[bptree verify]: Leaf list is broken at %p.", (void *)leaf);
+            return UINT64_MAX;
+        }
+        *prev_leaf = leaf;
+        return node->count;
+    }
+
+    struct bptree_inner *inner = BPTREE_INNER(node);
+    uint64_t             total = 0;
+    for (uint32_t i = 0; i <= node->count; i++) {
+        uint64_t child_low  = i > 0 ? inner->keys[i - 1] : low;
+        uint64_t child_high = i < node->count ? inner->keys[i] : high;
+        bool     child_has  = i < node->count ? true : has_high;
+        if (i > 0 && i < node->count && inner->keys[i - 1] >= inner->keys[i]) {
+            EASEDS_ERR("[bptree verify]: Inner key %lu out of order.", inner->keys[i]);
+            return UINT64_MAX;
+        }
+        uint64_t sub = bptree_verify_recursive(inner->children[i], depth + 1, height, false,
+            child_low, child_high, child_has, prev_leaf);
+        if (sub == UINT64_MAX) {
+            return UINT64_MAX;
+        }
+        total += sub;
+    }
+
+    return total;
+}
+
+// 校验 B+ 树结构不变量(有序, 节点占用率, 叶子链表, 统计信息), 正确返回0, 异常返回-1
+int32_t easeds_bptree_verify(struct easeds_bptree *tree)
+{
+    if (unlikely(tree == NULL)) {
+        EASEDS_ERR("[easeds_bptree_verify]: Invalid tree pointer.");
+        return -1;
+    }
+
+    if (tree->root == NULL) {
+        return (tree->size == 0 && tree->height == 0 && tree->first_leaf == NULL) ? 0 : -1;
+    }
+
+    struct bptree_leaf *prev  = NULL;
+    uint64_t            total = bptree_verify_recursive(
+        tree->root, 1, tree->height, true, 0, 0, false, &prev);
+    if (total == UINT64_MAX) {
+        return -1;
+    }
+
+    if (total != tree->size || prev == NULL || prev->next != NULL) {
+        EASEDS_ERR("[easeds_bptree_verify]: Size %lu mismatch, expect %lu.", total, tree->size);
+        return -1;
+    }
+
+    /* 第一个叶子节点必须为链表头 */
+    struct bptree_node *node = tree->root;
+    while (!node->leaf) {
+        node = BPTREE_INNER(node)->children[0];
+    }
+    if (node != tree->first_leaf) {
+        EASEDS_ERR("[easeds_bptree_verify]: First leaf mismatch.");
+        return -1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,139 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-bptree.h
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-18 10:20
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  缓存友好的内存 B+ 树有序映射, 键为 64 位无符号整数, 值为任意指针.
+ *
+ * @History:
+ *  2026年10月18日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#ifndef __EASEDS_BPTREE_H__
+#define __EASEDS_BPTREE_H__
+
+/* C 标准库头文件 */
+#include <stdbool.h>
+#include <stdint.h>
+
+/* 项目内部头文件 */
+#include "easeds-array.h"
+#include "easeds-environment.h"
+#include "easeds-public.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * 实现一个面向大量整数键的内存 B+ 树, 相比每个节点一个键的二叉树, 每层只需访问一个大节点.
+ *  (1) 节点大小固定为 EASEDS_BPTREE_NODE_SIZE, 为缓存行的整数倍, 并且按缓存行对齐分配.
+ *  (2) 节点内部键值连续存放, 节点内查找使用无分支计数, 支持 AVX2 时一次比较 4 个键.
+ *  (3) 数据只存放在叶子节点, 叶子节点通过 next 指针串联, 范围扫描只需顺序访问叶子.
+ *  (4) 删除时通过借位和合并保持节点至少半满, 树高始终为 O(log n).
+ *  (5) 支持从已排序的 easeds_array 批量构建, 自底向上逐层生成节点, 复杂度 O(n).
+ *  (6) 非线程安全, 需要用户自行保证线程安全性.
+ */
+struct easeds_bptree {
+    const char *name;       /* 名称, 预留字段, 可用于调试和日志输出 */
+    void       *root;       /* 根节点, 空树时为 NULL */
+    void       *first_leaf; /* 最左侧叶子节点, 用于顺序遍历 */
+    uint64_t    size;       /* 键值对数量 */
+    uint64_t    node_count; /* 节点数量(叶子节点和内部节点) */
+    uint32_t    height;     /* 树高, 空树为 0, 只有一个叶子节点时为 1 */
+    uint32_t    flags;      /* 标志位, 预留字段 */
+};
+
+/* 键值对, 也是批量构建时 easeds_array 的元素类型 */
+struct easeds_bptree_pair {
+    uint64_t key;   /* 键 */
+    void    *value; /* 值 */
+};
+
+/* 顺序迭代器, 指向某个叶子节点中的某个位置 */
+struct easeds_bptree_iter {
+    void    *leaf;  /* 当前叶子节点, NULL 表示遍历结束 */
+    uint32_t index; /* 当前叶子节点中的下标 */
+    uint32_t pad;   /* 填充 */
+};
+
+/* 节点大小: 8 个缓存行, 节点内可以容纳 31 个键 */
+#define EASEDS_BPTREE_NODE_SIZE (8 * EASEDS_CACHE_LINE_SIZE)
+
+/**
+ * 常见 B+ 树操作函数:
+ *
+ * 函数名                       功能描述
+ * ------------------------     ------------------------------------------------------
+ * easeds_bptree_create         创建一棵空的 B+ 树, 失败返回NULL
+ * easeds_bptree_destroy        销毁 B+ 树, 释放所有节点
+ * easeds_bptree_clear          清空 B+ 树, 释放所有节点, 树结构体本身保留
+ * easeds_bptree_size           获取键值对数量
+ * easeds_bptree_height         获取树高
+ * easeds_bptree_insert         插入键值对, 键已存在时覆盖旧值, 成功返回0, 失败返回-1
+ * easeds_bptree_remove         删除键值对, 成功返回0, 键不存在返回-1
+ * easeds_bptree_find           查找键对应的值, 成功返回0, 键不存在返回-1
+ * easeds_bptree_bulk_load      从有序数组批量构建, 要求树为空且键严格递增
+ * easeds_bptree_iter_first     迭代器定位到最小键
+ * easeds_bptree_iter_seek      迭代器定位到第一个 >= key 的位置(lower bound)
+ * easeds_bptree_iter_next      获取迭代器当前键值对并前进一步, 遍历结束返回false
+ * easeds_bptree_range          遍历 [low, high] 区间内的键值对, 返回遍历数量
+ * easeds_bptree_verify         校验 B+ 树结构不变量, 正确返回0, 异常返回-1
+ */
+
+// 创建一棵空的 B+ 树, 失败返回NULL
+struct easeds_bptree *easeds_bptree_create(const char *name);
+
+// 销毁 B+ 树, 释放所有节点
+void easeds_bptree_destroy(struct easeds_bptree *tree);
+
+// 清空 B+ 树, 释放所有节点, 树结构体本身保留
+void easeds_bptree_clear(struct easeds_bptree *tree);
+
+// 获取键值对数量
+uint64_t easeds_bptree_size(struct easeds_bptree *tree);
+
+// 获取树高
+uint32_t easeds_bptree_height(struct easeds_bptree *tree);
+
+// 插入键值对, 键已存在时覆盖旧值, 成功返回0, 失败返回-1
+int32_t easeds_bptree_insert(struct easeds_bptree *tree, uint64_t key, void *value);
+
+// 删除键值对, value 非空时返回被删除的值, 成功返回0, 键不存在返回-1
+int32_t easeds_bptree_remove(struct easeds_bptree *tree, uint64_t key, void **value);
+
+// 查找键对应的值, value 非空时返回找到的值, 成功返回0, 键不存在返回-1
+int32_t easeds_bptree_find(struct easeds_bptree *tree, uint64_t key, void **value);
+
+// 从有序数组批量构建, 元素类型为 struct easeds_bptree_pair, 要求树为空且键严格递增
+int32_t easeds_bptree_bulk_load(struct easeds_bptree *tree, struct easeds_array *pairs);
+
+// 迭代器定位到最小键
+void easeds_bptree_iter_first(struct easeds_bptree *tree, struct easeds_bptree_iter *iter);
+
+// 迭代器定位到第一个 >= key 的位置(lower bound)
+void easeds_bptree_iter_seek(
+    struct easeds_bptree *tree, uint64_t key, struct easeds_bptree_iter *iter);
+
+// 获取迭代器当前键值对并前进一步, 遍历结束返回false
+bool easeds_bptree_iter_next(struct easeds_bptree_iter *iter, uint64_t *key, void **value);
+
+// 遍历 [low, high] 区间内的键值对, 对每个键值对执行回调函数, 返回遍历数量
+uint64_t easeds_bptree_range(struct easeds_bptree *tree, uint64_t low, uint64_t high,
+    void (*callback)(uint64_t key, void *value, void *user_data), void *user_data);
+
+// 校验 B+ 树结构不变量(有序, 节点占用率, 叶子链表, 统计信息), 正确返回0, 异常返回-1
+int32_t easeds_bptree_verify(struct easeds_bptree *tree);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __EASEDS_BPTREE_H__ */
@@ -0,0 +1,341 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-cache-unittest.c
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-18 15:30
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  Easeds 缓存容器单元测试实现文件, 包含了 LRU/CLOCK 淘汰顺序/容量计算/统计计数测试.
+ *
+ * @History:
+ *  2026年10月18日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#include "easeds-unittest.h"
+
+// 项目内部头文件
+#include "easeds-cache.h"
+#include "easeds-utils.h"
+
+// 把整数转换为指针值, 便于校验
+#define CACHE_TEST_VALUE(key) ((void *)(uintptr_t)((key) + 1))
+
+// 释放回调记录
+struct cache_release_ctx {
+    uint64_t count;    /* 释放次数 */
+    uint64_t last_key; /* 最近一次释放的键 */
+};
+
+static void cache_release_cb(const void *key, uint32_t key_len, void *value, void *user_data)
+{
+    struct cache_release_ctx *ctx = user_data;
+    uint64_t                  k   = 0;
+
+    assert_int_equal(key_len, sizeof(uint64_t));
+    memcpy(&k, key, sizeof(k));
+    assert_ptr_equal(value, CACHE_TEST_VALUE(k));
+    ctx->count++;
+    ctx->last_key = k;
+}
+
+static int32_t cache_put_u64(struct easeds_cache *cache, uint64_t key, uint64_t charge)
+{
+    return easeds_cache_put(cache, &key, sizeof(key), CACHE_TEST_VALUE(key), charge);
+}
+
+static int32_t cache_get_u64(struct easeds_cache *cache, uint64_t key)
+{
+    void   *value = NULL;
+    int32_t ret   = easeds_cache_get(cache, &key, sizeof(key), &value);
+    if (ret == 0 && value != CACHE_TEST_VALUE(key)) {
+        return -2;
+    }
+    return ret;
+}
+
+static bool cache_has_u64(struct easeds_cache *cache, uint64_t key)
+{
+    return easeds_cache_contains(cache, &key, sizeof(key));
+}
+
+// 基本功能测试: 插入, 查找, 覆盖, 删除, 扩容
+static void test_easeds_cache_basic(void **state)
+{
+    easeds_unused(state);
+
+    const enum easeds_cache_policy policies[] = {EASEDS_CACHE_LRU, EASEDS_CACHE_CLOCK};
+
+    for (uint32_t p = 0; p < 2; p++) {
+        struct cache_release_ctx ctx = {0};
+        struct easeds_cache     *cache =
+            easeds_cache_create("basic", policies[p], EASEDS_CACHE_BY_COUNT, 10000);
+        assert_non_null(cache);
+        easeds_cache_set_release_cb(cache, cache_release_cb, &ctx);
+
+        for (uint64_t key = 0; key < 10000; key++) {
+            assert_int_equal(cache_put_u64(cache, key, 0), EASEDS_OK);
+        }
+        assert_int_equal(easeds_cache_count(cache), 10000);
+        assert_int_equal(easeds_cache_usage(cache), 10000);
+        assert_true(cache->bucket_mask + 1 >= 8192);
+
+        for (uint64_t key = 0; key < 10000; key++) {
+            assert_int_equal(cache_get_u64(cache, key), EASEDS_OK);
+        }
+        assert_int_equal(cache_get_u64(cache, 10000), EASEDS_ERROR);
+
+        // 覆盖相同的值不调用释放回调
+        assert_int_equal(cache_put_u64(cache, 5, 0), EASEDS_OK);
+        assert_int_equal(ctx.count, 0);
+        assert_int_equal(easeds_cache_count(cache), 10000);
+
+        // 删除
+        assert_int_equal(easeds_cache_remove(cache, &(uint64_t){5}, sizeof(uint64_t)), EASEDS_OK);
+        assert_int_equal(ctx.count, 1);
+        assert_int_equal(ctx.last_key, 5);
+        assert_false(cache_has_u64(cache, 5));
+        assert_int_equal(easeds_cache_remove(cache, &(uint64_t){5}, sizeof(uint64_t)), -1);
+
+        struct easeds_cache_stats stats;
+        easeds_cache_get_stats(cache, &stats);
+        assert_int_equal(stats.hits, 10000);
+        assert_int_equal(stats.misses, 1);
+        assert_int_equal(stats.inserts, 10001);
+        assert_int_equal(stats.evictions, 0);
+
+        easeds_cache_reset_stats(cache);
+        easeds_cache_get_stats(cache, &stats);
+        assert_int_equal(stats.hits, 0);
+
+        easeds_cache_destroy(cache);
+        assert_int_equal(ctx.count, 10000);
+    }
+}
+
+// 基本功能测试: LRU 淘汰顺序, CLOCK 二次机会, 按字节容量
+static void test_easeds_cache_operations(void **state)
+{
+    easeds_unused(state);
+
+    struct cache_release_ctx ctx = {0};
+
+    // LRU: 访问 0 后插入 4, 淘汰最久未访问的 1
+    struct easeds_cache *lru =
+        easeds_cache_create("lru", EASEDS_CACHE_LRU, EASEDS_CACHE_BY_COUNT, 4);
+    assert_non_null(lru);
+    easeds_cache_set_release_cb(lru, cache_release_cb, &ctx);
+    for (uint64_t key = 0; key < 4; key++) {
+        assert_int_equal(cache_put_u64(lru, key, 0), EASEDS_OK);
+    }
+    assert_int_equal(cache_get_u64(lru, 0), EASEDS_OK);
+    assert_int_equal(cache_put_u64(lru, 4, 0), EASEDS_OK);
+    assert_int_equal(ctx.count, 1);
+    assert_int_equal(ctx.last_key, 1);
+    assert_true(cache_has_u64(lru, 0));
+    assert_false(cache_has_u64(lru, 1));
+
+    // 再插入 5, 淘汰 2
+    assert_int_equal(cache_put_u64(lru, 5, 0), EASEDS_OK);
+    assert_int_equal(ctx.last_key, 2);
+    assert_int_equal(lru->stats.evictions, 2);
+    easeds_cache_destroy(lru);
+
+    // CLOCK: 0 和 2 被访问过, 插入 4 时跳过 0, 淘汰 1; 插入 5 时跳过 2, 淘汰 3
+    memset(&ctx, 0, sizeof(ctx));
+    struct easeds_cache *clock =
+        easeds_cache_create("clock", EASEDS_CACHE_CLOCK, EASEDS_CACHE_BY_COUNT, 4);
+    assert_non_null(clock);
+    easeds_cache_set_release_cb(clock, cache_release_cb, &ctx);
+    for (uint64_t key = 0; key < 4; key++) {
+        assert_int_equal(cache_put_u64(clock, key, 0), EASEDS_OK);
+    }
+    assert_int_equal(cache_get_u64(clock, 0), EASEDS_OK);
+    assert_int_equal(cache_get_u64(clock, 2), EASEDS_OK);
+    assert_int_equal(cache_put_u64(clock, 4, 0), EASEDS_OK);
+    assert_int_equal(ctx.last_key, 1);
+    assert_int_equal(cache_put_u64(clock, 5, 0), EASEDS_OK);
+    assert_int_equal(ctx.last_key, 3);
+    assert_true(cache_has_u64(clock, 0));
+    assert_true(cache_has_u64(clock, 2));
+
+    // 访问位已经在上一轮清零, 再插入 6 时淘汰 0
+    assert_int_equal(cache_put_u64(clock, 6, 0), EASEDS_OK);
+    assert_int_equal(ctx.last_key, 0);
+    easeds_cache_destroy(clock);
+
+    // 按字节容量: 容量 100, 每个条目占用 30, 最多容纳 3 个
+    memset(&ctx, 0, sizeof(ctx));
+    struct easeds_cache *bytes =
+        easeds_cache_create("bytes", EASEDS_CACHE_LRU, EASEDS_CACHE_BY_BYTES, 100);
+    assert_non_null(bytes);
+    easeds_cache_set_release_cb(bytes, cache_release_cb, &ctx);
+    for (uint64_t key = 0; key < 3; key++) {
+        assert_int_equal(cache_put_u64(bytes, key, 30), EASEDS_OK);
+    }
+    assert_int_equal(easeds_cache_usage(bytes), 90);
+    assert_int_equal(cache_put_u64(bytes, 3, 30), EASEDS_OK);
+    assert_int_equal(easeds_cache_count(bytes), 3);
+    assert_int_equal(ctx.last_key, 0);
+
+    // 大条目一次淘汰多个旧条目
+    assert_int_equal(cache_put_u64(bytes, 4, 80), EASEDS_OK);
+    assert_int_equal(easeds_cache_count(bytes), 1);
+    assert_int_equal(easeds_cache_usage(bytes), 80);
+
+    // 覆盖时占用变大, 同样触发淘汰
+    assert_int_equal(cache_put_u64(bytes, 5, 20), EASEDS_OK);
+    assert_int_equal(cache_put_u64(bytes, 5, 30), EASEDS_OK);
+    assert_int_equal(easeds_cache_count(bytes), 1);
+    assert_int_equal(easeds_cache_usage(bytes), 30);
+    assert_false(cache_has_u64(bytes, 4));
+    easeds_cache_destroy(bytes);
+
+    // CLOCK 覆盖时占用变大, 所有条目都被访问过, 淘汰扫描不能选中被覆盖的条目
+    memset(&ctx, 0, sizeof(ctx));
+    struct easeds_cache *clock_bytes =
+        easeds_cache_create("clock-bytes", EASEDS_CACHE_CLOCK, EASEDS_CACHE_BY_BYTES, 100);
+    assert_non_null(clock_bytes);
+    easeds_cache_set_release_cb(clock_bytes, cache_release_cb, &ctx);
+    for (uint64_t key = 0; key < 4; key++) {
+        assert_int_equal(cache_put_u64(clock_bytes, key, 30), EASEDS_OK);
+    }
+    // 插入 3 时淘汰 0, 时钟指针停在 1 上, 再访问剩余的所有条目
+    assert_int_equal(ctx.last_key, 0);
+    for (uint64_t key = 1; key < 4; key++) {
+        assert_int_equal(cache_get_u64(clock_bytes, key), EASEDS_OK);
+    }
+    assert_int_equal(cache_put_u64(clock_bytes, 1, 50), EASEDS_OK);
+    assert_int_equal(cache_get_u64(clock_bytes, 1), EASEDS_OK);
+    assert_int_equal(easeds_cache_count(clock_bytes), 2);
+    assert_int_equal(easeds_cache_usage(clock_bytes), 80);
+    assert_int_equal(ctx.count, 2);
+    assert_int_equal(ctx.last_key, 2);
+
+    // 占用增大到容量上限, 其他条目全部淘汰
+    assert_int_equal(cache_put_u64(clock_bytes, 1, 100), EASEDS_OK);
+    assert_int_equal(cache_get_u64(clock_bytes, 1), EASEDS_OK);
+    assert_int_equal(easeds_cache_count(clock_bytes), 1);
+    assert_int_equal(easeds_cache_usage(clock_bytes), 100);
+    assert_int_equal(ctx.count, 3);
+    assert_int_equal(ctx.last_key, 3);
+    easeds_cache_destroy(clock_bytes);
+}
+
+// 边界测试: 容量为 1, 空键, 清空后继续使用
+static void test_easeds_cache_boundary(void **state)
+{
+    easeds_unused(state);
+
+    const enum easeds_cache_policy policies[] = {EASEDS_CACHE_LRU, EASEDS_CACHE_CLOCK};
+
+    for (uint32_t p = 0; p < 2; p++) {
+        struct easeds_cache *cache =
+            easeds_cache_create("boundary", policies[p], EASEDS_CACHE_BY_COUNT, 1);
+        assert_non_null(cache);
+
+        for (uint64_t key = 0; key < 100; key++) {
+            assert_int_equal(cache_put_u64(cache, key, 0), EASEDS_OK);
+            assert_int_equal(cache_get_u64(cache, key), EASEDS_OK);
+            assert_int_equal(easeds_cache_count(cache), 1);
+        }
+        assert_int_equal(cache->stats.evictions, 99);
+
+        // 空键
+        void *value = NULL;
+        assert_int_equal(easeds_cache_put(cache, NULL, 0, CACHE_TEST_VALUE(7), 0), EASEDS_OK);
+        assert_int_equal(easeds_cache_get(cache, NULL, 0, &value), EASEDS_OK);
+        assert_ptr_equal(value, CACHE_TEST_VALUE(7));
+
+        easeds_cache_clear(cache);
+        assert_int_equal(easeds_cache_count(cache), 0);
+        assert_int_equal(easeds_cache_usage(cache), 0);
+        assert_int_equal(easeds_cache_get(cache, NULL, 0, NULL), EASEDS_ERROR);
+        assert_int_equal(cache_put_u64(cache, 1, 0), EASEDS_OK);
+        assert_int_equal(cache_get_u64(cache, 1), EASEDS_OK);
+
+        easeds_cache_destroy(cache);
+    }
+}
+
+// 失效测试: 非法参数
+static void test_easeds_cache_error(void **state)
+{
+    easeds_unused(state);
+
+    assert_null(easeds_cache_create("error", EASEDS_CACHE_LRU, EASEDS_CACHE_BY_COUNT, 0));
+    assert_null(easeds_cache_create(
+        "error", (enum easeds_cache_policy)7, EASEDS_CACHE_BY_COUNT, 1));
+    assert_null(easeds_cache_create(
+        "error", EASEDS_CACHE_LRU, (enum easeds_cache_capacity)7, 1));
+    assert_null(easeds_cache_create(
+        "error", EASEDS_CACHE_LRU, EASEDS_CACHE_BY_COUNT, (uint64_t)UINT32_MAX + 1));
+
+    assert_int_equal(easeds_cache_put(NULL, NULL, 0, NULL, 0), EASEDS_ERROR);
+    assert_int_equal(easeds_cache_get(NULL, NULL, 0, NULL), EASEDS_ERROR);
+    assert_int_equal(easeds_cache_remove(NULL, NULL, 0), EASEDS_ERROR);
+    assert_false(easeds_cache_contains(NULL, NULL, 0));
+    assert_int_equal(easeds_cache_count(NULL), 0);
+
+    struct easeds_cache *cache =
+        easeds_cache_create("error", EASEDS_CACHE_CLOCK, EASEDS_CACHE_BY_BYTES, 100);
+    assert_non_null(cache);
+    assert_int_equal(easeds_cache_put(cache, NULL, 4, NULL, 1), EASEDS_ERROR);
+    assert_int_equal(cache_put_u64(cache, 1, 101), EASEDS_ERROR);
+    assert_int_equal(easeds_cache_count(cache), 0);
+    easeds_cache_destroy(cache);
+}
+
+// 性能测试: 倾斜访问分布下 LRU 和 CLOCK 的命中率和单次操作耗时
+static void test_easeds_cache_perf(void **state)
+{
+    easeds_unused(state);
+
+    const uint32_t                 keys       = 100000;
+    const uint32_t                 ops        = 2000000;
+    const enum easeds_cache_policy policies[] = {EASEDS_CACHE_LRU, EASEDS_CACHE_CLOCK};
+    const char                    *names[]    = {"LRU", "CLOCK"};
+
+    for (uint32_t p = 0; p < 2; p++) {
+        struct easeds_cache *cache =
+            easeds_cache_create("perf", policies[p], EASEDS_CACHE_BY_COUNT, keys / 10);
+        assert_non_null(cache);
+
+        // 80% 的访问落在 10% 的热点键上, 未命中时插入
+        uint64_t seed  = 88172645463325252ULL;
+        int64_t  start = easeds_get_current_time_ns();
+        for (uint32_t i = 0; i < ops; i++) {
+            seed ^= seed << 13;
+            seed ^= seed >> 7;
+            seed ^= seed << 17;
+            uint64_t key = (seed % 10 < 8) ? (seed >> 8) % (keys / 10) : (seed >> 8) % keys;
+            if (cache_get_u64(cache, key) != 0) {
+                cache_put_u64(cache, key, 0);
+            }
+        }
+        int64_t elapsed = easeds_get_current_time_ns() - start;
+
+        struct easeds_cache_stats stats;
+        easeds_cache_get_stats(cache, &stats);
+        MEASURE("[cache perf]: %s, %u keys, capacity %u, hit rate %.2f%%, evictions %lu, "
+                "%.1f ns/op.",
+            names[p], keys, keys / 10, (double)stats.hits * 100.0 / ops, stats.evictions,
+            (double)elapsed / ops);
+
+        easeds_cache_destroy(cache);
+    }
+}
+
+// 注册单元测试用例
+EASEDS_UNITTEST_REGISTER(easeds_unittest_cache){
+    cmocka_unit_test(test_easeds_cache_basic),
+    cmocka_unit_test(test_easeds_cache_operations),
+    cmocka_unit_test(test_easeds_cache_boundary),
+    cmocka_unit_test(test_easeds_cache_error),
+    cmocka_unit_test(test_easeds_cache_perf),
+    easeds_unit_test_end,
+};
@@ -0,0 +1,442 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-cache.c
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-18 15:00
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  有界缓存容器实现, 链式哈希表索引 + LRU 链表或 CLOCK 环形链表.
+ *
+ * @History:
+ *  2026年10月18日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#include "easeds-cache.h"
+
+// 标准库头文件
+#include <stdlib.h>
+#include <string.h>
+
+// 项目内部头文件
+#include "easeds-log.h"
+#include "easeds-utils.h"
+
+/* 哈希桶初始数量, 必须为 2 的幂 */
+#define CACHE_INITIAL_BUCKETS 64
+
+// 查找键, 返回指向条目的桶链表指针地址, 未找到时该地址中的值为 NULL
+static struct easeds_cache_entry **cache_lookup(
+    struct easeds_cache *cache, const void *key, uint32_t key_len, uint64_t hash)
+{
+    struct easeds_cache_entry **pos = &cache->buckets[hash & cache->bucket_mask];
+
+    while (*pos != NULL) {
+        struct easeds_cache_entry *entry = *pos;
+        if (entry->hash == hash && entry->key_len == key_len &&
+            (key_len == 0 || memcmp(entry->key, key, key_len) == 0)) {
+            break;
+        }
+        pos = &entry->hash_next;
+    }
+
+    return pos;
+}
+
+// 桶数组扩容为两倍, 失败时保持原桶数组, 只影响查找效率
+static void cache_grow(struct easeds_cache *cache)
+{
+    uint32_t                    new_count = (cache->bucket_mask + 1) * 2;
+    uint64_t                    bytes     = new_count * sizeof(*cache->buckets);
+    struct easeds_cache_entry **buckets   = __easeds_malloc(bytes);
+    if (unlikely(buckets == NULL)) {
+        PFL_DEBUG("Failed to grow cache buckets to %u.", new_count);
+        return;
+    }
+    memset(buckets, 0, bytes);
+
+    struct easeds_cache_entry *entry;
+    TAILQ_FOREACH(entry, &cache->list, entry)
+    {
+        struct easeds_cache_entry **slot = &buckets[entry->hash & (new_count - 1)];
+        entry->hash_next                 = *slot;
+        *slot                            = entry;
+    }
+
+    __easeds_free(cache->buckets);
+    cache->buckets     = buckets;
+    cache->bucket_mask = new_count - 1;
+
+    PFL_DEBUG("Grew cache buckets to %u.", new_count);
+}
+
+// 从哈希表和链表中摘除条目, 调用释放回调函数并释放条目
+static void cache_drop(
+    struct easeds_cache *cache, struct easeds_cache_entry **pos, struct easeds_cache_entry *entry)
+{
+    *pos = entry->hash_next;
+
+    if (cache->hand == entry) {
+        cache->hand = TAILQ_NEXT(entry, entry);
+    }
+    TAILQ_REMOVE(&cache->list, entry, entry);
+
+    cache->usage -= entry->charge;
+    cache->count--;
+
+    if (cache->release != NULL) {
+        cache->release(entry->key, entry->key_len, entry->value, cache->user_data);
+    }
+    __easeds_free(entry);
+}
+
+// 选择淘汰对象: LRU 取链表尾部, CLOCK 从时钟指针开始跳过访问位为 1 的条目, 都不会选中 skip
+static struct easeds_cache_entry *cache_victim(
+    struct easeds_cache *cache, const struct easeds_cache_entry *skip)
+{
+    if (cache->policy == EASEDS_CACHE_LRU) {
+        struct easeds_cache_entry *last = TAILQ_LAST(&cache->list, easeds_cache_list);
+        return last != skip ? last : TAILQ_PREV(last, easeds_cache_list, entry);
+    }
+
+    struct easeds_cache_entry *entry = cache->hand;
+    if (entry == NULL) {
+        entry = TAILQ_FIRST(&cache->list);
+    }
+    while (entry->referenced || entry == skip) {
+        entry->referenced = 0;
+        entry             = TAILQ_NEXT(entry, entry);
+        if (entry == NULL) {
+            entry = TAILQ_FIRST(&cache->list);
+        }
+    }
+
+    // 时钟指针停在淘汰对象上, 淘汰后由 cache_drop 推进到下一个条目
+    cache->hand = entry;
+    return entry;
+}
+
+// 淘汰一个条目, skip 非空时不淘汰该条目, 调用者需保证还有其他条目
+static void cache_evict(struct easeds_cache *cache, const struct easeds_cache_entry *skip)
+{
+    struct easeds_cache_entry  *victim = cache_victim(cache, skip);
+    struct easeds_cache_entry **pos =
+        cache_lookup(cache, victim->key, victim->key_len, victim->hash);
+
+    cache_drop(cache, pos, victim);
+    cache->stats.evictions++;
+}
+
+/**
+ * @description: 创建缓存, 返回缓存指针, 失败返回NULL.
+ * @param name 缓存名称, 预留字段, 可用于调试和日志输出
+ * @param policy 淘汰策略, EASEDS_CACHE_LRU 或 EASEDS_CACHE_CLOCK
+ * @param mode 容量计算方式, EASEDS_CACHE_BY_COUNT 或 EASEDS_CACHE_BY_BYTES
+ * @param capacity 容量上限, 按数量计算时为最大条目数, 按字节计算时为最大字节数
+ * @return 成功返回缓存指针, 失败返回NULL
+ */
+struct easeds_cache *easeds_cache_create(const char *name, enum easeds_cache_policy policy,
+    enum easeds_cache_capacity mode, uint64_t capacity)
+{
+    if (unlikely(policy != EASEDS_CACHE_LRU && policy != EASEDS_CACHE_CLOCK)) {
+        EASEDS_ERR("[easeds_cache_create]: Invalid policy %d.", (int32_t)policy);
+        return NULL;
+    }
+
+    if (unlikely(mode != EASEDS_CACHE_BY_COUNT && mode != EASEDS_CACHE_BY_BYTES)) {
+        EASEDS_ERR("[easeds_cache_create]: Invalid capacity mode %d.", (int32_t)mode);
+        return NULL;
+    }
+
+    if (unlikely(capacity == 0 || (mode == EASEDS_CACHE_BY_COUNT && capacity > UINT32_MAX))) {
+        EASEDS_ERR("[easeds_cache_create]: Invalid capacity %lu.", capacity);
+        return NULL;
+    }
+
+    struct easeds_cache *cache = __easeds_malloc(sizeof(struct easeds_cache));
+    if (unlikely(cache == NULL)) {
+        EASEDS_ERR("[easeds_cache_create]: Failed to allocate memory for cache struct.");
+        return NULL;
+    }
+
+    cache->buckets = __easeds_malloc(CACHE_INITIAL_BUCKETS * sizeof(*cache->buckets));
+    if (unlikely(cache->buckets == NULL)) {
+        EASEDS_ERR("[easeds_cache_create]: Failed to allocate memory for cache buckets.");
+        __easeds_free(cache);
+        return NULL;
+    }
+    memset(cache->buckets, 0, CACHE_INITIAL_BUCKETS * sizeof(*cache->buckets));
+
+    cache->name = name;
+    TAILQ_INIT(&cache->list);
+    cache->hand        = NULL;
+    cache->release     = NULL;
+    cache->user_data   = NULL;
+    cache->capacity    = capacity;
+    cache->usage       = 0;
+    cache->count       = 0;
+    cache->bucket_mask = CACHE_INITIAL_BUCKETS - 1;
+    cache->policy      = policy;
+    cache->mode        = mode;
+    memset(&cache->stats, 0, sizeof(cache->stats));
+
+    PFL_DEBUG("Created cache: policy=%d, mode=%d, capacity=%lu.", (int32_t)policy, (int32_t)mode,
+        capacity);
+    return cache;
+}
+
+// 销毁缓存, 对所有值调用释放回调函数
+void easeds_cache_destroy(struct easeds_cache *cache)
+{
+    if (unlikely(cache == NULL)) {
+        return;
+    }
+
+    easeds_cache_clear(cache);
+    __easeds_free(cache->buckets);
+    __easeds_free(cache);
+
+    PFL_DEBUG("Destroyed cache.");
+}
+
+// 清空缓存, 对所有值调用释放回调函数, 统计计数保留
+void easeds_cache_clear(struct easeds_cache *cache)
+{
+    if (unlikely(cache == NULL)) {
+        return;
+    }
+
+    struct easeds_cache_entry *entry;
+    while ((entry = TAILQ_FIRST(&cache->list)) != NULL) {
+        TAILQ_REMOVE(&cache->list, entry, entry);
+        if (cache->release != NULL) {
+            cache->release(entry->key, entry->key_len, entry->value, cache->user_data);
+        }
+        __easeds_free(entry);
+    }
+
+    memset(cache->buckets, 0, (cache->bucket_mask + 1) * sizeof(struct easeds_cache_entry *));
+    cache->hand  = NULL;
+    cache->usage = 0;
+    cache->count = 0;
+}
+
+// 设置释放回调函数, 值离开缓存时调用
+void easeds_cache_set_release_cb(struct easeds_cache *cache,
+    void (*release)(const void *key, uint32_t key_len, void *value, void *user_data),
+    void *user_data)
+{
+    if (unlikely(cache == NULL)) {
+        EASEDS_ERR("[easeds_cache_set_release_cb]: Invalid cache pointer.");
+        return;
+    }
+
+    cache->release   = release;
+    cache->user_data = user_data;
+}
+
+/**
+ * @description: 插入或覆盖键值对, 容量不足时按淘汰策略淘汰旧条目.
+ *  键已存在时替换值(旧值调用释放回调函数), 并视为一次访问. 新条目先申请内存再淘汰,
+ *  内存申请失败时缓存内容不变.
+ * @param cache 缓存指针
+ * @param key 键内容, 会被复制到条目中
+ * @param key_len 键长度
+ * @param value 值
+ * @param charge 按字节计算时的占用, 不能超过容量上限; 按数量计算时忽略, 固定为 1
+ * @return 成功返回0, 失败返回-1
+ */
+int32_t easeds_cache_put(struct easeds_cache *cache, const void *key, uint32_t key_len,
+    void *value, uint64_t charge)
+{
+    if (unlikely(cache == NULL || (key == NULL && key_len != 0))) {
+        EASEDS_ERR("[easeds_cache_put]: Invalid cache or key pointer.");
+        return -1;
+    }
+
+    if (cache->mode == EASEDS_CACHE_BY_COUNT) {
+        charge = 1;
+    } else if (unlikely(charge > cache->capacity)) {
+        EASEDS_ERR("[easeds_cache_put]: Charge %lu exceeds capacity %lu.", charge,
+            cache->capacity);
+        return -1;
+    }
+
+    uint64_t                    hash  = easeds_hash_bytes(key, key_len);
+    struct easeds_cache_entry **pos   = cache_lookup(cache, key, key_len, hash);
+    struct easeds_cache_entry  *entry = *pos;
+    cache->stats.inserts++;
+
+    if (entry != NULL) {
+        /* 占用增加时先淘汰其他条目, charge 不超过容量上限, 只剩该条目时一定放得下 */
+        while (cache->usage - entry->charge + charge > cache->capacity) {
+            cache_evict(cache, entry);
+        }
+
+        /* 覆盖旧值, 视为一次访问 */
+        if (cache->release != NULL && entry->value != value) {
+            cache->release(entry->key, entry->key_len, entry->value, cache->user_data);
+        }
+        entry->value  = value;
+        cache->usage  = cache->usage - entry->charge + charge;
+        entry->charge = charge;
+        if (cache->policy == EASEDS_CACHE_LRU) {
+            TAILQ_REMOVE(&cache->list, entry, entry);
+            TAILQ_INSERT_HEAD(&cache->list, entry, entry);
+        } else {
+            entry->referenced = 1;
+        }
+        return 0;
+    }
+
+    entry = __easeds_malloc(sizeof(struct easeds_cache_entry) + key_len);
+    if (unlikely(entry == NULL)) {
+        EASEDS_ERR("[easeds_cache_put]: Failed to allocate memory for cache entry.");
+        return -1;
+    }
+
+    entry->value      = value;
+    entry->hash       = hash;
+    entry->charge     = charge;
+    entry->key_len    = key_len;
+    entry->referenced = 0;
+    if (key_len > 0) {
+        memcpy(entry->key, key, key_len);
+    }
+
+    /* 先淘汰, 淘汰会修改桶链表, 之后重新定位插入位置 */
+    while (cache->count > 0 && cache->usage + charge > cache->capacity) {
+        cache_evict(cache, NULL);
+    }
+
+    struct easeds_cache_entry **slot = &cache->buckets[hash & cache->bucket_mask];
+    entry->hash_next                 = *slot;
+    *slot                            = entry;
+
+    if (cache->policy == EASEDS_CACHE_LRU) {
+        TAILQ_INSERT_HEAD(&cache->list, entry, entry);
+    } else if (cache->hand != NULL) {
+        /* 插入到时钟指针之前, 本轮扫描最后才会检查新条目 */
+        TAILQ_INSERT_BEFORE(cache->hand, entry, entry);
+    } else {
+        TAILQ_INSERT_TAIL(&cache->list, entry, entry);
+    }
+
+    cache->usage += charge;
+    cache->count++;
+    if (cache->count > cache->bucket_mask + 1) {
+        cache_grow(cache);
+    }
+
+    return 0;
+}
+
+// 查找键对应的值, value 非空时返回找到的值, 命中返回0, 未命中返回-1
+int32_t easeds_cache_get(
+    struct easeds_cache *cache, const void *key, uint32_t key_len, void **value)
+{
+    if (unlikely(cache == NULL || (key == NULL && key_len != 0))) {
+        EASEDS_ERR("[easeds_cache_get]: Invalid cache or key pointer.");
+        return -1;
+    }
+
+    struct easeds_cache_entry *entry =
+        *cache_lookup(cache, key, key_len, easeds_hash_bytes(key, key_len));
+    if (entry == NULL) {
+        cache->stats.misses++;
+        return -1;
+    }
+
+    cache->stats.hits++;
+    if (cache->policy == EASEDS_CACHE_LRU) {
+        if (TAILQ_FIRST(&cache->list) != entry) {
+            TAILQ_REMOVE(&cache->list, entry, entry);
+            TAILQ_INSERT_HEAD(&cache->list, entry, entry);
+        }
+    } else if (entry->referenced == 0) {
+        /* 已经置位时不再写入, 避免热点条目反复弄脏缓存行 */
+        entry->referenced = 1;
+    }
+
+    if (value != NULL) {
+        *value = entry->value;
+    }
+    return 0;
+}
+
+// 判断键是否存在, 不更新访问状态和统计计数
+bool easeds_cache_contains(struct easeds_cache *cache, const void *key, uint32_t key_len)
+{
+    if (unlikely(cache == NULL || (key == NULL && key_len != 0))) {
+        EASEDS_ERR("[easeds_cache_contains]: Invalid cache or key pointer.");
+        return false;
+    }
+
+    return *cache_lookup(cache, key, key_len, easeds_hash_bytes(key, key_len)) != NULL;
+}
+
+// 删除键值对, 对值调用释放回调函数, 成功返回0, 键不存在返回-1
+int32_t easeds_cache_remove(struct easeds_cache *cache, const void *key, uint32_t key_len)
+{
+    if (unlikely(cache == NULL || (key == NULL && key_len != 0))) {
+        EASEDS_ERR("[easeds_cache_remove]: Invalid cache or key pointer.");
+        return -1;
+    }
+
+    struct easeds_cache_entry **pos =
+        cache_lookup(cache, key, key_len, easeds_hash_bytes(key, key_len));
+    if (*pos == NULL) {
+        return -1;
+    }
+
+    cache_drop(cache, pos, *pos);
+    return 0;
+}
+
+// 获取条目数量
+uint32_t easeds_cache_count(struct easeds_cache *cache)
+{
+    if (unlikely(cache == NULL)) {
+        EASEDS_ERR("[easeds_cache_count]: Invalid cache pointer.");
+        return 0;
+    }
+
+    return cache->count;
+}
+
+// 获取当前占用
+uint64_t easeds_cache_usage(struct easeds_cache *cache)
+{
+    if (unlikely(cache == NULL)) {
+        EASEDS_ERR("[easeds_cache_usage]: Invalid cache pointer.");
+        return 0;
+    }
+
+    return cache->usage;
+}
+
+// 获取统计计数
+void easeds_cache_get_stats(struct easeds_cache *cache, struct easeds_cache_stats *stats)
+{
+    if (unlikely(cache == NULL || stats == NULL)) {
+        EASEDS_ERR("[easeds_cache_get_stats]: Invalid cache or stats pointer.");
+        return;
+    }
+
+    *stats = cache->stats;
+}
+
+// 重置统计计数
+void easeds_cache_reset_stats(struct easeds_cache *cache)
+{
+    if (unlikely(cache == NULL)) {
+        EASEDS_ERR("[easeds_cache_reset_stats]: Invalid cache pointer.");
+        return;
+    }
+
+    memset(&cache->stats, 0, sizeof(cache->stats));
+}
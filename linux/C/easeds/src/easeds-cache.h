@@ -0,0 +1,160 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-cache.h
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-18 14:40
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  有界缓存容器, 支持严格 LRU 和 CLOCK(二次机会)两种淘汰策略.
+ *
+ * @History:
+ *  2026年10月18日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#ifndef __EASEDS_CACHE_H__
+#define __EASEDS_CACHE_H__
+
+/* C 标准库头文件 */
+#include <stdbool.h>
+#include <stdint.h>
+
+/* 项目内部头文件 */
+#include "easeds-public.h"
+#include "easeds-queue.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 淘汰策略 */
+enum easeds_cache_policy {
+    EASEDS_CACHE_LRU   = 0, /* 严格 LRU, 每次命中都移动到链表头部 */
+    EASEDS_CACHE_CLOCK = 1, /* CLOCK 二次机会, 命中只设置访问位, 不修改链表 */
+};
+
+/* 容量计算方式 */
+enum easeds_cache_capacity {
+    EASEDS_CACHE_BY_COUNT = 0, /* 按条目数量计算, 每个条目占用为 1 */
+    EASEDS_CACHE_BY_BYTES = 1, /* 按用户指定的字节数计算 */
+};
+
+/* 缓存条目, 键内容紧跟在结构体后面存放 */
+struct easeds_cache_entry {
+    struct easeds_cache_entry *hash_next;  /* 哈希桶链表 */
+    TAILQ_ENTRY(easeds_cache_entry) entry; /* LRU 链表或 CLOCK 环形链表 */
+    void    *value;                        /* 值 */
+    uint64_t hash;                         /* 键的哈希值 */
+    uint64_t charge;                       /* 占用的容量 */
+    uint32_t key_len;                      /* 键长度 */
+    uint32_t referenced;                   /* CLOCK 访问位 */
+    uint8_t  key[];                        /* 键内容 */
+};
+
+TAILQ_HEAD(easeds_cache_list, easeds_cache_entry);
+
+/* 缓存统计计数 */
+struct easeds_cache_stats {
+    uint64_t hits;      /* 命中次数 */
+    uint64_t misses;    /* 未命中次数 */
+    uint64_t inserts;   /* 插入次数(包含覆盖) */
+    uint64_t evictions; /* 因容量不足淘汰的次数 */
+};
+
+/**
+ * 实现一个有界缓存, 键为任意字节串, 值为任意指针, 查找/插入/删除复杂度均为 O(1).
+ *  (1) 内部使用链式哈希表索引条目, 条目数量超过桶数量时桶数组扩容为两倍.
+ *  (2) LRU 策略: 命中时把条目移动到链表头部, 容量不足时淘汰链表尾部条目.
+ *  (3) CLOCK 策略: 条目组成环形链表, 命中时只设置访问位; 淘汰时时钟指针顺序扫描,
+ *      访问位为 1 的条目清零后跳过(二次机会), 遇到访问位为 0 的条目则淘汰.
+ *      命中路径只写一个字节, 不修改链表指针, 读多写少时开销远小于严格 LRU.
+ *  (4) 容量可以按条目数量或按字节数计算, 按字节计算时由插入方指定每个条目的占用.
+ *  (5) 值离开缓存时(淘汰, 覆盖, 删除, 清空, 销毁)调用释放回调函数, 由用户释放值.
+ *  (6) 非线程安全, 需要用户自行保证线程安全性.
+ */
+struct easeds_cache {
+    const char                 *name;    /* 名称, 预留字段, 可用于调试和日志输出 */
+    struct easeds_cache_entry **buckets; /* 哈希桶数组 */
+    struct easeds_cache_list    list;    /* LRU 链表(头部最新)或 CLOCK 环形链表 */
+    struct easeds_cache_entry  *hand;    /* CLOCK 时钟指针, NULL 表示指向链表头部 */
+    /* 释放回调函数, 可选, 值离开缓存时调用 */
+    void (*release)(const void *key, uint32_t key_len, void *value, void *user_data);
+    void                      *user_data;   /* 释放回调函数的用户数据 */
+    uint64_t                   capacity;    /* 容量上限 */
+    uint64_t                   usage;       /* 当前占用 */
+    uint32_t                   count;       /* 条目数量 */
+    uint32_t                   bucket_mask; /* 桶数量减一, 桶数量为 2 的幂 */
+    enum easeds_cache_policy   policy;      /* 淘汰策略 */
+    enum easeds_cache_capacity mode;        /* 容量计算方式 */
+    struct easeds_cache_stats  stats;       /* 统计计数 */
+};
+
+/**
+ * 常见缓存操作函数:
+ *
+ * 函数名                       功能描述
+ * ------------------------     ------------------------------------------------------
+ * easeds_cache_create          创建缓存, 指定淘汰策略和容量, 失败返回NULL
+ * easeds_cache_destroy         销毁缓存, 对所有值调用释放回调函数
+ * easeds_cache_clear           清空缓存, 对所有值调用释放回调函数
+ * easeds_cache_set_release_cb  设置释放回调函数
+ * easeds_cache_put             插入或覆盖键值对, 必要时淘汰旧条目, 成功返回0, 失败返回-1
+ * easeds_cache_get             查找键对应的值, 命中返回0, 未命中返回-1
+ * easeds_cache_contains        判断键是否存在, 不更新访问状态和统计计数
+ * easeds_cache_remove          删除键值对, 成功返回0, 键不存在返回-1
+ * easeds_cache_count           获取条目数量
+ * easeds_cache_usage           获取当前占用
+ * easeds_cache_get_stats       获取统计计数
+ * easeds_cache_reset_stats     重置统计计数
+ */
+
+// 创建缓存, 指定淘汰策略, 容量计算方式和容量上限, 失败返回NULL
+struct easeds_cache *easeds_cache_create(const char *name, enum easeds_cache_policy policy,
+    enum easeds_cache_capacity mode, uint64_t capacity);
+
+// 销毁缓存, 对所有值调用释放回调函数
+void easeds_cache_destroy(struct easeds_cache *cache);
+
+// 清空缓存, 对所有值调用释放回调函数, 统计计数保留
+void easeds_cache_clear(struct easeds_cache *cache);
+
+// 设置释放回调函数, 值离开缓存时调用
+void easeds_cache_set_release_cb(struct easeds_cache *cache,
+    void (*release)(const void *key, uint32_t key_len, void *value, void *user_data),
+    void *user_data);
+
+// 插入或覆盖键值对, charge 为按字节计算时的占用, 必要时淘汰旧条目, 成功返回0, 失败返回-1
+int32_t easeds_cache_put(struct easeds_cache *cache, const void *key, uint32_t key_len,
+    void *value, uint64_t charge);
+
+// 查找键对应的值, value 非空时返回找到的值, 命中返回0, 未命中返回-1
+int32_t easeds_cache_get(
+    struct easeds_cache *cache, const void *key, uint32_t key_len, void **value);
+
+// 判断键是否存在, 不更新访问状态和统计计数
+bool easeds_cache_contains(struct easeds_cache *cache, const void *key, uint32_t key_len);
+
+// 删除键值对, 对值调用释放回调函数, 成功返回0, 键不存在返回-1
+int32_t easeds_cache_remove(struct easeds_cache *cache, const void *key, uint32_t key_len);
+
+// 获取条目数量
+uint32_t easeds_cache_count(struct easeds_cache *cache);
+
+// 获取当前占用
+uint64_t easeds_cache_usage(struct easeds_cache *cache);
+
+// 获取统计计数
+void easeds_cache_get_stats(struct easeds_cache *cache, struct easeds_cache_stats *stats);
+
+// 重置统计计数
+void easeds_cache_reset_stats(struct easeds_cache *cache);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __EASEDS_CACHE_H__ */
@@ -0,0 +1,420 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-chmap-unittest.c
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-18 21:40
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  Easeds 并发哈希表单元测试实现文件, 包含了扩容迁移/多线程读写一致性/和全局锁基线的吞吐对比测试.
+ *
+ * @History:
+ *  2026年10月18日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#include "easeds-unittest.h"
+
+// 标准库头文件
+#include <pthread.h>
+
+// 项目内部头文件
+#include "easeds-cache.h"
+#include "easeds-chmap.h"
+#include "easeds-utils.h"
+
+// 把整数转换为指针值, 便于校验
+#define CHMAP_TEST_VALUE(key) ((void *)(uintptr_t)((key) + 1))
+
+static int32_t chmap_put_u64(struct easeds_chmap *map, uint64_t key, void *value)
+{
+    return easeds_chmap_put(map, &key, sizeof(key), value);
+}
+
+static int32_t chmap_get_u64(struct easeds_chmap *map, uint64_t key, void **value)
+{
+    return easeds_chmap_get(map, &key, sizeof(key), value);
+}
+
+static int32_t chmap_remove_u64(struct easeds_chmap *map, uint64_t key, void **value)
+{
+    return easeds_chmap_remove(map, &key, sizeof(key), value);
+}
+
+// 基本功能测试: 插入, 查找, 覆盖, 删除, 扩容
+static void test_easeds_chmap_basic(void **state)
+{
+    easeds_unused(state);
+
+    struct easeds_chmap *map = easeds_chmap_create("basic", 0, 0);
+    assert_non_null(map);
+    assert_int_equal(easeds_chmap_buckets(map), EASEDS_CHMAP_STRIPES);
+
+    // 插入足够多的键触发多次扩容, 扩容期间所有键都可以查到
+    for (uint64_t key = 0; key < 20000; key++) {
+        assert_int_equal(chmap_put_u64(map, key, CHMAP_TEST_VALUE(key)), EASEDS_OK);
+    }
+    assert_int_equal(easeds_chmap_size(map), 20000);
+    assert_true(easeds_chmap_buckets(map) > EASEDS_CHMAP_STRIPES);
+
+    for (uint64_t key = 0; key < 20000; key++) {
+        void *value = NULL;
+        assert_int_equal(chmap_get_u64(map, key, &value), EASEDS_OK);
+        assert_ptr_equal(value, CHMAP_TEST_VALUE(key));
+    }
+    assert_int_equal(chmap_get_u64(map, 20000, NULL), EASEDS_ERROR);
+
+    // 覆盖不改变数量
+    assert_int_equal(chmap_put_u64(map, 7, CHMAP_TEST_VALUE(100)), EASEDS_OK);
+    assert_int_equal(easeds_chmap_size(map), 20000);
+
+    void *value = NULL;
+    assert_int_equal(chmap_get_u64(map, 7, &value), EASEDS_OK);
+    assert_ptr_equal(value, CHMAP_TEST_VALUE(100));
+
+    // 删除一半
+    for (uint64_t key = 0; key < 20000; key += 2) {
+        assert_int_equal(chmap_remove_u64(map, key, &value), EASEDS_OK);
+        assert_ptr_equal(value, CHMAP_TEST_VALUE(key));
+    }
+    assert_int_equal(easeds_chmap_size(map), 10000);
+    for (uint64_t key = 0; key < 20000; key++) {
+        assert_int_equal(chmap_get_u64(map, key, NULL), (key & 1) ? EASEDS_OK : EASEDS_ERROR);
+    }
+
+    easeds_chmap_destroy(map);
+}
+
+// 多线程测试参数
+struct chmap_thread_ctx {
+    struct easeds_chmap *map;      /* 哈希表 */
+    uint64_t             base;     /* 本线程负责的键起点 */
+    uint64_t             count;    /* 本线程负责的键数量 */
+    uint64_t             rounds;   /* 重复轮数 */
+    uint64_t             errors;   /* 检测到的错误数量 */
+    uint64_t            *stop;     /* 读线程停止标志 */
+    uint64_t             key_max;  /* 读线程随机访问的键范围 */
+    uint64_t             lookups;  /* 读线程完成的查找次数 */
+};
+
+// 写线程: 在自己的键范围内反复插入和删除, 每轮结束后校验
+static void *chmap_writer(void *arg)
+{
+    struct chmap_thread_ctx *ctx = arg;
+
+    for (uint64_t r = 0; r < ctx->rounds; r++) {
+        for (uint64_t key = ctx->base; key < ctx->base + ctx->count; key++) {
+            if (chmap_put_u64(ctx->map, key, CHMAP_TEST_VALUE(key)) != 0) {
+                ctx->errors++;
+            }
+        }
+        for (uint64_t key = ctx->base; key < ctx->base + ctx->count; key++) {
+            void *value = NULL;
+            if (chmap_get_u64(ctx->map, key, &value) != 0 || value != CHMAP_TEST_VALUE(key)) {
+                ctx->errors++;
+            }
+        }
+        if (r + 1 == ctx->rounds) {
+            break;
+        }
+        for (uint64_t key = ctx->base; key < ctx->base + ctx->count; key += 3) {
+            void *value = NULL;
+            if (chmap_remove_u64(ctx->map, key, &value) != 0 || value != CHMAP_TEST_VALUE(key)) {
+                ctx->errors++;
+            }
+        }
+    }
+    return NULL;
+}
+
+// 读线程: 随机查找, 找到的值必须和键对应
+static void *chmap_reader_fn(void *arg)
+{
+    struct chmap_thread_ctx *ctx  = arg;
+    uint64_t                 seed = 88172645463325252ULL ^ ctx->base;
+
+    while (__atomic_load_n(ctx->stop, __ATOMIC_ACQUIRE) == 0) {
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+
+        void    *value = NULL;
+        uint64_t key   = seed % ctx->key_max;
+        if (chmap_get_u64(ctx->map, key, &value) == 0 && value != CHMAP_TEST_VALUE(key)) {
+            ctx->errors++;
+        }
+        ctx->lookups++;
+    }
+    return NULL;
+}
+
+// 操作测试: 多个写线程在不相交的键范围内插入删除, 读线程在扩容迁移期间并发查找
+static void test_easeds_chmap_operations(void **state)
+{
+    easeds_unused(state);
+
+    enum { WRITERS = 4, READERS = 2, PER_WRITER = 20000 };
+
+    struct easeds_chmap    *map  = easeds_chmap_create("operations", 0, EASEDS_CHMAP_LATENCY);
+    uint64_t                stop = 0;
+    pthread_t               threads[WRITERS + READERS];
+    struct chmap_thread_ctx ctx[WRITERS + READERS];
+    assert_non_null(map);
+
+    memset(ctx, 0, sizeof(ctx));
+    for (uint32_t i = 0; i < WRITERS + READERS; i++) {
+        ctx[i].map     = map;
+        ctx[i].base    = i < WRITERS ? i * PER_WRITER : i;
+        ctx[i].count   = PER_WRITER;
+        ctx[i].rounds  = 4;
+        ctx[i].stop    = &stop;
+        ctx[i].key_max = WRITERS * PER_WRITER;
+        void *(*fn)(void *) = i < WRITERS ? chmap_writer : chmap_reader_fn;
+        assert_int_equal(pthread_create(&threads[i], NULL, fn, &ctx[i]), 0);
+    }
+
+    for (uint32_t i = 0; i < WRITERS; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    __atomic_store_n(&stop, 1, __ATOMIC_RELEASE);
+    for (uint32_t i = WRITERS; i < WRITERS + READERS; i++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    for (uint32_t i = 0; i < WRITERS + READERS; i++) {
+        assert_int_equal(ctx[i].errors, 0);
+    }
+
+    // 最后一轮不删除, 所有键都在
+    assert_int_equal(easeds_chmap_size(map), WRITERS * PER_WRITER);
+    for (uint64_t key = 0; key < WRITERS * PER_WRITER; key++) {
+        void *value = NULL;
+        assert_int_equal(chmap_get_u64(map, key, &value), EASEDS_OK);
+        assert_ptr_equal(value, CHMAP_TEST_VALUE(key));
+    }
+
+    struct easeds_chmap_stats stats;
+    easeds_chmap_stats(map, &stats);
+    assert_true(stats.resizes > 0);
+    assert_true(stats.migrated > 0);
+    assert_true(stats.grace_periods > 0);
+    assert_int_equal(stats.ops[EASEDS_CHMAP_OP_REMOVE].count, WRITERS * 3 * ((PER_WRITER + 2) / 3));
+    assert_true(stats.ops[EASEDS_CHMAP_OP_PUT].count >= WRITERS * 4 * PER_WRITER);
+
+    // 回收后统计的释放数量包含所有删除和迁移替换下来的节点
+    easeds_chmap_reclaim(map);
+    easeds_chmap_stats(map, &stats);
+    assert_int_equal(stats.reclaimed, stats.ops[EASEDS_CHMAP_OP_REMOVE].count + stats.migrated);
+
+    easeds_chmap_reset_stats(map);
+    easeds_chmap_stats(map, &stats);
+    assert_int_equal(stats.ops[EASEDS_CHMAP_OP_GET].count, 0);
+
+    easeds_chmap_destroy(map);
+}
+
+// 边界测试: 空键, 变长键, 预设容量, 扩容中途销毁
+static void test_easeds_chmap_boundary(void **state)
+{
+    easeds_unused(state);
+
+    struct easeds_chmap *map = easeds_chmap_create("boundary", 100000, 0);
+    assert_non_null(map);
+    assert_int_equal(easeds_chmap_buckets(map), 131072);
+
+    // 长度为 0 的键是一个合法的键
+    void *value = NULL;
+    assert_int_equal(easeds_chmap_put(map, NULL, 0, CHMAP_TEST_VALUE(0)), EASEDS_OK);
+    assert_int_equal(easeds_chmap_get(map, "", 0, &value), EASEDS_OK);
+    assert_ptr_equal(value, CHMAP_TEST_VALUE(0));
+
+    // 前缀相同的变长键互不影响
+    const char *keys[] = {"a", "ab", "abc", "abcdefghijklmnop", "abcdefghijklmnopq"};
+    for (uint32_t i = 0; i < 5; i++) {
+        uint32_t len = (uint32_t)strlen(keys[i]);
+        assert_int_equal(easeds_chmap_put(map, keys[i], len, CHMAP_TEST_VALUE(i + 1)), EASEDS_OK);
+    }
+    for (uint32_t i = 0; i < 5; i++) {
+        uint32_t len = (uint32_t)strlen(keys[i]);
+        assert_int_equal(easeds_chmap_get(map, keys[i], len, &value), EASEDS_OK);
+        assert_ptr_equal(value, CHMAP_TEST_VALUE(i + 1));
+    }
+    assert_int_equal(easeds_chmap_remove(map, "ab", 2, NULL), EASEDS_OK);
+    assert_int_equal(easeds_chmap_get(map, "ab", 2, NULL), EASEDS_ERROR);
+    assert_int_equal(easeds_chmap_get(map, "abc", 3, NULL), EASEDS_OK);
+    assert_int_equal(easeds_chmap_size(map), 5);
+    assert_int_equal(easeds_chmap_reclaim(map), 1);
+    assert_int_equal(easeds_chmap_reclaim(map), 0);
+    easeds_chmap_destroy(map);
+
+    // 刚好触发一次扩容就销毁, 旧表中未迁移的桶和新表中的节点都要释放
+    map = easeds_chmap_create("boundary", 0, 0);
+    assert_non_null(map);
+    uint64_t key = 0;
+    while (easeds_chmap_buckets(map) == EASEDS_CHMAP_STRIPES) {
+        assert_int_equal(chmap_put_u64(map, key, CHMAP_TEST_VALUE(key)), EASEDS_OK);
+        key++;
+    }
+    for (uint64_t k = 0; k < key; k++) {
+        assert_int_equal(chmap_get_u64(map, k, &value), EASEDS_OK);
+        assert_ptr_equal(value, CHMAP_TEST_VALUE(k));
+    }
+    easeds_chmap_destroy(map);
+}
+
+// 错误测试: 空指针参数, 删除不存在的键
+static void test_easeds_chmap_error(void **state)
+{
+    easeds_unused(state);
+
+    uint64_t key = 1;
+    assert_null(easeds_chmap_create("error", UINT64_MAX, 0));
+    assert_int_equal(easeds_chmap_put(NULL, &key, sizeof(key), NULL), EASEDS_ERROR);
+    assert_int_equal(easeds_chmap_get(NULL, &key, sizeof(key), NULL), EASEDS_ERROR);
+    assert_int_equal(easeds_chmap_remove(NULL, &key, sizeof(key), NULL), EASEDS_ERROR);
+    assert_int_equal(easeds_chmap_size(NULL), 0);
+    assert_int_equal(easeds_chmap_buckets(NULL), 0);
+    assert_int_equal(easeds_chmap_reclaim(NULL), 0);
+    easeds_chmap_stats(NULL, NULL);
+    easeds_chmap_reset_stats(NULL);
+    easeds_chmap_destroy(NULL);
+
+    struct easeds_chmap *map = easeds_chmap_create("error", 0, 0);
+    assert_non_null(map);
+    assert_int_equal(easeds_chmap_put(map, NULL, 8, NULL), EASEDS_ERROR);
+    assert_int_equal(easeds_chmap_get(map, NULL, 8, NULL), EASEDS_ERROR);
+    assert_int_equal(easeds_chmap_remove(map, NULL, 8, NULL), EASEDS_ERROR);
+    assert_int_equal(chmap_remove_u64(map, key, NULL), EASEDS_ERROR);
+    assert_int_equal(chmap_put_u64(map, key, NULL), EASEDS_OK);
+    assert_int_equal(chmap_remove_u64(map, key, NULL), EASEDS_OK);
+    assert_int_equal(chmap_remove_u64(map, key, NULL), EASEDS_ERROR);
+    easeds_chmap_destroy(map);
+}
+
+// 性能测试参数, map 和 cache 二选一
+struct chmap_perf_ctx {
+    struct easeds_chmap *map;   /* 并发哈希表 */
+    struct easeds_cache *cache; /* 全局锁基线 */
+    pthread_mutex_t     *lock;  /* 基线的全局锁 */
+    uint64_t             seed;  /* 随机种子 */
+    uint64_t             keys;  /* 键范围 */
+    uint64_t             ops;   /* 操作次数 */
+};
+
+// 性能测试线程: 90% 查找, 10% 插入
+static void *chmap_perf_fn(void *arg)
+{
+    struct chmap_perf_ctx *ctx  = arg;
+    uint64_t               seed = ctx->seed;
+
+    for (uint64_t i = 0; i < ctx->ops; i++) {
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+
+        void    *value = NULL;
+        uint64_t key   = (seed >> 8) % ctx->keys;
+        if (ctx->map != NULL) {
+            if (seed % 10 != 0) {
+                chmap_get_u64(ctx->map, key, &value);
+            } else {
+                chmap_put_u64(ctx->map, key, CHMAP_TEST_VALUE(key));
+            }
+        } else {
+            pthread_mutex_lock(ctx->lock);
+            if (seed % 10 != 0) {
+                easeds_cache_get(ctx->cache, &key, sizeof(key), &value);
+            } else {
+                easeds_cache_put(ctx->cache, &key, sizeof(key), CHMAP_TEST_VALUE(key), 0);
+            }
+            pthread_mutex_unlock(ctx->lock);
+        }
+    }
+    return NULL;
+}
+
+// 运行一轮多线程测试, 返回总耗时
+static int64_t chmap_perf_run(struct chmap_perf_ctx *base, uint32_t nthreads)
+{
+    pthread_t             threads[8];
+    struct chmap_perf_ctx ctx[8];
+
+    int64_t start = easeds_get_current_time_ns();
+    for (uint32_t t = 0; t < nthreads; t++) {
+        ctx[t]      = *base;
+        ctx[t].seed = base->seed + t * 0x9E3779B97F4A7C15ULL;
+        assert_int_equal(pthread_create(&threads[t], NULL, chmap_perf_fn, &ctx[t]), 0);
+    }
+    for (uint32_t t = 0; t < nthreads; t++) {
+        pthread_join(threads[t], NULL);
+    }
+    return easeds_get_current_time_ns() - start;
+}
+
+// 性能测试: 90% 读负载下并发哈希表和全局锁缓存的吞吐, 吞吐不开启延迟统计, 取时间的开销和查找本身相当,
+// 延迟统计单独运行一轮.
+static void test_easeds_chmap_perf(void **state)
+{
+    easeds_unused(state);
+
+    const uint64_t keys      = 100000;
+    const uint64_t ops       = 500000;
+    const uint32_t threads[] = {1, 2, 4};
+
+    for (uint32_t i = 0; i < 3; i++) {
+        struct easeds_chmap *map     = easeds_chmap_create("perf", keys, 0);
+        struct easeds_chmap *latency = easeds_chmap_create("perf", keys, EASEDS_CHMAP_LATENCY);
+        struct easeds_cache *cache =
+            easeds_cache_create("perf", EASEDS_CACHE_LRU, EASEDS_CACHE_BY_COUNT, keys);
+        pthread_mutex_t lock;
+        assert_non_null(map);
+        assert_non_null(latency);
+        assert_non_null(cache);
+        pthread_mutex_init(&lock, NULL);
+
+        struct chmap_perf_ctx ctx = {
+            .map = map, .seed = 88172645463325252ULL, .keys = keys, .ops = ops};
+        int64_t chmap_ns = chmap_perf_run(&ctx, threads[i]);
+
+        ctx.map = latency;
+        chmap_perf_run(&ctx, threads[i]);
+
+        ctx.map         = NULL;
+        ctx.cache       = cache;
+        ctx.lock        = &lock;
+        int64_t lock_ns = chmap_perf_run(&ctx, threads[i]);
+
+        struct easeds_chmap_stats stats;
+        easeds_chmap_stats(latency, &stats);
+        uint64_t gets = stats.ops[EASEDS_CHMAP_OP_GET].count;
+        uint64_t puts = stats.ops[EASEDS_CHMAP_OP_PUT].count;
+        assert_int_equal(gets + puts, ops * threads[i]);
+
+        double total = (double)(ops * threads[i]);
+        MEASURE("[chmap perf]: %u threads, chmap %.2f Mops/s, locked cache %.2f Mops/s, "
+                "get avg %.1f ns max %lu ns, put avg %.1f ns max %lu ns.",
+            threads[i], total * 1000.0 / (double)chmap_ns, total * 1000.0 / (double)lock_ns,
+            (double)stats.ops[EASEDS_CHMAP_OP_GET].total_ns / (double)(gets ? gets : 1),
+            stats.ops[EASEDS_CHMAP_OP_GET].max_ns,
+            (double)stats.ops[EASEDS_CHMAP_OP_PUT].total_ns / (double)(puts ? puts : 1),
+            stats.ops[EASEDS_CHMAP_OP_PUT].max_ns);
+
+        pthread_mutex_destroy(&lock);
+        easeds_cache_destroy(cache);
+        easeds_chmap_destroy(latency);
+        easeds_chmap_destroy(map);
+    }
+}
+
+// 注册单元测试用例
+EASEDS_UNITTEST_REGISTER(easeds_unittest_chmap){
+    cmocka_unit_test(test_easeds_chmap_basic),
+    cmocka_unit_test(test_easeds_chmap_operations),
+    cmocka_unit_test(test_easeds_chmap_boundary),
+    cmocka_unit_test(test_easeds_chmap_error),
+    cmocka_unit_test(test_easeds_chmap_perf),
+    easeds_unit_test_end,
+};
@@ -0,0 +1,748 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-chmap.c
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-18 21:40
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  并发哈希表(Concurrent Hash Map)实现文件.
+ *
+ * @History:
+ *  2026年10月18日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#include "easeds-chmap.h"
+
+// 标准库头文件
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+
+// 项目内部头文件
+#include "easeds-log.h"
+#include "easeds-utils.h"
+
+/* 已迁移桶的标记, 节点按 8 字节对齐分配, 1 不会是合法的节点地址 */
+#define CHMAP_MOVED ((struct easeds_chmap_node *)(uintptr_t)1)
+
+/* 最小桶数量, 不小于分段数量 */
+#define CHMAP_MIN_BUCKETS EASEDS_CHMAP_STRIPES
+
+/* 最大桶数量 */
+#define CHMAP_MAX_BUCKETS (1ULL << 40)
+
+/* 每次写操作顺带迁移的旧桶数量 */
+#define CHMAP_MIGRATE_BATCH 8
+
+/* 分段待回收节点达到该数量时, 写操作在释放锁之后等待一个宽限期并回收 */
+#define CHMAP_RECLAIM_BATCH 256
+
+/* 自旋等待多少次之后让出 CPU, 线程数超过 CPU 数时避免持锁线程被抢占后空转 */
+#define CHMAP_SPIN_LIMIT 64
+
+/* 当前线程的读者槽位编号加一, 0 表示还未分配, 所有哈希表共用同一个编号 */
+static EASEDS_THREAD_DEFINE(uint32_t, chmap_reader_slot) = 0;
+
+/* 已分配的读者槽位编号 */
+static uint32_t chmap_reader_next = 0;
+
+// 自旋等待时降低 CPU 占用和流水线冲刷
+static inline void chmap_cpu_relax(uint32_t *spins)
+{
+    if (++*spins < CHMAP_SPIN_LIMIT) {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#endif
+    } else {
+        sched_yield();
+    }
+}
+
+// 获取当前线程的读者槽位
+static inline struct easeds_chmap_reader *chmap_reader(struct easeds_chmap *map)
+{
+    uint32_t slot = EASEDS_THREAD_VAR(chmap_reader_slot);
+    if (unlikely(slot == 0)) {
+        slot = __atomic_add_fetch(&chmap_reader_next, 1, __ATOMIC_RELAXED);
+        EASEDS_THREAD_VAR(chmap_reader_slot) = slot;
+    }
+    return &map->readers[(slot - 1) & (EASEDS_CHMAP_READERS - 1)];
+}
+
+// 进入读侧临界区, 在当前阶段的计数上加一, 返回所在阶段
+static inline uint32_t chmap_read_lock(struct easeds_chmap *map, struct easeds_chmap_reader *reader)
+{
+    uint32_t phase = (uint32_t)(__atomic_load_n(&map->epoch, __ATOMIC_RELAXED) & 1);
+
+    /* 计数加一必须先于读取表和链表, seq_cst 的原子加同时是完整的内存屏障 */
+    __atomic_fetch_add(&reader->active[phase], 1, __ATOMIC_SEQ_CST);
+    return phase;
+}
+
+// 退出读侧临界区
+static inline void chmap_read_unlock(struct easeds_chmap_reader *reader, uint32_t phase)
+{
+    __atomic_fetch_sub(&reader->active[phase], 1, __ATOMIC_RELEASE);
+}
+
+// 等待一个宽限期, 调用前已经摘除的节点和表在返回后没有读者引用, 可以释放.
+// 读者可能在切换前读到旧阶段, 在扫描之后才增加计数, 这类读者会被第二次切换等到, 因此切换两次.
+static void chmap_synchronize(struct easeds_chmap *map)
+{
+    pthread_mutex_lock(&map->grace_lock);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+    for (uint32_t flip = 0; flip < 2; flip++) {
+        uint64_t phase = __atomic_fetch_add(&map->epoch, 1, __ATOMIC_SEQ_CST) & 1;
+        for (uint32_t i = 0; i < EASEDS_CHMAP_READERS; i++) {
+            uint32_t spins = 0;
+            while (__atomic_load_n(&map->readers[i].active[phase], __ATOMIC_SEQ_CST) != 0) {
+                chmap_cpu_relax(&spins);
+            }
+        }
+    }
+
+    __atomic_add_fetch(&map->grace_periods, 1, __ATOMIC_RELAXED);
+    pthread_mutex_unlock(&map->grace_lock);
+}
+
+// 获取分段自旋锁
+static inline void chmap_lock(struct easeds_chmap_stripe *stripe)
+{
+    uint32_t spins = 0;
+    while (__atomic_exchange_n(&stripe->lock, 1, __ATOMIC_ACQUIRE) != 0) {
+        while (__atomic_load_n(&stripe->lock, __ATOMIC_RELAXED) != 0) {
+            chmap_cpu_relax(&spins);
+        }
+    }
+}
+
+// 释放分段自旋锁
+static inline void chmap_unlock(struct easeds_chmap_stripe *stripe)
+{
+    __atomic_store_n(&stripe->lock, 0, __ATOMIC_RELEASE);
+}
+
+// 开启延迟统计时获取操作开始时间
+static inline int64_t chmap_start_time(struct easeds_chmap *map)
+{
+    return (map->flags & EASEDS_CHMAP_LATENCY) ? easeds_get_current_time_ns() : 0;
+}
+
+// 记录一次操作的耗时, 槽位可能被多个线程共享, 使用原子操作
+static void chmap_record(struct easeds_chmap_reader *reader, enum easeds_chmap_op op, int64_t start)
+{
+    struct easeds_chmap_latency *latency = &reader->ops[op];
+    uint64_t                     ns      = (uint64_t)(easeds_get_current_time_ns() - start);
+    uint64_t                     max     = __atomic_load_n(&latency->max_ns, __ATOMIC_RELAXED);
+
+    __atomic_fetch_add(&latency->count, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&latency->total_ns, ns, __ATOMIC_RELAXED);
+    while (ns > max && !__atomic_compare_exchange_n(&latency->max_ns, &max, ns, true,
+                           __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+    }
+}
+
+// 分配指定桶数量的空表, 失败返回NULL
+static struct easeds_chmap_table *chmap_table_alloc(uint64_t buckets)
+{
+    uint64_t                   size  = sizeof(struct easeds_chmap_table) + buckets * sizeof(void *);
+    struct easeds_chmap_table *table = __easeds_malloc(size);
+    if (unlikely(table == NULL)) {
+        EASEDS_ERR("[chmap_table_alloc]: Malloc table with %lu buckets failed.", buckets);
+        return NULL;
+    }
+
+    memset(table, 0, size);
+    table->mask = buckets - 1;
+    return table;
+}
+
+// 分配节点并拷贝键, 失败返回NULL
+static struct easeds_chmap_node *chmap_node_alloc(
+    uint64_t hash, const void *key, uint32_t key_len, void *value)
+{
+    struct easeds_chmap_node *node = __easeds_malloc(sizeof(struct easeds_chmap_node) + key_len);
+    if (unlikely(node == NULL)) {
+        EASEDS_ERR("[chmap_node_alloc]: Malloc node with key length %u failed.", key_len);
+        return NULL;
+    }
+
+    node->next    = NULL;
+    node->retire  = NULL;
+    node->value   = value;
+    node->hash    = hash;
+    node->key_len = key_len;
+    node->pad     = 0;
+    if (key_len != 0) {
+        memcpy(node->key, key, key_len);
+    }
+    return node;
+}
+
+// 比较节点的键
+static inline bool chmap_node_match(
+    struct easeds_chmap_node *node, uint64_t hash, const void *key, uint32_t key_len)
+{
+    return node->hash == hash && node->key_len == key_len
+        && (key_len == 0 || memcmp(node->key, key, key_len) == 0);
+}
+
+// 释放 retire 链表上的所有节点, 返回释放数量
+static uint64_t chmap_free_retired(struct easeds_chmap_node *node)
+{
+    uint64_t count = 0;
+
+    while (node != NULL) {
+        struct easeds_chmap_node *next = node->retire;
+        __easeds_free(node);
+        node = next;
+        count++;
+    }
+    return count;
+}
+
+// 节点挂到分段的待回收链表, 调用者持有分段锁
+static inline void chmap_retire(struct easeds_chmap_stripe *stripe, struct easeds_chmap_node *node)
+{
+    node->retire    = stripe->retired;
+    stripe->retired = node;
+    stripe->pending++;
+}
+
+// 迁移旧表的一个桶到新表, 调用者持有该桶所在分段的锁, 成功返回0, 内存不足返回-1.
+// 旧链表保持不变, 新表的两个目标桶只来自这个旧桶, 迁移前一定为空, 拷贝完成后整体发布.
+static int32_t chmap_migrate_bucket(struct easeds_chmap *map, struct easeds_chmap_table *old,
+    uint64_t index, struct easeds_chmap_stripe *stripe)
+{
+    struct easeds_chmap_table *next     = old->next;
+    struct easeds_chmap_node  *head     = old->buckets[index];
+    struct easeds_chmap_node  *lists[2] = {NULL, NULL};
+    uint64_t                   moved    = 0;
+
+    for (struct easeds_chmap_node *node = head; node != NULL; node = node->next) {
+        struct easeds_chmap_node *copy = chmap_node_alloc(node->hash, node->key, node->key_len,
+            __atomic_load_n(&node->value, __ATOMIC_RELAXED));
+        if (unlikely(copy == NULL)) {
+            for (uint32_t i = 0; i < 2; i++) {
+                while (lists[i] != NULL) {
+                    struct easeds_chmap_node *tmp = lists[i]->next;
+                    __easeds_free(lists[i]);
+                    lists[i] = tmp;
+                }
+            }
+            return -1;
+        }
+
+        uint32_t half = (node->hash & (old->mask + 1)) != 0 ? 1 : 0;
+        copy->next    = lists[half];
+        lists[half]   = copy;
+        moved++;
+    }
+
+    /* 先发布新表的桶, 再标记旧桶, 读者看到 MOVED 时一定能看到新表中的节点 */
+    __atomic_store_n(&next->buckets[index], lists[0], __ATOMIC_RELEASE);
+    __atomic_store_n(&next->buckets[index + old->mask + 1], lists[1], __ATOMIC_RELEASE);
+    __atomic_store_n(&old->buckets[index], CHMAP_MOVED, __ATOMIC_RELEASE);
+
+    for (struct easeds_chmap_node *node = head; node != NULL; node = node->next) {
+        chmap_retire(stripe, node);
+    }
+    __atomic_add_fetch(&map->moved_nodes, moved, __ATOMIC_RELAXED);
+    return 0;
+}
+
+// 记录迁移完成的桶数量, 最后一个桶迁移完成时切换根表, 返回需要在宽限期后释放的旧表
+static struct easeds_chmap_table *chmap_migrate_done(
+    struct easeds_chmap *map, struct easeds_chmap_table *old, uint64_t count)
+{
+    if (__atomic_add_fetch(&old->migrated, count, __ATOMIC_ACQ_REL) != old->mask + 1) {
+        return NULL;
+    }
+
+    __atomic_store_n(&map->root, old->next, __ATOMIC_RELEASE);
+    __atomic_add_fetch(&map->resizes, 1, __ATOMIC_RELAXED);
+    return old;
+}
+
+// 写操作顺带迁移若干个旧桶, 调用者在读侧临界区内且不持有分段锁, 返回需要释放的旧表.
+// 迁移进度保存在旧表中, 过期的旧表指针只会领取到该表自己的桶, 不会干扰下一次扩容.
+// 领取位置对桶数量取模循环领取, 内存不足而没有迁移的桶(包括 chmap_locate 中失败的桶)
+// 会在下一轮被之后任意一次写操作重新领取, 已迁移的桶直接跳过, 直到全部迁移完成.
+static struct easeds_chmap_table *chmap_help_migrate(struct easeds_chmap *map)
+{
+    struct easeds_chmap_table *old = __atomic_load_n(&map->root, __ATOMIC_ACQUIRE);
+    if (__atomic_load_n(&old->next, __ATOMIC_ACQUIRE) == NULL) {
+        return NULL;
+    }
+
+    uint64_t size  = old->mask + 1;
+    uint64_t claim = __atomic_fetch_add(&old->migrate_next, CHMAP_MIGRATE_BATCH, __ATOMIC_RELAXED);
+    uint64_t start = claim & old->mask;
+    uint64_t end   = start + CHMAP_MIGRATE_BATCH < size ? start + CHMAP_MIGRATE_BATCH : size;
+    uint64_t done  = 0;
+
+    for (uint64_t i = start; i < end; i++) {
+        struct easeds_chmap_stripe *stripe = &map->stripes[i & (EASEDS_CHMAP_STRIPES - 1)];
+        int32_t                     ret    = 0;
+
+        chmap_lock(stripe);
+        if (old->buckets[i] != CHMAP_MOVED) {
+            ret = chmap_migrate_bucket(map, old, i, stripe);
+            done += ret == 0 ? 1 : 0;
+        }
+        chmap_unlock(stripe);
+
+        /* 内存不足时停止本批迁移, 失败的桶在下一轮循环领取时重试 */
+        if (unlikely(ret != 0)) {
+            break;
+        }
+    }
+
+    return done != 0 ? chmap_migrate_done(map, old, done) : NULL;
+}
+
+// 找到键所在桶仍然有效的最新表, 途经的未迁移旧桶先迁移, 调用者持有分段锁, 内存不足返回NULL
+static struct easeds_chmap_table *chmap_locate(struct easeds_chmap *map,
+    struct easeds_chmap_stripe *stripe, uint64_t hash, struct easeds_chmap_table **retired)
+{
+    struct easeds_chmap_table *table = __atomic_load_n(&map->root, __ATOMIC_ACQUIRE);
+
+    for (;;) {
+        struct easeds_chmap_table *next  = __atomic_load_n(&table->next, __ATOMIC_ACQUIRE);
+        uint64_t                   index = hash & table->mask;
+        if (next == NULL) {
+            return table;
+        }
+
+        if (table->buckets[index] != CHMAP_MOVED) {
+            if (unlikely(chmap_migrate_bucket(map, table, index, stripe) != 0)) {
+                return NULL;
+            }
+
+            struct easeds_chmap_table *old = chmap_migrate_done(map, table, 1);
+            if (old != NULL) {
+                *retired = old;
+            }
+        }
+        table = next;
+    }
+}
+
+// 开始一次扩容, 新表建立后由后续的写操作渐进迁移, 同一时刻只有一次扩容
+static void chmap_start_resize(struct easeds_chmap *map, uint64_t mask)
+{
+    if (__atomic_exchange_n(&map->resizing, 1, __ATOMIC_ACQUIRE) != 0) {
+        return;
+    }
+
+    /* 上一次扩容的旧表已经释放, 当前表就是根表; 表已经被其他线程扩容过时放弃 */
+    struct easeds_chmap_table *table = __atomic_load_n(&map->table, __ATOMIC_ACQUIRE);
+    if (table->mask != mask || table->mask + 1 >= CHMAP_MAX_BUCKETS) {
+        __atomic_store_n(&map->resizing, 0, __ATOMIC_RELEASE);
+        return;
+    }
+
+    struct easeds_chmap_table *next = chmap_table_alloc((table->mask + 1) * 2);
+    if (unlikely(next == NULL)) {
+        __atomic_store_n(&map->resizing, 0, __ATOMIC_RELEASE);
+        return;
+    }
+
+    __atomic_store_n(&map->table, next, __ATOMIC_RELEASE);
+    __atomic_store_n(&table->next, next, __ATOMIC_RELEASE);
+    PFL_DEBUG("[chmap_start_resize]: name=%s, buckets %lu -> %lu.",
+        map->name != NULL ? map->name : "(null)", table->mask + 1, next->mask + 1);
+}
+
+// 写操作释放锁之后的收尾: 等待一个宽限期, 释放摘除的节点和迁移完成的旧表
+static void chmap_write_finish(
+    struct easeds_chmap *map, struct easeds_chmap_node *retired, struct easeds_chmap_table *old)
+{
+    if (retired == NULL && old == NULL) {
+        return;
+    }
+
+    chmap_synchronize(map);
+    __atomic_add_fetch(&map->reclaimed, chmap_free_retired(retired), __ATOMIC_RELAXED);
+    if (old != NULL) {
+        __easeds_free(old);
+        __atomic_store_n(&map->resizing, 0, __ATOMIC_RELEASE);
+    }
+}
+
+// 取下分段中达到批量的待回收节点, 调用者持有分段锁
+static inline struct easeds_chmap_node *chmap_take_retired(struct easeds_chmap_stripe *stripe)
+{
+    struct easeds_chmap_node *retired = NULL;
+
+    if (stripe->pending >= CHMAP_RECLAIM_BATCH) {
+        retired         = stripe->retired;
+        stripe->retired = NULL;
+        stripe->pending = 0;
+    }
+    return retired;
+}
+
+// 在键所在桶中插入或覆盖, 调用者持有分段锁, 需要扩容时通过 grow 返回当前表的 mask
+static int32_t chmap_insert(struct easeds_chmap_table *table, struct easeds_chmap_stripe *stripe,
+    uint64_t hash, const void *key, uint32_t key_len, void *value, uint64_t *grow)
+{
+    struct easeds_chmap_node **head = &table->buckets[hash & table->mask];
+    struct easeds_chmap_node  *node = *head;
+
+    while (node != NULL && !chmap_node_match(node, hash, key, key_len)) {
+        node = node->next;
+    }
+
+    if (node != NULL) {
+        __atomic_store_n(&node->value, value, __ATOMIC_RELEASE);
+        return 0;
+    }
+
+    node = chmap_node_alloc(hash, key, key_len, value);
+    if (unlikely(node == NULL)) {
+        return -1;
+    }
+
+    /* 节点内容先于链表头对读者可见 */
+    node->next = *head;
+    __atomic_store_n(head, node, __ATOMIC_RELEASE);
+    stripe->size++;
+
+    /* 每个分段的键数量超过其桶数量时扩容, 不需要全局计数 */
+    if (stripe->size > (table->mask + 1) / EASEDS_CHMAP_STRIPES) {
+        *grow = table->mask;
+    }
+    return 0;
+}
+
+// 从键所在桶中摘除节点并挂到待回收链表, 调用者持有分段锁, 键不存在返回-1.
+// 摘除节点只修改前驱的 next, 正在该节点上的读者仍然可以沿 next 继续遍历.
+static int32_t chmap_unlink(struct easeds_chmap_table *table, struct easeds_chmap_stripe *stripe,
+    uint64_t hash, const void *key, uint32_t key_len, void **value)
+{
+    struct easeds_chmap_node **link = &table->buckets[hash & table->mask];
+
+    for (struct easeds_chmap_node *node = *link; node != NULL; node = *link) {
+        if (chmap_node_match(node, hash, key, key_len)) {
+            if (value != NULL) {
+                *value = node->value;
+            }
+            __atomic_store_n(link, node->next, __ATOMIC_RELEASE);
+            chmap_retire(stripe, node);
+            stripe->size--;
+            return 0;
+        }
+        link = &node->next;
+    }
+    return -1;
+}
+
+// 创建并发哈希表, capacity 为预期键数量, flags 为 EASEDS_CHMAP_* 标志, 失败返回NULL
+struct easeds_chmap *easeds_chmap_create(const char *name, uint64_t capacity, uint32_t flags)
+{
+    uint64_t buckets = CHMAP_MIN_BUCKETS;
+
+    if (unlikely(capacity > CHMAP_MAX_BUCKETS)) {
+        EASEDS_ERR("[easeds_chmap_create]: Invalid capacity %lu.", capacity);
+        return NULL;
+    }
+
+    while (buckets < capacity) {
+        buckets <<= 1;
+    }
+
+    struct easeds_chmap *map = __easeds_malloc(sizeof(struct easeds_chmap));
+    if (unlikely(map == NULL)) {
+        EASEDS_ERR("[easeds_chmap_create]: Malloc map failed.");
+        return NULL;
+    }
+
+    memset(map, 0, sizeof(struct easeds_chmap));
+    map->name    = name;
+    map->flags   = flags;
+    map->stripes = __easeds_aligned_alloc(
+        EASEDS_CACHE_LINE_SIZE, EASEDS_CHMAP_STRIPES * sizeof(struct easeds_chmap_stripe));
+    map->readers = __easeds_aligned_alloc(
+        EASEDS_CACHE_LINE_SIZE, EASEDS_CHMAP_READERS * sizeof(struct easeds_chmap_reader));
+    map->table   = chmap_table_alloc(buckets);
+    if (unlikely(map->stripes == NULL || map->readers == NULL || map->table == NULL)) {
+        EASEDS_ERR("[easeds_chmap_create]: Malloc stripes, readers or table failed.");
+        __easeds_free(map->stripes);
+        __easeds_free(map->readers);
+        __easeds_free(map->table);
+        __easeds_free(map);
+        return NULL;
+    }
+
+    memset(map->stripes, 0, EASEDS_CHMAP_STRIPES * sizeof(struct easeds_chmap_stripe));
+    memset(map->readers, 0, EASEDS_CHMAP_READERS * sizeof(struct easeds_chmap_reader));
+    map->root = map->table;
+    pthread_mutex_init(&map->grace_lock, NULL);
+
+    PFL_DEBUG("[easeds_chmap_create]: name=%s, buckets=%lu, flags=0x%x.",
+        name != NULL ? name : "(null)", buckets, flags);
+    return map;
+}
+
+// 销毁并发哈希表, 释放所有节点, 值由用户管理, 调用时不能有其他线程访问
+void easeds_chmap_destroy(struct easeds_chmap *map)
+{
+    if (unlikely(map == NULL)) {
+        return;
+    }
+
+    /* 扩容中途销毁时, 旧表中未迁移的桶和新表各自持有不同的节点 */
+    struct easeds_chmap_table *table = map->root;
+    while (table != NULL) {
+        struct easeds_chmap_table *next = table->next;
+        for (uint64_t i = 0; i <= table->mask; i++) {
+            struct easeds_chmap_node *node = table->buckets[i];
+            if (node == CHMAP_MOVED) {
+                continue;
+            }
+            while (node != NULL) {
+                struct easeds_chmap_node *tmp = node->next;
+                __easeds_free(node);
+                node = tmp;
+            }
+        }
+        __easeds_free(table);
+        table = next;
+    }
+
+    for (uint32_t i = 0; i < EASEDS_CHMAP_STRIPES; i++) {
+        chmap_free_retired(map->stripes[i].retired);
+    }
+
+    pthread_mutex_destroy(&map->grace_lock);
+    __easeds_free(map->stripes);
+    __easeds_free(map->readers);
+    __easeds_free(map);
+}
+
+// 插入键值对, 键已存在时覆盖旧值, 成功返回0, 失败返回-1
+int32_t easeds_chmap_put(
+    struct easeds_chmap *map, const void *key, uint32_t key_len, void *value)
+{
+    if (unlikely(map == NULL || (key == NULL && key_len != 0))) {
+        EASEDS_ERR("[easeds_chmap_put]: Invalid map or key pointer.");
+        return -1;
+    }
+
+    int64_t                     start   = chmap_start_time(map);
+    uint64_t                    hash    = easeds_hash_bytes(key, key_len);
+    struct easeds_chmap_reader *reader  = chmap_reader(map);
+    struct easeds_chmap_stripe *stripe  = &map->stripes[hash & (EASEDS_CHMAP_STRIPES - 1)];
+    struct easeds_chmap_table  *old     = NULL;
+    struct easeds_chmap_node   *retired = NULL;
+    uint64_t                    grow    = UINT64_MAX;
+    int32_t                     ret     = -1;
+
+    /* 写操作也在读侧临界区内, 保证访问的表和节点在操作期间不会被释放 */
+    uint32_t phase = chmap_read_lock(map, reader);
+    old            = chmap_help_migrate(map);
+
+    chmap_lock(stripe);
+    struct easeds_chmap_table *table = chmap_locate(map, stripe, hash, &old);
+    if (likely(table != NULL)) {
+        ret = chmap_insert(table, stripe, hash, key, key_len, value, &grow);
+    }
+    retired = chmap_take_retired(stripe);
+    chmap_unlock(stripe);
+    chmap_read_unlock(reader, phase);
+
+    if (grow != UINT64_MAX) {
+        chmap_start_resize(map, grow);
+    }
+    chmap_write_finish(map, retired, old);
+
+    if (map->flags & EASEDS_CHMAP_LATENCY) {
+        chmap_record(reader, EASEDS_CHMAP_OP_PUT, start);
+    }
+    return ret;
+}
+
+// 无锁查找键对应的值, value 非空时返回找到的值, 成功返回0, 键不存在返回-1
+int32_t easeds_chmap_get(
+    struct easeds_chmap *map, const void *key, uint32_t key_len, void **value)
+{
+    if (unlikely(map == NULL || (key == NULL && key_len != 0))) {
+        EASEDS_ERR("[easeds_chmap_get]: Invalid map or key pointer.");
+        return -1;
+    }
+
+    int64_t                     start  = chmap_start_time(map);
+    uint64_t                    hash   = easeds_hash_bytes(key, key_len);
+    struct easeds_chmap_reader *reader = chmap_reader(map);
+    uint32_t                    phase  = chmap_read_lock(map, reader);
+    int32_t                     ret    = -1;
+
+    /* 从最旧的在用表开始, 桶已迁移时转到下一张表 */
+    struct easeds_chmap_table *table = __atomic_load_n(&map->root, __ATOMIC_ACQUIRE);
+    struct easeds_chmap_node  *node  = NULL;
+
+    node = __atomic_load_n(&table->buckets[hash & table->mask], __ATOMIC_ACQUIRE);
+    while (node == CHMAP_MOVED) {
+        table = __atomic_load_n(&table->next, __ATOMIC_ACQUIRE);
+        node  = __atomic_load_n(&table->buckets[hash & table->mask], __ATOMIC_ACQUIRE);
+    }
+
+    for (; node != NULL; node = __atomic_load_n(&node->next, __ATOMIC_ACQUIRE)) {
+        if (chmap_node_match(node, hash, key, key_len)) {
+            if (value != NULL) {
+                *value = __atomic_load_n(&node->value, __ATOMIC_ACQUIRE);
+            }
+            ret = 0;
+            break;
+        }
+    }
+
+    chmap_read_unlock(reader, phase);
+    if (map->flags & EASEDS_CHMAP_LATENCY) {
+        chmap_record(reader, EASEDS_CHMAP_OP_GET, start);
+    }
+    return ret;
+}
+
+// 删除键值对, value 非空时返回被删除的值, 成功返回0, 键不存在返回-1
+int32_t easeds_chmap_remove(
+    struct easeds_chmap *map, const void *key, uint32_t key_len, void **value)
+{
+    if (unlikely(map == NULL || (key == NULL && key_len != 0))) {
+        EASEDS_ERR("[easeds_chmap_remove]: Invalid map or key pointer.");
+        return -1;
+    }
+
+    int64_t                     start   = chmap_start_time(map);
+    uint64_t                    hash    = easeds_hash_bytes(key, key_len);
+    struct easeds_chmap_reader *reader  = chmap_reader(map);
+    struct easeds_chmap_stripe *stripe  = &map->stripes[hash & (EASEDS_CHMAP_STRIPES - 1)];
+    struct easeds_chmap_table  *old     = NULL;
+    struct easeds_chmap_node   *retired = NULL;
+    int32_t                     ret     = -1;
+
+    uint32_t phase = chmap_read_lock(map, reader);
+    old            = chmap_help_migrate(map);
+
+    chmap_lock(stripe);
+    struct easeds_chmap_table *table = chmap_locate(map, stripe, hash, &old);
+    if (likely(table != NULL)) {
+        ret = chmap_unlink(table, stripe, hash, key, key_len, value);
+    }
+    retired = chmap_take_retired(stripe);
+    chmap_unlock(stripe);
+    chmap_read_unlock(reader, phase);
+    chmap_write_finish(map, retired, old);
+
+    if (map->flags & EASEDS_CHMAP_LATENCY) {
+        chmap_record(reader, EASEDS_CHMAP_OP_REMOVE, start);
+    }
+    return ret;
+}
+
+// 获取键值对数量, 并发修改时为近似值
+uint64_t easeds_chmap_size(struct easeds_chmap *map)
+{
+    uint64_t size = 0;
+
+    if (unlikely(map == NULL)) {
+        return 0;
+    }
+
+    for (uint32_t i = 0; i < EASEDS_CHMAP_STRIPES; i++) {
+        size += __atomic_load_n(&map->stripes[i].size, __ATOMIC_RELAXED);
+    }
+    return size;
+}
+
+// 获取最新表的桶数量
+uint64_t easeds_chmap_buckets(struct easeds_chmap *map)
+{
+    if (unlikely(map == NULL)) {
+        return 0;
+    }
+
+    return __atomic_load_n(&map->table, __ATOMIC_ACQUIRE)->mask + 1;
+}
+
+// 等待一个宽限期, 释放所有待回收的节点, 返回释放的节点数量
+uint64_t easeds_chmap_reclaim(struct easeds_chmap *map)
+{
+    struct easeds_chmap_node *retired = NULL;
+
+    if (unlikely(map == NULL)) {
+        return 0;
+    }
+
+    /* 把各分段的待回收链表拼接到一起, 只等待一个宽限期 */
+    for (uint32_t i = 0; i < EASEDS_CHMAP_STRIPES; i++) {
+        struct easeds_chmap_stripe *stripe = &map->stripes[i];
+
+        chmap_lock(stripe);
+        struct easeds_chmap_node *node = stripe->retired;
+        if (node != NULL) {
+            while (node->retire != NULL) {
+                node = node->retire;
+            }
+            node->retire    = retired;
+            retired         = stripe->retired;
+            stripe->retired = NULL;
+            stripe->pending = 0;
+        }
+        chmap_unlock(stripe);
+    }
+
+    chmap_synchronize(map);
+    uint64_t count = chmap_free_retired(retired);
+    __atomic_add_fetch(&map->reclaimed, count, __ATOMIC_RELAXED);
+    return count;
+}
+
+// 获取统计信息, 延迟统计需要创建时指定 EASEDS_CHMAP_LATENCY
+void easeds_chmap_stats(struct easeds_chmap *map, struct easeds_chmap_stats *stats)
+{
+    if (unlikely(map == NULL || stats == NULL)) {
+        return;
+    }
+
+    memset(stats, 0, sizeof(struct easeds_chmap_stats));
+    for (uint32_t i = 0; i < EASEDS_CHMAP_READERS; i++) {
+        for (uint32_t op = 0; op < EASEDS_CHMAP_OPS; op++) {
+            struct easeds_chmap_latency *latency = &map->readers[i].ops[op];
+
+            uint64_t max = __atomic_load_n(&latency->max_ns, __ATOMIC_RELAXED);
+
+            stats->ops[op].count += __atomic_load_n(&latency->count, __ATOMIC_RELAXED);
+            stats->ops[op].total_ns += __atomic_load_n(&latency->total_ns, __ATOMIC_RELAXED);
+            stats->ops[op].max_ns = max > stats->ops[op].max_ns ? max : stats->ops[op].max_ns;
+        }
+    }
+
+    stats->resizes       = __atomic_load_n(&map->resizes, __ATOMIC_RELAXED);
+    stats->migrated      = __atomic_load_n(&map->moved_nodes, __ATOMIC_RELAXED);
+    stats->reclaimed     = __atomic_load_n(&map->reclaimed, __ATOMIC_RELAXED);
+    stats->grace_periods = __atomic_load_n(&map->grace_periods, __ATOMIC_RELAXED);
+}
+
+// 清零延迟统计, 并发操作期间清零可能丢失少量计数
+void easeds_chmap_reset_stats(struct easeds_chmap *map)
+{
+    if (unlikely(map == NULL)) {
+        return;
+    }
+
+    for (uint32_t i = 0; i < EASEDS_CHMAP_READERS; i++) {
+        for (uint32_t op = 0; op < EASEDS_CHMAP_OPS; op++) {
+            __atomic_store_n(&map->readers[i].ops[op].count, 0, __ATOMIC_RELAXED);
+            __atomic_store_n(&map->readers[i].ops[op].total_ns, 0, __ATOMIC_RELAXED);
+            __atomic_store_n(&map->readers[i].ops[op].max_ns, 0, __ATOMIC_RELAXED);
+        }
+    }
+}
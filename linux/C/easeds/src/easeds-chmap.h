@@ -0,0 +1,187 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-chmap.h
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-18 21:40
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  并发哈希表(Concurrent Hash Map), 查找无锁, 写操作使用分段自旋锁, 扩容按桶渐进迁移.
+ *
+ * @History:
+ *  2026年10月18日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#ifndef __EASEDS_CHMAP_H__
+#define __EASEDS_CHMAP_H__
+
+/* C 标准库头文件 */
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/* 项目内部头文件 */
+#include "easeds-environment.h"
+#include "easeds-public.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 写锁分段数量, 2 的幂, 桶数量不小于分段数量, 每个桶在任意大小的表中都属于同一个分段 */
+#define EASEDS_CHMAP_STRIPES 256
+
+/* 读者槽位数量, 2 的幂, 线程按首次访问顺序分配槽位, 超过后多个线程共享一个槽位 */
+#define EASEDS_CHMAP_READERS 64
+
+/* 创建标志 */
+#define EASEDS_CHMAP_LATENCY 0x1U /* 记录每次操作的耗时, 每次操作多两次取时间的开销 */
+
+/* 操作类型, 用于延迟统计 */
+enum easeds_chmap_op {
+    EASEDS_CHMAP_OP_GET    = 0, /* 查找 */
+    EASEDS_CHMAP_OP_PUT    = 1, /* 插入或覆盖 */
+    EASEDS_CHMAP_OP_REMOVE = 2, /* 删除 */
+    EASEDS_CHMAP_OPS       = 3, /* 操作类型数量 */
+};
+
+/* 单类操作的延迟统计 */
+struct easeds_chmap_latency {
+    uint64_t count;    /* 操作次数 */
+    uint64_t total_ns; /* 总耗时 */
+    uint64_t max_ns;   /* 最大耗时 */
+};
+
+/* 哈希表统计信息, 所有读者槽位之和 */
+struct easeds_chmap_stats {
+    struct easeds_chmap_latency ops[EASEDS_CHMAP_OPS]; /* 各类操作延迟, 需要 LATENCY 标志 */
+    uint64_t                    resizes;               /* 完成的扩容次数 */
+    uint64_t                    migrated;              /* 扩容迁移的节点数量 */
+    uint64_t                    reclaimed;             /* 宽限期后释放的节点数量 */
+    uint64_t                    grace_periods;         /* 等待读者退出的次数 */
+};
+
+/* 键值节点, 键直接存放在节点尾部, 发布后只有 value 和 next 会被修改 */
+struct easeds_chmap_node {
+    struct easeds_chmap_node *next;    /* 桶链表下一个节点 */
+    struct easeds_chmap_node *retire;  /* 待回收链表, 不影响读者遍历 next */
+    void                     *value;   /* 值, 原子读写 */
+    uint64_t                  hash;    /* 键的哈希值 */
+    uint32_t                  key_len; /* 键长度 */
+    uint32_t                  pad;     /* 对齐填充 */
+    uint8_t                   key[];   /* 键 */
+};
+
+/* 哈希表的桶数组, 扩容期间旧表的 next 指向新表, 已迁移的桶标记为 MOVED */
+struct easeds_chmap_table {
+    struct easeds_chmap_table *next;         /* 扩容目标表 */
+    uint64_t                   mask;         /* 桶数量减一, 桶数量为 2 的幂 */
+    uint64_t                   migrate_next; /* 迁移领取游标, 对桶数量取模 */
+    uint64_t                   migrated;     /* 已迁移的桶数量 */
+    struct easeds_chmap_node  *buckets[];    /* 桶链表头 */
+};
+
+/* 写锁分段, 独占一个缓存行 */
+struct easeds_chmap_stripe {
+    uint32_t                  lock;    /* 自旋锁 */
+    uint32_t                  pad0;    /* 对齐填充 */
+    uint64_t                  size;    /* 该分段的键数量 */
+    struct easeds_chmap_node *retired; /* 等待宽限期的节点 */
+    uint64_t                  pending; /* 等待宽限期的节点数量 */
+    uint8_t                   pad1[EASEDS_CACHE_LINE_SIZE - 32]; /* 缓存行填充 */
+};
+
+/* 读者槽位, 两个阶段的活跃读者计数和本槽位的延迟统计, 独占两个缓存行 */
+struct easeds_chmap_reader {
+    uint64_t                    active[2];             /* 两个阶段的活跃读者数量 */
+    struct easeds_chmap_latency ops[EASEDS_CHMAP_OPS]; /* 延迟统计 */
+    uint8_t                     pad[2 * EASEDS_CACHE_LINE_SIZE - 88]; /* 缓存行填充 */
+};
+
+/**
+ * 实现一个面向多线程共享缓存的并发哈希表, 替代"一个哈希表加一把全局锁"的用法.
+ *  (1) 查找不加锁: 从最旧的在用表开始, 遇到 MOVED 标记时转到新表, 沿链表原子地读取节点.
+ *  (2) 写操作按哈希值低位选择 EASEDS_CHMAP_STRIPES 个分段自旋锁之一, 不同分段的写操作完全并行.
+ *  (3) 扩容不停顿: 新表建立后, 每个写操作顺带迁移若干个旧桶, 访问到未迁移桶的写操作先迁移该桶.
+ *      迁移复制节点到新表, 旧链表保持不变, 正在遍历旧链表的读者不需要重试.
+ *  (4) 删除和迁移替换下来的节点在宽限期之后释放: 读者进入时在当前阶段的计数上加一,
+ *      回收者切换阶段并等待旧阶段计数归零, 之后没有读者还能引用这些节点.
+ *  (5) 开启 EASEDS_CHMAP_LATENCY 时按操作类型记录次数/总耗时/最大耗时, 统计数据放在读者槽位中,
+ *      各线程写自己的缓存行, 便于和加锁的基线实现做多线程对比.
+ *  (6) 值由用户管理, 覆盖和删除时旧值可能还在被其他线程的查找返回, 释放值需要用户自行同步.
+ */
+struct easeds_chmap {
+    const char                 *name;          /* 名称, 预留字段, 可用于调试和日志 */
+    struct easeds_chmap_table  *root;          /* 最旧的在用表, 查找从这里开始 */
+    struct easeds_chmap_table  *table;         /* 最新的表 */
+    struct easeds_chmap_stripe *stripes;       /* 写锁分段 */
+    struct easeds_chmap_reader *readers;       /* 读者槽位 */
+    uint64_t                    epoch;         /* 读者阶段, 最低位选择 active 计数 */
+    uint64_t                    resizes;       /* 完成的扩容次数 */
+    uint64_t                    moved_nodes;   /* 扩容迁移的节点数量 */
+    uint64_t                    reclaimed;     /* 宽限期后释放的节点数量 */
+    uint64_t                    grace_periods; /* 等待读者退出的次数 */
+    uint32_t                    resizing;      /* 是否有扩容正在进行 */
+    uint32_t                    flags;         /* 创建标志 */
+    pthread_mutex_t             grace_lock;    /* 串行化宽限期等待 */
+};
+
+/**
+ * 常见并发哈希表操作函数:
+ *
+ * 函数名                       功能描述
+ * ------------------------     ------------------------------------------------------
+ * easeds_chmap_create          创建并发哈希表, 指定预期容量和标志, 失败返回NULL
+ * easeds_chmap_destroy         销毁并发哈希表, 调用时不能有其他线程访问
+ * easeds_chmap_put             插入键值对, 键已存在时覆盖旧值, 成功返回0, 失败返回-1
+ * easeds_chmap_get             无锁查找键对应的值, 成功返回0, 键不存在返回-1
+ * easeds_chmap_remove          删除键值对, 成功返回0, 键不存在返回-1
+ * easeds_chmap_size            获取键值对数量, 并发修改时为近似值
+ * easeds_chmap_buckets         获取最新表的桶数量
+ * easeds_chmap_reclaim         等待一个宽限期, 释放所有待回收的节点
+ * easeds_chmap_stats           获取统计信息
+ * easeds_chmap_reset_stats     清零延迟统计
+ */
+
+// 创建并发哈希表, capacity 为预期键数量, flags 为 EASEDS_CHMAP_* 标志, 失败返回NULL
+struct easeds_chmap *easeds_chmap_create(const char *name, uint64_t capacity, uint32_t flags);
+
+// 销毁并发哈希表, 释放所有节点, 值由用户管理, 调用时不能有其他线程访问
+void easeds_chmap_destroy(struct easeds_chmap *map);
+
+// 插入键值对, 键已存在时覆盖旧值, 成功返回0, 失败返回-1
+int32_t easeds_chmap_put(
+    struct easeds_chmap *map, const void *key, uint32_t key_len, void *value);
+
+// 无锁查找键对应的值, value 非空时返回找到的值, 成功返回0, 键不存在返回-1
+int32_t easeds_chmap_get(
+    struct easeds_chmap *map, const void *key, uint32_t key_len, void **value);
+
+// 删除键值对, value 非空时返回被删除的值, 成功返回0, 键不存在返回-1
+int32_t easeds_chmap_remove(
+    struct easeds_chmap *map, const void *key, uint32_t key_len, void **value);
+
+// 获取键值对数量, 并发修改时为近似值
+uint64_t easeds_chmap_size(struct easeds_chmap *map);
+
+// 获取最新表的桶数量
+uint64_t easeds_chmap_buckets(struct easeds_chmap *map);
+
+// 等待一个宽限期, 释放所有待回收的节点, 返回释放的节点数量
+uint64_t easeds_chmap_reclaim(struct easeds_chmap *map);
+
+// 获取统计信息, 延迟统计需要创建时指定 EASEDS_CHMAP_LATENCY
+void easeds_chmap_stats(struct easeds_chmap *map, struct easeds_chmap_stats *stats);
+
+// 清零延迟统计, 并发操作期间清零可能丢失少量计数
+void easeds_chmap_reset_stats(struct easeds_chmap *map);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __EASEDS_CHMAP_H__ */
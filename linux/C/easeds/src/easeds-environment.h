@@ -66,8 +66,12 @@ typedef struct easeds_empty {
 
 /* 运行环境层抽象定义 */
 /* ## 运算符, 这是 GCC 扩展的语法. ISO C标准中应该使用 __VA_OPT__(,) 代替 */
-#define __easeds_malloc malloc
-#define __easeds_free   free
+#define __easeds_malloc        malloc
+#define __easeds_free          free
+#define __easeds_aligned_alloc aligned_alloc /* size 必须是 alignment 的整数倍 */
+
+/* CPU 缓存行大小, 用于数据结构按缓存行对齐和填充 */
+#define EASEDS_CACHE_LINE_SIZE 64
 
 /* 类型转化和定义 */
 #define EASEDS_TYPE(x)         __typeof__(x)
@@ -0,0 +1,553 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-flatset-unittest.c
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-19 00:25
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  Easeds 有序平铺集合单元测试实现文件, 包含了插入/查找/批量构建/集合运算/倍增查找和性能测试.
+ *
+ * @History:
+ *  2026年10月19日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#include "easeds-unittest.h"
+
+// 项目内部头文件
+#include "easeds-flatset.h"
+#include "easeds-utils.h"
+
+// 结构体元素, 只按 key 比较, value 用于区分相等元素的来源
+struct flatset_pair {
+    uint32_t key;
+    uint32_t value;
+};
+
+// 结构体元素比较函数
+static int32_t flatset_pair_cmp(const void *a, const void *b)
+{
+    uint32_t x = ((const struct flatset_pair *)a)->key;
+    uint32_t y = ((const struct flatset_pair *)b)->key;
+    return (x > y) - (x < y);
+}
+
+// xorshift 伪随机数
+static uint64_t flatset_rand(uint64_t *seed)
+{
+    *seed ^= *seed << 13;
+    *seed ^= *seed >> 7;
+    *seed ^= *seed << 17;
+    return *seed;
+}
+
+// 获取 uint32_t 集合第 index 个元素, 失败返回 UINT32_MAX
+static uint32_t flatset_value(struct easeds_flatset *set, uint32_t index)
+{
+    uint32_t *pvalue = NULL;
+    if (easeds_flatset_get(set, index, (void **)&pvalue) != 0 || pvalue == NULL) {
+        return UINT32_MAX;
+    }
+    return *pvalue;
+}
+
+// 用 [0, domain) 内的 count 个随机值构建集合, 同时在 mark 中标记存在的值
+static void flatset_fill_random(struct easeds_flatset *set, uint8_t *mark, uint32_t domain,
+    uint32_t count, uint64_t *seed)
+{
+    uint32_t *values = malloc((size_t)count * sizeof(uint32_t) + 1);
+    assert_non_null(values);
+    memset(mark, 0, domain);
+    for (uint32_t i = 0; i < count; i++) {
+        values[i]       = (uint32_t)(flatset_rand(seed) % domain);
+        mark[values[i]] = 1;
+    }
+    assert_int_equal(easeds_flatset_build(set, values, count), 0);
+    free(values);
+}
+
+// 校验 uint32_t 集合恰好包含 mark 中标记的值, 并且升序不重复
+static void flatset_check_mark(struct easeds_flatset *set, const uint8_t *mark, uint32_t domain)
+{
+    uint32_t index = 0;
+    assert_int_equal(easeds_flatset_verify(set), 0);
+    for (uint32_t v = 0; v < domain; v++) {
+        if (mark[v]) {
+            assert_int_equal(flatset_value(set, index), v);
+            index++;
+        }
+    }
+    assert_int_equal(easeds_flatset_size(set), index);
+}
+
+// 用 mark_a 和 mark_b 校验 dst 的交集/并集/差集结果
+static void flatset_check_ops(struct easeds_flatset *dst, struct easeds_flatset *a,
+    struct easeds_flatset *b, const uint8_t *mark_a, const uint8_t *mark_b, uint32_t domain)
+{
+    uint8_t *expect = malloc(domain);
+    assert_non_null(expect);
+
+    assert_int_equal(easeds_flatset_intersect(dst, a, b), 0);
+    for (uint32_t v = 0; v < domain; v++) {
+        expect[v] = mark_a[v] & mark_b[v];
+    }
+    flatset_check_mark(dst, expect, domain);
+
+    /* 交集与参数顺序无关 */
+    assert_int_equal(easeds_flatset_intersect(dst, b, a), 0);
+    flatset_check_mark(dst, expect, domain);
+
+    assert_int_equal(easeds_flatset_union(dst, a, b), 0);
+    for (uint32_t v = 0; v < domain; v++) {
+        expect[v] = mark_a[v] | mark_b[v];
+    }
+    flatset_check_mark(dst, expect, domain);
+
+    assert_int_equal(easeds_flatset_difference(dst, a, b), 0);
+    for (uint32_t v = 0; v < domain; v++) {
+        expect[v] = mark_a[v] & !mark_b[v];
+    }
+    flatset_check_mark(dst, expect, domain);
+
+    assert_int_equal(easeds_flatset_difference(dst, b, a), 0);
+    for (uint32_t v = 0; v < domain; v++) {
+        expect[v] = mark_b[v] & !mark_a[v];
+    }
+    flatset_check_mark(dst, expect, domain);
+
+    free(expect);
+}
+
+// 基本功能测试: 创建/插入/查找/删除/销毁
+static void test_easeds_flatset_basic(void **state)
+{
+    easeds_unused(state);
+
+    struct easeds_flatset *set = easeds_flatset_create("basic", sizeof(uint32_t), NULL, 4);
+    assert_non_null(set);
+    assert_true(set->flags & EASEDS_FLATSET_F_U32);
+    assert_int_equal(easeds_flatset_size(set), 0);
+    assert_true(easeds_flatset_is_empty(set));
+
+    /* 乱序插入, 重复元素只保存一份 */
+    const uint32_t values[] = {50, 10, 40, 10, 30, 20, 50, 60, 0};
+    for (uint32_t i = 0; i < sizeof(values) / sizeof(values[0]); i++) {
+        assert_int_equal(easeds_flatset_insert(set, &values[i]), 0);
+    }
+    assert_int_equal(easeds_flatset_size(set), 7);
+    assert_int_equal(easeds_flatset_verify(set), 0);
+    for (uint32_t i = 0; i < 7; i++) {
+        assert_int_equal(flatset_value(set, i), i * 10);
+    }
+
+    uint32_t  key    = 30;
+    uint32_t *pvalue = NULL;
+    assert_true(easeds_flatset_contains(set, &key));
+    assert_int_equal(easeds_flatset_find(set, &key, (void **)&pvalue), 0);
+    assert_int_equal(*pvalue, 30);
+    assert_int_equal(easeds_flatset_lower_bound(set, &key), 3);
+    key = 35;
+    assert_false(easeds_flatset_contains(set, &key));
+    assert_int_equal(easeds_flatset_find(set, &key, (void **)&pvalue), -1);
+    assert_int_equal(easeds_flatset_lower_bound(set, &key), 4);
+
+    key = 30;
+    assert_int_equal(easeds_flatset_remove(set, &key), 0);
+    assert_false(easeds_flatset_contains(set, &key));
+    assert_int_equal(easeds_flatset_size(set), 6);
+    assert_int_equal(flatset_value(set, 3), 40);
+    assert_int_equal(easeds_flatset_verify(set), 0);
+
+    easeds_flatset_clear(set);
+    assert_true(easeds_flatset_is_empty(set));
+    easeds_flatset_destroy(set);
+}
+
+// 基本功能测试: 批量构建和集合运算, 覆盖 uint32_t/uint64_t/结构体三种元素, 归并和倍增两种路径
+static void test_easeds_flatset_operations(void **state)
+{
+    easeds_unused(state);
+
+    const uint32_t domain = 1 << 16;
+    uint64_t       seed   = 88172645463325252ULL;
+    uint8_t       *mark_a = malloc(domain);
+    uint8_t       *mark_b = malloc(domain);
+    assert_non_null(mark_a);
+    assert_non_null(mark_b);
+
+    struct easeds_flatset *a   = easeds_flatset_create("a", sizeof(uint32_t), NULL, 0);
+    struct easeds_flatset *b   = easeds_flatset_create("b", sizeof(uint32_t), NULL, 0);
+    struct easeds_flatset *dst = easeds_flatset_create("dst", sizeof(uint32_t), NULL, 0);
+    assert_non_null(a);
+    assert_non_null(b);
+    assert_non_null(dst);
+
+    /* 大小相近(线性归并/SIMD), 大小悬殊(倍增查找), 以及非 4 倍数的尾部元素 */
+    const uint32_t sizes[][2] = {{20000, 20000}, {30000, 3000}, {50, 40000}, {7, 30001}};
+    for (uint32_t r = 0; r < sizeof(sizes) / sizeof(sizes[0]); r++) {
+        flatset_fill_random(a, mark_a, domain, sizes[r][0], &seed);
+        flatset_fill_random(b, mark_b, domain, sizes[r][1], &seed);
+        flatset_check_mark(a, mark_a, domain);
+        flatset_check_mark(b, mark_b, domain);
+        flatset_check_ops(dst, a, b, mark_a, mark_b, domain);
+    }
+    easeds_flatset_destroy(a);
+    easeds_flatset_destroy(b);
+    easeds_flatset_destroy(dst);
+
+    /* uint64_t 元素走通用路径, 高 32 位相同, 比较必须使用完整的 64 位 */
+    struct easeds_flatset *a64 = easeds_flatset_create("a64", sizeof(uint64_t), NULL, 0);
+    struct easeds_flatset *b64 = easeds_flatset_create("b64", sizeof(uint64_t), NULL, 0);
+    struct easeds_flatset *d64 = easeds_flatset_create("d64", sizeof(uint64_t), NULL, 0);
+    assert_non_null(a64);
+    assert_non_null(b64);
+    assert_non_null(d64);
+    assert_true(a64->flags & EASEDS_FLATSET_F_U64);
+    for (uint64_t v = 0; v < 3000; v++) {
+        uint64_t x = (1ULL << 40) | (v * 2);
+        uint64_t y = (1ULL << 40) | (v * 3);
+        assert_int_equal(easeds_flatset_insert(a64, &x), 0);
+        if (v < 100) {
+            assert_int_equal(easeds_flatset_insert(b64, &y), 0);
+        }
+    }
+    assert_int_equal(easeds_flatset_intersect(d64, a64, b64), 0);
+    assert_int_equal(easeds_flatset_size(d64), 50); /* 0, 6, 12 ... 294 */
+    assert_int_equal(easeds_flatset_union(d64, a64, b64), 0);
+    assert_int_equal(easeds_flatset_size(d64), 3050);
+    assert_int_equal(easeds_flatset_verify(d64), 0);
+    assert_int_equal(easeds_flatset_difference(d64, b64, a64), 0);
+    assert_int_equal(easeds_flatset_size(d64), 50);
+    easeds_flatset_destroy(a64);
+    easeds_flatset_destroy(b64);
+    easeds_flatset_destroy(d64);
+
+    free(mark_a);
+    free(mark_b);
+}
+
+// 边界测试: 空集合/单个元素/极值/SIMD 分块尾部
+static void test_easeds_flatset_boundary(void **state)
+{
+    easeds_unused(state);
+
+    struct easeds_flatset *a   = easeds_flatset_create("a", sizeof(uint32_t), NULL, 1);
+    struct easeds_flatset *b   = easeds_flatset_create("b", sizeof(uint32_t), NULL, 1);
+    struct easeds_flatset *dst = easeds_flatset_create("dst", sizeof(uint32_t), NULL, 1);
+    assert_non_null(a);
+    assert_non_null(b);
+    assert_non_null(dst);
+
+    /* 空集合参与运算 */
+    assert_int_equal(easeds_flatset_build(a, NULL, 0), 0);
+    assert_int_equal(easeds_flatset_intersect(dst, a, b), 0);
+    assert_int_equal(easeds_flatset_size(dst), 0);
+    assert_int_equal(easeds_flatset_union(dst, a, b), 0);
+    assert_int_equal(easeds_flatset_size(dst), 0);
+    uint32_t key = 0;
+    assert_int_equal(easeds_flatset_lower_bound(a, &key), 0);
+    assert_int_equal(easeds_flatset_remove(a, &key), -1);
+
+    /* 极值: 0 和 UINT32_MAX, 基数排序需要处理最高字节 */
+    const uint32_t extremes[] = {UINT32_MAX, 0, 0x80000000U, UINT32_MAX, 1, 0xFF000000U};
+    assert_int_equal(easeds_flatset_build(a, extremes, 6), 0);
+    assert_int_equal(easeds_flatset_size(a), 5);
+    assert_int_equal(flatset_value(a, 0), 0);
+    assert_int_equal(flatset_value(a, 1), 1);
+    assert_int_equal(flatset_value(a, 2), 0x80000000U);
+    assert_int_equal(flatset_value(a, 3), 0xFF000000U);
+    assert_int_equal(flatset_value(a, 4), UINT32_MAX);
+    key = UINT32_MAX;
+    assert_int_equal(easeds_flatset_lower_bound(a, &key), 4);
+
+    /* 所有元素只有最低字节不同, 基数排序跳过高位的三轮 */
+    uint32_t small[300];
+    for (uint32_t i = 0; i < 300; i++) {
+        small[i] = (i * 7) % 256;
+    }
+    assert_int_equal(easeds_flatset_build(b, small, 300), 0);
+    assert_int_equal(easeds_flatset_size(b), 256);
+    assert_int_equal(easeds_flatset_verify(b), 0);
+
+    /* 大小从 0 到 12 的两两组合, 覆盖 SIMD 分块和标量尾部的衔接 */
+    uint8_t mark_a[64], mark_b[64];
+    for (uint32_t na = 0; na <= 12; na++) {
+        for (uint32_t nb = 0; nb <= 12; nb++) {
+            uint32_t va[12], vb[12];
+            memset(mark_a, 0, sizeof(mark_a));
+            memset(mark_b, 0, sizeof(mark_b));
+            for (uint32_t i = 0; i < na; i++) {
+                va[i]         = i * 3 + (nb & 1);
+                mark_a[va[i]] = 1;
+            }
+            for (uint32_t i = 0; i < nb; i++) {
+                vb[i]         = i * 2 + (na & 1);
+                mark_b[vb[i]] = 1;
+            }
+            assert_int_equal(easeds_flatset_build(a, va, na), 0);
+            assert_int_equal(easeds_flatset_build(b, vb, nb), 0);
+            flatset_check_ops(dst, a, b, mark_a, mark_b, 64);
+        }
+    }
+
+    /* 单个元素在大集合两端和中间做倍增查找 */
+    assert_int_equal(easeds_flatset_build(a, NULL, 0), 0);
+    for (uint32_t v = 0; v < 1000; v++) {
+        uint32_t x = v * 2;
+        assert_int_equal(easeds_flatset_insert(a, &x), 0);
+    }
+    const uint32_t probes[] = {0, 1, 998, 1998, 1999};
+    for (uint32_t p = 0; p < 5; p++) {
+        assert_int_equal(easeds_flatset_build(b, &probes[p], 1), 0);
+        assert_int_equal(easeds_flatset_intersect(dst, a, b), 0);
+        assert_int_equal(easeds_flatset_size(dst), (probes[p] & 1) ? 0 : 1);
+        assert_int_equal(easeds_flatset_difference(dst, a, b), 0);
+        assert_int_equal(easeds_flatset_size(dst), (probes[p] & 1) ? 1000 : 999);
+        assert_int_equal(easeds_flatset_union(dst, b, a), 0);
+        assert_int_equal(easeds_flatset_size(dst), (probes[p] & 1) ? 1001 : 1000);
+        assert_int_equal(easeds_flatset_verify(dst), 0);
+    }
+
+    easeds_flatset_destroy(a);
+    easeds_flatset_destroy(b);
+    easeds_flatset_destroy(dst);
+}
+
+// 异常测试: 非法参数/目标集合与源集合相同/元素类型不一致/结构体元素覆盖
+static void test_easeds_flatset_error(void **state)
+{
+    easeds_unused(state);
+
+    assert_null(easeds_flatset_create("bad", 3, NULL, 0));
+    assert_null(easeds_flatset_create("bad", 0, flatset_pair_cmp, 0));
+
+    struct easeds_flatset *a = easeds_flatset_create("a", sizeof(uint32_t), NULL, 0);
+    struct easeds_flatset *b = easeds_flatset_create("b", sizeof(uint32_t), NULL, 0);
+    struct easeds_flatset *p =
+        easeds_flatset_create("p", sizeof(struct flatset_pair), flatset_pair_cmp, 0);
+    struct easeds_flatset *q =
+        easeds_flatset_create("q", sizeof(struct flatset_pair), flatset_pair_cmp, 0);
+    struct easeds_flatset *r =
+        easeds_flatset_create("r", sizeof(struct flatset_pair), flatset_pair_cmp, 0);
+    assert_non_null(a);
+    assert_non_null(b);
+    assert_non_null(p);
+    assert_non_null(q);
+    assert_non_null(r);
+
+    uint32_t key = 1;
+    void    *elem;
+    assert_int_equal(easeds_flatset_insert(NULL, &key), -1);
+    assert_int_equal(easeds_flatset_insert(a, NULL), -1);
+    assert_int_equal(easeds_flatset_remove(a, &key), -1);
+    assert_int_equal(easeds_flatset_find(a, &key, &elem), -1);
+    assert_int_equal(easeds_flatset_get(a, 0, &elem), -1);
+    assert_int_equal(easeds_flatset_build(a, NULL, 1), -1);
+    assert_false(easeds_flatset_contains(NULL, &key));
+    assert_int_equal(easeds_flatset_size(NULL), 0);
+
+    /* 目标集合不能是源集合, 元素类型必须一致, 失败时 dst 保持不变 */
+    assert_int_equal(easeds_flatset_insert(a, &key), 0);
+    assert_int_equal(easeds_flatset_intersect(a, a, b), -1);
+    assert_int_equal(easeds_flatset_union(b, a, b), -1);
+    assert_int_equal(easeds_flatset_difference(NULL, a, b), -1);
+    assert_int_equal(easeds_flatset_intersect(p, a, b), -1);
+    assert_int_equal(easeds_flatset_union(b, a, p), -1);
+    assert_int_equal(easeds_flatset_size(a), 1);
+
+    /* 结构体元素: 键相同时插入覆盖旧值 */
+    struct flatset_pair pair = {.key = 5, .value = 1};
+    assert_int_equal(easeds_flatset_insert(p, &pair), 0);
+    pair.value = 2;
+    assert_int_equal(easeds_flatset_insert(p, &pair), 0);
+    assert_int_equal(easeds_flatset_size(p), 1);
+    assert_int_equal(easeds_flatset_find(p, &pair, &elem), 0);
+    assert_int_equal(((struct flatset_pair *)elem)->value, 2);
+
+    /* 结构体元素: 重建时重复键保留输入中最后出现的一个, 与依次插入的结果一致 */
+    struct flatset_pair dups[1000];
+    for (uint32_t i = 0; i < 1000; i++) {
+        dups[i].key   = (i * 37) % 100;
+        dups[i].value = i;
+    }
+    assert_int_equal(easeds_flatset_build(p, dups, 1000), 0);
+    assert_int_equal(easeds_flatset_size(p), 100);
+    assert_int_equal(easeds_flatset_verify(p), 0);
+    for (uint32_t i = 0; i < 100; i++) {
+        assert_int_equal(easeds_flatset_get(p, i, &elem), 0);
+        assert_int_equal(((struct flatset_pair *)elem)->key, i);
+        assert_true(((struct flatset_pair *)elem)->value >= 900);
+        assert_int_equal((((struct flatset_pair *)elem)->value * 37) % 100, i);
+    }
+
+    /* 通用路径的集合运算: 键相等时结果元素取自第一个集合, 覆盖归并和倍增两种路径 */
+    for (uint32_t round = 0; round < 2; round++) {
+        uint32_t count = round == 0 ? 100 : 5000;
+        easeds_flatset_clear(p);
+        easeds_flatset_clear(q);
+        for (uint32_t k = 0; k < count; k++) {
+            struct flatset_pair pa = {.key = k * 2, .value = 100};
+            struct flatset_pair pb = {.key = k * 3, .value = 200};
+            assert_int_equal(easeds_flatset_insert(p, &pa), 0);
+            if (round == 0 || k < 50) {
+                assert_int_equal(easeds_flatset_insert(q, &pb), 0);
+            }
+        }
+        uint32_t nq = easeds_flatset_size(q);
+
+        assert_int_equal(easeds_flatset_intersect(r, p, q), 0);
+        assert_int_equal(easeds_flatset_verify(r), 0);
+        for (uint32_t i = 0; i < easeds_flatset_size(r); i++) {
+            assert_int_equal(easeds_flatset_get(r, i, &elem), 0);
+            assert_int_equal(((struct flatset_pair *)elem)->key % 6, 0);
+            assert_int_equal(((struct flatset_pair *)elem)->value, 100);
+        }
+        uint32_t common = 0;
+        for (uint32_t k = 0; k < nq; k++) {
+            common += (k * 3) % 2 == 0 && (k * 3) / 2 < count;
+        }
+        assert_int_equal(easeds_flatset_size(r), common);
+
+        assert_int_equal(easeds_flatset_intersect(r, q, p), 0);
+        assert_int_equal(easeds_flatset_size(r), common);
+        assert_int_equal(easeds_flatset_get(r, 0, &elem), 0);
+        assert_int_equal(((struct flatset_pair *)elem)->value, 200);
+
+        assert_int_equal(easeds_flatset_union(r, q, p), 0);
+        assert_int_equal(easeds_flatset_verify(r), 0);
+        assert_int_equal(easeds_flatset_size(r), count + nq - common);
+        for (uint32_t i = 0; i < easeds_flatset_size(r); i++) {
+            assert_int_equal(easeds_flatset_get(r, i, &elem), 0);
+            struct flatset_pair *pr = elem;
+            assert_int_equal(pr->value, pr->key % 3 == 0 && pr->key / 3 < nq ? 200 : 100);
+        }
+
+        assert_int_equal(easeds_flatset_difference(r, p, q), 0);
+        assert_int_equal(easeds_flatset_size(r), count - common);
+        assert_int_equal(easeds_flatset_difference(r, q, p), 0);
+        assert_int_equal(easeds_flatset_size(r), nq - common);
+        assert_int_equal(easeds_flatset_verify(r), 0);
+    }
+
+    easeds_flatset_destroy(a);
+    easeds_flatset_destroy(b);
+    easeds_flatset_destroy(p);
+    easeds_flatset_destroy(q);
+    easeds_flatset_destroy(r);
+    easeds_flatset_destroy(NULL);
+}
+
+// 标量归并求交集, 作为性能对比基准
+static uint32_t flatset_scalar_intersect(
+    const uint32_t *a, uint32_t na, const uint32_t *b, uint32_t nb, uint32_t *out)
+{
+    uint32_t i = 0, j = 0, count = 0;
+    while (i < na && j < nb) {
+        if (a[i] < b[j]) {
+            i++;
+        } else if (a[i] > b[j]) {
+            j++;
+        } else {
+            out[count++] = a[i];
+            i++;
+            j++;
+        }
+    }
+    return count;
+}
+
+// 性能测试: 批量构建, 大小相近和大小悬殊两种情况下的交集
+static void test_easeds_flatset_perf(void **state)
+{
+    easeds_unused(state);
+
+    const uint32_t count  = 1000000;
+    const uint32_t rounds = 20;
+    uint64_t       seed   = 88172645463325252ULL;
+    uint32_t      *values = malloc((size_t)count * sizeof(uint32_t));
+    uint32_t      *out    = malloc((size_t)count * sizeof(uint32_t));
+    assert_non_null(values);
+    assert_non_null(out);
+
+    struct easeds_flatset *a     = easeds_flatset_create("a", sizeof(uint32_t), NULL, 0);
+    struct easeds_flatset *b     = easeds_flatset_create("b", sizeof(uint32_t), NULL, 0);
+    struct easeds_flatset *small = easeds_flatset_create("small", sizeof(uint32_t), NULL, 0);
+    struct easeds_flatset *dst   = easeds_flatset_create("dst", sizeof(uint32_t), NULL, 0);
+    assert_non_null(a);
+    assert_non_null(b);
+    assert_non_null(small);
+    assert_non_null(dst);
+
+    /* 批量构建: 值域为 4 倍元素数量, 两个集合大约有 1/4 的元素相同 */
+    int64_t start = easeds_get_current_time_ns();
+    for (uint32_t i = 0; i < count; i++) {
+        values[i] = (uint32_t)(flatset_rand(&seed) % (count * 4));
+    }
+    assert_int_equal(easeds_flatset_build(a, values, count), 0);
+    double build_ms = (double)(easeds_get_current_time_ns() - start) / 1e6;
+    for (uint32_t i = 0; i < count; i++) {
+        values[i] = (uint32_t)(flatset_rand(&seed) % (count * 4));
+    }
+    assert_int_equal(easeds_flatset_build(b, values, count), 0);
+    assert_int_equal(easeds_flatset_build(small, values, 1000), 0);
+
+    const uint32_t na = easeds_flatset_size(a), nb = easeds_flatset_size(b);
+    const uint32_t ns = easeds_flatset_size(small);
+
+    /* 大小相近: SIMD 分块比较与标量归并对比 */
+    start = easeds_get_current_time_ns();
+    for (uint32_t r = 0; r < rounds; r++) {
+        assert_int_equal(easeds_flatset_intersect(dst, a, b), 0);
+    }
+    double simd_ms = (double)(easeds_get_current_time_ns() - start) / 1e6 / rounds;
+
+    uint32_t scalar_count = 0;
+    start                 = easeds_get_current_time_ns();
+    for (uint32_t r = 0; r < rounds; r++) {
+        scalar_count = flatset_scalar_intersect(
+            a->array->elements, na, b->array->elements, nb, out);
+    }
+    double scalar_ms = (double)(easeds_get_current_time_ns() - start) / 1e6 / rounds;
+    assert_int_equal(easeds_flatset_size(dst), scalar_count);
+    assert_memory_equal(dst->array->elements, out, (size_t)scalar_count * sizeof(uint32_t));
+
+    /* 大小悬殊: 倍增查找与标量归并对比 */
+    start = easeds_get_current_time_ns();
+    for (uint32_t r = 0; r < rounds; r++) {
+        assert_int_equal(easeds_flatset_intersect(dst, small, a), 0);
+    }
+    double gallop_us = (double)(easeds_get_current_time_ns() - start) / 1e3 / rounds;
+
+    start = easeds_get_current_time_ns();
+    for (uint32_t r = 0; r < rounds; r++) {
+        scalar_count = flatset_scalar_intersect(
+            small->array->elements, ns, a->array->elements, na, out);
+    }
+    double merge_us = (double)(easeds_get_current_time_ns() - start) / 1e3 / rounds;
+    assert_int_equal(easeds_flatset_size(dst), scalar_count);
+
+    MEASURE("[flatset perf]: build %u random keys %.1f ms; intersect %u x %u: %.2f ms, "
+            "scalar merge %.2f ms; intersect %u x %u: gallop %.1f us, scalar merge %.1f us.",
+        count, build_ms, na, nb, simd_ms, scalar_ms, ns, na, gallop_us, merge_us);
+
+    easeds_flatset_destroy(a);
+    easeds_flatset_destroy(b);
+    easeds_flatset_destroy(small);
+    easeds_flatset_destroy(dst);
+    free(values);
+    free(out);
+}
+
+// 注册单元测试用例
+EASEDS_UNITTEST_REGISTER(easeds_unittest_flatset){
+    cmocka_unit_test(test_easeds_flatset_basic),
+    cmocka_unit_test(test_easeds_flatset_operations),
+    cmocka_unit_test(test_easeds_flatset_boundary),
+    cmocka_unit_test(test_easeds_flatset_error),
+    cmocka_unit_test(test_easeds_flatset_perf),
+    easeds_unit_test_end,
+};
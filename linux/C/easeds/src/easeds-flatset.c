@@ -0,0 +1,935 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-flatset.c
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-19 00:25
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  有序平铺集合实现, 集合运算按大小比例选择线性归并或倍增查找, uint32_t 集合交集使用 SSE2.
+ *
+ * @History:
+ *  2026年10月19日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#include "easeds-flatset.h"
+
+// 标准库头文件
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+// 项目内部头文件
+#include "easeds-log.h"
+
+// 两个集合大小相差超过该倍数时, 集合运算对大集合使用倍增查找, 否则线性归并
+#define FLATSET_GALLOP_RATIO 32
+
+// uint32_t 无符号整数比较函数
+static int32_t flatset_cmp_u32(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
+
+// uint64_t 无符号整数比较函数
+static int32_t flatset_cmp_u64(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a;
+    uint64_t y = *(const uint64_t *)b;
+    return (x > y) - (x < y);
+}
+
+// 获取指定下标的元素地址
+static inline void *flatset_elem(const struct easeds_flatset *set, uint32_t index)
+{
+    return (uint8_t *)set->array->elements + (size_t)index * set->array->element_size;
+}
+
+// 获取 uint32_t 集合的元素数组
+static inline uint32_t *flatset_u32(const struct easeds_flatset *set)
+{
+    return (uint32_t *)set->array->elements;
+}
+
+// 确保数组容量不少于 need 个元素, 按2倍扩容, 成功返回0, 失败返回-1
+static int32_t flatset_reserve(struct easeds_flatset *set, uint32_t need)
+{
+    uint32_t capacity = set->array->capacity;
+    if (need <= capacity) {
+        return 0;
+    }
+
+    while (capacity < need) {
+        capacity = capacity > UINT32_MAX / 2 ? need : capacity * 2;
+    }
+    return easeds_array_resize(set->array, capacity);
+}
+
+// 在 [lo, hi) 范围内二分查找第一个不小于 key 的元素下标
+static uint32_t flatset_search(
+    const struct easeds_flatset *set, uint32_t lo, uint32_t hi, const void *key)
+{
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        if (set->compare(flatset_elem(set, mid), key) < 0) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+// 在 [lo, hi) 范围内二分查找第一个不小于 key 的 uint32_t 元素下标
+static inline uint32_t flatset_search_u32(
+    const uint32_t *keys, uint32_t lo, uint32_t hi, uint32_t key)
+{
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        if (keys[mid] < key) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+/**
+ * 倍增查找: 从 lo 开始以 1, 2, 4... 的步长向后跳跃, 越过 key 后在最后一段内二分查找,
+ * 返回 [lo, hi) 中第一个不小于 key 的下标. 目标距离 lo 为 d 时复杂度为 O(log d),
+ * 小集合的元素依次在大集合中查找时, 每次都从上一次的结果开始, 总复杂度 O(m log(n/m)).
+ */
+static uint32_t flatset_gallop(
+    const struct easeds_flatset *set, uint32_t lo, uint32_t hi, const void *key)
+{
+    uint32_t step = 1, base = lo;
+    while (lo < hi && set->compare(flatset_elem(set, lo), key) < 0) {
+        base = lo + 1;
+        lo   = hi - lo > step ? lo + step : hi;
+        step <<= 1;
+    }
+    return flatset_search(set, base, lo, key);
+}
+
+// uint32_t 版本的倍增查找
+static inline uint32_t flatset_gallop_u32(
+    const uint32_t *keys, uint32_t lo, uint32_t hi, uint32_t key)
+{
+    uint32_t step = 1, base = lo;
+    while (lo < hi && keys[lo] < key) {
+        base = lo + 1;
+        lo   = hi - lo > step ? lo + step : hi;
+        step <<= 1;
+    }
+    return flatset_search_u32(keys, base, lo, key);
+}
+
+// 判断两个集合的大小是否相差悬殊, small 远小于 large 时返回true
+static inline bool flatset_skewed(uint32_t small, uint32_t large)
+{
+    return (uint64_t)small * FLATSET_GALLOP_RATIO < large;
+}
+
+// 查找与 key 相等的元素下标, 不存在时返回 UINT32_MAX
+static uint32_t flatset_index_of(const struct easeds_flatset *set, const void *key)
+{
+    uint32_t size = set->array->size;
+    uint32_t index;
+
+    if (set->flags & EASEDS_FLATSET_F_U32) {
+        uint32_t value = *(const uint32_t *)key;
+        index          = flatset_search_u32(flatset_u32(set), 0, size, value);
+        return index < size && flatset_u32(set)[index] == value ? index : UINT32_MAX;
+    }
+
+    index = flatset_search(set, 0, size, key);
+    if (index < size && set->compare(flatset_elem(set, index), key) == 0) {
+        return index;
+    }
+    return UINT32_MAX;
+}
+
+/**
+ * uint32_t 集合线性归并求交集, 结果写入 out, 返回结果元素数量.
+ * 支持 SSE2 时每次取 a 和 b 各 4 个元素, b 循环移位 3 次, 4 次比较得到 a 中命中元素的掩码,
+ * 再根据两组元素的最大值决定前进哪一组, 集合内元素不重复, 因此每个命中元素只会输出一次.
+ * 剩余不足 4 个的元素使用标量归并, 相等时同时前进, 否则只前进较小的一侧, 分支较少.
+ */
+static uint32_t flatset_intersect_merge_u32(
+    const uint32_t *a, uint32_t na, const uint32_t *b, uint32_t nb, uint32_t *out)
+{
+    uint32_t i = 0, j = 0, count = 0;
+
+#ifdef __SSE2__
+    const uint32_t na4 = na & ~3U, nb4 = nb & ~3U;
+    while (i < na4 && j < nb4) {
+        __m128i va  = _mm_loadu_si128((const __m128i *)(a + i));
+        __m128i vb  = _mm_loadu_si128((const __m128i *)(b + j));
+        __m128i eq0 = _mm_cmpeq_epi32(va, vb);
+        __m128i eq1 = _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, 0x39));
+        __m128i eq2 = _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, 0x4E));
+        __m128i eq3 = _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, 0x93));
+        __m128i eq  = _mm_or_si128(_mm_or_si128(eq0, eq1), _mm_or_si128(eq2, eq3));
+
+        uint32_t mask = (uint32_t)_mm_movemask_ps(_mm_castsi128_ps(eq));
+        while (mask != 0) {
+            out[count++] = a[i + (uint32_t)__builtin_ctz(mask)];
+            mask &= mask - 1;
+        }
+
+        uint32_t amax = a[i + 3], bmax = b[j + 3];
+        i += amax <= bmax ? 4 : 0;
+        j += bmax <= amax ? 4 : 0;
+    }
+#endif
+
+    while (i < na && j < nb) {
+        uint32_t x = a[i], y = b[j];
+        if (x == y) {
+            out[count++] = x;
+        }
+        i += x <= y;
+        j += y <= x;
+    }
+    return count;
+}
+
+// uint32_t 集合求交集, 大小相差悬殊时对大集合倍增查找, 返回结果元素数量
+static uint32_t flatset_intersect_u32(
+    const uint32_t *a, uint32_t na, const uint32_t *b, uint32_t nb, uint32_t *out)
+{
+    uint32_t count = 0, j = 0;
+
+    if (flatset_skewed(nb, na)) {
+        /* 交集与参数顺序无关, 统一让 a 为小集合 */
+        const uint32_t *t = a;
+        uint32_t        n = na;
+        a                 = b;
+        b                 = t;
+        na                = nb;
+        nb                = n;
+    } else if (!flatset_skewed(na, nb)) {
+        return flatset_intersect_merge_u32(a, na, b, nb, out);
+    }
+
+    for (uint32_t i = 0; i < na && j < nb; i++) {
+        j = flatset_gallop_u32(b, j, nb, a[i]);
+        if (j < nb && b[j] == a[i]) {
+            out[count++] = a[i];
+            j++;
+        }
+    }
+    return count;
+}
+
+// uint32_t 集合求并集, 返回结果元素数量, out 至少能容纳 na + nb 个元素
+static uint32_t flatset_union_u32(
+    const uint32_t *a, uint32_t na, const uint32_t *b, uint32_t nb, uint32_t *out)
+{
+    uint32_t i = 0, j = 0, count = 0;
+
+    if (flatset_skewed(na, nb) || flatset_skewed(nb, na)) {
+        /* 并集结果与参数顺序无关, 遍历小集合, 大集合中两次命中之间的元素整段复制 */
+        if (na > nb) {
+            const uint32_t *t = a;
+            uint32_t        n = na;
+            a                 = b;
+            b                 = t;
+            na                = nb;
+            nb                = n;
+        }
+        for (i = 0; i < na; i++) {
+            uint32_t k = flatset_gallop_u32(b, j, nb, a[i]);
+            memcpy(out + count, b + j, (size_t)(k - j) * sizeof(uint32_t));
+            count += k - j;
+            j            = k < nb && b[k] == a[i] ? k + 1 : k;
+            out[count++] = a[i];
+        }
+        i = na;
+    } else {
+        while (i < na && j < nb) {
+            uint32_t x   = a[i], y = b[j];
+            out[count++] = x <= y ? x : y;
+            i += x <= y;
+            j += y <= x;
+        }
+    }
+
+    memcpy(out + count, a + i, (size_t)(na - i) * sizeof(uint32_t));
+    count += na - i;
+    memcpy(out + count, b + j, (size_t)(nb - j) * sizeof(uint32_t));
+    count += nb - j;
+    return count;
+}
+
+// uint32_t 集合求差集 a - b, 返回结果元素数量, out 至少能容纳 na 个元素
+static uint32_t flatset_difference_u32(
+    const uint32_t *a, uint32_t na, const uint32_t *b, uint32_t nb, uint32_t *out)
+{
+    uint32_t i = 0, j = 0, count = 0;
+
+    if (flatset_skewed(na, nb)) {
+        /* a 远小于 b, 逐个在 b 中倍增查找 */
+        for (i = 0; i < na; i++) {
+            j = flatset_gallop_u32(b, j, nb, a[i]);
+            if (j == nb || b[j] != a[i]) {
+                out[count++] = a[i];
+            }
+        }
+        return count;
+    }
+
+    if (flatset_skewed(nb, na)) {
+        /* b 远小于 a, 逐个在 a 中倍增查找, 两次命中之间的元素整段复制 */
+        for (j = 0; j < nb; j++) {
+            uint32_t k = flatset_gallop_u32(a, i, na, b[j]);
+            memcpy(out + count, a + i, (size_t)(k - i) * sizeof(uint32_t));
+            count += k - i;
+            i = k < na && a[k] == b[j] ? k + 1 : k;
+        }
+    } else {
+        while (i < na && j < nb) {
+            uint32_t x = a[i], y = b[j];
+            if (x < y) {
+                out[count++] = x;
+            }
+            i += x <= y;
+            j += y <= x;
+        }
+    }
+
+    memcpy(out + count, a + i, (size_t)(na - i) * sizeof(uint32_t));
+    return count + (na - i);
+}
+
+// 复制 src 中 [from, to) 范围的元素到 dst 末尾
+static inline void flatset_append(struct easeds_flatset *dst, const struct easeds_flatset *src,
+    uint32_t from, uint32_t to)
+{
+    if (from < to) {
+        memcpy(flatset_elem(dst, dst->array->size), flatset_elem(src, from),
+            (size_t)(to - from) * src->array->element_size);
+        dst->array->size += to - from;
+    }
+}
+
+// 通用集合求交集, 元素取自 a, 结果追加到 dst
+static void flatset_intersect_generic(
+    struct easeds_flatset *dst, const struct easeds_flatset *a, const struct easeds_flatset *b)
+{
+    const uint32_t na = a->array->size, nb = b->array->size;
+    uint32_t       i  = 0, j = 0;
+
+    if (flatset_skewed(na, nb)) {
+        for (i = 0; i < na && j < nb; i++) {
+            j = flatset_gallop(b, j, nb, flatset_elem(a, i));
+            if (j < nb && a->compare(flatset_elem(b, j), flatset_elem(a, i)) == 0) {
+                flatset_append(dst, a, i, i + 1);
+                j++;
+            }
+        }
+    } else if (flatset_skewed(nb, na)) {
+        for (j = 0; j < nb && i < na; j++) {
+            i = flatset_gallop(a, i, na, flatset_elem(b, j));
+            if (i < na && a->compare(flatset_elem(a, i), flatset_elem(b, j)) == 0) {
+                flatset_append(dst, a, i, i + 1);
+                i++;
+            }
+        }
+    } else {
+        while (i < na && j < nb) {
+            int32_t ret = a->compare(flatset_elem(a, i), flatset_elem(b, j));
+            if (ret == 0) {
+                flatset_append(dst, a, i, i + 1);
+            }
+            i += ret <= 0;
+            j += ret >= 0;
+        }
+    }
+}
+
+// 通用集合求并集, 相等元素取自 a, 结果追加到 dst
+static void flatset_union_generic(
+    struct easeds_flatset *dst, const struct easeds_flatset *a, const struct easeds_flatset *b)
+{
+    const uint32_t na = a->array->size, nb = b->array->size;
+    uint32_t       i  = 0, j = 0;
+
+    if (flatset_skewed(na, nb)) {
+        for (i = 0; i < na; i++) {
+            uint32_t k = flatset_gallop(b, j, nb, flatset_elem(a, i));
+            flatset_append(dst, b, j, k);
+            j = k < nb && a->compare(flatset_elem(b, k), flatset_elem(a, i)) == 0 ? k + 1 : k;
+            flatset_append(dst, a, i, i + 1);
+        }
+    } else if (flatset_skewed(nb, na)) {
+        for (j = 0; j < nb; j++) {
+            uint32_t k = flatset_gallop(a, i, na, flatset_elem(b, j));
+            flatset_append(dst, a, i, k);
+            i = k; /* 相等元素取自 a, 留给下一段复制 */
+            if (k == na || a->compare(flatset_elem(a, k), flatset_elem(b, j)) != 0) {
+                flatset_append(dst, b, j, j + 1);
+            }
+        }
+    } else {
+        while (i < na && j < nb) {
+            int32_t ret = a->compare(flatset_elem(a, i), flatset_elem(b, j));
+            if (ret <= 0) {
+                flatset_append(dst, a, i, i + 1);
+            } else {
+                flatset_append(dst, b, j, j + 1);
+            }
+            i += ret <= 0;
+            j += ret >= 0;
+        }
+    }
+
+    flatset_append(dst, a, i, na);
+    flatset_append(dst, b, j, nb);
+}
+
+// 通用集合求差集 a - b, 结果追加到 dst
+static void flatset_difference_generic(
+    struct easeds_flatset *dst, const struct easeds_flatset *a, const struct easeds_flatset *b)
+{
+    const uint32_t na = a->array->size, nb = b->array->size;
+    uint32_t       i  = 0, j = 0;
+
+    if (flatset_skewed(na, nb)) {
+        for (i = 0; i < na; i++) {
+            j = flatset_gallop(b, j, nb, flatset_elem(a, i));
+            if (j == nb || a->compare(flatset_elem(b, j), flatset_elem(a, i)) != 0) {
+                flatset_append(dst, a, i, i + 1);
+            }
+        }
+        return;
+    }
+
+    if (flatset_skewed(nb, na)) {
+        for (j = 0; j < nb; j++) {
+            uint32_t k = flatset_gallop(a, i, na, flatset_elem(b, j));
+            flatset_append(dst, a, i, k);
+            i = k < na && a->compare(flatset_elem(a, k), flatset_elem(b, j)) == 0 ? k + 1 : k;
+        }
+    } else {
+        while (i < na && j < nb) {
+            int32_t ret = a->compare(flatset_elem(a, i), flatset_elem(b, j));
+            if (ret < 0) {
+                flatset_append(dst, a, i, i + 1);
+            }
+            i += ret <= 0;
+            j += ret >= 0;
+        }
+    }
+
+    flatset_append(dst, a, i, na);
+}
+
+// 检查集合运算的参数, 三个集合元素类型必须一致, dst 不能是 a 或 b, 合法返回0
+static int32_t flatset_check_operands(const char *func, const struct easeds_flatset *dst,
+    const struct easeds_flatset *a, const struct easeds_flatset *b)
+{
+    if (unlikely(dst == NULL || a == NULL || b == NULL)) {
+        EASEDS_ERR("[%s]: Invalid set pointer.", func);
+        return -1;
+    }
+
+    if (unlikely(dst == a || dst == b)) {
+        EASEDS_ERR("[%s]: Destination set cannot be a source set.", func);
+        return -1;
+    }
+
+    if (unlikely(a->compare != b->compare || a->compare != dst->compare
+                 || a->array->element_size != b->array->element_size
+                 || a->array->element_size != dst->array->element_size)) {
+        EASEDS_ERR("[%s]: Sets have different element size or compare function.", func);
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * uint32_t 键的 LSD 基数排序, 每轮处理 8 位共 4 轮, 一次遍历统计 4 轮的直方图,
+ * 所有元素在某一轮的字节都相同时跳过该轮. temp 为与输入等大的临时缓冲区.
+ */
+static void flatset_radix_sort_u32(uint32_t *keys, uint32_t *temp, uint32_t count)
+{
+    uint32_t  hist[4][256];
+    uint32_t *src = keys, *dst = temp;
+
+    memset(hist, 0, sizeof(hist));
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t key = keys[i];
+        hist[0][key & 0xFF]++;
+        hist[1][(key >> 8) & 0xFF]++;
+        hist[2][(key >> 16) & 0xFF]++;
+        hist[3][key >> 24]++;
+    }
+
+    for (uint32_t pass = 0; pass < 4; pass++) {
+        uint32_t shift = pass * 8;
+        if (hist[pass][(src[0] >> shift) & 0xFF] == count) {
+            continue;
+        }
+
+        uint32_t offset = 0;
+        for (uint32_t b = 0; b < 256; b++) {
+            uint32_t n    = hist[pass][b];
+            hist[pass][b] = offset;
+            offset += n;
+        }
+        for (uint32_t i = 0; i < count; i++) {
+            uint32_t  key  = src[i];
+            uint32_t *slot = &hist[pass][(key >> shift) & 0xFF];
+            dst[(*slot)++] = key;
+        }
+
+        uint32_t *t = src;
+        src         = dst;
+        dst         = t;
+    }
+
+    if (src != keys) {
+        memcpy(keys, src, (size_t)count * sizeof(uint32_t));
+    }
+}
+
+/**
+ * @description: 创建一个空集合, 返回集合指针, 失败返回NULL.
+ * @param name 集合名称, 预留字段, 可用于调试和日志输出
+ * @param element_size 元素大小, 单位字节, compare 为NULL时必须为 4 或 8
+ * @param compare 比较函数, 返回值小于0表示 a 小于 b, NULL 表示元素为无符号整数
+ * @param initial_capacity 初始容量, 如果为0则使用默认初始容量
+ * @return 成功返回集合指针, 失败返回NULL
+ */
+struct easeds_flatset *easeds_flatset_create(const char *name, uint32_t element_size,
+    int32_t (*compare)(const void *a, const void *b), uint32_t initial_capacity)
+{
+    uint32_t flags = 0;
+
+    if (compare == NULL) {
+        if (element_size == sizeof(uint32_t)) {
+            compare = flatset_cmp_u32;
+            flags   = EASEDS_FLATSET_F_U32;
+        } else if (element_size == sizeof(uint64_t)) {
+            compare = flatset_cmp_u64;
+            flags   = EASEDS_FLATSET_F_U64;
+        } else {
+            EASEDS_ERR("[easeds_flatset_create]: Invalid element size %u for integer keys.",
+                element_size);
+            return NULL;
+        }
+    }
+
+    if (unlikely(element_size == 0)) {
+        EASEDS_ERR("[easeds_flatset_create]: Invalid element size.");
+        return NULL;
+    }
+
+    struct easeds_flatset *set = __easeds_malloc(sizeof(struct easeds_flatset));
+    if (unlikely(set == NULL)) {
+        EASEDS_ERR("[easeds_flatset_create]: Failed to allocate memory for set struct.");
+        return NULL;
+    }
+
+    set->array = easeds_array_create(name, element_size, initial_capacity);
+    if (unlikely(set->array == NULL)) {
+        __easeds_free(set);
+        return NULL;
+    }
+
+    set->name    = name;
+    set->compare = compare;
+    set->flags   = flags;
+    set->pad     = 0;
+
+    PFL_DEBUG("Created flatset: element_size=%u, flags=0x%x.", element_size, flags);
+    return set;
+}
+
+// 销毁集合, 释放内存
+void easeds_flatset_destroy(struct easeds_flatset *set)
+{
+    if (unlikely(set == NULL)) {
+        return;
+    }
+
+    easeds_array_destroy(set->array);
+    __easeds_free(set);
+
+    PFL_DEBUG("Destroyed flatset.");
+}
+
+// 清空集合, 删除所有元素, 但不释放内存
+void easeds_flatset_clear(struct easeds_flatset *set)
+{
+    if (unlikely(set == NULL)) {
+        return;
+    }
+
+    easeds_array_clear(set->array);
+}
+
+// 获取集合中元素数量
+uint32_t easeds_flatset_size(struct easeds_flatset *set)
+{
+    if (unlikely(set == NULL)) {
+        EASEDS_ERR("[easeds_flatset_size]: Invalid set pointer.");
+        return 0;
+    }
+
+    return set->array->size;
+}
+
+// 判断集合是否为空, 为空返回true, 否则返回false
+bool easeds_flatset_is_empty(struct easeds_flatset *set)
+{
+    return easeds_flatset_size(set) == 0;
+}
+
+// 插入一个元素, 已存在时覆盖旧元素, 成功返回0, 失败返回-1
+int32_t easeds_flatset_insert(struct easeds_flatset *set, const void *element)
+{
+    if (unlikely(set == NULL || element == NULL)) {
+        EASEDS_ERR("[easeds_flatset_insert]: Invalid set or element pointer.");
+        return -1;
+    }
+
+    const uint32_t size = set->array->size;
+    const uint32_t es   = set->array->element_size;
+    uint32_t       index;
+
+    if (set->flags & EASEDS_FLATSET_F_U32) {
+        index = flatset_search_u32(flatset_u32(set), 0, size, *(const uint32_t *)element);
+    } else {
+        index = flatset_search(set, 0, size, element);
+    }
+
+    /* 键已存在, 覆盖旧元素 */
+    if (index < size && set->compare(flatset_elem(set, index), element) == 0) {
+        memcpy(flatset_elem(set, index), element, es);
+        return 0;
+    }
+
+    if (unlikely(size == UINT32_MAX || flatset_reserve(set, size + 1) != 0)) {
+        EASEDS_ERR("[easeds_flatset_insert]: Failed to reallocate memory for set expansion.");
+        return -1;
+    }
+
+    /* 后续元素整体后移一个位置, 空出插入位置 */
+    uint8_t *dest = flatset_elem(set, index);
+    memmove(dest + es, dest, (size_t)(size - index) * es);
+    memcpy(dest, element, es);
+    set->array->size++;
+
+    PFL_DEBUG("Inserted element at index %u, new size is %u.", index, set->array->size);
+    return 0;
+}
+
+// 删除与 key 相等的元素, 成功返回0, 不存在或失败返回-1
+int32_t easeds_flatset_remove(struct easeds_flatset *set, const void *key)
+{
+    if (unlikely(set == NULL || key == NULL)) {
+        EASEDS_ERR("[easeds_flatset_remove]: Invalid set or key pointer.");
+        return -1;
+    }
+
+    uint32_t index = flatset_index_of(set, key);
+    if (index == UINT32_MAX) {
+        return -1;
+    }
+
+    return easeds_array_remove(set->array, index);
+}
+
+// 判断集合中是否存在与 key 相等的元素
+bool easeds_flatset_contains(struct easeds_flatset *set, const void *key)
+{
+    if (unlikely(set == NULL || key == NULL)) {
+        EASEDS_ERR("[easeds_flatset_contains]: Invalid set or key pointer.");
+        return false;
+    }
+
+    return flatset_index_of(set, key) != UINT32_MAX;
+}
+
+// 查找与 key 相等的元素, 成功返回0并通过 element 返回元素指针, 不存在返回-1
+int32_t easeds_flatset_find(struct easeds_flatset *set, const void *key, void **element)
+{
+    if (unlikely(set == NULL || key == NULL || element == NULL)) {
+        EASEDS_ERR("[easeds_flatset_find]: Invalid set, key or element pointer.");
+        return -1;
+    }
+
+    uint32_t index = flatset_index_of(set, key);
+    if (index == UINT32_MAX) {
+        return -1;
+    }
+
+    *element = flatset_elem(set, index);
+    return 0;
+}
+
+// 返回第一个不小于 key 的元素下标, 不存在时返回集合大小
+uint32_t easeds_flatset_lower_bound(struct easeds_flatset *set, const void *key)
+{
+    if (unlikely(set == NULL || key == NULL)) {
+        EASEDS_ERR("[easeds_flatset_lower_bound]: Invalid set or key pointer.");
+        return 0;
+    }
+
+    if (set->flags & EASEDS_FLATSET_F_U32) {
+        return flatset_search_u32(flatset_u32(set), 0, set->array->size, *(const uint32_t *)key);
+    }
+    return flatset_search(set, 0, set->array->size, key);
+}
+
+// 获取指定下标的元素指针, 成功返回0, 失败返回-1
+int32_t easeds_flatset_get(struct easeds_flatset *set, uint32_t index, void **element)
+{
+    if (unlikely(set == NULL)) {
+        EASEDS_ERR("[easeds_flatset_get]: Invalid set pointer.");
+        return -1;
+    }
+
+    return easeds_array_get(set->array, index, element);
+}
+
+// 合并 src 中有序的 [lo, mid) 和 [mid, hi) 到 dst 的 [lo, hi), 相等时左侧优先, 保证稳定
+static void flatset_merge(const struct easeds_flatset *set, const char *src, char *dst,
+    uint64_t lo, uint64_t mid, uint64_t hi)
+{
+    const size_t es = set->array->element_size;
+    uint64_t     i  = lo, j = mid, k = lo;
+
+    /* 两段已经整体有序时直接复制 */
+    if (mid > lo && mid < hi && set->compare(src + (mid - 1) * es, src + mid * es) <= 0) {
+        memcpy(dst + lo * es, src + lo * es, (size_t)(hi - lo) * es);
+        return;
+    }
+
+    while (i < mid && j < hi) {
+        if (set->compare(src + j * es, src + i * es) < 0) {
+            memcpy(dst + k++ * es, src + j++ * es, es);
+        } else {
+            memcpy(dst + k++ * es, src + i++ * es, es);
+        }
+    }
+    memcpy(dst + k * es, src + i * es, (size_t)(mid - i) * es);
+    k += mid - i;
+    memcpy(dst + k * es, src + j * es, (size_t)(hi - j) * es);
+}
+
+// 自底向上稳定归并排序, 相等元素保持输入顺序, temp 为与输入等大的临时缓冲区
+static void flatset_merge_sort(
+    const struct easeds_flatset *set, char *base, char *temp, uint32_t count)
+{
+    char *src = base, *dst = temp;
+
+    for (uint64_t width = 1; width < count; width *= 2) {
+        for (uint64_t lo = 0; lo < count; lo += 2 * width) {
+            uint64_t mid = lo + width < count ? lo + width : count;
+            uint64_t hi  = lo + 2 * width < count ? lo + 2 * width : count;
+            flatset_merge(set, src, dst, lo, mid, hi);
+        }
+        char *t = src;
+        src     = dst;
+        dst     = t;
+    }
+
+    if (src != base) {
+        memcpy(base, src, (size_t)count * set->array->element_size);
+    }
+}
+
+/**
+ * @description: 用无序元素数组重建集合, 原有元素被丢弃, 重复元素只保留输入中最后出现的一个,
+ *  与依次 insert 时新值覆盖旧值的结果一致. 元素先整体复制再稳定排序去重,
+ *  uint32_t 集合使用基数排序, 其他集合使用归并排序.
+ * @param set 集合指针
+ * @param elements 元素数组, 元素大小与集合一致, count 为0时可以为NULL
+ * @param count 元素数量
+ * @return 成功返回0, 失败返回-1, 失败时集合保持不变
+ */
+int32_t easeds_flatset_build(struct easeds_flatset *set, const void *elements, uint32_t count)
+{
+    if (unlikely(set == NULL || (elements == NULL && count > 0))) {
+        EASEDS_ERR("[easeds_flatset_build]: Invalid set or elements pointer.");
+        return -1;
+    }
+
+    if (unlikely(flatset_reserve(set, count) != 0)) {
+        EASEDS_ERR("[easeds_flatset_build]: Failed to reallocate memory for %u elements.", count);
+        return -1;
+    }
+
+    /* 两种排序都需要与输入等大的临时缓冲区, 在修改集合之前申请 */
+    const uint32_t es   = set->array->element_size;
+    char          *temp = NULL;
+    if (count > 1) {
+        temp = __easeds_malloc((size_t)count * es);
+        if (unlikely(temp == NULL)) {
+            EASEDS_ERR("[easeds_flatset_build]: Failed to allocate memory for sort buffer.");
+            return -1;
+        }
+    }
+    if (count > 0) {
+        memcpy(set->array->elements, elements, (size_t)count * es);
+    }
+
+    /* 稳定排序, 相等元素保持输入顺序 */
+    if (count > 1) {
+        if (set->flags & EASEDS_FLATSET_F_U32) {
+            flatset_radix_sort_u32(flatset_u32(set), (uint32_t *)temp, count);
+        } else {
+            flatset_merge_sort(set, set->array->elements, temp, count);
+        }
+        __easeds_free(temp);
+    }
+
+    /* 去重, 相等元素依次覆盖, 保留输入中最后出现的一个 */
+    uint32_t unique = count > 0 ? 1 : 0;
+    for (uint32_t i = 1; i < count; i++) {
+        void *last = flatset_elem(set, unique - 1);
+        void *elem = flatset_elem(set, i);
+        if (set->compare(last, elem) == 0) {
+            memcpy(last, elem, es);
+        } else {
+            if (unique != i) {
+                memcpy(flatset_elem(set, unique), elem, es);
+            }
+            unique++;
+        }
+    }
+    set->array->size = unique;
+
+    PFL_DEBUG("Built flatset from %u elements, %u unique.", count, unique);
+    return 0;
+}
+
+/**
+ * @description: 计算 a 和 b 的交集, 结果写入 dst, dst 原有元素被丢弃.
+ *  两个集合大小相近时线性归并, uint32_t 集合支持 SSE2 时按 4x4 分块比较;
+ *  大小相差超过 FLATSET_GALLOP_RATIO 倍时, 小集合的元素依次在大集合中倍增查找.
+ * @param dst 结果集合, 元素类型与 a 和 b 一致, 不能是 a 或 b
+ * @param a 集合 a, 键相等时结果元素取自 a
+ * @param b 集合 b
+ * @return 成功返回0, 失败返回-1, 失败时 dst 保持不变
+ */
+int32_t easeds_flatset_intersect(
+    struct easeds_flatset *dst, struct easeds_flatset *a, struct easeds_flatset *b)
+{
+    if (flatset_check_operands("easeds_flatset_intersect", dst, a, b) != 0) {
+        return -1;
+    }
+
+    const uint32_t na = a->array->size, nb = b->array->size;
+    if (unlikely(flatset_reserve(dst, na < nb ? na : nb) != 0)) {
+        EASEDS_ERR("[easeds_flatset_intersect]: Failed to reallocate memory for result.");
+        return -1;
+    }
+
+    if (a->flags & EASEDS_FLATSET_F_U32) {
+        dst->array->size =
+            flatset_intersect_u32(flatset_u32(a), na, flatset_u32(b), nb, flatset_u32(dst));
+    } else {
+        dst->array->size = 0;
+        flatset_intersect_generic(dst, a, b);
+    }
+
+    PFL_DEBUG("Intersected %u and %u elements, result %u.", na, nb, dst->array->size);
+    return 0;
+}
+
+/**
+ * @description: 计算 a 和 b 的并集, 结果写入 dst, dst 原有元素被丢弃.
+ *  两个集合大小相差悬殊时遍历小集合, 大集合中两次命中之间的元素整段复制.
+ * @param dst 结果集合, 元素类型与 a 和 b 一致, 不能是 a 或 b
+ * @param a 集合 a, 键相等时结果元素取自 a
+ * @param b 集合 b
+ * @return 成功返回0, 失败返回-1, 失败时 dst 保持不变
+ */
+int32_t easeds_flatset_union(
+    struct easeds_flatset *dst, struct easeds_flatset *a, struct easeds_flatset *b)
+{
+    if (flatset_check_operands("easeds_flatset_union", dst, a, b) != 0) {
+        return -1;
+    }
+
+    const uint32_t na = a->array->size, nb = b->array->size;
+    if (unlikely((uint64_t)na + nb > UINT32_MAX || flatset_reserve(dst, na + nb) != 0)) {
+        EASEDS_ERR("[easeds_flatset_union]: Failed to reallocate memory for result.");
+        return -1;
+    }
+
+    if (a->flags & EASEDS_FLATSET_F_U32) {
+        dst->array->size =
+            flatset_union_u32(flatset_u32(a), na, flatset_u32(b), nb, flatset_u32(dst));
+    } else {
+        dst->array->size = 0;
+        flatset_union_generic(dst, a, b);
+    }
+
+    PFL_DEBUG("United %u and %u elements, result %u.", na, nb, dst->array->size);
+    return 0;
+}
+
+/**
+ * @description: 计算 a 减去 b 的差集, 结果写入 dst, dst 原有元素被丢弃.
+ * @param dst 结果集合, 元素类型与 a 和 b 一致, 不能是 a 或 b
+ * @param a 集合 a
+ * @param b 集合 b
+ * @return 成功返回0, 失败返回-1, 失败时 dst 保持不变
+ */
+int32_t easeds_flatset_difference(
+    struct easeds_flatset *dst, struct easeds_flatset *a, struct easeds_flatset *b)
+{
+    if (flatset_check_operands("easeds_flatset_difference", dst, a, b) != 0) {
+        return -1;
+    }
+
+    const uint32_t na = a->array->size, nb = b->array->size;
+    if (unlikely(flatset_reserve(dst, na) != 0)) {
+        EASEDS_ERR("[easeds_flatset_difference]: Failed to reallocate memory for result.");
+        return -1;
+    }
+
+    if (a->flags & EASEDS_FLATSET_F_U32) {
+        dst->array->size =
+            flatset_difference_u32(flatset_u32(a), na, flatset_u32(b), nb, flatset_u32(dst));
+    } else {
+        dst->array->size = 0;
+        flatset_difference_generic(dst, a, b);
+    }
+
+    PFL_DEBUG("Subtracted %u from %u elements, result %u.", nb, na, dst->array->size);
+    return 0;
+}
+
+// 校验元素升序且不重复, 正确返回0, 异常返回-1
+int32_t easeds_flatset_verify(struct easeds_flatset *set)
+{
+    if (unlikely(set == NULL)) {
+        EASEDS_ERR("[easeds_flatset_verify]: Invalid set pointer.");
+        return -1;
+    }
+
+    for (uint32_t i = 1; i < set->array->size; i++) {
+        if (set->compare(flatset_elem(set, i - 1), flatset_elem(set, i)) >= 0) {
+            EASEDS_ERR("[easeds_flatset_verify]: Element %u is not greater than element %u.", i,
+                i - 1);
+            return -1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,140 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-flatset.h
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-19 00:25
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  有序平铺集合(flat set)数据结构定义, 元素有序存放在动态数组中, 支持交集/并集/差集运算.
+ *
+ * @History:
+ *  2026年10月19日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#ifndef __EASEDS_FLATSET_H__
+#define __EASEDS_FLATSET_H__
+
+/* C 标准库头文件 */
+#include <stdbool.h>
+#include <stdint.h>
+
+/* 项目内部头文件 */
+#include "easeds-array.h"
+#include "easeds-public.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * 实现一个有序平铺集合, 元素按值升序存放在 easeds_array 中, 不含重复元素.
+ *  (1) 查找使用二分查找, 复杂度 O(log n); 插入和删除需要移动后续元素, 复杂度 O(n),
+ *      适合读多写少, 或者先批量构建再查询和做集合运算的场景.
+ *  (2) 支持从无序输入批量构建, 排序后去重, 复杂度 O(n log n), 远快于逐个插入.
+ *  (3) 支持交集/并集/差集运算, 两个集合大小相近时线性归并, 大小相差悬殊时对大集合使用
+ *      倍增(galloping)查找, 复杂度 O(m log(n/m)), m 为小集合大小.
+ *  (4) compare 为NULL时元素视为 uint32_t 或 uint64_t 无符号整数, element_size 必须为 4 或 8.
+ *      uint32_t 集合使用专用实现, 支持 SSE2 时交集运算每次比较 4x4 个元素.
+ *  (5) 元素可以是结构体, compare 只比较其中的键字段, 键相同时插入会覆盖旧元素.
+ *  (6) 非线程安全, 需要用户自行保证线程安全性.
+ */
+struct easeds_flatset {
+    const char          *name;  /* 名称, 预留字段, 可用于调试和日志输出 */
+    struct easeds_array *array; /* 元素存储数组, 升序且不重复 */
+    /* 比较函数, 返回值小于0表示 a 小于 b, 等于0表示 a 等于 b */
+    int32_t (*compare)(const void *a, const void *b);
+    uint32_t flags; /* 标志位, 见 EASEDS_FLATSET_F_* */
+    uint32_t pad;   /* 填充字段, 保持结构体对齐 */
+};
+
+/* 元素为 uint32_t 无符号整数, 使用专用实现 */
+#define EASEDS_FLATSET_F_U32 0x1U
+
+/* 元素为 uint64_t 无符号整数 */
+#define EASEDS_FLATSET_F_U64 0x2U
+
+/**
+ * 常见集合操作函数:
+ *
+ * 函数名                       功能描述
+ * ------------------------     ------------------------------------------------------
+ * easeds_flatset_create        创建一个空集合, 返回集合指针, 失败返回NULL
+ * easeds_flatset_destroy       销毁集合, 释放内存
+ * easeds_flatset_clear         清空集合, 删除所有元素, 但不释放内存
+ * easeds_flatset_size          获取集合中元素数量
+ * easeds_flatset_is_empty      判断集合是否为空, 为空返回true, 否则返回false
+ * easeds_flatset_insert        插入一个元素, 已存在时覆盖旧元素, 成功返回0, 失败返回-1
+ * easeds_flatset_remove        删除与 key 相等的元素, 成功返回0, 不存在或失败返回-1
+ * easeds_flatset_contains      判断集合中是否存在与 key 相等的元素
+ * easeds_flatset_find          查找与 key 相等的元素, 成功返回0, 不存在返回-1
+ * easeds_flatset_lower_bound   返回第一个不小于 key 的元素下标, 不存在时返回集合大小
+ * easeds_flatset_get           获取指定下标的元素指针, 成功返回0, 失败返回-1
+ * easeds_flatset_build         用无序元素数组重建集合, 成功返回0, 失败返回-1
+ * easeds_flatset_intersect     计算 a 和 b 的交集, 结果写入 dst, 成功返回0, 失败返回-1
+ * easeds_flatset_union         计算 a 和 b 的并集, 结果写入 dst, 成功返回0, 失败返回-1
+ * easeds_flatset_difference    计算 a 减去 b 的差集, 结果写入 dst, 成功返回0, 失败返回-1
+ * easeds_flatset_verify        校验元素升序且不重复, 正确返回0, 异常返回-1
+ */
+
+// 创建一个空集合, compare 为NULL时元素视为无符号整数, initial_capacity 为0时使用默认容量
+struct easeds_flatset *easeds_flatset_create(const char *name, uint32_t element_size,
+    int32_t (*compare)(const void *a, const void *b), uint32_t initial_capacity);
+
+// 销毁集合, 释放内存
+void easeds_flatset_destroy(struct easeds_flatset *set);
+
+// 清空集合, 删除所有元素, 但不释放内存
+void easeds_flatset_clear(struct easeds_flatset *set);
+
+// 获取集合中元素数量
+uint32_t easeds_flatset_size(struct easeds_flatset *set);
+
+// 判断集合是否为空, 为空返回true, 否则返回false
+bool easeds_flatset_is_empty(struct easeds_flatset *set);
+
+// 插入一个元素, 已存在时覆盖旧元素, 成功返回0, 失败返回-1
+int32_t easeds_flatset_insert(struct easeds_flatset *set, const void *element);
+
+// 删除与 key 相等的元素, 成功返回0, 不存在或失败返回-1
+int32_t easeds_flatset_remove(struct easeds_flatset *set, const void *key);
+
+// 判断集合中是否存在与 key 相等的元素
+bool easeds_flatset_contains(struct easeds_flatset *set, const void *key);
+
+// 查找与 key 相等的元素, 成功返回0并通过 element 返回元素指针, 不存在返回-1
+int32_t easeds_flatset_find(struct easeds_flatset *set, const void *key, void **element);
+
+// 返回第一个不小于 key 的元素下标, 不存在时返回集合大小
+uint32_t easeds_flatset_lower_bound(struct easeds_flatset *set, const void *key);
+
+// 获取指定下标的元素指针, 成功返回0, 失败返回-1
+int32_t easeds_flatset_get(struct easeds_flatset *set, uint32_t index, void **element);
+
+// 用无序元素数组重建集合, 原有元素被丢弃, 重复元素保留最后出现的一个, 成功返回0, 失败返回-1
+int32_t easeds_flatset_build(struct easeds_flatset *set, const void *elements, uint32_t count);
+
+// 计算 a 和 b 的交集, 元素取自 a, 结果写入 dst, dst 不能是 a 或 b, 成功返回0, 失败返回-1
+int32_t easeds_flatset_intersect(
+    struct easeds_flatset *dst, struct easeds_flatset *a, struct easeds_flatset *b);
+
+// 计算 a 和 b 的并集, 相等元素取自 a, 结果写入 dst, dst 不能是 a 或 b, 成功返回0, 失败返回-1
+int32_t easeds_flatset_union(
+    struct easeds_flatset *dst, struct easeds_flatset *a, struct easeds_flatset *b);
+
+// 计算 a 减去 b 的差集, 结果写入 dst, dst 不能是 a 或 b, 成功返回0, 失败返回-1
+int32_t easeds_flatset_difference(
+    struct easeds_flatset *dst, struct easeds_flatset *a, struct easeds_flatset *b);
+
+// 校验元素升序且不重复, 正确返回0, 异常返回-1
+int32_t easeds_flatset_verify(struct easeds_flatset *set);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __EASEDS_FLATSET_H__ */
@@ -0,0 +1,322 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-heap-unittest.c
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-18 12:55
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  Easeds 堆优先队列单元测试实现文件, 包含了插入/弹出/批量建堆/原地更新优先级测试.
+ *
+ * @History:
+ *  2026年10月18日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#include "easeds-unittest.h"
+
+// 项目内部头文件
+#include "easeds-heap.h"
+#include "easeds-queue.h"
+#include "easeds-utils.h"
+
+// 测试元素, 按 prio 从小到大出堆
+struct heap_item {
+    uint32_t prio;
+    uint32_t id;
+};
+
+static int32_t heap_item_cmp(const void *a, const void *b)
+{
+    const struct heap_item *x = a;
+    const struct heap_item *y = b;
+    return (x->prio > y->prio) - (x->prio < y->prio);
+}
+
+// 记录每个 id 当前所在的堆下标
+static void heap_item_set_index(void *element, uint32_t index, void *user_data)
+{
+    const struct heap_item *item    = element;
+    uint32_t               *indexes = user_data;
+    indexes[item->id]               = index;
+}
+
+static const uint32_t heap_arities[] = {2, 4};
+
+// 基本功能测试: 插入, 查看堆顶, 弹出
+static void test_easeds_heap_basic(void **state)
+{
+    easeds_unused(state);
+
+    for (uint32_t a = 0; a < 2; a++) {
+        struct easeds_heap *heap = easeds_heap_create(
+            "basic", sizeof(struct heap_item), heap_arities[a], heap_item_cmp, 4);
+        assert_non_null(heap);
+        assert_true(easeds_heap_is_empty(heap));
+
+        for (uint32_t i = 0; i < 1000; i++) {
+            struct heap_item item = {.prio = (i * 7919) % 1000, .id = i};
+            assert_int_equal(easeds_heap_push(heap, &item), EASEDS_OK);
+        }
+        assert_int_equal(easeds_heap_size(heap), 1000);
+        assert_int_equal(easeds_heap_verify(heap), 0);
+
+        void *top = NULL;
+        assert_int_equal(easeds_heap_peek(heap, &top), EASEDS_OK);
+        assert_true(top != NULL && ((struct heap_item *)top)->prio == 0);
+
+        for (uint32_t i = 0; i < 1000; i++) {
+            struct heap_item item;
+            assert_int_equal(easeds_heap_pop(heap, &item), EASEDS_OK);
+            assert_int_equal(item.prio, i);
+        }
+        assert_true(easeds_heap_is_empty(heap));
+
+        easeds_heap_destroy(heap);
+    }
+}
+
+// 基本功能测试: 批量建堆, 通过下标回调原地更新优先级, 删除任意元素
+static void test_easeds_heap_operations(void **state)
+{
+    easeds_unused(state);
+
+    const uint32_t count = 5000;
+    uint32_t      *index = calloc(count, sizeof(uint32_t));
+    assert_non_null(index);
+
+    for (uint32_t a = 0; a < 2; a++) {
+        struct easeds_heap *heap =
+            easeds_heap_create("ops", sizeof(struct heap_item), heap_arities[a], heap_item_cmp, 0);
+        assert_non_null(heap);
+        easeds_heap_set_index_cb(heap, heap_item_set_index, index);
+
+        struct easeds_array *items = easeds_array_create("items", sizeof(struct heap_item), count);
+        assert_non_null(items);
+        for (uint32_t i = 0; i < count; i++) {
+            struct heap_item item = {.prio = count + (i * 7919) % count, .id = i};
+            assert_int_equal(easeds_array_push_back(items, &item), EASEDS_OK);
+        }
+
+        // 批量建堆, 数组内容不变
+        assert_int_equal(easeds_heap_heapify(heap, items), EASEDS_OK);
+        assert_int_equal(easeds_heap_size(heap), count);
+        assert_int_equal(easeds_array_size(items), count);
+        assert_int_equal(easeds_heap_verify(heap), 0);
+        for (uint32_t i = 0; i < count; i++) {
+            void *elem = NULL;
+            assert_int_equal(easeds_heap_get(heap, index[i], &elem), EASEDS_OK);
+            assert_true(elem != NULL && ((struct heap_item *)elem)->id == i);
+        }
+
+        // decrease-key: 每隔 100 个元素把优先级提升到最高
+        for (uint32_t i = 0; i < count; i += 100) {
+            void *elem = NULL;
+            assert_int_equal(easeds_heap_get(heap, index[i], &elem), EASEDS_OK);
+            ((struct heap_item *)elem)->prio = i / 100;
+            assert_int_equal(easeds_heap_update(heap, index[i]), EASEDS_OK);
+        }
+        assert_int_equal(easeds_heap_verify(heap), 0);
+
+        // increase-key: 把 id 为 1 的元素优先级降到最低
+        void *elem = NULL;
+        assert_int_equal(easeds_heap_get(heap, index[1], &elem), EASEDS_OK);
+        ((struct heap_item *)elem)->prio = UINT32_MAX;
+        assert_int_equal(easeds_heap_update(heap, index[1]), EASEDS_OK);
+        assert_int_equal(easeds_heap_verify(heap), 0);
+
+        // 删除任意元素
+        struct heap_item removed;
+        assert_int_equal(easeds_heap_remove(heap, index[2], &removed), EASEDS_OK);
+        assert_int_equal(removed.id, 2);
+        assert_int_equal(index[2], EASEDS_HEAP_INVALID_INDEX);
+        assert_int_equal(easeds_heap_verify(heap), 0);
+
+        // 依次弹出, 先出被提升的元素, 最后出被降低的元素
+        struct heap_item item;
+        for (uint32_t i = 0; i < count / 100; i++) {
+            assert_int_equal(easeds_heap_pop(heap, &item), EASEDS_OK);
+            assert_int_equal(item.id, i * 100);
+            assert_int_equal(index[item.id], EASEDS_HEAP_INVALID_INDEX);
+        }
+        uint32_t last = 0;
+        while (easeds_heap_size(heap) > 1) {
+            assert_int_equal(easeds_heap_pop(heap, &item), EASEDS_OK);
+            assert_true(item.prio >= last);
+            last = item.prio;
+        }
+        assert_int_equal(easeds_heap_pop(heap, &item), EASEDS_OK);
+        assert_int_equal(item.id, 1);
+
+        easeds_array_destroy(items);
+        easeds_heap_destroy(heap);
+    }
+
+    free(index);
+}
+
+// 边界测试: 空堆, 单元素, 重复优先级, 向非空堆批量建堆
+static void test_easeds_heap_boundary(void **state)
+{
+    easeds_unused(state);
+
+    struct easeds_heap *heap =
+        easeds_heap_create("boundary", sizeof(struct heap_item), 4, heap_item_cmp, 1);
+    assert_non_null(heap);
+
+    void            *top  = NULL;
+    struct heap_item item = {.prio = 5, .id = 0};
+    assert_int_equal(easeds_heap_peek(heap, &top), EASEDS_ERROR);
+    assert_int_equal(easeds_heap_pop(heap, NULL), EASEDS_ERROR);
+    assert_int_equal(easeds_heap_update(heap, 0), EASEDS_ERROR);
+
+    assert_int_equal(easeds_heap_push(heap, &item), EASEDS_OK);
+    assert_int_equal(easeds_heap_update(heap, 0), EASEDS_OK);
+    assert_int_equal(easeds_heap_remove(heap, 0, NULL), EASEDS_OK);
+    assert_true(easeds_heap_is_empty(heap));
+
+    // 重复优先级
+    for (uint32_t i = 0; i < 100; i++) {
+        item.id = i;
+        assert_int_equal(easeds_heap_push(heap, &item), EASEDS_OK);
+    }
+    assert_int_equal(easeds_heap_verify(heap), 0);
+
+    // 向非空堆批量建堆, 包含更高优先级的元素
+    struct easeds_array *items = easeds_array_create("items", sizeof(struct heap_item), 0);
+    assert_non_null(items);
+    for (uint32_t i = 0; i < 100; i++) {
+        struct heap_item more = {.prio = i % 10, .id = 100 + i};
+        assert_int_equal(easeds_array_push_back(items, &more), EASEDS_OK);
+    }
+    assert_int_equal(easeds_heap_heapify(heap, items), EASEDS_OK);
+    assert_int_equal(easeds_heap_size(heap), 200);
+    assert_int_equal(easeds_heap_verify(heap), 0);
+    assert_int_equal(easeds_heap_pop(heap, &item), EASEDS_OK);
+    assert_int_equal(item.prio, 0);
+
+    // 空数组建堆不改变堆
+    easeds_array_clear(items);
+    assert_int_equal(easeds_heap_heapify(heap, items), EASEDS_OK);
+    assert_int_equal(easeds_heap_size(heap), 199);
+
+    easeds_heap_clear(heap);
+    assert_true(easeds_heap_is_empty(heap));
+
+    easeds_array_destroy(items);
+    easeds_heap_destroy(heap);
+}
+
+// 失效测试: 非法参数
+static void test_easeds_heap_error(void **state)
+{
+    easeds_unused(state);
+
+    assert_null(easeds_heap_create("error", 0, 2, heap_item_cmp, 0));
+    assert_null(easeds_heap_create("error", 8, 3, heap_item_cmp, 0));
+    assert_null(easeds_heap_create("error", 8, 2, NULL, 0));
+
+    assert_int_equal(easeds_heap_push(NULL, NULL), EASEDS_ERROR);
+    assert_int_equal(easeds_heap_pop(NULL, NULL), EASEDS_ERROR);
+    assert_int_equal(easeds_heap_peek(NULL, NULL), EASEDS_ERROR);
+    assert_int_equal(easeds_heap_heapify(NULL, NULL), EASEDS_ERROR);
+    assert_int_equal(easeds_heap_size(NULL), 0);
+
+    struct easeds_heap *heap =
+        easeds_heap_create("error", sizeof(struct heap_item), 2, heap_item_cmp, 0);
+    assert_non_null(heap);
+    assert_int_equal(easeds_heap_push(heap, NULL), EASEDS_ERROR);
+    assert_int_equal(easeds_heap_remove(heap, 0, NULL), EASEDS_ERROR);
+
+    struct easeds_array *wrong = easeds_array_create("wrong", sizeof(uint32_t), 0);
+    assert_non_null(wrong);
+    uint32_t value = 1;
+    assert_int_equal(easeds_array_push_back(wrong, &value), EASEDS_OK);
+    assert_int_equal(easeds_heap_heapify(heap, wrong), EASEDS_ERROR);
+    assert_true(easeds_heap_is_empty(heap));
+
+    easeds_array_destroy(wrong);
+    easeds_heap_destroy(heap);
+}
+
+// 按优先级有序插入的 TAILQ, 作为性能对照
+struct heap_list_node {
+    TAILQ_ENTRY(heap_list_node) entry;
+    struct heap_item item;
+};
+TAILQ_HEAD(heap_list, heap_list_node);
+
+// 性能测试: 二叉堆和四叉堆的插入/弹出, 与有序 TAILQ 插入对比
+static void test_easeds_heap_perf(void **state)
+{
+    easeds_unused(state);
+
+    const uint32_t count = 1000000;
+
+    for (uint32_t a = 0; a < 2; a++) {
+        struct easeds_heap *heap =
+            easeds_heap_create("perf", sizeof(struct heap_item), heap_arities[a], heap_item_cmp, 0);
+        assert_non_null(heap);
+
+        int64_t start = easeds_get_current_time_ns();
+        for (uint32_t i = 0; i < count; i++) {
+            struct heap_item item = {.prio = (uint32_t)(((uint64_t)i * 2654435761ULL) % count)};
+            assert_int_equal(easeds_heap_push(heap, &item), EASEDS_OK);
+        }
+        int64_t push_ns = easeds_get_current_time_ns() - start;
+
+        start = easeds_get_current_time_ns();
+        for (uint32_t i = 0; i < count; i++) {
+            struct heap_item item;
+            assert_int_equal(easeds_heap_pop(heap, &item), EASEDS_OK);
+        }
+        int64_t pop_ns = easeds_get_current_time_ns() - start;
+
+        MEASURE("[heap perf]: %u-ary, %u elements, push %.1f ns/op, pop %.1f ns/op.",
+            heap_arities[a], count, (double)push_ns / count, (double)pop_ns / count);
+
+        easeds_heap_destroy(heap);
+    }
+
+    // 有序链表插入为 O(n), 只测试较小规模
+    const uint32_t         list_count = 10000;
+    struct heap_list       list       = TAILQ_HEAD_INITIALIZER(list);
+    struct heap_list_node *nodes      = calloc(list_count, sizeof(struct heap_list_node));
+    struct heap_list_node *node;
+    assert_non_null(nodes);
+
+    int64_t start = easeds_get_current_time_ns();
+    for (uint32_t i = 0; i < list_count; i++) {
+        nodes[i].item.prio = (uint32_t)(((uint64_t)i * 2654435761ULL) % list_count);
+        TAILQ_FOREACH(node, &list, entry)
+        {
+            if (node->item.prio > nodes[i].item.prio) {
+                break;
+            }
+        }
+        if (node == NULL) {
+            TAILQ_INSERT_TAIL(&list, &nodes[i], entry);
+        } else {
+            TAILQ_INSERT_BEFORE(node, &nodes[i], entry);
+        }
+    }
+    int64_t list_ns = easeds_get_current_time_ns() - start;
+
+    MEASURE("[heap perf]: sorted TAILQ, %u elements, insert %.1f ns/op.", list_count,
+        (double)list_ns / list_count);
+
+    free(nodes);
+}
+
+// 注册单元测试用例
+EASEDS_UNITTEST_REGISTER(easeds_unittest_heap){
+    cmocka_unit_test(test_easeds_heap_basic),
+    cmocka_unit_test(test_easeds_heap_operations),
+    cmocka_unit_test(test_easeds_heap_boundary),
+    cmocka_unit_test(test_easeds_heap_error),
+    cmocka_unit_test(test_easeds_heap_perf),
+    easeds_unit_test_end,
+};
@@ -0,0 +1,407 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-heap.c
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-18 12:30
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  d 叉堆优先队列实现, 上浮和下沉使用"空穴"移动, 每层只复制一次元素.
+ *
+ * @History:
+ *  2026年10月18日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#include "easeds-heap.h"
+
+// 标准库头文件
+#include <stdlib.h>
+#include <string.h>
+
+// 项目内部头文件
+#include "easeds-log.h"
+
+// 获取指定下标的元素地址
+static inline void *heap_elem(struct easeds_heap *heap, uint32_t index)
+{
+    return (uint8_t *)heap->array->elements + (size_t)index * heap->array->element_size;
+}
+
+// 复制元素并通知新下标
+static inline void heap_place(struct easeds_heap *heap, uint32_t index, const void *src)
+{
+    void *dst = heap_elem(heap, index);
+    memcpy(dst, src, heap->array->element_size);
+    if (heap->set_index != NULL) {
+        heap->set_index(dst, index, heap->user_data);
+    }
+}
+
+// 上浮: 元素暂存在 temp 中, 父节点依次下移, 最后把元素放入空穴
+static void heap_sift_up(struct easeds_heap *heap, uint32_t index)
+{
+    memcpy(heap->temp, heap_elem(heap, index), heap->array->element_size);
+
+    while (index > 0) {
+        uint32_t parent = (index - 1) / heap->arity;
+        void    *elem   = heap_elem(heap, parent);
+        if (heap->compare(heap->temp, elem) >= 0) {
+            break;
+        }
+        heap_place(heap, index, elem);
+        index = parent;
+    }
+
+    heap_place(heap, index, heap->temp);
+}
+
+// 下沉: 每层从 arity 个子节点中选出优先级最高者, 子节点依次上移, 最后把元素放入空穴
+static void heap_sift_down(struct easeds_heap *heap, uint32_t index)
+{
+    const uint32_t size = heap->array->size;
+
+    memcpy(heap->temp, heap_elem(heap, index), heap->array->element_size);
+
+    for (;;) {
+        uint64_t first = (uint64_t)index * heap->arity + 1;
+        if (first >= size) {
+            break;
+        }
+
+        uint32_t best = (uint32_t)first;
+        uint32_t last = first + heap->arity < size ? (uint32_t)first + heap->arity : size;
+        for (uint32_t child = best + 1; child < last; child++) {
+            if (heap->compare(heap_elem(heap, child), heap_elem(heap, best)) < 0) {
+                best = child;
+            }
+        }
+
+        void *elem = heap_elem(heap, best);
+        if (heap->compare(elem, heap->temp) >= 0) {
+            break;
+        }
+        heap_place(heap, index, elem);
+        index = best;
+    }
+
+    heap_place(heap, index, heap->temp);
+}
+
+/**
+ * @description: 创建一个空堆, 返回堆指针, 失败返回NULL.
+ * @param name 堆名称, 预留字段, 可用于调试和日志输出
+ * @param element_size 元素大小, 单位字节
+ * @param arity 分叉数, 只支持 2 或 4
+ * @param compare 比较函数, 返回值小于0表示 a 的优先级高于 b
+ * @param initial_capacity 初始容量, 如果为0则使用默认初始容量
+ * @return 成功返回堆指针, 失败返回NULL
+ */
+struct easeds_heap *easeds_heap_create(const char *name, uint32_t element_size, uint32_t arity,
+    int32_t (*compare)(const void *a, const void *b), uint32_t initial_capacity)
+{
+    if (unlikely(element_size == 0 || compare == NULL)) {
+        EASEDS_ERR("[easeds_heap_create]: Invalid element size or compare function.");
+        return NULL;
+    }
+
+    if (unlikely(arity != 2 && arity != 4)) {
+        EASEDS_ERR("[easeds_heap_create]: Invalid arity %u, only 2 or 4 is supported.", arity);
+        return NULL;
+    }
+
+    struct easeds_heap *heap = __easeds_malloc(sizeof(struct easeds_heap));
+    if (unlikely(heap == NULL)) {
+        EASEDS_ERR("[easeds_heap_create]: Failed to allocate memory for heap struct.");
+        return NULL;
+    }
+
+    heap->temp = __easeds_malloc(element_size);
+    if (unlikely(heap->temp == NULL)) {
+        EASEDS_ERR("[easeds_heap_create]: Failed to allocate memory for temp element.");
+        __easeds_free(heap);
+        return NULL;
+    }
+
+    heap->array = easeds_array_create(name, element_size, initial_capacity);
+    if (unlikely(heap->array == NULL)) {
+        __easeds_free(heap->temp);
+        __easeds_free(heap);
+        return NULL;
+    }
+
+    heap->name      = name;
+    heap->compare   = compare;
+    heap->set_index = NULL;
+    heap->user_data = NULL;
+    heap->arity     = arity;
+    heap->flags     = 0;
+
+    PFL_DEBUG("Created heap: element_size=%u, arity=%u.", element_size, arity);
+    return heap;
+}
+
+// 销毁堆, 释放内存
+void easeds_heap_destroy(struct easeds_heap *heap)
+{
+    if (unlikely(heap == NULL)) {
+        return;
+    }
+
+    easeds_array_destroy(heap->array);
+    __easeds_free(heap->temp);
+    __easeds_free(heap);
+
+    PFL_DEBUG("Destroyed heap.");
+}
+
+// 清空堆, 删除所有元素, 但不释放内存, 不会调用下标回调函数
+void easeds_heap_clear(struct easeds_heap *heap)
+{
+    if (unlikely(heap == NULL)) {
+        return;
+    }
+
+    easeds_array_clear(heap->array);
+}
+
+// 设置下标回调函数, 用于原地更新元素优先级
+void easeds_heap_set_index_cb(struct easeds_heap *heap,
+    void (*set_index)(void *element, uint32_t index, void *user_data), void *user_data)
+{
+    if (unlikely(heap == NULL)) {
+        EASEDS_ERR("[easeds_heap_set_index_cb]: Invalid heap pointer.");
+        return;
+    }
+
+    heap->set_index = set_index;
+    heap->user_data = user_data;
+}
+
+// 获取堆中元素数量
+uint32_t easeds_heap_size(struct easeds_heap *heap)
+{
+    if (unlikely(heap == NULL)) {
+        EASEDS_ERR("[easeds_heap_size]: Invalid heap pointer.");
+        return 0;
+    }
+
+    return heap->array->size;
+}
+
+// 判断堆是否为空, 为空返回true, 否则返回false
+bool easeds_heap_is_empty(struct easeds_heap *heap)
+{
+    return easeds_heap_size(heap) == 0;
+}
+
+// 插入一个元素, 成功返回0, 失败返回-1
+int32_t easeds_heap_push(struct easeds_heap *heap, const void *element)
+{
+    if (unlikely(heap == NULL || element == NULL)) {
+        EASEDS_ERR("[easeds_heap_push]: Invalid heap or element pointer.");
+        return -1;
+    }
+
+    if (unlikely(easeds_array_push_back(heap->array, element) != 0)) {
+        return -1;
+    }
+
+    heap_sift_up(heap, heap->array->size - 1);
+    return 0;
+}
+
+// 删除指定下标的元素, 用最后一个元素填补空位, 再根据其优先级上浮或下沉
+static void heap_remove_at(struct easeds_heap *heap, uint32_t index, void *element)
+{
+    void *elem = heap_elem(heap, index);
+
+    if (heap->set_index != NULL) {
+        heap->set_index(elem, EASEDS_HEAP_INVALID_INDEX, heap->user_data);
+    }
+    if (element != NULL) {
+        memcpy(element, elem, heap->array->element_size);
+    }
+
+    uint32_t last = heap->array->size - 1;
+    if (index != last) {
+        memcpy(elem, heap_elem(heap, last), heap->array->element_size);
+    }
+    heap->array->size--;
+
+    if (index == last) {
+        return;
+    }
+
+    if (index > 0 && heap->compare(elem, heap_elem(heap, (index - 1) / heap->arity)) < 0) {
+        heap_sift_up(heap, index);
+    } else {
+        heap_sift_down(heap, index);
+    }
+}
+
+// 弹出堆顶元素, element 非空时复制到 element, 成功返回0, 失败返回-1
+int32_t easeds_heap_pop(struct easeds_heap *heap, void *element)
+{
+    if (unlikely(heap == NULL)) {
+        EASEDS_ERR("[easeds_heap_pop]: Invalid heap pointer.");
+        return -1;
+    }
+
+    if (heap->array->size == 0) {
+        EASEDS_ERR("[easeds_heap_pop]: Cannot pop from an empty heap.");
+        return -1;
+    }
+
+    heap_remove_at(heap, 0, element);
+    return 0;
+}
+
+// 获取堆顶元素指针, 成功返回0, 堆为空返回-1
+int32_t easeds_heap_peek(struct easeds_heap *heap, void **element)
+{
+    if (unlikely(heap == NULL || element == NULL)) {
+        EASEDS_ERR("[easeds_heap_peek]: Invalid heap or element pointer.");
+        return -1;
+    }
+
+    if (heap->array->size == 0) {
+        return -1;
+    }
+
+    *element = heap_elem(heap, 0);
+    return 0;
+}
+
+// 获取指定下标的元素指针, 成功返回0, 失败返回-1
+int32_t easeds_heap_get(struct easeds_heap *heap, uint32_t index, void **element)
+{
+    if (unlikely(heap == NULL)) {
+        EASEDS_ERR("[easeds_heap_get]: Invalid heap pointer.");
+        return -1;
+    }
+
+    return easeds_array_get(heap->array, index, element);
+}
+
+// 指定下标的元素优先级变化后恢复堆序, 支持优先级升高和降低, 成功返回0, 失败返回-1
+int32_t easeds_heap_update(struct easeds_heap *heap, uint32_t index)
+{
+    if (unlikely(heap == NULL)) {
+        EASEDS_ERR("[easeds_heap_update]: Invalid heap pointer.");
+        return -1;
+    }
+
+    if (index >= heap->array->size) {
+        EASEDS_ERR(
+            "[easeds_heap_update]: Index %u out of bounds, size is %u.", index, heap->array->size);
+        return -1;
+    }
+
+    void *elem = heap_elem(heap, index);
+    if (index > 0 && heap->compare(elem, heap_elem(heap, (index - 1) / heap->arity)) < 0) {
+        heap_sift_up(heap, index);
+    } else {
+        heap_sift_down(heap, index);
+    }
+
+    return 0;
+}
+
+// 删除指定下标的元素, element 非空时复制到 element, 成功返回0, 失败返回-1
+int32_t easeds_heap_remove(struct easeds_heap *heap, uint32_t index, void *element)
+{
+    if (unlikely(heap == NULL)) {
+        EASEDS_ERR("[easeds_heap_remove]: Invalid heap pointer.");
+        return -1;
+    }
+
+    if (index >= heap->array->size) {
+        EASEDS_ERR(
+            "[easeds_heap_remove]: Index %u out of bounds, size is %u.", index, heap->array->size);
+        return -1;
+    }
+
+    heap_remove_at(heap, index, element);
+    return 0;
+}
+
+/**
+ * @description: 将数组中的元素批量加入堆并整体建堆.
+ *  先把元素追加到堆数组末尾, 再从最后一个非叶子节点开始逐个下沉(Floyd 算法), 复杂度 O(n),
+ *  优于逐个插入的 O(n log n). 注册了下标回调函数时, 建堆完成后统一通知一遍所有元素的下标.
+ * @param heap 堆指针
+ * @param array 元素数组, 元素大小必须与堆一致, 数组内容不会被修改
+ * @return 成功返回0, 失败返回-1
+ */
+int32_t easeds_heap_heapify(struct easeds_heap *heap, struct easeds_array *array)
+{
+    if (unlikely(heap == NULL || array == NULL)) {
+        EASEDS_ERR("[easeds_heap_heapify]: Invalid heap or array pointer.");
+        return -1;
+    }
+
+    struct easeds_array *dst = heap->array;
+    if (unlikely(array->element_size != dst->element_size)) {
+        EASEDS_ERR("[easeds_heap_heapify]: Element size mismatch, heap %u, array %u.",
+            dst->element_size, array->element_size);
+        return -1;
+    }
+
+    if (array->size == 0) {
+        return 0;
+    }
+
+    uint64_t total = (uint64_t)dst->size + array->size;
+    if (unlikely(total > UINT32_MAX)) {
+        EASEDS_ERR("[easeds_heap_heapify]: Too many elements, total %lu.", total);
+        return -1;
+    }
+
+    if (total > dst->capacity && easeds_array_resize(dst, (uint32_t)total) != 0) {
+        return -1;
+    }
+
+    memcpy(heap_elem(heap, dst->size), array->elements, (size_t)array->size * dst->element_size);
+    dst->size = (uint32_t)total;
+
+    /* 最后一个非叶子节点为最后一个元素的父节点 */
+    if (dst->size > 1) {
+        uint32_t index = (dst->size - 2) / heap->arity + 1;
+        while (index-- > 0) {
+            heap_sift_down(heap, index);
+        }
+    }
+
+    if (heap->set_index != NULL) {
+        for (uint32_t i = 0; i < dst->size; i++) {
+            heap->set_index(heap_elem(heap, i), i, heap->user_data);
+        }
+    }
+
+    PFL_DEBUG("Heapified %u elements, heap size is %u.", array->size, dst->size);
+    return 0;
+}
+
+// 校验堆序, 正确返回0, 异常返回-1
+int32_t easeds_heap_verify(struct easeds_heap *heap)
+{
+    if (unlikely(heap == NULL)) {
+        EASEDS_ERR("[easeds_heap_verify]: Invalid heap pointer.");
+        return -1;
+    }
+
+    for (uint32_t i = 1; i < heap->array->size; i++) {
+        uint32_t parent = (i - 1) / heap->arity;
+        if (heap->compare(heap_elem(heap, i), heap_elem(heap, parent)) < 0) {
+            EASEDS_ERR("[easeds_heap_verify]: Element %u has higher priority than parent %u.", i,
+                parent);
+            return -1;
+        }
+    }
+
+    return 0;
+}
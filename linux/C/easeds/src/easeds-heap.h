@@ -0,0 +1,129 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-heap.h
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-18 12:10
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  基于动态数组的 d 叉堆优先队列, 支持二叉堆和四叉堆.
+ *
+ * @History:
+ *  2026年10月18日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#ifndef __EASEDS_HEAP_H__
+#define __EASEDS_HEAP_H__
+
+/* C 标准库头文件 */
+#include <stdbool.h>
+#include <stdint.h>
+
+/* 项目内部头文件 */
+#include "easeds-array.h"
+#include "easeds-public.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * 实现一个 d 叉堆优先队列, 元素按值存放在 easeds_array 中, 插入和弹出复杂度为 O(log n).
+ *  (1) compare(a, b) < 0 表示 a 的优先级高于 b, 堆顶总是优先级最高的元素(最小堆语义).
+ *  (2) 分叉数可选 2 或 4, 四叉堆树高减半, 同一父节点的 4 个子节点通常位于同一缓存行,
+ *      下沉时缓存未命中更少, 适合弹出操作频繁且元素较小的场景.
+ *  (3) 支持从已有数组批量建堆(Floyd 算法), 复杂度 O(n).
+ *  (4) 可选注册下标回调, 元素每次移动到新下标时通知用户, 移出堆时通知 EASEDS_HEAP_INVALID_INDEX.
+ *      用户据此记录元素下标, 原地修改优先级后调用 easeds_heap_update 恢复堆序(decrease-key).
+ *  (5) 非线程安全, 需要用户自行保证线程安全性.
+ */
+struct easeds_heap {
+    const char          *name;  /* 名称, 预留字段, 可用于调试和日志输出 */
+    struct easeds_array *array; /* 元素存储数组 */
+    void                *temp;  /* 元素大小的临时空间, 用于元素交换 */
+    /* 比较函数, 返回值小于0表示 a 的优先级高于 b */
+    int32_t (*compare)(const void *a, const void *b);
+    /* 下标回调函数, 可选, 元素移动到新下标时调用 */
+    void (*set_index)(void *element, uint32_t index, void *user_data);
+    void    *user_data; /* 下标回调函数的用户数据 */
+    uint32_t arity;     /* 分叉数, 2 或 4 */
+    uint32_t flags;     /* 标志位, 预留字段 */
+};
+
+/* 元素不在堆中时的下标 */
+#define EASEDS_HEAP_INVALID_INDEX UINT32_MAX
+
+/**
+ * 常见堆操作函数:
+ *
+ * 函数名                       功能描述
+ * ------------------------     ------------------------------------------------------
+ * easeds_heap_create           创建一个空堆, 返回堆指针, 失败返回NULL
+ * easeds_heap_destroy          销毁堆, 释放内存
+ * easeds_heap_clear            清空堆, 删除所有元素, 但不释放内存
+ * easeds_heap_set_index_cb     设置下标回调函数, 用于原地更新元素优先级
+ * easeds_heap_size             获取堆中元素数量
+ * easeds_heap_is_empty         判断堆是否为空, 为空返回true, 否则返回false
+ * easeds_heap_push             插入一个元素, 成功返回0, 失败返回-1
+ * easeds_heap_pop              弹出堆顶元素, element 非空时复制到 element, 成功返回0, 失败返回-1
+ * easeds_heap_peek             获取堆顶元素指针, 成功返回0, 堆为空返回-1
+ * easeds_heap_get              获取指定下标的元素指针, 成功返回0, 失败返回-1
+ * easeds_heap_update           指定下标的元素优先级变化后恢复堆序, 成功返回0, 失败返回-1
+ * easeds_heap_remove           删除指定下标的元素, 成功返回0, 失败返回-1
+ * easeds_heap_heapify          将数组中的元素批量加入堆并整体建堆, 成功返回0, 失败返回-1
+ * easeds_heap_verify           校验堆序, 正确返回0, 异常返回-1
+ */
+
+// 创建一个空堆, arity 为 2 或 4, initial_capacity 为0时使用默认容量, 失败返回NULL
+struct easeds_heap *easeds_heap_create(const char *name, uint32_t element_size, uint32_t arity,
+    int32_t (*compare)(const void *a, const void *b), uint32_t initial_capacity);
+
+// 销毁堆, 释放内存
+void easeds_heap_destroy(struct easeds_heap *heap);
+
+// 清空堆, 删除所有元素, 但不释放内存, 不会调用下标回调函数
+void easeds_heap_clear(struct easeds_heap *heap);
+
+// 设置下标回调函数, 用于原地更新元素优先级
+void easeds_heap_set_index_cb(struct easeds_heap *heap,
+    void (*set_index)(void *element, uint32_t index, void *user_data), void *user_data);
+
+// 获取堆中元素数量
+uint32_t easeds_heap_size(struct easeds_heap *heap);
+
+// 判断堆是否为空, 为空返回true, 否则返回false
+bool easeds_heap_is_empty(struct easeds_heap *heap);
+
+// 插入一个元素, 成功返回0, 失败返回-1
+int32_t easeds_heap_push(struct easeds_heap *heap, const void *element);
+
+// 弹出堆顶元素, element 非空时复制到 element, 成功返回0, 失败返回-1
+int32_t easeds_heap_pop(struct easeds_heap *heap, void *element);
+
+// 获取堆顶元素指针, 成功返回0, 堆为空返回-1
+int32_t easeds_heap_peek(struct easeds_heap *heap, void **element);
+
+// 获取指定下标的元素指针, 成功返回0, 失败返回-1
+int32_t easeds_heap_get(struct easeds_heap *heap, uint32_t index, void **element);
+
+// 指定下标的元素优先级变化后恢复堆序, 支持优先级升高和降低, 成功返回0, 失败返回-1
+int32_t easeds_heap_update(struct easeds_heap *heap, uint32_t index);
+
+// 删除指定下标的元素, element 非空时复制到 element, 成功返回0, 失败返回-1
+int32_t easeds_heap_remove(struct easeds_heap *heap, uint32_t index, void *element);
+
+// 将数组中的元素批量加入堆并整体建堆, 元素大小必须一致, 成功返回0, 失败返回-1
+int32_t easeds_heap_heapify(struct easeds_heap *heap, struct easeds_array *array);
+
+// 校验堆序, 正确返回0, 异常返回-1
+int32_t easeds_heap_verify(struct easeds_heap *heap);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __EASEDS_HEAP_H__ */
@@ -0,0 +1,469 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-intseq-unittest.c
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-19 00:40
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  Easeds 压缩整数序列单元测试实现文件, 包含了追加/随机访问/范围解码/编码选择/有序查找和性能测试.
+ *
+ * @History:
+ *  2026年10月19日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#include "easeds-unittest.h"
+
+// 项目内部头文件
+#include "easeds-intseq.h"
+#include "easeds-utils.h"
+
+// xorshift 伪随机数
+static uint64_t intseq_rand(uint64_t *seed)
+{
+    *seed ^= *seed << 13;
+    *seed ^= *seed >> 7;
+    *seed ^= *seed << 17;
+    return *seed;
+}
+
+// 遍历回调: 累加元素值
+static void intseq_sum_cb(uint64_t value, void *user_data)
+{
+    *(uint64_t *)user_data += value;
+}
+
+// 在 expect 中二分查找第一个不小于 value 的下标
+static uint64_t intseq_ref_lower_bound(const uint64_t *expect, uint64_t count, uint64_t value)
+{
+    uint64_t lo = 0, hi = count;
+    while (lo < hi) {
+        uint64_t mid = lo + (hi - lo) / 2;
+        if (expect[mid] < value) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+// 用 expect 重建序列, 并校验随机访问/范围解码/遍历/有序查找的结果
+static void intseq_check(
+    struct easeds_intseq *seq, const uint64_t *expect, uint64_t count, uint64_t *seed)
+{
+    uint64_t *out = malloc((size_t)(count + 1) * sizeof(uint64_t));
+    assert_non_null(out);
+
+    easeds_intseq_clear(seq);
+    assert_int_equal(easeds_intseq_append_bulk(seq, expect, count), 0);
+    assert_int_equal(easeds_intseq_size(seq), count);
+
+    /* 顺序访问和随机访问 */
+    uint64_t value = 0, sum = 0, expect_sum = 0;
+    for (uint64_t i = 0; i < count; i++) {
+        assert_int_equal(easeds_intseq_get(seq, i, &value), 0);
+        assert_int_equal(value, expect[i]);
+        expect_sum += expect[i];
+    }
+    for (uint32_t r = 0; r < 1000 && count > 0; r++) {
+        uint64_t i = intseq_rand(seed) % count;
+        assert_int_equal(easeds_intseq_get(seq, i, &value), 0);
+        assert_int_equal(value, expect[i]);
+    }
+
+    /* 整体解码, 以及起止位置随机的范围解码 */
+    assert_int_equal(easeds_intseq_decode(seq, 0, count, out), 0);
+    assert_memory_equal(out, expect, (size_t)count * sizeof(uint64_t));
+    for (uint32_t r = 0; r < 100 && count > 0; r++) {
+        uint64_t start = intseq_rand(seed) % count;
+        uint64_t n     = intseq_rand(seed) % (count - start + 1);
+        assert_int_equal(easeds_intseq_decode(seq, start, n, out), 0);
+        assert_memory_equal(out, expect + start, (size_t)n * sizeof(uint64_t));
+    }
+
+    easeds_intseq_foreach(seq, intseq_sum_cb, &sum);
+    assert_int_equal(sum, expect_sum);
+
+    /* 有序序列的查找结果与参考实现一致 */
+    if (easeds_intseq_is_sorted(seq)) {
+        for (uint32_t r = 0; r < 1000 && count > 0; r++) {
+            uint64_t probe = expect[intseq_rand(seed) % count] + (intseq_rand(seed) % 3) - 1;
+            uint64_t index = UINT64_MAX;
+            assert_int_equal(easeds_intseq_lower_bound(seq, probe, &index), 0);
+            assert_int_equal(index, intseq_ref_lower_bound(expect, count, probe));
+        }
+    }
+
+    free(out);
+}
+
+// 基本功能测试: 创建/追加/访问/压缩统计/销毁
+static void test_easeds_intseq_basic(void **state)
+{
+    easeds_unused(state);
+
+    struct easeds_intseq *seq = easeds_intseq_create("basic", 0);
+    assert_non_null(seq);
+    assert_int_equal(easeds_intseq_size(seq), 0);
+    assert_true(easeds_intseq_is_empty(seq));
+    assert_true(easeds_intseq_is_sorted(seq));
+
+    /* 1000 个有序 id, 相邻差值在 [1, 64] 之间 */
+    uint64_t expect[1000];
+    uint64_t seed = 88172645463325252ULL;
+    uint64_t id   = 1ULL << 40;
+    for (uint32_t i = 0; i < 1000; i++) {
+        id += intseq_rand(&seed) % 64 + 1;
+        expect[i] = id;
+        assert_int_equal(easeds_intseq_append(seq, id), 0);
+    }
+    assert_int_equal(easeds_intseq_size(seq), 1000);
+    assert_false(easeds_intseq_is_empty(seq));
+    assert_true(easeds_intseq_is_sorted(seq));
+
+    uint64_t value = 0;
+    for (uint32_t i = 0; i < 1000; i++) {
+        assert_int_equal(easeds_intseq_get(seq, i, &value), 0);
+        assert_int_equal(value, expect[i]);
+    }
+
+    /* 7 个完整块全部位打包, 每个差值不超过 6 位, 剩余 104 个元素在尾部缓冲区 */
+    struct easeds_intseq_stats stats;
+    assert_int_equal(easeds_intseq_stats(seq, &stats), 0);
+    assert_int_equal(stats.count, 1000);
+    assert_int_equal(stats.raw_bytes, 8000);
+    assert_int_equal(stats.packed_blocks, 7);
+    assert_int_equal(stats.varint_blocks, 0);
+    assert_int_equal(seq->tail_count, 104);
+    assert_true(stats.compressed_bytes < stats.raw_bytes);
+    assert_true(stats.ratio > 1.0);
+
+    easeds_intseq_clear(seq);
+    assert_true(easeds_intseq_is_empty(seq));
+    assert_int_equal(easeds_intseq_get(seq, 0, &value), -1);
+    easeds_intseq_destroy(seq);
+}
+
+// 基本功能测试: 各种数据分布下的编码选择和访问正确性
+static void test_easeds_intseq_operations(void **state)
+{
+    easeds_unused(state);
+
+    const uint64_t count  = 5000;
+    uint64_t       seed   = 88172645463325252ULL;
+    uint64_t      *expect = malloc((size_t)count * sizeof(uint64_t));
+    assert_non_null(expect);
+
+    struct easeds_intseq *seq = easeds_intseq_create("operations", 4);
+    assert_non_null(seq);
+
+    struct easeds_intseq_stats stats;
+    for (uint32_t pattern = 0; pattern < 6; pattern++) {
+        uint64_t id = 1ULL << 40;
+        for (uint64_t i = 0; i < count; i++) {
+            switch (pattern) {
+            case 0: /* 有序, 差值较小 */
+                id += intseq_rand(&seed) % 1000;
+                break;
+            case 1: /* 有序, 偶尔出现巨大的差值 */
+                id += (i % 200 == 199) ? (1ULL << 40) : intseq_rand(&seed) % 16;
+                break;
+            case 2: /* 完全随机 */
+                id = intseq_rand(&seed);
+                break;
+            case 3: /* 全部相同 */
+                break;
+            case 4: /* 单调递减, 基准为负数 */
+                id -= 3;
+                break;
+            default: /* 大小交替 */
+                id = (i & 1) ? (1ULL << 40) + i : i;
+                break;
+            }
+            expect[i] = id;
+        }
+
+        intseq_check(seq, expect, count, &seed);
+        assert_int_equal(easeds_intseq_stats(seq, &stats), 0);
+        assert_int_equal(stats.packed_blocks + stats.varint_blocks, count / 128);
+
+        switch (pattern) {
+        case 0:
+            assert_true(easeds_intseq_is_sorted(seq));
+            assert_int_equal(stats.varint_blocks, 0);
+            assert_true(stats.ratio > 5.0);
+            break;
+        case 1:
+            /* 含巨大差值的块改用变长整数, 其余块位打包 */
+            assert_true(easeds_intseq_is_sorted(seq));
+            assert_true(stats.varint_blocks > 0);
+            assert_true(stats.packed_blocks > 0);
+            break;
+        case 2:
+            assert_false(easeds_intseq_is_sorted(seq));
+            assert_int_equal(stats.packed_blocks, 0);
+            break;
+        case 3:
+        case 4:
+            /* 差值全部相同, 位宽为0, 不占用压缩数据 */
+            assert_int_equal(easeds_intseq_is_sorted(seq), pattern == 3);
+            assert_int_equal(seq->data_size, 0);
+            assert_int_equal(stats.packed_blocks, count / 128);
+            break;
+        default:
+            assert_false(easeds_intseq_is_sorted(seq));
+            break;
+        }
+    }
+
+    easeds_intseq_destroy(seq);
+    free(expect);
+}
+
+// 边界测试: 空序列/恰好一块/位宽 1~33/数值回绕
+static void test_easeds_intseq_boundary(void **state)
+{
+    easeds_unused(state);
+
+    uint64_t              seed = 88172645463325252ULL;
+    uint64_t              expect[4 * EASEDS_INTSEQ_BLOCK_SIZE];
+    struct easeds_intseq *seq = easeds_intseq_create("boundary", 1);
+    assert_non_null(seq);
+
+    /* 空序列 */
+    uint64_t value = 0, index = 1;
+    assert_int_equal(easeds_intseq_decode(seq, 0, 0, NULL), 0);
+    assert_int_equal(easeds_intseq_lower_bound(seq, 5, &index), 0);
+    assert_int_equal(index, 0);
+
+    /* 恰好一块时仍在尾部缓冲区, 再追加一个元素才压缩 */
+    for (uint64_t i = 0; i < EASEDS_INTSEQ_BLOCK_SIZE; i++) {
+        assert_int_equal(easeds_intseq_append(seq, i * 10), 0);
+    }
+    assert_int_equal(seq->blocks->size, 0);
+    assert_int_equal(easeds_intseq_append(seq, 5000), 0);
+    assert_int_equal(seq->blocks->size, 1);
+    assert_int_equal(easeds_intseq_get(seq, 127, &value), 0);
+    assert_int_equal(value, 1270);
+    assert_int_equal(easeds_intseq_get(seq, 128, &value), 0);
+    assert_int_equal(value, 5000);
+    assert_int_equal(easeds_intseq_lower_bound(seq, 1271, &index), 0);
+    assert_int_equal(index, 128);
+    assert_int_equal(easeds_intseq_lower_bound(seq, 5001, &index), 0);
+    assert_int_equal(index, 129);
+
+    /* 位宽 1~32 使用位打包, 33 超过打包上限改用变长整数, 每块都包含差值 0 和最大值 */
+    for (uint32_t bits = 1; bits <= 33; bits++) {
+        uint64_t max = (1ULL << bits) - 1;
+        uint64_t id  = 0;
+        for (uint32_t i = 0; i < 3 * EASEDS_INTSEQ_BLOCK_SIZE; i++) {
+            uint32_t pos = i % EASEDS_INTSEQ_BLOCK_SIZE;
+            if (pos == 1) {
+                id += 0;
+            } else if (pos == 2) {
+                id += max;
+            } else if (pos > 2) {
+                id += intseq_rand(&seed) & max;
+            }
+            expect[i] = id;
+        }
+        expect[3 * EASEDS_INTSEQ_BLOCK_SIZE] = id;
+        intseq_check(seq, expect, 3 * EASEDS_INTSEQ_BLOCK_SIZE + 1, &seed);
+
+        const struct easeds_intseq_block *block = seq->blocks->elements;
+        for (uint32_t b = 0; b < 3; b++) {
+            assert_int_equal(block[b].base, 0);
+            if (bits <= 32) {
+                assert_int_equal(block[b].encoding, EASEDS_INTSEQ_ENC_PACKED);
+                assert_int_equal(block[b].bits, bits);
+                assert_int_equal(block[b].bytes, bits * 16);
+            } else {
+                assert_int_equal(block[b].encoding, EASEDS_INTSEQ_ENC_VARINT);
+            }
+        }
+    }
+
+    /* 数值在 0 和 UINT64_MAX 附近来回跳变, 差值补码回绕 */
+    for (uint32_t i = 0; i < 2 * EASEDS_INTSEQ_BLOCK_SIZE; i++) {
+        expect[i] = (i & 1) ? UINT64_MAX - i : i;
+    }
+    intseq_check(seq, expect, 2 * EASEDS_INTSEQ_BLOCK_SIZE, &seed);
+
+    /* 收缩容量后继续追加 */
+    assert_int_equal(easeds_intseq_shrink(seq), 0);
+    assert_int_equal(seq->data_capacity, seq->data_size);
+    intseq_check(seq, expect, 2 * EASEDS_INTSEQ_BLOCK_SIZE, &seed);
+    easeds_intseq_clear(seq);
+    assert_int_equal(easeds_intseq_shrink(seq), 0);
+    assert_null(seq->data);
+    intseq_check(seq, expect, 3 * EASEDS_INTSEQ_BLOCK_SIZE / 2, &seed);
+    easeds_intseq_destroy(seq);
+
+    /* 新序列的第一块就是固定步长(0 位宽, 0 字节), 收缩后仍可解码 */
+    seq = easeds_intseq_create("boundary-step", 0);
+    assert_non_null(seq);
+    for (uint32_t i = 0; i < 3 * EASEDS_INTSEQ_BLOCK_SIZE + 1; i++) {
+        expect[i] = 1000 + (uint64_t)i * 7;
+    }
+    intseq_check(seq, expect, 3 * EASEDS_INTSEQ_BLOCK_SIZE + 1, &seed);
+    assert_int_equal(seq->data_size, 0);
+    const struct easeds_intseq_block *step = seq->blocks->elements;
+    assert_int_equal(step[0].bits, 0);
+    assert_int_equal(easeds_intseq_shrink(seq), 0);
+    assert_non_null(seq->data);
+    assert_int_equal(easeds_intseq_get(seq, 200, &value), 0);
+    assert_int_equal(value, 1000 + 200 * 7);
+
+    easeds_intseq_destroy(seq);
+}
+
+// 异常测试: 非法参数/越界访问/无序序列查找
+static void test_easeds_intseq_error(void **state)
+{
+    easeds_unused(state);
+
+    struct easeds_intseq      *seq = easeds_intseq_create("error", 0);
+    struct easeds_intseq_stats stats;
+    uint64_t                   value = 0, index = 0, sum = 0;
+    assert_non_null(seq);
+
+    assert_int_equal(easeds_intseq_append(NULL, 1), -1);
+    assert_int_equal(easeds_intseq_append_bulk(seq, NULL, 1), -1);
+    assert_int_equal(easeds_intseq_append_bulk(seq, NULL, 0), 0);
+    assert_int_equal(easeds_intseq_get(seq, 0, &value), -1);
+    assert_int_equal(easeds_intseq_get(seq, 0, NULL), -1);
+    assert_int_equal(easeds_intseq_size(NULL), 0);
+    assert_false(easeds_intseq_is_sorted(NULL));
+    assert_int_equal(easeds_intseq_stats(NULL, &stats), -1);
+    assert_int_equal(easeds_intseq_stats(seq, NULL), -1);
+    assert_int_equal(easeds_intseq_shrink(NULL), -1);
+    easeds_intseq_foreach(seq, NULL, &sum);
+    easeds_intseq_foreach(NULL, intseq_sum_cb, &sum);
+    assert_int_equal(sum, 0);
+
+    for (uint64_t i = 0; i < 300; i++) {
+        assert_int_equal(easeds_intseq_append(seq, i), 0);
+    }
+
+    /* 越界访问和越界范围, 包括 start + count 溢出 */
+    uint64_t out[4];
+    assert_int_equal(easeds_intseq_get(seq, 300, &value), -1);
+    assert_int_equal(easeds_intseq_decode(seq, 298, 3, out), -1);
+    assert_int_equal(easeds_intseq_decode(seq, 301, 0, out), -1);
+    assert_int_equal(easeds_intseq_decode(seq, 2, UINT64_MAX, out), -1);
+    assert_int_equal(easeds_intseq_decode(seq, 0, 1, NULL), -1);
+    assert_int_equal(easeds_intseq_decode(seq, 297, 3, out), 0);
+    assert_int_equal(out[2], 299);
+
+    /* 追加一个更小的值后序列不再有序, 拒绝二分查找 */
+    assert_int_equal(easeds_intseq_lower_bound(seq, 100, &index), 0);
+    assert_int_equal(index, 100);
+    assert_int_equal(easeds_intseq_lower_bound(seq, 100, NULL), -1);
+    assert_int_equal(easeds_intseq_append(seq, 7), 0);
+    assert_false(easeds_intseq_is_sorted(seq));
+    assert_int_equal(easeds_intseq_lower_bound(seq, 100, &index), -1);
+    assert_int_equal(easeds_intseq_get(seq, 300, &value), 0);
+    assert_int_equal(value, 7);
+
+    /* 清空后恢复有序标志 */
+    easeds_intseq_clear(seq);
+    assert_true(easeds_intseq_is_sorted(seq));
+
+    easeds_intseq_destroy(seq);
+    easeds_intseq_destroy(NULL);
+}
+
+// 性能测试: 有序 id 的压缩比, 顺序解码和随机访问与普通数组对比
+static void test_easeds_intseq_perf(void **state)
+{
+    easeds_unused(state);
+
+    const uint64_t count  = 4000000;
+    const uint32_t probes = 1000000;
+    const uint32_t chunk  = 4096;
+    uint64_t       seed   = 88172645463325252ULL;
+    uint64_t      *ids    = malloc((size_t)count * sizeof(uint64_t));
+    uint64_t      *buffer = malloc((size_t)chunk * sizeof(uint64_t));
+    assert_non_null(ids);
+    assert_non_null(buffer);
+
+    /* 有序 id, 相邻差值在 [1, 1024] 之间, 约需 10 位 */
+    uint64_t id = 1ULL << 40;
+    for (uint64_t i = 0; i < count; i++) {
+        id += intseq_rand(&seed) % 1024 + 1;
+        ids[i] = id;
+    }
+
+    struct easeds_intseq *seq = easeds_intseq_create("perf", 0);
+    assert_non_null(seq);
+
+    int64_t start = easeds_get_current_time_ns();
+    assert_int_equal(easeds_intseq_append_bulk(seq, ids, count), 0);
+    double append_ns = (double)(easeds_get_current_time_ns() - start) / (double)count;
+    assert_int_equal(easeds_intseq_shrink(seq), 0);
+
+    struct easeds_intseq_stats stats;
+    assert_int_equal(easeds_intseq_stats(seq, &stats), 0);
+
+    /* 顺序扫描: 分段解码后求和, 与直接遍历数组对比 */
+    uint64_t sum = 0, expect_sum = 0;
+    start        = easeds_get_current_time_ns();
+    for (uint64_t pos = 0; pos < count; pos += chunk) {
+        uint64_t n = count - pos < chunk ? count - pos : chunk;
+        assert_int_equal(easeds_intseq_decode(seq, pos, n, buffer), 0);
+        for (uint64_t i = 0; i < n; i++) {
+            sum += buffer[i];
+        }
+    }
+    double scan_ns = (double)(easeds_get_current_time_ns() - start) / (double)count;
+
+    start = easeds_get_current_time_ns();
+    for (uint64_t i = 0; i < count; i++) {
+        expect_sum += ids[i];
+    }
+    double array_scan_ns = (double)(easeds_get_current_time_ns() - start) / (double)count;
+    assert_int_equal(sum, expect_sum);
+
+    /* 随机访问和有序查找 */
+    uint64_t value = 0, index = 0;
+    start          = easeds_get_current_time_ns();
+    for (uint32_t r = 0; r < probes; r++) {
+        uint64_t i = intseq_rand(&seed) % count;
+        assert_int_equal(easeds_intseq_get(seq, i, &value), 0);
+        sum += value;
+    }
+    double get_ns = (double)(easeds_get_current_time_ns() - start) / probes;
+
+    start = easeds_get_current_time_ns();
+    for (uint32_t r = 0; r < probes; r++) {
+        uint64_t i = intseq_rand(&seed) % count;
+        assert_int_equal(easeds_intseq_lower_bound(seq, ids[i], &index), 0);
+        assert_int_equal(index, i);
+    }
+    double search_ns = (double)(easeds_get_current_time_ns() - start) / probes;
+
+    MEASURE("[intseq perf]: %lu sorted ids, %lu -> %lu bytes (ratio %.2f, %lu packed / %lu varint "
+            "blocks), append %.1f ns, scan %.2f ns/value (array %.2f ns), get %.1f ns, "
+            "lower_bound %.1f ns.",
+        count, stats.raw_bytes, stats.compressed_bytes, stats.ratio, stats.packed_blocks,
+        stats.varint_blocks, append_ns, scan_ns, array_scan_ns, get_ns, search_ns);
+
+    easeds_intseq_destroy(seq);
+    free(ids);
+    free(buffer);
+}
+
+// 注册单元测试用例
+EASEDS_UNITTEST_REGISTER(easeds_unittest_intseq){
+    cmocka_unit_test(test_easeds_intseq_basic),
+    cmocka_unit_test(test_easeds_intseq_operations),
+    cmocka_unit_test(test_easeds_intseq_boundary),
+    cmocka_unit_test(test_easeds_intseq_error),
+    cmocka_unit_test(test_easeds_intseq_perf),
+    easeds_unit_test_end,
+};
@@ -0,0 +1,639 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-intseq.c
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-19 00:40
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  压缩整数序列实现, 每块在位打包和变长整数之间选择较小的编码, 位打包数据使用 SSE2 解码.
+ *
+ * @History:
+ *  2026年10月19日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#include "easeds-intseq.h"
+
+// 标准库头文件
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+// 项目内部头文件
+#include "easeds-log.h"
+
+// 压缩数据缓冲区初始容量, 单位字节
+#define INTSEQ_DATA_INITIAL_CAPACITY 4096
+
+// 块内元素数量的简写
+#define INTSEQ_BLOCK EASEDS_INTSEQ_BLOCK_SIZE
+
+// 获取第 index 个块的索引项
+static inline struct easeds_intseq_block *intseq_block(
+    const struct easeds_intseq *seq, uint64_t index)
+{
+    return (struct easeds_intseq_block *)seq->blocks->elements + index;
+}
+
+// 已压缩的块数
+static inline uint64_t intseq_block_count(const struct easeds_intseq *seq)
+{
+    return seq->blocks->size;
+}
+
+// 变长整数编码后的字节数, 每字节保存 7 位
+static inline uint32_t intseq_varint_len(uint64_t value)
+{
+    uint32_t len = 1;
+    while (value >= 0x80) {
+        value >>= 7;
+        len++;
+    }
+    return len;
+}
+
+// 变长整数编码, 低 7 位在前, 最高位为1表示后面还有字节, 返回写入后的位置
+static inline uint8_t *intseq_varint_put(uint8_t *dst, uint64_t value)
+{
+    while (value >= 0x80) {
+        *dst++ = (uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+    *dst++ = (uint8_t)value;
+    return dst;
+}
+
+// 变长整数解码, 返回读取后的位置
+static inline const uint8_t *intseq_varint_get(const uint8_t *src, uint64_t *value)
+{
+    uint64_t result = 0;
+    uint32_t shift  = 0;
+    for (;;) {
+        uint8_t byte = *src++;
+        result |= (uint64_t)(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            break;
+        }
+        shift += 7;
+    }
+    *value = result;
+    return src;
+}
+
+/**
+ * 按 4 路交错布局打包 128 个值, 第 i 个值位于第 i % 4 路的第 i / 4 个位置, 每路 32 个值
+ * 连续打包成 bits 个 32 位字, 4 路的同一个字相邻存放, 刚好组成一个 128 位 SIMD 字.
+ * 打包后共 bits * 16 字节.
+ */
+static void intseq_pack(const uint64_t *values, uint32_t bits, uint32_t *words)
+{
+    if (bits == 0) {
+        return;
+    }
+
+    memset(words, 0, (size_t)bits * 4 * sizeof(uint32_t));
+    for (uint32_t i = 0; i < INTSEQ_BLOCK; i++) {
+        uint32_t value = (uint32_t)values[i];
+        uint32_t pos   = (i / 4) * bits;
+        uint32_t lane  = i % 4;
+        uint32_t word  = pos / 32;
+        uint32_t shift = pos % 32;
+        words[word * 4 + lane] |= value << shift;
+        if (shift + bits > 32) {
+            words[(word + 1) * 4 + lane] |= value >> (32 - shift);
+        }
+    }
+}
+
+// 解包 intseq_pack 打包的 128 个值, 支持 SSE2 时 4 路同时解包
+static void intseq_unpack(const uint8_t *src, uint32_t bits, uint32_t *out)
+{
+    if (bits == 0) {
+        memset(out, 0, INTSEQ_BLOCK * sizeof(uint32_t));
+        return;
+    }
+
+#ifdef __SSE2__
+    const __m128i *in   = (const __m128i *)src;
+    const __m128i  mask = _mm_set1_epi32(bits == 32 ? -1 : (int)((1U << bits) - 1));
+    __m128i        cur  = _mm_loadu_si128(in);
+    uint32_t       word = 0, shift = 0;
+
+    for (uint32_t k = 0; k < INTSEQ_BLOCK / 4; k++) {
+        __m128i value = _mm_srl_epi32(cur, _mm_cvtsi32_si128((int)shift));
+        shift += bits;
+        if (shift >= 32) {
+            /* 当前字已用完, 跨字的值由下一个字的低位补齐 */
+            shift -= 32;
+            if (++word < bits) {
+                cur = _mm_loadu_si128(in + word);
+                if (shift > 0) {
+                    __m128i high = _mm_sll_epi32(cur, _mm_cvtsi32_si128((int)(bits - shift)));
+                    value        = _mm_or_si128(value, high);
+                }
+            }
+        }
+        _mm_storeu_si128((__m128i *)(out + k * 4), _mm_and_si128(value, mask));
+    }
+#else
+    const uint32_t mask = bits == 32 ? UINT32_MAX : (1U << bits) - 1;
+    uint32_t       words[4 * 32];
+
+    memcpy(words, src, (size_t)bits * 4 * sizeof(uint32_t));
+    for (uint32_t i = 0; i < INTSEQ_BLOCK; i++) {
+        uint32_t pos   = (i / 4) * bits;
+        uint32_t lane  = i % 4;
+        uint32_t word  = pos / 32;
+        uint32_t shift = pos % 32;
+        uint32_t value = words[word * 4 + lane] >> shift;
+        if (shift + bits > 32) {
+            value |= words[(word + 1) * 4 + lane] << (32 - shift);
+        }
+        out[i] = value & mask;
+    }
+#endif
+}
+
+// 确保压缩数据缓冲区容量不少于 need 字节, 按2倍扩容, 成功返回0, 失败返回-1
+// 第一块压缩时即使是 0 位宽(0 字节)也申请缓冲区, 保证有块时 data 非空
+static int32_t intseq_reserve(struct easeds_intseq *seq, uint64_t need)
+{
+    if (seq->data != NULL && need <= seq->data_capacity) {
+        return 0;
+    }
+
+    uint64_t capacity = seq->data_capacity ? seq->data_capacity : INTSEQ_DATA_INITIAL_CAPACITY;
+    while (capacity < need) {
+        capacity *= 2;
+    }
+
+    uint8_t *data = realloc(seq->data, capacity);
+    if (unlikely(data == NULL)) {
+        return -1;
+    }
+
+    seq->data          = data;
+    seq->data_capacity = capacity;
+    return 0;
+}
+
+/**
+ * 压缩尾部缓冲区中的一整块元素, 追加到压缩数据和块跳跃索引.
+ * 第一个元素保存在索引中, 其余元素计算差值 d[i] = v[i] - v[i - 1], 减去最小差值后得到
+ * 非负结果, 第 0 个位置固定为0. 位宽不超过 32 时计算打包字节数, 与变长整数字节数比较,
+ * 选择较小的一种.
+ */
+static int32_t intseq_flush(struct easeds_intseq *seq)
+{
+    const uint64_t            *values = seq->tail;
+    uint64_t                   deltas[INTSEQ_BLOCK];
+    struct easeds_intseq_block block;
+    int64_t                    min = INT64_MAX;
+
+    for (uint32_t i = 1; i < INTSEQ_BLOCK; i++) {
+        deltas[i] = values[i] - values[i - 1];
+        if ((int64_t)deltas[i] < min) {
+            min = (int64_t)deltas[i];
+        }
+    }
+    deltas[0] = (uint64_t)min; /* 减去基准后为0, 不影响位宽 */
+
+    uint64_t merged = 0, varint_bytes = 0;
+    for (uint32_t i = 0; i < INTSEQ_BLOCK; i++) {
+        deltas[i] -= (uint64_t)min;
+        merged |= deltas[i];
+        varint_bytes += intseq_varint_len(deltas[i]);
+    }
+
+    uint32_t bits         = merged == 0 ? 0 : 64 - (uint32_t)__builtin_clzll(merged);
+    uint64_t packed_bytes = bits <= 32 ? (uint64_t)bits * 16 : UINT64_MAX;
+
+    memset(&block, 0, sizeof(block));
+    block.first  = values[0];
+    block.base   = (uint64_t)min;
+    block.offset = seq->data_size;
+    if (packed_bytes <= varint_bytes) {
+        block.encoding = EASEDS_INTSEQ_ENC_PACKED;
+        block.bits     = (uint8_t)bits;
+        block.bytes    = (uint32_t)packed_bytes;
+    } else {
+        block.encoding = EASEDS_INTSEQ_ENC_VARINT;
+        block.bytes    = (uint32_t)varint_bytes;
+    }
+
+    if (unlikely(intseq_reserve(seq, seq->data_size + block.bytes) != 0)) {
+        EASEDS_ERR("[intseq_flush]: Failed to reallocate memory for compressed data.");
+        return -1;
+    }
+
+    uint8_t *dst = seq->data + seq->data_size;
+    if (block.encoding == EASEDS_INTSEQ_ENC_PACKED) {
+        uint32_t words[4 * 32];
+        intseq_pack(deltas, bits, words);
+        memcpy(dst, words, block.bytes);
+    } else {
+        for (uint32_t i = 0; i < INTSEQ_BLOCK; i++) {
+            dst = intseq_varint_put(dst, deltas[i]);
+        }
+    }
+
+    /* 索引追加成功后才提交数据, 失败时尾部缓冲区保持不变 */
+    if (unlikely(easeds_array_push_back(seq->blocks, &block) != 0)) {
+        EASEDS_ERR("[intseq_flush]: Failed to append block index.");
+        return -1;
+    }
+    seq->data_size += block.bytes;
+    seq->tail_count = 0;
+
+    PFL_DEBUG("Flushed block %u: encoding=%u, bits=%u, bytes=%u.", seq->blocks->size - 1,
+        (uint32_t)block.encoding, (uint32_t)block.bits, block.bytes);
+    return 0;
+}
+
+// 解码第 index 个块的全部元素到 out
+static void intseq_decode_block(const struct easeds_intseq *seq, uint64_t index, uint64_t *out)
+{
+    const struct easeds_intseq_block *block = intseq_block(seq, index);
+    const uint8_t                    *src   = seq->data + block->offset;
+    uint64_t                          value = block->first;
+
+    /* 第 0 个位置固定为0, 跳过 */
+    out[0] = value;
+    if (block->encoding == EASEDS_INTSEQ_ENC_PACKED) {
+        uint32_t deltas[INTSEQ_BLOCK];
+        intseq_unpack(src, block->bits, deltas);
+        for (uint32_t i = 1; i < INTSEQ_BLOCK; i++) {
+            value += deltas[i] + block->base;
+            out[i] = value;
+        }
+    } else {
+        uint64_t delta;
+        src = intseq_varint_get(src, &delta);
+        for (uint32_t i = 1; i < INTSEQ_BLOCK; i++) {
+            src = intseq_varint_get(src, &delta);
+            value += delta + block->base;
+            out[i] = value;
+        }
+    }
+}
+
+// 获取第 index 个块的解码结果, 块不在缓存中时先解码到缓存
+static inline const uint64_t *intseq_cached_block(struct easeds_intseq *seq, uint64_t index)
+{
+    if (seq->cache_block != index) {
+        intseq_decode_block(seq, index, seq->cache);
+        seq->cache_block = index;
+    }
+    return seq->cache;
+}
+
+/**
+ * @description: 创建一个空序列, 返回序列指针, 失败返回NULL.
+ * @param name 序列名称, 预留字段, 可用于调试和日志输出
+ * @param initial_blocks 块跳跃索引初始容量, 如果为0则使用默认初始容量
+ * @return 成功返回序列指针, 失败返回NULL
+ */
+struct easeds_intseq *easeds_intseq_create(const char *name, uint32_t initial_blocks)
+{
+    struct easeds_intseq *seq = __easeds_malloc(sizeof(struct easeds_intseq));
+    if (unlikely(seq == NULL)) {
+        EASEDS_ERR("[easeds_intseq_create]: Failed to allocate memory for sequence struct.");
+        return NULL;
+    }
+
+    seq->blocks = easeds_array_create(name, sizeof(struct easeds_intseq_block), initial_blocks);
+    if (unlikely(seq->blocks == NULL)) {
+        __easeds_free(seq);
+        return NULL;
+    }
+
+    seq->name          = name;
+    seq->data          = NULL; /* 第一块压缩时再申请 */
+    seq->data_size     = 0;
+    seq->data_capacity = 0;
+    seq->size          = 0;
+    seq->last          = 0;
+    seq->cache_block   = UINT64_MAX;
+    seq->tail_count    = 0;
+    seq->flags         = EASEDS_INTSEQ_F_SORTED;
+
+    PFL_DEBUG("Created intseq: block_size=%u.", INTSEQ_BLOCK);
+    return seq;
+}
+
+// 销毁序列, 释放内存
+void easeds_intseq_destroy(struct easeds_intseq *seq)
+{
+    if (unlikely(seq == NULL)) {
+        return;
+    }
+
+    easeds_array_destroy(seq->blocks);
+    __easeds_free(seq->data);
+    __easeds_free(seq);
+
+    PFL_DEBUG("Destroyed intseq.");
+}
+
+// 清空序列, 删除所有元素, 但不释放内存
+void easeds_intseq_clear(struct easeds_intseq *seq)
+{
+    if (unlikely(seq == NULL)) {
+        return;
+    }
+
+    easeds_array_clear(seq->blocks);
+    seq->data_size   = 0;
+    seq->size        = 0;
+    seq->last        = 0;
+    seq->cache_block = UINT64_MAX;
+    seq->tail_count  = 0;
+    seq->flags       = EASEDS_INTSEQ_F_SORTED;
+}
+
+// 获取序列中元素数量
+uint64_t easeds_intseq_size(struct easeds_intseq *seq)
+{
+    if (unlikely(seq == NULL)) {
+        EASEDS_ERR("[easeds_intseq_size]: Invalid sequence pointer.");
+        return 0;
+    }
+
+    return seq->size;
+}
+
+// 判断序列是否为空, 为空返回true, 否则返回false
+bool easeds_intseq_is_empty(struct easeds_intseq *seq)
+{
+    return easeds_intseq_size(seq) == 0;
+}
+
+// 判断序列是否单调不减
+bool easeds_intseq_is_sorted(struct easeds_intseq *seq)
+{
+    if (unlikely(seq == NULL)) {
+        EASEDS_ERR("[easeds_intseq_is_sorted]: Invalid sequence pointer.");
+        return false;
+    }
+
+    return (seq->flags & EASEDS_INTSEQ_F_SORTED) != 0;
+}
+
+// 在序列末尾追加一个元素, 尾部缓冲区已满时先压缩成块, 成功返回0, 失败返回-1
+int32_t easeds_intseq_append(struct easeds_intseq *seq, uint64_t value)
+{
+    if (unlikely(seq == NULL)) {
+        EASEDS_ERR("[easeds_intseq_append]: Invalid sequence pointer.");
+        return -1;
+    }
+
+    if (seq->tail_count == INTSEQ_BLOCK && unlikely(intseq_flush(seq) != 0)) {
+        return -1;
+    }
+
+    if (seq->size > 0 && value < seq->last) {
+        seq->flags &= ~EASEDS_INTSEQ_F_SORTED;
+    }
+
+    seq->tail[seq->tail_count++] = value;
+    seq->last                    = value;
+    seq->size++;
+    return 0;
+}
+
+// 在序列末尾追加多个元素, 失败时已追加的元素保留, 成功返回0, 失败返回-1
+int32_t easeds_intseq_append_bulk(
+    struct easeds_intseq *seq, const uint64_t *values, uint64_t count)
+{
+    if (unlikely(seq == NULL || (values == NULL && count > 0))) {
+        EASEDS_ERR("[easeds_intseq_append_bulk]: Invalid sequence or values pointer.");
+        return -1;
+    }
+
+    for (uint64_t i = 0; i < count; i++) {
+        if (unlikely(easeds_intseq_append(seq, values[i]) != 0)) {
+            EASEDS_ERR("[easeds_intseq_append_bulk]: Failed to append value %lu.", i);
+            return -1;
+        }
+    }
+    return 0;
+}
+
+// 获取指定下标的元素值, 成功返回0, 失败返回-1
+int32_t easeds_intseq_get(struct easeds_intseq *seq, uint64_t index, uint64_t *value)
+{
+    if (unlikely(seq == NULL || value == NULL)) {
+        EASEDS_ERR("[easeds_intseq_get]: Invalid sequence or value pointer.");
+        return -1;
+    }
+
+    if (index >= seq->size) {
+        EASEDS_ERR("[easeds_intseq_get]: Index %lu out of bounds, size is %lu.", index, seq->size);
+        return -1;
+    }
+
+    uint64_t block = index / INTSEQ_BLOCK;
+    if (block < intseq_block_count(seq)) {
+        *value = intseq_cached_block(seq, block)[index % INTSEQ_BLOCK];
+    } else {
+        *value = seq->tail[index - block * INTSEQ_BLOCK];
+    }
+    return 0;
+}
+
+/**
+ * @description: 解码 [start, start + count) 范围的元素到 out.
+ *  完整的块直接解码到 out, 不经过缓存; 首尾不完整的块经过解码缓存.
+ * @param seq 序列指针
+ * @param start 起始下标
+ * @param count 元素数量
+ * @param out 输出缓冲区, 至少能容纳 count 个元素
+ * @return 成功返回0, 范围越界或参数非法返回-1
+ */
+int32_t easeds_intseq_decode(
+    struct easeds_intseq *seq, uint64_t start, uint64_t count, uint64_t *out)
+{
+    if (unlikely(seq == NULL || (out == NULL && count > 0))) {
+        EASEDS_ERR("[easeds_intseq_decode]: Invalid sequence or output pointer.");
+        return -1;
+    }
+
+    if (start > seq->size || count > seq->size - start) {
+        EASEDS_ERR("[easeds_intseq_decode]: Range [%lu, +%lu) out of bounds, size is %lu.", start,
+            count, seq->size);
+        return -1;
+    }
+
+    const uint64_t nblocks = intseq_block_count(seq);
+    while (count > 0) {
+        uint64_t block  = start / INTSEQ_BLOCK;
+        uint32_t offset = (uint32_t)(start % INTSEQ_BLOCK);
+        uint64_t n      = INTSEQ_BLOCK - offset < count ? INTSEQ_BLOCK - offset : count;
+
+        if (block >= nblocks) {
+            memcpy(out, seq->tail + offset, (size_t)n * sizeof(uint64_t));
+        } else if (n == INTSEQ_BLOCK) {
+            intseq_decode_block(seq, block, out);
+        } else {
+            memcpy(out, intseq_cached_block(seq, block) + offset, (size_t)n * sizeof(uint64_t));
+        }
+
+        out += n;
+        start += n;
+        count -= n;
+    }
+    return 0;
+}
+
+// 按顺序遍历所有元素, 对每个元素执行指定的回调函数
+void easeds_intseq_foreach(
+    struct easeds_intseq *seq, void (*callback)(uint64_t value, void *user_data), void *user_data)
+{
+    if (unlikely(seq == NULL || callback == NULL)) {
+        EASEDS_ERR("[easeds_intseq_foreach]: Invalid sequence pointer or callback function.");
+        return;
+    }
+
+    uint64_t       values[INTSEQ_BLOCK];
+    const uint64_t nblocks = intseq_block_count(seq);
+    for (uint64_t block = 0; block < nblocks; block++) {
+        intseq_decode_block(seq, block, values);
+        for (uint32_t i = 0; i < INTSEQ_BLOCK; i++) {
+            callback(values[i], user_data);
+        }
+    }
+
+    for (uint32_t i = 0; i < seq->tail_count; i++) {
+        callback(seq->tail[i], user_data);
+    }
+}
+
+/**
+ * @description: 有序序列中查找第一个不小于 value 的下标.
+ *  先在块跳跃索引中二分查找第一个元素不小于 value 的块, 目标只可能位于它的前一块中,
+ *  或者就是它的第一个元素, 因此最多解码一个块.
+ * @param seq 序列指针, 必须单调不减
+ * @param value 查找的值
+ * @param index 返回下标, 所有元素都小于 value 时为序列大小
+ * @return 成功返回0, 参数非法或序列无序返回-1
+ */
+int32_t easeds_intseq_lower_bound(struct easeds_intseq *seq, uint64_t value, uint64_t *index)
+{
+    if (unlikely(seq == NULL || index == NULL)) {
+        EASEDS_ERR("[easeds_intseq_lower_bound]: Invalid sequence or index pointer.");
+        return -1;
+    }
+
+    if (unlikely((seq->flags & EASEDS_INTSEQ_F_SORTED) == 0)) {
+        EASEDS_ERR("[easeds_intseq_lower_bound]: Sequence is not sorted.");
+        return -1;
+    }
+
+    /* 统计第一个元素小于 value 的块数 */
+    const uint64_t nblocks = intseq_block_count(seq);
+    uint64_t       lo      = 0, hi = nblocks;
+    while (lo < hi) {
+        uint64_t mid = lo + (hi - lo) / 2;
+        if (intseq_block(seq, mid)->first < value) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    if (lo > 0) {
+        /* 前一块的第一个元素小于 value, 在块内其余元素中二分查找 */
+        const uint64_t *values = intseq_cached_block(seq, lo - 1);
+        uint32_t        left = 1, right = INTSEQ_BLOCK;
+        while (left < right) {
+            uint32_t mid = left + (right - left) / 2;
+            if (values[mid] < value) {
+                left = mid + 1;
+            } else {
+                right = mid;
+            }
+        }
+        if (left < INTSEQ_BLOCK) {
+            *index = (lo - 1) * INTSEQ_BLOCK + left;
+            return 0;
+        }
+    }
+
+    if (lo < nblocks) {
+        *index = lo * INTSEQ_BLOCK;
+        return 0;
+    }
+
+    /* 所有块的元素都小于 value, 继续在尾部缓冲区中查找 */
+    uint32_t i = 0;
+    while (i < seq->tail_count && seq->tail[i] < value) {
+        i++;
+    }
+    *index = nblocks * INTSEQ_BLOCK + i;
+    return 0;
+}
+
+// 释放压缩数据和索引的多余容量, 成功返回0, 失败返回-1
+int32_t easeds_intseq_shrink(struct easeds_intseq *seq)
+{
+    if (unlikely(seq == NULL)) {
+        EASEDS_ERR("[easeds_intseq_shrink]: Invalid sequence pointer.");
+        return -1;
+    }
+
+    /* 只有 0 位宽的块时压缩数据为 0 字节, 仍保留缓冲区, 有块时 data 不能为空 */
+    if (intseq_block_count(seq) == 0) {
+        __easeds_free(seq->data);
+        seq->data          = NULL;
+        seq->data_capacity = 0;
+    } else if (seq->data_size > 0 && seq->data_size < seq->data_capacity) {
+        uint8_t *data = realloc(seq->data, seq->data_size);
+        if (unlikely(data == NULL)) {
+            EASEDS_ERR("[easeds_intseq_shrink]: Failed to shrink compressed data.");
+            return -1;
+        }
+        seq->data          = data;
+        seq->data_capacity = seq->data_size;
+    }
+
+    uint32_t nblocks = seq->blocks->size > 0 ? seq->blocks->size : 1;
+    return easeds_array_resize(seq->blocks, nblocks);
+}
+
+// 获取压缩统计信息, 成功返回0, 失败返回-1
+int32_t easeds_intseq_stats(struct easeds_intseq *seq, struct easeds_intseq_stats *stats)
+{
+    if (unlikely(seq == NULL || stats == NULL)) {
+        EASEDS_ERR("[easeds_intseq_stats]: Invalid sequence or stats pointer.");
+        return -1;
+    }
+
+    const uint64_t nblocks = intseq_block_count(seq);
+    const uint64_t index   = nblocks * sizeof(struct easeds_intseq_block);
+
+    memset(stats, 0, sizeof(*stats));
+    stats->count            = seq->size;
+    stats->raw_bytes        = seq->size * sizeof(uint64_t);
+    stats->compressed_bytes = seq->data_size + index + seq->tail_count * sizeof(uint64_t);
+    stats->memory_bytes     = sizeof(struct easeds_intseq) + sizeof(struct easeds_array)
+                          + seq->data_capacity
+                          + (uint64_t)seq->blocks->capacity * sizeof(struct easeds_intseq_block);
+    for (uint64_t block = 0; block < nblocks; block++) {
+        if (intseq_block(seq, block)->encoding == EASEDS_INTSEQ_ENC_PACKED) {
+            stats->packed_blocks++;
+        } else {
+            stats->varint_blocks++;
+        }
+    }
+    stats->ratio = stats->compressed_bytes > 0
+                       ? (double)stats->raw_bytes / (double)stats->compressed_bytes
+                       : 0.0;
+    return 0;
+}
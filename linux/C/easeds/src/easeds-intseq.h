@@ -0,0 +1,167 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-intseq.h
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-19 00:40
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  压缩整数序列数据结构定义, 差值编码 + 分块位打包(frame-of-reference), 变长整数兜底.
+ *
+ * @History:
+ *  2026年10月19日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#ifndef __EASEDS_INTSEQ_H__
+#define __EASEDS_INTSEQ_H__
+
+/* C 标准库头文件 */
+#include <stdbool.h>
+#include <stdint.h>
+
+/* 项目内部头文件 */
+#include "easeds-array.h"
+#include "easeds-public.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * 实现一个只追加的 uint64_t 压缩整数序列, 适合保存有序 id 等相邻差值较小的大数组.
+ *  (1) 元素每 EASEDS_INTSEQ_BLOCK_SIZE 个一块, 块内保存相邻元素的差值(补码回绕, 允许乱序),
+ *      以块内最小差值为基准(frame-of-reference), 只保存差值减去基准后的结果.
+ *  (2) 块内结果都不超过 32 位时按相同位宽打包, 128 个值按 4 路交错存放(SIMD-BP128 布局),
+ *      支持 SSE2 时一次解出 4 个值; 个别差值过大导致位宽浪费时, 改用变长整数(LEB128)编码,
+ *      每块选择字节数较少的一种.
+ *  (3) 块跳跃索引记录每块的第一个元素, 基准, 编码方式和数据偏移, 随机访问只需解码一个块,
+ *      最近解码的块会被缓存, 按下标顺序访问时每块只解码一次. 序列有序时支持二分查找.
+ *  (4) 最后不足一块的元素以原值保存在尾部缓冲区, 凑满一块后再压缩.
+ *  (5) 提供统计接口, 报告压缩后字节数和压缩比.
+ *  (6) 非线程安全, 只读访问也会更新解码缓存, 需要用户自行保证线程安全性.
+ */
+
+// 每块元素数量
+#define EASEDS_INTSEQ_BLOCK_SIZE 128
+
+/* 块编码方式 */
+enum easeds_intseq_encoding {
+    EASEDS_INTSEQ_ENC_PACKED = 0, /* 定长位打包, 位宽不超过 32 */
+    EASEDS_INTSEQ_ENC_VARINT = 1, /* 变长整数编码 */
+};
+
+/* 块跳跃索引项 */
+struct easeds_intseq_block {
+    uint64_t first;    /* 块内第一个元素的值 */
+    uint64_t base;     /* 帧基准, 块内最小差值(补码) */
+    uint64_t offset;   /* 压缩数据在 data 中的偏移 */
+    uint32_t bytes;    /* 压缩数据字节数 */
+    uint8_t  encoding; /* 编码方式, 见 enum easeds_intseq_encoding */
+    uint8_t  bits;     /* 位打包的位宽 */
+    uint16_t pad;      /* 填充字段, 保持结构体对齐 */
+};
+
+struct easeds_intseq {
+    const char          *name;          /* 名称, 预留字段, 可用于调试和日志输出 */
+    struct easeds_array *blocks;        /* 块跳跃索引, 元素为 struct easeds_intseq_block */
+    uint8_t             *data;          /* 压缩数据 */
+    uint64_t             data_size;     /* 压缩数据字节数 */
+    uint64_t             data_capacity; /* 压缩数据缓冲区容量 */
+    uint64_t             size;          /* 元素总数 */
+    uint64_t             last;          /* 最后一个元素的值 */
+    uint64_t             cache_block;   /* 缓存的块号, UINT64_MAX 表示无效 */
+    uint32_t             tail_count;    /* 尾部缓冲区元素数量 */
+    uint32_t             flags;         /* 标志位, 见 EASEDS_INTSEQ_F_* */
+    uint64_t             tail[EASEDS_INTSEQ_BLOCK_SIZE];  /* 尾部未压缩元素 */
+    uint64_t             cache[EASEDS_INTSEQ_BLOCK_SIZE]; /* 最近解码的块 */
+};
+
+/* 序列单调不减, 可以二分查找 */
+#define EASEDS_INTSEQ_F_SORTED 0x1U
+
+/* 压缩统计信息 */
+struct easeds_intseq_stats {
+    uint64_t count;            /* 元素数量 */
+    uint64_t raw_bytes;        /* 按 uint64_t 数组保存所需的字节数 */
+    uint64_t compressed_bytes; /* 压缩数据 + 跳跃索引 + 尾部元素的字节数 */
+    uint64_t memory_bytes;     /* 实际申请的内存字节数, 包括未使用的容量 */
+    uint64_t packed_blocks;    /* 位打包编码的块数 */
+    uint64_t varint_blocks;    /* 变长整数编码的块数 */
+    double   ratio;            /* 压缩比, raw_bytes / compressed_bytes */
+};
+
+/**
+ * 常见压缩序列操作函数:
+ *
+ * 函数名                       功能描述
+ * ------------------------     ------------------------------------------------------
+ * easeds_intseq_create         创建一个空序列, 返回序列指针, 失败返回NULL
+ * easeds_intseq_destroy        销毁序列, 释放内存
+ * easeds_intseq_clear          清空序列, 删除所有元素, 但不释放内存
+ * easeds_intseq_size           获取序列中元素数量
+ * easeds_intseq_is_empty       判断序列是否为空, 为空返回true, 否则返回false
+ * easeds_intseq_is_sorted      判断序列是否单调不减
+ * easeds_intseq_append         在序列末尾追加一个元素, 成功返回0, 失败返回-1
+ * easeds_intseq_append_bulk    在序列末尾追加多个元素, 成功返回0, 失败返回-1
+ * easeds_intseq_get            获取指定下标的元素值, 成功返回0, 失败返回-1
+ * easeds_intseq_decode         解码 [start, start + count) 范围的元素, 成功返回0, 失败返回-1
+ * easeds_intseq_foreach        按顺序遍历所有元素, 对每个元素执行指定的回调函数
+ * easeds_intseq_lower_bound    有序序列中查找第一个不小于 value 的下标, 成功返回0, 失败返回-1
+ * easeds_intseq_shrink         释放压缩数据和索引的多余容量, 成功返回0, 失败返回-1
+ * easeds_intseq_stats          获取压缩统计信息, 成功返回0, 失败返回-1
+ */
+
+// 创建一个空序列, initial_blocks 为索引初始容量, 为0时使用默认容量, 失败返回NULL
+struct easeds_intseq *easeds_intseq_create(const char *name, uint32_t initial_blocks);
+
+// 销毁序列, 释放内存
+void easeds_intseq_destroy(struct easeds_intseq *seq);
+
+// 清空序列, 删除所有元素, 但不释放内存
+void easeds_intseq_clear(struct easeds_intseq *seq);
+
+// 获取序列中元素数量
+uint64_t easeds_intseq_size(struct easeds_intseq *seq);
+
+// 判断序列是否为空, 为空返回true, 否则返回false
+bool easeds_intseq_is_empty(struct easeds_intseq *seq);
+
+// 判断序列是否单调不减
+bool easeds_intseq_is_sorted(struct easeds_intseq *seq);
+
+// 在序列末尾追加一个元素, 成功返回0, 失败返回-1
+int32_t easeds_intseq_append(struct easeds_intseq *seq, uint64_t value);
+
+// 在序列末尾追加多个元素, 失败时已追加的元素保留, 成功返回0, 失败返回-1
+int32_t easeds_intseq_append_bulk(
+    struct easeds_intseq *seq, const uint64_t *values, uint64_t count);
+
+// 获取指定下标的元素值, 成功返回0, 失败返回-1
+int32_t easeds_intseq_get(struct easeds_intseq *seq, uint64_t index, uint64_t *value);
+
+// 解码 [start, start + count) 范围的元素到 out, 成功返回0, 失败返回-1
+int32_t easeds_intseq_decode(
+    struct easeds_intseq *seq, uint64_t start, uint64_t count, uint64_t *out);
+
+// 按顺序遍历所有元素, 对每个元素执行指定的回调函数
+void easeds_intseq_foreach(
+    struct easeds_intseq *seq, void (*callback)(uint64_t value, void *user_data), void *user_data);
+
+// 有序序列中查找第一个不小于 value 的下标, 不存在时为序列大小, 成功返回0, 序列无序返回-1
+int32_t easeds_intseq_lower_bound(struct easeds_intseq *seq, uint64_t value, uint64_t *index);
+
+// 释放压缩数据和索引的多余容量, 成功返回0, 失败返回-1
+int32_t easeds_intseq_shrink(struct easeds_intseq *seq);
+
+// 获取压缩统计信息, 成功返回0, 失败返回-1
+int32_t easeds_intseq_stats(struct easeds_intseq *seq, struct easeds_intseq_stats *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __EASEDS_INTSEQ_H__ */
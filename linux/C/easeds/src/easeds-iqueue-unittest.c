@@ -0,0 +1,385 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-iqueue-unittest.c
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-18 23:55
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  Easeds 下标链表单元测试实现文件, 包含了 ISLIST/ITAILQ 基本操作/数组扩容和拷贝/元素池和性能测试.
+ *
+ * @History:
+ *  2026年10月18日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#include "easeds-unittest.h"
+
+// 标准库头文件
+#include <string.h>
+
+// 项目内部头文件
+#include "easeds-array.h"
+#include "easeds-iqueue.h"
+#include "easeds-queue.h"
+#include "easeds-utils.h"
+
+// 测试节点, 链接为 32 位下标
+struct iq_node {
+    ITAILQ_ENTRY link;  /* 尾队列链接 */
+    ISLIST_ENTRY free;  /* 空闲链表链接 */
+    uint32_t     value; /* 数据 */
+};
+
+ITAILQ_HEAD(iq_list);
+ISLIST_HEAD(iq_free_list);
+
+// 指针链表节点, 性能对比使用
+struct iq_ptr_node {
+    TAILQ_ENTRY(iq_ptr_node) link; /* 尾队列链接 */
+    uint64_t value;                /* 数据 */
+};
+
+TAILQ_HEAD(iq_ptr_list, iq_ptr_node);
+
+// 检查尾队列正向和反向遍历的结果与 expect 一致, 一致返回0
+static int32_t iq_check_list(
+    struct iq_node *base, struct iq_list *list, const uint32_t *expect, uint32_t count)
+{
+    uint32_t i = 0;
+    uint32_t idx;
+
+    ITAILQ_FOREACH(idx, base, list, link)
+    {
+        if (i >= count || base[idx].value != expect[i]) {
+            return -1;
+        }
+        i++;
+    }
+    if (i != count) {
+        return -1;
+    }
+
+    ITAILQ_FOREACH_REVERSE(idx, base, list, link)
+    {
+        if (i == 0 || base[idx].value != expect[i - 1]) {
+            return -1;
+        }
+        i--;
+    }
+    return i == 0 ? 0 : -1;
+}
+
+// 基本功能测试: 单向链表头部插入/删除, 链接只占 4 字节
+static void test_easeds_iqueue_basic(void **state)
+{
+    easeds_unused(state);
+
+    struct iq_node      nodes[8];
+    struct iq_free_list head = ISLIST_HEAD_INITIALIZER(head);
+    uint32_t            idx;
+
+    assert_int_equal(sizeof(((struct iq_node *)NULL)->link), 8);
+    assert_int_equal(sizeof(((struct iq_node *)NULL)->free), 4);
+    assert_true(ISLIST_EMPTY(&head));
+
+    for (uint32_t i = 0; i < 8; i++) {
+        nodes[i].value = i;
+        ISLIST_INSERT_HEAD(nodes, &head, i, free);
+    }
+    assert_false(ISLIST_EMPTY(&head));
+    assert_int_equal(ISLIST_FIRST(&head), 7);
+
+    /* 后进先出 */
+    uint32_t expect = 7;
+    ISLIST_FOREACH(idx, nodes, &head, free)
+    {
+        assert_int_equal(nodes[idx].value, expect);
+        expect--;
+    }
+    assert_int_equal(expect, UINT32_MAX);
+
+    /* 删除头部和删除后继 */
+    ISLIST_REMOVE_HEAD(nodes, &head, free);
+    assert_int_equal(ISLIST_FIRST(&head), 6);
+    ISLIST_REMOVE_AFTER(nodes, 6, free);
+    assert_int_equal(ISLIST_NEXT(nodes, 6, free), 4);
+    ISLIST_INSERT_AFTER(nodes, 6, 5, free);
+    assert_int_equal(ISLIST_NEXT(nodes, 6, free), 5);
+    assert_int_equal(ISLIST_NEXT(nodes, 5, free), 4);
+
+    while (!ISLIST_EMPTY(&head)) {
+        ISLIST_REMOVE_HEAD(nodes, &head, free);
+    }
+    assert_int_equal(ISLIST_FIRST(&head), IQUEUE_NIL);
+}
+
+// 基本功能测试: 尾队列头尾插入, 前后插入, 删除, 安全遍历, 拼接
+static void test_easeds_iqueue_operations(void **state)
+{
+    easeds_unused(state);
+
+    struct iq_node nodes[10];
+    struct iq_list list;
+    uint32_t       idx, tmp;
+
+    ITAILQ_INIT(&list);
+    assert_true(ITAILQ_EMPTY(&list));
+    for (uint32_t i = 0; i < 10; i++) {
+        nodes[i].value = i;
+    }
+
+    ITAILQ_INSERT_TAIL(nodes, &list, 1, link);
+    ITAILQ_INSERT_TAIL(nodes, &list, 2, link);
+    ITAILQ_INSERT_HEAD(nodes, &list, 0, link);
+    ITAILQ_INSERT_AFTER(nodes, &list, 2, 4, link);
+    ITAILQ_INSERT_BEFORE(nodes, &list, 4, 3, link);
+    ITAILQ_INSERT_BEFORE(nodes, &list, 0, 5, link);
+    const uint32_t expect1[] = {5, 0, 1, 2, 3, 4};
+    assert_int_equal(iq_check_list(nodes, &list, expect1, 6), 0);
+    assert_int_equal(ITAILQ_FIRST(&list), 5);
+    assert_int_equal(ITAILQ_LAST(&list), 4);
+    assert_int_equal(ITAILQ_NEXT(nodes, 2, link), 3);
+    assert_int_equal(ITAILQ_PREV(nodes, 2, link), 1);
+
+    /* 删除头, 尾, 中间节点 */
+    ITAILQ_REMOVE(nodes, &list, 5, link);
+    ITAILQ_REMOVE(nodes, &list, 4, link);
+    ITAILQ_REMOVE(nodes, &list, 2, link);
+    const uint32_t expect2[] = {0, 1, 3};
+    assert_int_equal(iq_check_list(nodes, &list, expect2, 3), 0);
+
+    /* 拼接另一个尾队列 */
+    struct iq_list other = ITAILQ_HEAD_INITIALIZER(other);
+    for (uint32_t i = 6; i < 10; i++) {
+        ITAILQ_INSERT_TAIL(nodes, &other, i, link);
+    }
+    ITAILQ_CONCAT(nodes, &list, &other, link);
+    assert_true(ITAILQ_EMPTY(&other));
+    const uint32_t expect3[] = {0, 1, 3, 6, 7, 8, 9};
+    assert_int_equal(iq_check_list(nodes, &list, expect3, 7), 0);
+
+    /* 安全遍历中删除奇数节点, 反向安全遍历中删除剩余节点 */
+    ITAILQ_FOREACH_SAFE(idx, nodes, &list, link, tmp)
+    {
+        if (nodes[idx].value & 1) {
+            ITAILQ_REMOVE(nodes, &list, idx, link);
+        }
+    }
+    const uint32_t expect4[] = {0, 6, 8};
+    assert_int_equal(iq_check_list(nodes, &list, expect4, 3), 0);
+    ITAILQ_FOREACH_REVERSE_SAFE(idx, nodes, &list, link, tmp)
+    {
+        ITAILQ_REMOVE(nodes, &list, idx, link);
+    }
+    assert_true(ITAILQ_EMPTY(&list));
+    assert_int_equal(ITAILQ_LAST(&list), IQUEUE_NIL);
+}
+
+// 边界测试: 元素数组扩容和整体拷贝后链表仍然有效, 空闲链表复用元素
+static void test_easeds_iqueue_boundary(void **state)
+{
+    easeds_unused(state);
+
+    struct easeds_array *array = easeds_array_create("iqueue", sizeof(struct iq_node), 4);
+    assert_non_null(array);
+
+    struct iq_list      list  = ITAILQ_HEAD_INITIALIZER(list);
+    struct iq_free_list frees = ISLIST_HEAD_INITIALIZER(frees);
+    struct iq_node      node;
+    struct iq_node     *base;
+    uint32_t            idx;
+
+    /* 扩容会移动元素数组, 每次插入前重新获取首地址 */
+    memset(&node, 0, sizeof(node));
+    for (uint32_t i = 0; i < 1000; i++) {
+        node.value = i;
+        assert_int_equal(easeds_array_push_back(array, &node), EASEDS_OK);
+        base = array->elements;
+        ITAILQ_INSERT_HEAD(base, &list, i, link);
+    }
+    assert_true(easeds_array_capacity(array) >= 1000);
+
+    /* 删除偶数节点放入空闲链表, 再插入时复用 */
+    base = array->elements;
+    for (uint32_t i = 0; i < 1000; i += 2) {
+        ITAILQ_REMOVE(base, &list, i, link);
+        ISLIST_INSERT_HEAD(base, &frees, i, free);
+    }
+    for (uint32_t i = 0; i < 500; i++) {
+        assert_false(ISLIST_EMPTY(&frees));
+        idx = ISLIST_FIRST(&frees);
+        ISLIST_REMOVE_HEAD(base, &frees, free);
+        base[idx].value = 1000 + idx;
+        ITAILQ_INSERT_TAIL(base, &list, idx, link);
+    }
+    assert_true(ISLIST_EMPTY(&frees));
+    assert_int_equal(easeds_array_size(array), 1000);
+
+    /* 整个元素数组拷贝到新地址, 链表不需要修正 */
+    struct iq_node *copy = malloc(sizeof(struct iq_node) * 1000);
+    assert_non_null(copy);
+    memcpy(copy, base, sizeof(struct iq_node) * 1000);
+    easeds_array_destroy(array);
+
+    uint32_t count = 0;
+    uint32_t prev  = IQUEUE_NIL;
+    ITAILQ_FOREACH(idx, copy, &list, link)
+    {
+        assert_int_equal(ITAILQ_PREV(copy, idx, link), prev);
+        assert_int_equal(IQUEUE_INDEX(copy, &copy[idx]), idx);
+        if (count < 500) {
+            assert_int_equal(copy[idx].value, 999 - 2 * count);
+        } else {
+            /* 空闲链表后进先出, 复用顺序为 998, 996, ..., 0 */
+            assert_int_equal(idx, 998 - 2 * (count - 500));
+            assert_int_equal(copy[idx].value, 1000 + idx);
+        }
+        prev = idx;
+        count++;
+    }
+    assert_int_equal(count, 1000);
+    assert_int_equal(ITAILQ_LAST(&list), prev);
+    free(copy);
+}
+
+// 失效测试: 空链表遍历, 只有一个节点时删除, 空链表拼接
+static void test_easeds_iqueue_error(void **state)
+{
+    easeds_unused(state);
+
+    struct iq_node nodes[2];
+    struct iq_list list  = ITAILQ_HEAD_INITIALIZER(list);
+    struct iq_list empty = ITAILQ_HEAD_INITIALIZER(empty);
+    uint32_t       idx;
+    uint32_t       count = 0;
+
+    memset(nodes, 0, sizeof(nodes));
+    ITAILQ_FOREACH(idx, nodes, &list, link)
+    {
+        count++;
+    }
+    ITAILQ_FOREACH_REVERSE(idx, nodes, &list, link)
+    {
+        count++;
+    }
+    assert_int_equal(count, 0);
+
+    /* 空链表相互拼接 */
+    ITAILQ_CONCAT(nodes, &list, &empty, link);
+    assert_true(ITAILQ_EMPTY(&list));
+
+    /* 唯一节点删除后头尾都为空 */
+    nodes[1].value = 1;
+    ITAILQ_INSERT_TAIL(nodes, &list, 1, link);
+    assert_int_equal(ITAILQ_FIRST(&list), 1);
+    assert_int_equal(ITAILQ_LAST(&list), 1);
+    assert_int_equal(ITAILQ_NEXT(nodes, 1, link), IQUEUE_NIL);
+    assert_int_equal(ITAILQ_PREV(nodes, 1, link), IQUEUE_NIL);
+    ITAILQ_REMOVE(nodes, &list, 1, link);
+    assert_int_equal(ITAILQ_FIRST(&list), IQUEUE_NIL);
+    assert_int_equal(ITAILQ_LAST(&list), IQUEUE_NIL);
+
+    /* 拼接到空链表 */
+    ITAILQ_INSERT_TAIL(nodes, &empty, 0, link);
+    ITAILQ_CONCAT(nodes, &list, &empty, link);
+    assert_int_equal(ITAILQ_FIRST(&list), 0);
+    assert_int_equal(ITAILQ_LAST(&list), 0);
+    assert_true(ITAILQ_EMPTY(&empty));
+}
+
+// 性能测试: 下标尾队列和指针尾队列的构建与遍历
+static void test_easeds_iqueue_perf(void **state)
+{
+    easeds_unused(state);
+
+    const uint32_t count = 1000000;
+    uint64_t       seed  = 88172645463325252ULL;
+    uint32_t      *order = malloc(sizeof(uint32_t) * count);
+    assert_non_null(order);
+
+    /* 随机顺序插入, 模拟长期运行后链表顺序和内存顺序无关 */
+    for (uint32_t i = 0; i < count; i++) {
+        order[i] = i;
+    }
+    for (uint32_t i = count - 1; i > 0; i--) {
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+        uint32_t j = (uint32_t)(seed % (i + 1));
+        uint32_t t = order[i];
+        order[i]   = order[j];
+        order[j]   = t;
+    }
+
+    struct iq_node *nodes = malloc(sizeof(struct iq_node) * count);
+    struct iq_list  list  = ITAILQ_HEAD_INITIALIZER(list);
+    uint64_t        sum   = 0;
+    uint32_t        idx;
+    assert_non_null(nodes);
+
+    int64_t start = easeds_get_current_time_ns();
+    for (uint32_t i = 0; i < count; i++) {
+        nodes[order[i]].value = order[i];
+        ITAILQ_INSERT_TAIL(nodes, &list, order[i], link);
+    }
+    double build_ns = (double)(easeds_get_current_time_ns() - start) / count;
+    start           = easeds_get_current_time_ns();
+    ITAILQ_FOREACH(idx, nodes, &list, link)
+    {
+        sum += nodes[idx].value;
+    }
+    double walk_ns = (double)(easeds_get_current_time_ns() - start) / count;
+
+    /* 指针尾队列, 节点逐个申请 */
+    struct iq_ptr_node **ptrs = malloc(sizeof(struct iq_ptr_node *) * count);
+    struct iq_ptr_list   plist;
+    struct iq_ptr_node  *pnode;
+    uint64_t             psum = 0;
+    assert_non_null(ptrs);
+    TAILQ_INIT(&plist);
+
+    start = easeds_get_current_time_ns();
+    for (uint32_t i = 0; i < count; i++) {
+        ptrs[i] = malloc(sizeof(struct iq_ptr_node));
+        assert_non_null(ptrs[i]);
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        pnode        = ptrs[order[i]];
+        pnode->value = order[i];
+        TAILQ_INSERT_TAIL(&plist, pnode, link);
+    }
+    double pbuild_ns = (double)(easeds_get_current_time_ns() - start) / count;
+    start            = easeds_get_current_time_ns();
+    TAILQ_FOREACH(pnode, &plist, link)
+    {
+        psum += pnode->value;
+    }
+    double pwalk_ns = (double)(easeds_get_current_time_ns() - start) / count;
+    assert_int_equal(sum, psum);
+
+    MEASURE("[iqueue perf]: %u nodes, ITAILQ %zu bytes/node build %.1f ns walk %.1f ns, "
+            "TAILQ %zu bytes/node build %.1f ns walk %.1f ns.",
+        count, sizeof(struct iq_node), build_ns, walk_ns, sizeof(struct iq_ptr_node), pbuild_ns,
+        pwalk_ns);
+
+    for (uint32_t i = 0; i < count; i++) {
+        free(ptrs[i]);
+    }
+    free(ptrs);
+    free(nodes);
+    free(order);
+}
+
+// 注册单元测试用例
+EASEDS_UNITTEST_REGISTER(easeds_unittest_iqueue){
+    cmocka_unit_test(test_easeds_iqueue_basic),
+    cmocka_unit_test(test_easeds_iqueue_operations),
+    cmocka_unit_test(test_easeds_iqueue_boundary),
+    cmocka_unit_test(test_easeds_iqueue_error),
+    cmocka_unit_test(test_easeds_iqueue_perf),
+    easeds_unit_test_end,
+};
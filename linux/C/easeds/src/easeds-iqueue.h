@@ -0,0 +1,263 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-iqueue.h
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-18 23:55
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  下标链表宏定义, 链接是元素数组中的 32 位下标而不是指针, 接口风格参考 easeds-queue.h.
+ *
+ * @History:
+ *  2026年10月18日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#ifndef __EASEDS_IQUEUE_H__
+#define __EASEDS_IQUEUE_H__
+
+/* C 标准库头文件 */
+#include <stdint.h>
+
+/**
+ * 下标链表的所有元素存放在同一个连续的元素数组中(easeds_array, easeds_smallvec 或普通数组),
+ * 链接字段保存的是元素在数组中的下标, 而不是元素指针.
+ *  (1) 每个链接 4 字节, ITAILQ 节点的链接开销为 8 字节, 是 TAILQ 的一半; ISLIST 为 4 字节.
+ *  (2) 元素在数组中连续存放, 遍历时的访问局部性比分散在堆上的节点好得多.
+ *  (3) 链接与数组地址无关, 数组扩容(realloc)后链表仍然有效, 整个数组可以直接拷贝,
+ *      写入文件或通过共享内存传递, 不需要修正任何指针.
+ *  (4) 所有宏都需要传入元素数组首地址 base, 数组地址可能变化时, 每次操作前重新获取.
+ *  (5) IQUEUE_NIL 表示空链接, 因此最多支持 UINT32_MAX 个元素.
+ *  (6) 删除的元素可以挂到一个 ISLIST 空闲链表上, 插入时优先复用, 数组就成了一个元素池.
+ *
+ * 使用方法:
+ *  struct node {
+ *      ITAILQ_ENTRY link;
+ *      uint32_t     value;
+ *  };
+ *  ITAILQ_HEAD(node_list) list = ITAILQ_HEAD_INITIALIZER(list);
+ *  struct node *base = array->elements;
+ *  ITAILQ_INSERT_TAIL(base, &list, index, link);
+ *  ITAILQ_FOREACH(i, base, &list, link) { ... base[i].value ... }
+ *
+ * 支持的操作如下:
+ *
+ * 宏名称                               ISLIST   ITAILQ
+ * ------------------------------       ------   ------
+ * _HEAD                                +        +
+ * _HEAD_INITIALIZER                    +        +
+ * _ENTRY                               +        +
+ * _INIT                                +        +
+ * _EMPTY                               +        +
+ * _FIRST                               +        +
+ * _LAST                                -        +
+ * _NEXT                                +        +
+ * _PREV                                -        +
+ * _FOREACH                             +        +
+ * _FOREACH_SAFE                        +        +
+ * _FOREACH_REVERSE                     -        +
+ * _FOREACH_REVERSE_SAFE                -        +
+ * _INSERT_HEAD                         +        +
+ * _INSERT_AFTER                        +        +
+ * _INSERT_BEFORE                       -        +
+ * _INSERT_TAIL                         -        +
+ * _REMOVE_HEAD                         +        -
+ * _REMOVE_AFTER                        +        -
+ * _REMOVE                              -        +
+ * _CONCAT                              -        +
+ */
+
+/* 空链接 */
+#define IQUEUE_NIL UINT32_MAX
+
+/* 元素指针转换为下标 */
+#define IQUEUE_INDEX(base, elm) ((uint32_t)((elm) - (base)))
+
+/*
+ * 单向下标链表
+ */
+#define ISLIST_HEAD(name)   \
+    struct name {           \
+        uint32_t slh_first; \
+    }
+
+#define ISLIST_HEAD_INITIALIZER(head) {IQUEUE_NIL}
+
+#define ISLIST_ENTRY       \
+    struct {               \
+        uint32_t sle_next; \
+    }
+
+#define ISLIST_INIT(head)  ((head)->slh_first = IQUEUE_NIL)
+#define ISLIST_EMPTY(head) ((head)->slh_first == IQUEUE_NIL)
+#define ISLIST_FIRST(head) ((head)->slh_first)
+
+#define ISLIST_NEXT(base, idx, field) ((base)[idx].field.sle_next)
+
+#define ISLIST_FOREACH(var, base, head, field)            \
+    for ((var) = ISLIST_FIRST(head); (var) != IQUEUE_NIL; \
+         (var) = ISLIST_NEXT(base, var, field))
+
+#define ISLIST_FOREACH_SAFE(var, base, head, field, tvar)                    \
+    for ((var) = ISLIST_FIRST(head);                                         \
+         (var) != IQUEUE_NIL && ((tvar) = ISLIST_NEXT(base, var, field), 1); \
+         (var) = (tvar))
+
+#define ISLIST_INSERT_HEAD(base, head, idx, field)             \
+    do {                                                       \
+        uint32_t iq_elm_                  = (idx);             \
+        ISLIST_NEXT(base, iq_elm_, field) = (head)->slh_first; \
+        (head)->slh_first                 = iq_elm_;           \
+    } while (0)
+
+#define ISLIST_INSERT_AFTER(base, slistidx, idx, field)                          \
+    do {                                                                         \
+        uint32_t iq_elm_                   = (idx);                              \
+        uint32_t iq_list_                  = (slistidx);                         \
+        ISLIST_NEXT(base, iq_elm_, field)  = ISLIST_NEXT(base, iq_list_, field); \
+        ISLIST_NEXT(base, iq_list_, field) = iq_elm_;                            \
+    } while (0)
+
+#define ISLIST_REMOVE_HEAD(base, head, field)                         \
+    ((head)->slh_first = ISLIST_NEXT(base, (head)->slh_first, field))
+
+#define ISLIST_REMOVE_AFTER(base, idx, field)                            \
+    do {                                                                 \
+        uint32_t iq_elm_ = (idx);                                        \
+        ISLIST_NEXT(base, iq_elm_, field) =                              \
+            ISLIST_NEXT(base, ISLIST_NEXT(base, iq_elm_, field), field); \
+    } while (0)
+
+/*
+ * 下标尾队列
+ */
+#define ITAILQ_HEAD(name)   \
+    struct name {           \
+        uint32_t tqh_first; \
+        uint32_t tqh_last;  \
+    }
+
+#define ITAILQ_HEAD_INITIALIZER(head) {IQUEUE_NIL, IQUEUE_NIL}
+
+#define ITAILQ_ENTRY       \
+    struct {               \
+        uint32_t tqe_next; \
+        uint32_t tqe_prev; \
+    }
+
+#define ITAILQ_INIT(head)               \
+    do {                                \
+        (head)->tqh_first = IQUEUE_NIL; \
+        (head)->tqh_last  = IQUEUE_NIL; \
+    } while (0)
+
+#define ITAILQ_EMPTY(head) ((head)->tqh_first == IQUEUE_NIL)
+#define ITAILQ_FIRST(head) ((head)->tqh_first)
+#define ITAILQ_LAST(head)  ((head)->tqh_last)
+
+#define ITAILQ_NEXT(base, idx, field) ((base)[idx].field.tqe_next)
+#define ITAILQ_PREV(base, idx, field) ((base)[idx].field.tqe_prev)
+
+#define ITAILQ_FOREACH(var, base, head, field)            \
+    for ((var) = ITAILQ_FIRST(head); (var) != IQUEUE_NIL; \
+         (var) = ITAILQ_NEXT(base, var, field))
+
+#define ITAILQ_FOREACH_SAFE(var, base, head, field, tvar)                    \
+    for ((var) = ITAILQ_FIRST(head);                                         \
+         (var) != IQUEUE_NIL && ((tvar) = ITAILQ_NEXT(base, var, field), 1); \
+         (var) = (tvar))
+
+#define ITAILQ_FOREACH_REVERSE(var, base, head, field)   \
+    for ((var) = ITAILQ_LAST(head); (var) != IQUEUE_NIL; \
+         (var) = ITAILQ_PREV(base, var, field))
+
+#define ITAILQ_FOREACH_REVERSE_SAFE(var, base, head, field, tvar)            \
+    for ((var) = ITAILQ_LAST(head);                                          \
+         (var) != IQUEUE_NIL && ((tvar) = ITAILQ_PREV(base, var, field), 1); \
+         (var) = (tvar))
+
+#define ITAILQ_INSERT_HEAD(base, head, idx, field)                 \
+    do {                                                           \
+        uint32_t iq_elm_                  = (idx);                 \
+        ITAILQ_NEXT(base, iq_elm_, field) = (head)->tqh_first;     \
+        ITAILQ_PREV(base, iq_elm_, field) = IQUEUE_NIL;            \
+        if ((head)->tqh_first != IQUEUE_NIL)                       \
+            ITAILQ_PREV(base, (head)->tqh_first, field) = iq_elm_; \
+        else                                                       \
+            (head)->tqh_last = iq_elm_;                            \
+        (head)->tqh_first = iq_elm_;                               \
+    } while (0)
+
+#define ITAILQ_INSERT_TAIL(base, head, idx, field)                \
+    do {                                                          \
+        uint32_t iq_elm_                  = (idx);                \
+        ITAILQ_NEXT(base, iq_elm_, field) = IQUEUE_NIL;           \
+        ITAILQ_PREV(base, iq_elm_, field) = (head)->tqh_last;     \
+        if ((head)->tqh_last != IQUEUE_NIL)                       \
+            ITAILQ_NEXT(base, (head)->tqh_last, field) = iq_elm_; \
+        else                                                      \
+            (head)->tqh_first = iq_elm_;                          \
+        (head)->tqh_last = iq_elm_;                               \
+    } while (0)
+
+#define ITAILQ_INSERT_AFTER(base, head, listidx, idx, field)                    \
+    do {                                                                        \
+        uint32_t iq_elm_                  = (idx);                              \
+        uint32_t iq_list_                 = (listidx);                          \
+        uint32_t iq_next_                 = ITAILQ_NEXT(base, iq_list_, field); \
+        ITAILQ_NEXT(base, iq_elm_, field) = iq_next_;                           \
+        ITAILQ_PREV(base, iq_elm_, field) = iq_list_;                           \
+        if (iq_next_ != IQUEUE_NIL)                                             \
+            ITAILQ_PREV(base, iq_next_, field) = iq_elm_;                       \
+        else                                                                    \
+            (head)->tqh_last = iq_elm_;                                         \
+        ITAILQ_NEXT(base, iq_list_, field) = iq_elm_;                           \
+    } while (0)
+
+#define ITAILQ_INSERT_BEFORE(base, head, listidx, idx, field)                   \
+    do {                                                                        \
+        uint32_t iq_elm_                  = (idx);                              \
+        uint32_t iq_list_                 = (listidx);                          \
+        uint32_t iq_prev_                 = ITAILQ_PREV(base, iq_list_, field); \
+        ITAILQ_PREV(base, iq_elm_, field) = iq_prev_;                           \
+        ITAILQ_NEXT(base, iq_elm_, field) = iq_list_;                           \
+        if (iq_prev_ != IQUEUE_NIL)                                             \
+            ITAILQ_NEXT(base, iq_prev_, field) = iq_elm_;                       \
+        else                                                                    \
+            (head)->tqh_first = iq_elm_;                                        \
+        ITAILQ_PREV(base, iq_list_, field) = iq_elm_;                           \
+    } while (0)
+
+#define ITAILQ_REMOVE(base, head, idx, field)                  \
+    do {                                                       \
+        uint32_t iq_elm_  = (idx);                             \
+        uint32_t iq_next_ = ITAILQ_NEXT(base, iq_elm_, field); \
+        uint32_t iq_prev_ = ITAILQ_PREV(base, iq_elm_, field); \
+        if (iq_next_ != IQUEUE_NIL)                            \
+            ITAILQ_PREV(base, iq_next_, field) = iq_prev_;     \
+        else                                                   \
+            (head)->tqh_last = iq_prev_;                       \
+        if (iq_prev_ != IQUEUE_NIL)                            \
+            ITAILQ_NEXT(base, iq_prev_, field) = iq_next_;     \
+        else                                                   \
+            (head)->tqh_first = iq_next_;                      \
+    } while (0)
+
+#define ITAILQ_CONCAT(base, head1, head2, field)                                   \
+    do {                                                                           \
+        if (!ITAILQ_EMPTY(head2)) {                                                \
+            if (ITAILQ_EMPTY(head1)) {                                             \
+                (head1)->tqh_first = (head2)->tqh_first;                           \
+            } else {                                                               \
+                ITAILQ_NEXT(base, (head1)->tqh_last, field)  = (head2)->tqh_first; \
+                ITAILQ_PREV(base, (head2)->tqh_first, field) = (head1)->tqh_last;  \
+            }                                                                      \
+            (head1)->tqh_last = (head2)->tqh_last;                                 \
+            ITAILQ_INIT(head2);                                                    \
+        }                                                                          \
+    } while (0)
+
+#endif /* __EASEDS_IQUEUE_H__ */
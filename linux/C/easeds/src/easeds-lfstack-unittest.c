@@ -0,0 +1,312 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-lfstack-unittest.c
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-18 23:10
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  Easeds 无锁栈单元测试实现文件, 包含了后进先出顺序/批量摘取/版本号回绕/并发空闲链表和性能测试.
+ *
+ * @History:
+ *  2026年10月18日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#include "easeds-unittest.h"
+
+// 标准库头文件
+#include <pthread.h>
+
+// 项目内部头文件
+#include "easeds-lfstack.h"
+#include "easeds-queue.h"
+#include "easeds-utils.h"
+
+/* 并发测试的线程数量和节点数量 */
+#define LFSTACK_THREADS 4
+#define LFSTACK_NODES   64
+
+// 测试节点, 栈节点放在第一个成员, 可以直接转换
+struct lfstack_item {
+    struct easeds_lfstack_node node;  /* 无锁栈节点 */
+    SLIST_ENTRY(lfstack_item) entry;  /* 互斥锁对照组使用的链表节点 */
+    uint64_t                   value; /* 数据 */
+    uint64_t                   owned; /* 是否已被某个线程弹出 */
+};
+
+SLIST_HEAD(lfstack_list, lfstack_item);
+
+// 弹出栈顶节点, 返回它的数据, 空栈返回 UINT64_MAX
+static uint64_t lfstack_pop_value(struct easeds_lfstack *stack)
+{
+    struct easeds_lfstack_node *node = easeds_lfstack_pop(stack);
+    return node != NULL ? ((struct lfstack_item *)node)->value : UINT64_MAX;
+}
+
+// 基本功能测试: 后进先出顺序
+static void test_easeds_lfstack_basic(void **state)
+{
+    easeds_unused(state);
+
+    struct easeds_lfstack stack;
+    struct lfstack_item   items[16];
+
+    easeds_lfstack_init(&stack);
+    assert_true(easeds_lfstack_empty(&stack));
+    assert_null(easeds_lfstack_pop(&stack));
+
+    for (uint64_t i = 0; i < 16; i++) {
+        items[i].value = i;
+        easeds_lfstack_push(&stack, &items[i].node);
+        assert_false(easeds_lfstack_empty(&stack));
+    }
+
+    for (uint64_t i = 16; i-- > 0;) {
+        struct lfstack_item *item = (struct lfstack_item *)easeds_lfstack_pop(&stack);
+        assert_non_null(item);
+        assert_int_equal(item->value, i);
+    }
+    assert_true(easeds_lfstack_empty(&stack));
+    assert_null(easeds_lfstack_pop(&stack));
+}
+
+// 操作测试: 摘下整个栈后遍历, 整体压回
+static void test_easeds_lfstack_operations(void **state)
+{
+    easeds_unused(state);
+
+    struct easeds_lfstack stack;
+    struct lfstack_item   items[32];
+
+    easeds_lfstack_init(&stack);
+    for (uint64_t i = 0; i < 32; i++) {
+        items[i].value = i;
+        easeds_lfstack_push(&stack, &items[i].node);
+    }
+
+    /* 摘下的链表按后进先出顺序排列, 栈变为空 */
+    struct easeds_lfstack_node *first = easeds_lfstack_pop_all(&stack);
+    struct easeds_lfstack_node *last  = NULL;
+    uint64_t                    count = 0;
+    assert_true(easeds_lfstack_empty(&stack));
+    assert_null(easeds_lfstack_pop_all(&stack));
+    for (struct easeds_lfstack_node *node = first; node != NULL; node = node->next) {
+        assert_int_equal(((struct lfstack_item *)node)->value, 31 - count);
+        last = node;
+        count++;
+    }
+    assert_int_equal(count, 32);
+
+    /* 先压入一个节点, 再整体压回, 整条链表位于它之上 */
+    struct lfstack_item extra = {.value = 100};
+    easeds_lfstack_push(&stack, &extra.node);
+    easeds_lfstack_push_list(&stack, first, last);
+    for (uint64_t i = 32; i-- > 0;) {
+        assert_int_equal(lfstack_pop_value(&stack), i);
+    }
+    assert_ptr_equal(easeds_lfstack_pop(&stack), &extra.node);
+    assert_null(easeds_lfstack_pop(&stack));
+
+    /* 交错的入栈出栈 */
+    for (uint64_t i = 0; i < 32; i++) {
+        easeds_lfstack_push(&stack, &items[i].node);
+        if (i % 3 == 2) {
+            assert_int_equal(lfstack_pop_value(&stack), i);
+        }
+    }
+    count = 0;
+    while (easeds_lfstack_pop(&stack) != NULL) {
+        count++;
+    }
+    assert_int_equal(count, 32 - 32 / 3);
+}
+
+// 边界测试: 版本号回绕, 同一个节点反复入栈出栈
+static void test_easeds_lfstack_boundary(void **state)
+{
+    easeds_unused(state);
+
+    struct easeds_lfstack stack;
+    struct lfstack_item   item = {.value = 1};
+
+    easeds_lfstack_init(&stack);
+    for (uint32_t i = 0; i < 70000; i++) {
+        easeds_lfstack_push(&stack, &item.node);
+        assert_ptr_equal(easeds_lfstack_pop(&stack), &item.node);
+    }
+    assert_true(easeds_lfstack_empty(&stack));
+
+    /* 每次入栈和出栈各加一, 16 位版本号回绕 */
+    assert_int_equal(stack.top >> EASEDS_LFSTACK_TAG_SHIFT, (70000 * 2) % 65536);
+
+    /* 摘空保留版本号, 再压入同一个节点时栈顶字与摘空前不同 */
+    easeds_lfstack_push(&stack, &item.node);
+    uint64_t before = stack.top;
+    assert_ptr_equal(easeds_lfstack_pop_all(&stack), &item.node);
+    assert_int_equal(stack.top, before & ~EASEDS_LFSTACK_PTR_MASK);
+    easeds_lfstack_push(&stack, &item.node);
+    assert_int_not_equal(stack.top, before);
+    assert_ptr_equal(easeds_lfstack_pop(&stack), &item.node);
+    assert_null(item.node.next);
+}
+
+// 错误处理测试: 空栈和空链表
+static void test_easeds_lfstack_error(void **state)
+{
+    easeds_unused(state);
+
+    struct easeds_lfstack stack;
+
+    easeds_lfstack_init(&stack);
+    easeds_lfstack_push_list(&stack, NULL, NULL);
+    assert_true(easeds_lfstack_empty(&stack));
+    assert_null(easeds_lfstack_pop(&stack));
+    assert_null(easeds_lfstack_pop_all(&stack));
+    assert_int_equal(stack.top >> EASEDS_LFSTACK_TAG_SHIFT, 0);
+}
+
+// 并发测试上下文
+struct lfstack_stress_ctx {
+    struct easeds_lfstack stack;  /* 无锁栈 */
+    struct lfstack_list   list;   /* 互斥锁对照组 */
+    pthread_mutex_t       lock;   /* 保护 list */
+    uint32_t              locked; /* 是否使用互斥锁对照组 */
+    uint32_t              pad0;   /* 对齐填充 */
+    uint64_t              ops;    /* 每个线程的操作次数 */
+    uint64_t              errors; /* 同一个节点被两个线程同时持有的次数 */
+    uint8_t               pad1[EASEDS_CACHE_LINE_SIZE - 8]; /* 缓存行填充 */
+};
+
+// 持有一个节点, 检查没有其他线程同时持有
+static uint64_t lfstack_own(struct lfstack_item *item)
+{
+    return __atomic_exchange_n(&item->owned, 1, __ATOMIC_RELAXED) != 0 ? 1 : 0;
+}
+
+// 并发测试线程: 弹出节点, 检查独占后压回, 每 64 次摘下整个栈检查后整体压回
+static void *lfstack_stress_fn(void *arg)
+{
+    struct lfstack_stress_ctx *ctx    = arg;
+    uint64_t                   errors = 0;
+
+    for (uint64_t i = 0; i < ctx->ops; i++) {
+        if (ctx->locked) {
+            pthread_mutex_lock(&ctx->lock);
+            struct lfstack_item *item = SLIST_FIRST(&ctx->list);
+            if (item != NULL) {
+                SLIST_REMOVE_HEAD(&ctx->list, entry);
+            }
+            pthread_mutex_unlock(&ctx->lock);
+            if (item != NULL) {
+                errors += lfstack_own(item);
+                __atomic_store_n(&item->owned, 0, __ATOMIC_RELAXED);
+                pthread_mutex_lock(&ctx->lock);
+                SLIST_INSERT_HEAD(&ctx->list, item, entry);
+                pthread_mutex_unlock(&ctx->lock);
+            }
+            continue;
+        }
+
+        if (i % 64 == 63) {
+            struct easeds_lfstack_node *first = easeds_lfstack_pop_all(&ctx->stack);
+            struct easeds_lfstack_node *last  = NULL;
+            for (struct easeds_lfstack_node *node = first; node != NULL; node = node->next) {
+                errors += lfstack_own((struct lfstack_item *)node);
+                last = node;
+            }
+            for (struct easeds_lfstack_node *node = first; node != NULL; node = node->next) {
+                __atomic_store_n(&((struct lfstack_item *)node)->owned, 0, __ATOMIC_RELAXED);
+            }
+            easeds_lfstack_push_list(&ctx->stack, first, last);
+            continue;
+        }
+
+        struct lfstack_item *item = (struct lfstack_item *)easeds_lfstack_pop(&ctx->stack);
+        if (item != NULL) {
+            errors += lfstack_own(item);
+            __atomic_store_n(&item->owned, 0, __ATOMIC_RELAXED);
+            easeds_lfstack_push(&ctx->stack, &item->node);
+        }
+    }
+
+    __atomic_add_fetch(&ctx->errors, errors, __ATOMIC_RELAXED);
+    return NULL;
+}
+
+// 运行一轮并发测试, 返回每次操作的平均耗时, 结束后检查节点没有丢失
+static double lfstack_stress_run(uint32_t locked, uint32_t nthreads, uint64_t ops)
+{
+    struct lfstack_stress_ctx *ctx =
+        aligned_alloc(EASEDS_CACHE_LINE_SIZE, sizeof(struct lfstack_stress_ctx));
+    struct lfstack_item       *items = calloc(LFSTACK_NODES, sizeof(struct lfstack_item));
+    pthread_t                  threads[LFSTACK_THREADS];
+    assert_non_null(ctx);
+    assert_non_null(items);
+
+    memset(ctx, 0, sizeof(struct lfstack_stress_ctx));
+    easeds_lfstack_init(&ctx->stack);
+    SLIST_INIT(&ctx->list);
+    pthread_mutex_init(&ctx->lock, NULL);
+    ctx->locked = locked;
+    ctx->ops    = ops;
+    for (uint64_t i = 0; i < LFSTACK_NODES; i++) {
+        items[i].value = i;
+        easeds_lfstack_push(&ctx->stack, &items[i].node);
+        SLIST_INSERT_HEAD(&ctx->list, &items[i], entry);
+    }
+
+    int64_t start = easeds_get_current_time_ns();
+    for (uint32_t t = 0; t < nthreads; t++) {
+        assert_int_equal(pthread_create(&threads[t], NULL, lfstack_stress_fn, ctx), 0);
+    }
+    for (uint32_t t = 0; t < nthreads; t++) {
+        pthread_join(threads[t], NULL);
+    }
+    double ns = (double)(easeds_get_current_time_ns() - start) / (double)(ops * nthreads);
+    assert_int_equal(ctx->errors, 0);
+
+    /* 所有节点都还在栈中, 没有重复 */
+    uint64_t seen  = 0;
+    uint64_t count = 0;
+    for (struct easeds_lfstack_node *node = easeds_lfstack_pop_all(&ctx->stack); node != NULL;
+         node = node->next) {
+        seen |= 1ULL << ((struct lfstack_item *)node)->value;
+        count++;
+    }
+    assert_int_equal(count, LFSTACK_NODES);
+    assert_int_equal(seen, UINT64_MAX);
+
+    pthread_mutex_destroy(&ctx->lock);
+    free(items);
+    free(ctx);
+    return ns;
+}
+
+// 性能测试: 多线程共享空闲链表, 与互斥锁保护的 SLIST 对比
+static void test_easeds_lfstack_perf(void **state)
+{
+    easeds_unused(state);
+
+    const uint32_t threads[] = {1, LFSTACK_THREADS};
+
+    for (uint32_t t = 0; t < 2; t++) {
+        double lockfree = lfstack_stress_run(0, threads[t], 2000000);
+        double locked   = lfstack_stress_run(1, threads[t], 2000000);
+        MEASURE("[lfstack perf]: %u threads, pop+push lfstack %.1f ns/op, mutex slist %.1f ns/op.",
+            threads[t], lockfree, locked);
+    }
+}
+
+// 注册单元测试用例
+EASEDS_UNITTEST_REGISTER(easeds_unittest_lfstack){
+    cmocka_unit_test(test_easeds_lfstack_basic),
+    cmocka_unit_test(test_easeds_lfstack_operations),
+    cmocka_unit_test(test_easeds_lfstack_boundary),
+    cmocka_unit_test(test_easeds_lfstack_error),
+    cmocka_unit_test(test_easeds_lfstack_perf),
+    easeds_unit_test_end,
+};
@@ -0,0 +1,156 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-lfstack.h
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-18 23:10
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  侵入式无锁栈(Treiber Stack), 栈顶指针带版本号防止 ABA, 支持一次摘下整个栈批量处理.
+ *
+ * @History:
+ *  2026年10月18日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#ifndef __EASEDS_LFSTACK_H__
+#define __EASEDS_LFSTACK_H__
+
+/* C 标准库头文件 */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* 项目内部头文件 */
+#include "easeds-environment.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 栈顶字低 48 位为节点地址, 高 16 位为版本号, 每次入栈和出栈都加一 */
+#define EASEDS_LFSTACK_TAG_SHIFT 48
+#define EASEDS_LFSTACK_PTR_MASK  ((1ULL << EASEDS_LFSTACK_TAG_SHIFT) - 1)
+#define EASEDS_LFSTACK_TAG_ONE   (1ULL << EASEDS_LFSTACK_TAG_SHIFT)
+
+/* 栈节点, 和 SLIST_ENTRY 一样只有一个 next 指针, 嵌入用户结构体中 */
+struct easeds_lfstack_node {
+    struct easeds_lfstack_node *next; /* 下一个节点, 出栈前由栈维护 */
+};
+
+/**
+ * 实现一个侵入式无锁栈, 适合线程间共享的空闲链表和工作栈, 入栈和出栈都只需要一次 CAS.
+ *  (1) 栈节点嵌入用户结构体中, 栈本身不申请任何内存, 节点地址必须在用户态 48 位地址空间内.
+ *  (2) ABA 问题: 线程 A 读到栈顶 X 和 X->next = Y, 其间其他线程弹出 X/Y 后再压回 X,
+ *      A 的 CAS 仍会成功并把已出栈的 Y 放回栈顶. 栈顶字中的版本号每次修改都加一, A 的 CAS 会失败.
+ *      版本号 16 位, 只有在一次出栈的读取和 CAS 之间恰好发生 65536 的整数倍次修改时才会误判.
+ *  (3) 出栈会读取栈顶节点的 next, 该节点可能刚被其他线程弹出, 因此节点出栈后只能复用,
+ *      不能归还给操作系统; 需要真正释放时配合 easeds_reclaim 使用.
+ *  (4) easeds_lfstack_pop_all 一次 CAS 摘下整个栈, 返回的链表按后进先出顺序排列,
+ *      可以不加锁地遍历处理, 再通过 easeds_lfstack_push_list 一次整体压回.
+ *  (5) 栈顶字独占一个缓存行, 避免和相邻数据产生伪共享.
+ */
+struct easeds_lfstack {
+    uint64_t top;                             /* 栈顶字: 版本号和栈顶节点地址 */
+    uint8_t  pad[EASEDS_CACHE_LINE_SIZE - 8]; /* 缓存行填充 */
+} __attribute__((aligned(EASEDS_CACHE_LINE_SIZE)));
+
+/**
+ * 常见无锁栈操作函数:
+ *
+ * 函数名                       功能描述
+ * ------------------------     ------------------------------------------------------
+ * easeds_lfstack_init          初始化一个空栈
+ * easeds_lfstack_empty         判断栈是否为空, 并发修改时只是一个瞬时结果
+ * easeds_lfstack_push          压入一个节点
+ * easeds_lfstack_push_list     把 first 到 last 的一条链表整体压入
+ * easeds_lfstack_pop           弹出栈顶节点, 空栈返回NULL
+ * easeds_lfstack_pop_all       摘下整个栈, 返回原栈顶节点, 空栈返回NULL
+ */
+
+// 从栈顶字中取出节点地址
+static inline struct easeds_lfstack_node *easeds_lfstack_ptr(uint64_t top)
+{
+    return (struct easeds_lfstack_node *)(uintptr_t)(top & EASEDS_LFSTACK_PTR_MASK);
+}
+
+// 生成新的栈顶字: 指向 node, 版本号比 old 加一
+static inline uint64_t easeds_lfstack_word(uint64_t old, struct easeds_lfstack_node *node)
+{
+    return ((old & ~EASEDS_LFSTACK_PTR_MASK) + EASEDS_LFSTACK_TAG_ONE) | (uint64_t)(uintptr_t)node;
+}
+
+// 初始化一个空栈
+static inline void easeds_lfstack_init(struct easeds_lfstack *stack)
+{
+    __atomic_store_n(&stack->top, 0, __ATOMIC_RELAXED);
+}
+
+// 判断栈是否为空, 并发修改时只是一个瞬时结果
+static inline bool easeds_lfstack_empty(struct easeds_lfstack *stack)
+{
+    return easeds_lfstack_ptr(__atomic_load_n(&stack->top, __ATOMIC_RELAXED)) == NULL;
+}
+
+// 把 first 到 last 的一条链表整体压入, first 为NULL时不做任何操作
+static inline void easeds_lfstack_push_list(struct easeds_lfstack *stack,
+    struct easeds_lfstack_node *first, struct easeds_lfstack_node *last)
+{
+    if (unlikely(first == NULL)) {
+        return;
+    }
+
+    /* 入栈也递增版本号, pop_all 保留版本号, 摘空后再压回同一个节点时栈顶字也不会重复 */
+    uint64_t old = __atomic_load_n(&stack->top, __ATOMIC_RELAXED);
+    do {
+        __atomic_store_n(&last->next, easeds_lfstack_ptr(old), __ATOMIC_RELAXED);
+    } while (!__atomic_compare_exchange_n(&stack->top, &old, easeds_lfstack_word(old, first), true,
+        __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+}
+
+// 压入一个节点
+static inline void easeds_lfstack_push(
+    struct easeds_lfstack *stack, struct easeds_lfstack_node *node)
+{
+    easeds_lfstack_push_list(stack, node, node);
+}
+
+// 弹出栈顶节点, 空栈返回NULL
+static inline struct easeds_lfstack_node *easeds_lfstack_pop(struct easeds_lfstack *stack)
+{
+    uint64_t                    old = __atomic_load_n(&stack->top, __ATOMIC_ACQUIRE);
+    struct easeds_lfstack_node *node;
+
+    while ((node = easeds_lfstack_ptr(old)) != NULL) {
+        /* node 可能已被其他线程弹出, 读到的 next 可能过期, 版本号保证这时 CAS 失败 */
+        struct easeds_lfstack_node *next = __atomic_load_n(&node->next, __ATOMIC_RELAXED);
+        if (__atomic_compare_exchange_n(&stack->top, &old, easeds_lfstack_word(old, next), true,
+                __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE)) {
+            break;
+        }
+    }
+    return node;
+}
+
+// 摘下整个栈, 返回原栈顶节点, 通过 next 遍历, 空栈返回NULL
+static inline struct easeds_lfstack_node *easeds_lfstack_pop_all(struct easeds_lfstack *stack)
+{
+    /* 只清除地址保留版本号, 正在出栈的线程持有的旧栈顶字不会再匹配 */
+    uint64_t old = __atomic_load_n(&stack->top, __ATOMIC_ACQUIRE);
+    while (easeds_lfstack_ptr(old) != NULL) {
+        if (__atomic_compare_exchange_n(&stack->top, &old, old & ~EASEDS_LFSTACK_PTR_MASK, true,
+                __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE)) {
+            break;
+        }
+    }
+    return easeds_lfstack_ptr(old);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __EASEDS_LFSTACK_H__ */
@@ -0,0 +1,392 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-pool-unittest.c
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-18 21:55
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  Easeds 对象池单元测试实现文件, 包含了弹匣交换/跨线程释放/线程退出归还/毒化检查和 malloc 对比测试.
+ *
+ * @History:
+ *  2026年10月18日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#include "easeds-unittest.h"
+
+// 标准库头文件
+#include <pthread.h>
+
+// 项目内部头文件
+#include "easeds-pool.h"
+#include "easeds-utils.h"
+
+// 统计仓库中所有对象数量, 线程缓存都归还后应该等于总容量
+static uint64_t pool_depot_objects(struct easeds_pool *pool)
+{
+    struct easeds_pool_stats stats;
+    uint64_t                 count = 0;
+
+    easeds_pool_stats(pool, &stats);
+    for (struct easeds_pool_magazine *mag = pool->full; mag != NULL; mag = mag->next) {
+        count += mag->rounds;
+    }
+    return count + stats.depot_free;
+}
+
+static int pool_ptr_cmp(const void *a, const void *b)
+{
+    uintptr_t x = *(const uintptr_t *)a;
+    uintptr_t y = *(const uintptr_t *)b;
+    return x < y ? -1 : (x > y ? 1 : 0);
+}
+
+// 基本功能测试: 分配互不重叠, 释放后复用, 不再申请新 slab
+static void test_easeds_pool_basic(void **state)
+{
+    easeds_unused(state);
+
+    enum { COUNT = 10000 };
+
+    struct easeds_pool *pool = easeds_pool_create("basic", 20, 0);
+    void              **objs = malloc(COUNT * sizeof(void *));
+    assert_non_null(pool);
+    assert_non_null(objs);
+    assert_int_equal(easeds_pool_obj_size(pool), 24);
+
+    for (uint32_t i = 0; i < COUNT; i++) {
+        objs[i] = easeds_pool_alloc(pool);
+        assert_non_null(objs[i]);
+        assert_int_equal((uintptr_t)objs[i] % EASEDS_POOL_ALIGN, 0);
+        memset(objs[i], (int)(i & 0xFF), 24);
+    }
+    for (uint32_t i = 0; i < COUNT; i++) {
+        assert_int_equal(((uint8_t *)objs[i])[23], i & 0xFF);
+    }
+
+    // 任意两个对象之间至少相隔一个对象大小
+    qsort(objs, COUNT, sizeof(void *), pool_ptr_cmp);
+    for (uint32_t i = 1; i < COUNT; i++) {
+        assert_true((uintptr_t)objs[i] - (uintptr_t)objs[i - 1] >= 24);
+    }
+
+    struct easeds_pool_stats stats;
+    easeds_pool_stats(pool, &stats);
+    uint64_t slabs = stats.slabs;
+    assert_true(stats.capacity >= COUNT);
+    assert_int_equal(stats.caches, 1);
+
+    // 释放后再分配同样数量不需要新的 slab
+    for (uint32_t r = 0; r < 3; r++) {
+        for (uint32_t i = 0; i < COUNT; i++) {
+            easeds_pool_free(pool, objs[i]);
+        }
+        for (uint32_t i = 0; i < COUNT; i++) {
+            objs[i] = easeds_pool_alloc(pool);
+            assert_non_null(objs[i]);
+        }
+    }
+    easeds_pool_stats(pool, &stats);
+    assert_int_equal(stats.slabs, slabs);
+
+    for (uint32_t i = 0; i < COUNT; i++) {
+        easeds_pool_free(pool, objs[i]);
+    }
+    easeds_pool_flush(pool);
+    assert_int_equal(pool_depot_objects(pool), stats.capacity);
+
+    free(objs);
+    easeds_pool_destroy(pool);
+}
+
+// 多线程测试参数
+struct pool_thread_ctx {
+    struct easeds_pool *pool;    /* 对象池 */
+    uint64_t            id;      /* 线程编号 */
+    uint64_t            rounds;  /* 重复轮数 */
+    uint64_t            errors;  /* 检测到的错误数量 */
+    void              **handoff; /* 交给下一个线程释放的对象 */
+    uint64_t            count;   /* handoff 数量 */
+    uint64_t            allocs;  /* 完成的分配次数 */
+};
+
+// 工作线程: 随机批量分配, 写入线程编号, 校验后释放, 最后分配一批交给主线程释放
+static void *pool_worker(void *arg)
+{
+    struct pool_thread_ctx *ctx  = arg;
+    uint64_t                seed = 88172645463325252ULL + ctx->id;
+    uint64_t               *objs[256];
+
+    for (uint64_t r = 0; r < ctx->rounds; r++) {
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+
+        uint32_t n = (uint32_t)(seed % 256) + 1;
+        for (uint32_t i = 0; i < n; i++) {
+            objs[i] = easeds_pool_alloc(ctx->pool);
+            if (objs[i] == NULL) {
+                ctx->errors++;
+                n = i;
+                break;
+            }
+            objs[i][0] = ctx->id;
+            objs[i][1] = i;
+        }
+        ctx->allocs += n;
+        for (uint32_t i = 0; i < n; i++) {
+            if (objs[i][0] != ctx->id || objs[i][1] != i) {
+                ctx->errors++;
+            }
+            easeds_pool_free(ctx->pool, objs[i]);
+        }
+    }
+
+    for (uint64_t i = 0; i < ctx->count; i++) {
+        ctx->handoff[i] = easeds_pool_alloc(ctx->pool);
+        if (ctx->handoff[i] == NULL) {
+            ctx->errors++;
+        }
+    }
+    return NULL;
+}
+
+// 操作测试: 多线程分配释放互不干扰, 跨线程释放, 线程退出后弹匣归还仓库
+static void test_easeds_pool_operations(void **state)
+{
+    easeds_unused(state);
+
+    enum { THREADS = 4, HANDOFF = 1000 };
+
+    struct easeds_pool    *pool = easeds_pool_create("operations", 16, 0);
+    pthread_t              threads[THREADS];
+    struct pool_thread_ctx ctx[THREADS];
+    void                  *handoff[THREADS][HANDOFF];
+    assert_non_null(pool);
+
+    for (uint32_t t = 0; t < THREADS; t++) {
+        ctx[t] = (struct pool_thread_ctx){
+            .pool = pool, .id = t, .rounds = 20000, .handoff = handoff[t], .count = HANDOFF};
+        assert_int_equal(pthread_create(&threads[t], NULL, pool_worker, &ctx[t]), 0);
+    }
+    for (uint32_t t = 0; t < THREADS; t++) {
+        pthread_join(threads[t], NULL);
+        assert_int_equal(ctx[t].errors, 0);
+    }
+
+    // 工作线程已经退出, 线程缓存全部归还, 只剩下交接的对象在外面
+    struct easeds_pool_stats stats;
+    easeds_pool_stats(pool, &stats);
+    assert_int_equal(stats.caches, 0);
+    assert_int_equal(pool_depot_objects(pool), stats.capacity - THREADS * HANDOFF);
+
+    // 由主线程释放其他线程分配的对象
+    for (uint32_t t = 0; t < THREADS; t++) {
+        for (uint32_t i = 0; i < HANDOFF; i++) {
+            easeds_pool_free(pool, handoff[t][i]);
+        }
+    }
+    easeds_pool_flush(pool);
+    assert_int_equal(pool_depot_objects(pool), stats.capacity);
+
+    // 每个弹匣 32 个对象, 访问仓库的次数远少于分配释放次数
+    uint64_t allocs = 0;
+    for (uint32_t t = 0; t < THREADS; t++) {
+        allocs += ctx[t].allocs;
+    }
+    easeds_pool_stats(pool, &stats);
+    assert_true(stats.depot_ops * 10 < allocs * 2);
+
+    easeds_pool_destroy(pool);
+}
+
+// 边界测试: 最小对象, 最大对象, 弹匣满/空边界, flush
+static void test_easeds_pool_boundary(void **state)
+{
+    easeds_unused(state);
+
+    struct easeds_pool *pool = easeds_pool_create("boundary", 1, 0);
+    assert_non_null(pool);
+    assert_int_equal(easeds_pool_obj_size(pool), EASEDS_POOL_ALIGN);
+
+    // 在弹匣满/空边界上来回分配释放不访问仓库
+    void *objs[EASEDS_POOL_MAGAZINE_SIZE * 3];
+    for (uint32_t i = 0; i < EASEDS_POOL_MAGAZINE_SIZE; i++) {
+        objs[i] = easeds_pool_alloc(pool);
+        assert_non_null(objs[i]);
+    }
+    struct easeds_pool_stats before, after;
+    easeds_pool_stats(pool, &before);
+    for (uint32_t r = 0; r < 1000; r++) {
+        easeds_pool_free(pool, objs[0]);
+        objs[0] = easeds_pool_alloc(pool);
+    }
+    easeds_pool_stats(pool, &after);
+    assert_int_equal(after.depot_ops, before.depot_ops);
+
+    // 超过两个弹匣的释放换出满弹匣
+    for (uint32_t i = EASEDS_POOL_MAGAZINE_SIZE; i < EASEDS_POOL_MAGAZINE_SIZE * 3; i++) {
+        objs[i] = easeds_pool_alloc(pool);
+        assert_non_null(objs[i]);
+    }
+    for (uint32_t i = 0; i < EASEDS_POOL_MAGAZINE_SIZE * 3; i++) {
+        easeds_pool_free(pool, objs[i]);
+    }
+    easeds_pool_stats(pool, &after);
+    assert_true(after.depot_full >= 1);
+
+    easeds_pool_flush(pool);
+    assert_int_equal(pool_depot_objects(pool), after.capacity);
+    easeds_pool_free(pool, NULL);
+    easeds_pool_destroy(pool);
+
+    // 最大对象, slab 至少容纳一个弹匣
+    pool = easeds_pool_create("boundary", EASEDS_POOL_MAX_OBJECT, 0);
+    assert_non_null(pool);
+    void *big = easeds_pool_alloc(pool);
+    assert_non_null(big);
+    memset(big, 0x5A, EASEDS_POOL_MAX_OBJECT);
+    easeds_pool_stats(pool, &after);
+    assert_int_equal(after.slabs, 1);
+    assert_true(after.capacity >= EASEDS_POOL_MAGAZINE_SIZE);
+    easeds_pool_free(pool, big);
+    easeds_pool_destroy(pool);
+}
+
+// 错误测试: 非法参数, 毒化检查发现释放后写入
+static void test_easeds_pool_error(void **state)
+{
+    easeds_unused(state);
+
+    assert_null(easeds_pool_create("error", 0, 0));
+    assert_null(easeds_pool_create("error", EASEDS_POOL_MAX_OBJECT + 1, 0));
+    assert_null(easeds_pool_alloc(NULL));
+    assert_int_equal(easeds_pool_obj_size(NULL), 0);
+    easeds_pool_free(NULL, NULL);
+    easeds_pool_flush(NULL);
+    easeds_pool_stats(NULL, NULL);
+    easeds_pool_destroy(NULL);
+
+    struct easeds_pool *pool = easeds_pool_create("error", 32, EASEDS_POOL_POISON);
+    assert_non_null(pool);
+
+    uint8_t *obj = easeds_pool_alloc(pool);
+    assert_non_null(obj);
+    memset(obj, 0, 32);
+    easeds_pool_free(pool, obj);
+
+    struct easeds_pool_stats stats;
+#ifndef NDEBUG
+    // 释放的对象被整体毒化, 释放后写入在下一次分配到该对象时被发现
+    for (uint32_t i = 0; i < 32; i++) {
+        assert_int_equal(obj[i], EASEDS_POOL_POISON_BYTE);
+    }
+    obj[17] = 0;
+    assert_ptr_equal(easeds_pool_alloc(pool), obj);
+    easeds_pool_stats(pool, &stats);
+    assert_int_equal(stats.poison_errors, 1);
+    easeds_pool_free(pool, obj);
+#endif
+
+    // 正常使用不会误报
+    for (uint32_t i = 0; i < 1000; i++) {
+        void *tmp = easeds_pool_alloc(pool);
+        assert_non_null(tmp);
+        memset(tmp, 0, 32);
+        easeds_pool_free(pool, tmp);
+    }
+    easeds_pool_stats(pool, &stats);
+    assert_true(stats.poison_errors <= 1);
+
+    easeds_pool_destroy(pool);
+}
+
+// 性能测试参数
+struct pool_perf_ctx {
+    struct easeds_pool *pool;  /* 对象池, 为NULL时使用 malloc */
+    uint64_t            ops;   /* 分配释放对数 */
+    uint32_t            batch; /* 每批分配数量 */
+    uint32_t            size;  /* 对象大小 */
+};
+
+// 性能测试线程: 批量分配后逆序释放
+static void *pool_perf_fn(void *arg)
+{
+    struct pool_perf_ctx *ctx = arg;
+    void                 *objs[256];
+
+    for (uint64_t done = 0; done < ctx->ops; done += ctx->batch) {
+        for (uint32_t i = 0; i < ctx->batch; i++) {
+            objs[i] = ctx->pool != NULL ? easeds_pool_alloc(ctx->pool) : malloc(ctx->size);
+            *(uint64_t *)objs[i] = i;
+        }
+        for (uint32_t i = ctx->batch; i > 0; i--) {
+            if (ctx->pool != NULL) {
+                easeds_pool_free(ctx->pool, objs[i - 1]);
+            } else {
+                free(objs[i - 1]);
+            }
+        }
+    }
+    return NULL;
+}
+
+// 运行一轮多线程测试, 返回每对分配释放的平均耗时
+static double pool_perf_run(struct pool_perf_ctx *ctx, uint32_t nthreads)
+{
+    pthread_t threads[4];
+
+    int64_t start = easeds_get_current_time_ns();
+    for (uint32_t t = 0; t < nthreads; t++) {
+        assert_int_equal(pthread_create(&threads[t], NULL, pool_perf_fn, ctx), 0);
+    }
+    for (uint32_t t = 0; t < nthreads; t++) {
+        pthread_join(threads[t], NULL);
+    }
+    return (double)(easeds_get_current_time_ns() - start) / (double)(ctx->ops * nthreads);
+}
+
+// 性能测试: 不同批量和线程数下对象池和 malloc 的单次分配释放耗时
+static void test_easeds_pool_perf(void **state)
+{
+    easeds_unused(state);
+
+    const uint32_t batches[] = {1, 16, 256};
+    const uint32_t threads[] = {1, 4};
+
+    for (uint32_t b = 0; b < 3; b++) {
+        for (uint32_t t = 0; t < 2; t++) {
+            struct easeds_pool  *pool = easeds_pool_create("perf", 48, 0);
+            struct pool_perf_ctx ctx  = {
+                .pool = pool, .ops = 2000000, .batch = batches[b], .size = 48};
+            assert_non_null(pool);
+
+            double pool_ns = pool_perf_run(&ctx, threads[t]);
+            ctx.pool       = NULL;
+            double libc_ns = pool_perf_run(&ctx, threads[t]);
+
+            struct easeds_pool_stats stats;
+            easeds_pool_stats(pool, &stats);
+            MEASURE("[pool perf]: batch %u, %u threads, pool %.1f ns/pair, malloc %.1f ns/pair, "
+                    "depot ops %lu (%.4f%%).",
+                batches[b], threads[t], pool_ns, libc_ns, stats.depot_ops,
+                (double)stats.depot_ops * 100.0 / (double)(ctx.ops * threads[t] * 2));
+
+            easeds_pool_destroy(pool);
+        }
+    }
+}
+
+// 注册单元测试用例
+EASEDS_UNITTEST_REGISTER(easeds_unittest_pool){
+    cmocka_unit_test(test_easeds_pool_basic),
+    cmocka_unit_test(test_easeds_pool_operations),
+    cmocka_unit_test(test_easeds_pool_boundary),
+    cmocka_unit_test(test_easeds_pool_error),
+    cmocka_unit_test(test_easeds_pool_perf),
+    easeds_unit_test_end,
+};
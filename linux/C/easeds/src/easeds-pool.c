@@ -0,0 +1,456 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-pool.c
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-18 21:55
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  定长对象池(Object Pool)实现文件.
+ *
+ * @History:
+ *  2026年10月18日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#include "easeds-pool.h"
+
+// 标准库头文件
+#include <stdlib.h>
+#include <string.h>
+
+// 项目内部头文件
+#include "easeds-log.h"
+
+/* slab 头部占用一个缓存行, 首字为下一个 slab, 对象从第二个缓存行开始, 小于缓存行的 2 的幂对象不跨行 */
+#define POOL_SLAB_HEADER EASEDS_CACHE_LINE_SIZE
+
+// 分配一个空弹匣, 失败返回NULL
+static struct easeds_pool_magazine *pool_magazine_alloc(void)
+{
+    struct easeds_pool_magazine *mag = __easeds_malloc(sizeof(struct easeds_pool_magazine));
+    if (unlikely(mag == NULL)) {
+        EASEDS_ERR("[pool_magazine_alloc]: Malloc magazine failed.");
+        return NULL;
+    }
+
+    mag->next   = NULL;
+    mag->rounds = 0;
+    mag->pad    = 0;
+    return mag;
+}
+
+// 释放弹匣链表
+static void pool_magazine_free_list(struct easeds_pool_magazine *mag)
+{
+    while (mag != NULL) {
+        struct easeds_pool_magazine *next = mag->next;
+        __easeds_free(mag);
+        mag = next;
+    }
+}
+
+#ifndef NDEBUG
+// 检查对象的毒化填充是否完整, 被修改说明对象释放后仍被写入
+static void pool_poison_check(struct easeds_pool *pool, void *obj)
+{
+    const uint8_t *bytes = obj;
+
+    for (uint32_t i = 0; i < pool->obj_size; i++) {
+        if (unlikely(bytes[i] != EASEDS_POOL_POISON_BYTE)) {
+            __atomic_add_fetch(&pool->stats.poison_errors, 1, __ATOMIC_RELAXED);
+            EASEDS_ERR("[pool_poison_check]: name=%s, object %p modified after free at offset %u.",
+                pool->name != NULL ? pool->name : "(null)", obj, i);
+            return;
+        }
+    }
+}
+#endif
+
+// 对象挂到 slab 空闲链表, 调用者持有仓库锁
+static inline void pool_free_list_push(struct easeds_pool *pool, void *obj)
+{
+    *(void **)obj   = pool->free_list;
+    pool->free_list = obj;
+    pool->stats.depot_free++;
+}
+
+// 从 slab 空闲链表取下一个对象, 毒化模式下恢复被链表指针覆盖的首字, 调用者持有仓库锁
+static inline void *pool_free_list_pop(struct easeds_pool *pool)
+{
+    void *obj       = pool->free_list;
+    pool->free_list = *(void **)obj;
+    pool->stats.depot_free--;
+
+#ifndef NDEBUG
+    if (pool->flags & EASEDS_POOL_POISON) {
+        memset(obj, EASEDS_POOL_POISON_BYTE, sizeof(void *));
+    }
+#endif
+    return obj;
+}
+
+// 申请一个新的 slab 并切分到空闲链表, 成功返回0, 失败返回-1, 调用者持有仓库锁
+static int32_t pool_slab_grow(struct easeds_pool *pool)
+{
+    uint8_t *slab = __easeds_aligned_alloc(EASEDS_CACHE_LINE_SIZE, pool->slab_size);
+    if (unlikely(slab == NULL)) {
+        EASEDS_ERR("[pool_slab_grow]: Malloc slab with %lu bytes failed.", pool->slab_size);
+        return -1;
+    }
+
+    *(void **)slab = pool->slabs;
+    pool->slabs    = slab;
+    pool->stats.slabs++;
+    pool->stats.capacity += pool->slab_objs;
+
+    /* 逆序挂入, 空闲链表按地址递增的顺序分配 */
+    for (uint64_t i = pool->slab_objs; i > 0; i--) {
+        uint8_t *obj = slab + POOL_SLAB_HEADER + (i - 1) * pool->obj_size;
+#ifndef NDEBUG
+        if (pool->flags & EASEDS_POOL_POISON) {
+            memset(obj, EASEDS_POOL_POISON_BYTE, pool->obj_size);
+        }
+#endif
+        pool_free_list_push(pool, obj);
+    }
+    return 0;
+}
+
+// 弹匣归还仓库, 非空弹匣挂到 full 链表, 空弹匣挂到 empty 链表, 调用者持有仓库锁
+static void pool_depot_put(struct easeds_pool *pool, struct easeds_pool_magazine *mag)
+{
+    if (mag->rounds != 0) {
+        mag->next  = pool->full;
+        pool->full = mag;
+        pool->stats.depot_full++;
+    } else {
+        mag->next   = pool->empty;
+        pool->empty = mag;
+        pool->stats.depot_empty++;
+    }
+}
+
+// 从仓库取一个空弹匣, 仓库没有时新分配, 失败返回NULL, 调用者持有仓库锁
+static struct easeds_pool_magazine *pool_depot_get_empty(struct easeds_pool *pool)
+{
+    struct easeds_pool_magazine *mag = pool->empty;
+
+    if (mag == NULL) {
+        return pool_magazine_alloc();
+    }
+    pool->empty = mag->next;
+    pool->stats.depot_empty--;
+    return mag;
+}
+
+// 线程退出时归还线程缓存的两个弹匣
+static void pool_cache_destructor(void *arg)
+{
+    struct easeds_pool_cache *cache = arg;
+    struct easeds_pool       *pool  = cache->pool;
+
+    pthread_mutex_lock(&pool->lock);
+    pool_depot_put(pool, cache->loaded);
+    pool_depot_put(pool, cache->previous);
+    LIST_REMOVE(cache, entry);
+    pool->stats.caches--;
+    pthread_mutex_unlock(&pool->lock);
+
+    __easeds_free(cache);
+}
+
+// 创建当前线程的缓存, 失败返回NULL
+static struct easeds_pool_cache *pool_cache_create(struct easeds_pool *pool)
+{
+    struct easeds_pool_cache *cache = __easeds_malloc(sizeof(struct easeds_pool_cache));
+    if (unlikely(cache == NULL)) {
+        EASEDS_ERR("[pool_cache_create]: Malloc thread cache failed.");
+        return NULL;
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    cache->pool     = pool;
+    cache->loaded   = pool_depot_get_empty(pool);
+    cache->previous = pool_depot_get_empty(pool);
+    if (unlikely(cache->loaded == NULL || cache->previous == NULL)) {
+        pthread_mutex_unlock(&pool->lock);
+        __easeds_free(cache->loaded);
+        __easeds_free(cache->previous);
+        __easeds_free(cache);
+        return NULL;
+    }
+
+    LIST_INSERT_HEAD(&pool->caches, cache, entry);
+    pool->stats.caches++;
+    pthread_mutex_unlock(&pool->lock);
+
+    if (unlikely(pthread_setspecific(pool->key, cache) != 0)) {
+        EASEDS_ERR("[pool_cache_create]: Set thread specific data failed.");
+        pool_cache_destructor(cache);
+        return NULL;
+    }
+    return cache;
+}
+
+// 获取当前线程的缓存, 第一次访问时创建
+static inline struct easeds_pool_cache *pool_cache(struct easeds_pool *pool)
+{
+    struct easeds_pool_cache *cache = pthread_getspecific(pool->key);
+    if (unlikely(cache == NULL)) {
+        cache = pool_cache_create(pool);
+    }
+    return cache;
+}
+
+// 两个弹匣都为空时从仓库补充, 优先换入一个非空弹匣, 否则从 slab 空闲链表装填, 成功返回0, 失败返回-1
+static int32_t pool_refill(struct easeds_pool *pool, struct easeds_pool_cache *cache)
+{
+    struct easeds_pool_magazine *mag = cache->loaded;
+    int32_t                      ret = 0;
+
+    pthread_mutex_lock(&pool->lock);
+    pool->stats.depot_ops++;
+
+    if (pool->full != NULL) {
+        struct easeds_pool_magazine *full = pool->full;
+        pool->full                        = full->next;
+        pool->stats.depot_full--;
+
+        pool_depot_put(pool, cache->previous);
+        cache->previous = mag;
+        cache->loaded   = full;
+    } else {
+        /* previous 也是空的, 装满 loaded 之后紧接着的释放可以放入 previous */
+        while (mag->rounds < EASEDS_POOL_MAGAZINE_SIZE) {
+            if (pool->free_list == NULL && pool_slab_grow(pool) != 0) {
+                break;
+            }
+            mag->objs[mag->rounds++] = pool_free_list_pop(pool);
+        }
+        ret = mag->rounds != 0 ? 0 : -1;
+    }
+
+    pthread_mutex_unlock(&pool->lock);
+    return ret;
+}
+
+// 两个弹匣都已满时换出一个满弹匣并放入对象, 分配空弹匣失败时对象直接归还 slab 空闲链表
+static void pool_exchange(struct easeds_pool *pool, struct easeds_pool_cache *cache, void *obj)
+{
+    pthread_mutex_lock(&pool->lock);
+    pool->stats.depot_ops++;
+
+    struct easeds_pool_magazine *empty = pool_depot_get_empty(pool);
+    if (unlikely(empty == NULL)) {
+        pool_free_list_push(pool, obj);
+        pthread_mutex_unlock(&pool->lock);
+        return;
+    }
+
+    pool_depot_put(pool, cache->previous);
+    cache->previous = cache->loaded;
+    cache->loaded   = empty;
+    pthread_mutex_unlock(&pool->lock);
+
+    empty->objs[empty->rounds++] = obj;
+}
+
+// 创建对象池, obj_size 为对象大小, flags 为 EASEDS_POOL_* 标志, 失败返回NULL
+struct easeds_pool *easeds_pool_create(const char *name, uint32_t obj_size, uint32_t flags)
+{
+    if (unlikely(obj_size == 0 || obj_size > EASEDS_POOL_MAX_OBJECT)) {
+        EASEDS_ERR("[easeds_pool_create]: Invalid object size %u.", obj_size);
+        return NULL;
+    }
+
+    struct easeds_pool *pool = __easeds_malloc(sizeof(struct easeds_pool));
+    if (unlikely(pool == NULL)) {
+        EASEDS_ERR("[easeds_pool_create]: Malloc pool failed.");
+        return NULL;
+    }
+
+    memset(pool, 0, sizeof(struct easeds_pool));
+    if (unlikely(pthread_key_create(&pool->key, pool_cache_destructor) != 0)) {
+        EASEDS_ERR("[easeds_pool_create]: Create thread specific key failed.");
+        __easeds_free(pool);
+        return NULL;
+    }
+
+    /* 对象至少能存放空闲链表指针, slab 至少容纳一个弹匣的对象 */
+    uint32_t size = (obj_size + EASEDS_POOL_ALIGN - 1) & ~(uint32_t)(EASEDS_POOL_ALIGN - 1);
+    uint64_t slab = POOL_SLAB_HEADER + (uint64_t)size * EASEDS_POOL_MAGAZINE_SIZE;
+    slab          = slab > EASEDS_POOL_SLAB_SIZE ? slab : EASEDS_POOL_SLAB_SIZE;
+
+    pool->name      = name;
+    pool->flags     = flags;
+    pool->obj_size  = size;
+    pool->slab_size = (slab + EASEDS_CACHE_LINE_SIZE - 1) & ~(uint64_t)(EASEDS_CACHE_LINE_SIZE - 1);
+    pool->slab_objs = (pool->slab_size - POOL_SLAB_HEADER) / size;
+    pthread_mutex_init(&pool->lock, NULL);
+    LIST_INIT(&pool->caches);
+
+    PFL_DEBUG("[easeds_pool_create]: name=%s, obj_size=%u, slab_size=%lu, slab_objs=%lu.",
+        name != NULL ? name : "(null)", pool->obj_size, pool->slab_size, pool->slab_objs);
+    return pool;
+}
+
+// 销毁对象池, 释放所有 slab 和线程缓存, 未归还的对象也随之失效, 调用时不能有其他线程访问
+void easeds_pool_destroy(struct easeds_pool *pool)
+{
+    if (unlikely(pool == NULL)) {
+        return;
+    }
+
+    /* 先清除当前线程的私有数据, 再删除键, 其他线程退出时不会再调用析构函数 */
+    pthread_setspecific(pool->key, NULL);
+    pthread_key_delete(pool->key);
+
+    while (!LIST_EMPTY(&pool->caches)) {
+        struct easeds_pool_cache *cache = LIST_FIRST(&pool->caches);
+        LIST_REMOVE(cache, entry);
+        __easeds_free(cache->loaded);
+        __easeds_free(cache->previous);
+        __easeds_free(cache);
+    }
+
+    pool_magazine_free_list(pool->full);
+    pool_magazine_free_list(pool->empty);
+    while (pool->slabs != NULL) {
+        void *next = *(void **)pool->slabs;
+        __easeds_free(pool->slabs);
+        pool->slabs = next;
+    }
+
+    pthread_mutex_destroy(&pool->lock);
+    __easeds_free(pool);
+}
+
+// 分配一个对象, 内容未初始化, 失败返回NULL
+void *easeds_pool_alloc(struct easeds_pool *pool)
+{
+    if (unlikely(pool == NULL)) {
+        EASEDS_ERR("[easeds_pool_alloc]: Invalid pool pointer.");
+        return NULL;
+    }
+
+    struct easeds_pool_cache *cache = pool_cache(pool);
+    if (unlikely(cache == NULL)) {
+        return NULL;
+    }
+
+    struct easeds_pool_magazine *mag = cache->loaded;
+    if (unlikely(mag->rounds == 0)) {
+        if (cache->previous->rounds != 0) {
+            cache->loaded   = cache->previous;
+            cache->previous = mag;
+        } else if (unlikely(pool_refill(pool, cache) != 0)) {
+            return NULL;
+        }
+        mag = cache->loaded;
+    }
+
+    void *obj = mag->objs[--mag->rounds];
+#ifndef NDEBUG
+    if (pool->flags & EASEDS_POOL_POISON) {
+        pool_poison_check(pool, obj);
+    }
+#endif
+    return obj;
+}
+
+// 释放一个对象, obj 必须来自同一个对象池, obj 为NULL时不做任何操作
+void easeds_pool_free(struct easeds_pool *pool, void *obj)
+{
+    if (unlikely(pool == NULL || obj == NULL)) {
+        return;
+    }
+
+    /* 先毒化再归还, 两条归还路径都毒化, 避免下次申请时的毒化检查误报 */
+#ifndef NDEBUG
+    if (pool->flags & EASEDS_POOL_POISON) {
+        memset(obj, EASEDS_POOL_POISON_BYTE, pool->obj_size);
+    }
+#endif
+
+    struct easeds_pool_cache *cache = pool_cache(pool);
+    if (unlikely(cache == NULL)) {
+        /* 无法创建线程缓存时直接归还 slab 空闲链表, 对象不会丢失 */
+        pthread_mutex_lock(&pool->lock);
+        pool_free_list_push(pool, obj);
+        pthread_mutex_unlock(&pool->lock);
+        return;
+    }
+
+    struct easeds_pool_magazine *mag = cache->loaded;
+    if (unlikely(mag->rounds == EASEDS_POOL_MAGAZINE_SIZE)) {
+        if (cache->previous->rounds == 0) {
+            cache->loaded   = cache->previous;
+            cache->previous = mag;
+        } else {
+            pool_exchange(pool, cache, obj);
+            return;
+        }
+        mag = cache->loaded;
+    }
+
+    mag->objs[mag->rounds++] = obj;
+}
+
+// 把当前线程缓存的对象归还仓库, 线程长时间不再使用对象池时调用
+void easeds_pool_flush(struct easeds_pool *pool)
+{
+    if (unlikely(pool == NULL)) {
+        return;
+    }
+
+    struct easeds_pool_cache *cache = pthread_getspecific(pool->key);
+    if (cache == NULL) {
+        return;
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    pool->stats.depot_ops++;
+
+    /* 非空弹匣换成空弹匣, 分配不到空弹匣时保留原弹匣 */
+    struct easeds_pool_magazine **mags[2] = {&cache->loaded, &cache->previous};
+    for (uint32_t i = 0; i < 2; i++) {
+        if ((*mags[i])->rounds == 0) {
+            continue;
+        }
+
+        struct easeds_pool_magazine *empty = pool_depot_get_empty(pool);
+        if (unlikely(empty == NULL)) {
+            break;
+        }
+        pool_depot_put(pool, *mags[i]);
+        *mags[i] = empty;
+    }
+    pthread_mutex_unlock(&pool->lock);
+}
+
+// 获取对象大小, 为创建时的大小向上取整到 EASEDS_POOL_ALIGN
+uint32_t easeds_pool_obj_size(struct easeds_pool *pool)
+{
+    if (unlikely(pool == NULL)) {
+        return 0;
+    }
+
+    return pool->obj_size;
+}
+
+// 获取统计信息
+void easeds_pool_stats(struct easeds_pool *pool, struct easeds_pool_stats *stats)
+{
+    if (unlikely(pool == NULL || stats == NULL)) {
+        return;
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    *stats               = pool->stats;
+    stats->poison_errors = __atomic_load_n(&pool->stats.poison_errors, __ATOMIC_RELAXED);
+    pthread_mutex_unlock(&pool->lock);
+}
@@ -0,0 +1,154 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-pool.h
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-18 21:55
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  定长对象池(Object Pool), 按 slab 批量切分对象, 每个线程在共享仓库前面缓存两个弹匣(magazine).
+ *
+ * @History:
+ *  2026年10月18日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#ifndef __EASEDS_POOL_H__
+#define __EASEDS_POOL_H__
+
+/* C 标准库头文件 */
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/* 项目内部头文件 */
+#include "easeds-environment.h"
+#include "easeds-public.h"
+#include "easeds-queue.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 每个弹匣容纳的对象数量 */
+#define EASEDS_POOL_MAGAZINE_SIZE 32
+
+/* slab 的最小字节数, 对象较大时 slab 至少容纳 EASEDS_POOL_MAGAZINE_SIZE 个对象 */
+#define EASEDS_POOL_SLAB_SIZE (64 * 1024)
+
+/* 对象大小上限 */
+#define EASEDS_POOL_MAX_OBJECT (1U << 20)
+
+/* 对象对齐字节数, 对象大小向上取整到该值 */
+#define EASEDS_POOL_ALIGN 8
+
+/* 创建标志 */
+#define EASEDS_POOL_POISON 0x1U /* 释放时填充毒化字节, 分配时检查, 仅在未定义 NDEBUG 时生效 */
+
+/* 毒化填充字节 */
+#define EASEDS_POOL_POISON_BYTE 0x6B
+
+/* 弹匣, 一组空闲对象指针, 线程缓存和仓库之间整体交换 */
+struct easeds_pool_magazine {
+    struct easeds_pool_magazine *next;                            /* 仓库链表 */
+    uint32_t                     rounds;                          /* 当前对象数量 */
+    uint32_t                     pad;                             /* 对齐填充 */
+    void                        *objs[EASEDS_POOL_MAGAZINE_SIZE]; /* 空闲对象 */
+};
+
+/* 线程缓存, 每个线程每个对象池一个, 只被所属线程访问 */
+struct easeds_pool_cache {
+    struct easeds_pool_magazine *loaded;   /* 当前使用的弹匣 */
+    struct easeds_pool_magazine *previous; /* 备用弹匣, 总是全满或全空 */
+    struct easeds_pool          *pool;     /* 所属对象池, 线程退出时使用 */
+    LIST_ENTRY(easeds_pool_cache) entry;   /* 对象池的线程缓存链表 */
+};
+
+LIST_HEAD(easeds_pool_cache_list, easeds_pool_cache);
+
+/* 对象池统计信息 */
+struct easeds_pool_stats {
+    uint64_t slabs;         /* slab 数量 */
+    uint64_t capacity;      /* slab 切分出的对象总数 */
+    uint64_t depot_free;    /* 仓库 slab 空闲链表中的对象数量 */
+    uint64_t depot_full;    /* 仓库中非空弹匣的数量 */
+    uint64_t depot_empty;   /* 仓库中空弹匣的数量 */
+    uint64_t depot_ops;     /* 访问仓库(加锁)的次数 */
+    uint64_t caches;        /* 线程缓存数量 */
+    uint64_t poison_errors; /* 分配时发现毒化字节被修改的次数 */
+};
+
+/**
+ * 实现一个定长对象池, 替代热路径上同尺寸节点(TAILQ 元素, 定时器节点等)的 malloc/free.
+ *  (1) 内存按 slab 向系统申请, slab 按缓存行对齐, 切分成定长对象挂到仓库的空闲链表上,
+ *      对象只在销毁对象池时随 slab 一起释放.
+ *  (2) 每个线程有两个弹匣: loaded 和 previous. 分配从 loaded 弹出, loaded 为空且 previous 非空时交换;
+ *      释放压入 loaded, loaded 已满且 previous 为空时交换. 两个弹匣保证在满/空边界上来回分配释放
+ *      不会访问仓库, 绝大多数分配释放只访问线程自己的数据.
+ *  (3) 两个弹匣都不能满足时才加锁访问仓库, 以整个弹匣为单位交换: 分配时换入一个非空弹匣,
+ *      仓库没有时从 slab 空闲链表装填; 释放时换出一个满弹匣, 换入一个空弹匣.
+ *  (4) 线程缓存通过 pthread 线程私有数据查找, 线程退出时把弹匣归还仓库, 对象不会滞留在已退出的线程中.
+ *  (5) 创建时指定 EASEDS_POOL_POISON 且未定义 NDEBUG 时, 释放的对象整体填充 EASEDS_POOL_POISON_BYTE,
+ *      分配时检查填充是否完整, 被修改说明存在释放后写入(use-after-free), 记录错误日志和计数.
+ *  (6) 分配和释放是线程安全的, 一个线程分配的对象可以由其他线程释放; 创建和销毁不是线程安全的.
+ */
+struct easeds_pool {
+    const char                   *name;      /* 名称, 预留字段, 可用于调试和日志输出 */
+    uint32_t                      obj_size;  /* 对象大小, EASEDS_POOL_ALIGN 的整数倍 */
+    uint32_t                      flags;     /* 创建标志 */
+    uint64_t                      slab_size; /* slab 字节数 */
+    uint64_t                      slab_objs; /* 每个 slab 的对象数量 */
+    pthread_key_t                 key;       /* 线程缓存的线程私有数据键 */
+    uint32_t                      pad;       /* 对齐填充 */
+    pthread_mutex_t               lock;      /* 仓库锁, 保护以下字段 */
+    void                         *free_list; /* slab 空闲链表, 对象首字为下一个对象 */
+    void                         *slabs;     /* slab 链表, slab 首字为下一个 slab */
+    struct easeds_pool_magazine  *full;      /* 非空弹匣链表 */
+    struct easeds_pool_magazine  *empty;     /* 空弹匣链表 */
+    struct easeds_pool_cache_list caches;    /* 线程缓存链表 */
+    struct easeds_pool_stats      stats;     /* 统计信息, 除 poison_errors 外由仓库锁保护 */
+};
+
+/**
+ * 常见对象池操作函数:
+ *
+ * 函数名                   功能描述
+ * --------------------     ------------------------------------------------------
+ * easeds_pool_create       创建对象池, 指定对象大小和标志, 失败返回NULL
+ * easeds_pool_destroy      销毁对象池, 释放所有 slab, 调用时不能有其他线程访问
+ * easeds_pool_alloc        分配一个对象, 失败返回NULL
+ * easeds_pool_free         释放一个对象
+ * easeds_pool_flush        把当前线程缓存的对象归还仓库
+ * easeds_pool_obj_size     获取对象大小
+ * easeds_pool_stats        获取统计信息
+ */
+
+// 创建对象池, obj_size 为对象大小, flags 为 EASEDS_POOL_* 标志, 失败返回NULL
+struct easeds_pool *easeds_pool_create(const char *name, uint32_t obj_size, uint32_t flags);
+
+// 销毁对象池, 释放所有 slab 和线程缓存, 未归还的对象也随之失效, 调用时不能有其他线程访问
+void easeds_pool_destroy(struct easeds_pool *pool);
+
+// 分配一个对象, 内容未初始化, 失败返回NULL
+void *easeds_pool_alloc(struct easeds_pool *pool);
+
+// 释放一个对象, obj 必须来自同一个对象池, obj 为NULL时不做任何操作
+void easeds_pool_free(struct easeds_pool *pool, void *obj);
+
+// 把当前线程缓存的对象归还仓库, 线程长时间不再使用对象池时调用
+void easeds_pool_flush(struct easeds_pool *pool);
+
+// 获取对象大小, 为创建时的大小向上取整到 EASEDS_POOL_ALIGN
+uint32_t easeds_pool_obj_size(struct easeds_pool *pool);
+
+// 获取统计信息
+void easeds_pool_stats(struct easeds_pool *pool, struct easeds_pool_stats *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __EASEDS_POOL_H__ */
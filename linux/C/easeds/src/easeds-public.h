@@ -20,6 +20,9 @@
 #ifndef __EASEDS_PUBLIC_H__
 #define __EASEDS_PUBLIC_H__
 
+/* C 标准库头文件 */
+#include <stddef.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -29,6 +32,14 @@ extern "C" {
 #define EASEDS_ERROR              (-1)
 #define EASEDS_ERROR_NULL_POINTER (-2) /* 空指针错误 */
 
+/* 内存分配接口, 容器通过它从 arena/对象池等分配内存, 释放和重新分配时传入原大小 */
+struct easeds_allocator {
+    void *(*alloc_fn)(void *ctx, size_t size);                               /* 分配 */
+    void *(*realloc_fn)(void *ctx, void *ptr, size_t old_size, size_t size); /* 重新分配 */
+    void (*free_fn)(void *ctx, void *ptr, size_t size);                      /* 释放 */
+    void *ctx;                                                               /* 分配器上下文 */
+};
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,340 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-queue-unittest.c
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-19 00:10
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  Easeds 链表排序单元测试实现文件, 包含了 TAILQ_SORT/STAILQ_SORT 正确性/稳定性/边界和性能测试.
+ *
+ * @History:
+ *  2026年10月19日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#include "easeds-unittest.h"
+
+// 标准库头文件
+#include <stdlib.h>
+
+// 项目内部头文件
+#include "easeds-queue.h"
+#include "easeds-utils.h"
+
+// 测试节点, 同时挂在尾队列和单向尾队列上
+struct sort_node {
+    TAILQ_ENTRY(sort_node) tq;   /* 尾队列链接 */
+    STAILQ_ENTRY(sort_node) stq; /* 单向尾队列链接 */
+    uint32_t key;                /* 排序键值 */
+    uint32_t seq;                /* 插入顺序, 用于检查稳定性 */
+};
+
+TAILQ_HEAD(sort_tailq, sort_node);
+STAILQ_HEAD(sort_stailq, sort_node);
+
+// 比较函数, 只比较键值, 由排序宏直接展开调用
+static inline int32_t sort_node_cmp(const struct sort_node *a, const struct sort_node *b)
+{
+    return a->key < b->key ? -1 : (a->key > b->key ? 1 : 0);
+}
+
+// qsort 比较函数, 元素为节点指针
+static int sort_node_qsort_cmp(const void *a, const void *b)
+{
+    return sort_node_cmp(*(struct sort_node *const *)a, *(struct sort_node *const *)b);
+}
+
+// 生成随机数
+static uint64_t sort_rand(uint64_t *seed)
+{
+    *seed ^= *seed << 13;
+    *seed ^= *seed >> 7;
+    *seed ^= *seed << 17;
+    return *seed;
+}
+
+// 检查尾队列有序且稳定, 正反向链接一致, 返回节点数量, 不一致返回 UINT32_MAX
+static uint32_t sort_check_tailq(struct sort_tailq *head)
+{
+    struct sort_node *node, *prev = NULL;
+    uint32_t          count = 0;
+
+    TAILQ_FOREACH(node, head, tq)
+    {
+        if (TAILQ_PREV(node, sort_tailq, tq) != prev) {
+            return UINT32_MAX;
+        }
+        if (prev != NULL && (prev->key > node->key ||
+                                (prev->key == node->key && prev->seq > node->seq))) {
+            return UINT32_MAX;
+        }
+        prev = node;
+        count++;
+    }
+    if (TAILQ_LAST(head, sort_tailq) != prev) {
+        return UINT32_MAX;
+    }
+    return count;
+}
+
+// 检查单向尾队列有序且稳定, 尾指针正确, 返回节点数量, 不一致返回 UINT32_MAX
+static uint32_t sort_check_stailq(struct sort_stailq *head)
+{
+    struct sort_node *node, *prev = NULL;
+    uint32_t          count = 0;
+
+    STAILQ_FOREACH(node, head, stq)
+    {
+        if (prev != NULL && (prev->key > node->key ||
+                                (prev->key == node->key && prev->seq > node->seq))) {
+            return UINT32_MAX;
+        }
+        prev = node;
+        count++;
+    }
+    if (head->stqh_last != (prev != NULL ? &STAILQ_NEXT(prev, stq) : &STAILQ_FIRST(head))) {
+        return UINT32_MAX;
+    }
+    return count;
+}
+
+// 基本功能测试: 单向尾队列和尾队列排序
+static void test_easeds_queue_basic(void **state)
+{
+    easeds_unused(state);
+
+    const uint32_t     keys[] = {5, 3, 9, 1, 7, 3, 0, 8, 2, 6};
+    struct sort_node   nodes[10];
+    struct sort_tailq  tq  = TAILQ_HEAD_INITIALIZER(tq);
+    struct sort_stailq stq = STAILQ_HEAD_INITIALIZER(stq);
+
+    for (uint32_t i = 0; i < 10; i++) {
+        nodes[i].key = keys[i];
+        nodes[i].seq = i;
+        TAILQ_INSERT_TAIL(&tq, &nodes[i], tq);
+        STAILQ_INSERT_TAIL(&stq, &nodes[i], stq);
+    }
+
+    TAILQ_SORT(&tq, sort_node, tq, sort_node_cmp);
+    STAILQ_SORT(&stq, sort_node, stq, sort_node_cmp);
+    assert_int_equal(sort_check_tailq(&tq), 10);
+    assert_int_equal(sort_check_stailq(&stq), 10);
+    assert_int_equal(TAILQ_FIRST(&tq)->key, 0);
+    assert_int_equal(TAILQ_LAST(&tq, sort_tailq)->key, 9);
+    assert_int_equal(STAILQ_FIRST(&stq)->key, 0);
+}
+
+// 基本功能测试: 排序后继续插入/删除, 链接状态完整
+static void test_easeds_queue_operations(void **state)
+{
+    easeds_unused(state);
+
+    struct sort_node   nodes[64];
+    struct sort_node  *victim;
+    struct sort_tailq  tq   = TAILQ_HEAD_INITIALIZER(tq);
+    struct sort_stailq stq  = STAILQ_HEAD_INITIALIZER(stq);
+    uint64_t           seed = 88172645463325252ULL;
+
+    for (uint32_t i = 0; i < 60; i++) {
+        nodes[i].key = (uint32_t)(sort_rand(&seed) % 1000);
+        nodes[i].seq = 59 - i; /* 头部插入, seq 为在链表中的位置 */
+        TAILQ_INSERT_HEAD(&tq, &nodes[i], tq);
+        STAILQ_INSERT_HEAD(&stq, &nodes[i], stq);
+    }
+    TAILQ_SORT(&tq, sort_node, tq, sort_node_cmp);
+    STAILQ_SORT(&stq, sort_node, stq, sort_node_cmp);
+
+    /* 插入头尾, 删除首尾节点, 检查头尾指针仍然有效 */
+    nodes[60].key = 0;
+    nodes[60].seq = 0;
+    TAILQ_INSERT_HEAD(&tq, &nodes[60], tq);
+    STAILQ_INSERT_HEAD(&stq, &nodes[60], stq);
+    nodes[61].key = 1000;
+    nodes[61].seq = 61;
+    TAILQ_INSERT_TAIL(&tq, &nodes[61], tq);
+    STAILQ_INSERT_TAIL(&stq, &nodes[61], stq);
+    assert_int_equal(sort_check_tailq(&tq), 62);
+    assert_int_equal(sort_check_stailq(&stq), 62);
+
+    /* TAILQ_REMOVE 会多次展开 elm 参数, 先取出节点再删除 */
+    victim = TAILQ_LAST(&tq, sort_tailq);
+    TAILQ_REMOVE(&tq, victim, tq);
+    victim = TAILQ_FIRST(&tq);
+    TAILQ_REMOVE(&tq, victim, tq);
+    STAILQ_REMOVE_HEAD(&stq, stq);
+    assert_int_equal(sort_check_tailq(&tq), 60);
+    assert_int_equal(sort_check_stailq(&stq), 61);
+
+    /* 追加乱序节点后再次排序 */
+    nodes[62].key = 500;
+    nodes[62].seq = 62;
+    nodes[63].key = 1;
+    nodes[63].seq = 63;
+    TAILQ_INSERT_TAIL(&tq, &nodes[62], tq);
+    TAILQ_INSERT_TAIL(&tq, &nodes[63], tq);
+    TAILQ_SORT(&tq, sort_node, tq, sort_node_cmp);
+    assert_int_equal(sort_check_tailq(&tq), 62);
+}
+
+// 边界测试: 空链表, 单个节点, 两个节点, 已有序, 逆序, 全部相等
+static void test_easeds_queue_boundary(void **state)
+{
+    easeds_unused(state);
+
+    struct sort_node   nodes[100];
+    struct sort_tailq  tq  = TAILQ_HEAD_INITIALIZER(tq);
+    struct sort_stailq stq = STAILQ_HEAD_INITIALIZER(stq);
+
+    /* 空链表排序后仍然可以插入 */
+    TAILQ_SORT(&tq, sort_node, tq, sort_node_cmp);
+    STAILQ_SORT(&stq, sort_node, stq, sort_node_cmp);
+    assert_true(TAILQ_EMPTY(&tq));
+    assert_true(STAILQ_EMPTY(&stq));
+    nodes[0].key = 1;
+    nodes[0].seq = 0;
+    TAILQ_INSERT_TAIL(&tq, &nodes[0], tq);
+    STAILQ_INSERT_TAIL(&stq, &nodes[0], stq);
+    TAILQ_SORT(&tq, sort_node, tq, sort_node_cmp);
+    STAILQ_SORT(&stq, sort_node, stq, sort_node_cmp);
+    assert_int_equal(sort_check_tailq(&tq), 1);
+    assert_int_equal(sort_check_stailq(&stq), 1);
+
+    /* 两个节点逆序 */
+    nodes[1].key = 0;
+    nodes[1].seq = 1;
+    TAILQ_INSERT_TAIL(&tq, &nodes[1], tq);
+    STAILQ_INSERT_TAIL(&stq, &nodes[1], stq);
+    TAILQ_SORT(&tq, sort_node, tq, sort_node_cmp);
+    STAILQ_SORT(&stq, sort_node, stq, sort_node_cmp);
+    assert_ptr_equal(TAILQ_FIRST(&tq), &nodes[1]);
+    assert_ptr_equal(STAILQ_FIRST(&stq), &nodes[1]);
+    assert_int_equal(sort_check_tailq(&tq), 2);
+
+    /* 已有序, 逆序, 全部相等, 节点数不是2的幂 */
+    for (uint32_t mode = 0; mode < 3; mode++) {
+        TAILQ_INIT(&tq);
+        for (uint32_t i = 0; i < 99; i++) {
+            nodes[i].key = mode == 0 ? i : (mode == 1 ? 99 - i : 7);
+            nodes[i].seq = i;
+            TAILQ_INSERT_TAIL(&tq, &nodes[i], tq);
+        }
+        TAILQ_SORT(&tq, sort_node, tq, sort_node_cmp);
+        assert_int_equal(sort_check_tailq(&tq), 99);
+        if (mode == 2) {
+            /* 全部相等时保持原有顺序 */
+            assert_ptr_equal(TAILQ_FIRST(&tq), &nodes[0]);
+            assert_ptr_equal(TAILQ_LAST(&tq, sort_tailq), &nodes[98]);
+        }
+    }
+}
+
+// 稳定性测试: 大量重复键值, 相等节点保持插入顺序
+static void test_easeds_queue_error(void **state)
+{
+    easeds_unused(state);
+
+    const uint32_t     count = 10007;
+    struct sort_node  *nodes = malloc(sizeof(struct sort_node) * count);
+    struct sort_tailq  tq    = TAILQ_HEAD_INITIALIZER(tq);
+    struct sort_stailq stq   = STAILQ_HEAD_INITIALIZER(stq);
+    uint64_t           seed  = 88172645463325252ULL;
+    assert_non_null(nodes);
+
+    for (uint32_t i = 0; i < count; i++) {
+        nodes[i].key = (uint32_t)(sort_rand(&seed) % 16);
+        nodes[i].seq = i;
+        TAILQ_INSERT_TAIL(&tq, &nodes[i], tq);
+        STAILQ_INSERT_TAIL(&stq, &nodes[i], stq);
+    }
+    TAILQ_SORT(&tq, sort_node, tq, sort_node_cmp);
+    STAILQ_SORT(&stq, sort_node, stq, sort_node_cmp);
+    assert_int_equal(sort_check_tailq(&tq), count);
+    assert_int_equal(sort_check_stailq(&stq), count);
+
+    /* 再次排序已有序链表, 结果不变 */
+    struct sort_node *first = TAILQ_FIRST(&tq);
+    TAILQ_SORT(&tq, sort_node, tq, sort_node_cmp);
+    assert_ptr_equal(TAILQ_FIRST(&tq), first);
+    assert_int_equal(sort_check_tailq(&tq), count);
+    free(nodes);
+}
+
+// 复制到数组排序再重新链接, 性能对比使用
+static void sort_tailq_by_array(struct sort_tailq *head, struct sort_node **array)
+{
+    struct sort_node *node;
+    size_t            count = 0;
+
+    TAILQ_FOREACH(node, head, tq)
+    {
+        array[count++] = node;
+    }
+    qsort(array, count, sizeof(struct sort_node *), sort_node_qsort_cmp);
+    TAILQ_INIT(head);
+    for (size_t i = 0; i < count; i++) {
+        TAILQ_INSERT_TAIL(head, array[i], tq);
+    }
+}
+
+// 性能测试: TAILQ_SORT 与复制到数组排序再重新链接
+static void test_easeds_queue_perf(void **state)
+{
+    easeds_unused(state);
+
+    const uint32_t     count = 1000000;
+    struct sort_node  *nodes = malloc(sizeof(struct sort_node) * count);
+    struct sort_node **array = malloc(sizeof(struct sort_node *) * count);
+    struct sort_tailq  tq    = TAILQ_HEAD_INITIALIZER(tq);
+    struct sort_stailq stq   = STAILQ_HEAD_INITIALIZER(stq);
+    uint64_t           seed  = 88172645463325252ULL;
+    assert_non_null(nodes);
+    assert_non_null(array);
+
+    for (uint32_t i = 0; i < count; i++) {
+        nodes[i].key = (uint32_t)sort_rand(&seed);
+        nodes[i].seq = i;
+        TAILQ_INSERT_TAIL(&tq, &nodes[i], tq);
+        STAILQ_INSERT_TAIL(&stq, &nodes[i], stq);
+    }
+
+    int64_t start = easeds_get_current_time_ns();
+    TAILQ_SORT(&tq, sort_node, tq, sort_node_cmp);
+    double tailq_ms = (double)(easeds_get_current_time_ns() - start) / 1e6;
+    assert_int_equal(sort_check_tailq(&tq), count);
+
+    start = easeds_get_current_time_ns();
+    STAILQ_SORT(&stq, sort_node, stq, sort_node_cmp);
+    double stailq_ms = (double)(easeds_get_current_time_ns() - start) / 1e6;
+    assert_int_equal(sort_check_stailq(&stq), count);
+
+    /* 恢复为插入顺序, 再用数组排序 */
+    TAILQ_INIT(&tq);
+    for (uint32_t i = 0; i < count; i++) {
+        TAILQ_INSERT_TAIL(&tq, &nodes[i], tq);
+    }
+    start = easeds_get_current_time_ns();
+    sort_tailq_by_array(&tq, array);
+    double array_ms = (double)(easeds_get_current_time_ns() - start) / 1e6;
+    assert_int_equal(sort_check_tailq(&tq), count);
+
+    MEASURE("[queue perf]: %u nodes, TAILQ_SORT %.1f ms, STAILQ_SORT %.1f ms, "
+            "copy+qsort+relink %.1f ms (extra %zu bytes).",
+        count, tailq_ms, stailq_ms, array_ms, sizeof(struct sort_node *) * count);
+
+    free(array);
+    free(nodes);
+}
+
+// 注册单元测试用例
+EASEDS_UNITTEST_REGISTER(easeds_unittest_queue){
+    cmocka_unit_test(test_easeds_queue_basic),
+    cmocka_unit_test(test_easeds_queue_operations),
+    cmocka_unit_test(test_easeds_queue_boundary),
+    cmocka_unit_test(test_easeds_queue_error),
+    cmocka_unit_test(test_easeds_queue_perf),
+    easeds_unit_test_end,
+};
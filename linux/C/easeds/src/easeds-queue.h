@@ -114,6 +114,7 @@
  * _REMOVE_HEAD                 +        -        +       -
  * _REMOVE                      s        +        s       +
  * _SWAP                        +        +        +       +
+ * _SORT                        -        -        +       +
  *
  */
 #undef QUEUE_MACRO_DEBUG
@@ -181,6 +182,63 @@ struct qm_trace {
 #define QUEUE_TYPEOF(type) struct type
 #endif
 
+/*
+ * Bottom-up merge sort helpers for STAILQ_SORT and TAILQ_SORT, working on a
+ * NULL terminated chain linked through (elm)->next. Elements are taken off
+ * the chain one by one and merged into bins[i], which holds a sorted run of
+ * 2^i elements or NULL, like a binary counter; the bins are merged together
+ * at the end. Merging early keeps the working set small and cache hot, and
+ * the bins are a fixed array of QUEUE_SORT_BINS pointers, so the sort needs
+ * O(n log n) comparisons, no allocation and O(1) extra memory. On ties the
+ * element that came first is kept first, so the sort is stable. cmp(a, b)
+ * is expanded inline and returns <0, 0 or >0 like the RB_GENERATE comparators.
+ */
+#define QUEUE_SORT_BINS 64
+
+#define QUEUE_MERGE_RUNS(out, a, b, type, next, cmp)                  \
+    do {                                                              \
+        QUEUE_TYPEOF(type) *qm_a = (a), *qm_b = (b), *qm_head = NULL; \
+        QUEUE_TYPEOF(type) **qm_tail = &qm_head;                      \
+        while (qm_a != NULL && qm_b != NULL) {                        \
+            if (cmp(qm_b, qm_a) < 0) {                                \
+                *qm_tail = qm_b;                                      \
+                qm_tail  = &qm_b->next;                               \
+                qm_b     = qm_b->next;                                \
+            } else {                                                  \
+                *qm_tail = qm_a;                                      \
+                qm_tail  = &qm_a->next;                               \
+                qm_a     = qm_a->next;                                \
+            }                                                         \
+        }                                                             \
+        *qm_tail = qm_a != NULL ? qm_a : qm_b;                        \
+        (out)    = qm_head;                                           \
+    } while (0)
+
+#define QUEUE_MERGE_SORT(first, type, next, cmp)                                  \
+    do {                                                                          \
+        QUEUE_TYPEOF(type) *qs_bins[QUEUE_SORT_BINS];                             \
+        QUEUE_TYPEOF(type) *qs_elm = (first), *qs_run;                            \
+        unsigned int qs_i, qs_used = 0;                                           \
+        while (qs_elm != NULL) {                                                  \
+            qs_run       = qs_elm;                                                \
+            qs_elm       = qs_elm->next;                                          \
+            qs_run->next = NULL;                                                  \
+            for (qs_i = 0; qs_i < qs_used && qs_bins[qs_i] != NULL; qs_i++) {     \
+                QUEUE_MERGE_RUNS(qs_run, qs_bins[qs_i], qs_run, type, next, cmp); \
+                qs_bins[qs_i] = NULL;                                             \
+            }                                                                     \
+            if (qs_i == qs_used)                                                  \
+                qs_used++;                                                        \
+            qs_bins[qs_i] = qs_run;                                               \
+        }                                                                         \
+        qs_run = NULL;                                                            \
+        for (qs_i = 0; qs_i < qs_used; qs_i++) {                                  \
+            if (qs_bins[qs_i] != NULL)                                            \
+                QUEUE_MERGE_RUNS(qs_run, qs_bins[qs_i], qs_run, type, next, cmp); \
+        }                                                                         \
+        (first) = qs_run;                                                         \
+    } while (0)
+
 /*
  * Singly-linked List declarations.
  */
@@ -446,6 +504,16 @@ struct qm_trace {
             (head2)->stqh_last = &STAILQ_FIRST(head2);        \
     } while (0)
 
+#define STAILQ_SORT(head, type, field, cmp)                               \
+    do {                                                                  \
+        QUEUE_TYPEOF(type) *sort_elm = STAILQ_FIRST(head);                \
+        QUEUE_MERGE_SORT(sort_elm, type, field.stqe_next, cmp);           \
+        STAILQ_FIRST(head) = sort_elm;                                    \
+        (head)->stqh_last  = &STAILQ_FIRST(head);                         \
+        for (; sort_elm != NULL; sort_elm = STAILQ_NEXT(sort_elm, field)) \
+            (head)->stqh_last = &STAILQ_NEXT(sort_elm, field);            \
+    } while (0)
+
 #define STAILQ_END(head) NULL
 
 /*
@@ -870,6 +938,20 @@ struct qm_trace {
             (head2)->tqh_last = &(head2)->tqh_first;          \
     } while (0)
 
+#define TAILQ_SORT(head, type, field, cmp)                                 \
+    do {                                                                   \
+        QUEUE_TYPEOF(type) *sort_elm = TAILQ_FIRST(head);                  \
+        QUEUE_TYPEOF(type) **sort_prev = &TAILQ_FIRST(head);               \
+        QUEUE_MERGE_SORT(sort_elm, type, field.tqe_next, cmp);             \
+        TAILQ_FIRST(head) = sort_elm;                                      \
+        for (; sort_elm != NULL; sort_elm = TAILQ_NEXT(sort_elm, field)) { \
+            sort_elm->field.tqe_prev = sort_prev;                          \
+            sort_prev                = &TAILQ_NEXT(sort_elm, field);       \
+        }                                                                  \
+        (head)->tqh_last = sort_prev;                                      \
+        QMD_TRACE_HEAD(head);                                              \
+    } while (0)
+
 #define TAILQ_END(head) NULL
 
 #endif /* !_SYS_QUEUE_H_ */
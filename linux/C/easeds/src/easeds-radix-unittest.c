@@ -0,0 +1,421 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-radix-unittest.c
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-18 19:20
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  Easeds 压缩基数树单元测试实现文件, 包含了精确查找/最长前缀匹配/前缀遍历/节点类型变化/性能测试.
+ *
+ * @History:
+ *  2026年10月18日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#include "easeds-unittest.h"
+
+// 项目内部头文件
+#include "easeds-radix.h"
+#include "easeds-utils.h"
+
+#define RADIX_NAME_SIZE 64
+
+/* 指标名使用的服务名, 组成 "svc.<service>.<path>.<index>" 形式的键 */
+static const char *radix_services[] = {"db", "dbx", "cache", "gateway", "auth", "queue"};
+
+#define RADIX_SERVICES (sizeof(radix_services) / sizeof(radix_services[0]))
+
+/* 前缀遍历的检查上下文 */
+struct radix_scan {
+    const char *prefix;                /* 查询的前缀 */
+    char        last[RADIX_NAME_SIZE]; /* 上一个遍历到的键, 检查字典序 */
+    uint64_t    count;                 /* 遍历数量 */
+    uint64_t    sum;                   /* 值的累加和 */
+};
+
+static void radix_scan_cb(const uint8_t *key, uint32_t key_len, void *value, void *user_data)
+{
+    struct radix_scan *scan = user_data;
+    char               name[RADIX_NAME_SIZE];
+
+    assert_true(key_len < RADIX_NAME_SIZE);
+    memcpy(name, key, key_len);
+    name[key_len] = '\0';
+
+    assert_true(strncmp(name, scan->prefix, strlen(scan->prefix)) == 0);
+    assert_true(scan->count == 0 || strcmp(scan->last, name) < 0);
+    strcpy(scan->last, name);
+    scan->count++;
+    scan->sum += (uint64_t)(uintptr_t)value;
+}
+
+// 生成第 i 个指标名, 路径部分为随机的名称字符
+static void radix_make_name(char *name, uint32_t i)
+{
+    char path[24];
+
+    easeds_get_random_path_name(path, 1, 12);
+    snprintf(name, RADIX_NAME_SIZE, "svc.%s.%s.%u", radix_services[i % RADIX_SERVICES], path, i);
+}
+
+// 前缀遍历并和逐个比较的结果对照
+static void radix_check_prefix(
+    struct easeds_radix *tree, char (*names)[RADIX_NAME_SIZE], const bool *alive, uint32_t count,
+    const char *prefix)
+{
+    struct radix_scan scan;
+    uint64_t          expect = 0, expect_sum = 0;
+
+    for (uint32_t i = 0; i < count; i++) {
+        if (alive[i] && strncmp(names[i], prefix, strlen(prefix)) == 0) {
+            expect++;
+            expect_sum += i + 1;
+        }
+    }
+
+    memset(&scan, 0, sizeof(scan));
+    scan.prefix = prefix;
+    assert_int_equal(easeds_radix_prefix_foreach(tree, prefix, (uint32_t)strlen(prefix),
+                         radix_scan_cb, &scan),
+        expect);
+    assert_int_equal(scan.count, expect);
+    assert_int_equal(scan.sum, expect_sum);
+}
+
+// 基本功能测试: 插入覆盖, 精确查找, 最长前缀匹配, 前缀遍历, 删除合并
+static void test_easeds_radix_basic(void **state)
+{
+    easeds_unused(state);
+
+    static const char *keys[] = {
+        "svc", "svc.db", "svc.db.read", "svc.db.write", "svc.dbx.read", "svc.cache.hit", "sv"};
+    const uint32_t nkeys = sizeof(keys) / sizeof(keys[0]);
+
+    struct easeds_radix *tree = easeds_radix_create("basic");
+    assert_non_null(tree);
+    assert_int_equal(easeds_radix_size(tree), 0);
+    assert_int_equal(easeds_radix_memory(tree), 0);
+
+    for (uint32_t i = 0; i < nkeys; i++) {
+        assert_int_equal(easeds_radix_insert(tree, keys[i], (uint32_t)strlen(keys[i]),
+                             (void *)(uintptr_t)(i + 1)),
+            EASEDS_OK);
+        assert_int_equal(easeds_radix_verify(tree), EASEDS_OK);
+    }
+    assert_int_equal(easeds_radix_size(tree), nkeys);
+
+    void *value = NULL;
+    for (uint32_t i = 0; i < nkeys; i++) {
+        assert_int_equal(
+            easeds_radix_find(tree, keys[i], (uint32_t)strlen(keys[i]), &value), EASEDS_OK);
+        assert_true(value == (void *)(uintptr_t)(i + 1));
+    }
+    assert_int_equal(easeds_radix_find(tree, "svc.d", 5, &value), EASEDS_ERROR);
+    assert_int_equal(easeds_radix_find(tree, "s", 1, &value), EASEDS_ERROR);
+    assert_int_equal(easeds_radix_find(tree, "svc.db.readx", 12, &value), EASEDS_ERROR);
+
+    // 覆盖旧值, 数量不变
+    assert_int_equal(easeds_radix_insert(tree, "svc.db", 6, (void *)(uintptr_t)100), EASEDS_OK);
+    assert_int_equal(easeds_radix_size(tree), nkeys);
+    assert_int_equal(easeds_radix_find(tree, "svc.db", 6, &value), EASEDS_OK);
+    assert_true(value == (void *)(uintptr_t)100);
+
+    // 最长前缀匹配
+    uint32_t match = 0;
+    assert_int_equal(
+        easeds_radix_longest_prefix(tree, "svc.db.read.p99", 15, &match, &value), EASEDS_OK);
+    assert_int_equal(match, 11);
+    assert_int_equal(
+        easeds_radix_longest_prefix(tree, "svc.db.rea", 10, &match, &value), EASEDS_OK);
+    assert_int_equal(match, 6);
+    assert_true(value == (void *)(uintptr_t)100);
+    assert_int_equal(easeds_radix_longest_prefix(tree, "svc.q", 5, &match, NULL), EASEDS_OK);
+    assert_int_equal(match, 3);
+    assert_int_equal(easeds_radix_longest_prefix(tree, "s", 1, &match, NULL), EASEDS_ERROR);
+
+    // 前缀遍历, 前缀可以停在压缩路径中间
+    const char *names[] = {"svc.db", "svc.db.read", "svc.db.write", "svc.dbx.read"};
+    struct radix_scan scan;
+    memset(&scan, 0, sizeof(scan));
+    scan.prefix = "svc.d";
+    assert_int_equal(easeds_radix_prefix_foreach(tree, "svc.d", 5, radix_scan_cb, &scan), 4);
+    assert_string_equal(scan.last, names[3]);
+    assert_int_equal(easeds_radix_prefix_foreach(tree, "svc.db.", 7, NULL, NULL), 2);
+    assert_int_equal(easeds_radix_prefix_foreach(tree, "", 0, NULL, NULL), nkeys);
+    assert_int_equal(easeds_radix_prefix_foreach(tree, "svc.x", 5, NULL, NULL), 0);
+    assert_int_equal(easeds_radix_prefix_foreach(tree, "svc.db.readx", 12, NULL, NULL), 0);
+
+    // 删除中间节点的值后, 单子节点路径被合并
+    assert_int_equal(easeds_radix_remove(tree, "svc.db", 6, &value), EASEDS_OK);
+    assert_true(value == (void *)(uintptr_t)100);
+    assert_int_equal(easeds_radix_remove(tree, "svc.db", 6, NULL), EASEDS_ERROR);
+    assert_int_equal(easeds_radix_remove(tree, "svc.d", 5, NULL), EASEDS_ERROR);
+    assert_int_equal(easeds_radix_verify(tree), EASEDS_OK);
+    assert_int_equal(easeds_radix_find(tree, "svc.db.read", 11, &value), EASEDS_OK);
+
+    for (uint32_t i = 0; i < nkeys; i++) {
+        int32_t ret = easeds_radix_remove(tree, keys[i], (uint32_t)strlen(keys[i]), NULL);
+        assert_int_equal(ret, i == 1 ? EASEDS_ERROR : EASEDS_OK);
+        assert_int_equal(easeds_radix_verify(tree), EASEDS_OK);
+    }
+    assert_int_equal(easeds_radix_size(tree), 0);
+    assert_null(tree->root);
+    assert_int_equal(easeds_radix_memory(tree), 0);
+
+    easeds_radix_destroy(tree);
+}
+
+// 基本功能测试: 大量指标名随机插入删除, 前缀查询和逐个比较对照
+static void test_easeds_radix_operations(void **state)
+{
+    easeds_unused(state);
+
+    const uint32_t count = 20000;
+    char (*names)[RADIX_NAME_SIZE] = malloc(count * RADIX_NAME_SIZE);
+    bool *alive                    = calloc(count, sizeof(bool));
+    assert_non_null(names);
+    assert_non_null(alive);
+
+    struct easeds_radix *tree = easeds_radix_create("ops");
+    assert_non_null(tree);
+
+    for (uint32_t i = 0; i < count; i++) {
+        radix_make_name(names[i], i);
+        assert_int_equal(easeds_radix_insert(tree, names[i], (uint32_t)strlen(names[i]),
+                             (void *)(uintptr_t)(i + 1)),
+            EASEDS_OK);
+        alive[i] = true;
+    }
+    assert_int_equal(easeds_radix_size(tree), count);
+    assert_int_equal(easeds_radix_verify(tree), EASEDS_OK);
+
+    // 随机路径名的首字符有 63 种, 服务名下的分支升级到了 NODE48/NODE256
+    assert_true(tree->nodes[EASEDS_RADIX_NODE48] + tree->nodes[EASEDS_RADIX_NODE256] > 0);
+
+    void *value = NULL;
+    for (uint32_t i = 0; i < count; i++) {
+        assert_int_equal(
+            easeds_radix_find(tree, names[i], (uint32_t)strlen(names[i]), &value), EASEDS_OK);
+        assert_true(value == (void *)(uintptr_t)(i + 1));
+    }
+
+    const char *prefixes[] = {"svc.db.", "svc.db", "svc.dbx.", "svc.gateway.a", "svc.", "svc.q",
+        "svc.cache.Z_", "svc.auth.x.1", "svc.none."};
+    for (uint32_t p = 0; p < sizeof(prefixes) / sizeof(prefixes[0]); p++) {
+        radix_check_prefix(tree, names, alive, count, prefixes[p]);
+    }
+
+    // 随机删除一半, 检查合并和降级后的结构
+    uint64_t seed = 0x2545F4914F6CDD1DULL;
+    for (uint32_t n = 0; n < count; n++) {
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+
+        uint32_t i   = (uint32_t)(seed % count);
+        int32_t  ret = easeds_radix_remove(tree, names[i], (uint32_t)strlen(names[i]), &value);
+        if (alive[i]) {
+            assert_int_equal(ret, EASEDS_OK);
+            assert_true(value == (void *)(uintptr_t)(i + 1));
+            alive[i] = false;
+        } else {
+            assert_int_equal(ret, EASEDS_ERROR);
+        }
+
+        if (n % 2000 == 0) {
+            assert_int_equal(easeds_radix_verify(tree), EASEDS_OK);
+        }
+    }
+    assert_int_equal(easeds_radix_verify(tree), EASEDS_OK);
+
+    uint64_t left = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        left += alive[i];
+        int32_t ret = easeds_radix_find(tree, names[i], (uint32_t)strlen(names[i]), NULL);
+        assert_int_equal(ret, alive[i] ? EASEDS_OK : EASEDS_ERROR);
+    }
+    assert_int_equal(easeds_radix_size(tree), left);
+    for (uint32_t p = 0; p < sizeof(prefixes) / sizeof(prefixes[0]); p++) {
+        radix_check_prefix(tree, names, alive, count, prefixes[p]);
+    }
+
+    // 全部删除后没有残留节点
+    for (uint32_t i = 0; i < count; i++) {
+        if (alive[i]) {
+            assert_int_equal(
+                easeds_radix_remove(tree, names[i], (uint32_t)strlen(names[i]), NULL), EASEDS_OK);
+        }
+    }
+    assert_int_equal(easeds_radix_verify(tree), EASEDS_OK);
+    assert_int_equal(easeds_radix_memory(tree), 0);
+
+    easeds_radix_destroy(tree);
+    free(alive);
+    free(names);
+}
+
+// 边界测试: 空键, 二进制键, 单层 256 分支的升级降级, 长公共前缀
+static void test_easeds_radix_boundary(void **state)
+{
+    easeds_unused(state);
+
+    struct easeds_radix *tree = easeds_radix_create("boundary");
+    assert_non_null(tree);
+
+    // 空键是所有键的前缀
+    uint32_t match = 1;
+    void    *value = NULL;
+    assert_int_equal(easeds_radix_insert(tree, "", 0, (void *)(uintptr_t)1), EASEDS_OK);
+    assert_int_equal(easeds_radix_find(tree, "", 0, &value), EASEDS_OK);
+    assert_int_equal(easeds_radix_longest_prefix(tree, "abc", 3, &match, NULL), EASEDS_OK);
+    assert_int_equal(match, 0);
+
+    // 单字节键 0..255, 根节点依次升级到 NODE256
+    uint8_t key[4096];
+    for (uint32_t b = 0; b < 256; b++) {
+        key[0] = (uint8_t)b;
+        assert_int_equal(
+            easeds_radix_insert(tree, key, 1, (void *)(uintptr_t)(b + 2)), EASEDS_OK);
+        uint8_t expect = b < 4 ? EASEDS_RADIX_NODE4
+                         : b < 16 ? EASEDS_RADIX_NODE16
+                         : b < 48 ? EASEDS_RADIX_NODE48
+                                  : EASEDS_RADIX_NODE256;
+        assert_true(tree->root != NULL && tree->root->type == expect);
+    }
+    assert_int_equal(easeds_radix_verify(tree), EASEDS_OK);
+    assert_int_equal(easeds_radix_prefix_foreach(tree, "", 0, NULL, NULL), 257);
+
+    // 倒序删除, 根节点依次降级
+    for (uint32_t b = 256; b-- > 0;) {
+        key[0] = (uint8_t)b;
+        assert_int_equal(easeds_radix_remove(tree, key, 1, &value), EASEDS_OK);
+        assert_true(value == (void *)(uintptr_t)(b + 2));
+        if (b % 8 == 0) {
+            assert_int_equal(easeds_radix_verify(tree), EASEDS_OK);
+        }
+    }
+    assert_true(tree->root != NULL && tree->root->type == EASEDS_RADIX_LEAF);
+    assert_int_equal(easeds_radix_remove(tree, "", 0, NULL), EASEDS_OK);
+    assert_null(tree->root);
+
+    // 含 0 字节的二进制键, 以及 4096 字节长公共前缀只存一份
+    memset(key, 0, sizeof(key));
+    for (uint32_t i = 0; i < 64; i++) {
+        key[sizeof(key) - 1] = (uint8_t)i;
+        assert_int_equal(
+            easeds_radix_insert(tree, key, sizeof(key), (void *)(uintptr_t)i), EASEDS_OK);
+    }
+    assert_int_equal(easeds_radix_verify(tree), EASEDS_OK);
+    assert_true(easeds_radix_memory(tree) < sizeof(key) + 64 * 64);
+    assert_int_equal(easeds_radix_prefix_foreach(tree, key, sizeof(key) - 1, NULL, NULL), 64);
+    assert_int_equal(easeds_radix_find(tree, key, sizeof(key) - 1, NULL), EASEDS_ERROR);
+    key[sizeof(key) - 1] = 63;
+    assert_int_equal(easeds_radix_find(tree, key, sizeof(key), &value), EASEDS_OK);
+    assert_true(value == (void *)(uintptr_t)63);
+
+    // 清空后复用
+    easeds_radix_clear(tree);
+    assert_int_equal(easeds_radix_size(tree), 0);
+    assert_int_equal(easeds_radix_memory(tree), 0);
+    assert_int_equal(easeds_radix_insert(tree, "a", 1, NULL), EASEDS_OK);
+    assert_int_equal(easeds_radix_find(tree, "a", 1, &value), EASEDS_OK);
+    assert_null(value);
+    easeds_radix_destroy(tree);
+}
+
+// 失效测试: 非法参数
+static void test_easeds_radix_error(void **state)
+{
+    easeds_unused(state);
+
+    void *value = NULL;
+    assert_int_equal(easeds_radix_insert(NULL, "a", 1, NULL), EASEDS_ERROR);
+    assert_int_equal(easeds_radix_remove(NULL, "a", 1, NULL), EASEDS_ERROR);
+    assert_int_equal(easeds_radix_find(NULL, "a", 1, &value), EASEDS_ERROR);
+    assert_int_equal(easeds_radix_longest_prefix(NULL, "a", 1, NULL, NULL), EASEDS_ERROR);
+    assert_int_equal(easeds_radix_prefix_foreach(NULL, "a", 1, NULL, NULL), 0);
+    assert_int_equal(easeds_radix_verify(NULL), EASEDS_ERROR);
+    assert_int_equal(easeds_radix_size(NULL), 0);
+    assert_int_equal(easeds_radix_memory(NULL), 0);
+    easeds_radix_destroy(NULL);
+
+    struct easeds_radix *tree = easeds_radix_create("error");
+    assert_non_null(tree);
+    assert_int_equal(easeds_radix_insert(tree, NULL, 0, NULL), EASEDS_ERROR);
+    assert_int_equal(easeds_radix_find(tree, "a", 1, &value), EASEDS_ERROR);
+    assert_int_equal(easeds_radix_remove(tree, "a", 1, &value), EASEDS_ERROR);
+    assert_int_equal(easeds_radix_longest_prefix(tree, "a", 1, NULL, NULL), EASEDS_ERROR);
+    assert_int_equal(easeds_radix_prefix_foreach(tree, "", 0, NULL, NULL), 0);
+    easeds_radix_destroy(tree);
+}
+
+// 性能测试: 指标名插入查找, 前缀遍历, 每个键的内存占用
+static void test_easeds_radix_perf(void **state)
+{
+    easeds_unused(state);
+
+    const uint32_t count = 200000;
+    char (*names)[RADIX_NAME_SIZE] = malloc(count * RADIX_NAME_SIZE);
+    uint32_t *lens                 = malloc(count * sizeof(uint32_t));
+    assert_non_null(names);
+    assert_non_null(lens);
+
+    uint64_t key_bytes = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        radix_make_name(names[i], i);
+        lens[i] = (uint32_t)strlen(names[i]);
+        key_bytes += lens[i];
+    }
+
+    struct easeds_radix *tree = easeds_radix_create("perf");
+    assert_non_null(tree);
+
+    int64_t start = easeds_get_current_time_ns();
+    for (uint32_t i = 0; i < count; i++) {
+        assert_int_equal(
+            easeds_radix_insert(tree, names[i], lens[i], (void *)(uintptr_t)i), EASEDS_OK);
+    }
+    int64_t insert_ns = easeds_get_current_time_ns() - start;
+
+    start = easeds_get_current_time_ns();
+    for (uint32_t i = 0; i < count; i++) {
+        assert_int_equal(easeds_radix_find(tree, names[i], lens[i], NULL), EASEDS_OK);
+    }
+    int64_t find_ns = easeds_get_current_time_ns() - start;
+
+    start            = easeds_get_current_time_ns();
+    uint64_t matched = easeds_radix_prefix_foreach(tree, "svc.db.", 7, NULL, NULL);
+    int64_t  scan_ns = easeds_get_current_time_ns() - start;
+    assert_true(matched > 0 && matched < count);
+
+    assert_int_equal(easeds_radix_verify(tree), EASEDS_OK);
+    uint64_t memory = easeds_radix_memory(tree);
+    MEASURE("[radix perf]: %u keys, insert %.1f ns/op, find %.1f ns/op, scan svc.db. %lu keys "
+            "%.1f ns/key.",
+        count, (double)insert_ns / count, (double)find_ns / count, matched,
+        (double)scan_ns / (double)matched);
+    MEASURE("[radix perf]: memory %.1f bytes/key (keys %.1f bytes/key), nodes "
+            "leaf=%lu n4=%lu n16=%lu n48=%lu n256=%lu.",
+        (double)memory / count, (double)key_bytes / count,
+        tree->nodes[EASEDS_RADIX_LEAF], tree->nodes[EASEDS_RADIX_NODE4],
+        tree->nodes[EASEDS_RADIX_NODE16], tree->nodes[EASEDS_RADIX_NODE48],
+        tree->nodes[EASEDS_RADIX_NODE256]);
+
+    easeds_radix_destroy(tree);
+    free(lens);
+    free(names);
+}
+
+// 注册单元测试用例
+EASEDS_UNITTEST_REGISTER(easeds_unittest_radix){
+    cmocka_unit_test(test_easeds_radix_basic),
+    cmocka_unit_test(test_easeds_radix_operations),
+    cmocka_unit_test(test_easeds_radix_boundary),
+    cmocka_unit_test(test_easeds_radix_error),
+    cmocka_unit_test(test_easeds_radix_perf),
+    easeds_unit_test_end,
+};
@@ -0,0 +1,924 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-radix.c
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-18 18:50
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  压缩基数树(Radix Trie)实现文件.
+ *
+ * @History:
+ *  2026年10月18日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#include "easeds-radix.h"
+
+// 标准库头文件
+#include <stdlib.h>
+#include <string.h>
+
+// 项目内部头文件
+#include "easeds-log.h"
+
+/* 各类型节点结构体大小, 压缩路径从该偏移开始存放 */
+static const uint32_t radix_node_size[EASEDS_RADIX_TYPES] = {
+    sizeof(struct easeds_radix_node),
+    sizeof(struct easeds_radix_node4),
+    sizeof(struct easeds_radix_node16),
+    sizeof(struct easeds_radix_node48),
+    sizeof(struct easeds_radix_node256),
+};
+
+/* 各类型节点的子节点容量 */
+static const uint32_t radix_node_capacity[EASEDS_RADIX_TYPES] = {0, 4, 16, 48, 256};
+
+/* 删除子节点后降级的阈值, 子节点数量不超过该值时降为上一级类型, 和升级点错开避免抖动 */
+static const uint32_t radix_shrink_threshold[EASEDS_RADIX_TYPES] = {0, 0, 3, 12, 40};
+
+// 获取节点的压缩路径
+static uint8_t *radix_prefix(struct easeds_radix_node *node)
+{
+    return (uint8_t *)node + radix_node_size[node->type];
+}
+
+// 分配指定类型和压缩路径长度的空节点, 压缩路径由调用者填写, 失败返回NULL
+static struct easeds_radix_node *radix_node_alloc(
+    struct easeds_radix *tree, uint8_t type, uint32_t prefix_len)
+{
+    size_t                    bytes = (size_t)radix_node_size[type] + prefix_len;
+    struct easeds_radix_node *node  = __easeds_malloc(bytes);
+    if (unlikely(node == NULL)) {
+        EASEDS_ERR("[radix_node_alloc]: Malloc node %zu bytes failed.", bytes);
+        return NULL;
+    }
+
+    /* 子节点数组和 NODE48 下标表都需要清零 */
+    memset(node, 0, radix_node_size[type]);
+    node->prefix_len = prefix_len;
+    node->type       = type;
+
+    tree->memory += bytes;
+    tree->nodes[type]++;
+    return node;
+}
+
+// 释放单个节点, 不处理子节点
+static void radix_node_free(struct easeds_radix *tree, struct easeds_radix_node *node)
+{
+    tree->memory -= (uint64_t)radix_node_size[node->type] + node->prefix_len;
+    tree->nodes[node->type]--;
+    __easeds_free(node);
+}
+
+// 创建存放值的叶子节点, 失败返回NULL
+static struct easeds_radix_node *radix_leaf_new(
+    struct easeds_radix *tree, const uint8_t *prefix, uint32_t prefix_len, void *value)
+{
+    struct easeds_radix_node *leaf = radix_node_alloc(tree, EASEDS_RADIX_LEAF, prefix_len);
+    if (unlikely(leaf == NULL)) {
+        return NULL;
+    }
+
+    if (prefix_len != 0) {
+        memcpy(radix_prefix(leaf), prefix, prefix_len);
+    }
+    leaf->value     = value;
+    leaf->has_value = 1;
+    return leaf;
+}
+
+// 查找边字节对应的子节点槽位, 不存在返回NULL
+static struct easeds_radix_node **radix_find_child(struct easeds_radix_node *node, uint8_t byte)
+{
+    switch (node->type) {
+    case EASEDS_RADIX_NODE4: {
+        struct easeds_radix_node4 *n4 = (struct easeds_radix_node4 *)node;
+        for (uint32_t i = 0; i < node->count; i++) {
+            if (n4->keys[i] == byte) {
+                return &n4->children[i];
+            }
+        }
+        return NULL;
+    }
+    case EASEDS_RADIX_NODE16: {
+        struct easeds_radix_node16 *n16 = (struct easeds_radix_node16 *)node;
+        for (uint32_t i = 0; i < node->count; i++) {
+            if (n16->keys[i] == byte) {
+                return &n16->children[i];
+            }
+        }
+        return NULL;
+    }
+    case EASEDS_RADIX_NODE48: {
+        struct easeds_radix_node48 *n48  = (struct easeds_radix_node48 *)node;
+        uint8_t                     slot = n48->index[byte];
+        return slot != 0 ? &n48->children[slot - 1] : NULL;
+    }
+    case EASEDS_RADIX_NODE256: {
+        struct easeds_radix_node256 *n256 = (struct easeds_radix_node256 *)node;
+        return n256->children[byte] != NULL ? &n256->children[byte] : NULL;
+    }
+    default:
+        return NULL;
+    }
+}
+
+// 按边字节升序迭代子节点, pos 为迭代状态(初始为0), 没有更多子节点返回NULL
+static struct easeds_radix_node *radix_child_iter(
+    struct easeds_radix_node *node, uint32_t *pos, uint8_t *byte)
+{
+    switch (node->type) {
+    case EASEDS_RADIX_NODE4: {
+        struct easeds_radix_node4 *n4 = (struct easeds_radix_node4 *)node;
+        if (*pos >= node->count) {
+            return NULL;
+        }
+        *byte = n4->keys[*pos];
+        return n4->children[(*pos)++];
+    }
+    case EASEDS_RADIX_NODE16: {
+        struct easeds_radix_node16 *n16 = (struct easeds_radix_node16 *)node;
+        if (*pos >= node->count) {
+            return NULL;
+        }
+        *byte = n16->keys[*pos];
+        return n16->children[(*pos)++];
+    }
+    case EASEDS_RADIX_NODE48: {
+        struct easeds_radix_node48 *n48 = (struct easeds_radix_node48 *)node;
+        while (*pos < 256) {
+            uint8_t b = (uint8_t)(*pos)++;
+            if (n48->index[b] != 0) {
+                *byte = b;
+                return n48->children[n48->index[b] - 1];
+            }
+        }
+        return NULL;
+    }
+    case EASEDS_RADIX_NODE256: {
+        struct easeds_radix_node256 *n256 = (struct easeds_radix_node256 *)node;
+        while (*pos < 256) {
+            uint8_t b = (uint8_t)(*pos)++;
+            if (n256->children[b] != NULL) {
+                *byte = b;
+                return n256->children[b];
+            }
+        }
+        return NULL;
+    }
+    default:
+        return NULL;
+    }
+}
+
+// 在有序键数组中插入边字节和子节点, 数组必须还有空位
+static void radix_sorted_put(uint8_t *keys, struct easeds_radix_node **children, uint32_t count,
+    uint8_t byte, struct easeds_radix_node *child)
+{
+    uint32_t i = count;
+
+    /* 按顺序迁移子节点时 byte 总是最大, 不需要移动 */
+    while (i > 0 && keys[i - 1] > byte) {
+        keys[i]     = keys[i - 1];
+        children[i] = children[i - 1];
+        i--;
+    }
+    keys[i]     = byte;
+    children[i] = child;
+}
+
+// 在节点中添加子节点, 节点必须还有空位且边字节不存在
+static void radix_node_put(struct easeds_radix_node *node, uint8_t byte,
+    struct easeds_radix_node *child)
+{
+    switch (node->type) {
+    case EASEDS_RADIX_NODE4: {
+        struct easeds_radix_node4 *n4 = (struct easeds_radix_node4 *)node;
+        radix_sorted_put(n4->keys, n4->children, node->count, byte, child);
+        break;
+    }
+    case EASEDS_RADIX_NODE16: {
+        struct easeds_radix_node16 *n16 = (struct easeds_radix_node16 *)node;
+        radix_sorted_put(n16->keys, n16->children, node->count, byte, child);
+        break;
+    }
+    case EASEDS_RADIX_NODE48: {
+        struct easeds_radix_node48 *n48  = (struct easeds_radix_node48 *)node;
+        uint32_t                    slot = 0;
+        while (n48->children[slot] != NULL) {
+            slot++;
+        }
+        n48->children[slot] = child;
+        n48->index[byte]    = (uint8_t)(slot + 1);
+        break;
+    }
+    case EASEDS_RADIX_NODE256: {
+        struct easeds_radix_node256 *n256 = (struct easeds_radix_node256 *)node;
+        n256->children[byte]              = child;
+        break;
+    }
+    default:
+        return;
+    }
+    node->count++;
+}
+
+// 从节点中摘除边字节对应的子节点, 边字节必须存在
+static void radix_node_drop(struct easeds_radix_node *node, uint8_t byte)
+{
+    switch (node->type) {
+    case EASEDS_RADIX_NODE4:
+    case EASEDS_RADIX_NODE16: {
+        uint8_t                   *keys;
+        struct easeds_radix_node **children;
+        if (node->type == EASEDS_RADIX_NODE4) {
+            keys     = ((struct easeds_radix_node4 *)node)->keys;
+            children = ((struct easeds_radix_node4 *)node)->children;
+        } else {
+            keys     = ((struct easeds_radix_node16 *)node)->keys;
+            children = ((struct easeds_radix_node16 *)node)->children;
+        }
+        uint32_t i = 0;
+        while (i < node->count && keys[i] != byte) {
+            i++;
+        }
+        for (; i + 1 < node->count; i++) {
+            keys[i]     = keys[i + 1];
+            children[i] = children[i + 1];
+        }
+        break;
+    }
+    case EASEDS_RADIX_NODE48: {
+        struct easeds_radix_node48 *n48 = (struct easeds_radix_node48 *)node;
+        n48->children[n48->index[byte] - 1] = NULL;
+        n48->index[byte]                    = 0;
+        break;
+    }
+    case EASEDS_RADIX_NODE256: {
+        struct easeds_radix_node256 *n256 = (struct easeds_radix_node256 *)node;
+        n256->children[byte]              = NULL;
+        break;
+    }
+    default:
+        return;
+    }
+    node->count--;
+}
+
+// 复制节点为指定类型和压缩路径长度的新节点, 迁移值和子节点, 压缩路径由调用者填写
+static struct easeds_radix_node *radix_node_copy(struct easeds_radix *tree,
+    struct easeds_radix_node *node, uint8_t type, uint32_t prefix_len)
+{
+    struct easeds_radix_node *copy = radix_node_alloc(tree, type, prefix_len);
+    if (unlikely(copy == NULL)) {
+        return NULL;
+    }
+
+    copy->value     = node->value;
+    copy->has_value = node->has_value;
+
+    struct easeds_radix_node *child;
+    uint32_t                  pos  = 0;
+    uint8_t                   byte = 0;
+    while ((child = radix_child_iter(node, &pos, &byte)) != NULL) {
+        radix_node_put(copy, byte, child);
+    }
+    return copy;
+}
+
+// 把节点替换为另一种类型, 压缩路径不变, 成功返回0, 失败返回-1且原节点不变
+static int32_t radix_node_retype(
+    struct easeds_radix *tree, struct easeds_radix_node **ref, uint8_t type)
+{
+    struct easeds_radix_node *node = *ref;
+    struct easeds_radix_node *copy = radix_node_copy(tree, node, type, node->prefix_len);
+    if (unlikely(copy == NULL)) {
+        return -1;
+    }
+
+    memcpy(radix_prefix(copy), radix_prefix(node), node->prefix_len);
+    radix_node_free(tree, node);
+    *ref = copy;
+    return 0;
+}
+
+// 添加子节点, 节点已满时先升级为更大的类型, 成功返回0, 失败返回-1
+static int32_t radix_add_child(struct easeds_radix *tree, struct easeds_radix_node **ref,
+    uint8_t byte, struct easeds_radix_node *child)
+{
+    struct easeds_radix_node *node = *ref;
+
+    if (node->count == radix_node_capacity[node->type]) {
+        if (unlikely(radix_node_retype(tree, ref, (uint8_t)(node->type + 1)) != 0)) {
+            return -1;
+        }
+        node = *ref;
+    }
+
+    radix_node_put(node, byte, child);
+    return 0;
+}
+
+// 摘除子节点, 子节点数量低于阈值时降级为更小的类型, 降级失败时保留原类型
+static void radix_remove_child(
+    struct easeds_radix *tree, struct easeds_radix_node **ref, uint8_t byte)
+{
+    struct easeds_radix_node *node = *ref;
+
+    radix_node_drop(node, byte);
+    if (node->type != EASEDS_RADIX_LEAF && node->count <= radix_shrink_threshold[node->type]) {
+        radix_node_retype(tree, ref, (uint8_t)(node->type - 1));
+    }
+}
+
+// 合并没有值且只有一个子节点的节点, 新压缩路径为: 节点 prefix + 边字节 + 子节点 prefix
+static void radix_merge(struct easeds_radix *tree, struct easeds_radix_node **ref)
+{
+    struct easeds_radix_node *node = *ref;
+    uint32_t                  pos  = 0;
+    uint8_t                   byte = 0;
+    struct easeds_radix_node *child = radix_child_iter(node, &pos, &byte);
+    if (unlikely(child == NULL)) {
+        return;
+    }
+
+    uint32_t                  len    = node->prefix_len + 1 + child->prefix_len;
+    struct easeds_radix_node *merged = radix_node_copy(tree, child, child->type, len);
+    if (unlikely(merged == NULL)) {
+        return;
+    }
+
+    uint8_t *prefix = radix_prefix(merged);
+    memcpy(prefix, radix_prefix(node), node->prefix_len);
+    prefix[node->prefix_len] = byte;
+    memcpy(prefix + node->prefix_len + 1, radix_prefix(child), child->prefix_len);
+
+    radix_node_free(tree, child);
+    radix_node_free(tree, node);
+    *ref = merged;
+}
+
+// 在压缩路径的 same 处分裂节点, 新的父节点持有公共部分, 原节点和新键剩余部分 rest 成为子节点
+static int32_t radix_split(struct easeds_radix *tree, struct easeds_radix_node **ref, uint32_t same,
+    const uint8_t *rest, uint32_t rest_len, void *value)
+{
+    struct easeds_radix_node *node   = *ref;
+    uint8_t                  *prefix = radix_prefix(node);
+
+    struct easeds_radix_node *parent = radix_node_alloc(tree, EASEDS_RADIX_NODE4, same);
+    if (unlikely(parent == NULL)) {
+        return -1;
+    }
+    memcpy(radix_prefix(parent), prefix, same);
+
+    /* 原节点去掉公共部分和边字节, 压缩路径变短, 重新分配避免浪费 */
+    struct easeds_radix_node *tail =
+        radix_node_copy(tree, node, node->type, node->prefix_len - same - 1);
+    if (unlikely(tail == NULL)) {
+        radix_node_free(tree, parent);
+        return -1;
+    }
+    memcpy(radix_prefix(tail), prefix + same + 1, tail->prefix_len);
+
+    if (rest_len == 0) {
+        parent->value     = value;
+        parent->has_value = 1;
+    } else {
+        struct easeds_radix_node *leaf = radix_leaf_new(tree, rest + 1, rest_len - 1, value);
+        if (unlikely(leaf == NULL)) {
+            radix_node_free(tree, tail);
+            radix_node_free(tree, parent);
+            return -1;
+        }
+        radix_node_put(parent, rest[0], leaf);
+    }
+    radix_node_put(parent, prefix[same], tail);
+
+    radix_node_free(tree, node);
+    *ref = parent;
+    return 0;
+}
+
+// 精确查找键所在的节点, 不存在或节点没有值返回NULL
+static struct easeds_radix_node *radix_lookup(
+    struct easeds_radix *tree, const uint8_t *key, uint32_t key_len)
+{
+    struct easeds_radix_node *node  = tree->root;
+    uint32_t                  depth = 0;
+
+    while (node != NULL) {
+        uint32_t plen = node->prefix_len;
+        if (key_len - depth < plen || memcmp(radix_prefix(node), key + depth, plen) != 0) {
+            return NULL;
+        }
+
+        depth += plen;
+        if (depth == key_len) {
+            return node->has_value ? node : NULL;
+        }
+
+        struct easeds_radix_node **ref = radix_find_child(node, key[depth]);
+        if (ref == NULL) {
+            return NULL;
+        }
+        node = *ref;
+        depth++;
+    }
+
+    return NULL;
+}
+
+// 递归释放子树
+static void radix_free_tree(struct easeds_radix *tree, struct easeds_radix_node *node)
+{
+    struct easeds_radix_node *child;
+    uint32_t                  pos  = 0;
+    uint8_t                   byte = 0;
+
+    while ((child = radix_child_iter(node, &pos, &byte)) != NULL) {
+        radix_free_tree(tree, child);
+    }
+    radix_node_free(tree, node);
+}
+
+// 创建一棵空的基数树, 失败返回NULL
+struct easeds_radix *easeds_radix_create(const char *name)
+{
+    struct easeds_radix *tree = __easeds_malloc(sizeof(struct easeds_radix));
+    if (unlikely(tree == NULL)) {
+        EASEDS_ERR("[easeds_radix_create]: Malloc tree failed.");
+        return NULL;
+    }
+
+    memset(tree, 0, sizeof(struct easeds_radix));
+    tree->name = name;
+
+    PFL_DEBUG("[easeds_radix_create]: name=%s.", name != NULL ? name : "(null)");
+    return tree;
+}
+
+// 销毁基数树, 释放所有节点
+void easeds_radix_destroy(struct easeds_radix *tree)
+{
+    if (unlikely(tree == NULL)) {
+        return;
+    }
+
+    easeds_radix_clear(tree);
+    __easeds_free(tree);
+}
+
+// 清空基数树, 释放所有节点, 树结构体本身保留
+void easeds_radix_clear(struct easeds_radix *tree)
+{
+    if (unlikely(tree == NULL)) {
+        return;
+    }
+
+    if (tree->root != NULL) {
+        radix_free_tree(tree, tree->root);
+        tree->root = NULL;
+    }
+    tree->size        = 0;
+    tree->max_key_len = 0;
+}
+
+// 获取键值对数量
+uint64_t easeds_radix_size(struct easeds_radix *tree)
+{
+    return tree != NULL ? tree->size : 0;
+}
+
+// 获取节点占用的字节数, 不包含树结构体本身
+uint64_t easeds_radix_memory(struct easeds_radix *tree)
+{
+    return tree != NULL ? tree->memory : 0;
+}
+
+// 插入键值对, 键已存在时覆盖旧值, 成功返回0, 失败返回-1
+int32_t easeds_radix_insert(
+    struct easeds_radix *tree, const void *key, uint32_t key_len, void *value)
+{
+    const uint8_t *k = key;
+
+    if (unlikely(tree == NULL || key == NULL)) {
+        EASEDS_ERR("[easeds_radix_insert]: Invalid tree or key.");
+        return -1;
+    }
+
+    struct easeds_radix_node **ref   = &tree->root;
+    uint32_t                   depth = 0;
+    while (true) {
+        struct easeds_radix_node *node = *ref;
+        if (node == NULL) {
+            struct easeds_radix_node *leaf =
+                radix_leaf_new(tree, k + depth, key_len - depth, value);
+            if (unlikely(leaf == NULL)) {
+                return -1;
+            }
+            *ref = leaf;
+            break;
+        }
+
+        /* 比较压缩路径, 在第一个不同的字节处分裂 */
+        uint8_t *prefix = radix_prefix(node);
+        uint32_t rest   = key_len - depth;
+        uint32_t limit  = node->prefix_len < rest ? node->prefix_len : rest;
+        uint32_t same   = 0;
+        while (same < limit && prefix[same] == k[depth + same]) {
+            same++;
+        }
+        if (same < node->prefix_len) {
+            if (unlikely(radix_split(tree, ref, same, k + depth + same, rest - same, value) != 0)) {
+                return -1;
+            }
+            break;
+        }
+
+        depth += node->prefix_len;
+        if (depth == key_len) {
+            if (node->has_value) {
+                node->value = value;
+                return 0;
+            }
+            node->value     = value;
+            node->has_value = 1;
+            break;
+        }
+
+        struct easeds_radix_node **child = radix_find_child(node, k[depth]);
+        if (child == NULL) {
+            struct easeds_radix_node *leaf =
+                radix_leaf_new(tree, k + depth + 1, key_len - depth - 1, value);
+            if (unlikely(leaf == NULL)) {
+                return -1;
+            }
+            if (unlikely(radix_add_child(tree, ref, k[depth], leaf) != 0)) {
+                radix_node_free(tree, leaf);
+                return -1;
+            }
+            break;
+        }
+
+        ref = child;
+        depth++;
+    }
+
+    tree->size++;
+    if (key_len > tree->max_key_len) {
+        tree->max_key_len = key_len;
+    }
+    return 0;
+}
+
+// 删除键值对, value 非空时返回被删除的值, 成功返回0, 键不存在返回-1
+int32_t easeds_radix_remove(
+    struct easeds_radix *tree, const void *key, uint32_t key_len, void **value)
+{
+    const uint8_t *k = key;
+
+    if (unlikely(tree == NULL || key == NULL)) {
+        return -1;
+    }
+
+    /* 记录父节点槽位和边字节, 删除后需要修整父节点 */
+    struct easeds_radix_node **ref        = &tree->root;
+    struct easeds_radix_node **parent_ref = NULL;
+    struct easeds_radix_node  *node;
+    uint32_t                   depth = 0;
+    uint8_t                    edge  = 0;
+    while (true) {
+        node = *ref;
+        if (node == NULL) {
+            return -1;
+        }
+
+        uint32_t plen = node->prefix_len;
+        if (key_len - depth < plen || memcmp(radix_prefix(node), k + depth, plen) != 0) {
+            return -1;
+        }
+
+        depth += plen;
+        if (depth == key_len) {
+            break;
+        }
+
+        struct easeds_radix_node **child = radix_find_child(node, k[depth]);
+        if (child == NULL) {
+            return -1;
+        }
+        parent_ref = ref;
+        ref        = child;
+        edge       = k[depth];
+        depth++;
+    }
+
+    if (!node->has_value) {
+        return -1;
+    }
+
+    if (value != NULL) {
+        *value = node->value;
+    }
+    node->value     = NULL;
+    node->has_value = 0;
+    tree->size--;
+
+    if (node->count == 0) {
+        /* 叶子节点直接删除, 父节点没有值且只剩一个子节点时和子节点合并 */
+        radix_node_free(tree, node);
+        if (parent_ref == NULL) {
+            *ref = NULL;
+            return 0;
+        }
+        radix_remove_child(tree, parent_ref, edge);
+        node = *parent_ref;
+        if (!node->has_value && node->count == 1) {
+            radix_merge(tree, parent_ref);
+        }
+    } else if (node->count == 1) {
+        radix_merge(tree, ref);
+    }
+
+    return 0;
+}
+
+// 精确查找键对应的值, value 非空时返回找到的值, 成功返回0, 键不存在返回-1
+int32_t easeds_radix_find(
+    struct easeds_radix *tree, const void *key, uint32_t key_len, void **value)
+{
+    if (unlikely(tree == NULL || key == NULL)) {
+        return -1;
+    }
+
+    struct easeds_radix_node *node = radix_lookup(tree, key, key_len);
+    if (node == NULL) {
+        return -1;
+    }
+
+    if (value != NULL) {
+        *value = node->value;
+    }
+    return 0;
+}
+
+// 查找是 key 前缀的最长键, match_len/value 非空时返回匹配长度和值, 成功返回0, 不存在返回-1
+int32_t easeds_radix_longest_prefix(struct easeds_radix *tree, const void *key, uint32_t key_len,
+    uint32_t *match_len, void **value)
+{
+    const uint8_t *k = key;
+
+    if (unlikely(tree == NULL || key == NULL)) {
+        return -1;
+    }
+
+    struct easeds_radix_node *node     = tree->root;
+    struct easeds_radix_node *best     = NULL;
+    uint32_t                  best_len = 0;
+    uint32_t                  depth    = 0;
+    while (node != NULL) {
+        uint32_t plen = node->prefix_len;
+        if (key_len - depth < plen || memcmp(radix_prefix(node), k + depth, plen) != 0) {
+            break;
+        }
+
+        depth += plen;
+        if (node->has_value) {
+            best     = node;
+            best_len = depth;
+        }
+        if (depth == key_len) {
+            break;
+        }
+
+        struct easeds_radix_node **child = radix_find_child(node, k[depth]);
+        if (child == NULL) {
+            break;
+        }
+        node = *child;
+        depth++;
+    }
+
+    if (best == NULL) {
+        return -1;
+    }
+
+    if (match_len != NULL) {
+        *match_len = best_len;
+    }
+    if (value != NULL) {
+        *value = best->value;
+    }
+    return 0;
+}
+
+/* 前缀遍历的上下文, key 中保存从根到当前节点的完整路径 */
+struct radix_walk {
+    uint8_t *key;
+    void (*callback)(const uint8_t *key, uint32_t key_len, void *value, void *user_data);
+    void    *user_data;
+    uint64_t count;
+};
+
+// 按字典序深度优先遍历子树, key_len 为到当前节点(含压缩路径)的路径长度
+static void radix_walk_tree(
+    struct radix_walk *walk, struct easeds_radix_node *node, uint32_t key_len)
+{
+    if (node->has_value) {
+        if (walk->callback != NULL) {
+            walk->callback(walk->key, key_len, node->value, walk->user_data);
+        }
+        walk->count++;
+    }
+
+    struct easeds_radix_node *child;
+    uint32_t                  pos  = 0;
+    uint8_t                   byte = 0;
+    while ((child = radix_child_iter(node, &pos, &byte)) != NULL) {
+        walk->key[key_len] = byte;
+        memcpy(walk->key + key_len + 1, radix_prefix(child), child->prefix_len);
+        radix_walk_tree(walk, child, key_len + 1 + child->prefix_len);
+    }
+}
+
+// 按字典序遍历以 prefix 开头的所有键, 对每个键值对执行回调函数, 返回遍历数量
+uint64_t easeds_radix_prefix_foreach(struct easeds_radix *tree, const void *prefix,
+    uint32_t prefix_len,
+    void (*callback)(const uint8_t *key, uint32_t key_len, void *value, void *user_data),
+    void *user_data)
+{
+    const uint8_t *k = prefix;
+
+    if (unlikely(tree == NULL || prefix == NULL)) {
+        return 0;
+    }
+
+    /* 找到前缀结束位置所在的节点, 前缀可能停在节点的压缩路径中间 */
+    struct easeds_radix_node *node  = tree->root;
+    uint32_t                  depth = 0;
+    while (node != NULL) {
+        uint32_t plen = node->prefix_len;
+        uint32_t rest = prefix_len - depth;
+        if (rest <= plen) {
+            if (memcmp(radix_prefix(node), k + depth, rest) != 0) {
+                return 0;
+            }
+            break;
+        }
+        if (memcmp(radix_prefix(node), k + depth, plen) != 0) {
+            return 0;
+        }
+
+        depth += plen;
+        struct easeds_radix_node **child = radix_find_child(node, k[depth]);
+        if (child == NULL) {
+            return 0;
+        }
+        node = *child;
+        depth++;
+    }
+
+    if (node == NULL) {
+        return 0;
+    }
+
+    struct radix_walk walk = {
+        .key       = __easeds_malloc((size_t)tree->max_key_len + 1),
+        .callback  = callback,
+        .user_data = user_data,
+        .count     = 0,
+    };
+    if (unlikely(walk.key == NULL)) {
+        EASEDS_ERR("[easeds_radix_prefix_foreach]: Malloc key buffer %u bytes failed.",
+            tree->max_key_len + 1);
+        return 0;
+    }
+
+    memcpy(walk.key, k, depth);
+    memcpy(walk.key + depth, radix_prefix(node), node->prefix_len);
+    radix_walk_tree(&walk, node, depth + node->prefix_len);
+
+    __easeds_free(walk.key);
+    return walk.count;
+}
+
+/* 校验时累计的统计信息 */
+struct radix_check {
+    uint64_t size;
+    uint64_t memory;
+    uint64_t nodes[EASEDS_RADIX_TYPES];
+};
+
+// 递归校验子树, depth 为到当前节点(含压缩路径)的路径长度, 正确返回0, 异常返回-1
+static int32_t radix_verify_node(struct easeds_radix *tree, struct easeds_radix_node *node,
+    uint32_t depth, struct radix_check *check)
+{
+    if (node->type >= EASEDS_RADIX_TYPES || node->count > radix_node_capacity[node->type]) {
+        EASEDS_ERR("[easeds_radix_verify]: Invalid node type %u count %u.", node->type,
+            node->count);
+        return -1;
+    }
+
+    /* 压缩形态: 没有值的节点至少有两个子节点, 否则应该和子节点合并或被删除 */
+    if (!node->has_value && node->count < 2) {
+        EASEDS_ERR("[easeds_radix_verify]: Uncompressed node without value, count %u.",
+            node->count);
+        return -1;
+    }
+
+    if (node->type != EASEDS_RADIX_LEAF && node->count <= radix_shrink_threshold[node->type]) {
+        EASEDS_ERR("[easeds_radix_verify]: Node type %u too sparse, count %u.", node->type,
+            node->count);
+        return -1;
+    }
+
+    if (depth > tree->max_key_len) {
+        EASEDS_ERR("[easeds_radix_verify]: Path length %u exceeds max key length %u.", depth,
+            tree->max_key_len);
+        return -1;
+    }
+
+    if (node->type == EASEDS_RADIX_NODE48) {
+        struct easeds_radix_node48 *n48  = (struct easeds_radix_node48 *)node;
+        uint64_t                    used = 0;
+        for (uint32_t b = 0; b < 256; b++) {
+            uint8_t slot = n48->index[b];
+            if (slot == 0) {
+                continue;
+            }
+            if (slot > 48 || n48->children[slot - 1] == NULL || (used & (1ULL << (slot - 1)))) {
+                EASEDS_ERR("[easeds_radix_verify]: Invalid node48 slot %u for byte %u.", slot,
+                    b);
+                return -1;
+            }
+            used |= 1ULL << (slot - 1);
+        }
+    }
+
+    check->size += node->has_value;
+    check->memory += (uint64_t)radix_node_size[node->type] + node->prefix_len;
+    check->nodes[node->type]++;
+
+    struct easeds_radix_node *child;
+    uint32_t                  pos   = 0;
+    uint32_t                  count = 0;
+    uint32_t                  last  = 0;
+    uint8_t                   byte  = 0;
+    while ((child = radix_child_iter(node, &pos, &byte)) != NULL) {
+        if (count != 0 && byte <= last) {
+            EASEDS_ERR("[easeds_radix_verify]: Child bytes not ascending, %u after %u.", byte,
+                last);
+            return -1;
+        }
+        if (radix_verify_node(tree, child, depth + 1 + child->prefix_len, check) != 0) {
+            return -1;
+        }
+        last = byte;
+        count++;
+    }
+
+    if (count != node->count) {
+        EASEDS_ERR("[easeds_radix_verify]: Node count %u but found %u children.", node->count,
+            count);
+        return -1;
+    }
+
+    return 0;
+}
+
+// 校验树结构不变量(压缩形态, 节点类型和子节点数量, 统计信息), 正确返回0, 异常返回-1
+int32_t easeds_radix_verify(struct easeds_radix *tree)
+{
+    struct radix_check check;
+
+    if (unlikely(tree == NULL)) {
+        return -1;
+    }
+
+    memset(&check, 0, sizeof(check));
+    if (tree->root != NULL
+        && radix_verify_node(tree, tree->root, tree->root->prefix_len, &check) != 0) {
+        return -1;
+    }
+
+    if (check.size != tree->size || check.memory != tree->memory) {
+        EASEDS_ERR("[easeds_radix_verify]: Size %lu/%lu or memory %lu/%lu mismatch.", check.size,
+            tree->size, check.memory, tree->memory);
+        return -1;
+    }
+
+    for (uint32_t i = 0; i < EASEDS_RADIX_TYPES; i++) {
+        if (check.nodes[i] != tree->nodes[i]) {
+            EASEDS_ERR("[easeds_radix_verify]: Node type %u count %lu, expected %lu.", i,
+                check.nodes[i], tree->nodes[i]);
+            return -1;
+        }
+    }
+
+    return 0;
+}
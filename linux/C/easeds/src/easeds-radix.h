@@ -0,0 +1,161 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-radix.h
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-18 18:50
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  压缩基数树(Radix Trie), 键为任意字节串, 适用于指标名/路径名的精确查找和前缀查询.
+ *
+ * @History:
+ *  2026年10月18日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#ifndef __EASEDS_RADIX_H__
+#define __EASEDS_RADIX_H__
+
+/* C 标准库头文件 */
+#include <stdbool.h>
+#include <stdint.h>
+
+/* 项目内部头文件 */
+#include "easeds-public.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 节点类型, 按子节点数量自适应选择 */
+enum easeds_radix_type {
+    EASEDS_RADIX_LEAF    = 0, /* 没有子节点 */
+    EASEDS_RADIX_NODE4   = 1, /* 最多 4 个子节点, 有序键数组 */
+    EASEDS_RADIX_NODE16  = 2, /* 最多 16 个子节点, 有序键数组 */
+    EASEDS_RADIX_NODE48  = 3, /* 最多 48 个子节点, 256 字节下标表 */
+    EASEDS_RADIX_NODE256 = 4, /* 最多 256 个子节点, 直接寻址 */
+    EASEDS_RADIX_TYPES   = 5, /* 节点类型数量 */
+};
+
+/**
+ * 节点公共头部, 压缩路径(prefix)紧跟在具体类型结构体后面存放.
+ * 从父节点到本节点的路径为: 父节点中的边字节 + prefix, 节点有值时表示一个完整的键.
+ */
+struct easeds_radix_node {
+    void    *value;      /* 值, has_value 为 1 时有效 */
+    uint32_t prefix_len; /* 压缩路径长度 */
+    uint16_t count;      /* 子节点数量 */
+    uint8_t  type;       /* 节点类型, enum easeds_radix_type */
+    uint8_t  has_value;  /* 节点是否存储了值 */
+};
+
+struct easeds_radix_node4 {
+    struct easeds_radix_node  base;        /* 公共头部 */
+    uint8_t                   keys[4];     /* 有序边字节 */
+    uint32_t                  pad;         /* 对齐填充 */
+    struct easeds_radix_node *children[4]; /* 子节点 */
+};
+
+struct easeds_radix_node16 {
+    struct easeds_radix_node  base;         /* 公共头部 */
+    uint8_t                   keys[16];     /* 有序边字节 */
+    struct easeds_radix_node *children[16]; /* 子节点 */
+};
+
+struct easeds_radix_node48 {
+    struct easeds_radix_node  base;         /* 公共头部 */
+    uint8_t                   index[256];   /* 边字节到子节点槽位的映射, 0 表示不存在 */
+    struct easeds_radix_node *children[48]; /* 子节点 */
+};
+
+struct easeds_radix_node256 {
+    struct easeds_radix_node  base;          /* 公共头部 */
+    struct easeds_radix_node *children[256]; /* 子节点, 按边字节直接寻址 */
+};
+
+/**
+ * 实现一个压缩基数树, 查找复杂度 O(k), k 为键长度, 与键数量无关.
+ *  (1) 只有一个子节点且没有值的路径被压缩到子节点的 prefix 中, 长公共前缀只存一份.
+ *  (2) 节点按子节点数量在 LEAF/NODE4/NODE16/NODE48/NODE256 之间自动升级和降级,
+ *      稀疏分支只占几十字节, 稠密分支直接寻址, 内存和查找速度兼顾.
+ *  (3) 支持精确查找, 最长前缀匹配(如路由表/配置继承), 以及按字典序遍历某个前缀下的所有键.
+ *  (4) 删除后自动合并单子节点路径, 保持树的压缩形态.
+ *  (5) 值由用户管理, 销毁时不会释放值.
+ *  (6) 非线程安全, 需要用户自行保证线程安全性.
+ */
+struct easeds_radix {
+    const char               *name;                      /* 名称, 预留字段, 可用于调试和日志 */
+    struct easeds_radix_node *root;                      /* 根节点, NULL 表示空树 */
+    uint64_t                  size;                      /* 键值对数量 */
+    uint64_t                  memory;                    /* 节点占用的字节数 */
+    uint64_t                  nodes[EASEDS_RADIX_TYPES]; /* 各类型节点数量 */
+    uint32_t                  max_key_len;               /* 插入过的最长键长度 */
+    uint32_t                  flags;                     /* 标志位, 预留字段 */
+};
+
+/**
+ * 常见基数树操作函数:
+ *
+ * 函数名                       功能描述
+ * ------------------------     ------------------------------------------------------
+ * easeds_radix_create          创建一棵空的基数树, 失败返回NULL
+ * easeds_radix_destroy         销毁基数树, 释放所有节点
+ * easeds_radix_clear           清空基数树, 释放所有节点, 树结构体本身保留
+ * easeds_radix_size            获取键值对数量
+ * easeds_radix_memory          获取节点占用的字节数
+ * easeds_radix_insert          插入键值对, 键已存在时覆盖旧值, 成功返回0, 失败返回-1
+ * easeds_radix_remove          删除键值对, 成功返回0, 键不存在返回-1
+ * easeds_radix_find            精确查找键对应的值, 成功返回0, 键不存在返回-1
+ * easeds_radix_longest_prefix  查找是 key 前缀的最长键, 成功返回0, 不存在返回-1
+ * easeds_radix_prefix_foreach  按字典序遍历以 prefix 开头的所有键, 返回遍历数量
+ * easeds_radix_verify          校验树结构不变量, 正确返回0, 异常返回-1
+ */
+
+// 创建一棵空的基数树, 失败返回NULL
+struct easeds_radix *easeds_radix_create(const char *name);
+
+// 销毁基数树, 释放所有节点
+void easeds_radix_destroy(struct easeds_radix *tree);
+
+// 清空基数树, 释放所有节点, 树结构体本身保留
+void easeds_radix_clear(struct easeds_radix *tree);
+
+// 获取键值对数量
+uint64_t easeds_radix_size(struct easeds_radix *tree);
+
+// 获取节点占用的字节数, 不包含树结构体本身
+uint64_t easeds_radix_memory(struct easeds_radix *tree);
+
+// 插入键值对, 键已存在时覆盖旧值, 成功返回0, 失败返回-1
+int32_t easeds_radix_insert(
+    struct easeds_radix *tree, const void *key, uint32_t key_len, void *value);
+
+// 删除键值对, value 非空时返回被删除的值, 成功返回0, 键不存在返回-1
+int32_t easeds_radix_remove(
+    struct easeds_radix *tree, const void *key, uint32_t key_len, void **value);
+
+// 精确查找键对应的值, value 非空时返回找到的值, 成功返回0, 键不存在返回-1
+int32_t easeds_radix_find(
+    struct easeds_radix *tree, const void *key, uint32_t key_len, void **value);
+
+// 查找是 key 前缀的最长键, match_len/value 非空时返回匹配长度和值, 成功返回0, 不存在返回-1
+int32_t easeds_radix_longest_prefix(struct easeds_radix *tree, const void *key, uint32_t key_len,
+    uint32_t *match_len, void **value);
+
+// 按字典序遍历以 prefix 开头的所有键, 对每个键值对执行回调函数, 返回遍历数量
+uint64_t easeds_radix_prefix_foreach(struct easeds_radix *tree, const void *prefix,
+    uint32_t prefix_len,
+    void (*callback)(const uint8_t *key, uint32_t key_len, void *value, void *user_data),
+    void *user_data);
+
+// 校验树结构不变量(压缩形态, 节点类型和子节点数量, 统计信息), 正确返回0, 异常返回-1
+int32_t easeds_radix_verify(struct easeds_radix *tree);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __EASEDS_RADIX_H__ */
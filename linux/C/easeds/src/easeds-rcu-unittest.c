@@ -0,0 +1,533 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-rcu-unittest.c
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-18 22:40
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  Easeds RCU 单元测试实现文件, 包含了 RCU 链表宏/宽限期/延迟回调/离线读者/并发读写和读写锁对比测试.
+ *
+ * @History:
+ *  2026年10月18日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#include "easeds-unittest.h"
+
+// 标准库头文件
+#include <pthread.h>
+#include <unistd.h>
+
+// 项目内部头文件
+#include "easeds-rcu.h"
+#include "easeds-utils.h"
+
+/* 路由节点的有效标记, 释放时改写 */
+#define RCU_ROUTE_MAGIC 0x0123456789ABCDEFULL
+
+// 测试用路由节点
+struct rcu_route {
+    TAILQ_ENTRY(rcu_route) tq;    /* 尾队列节点 */
+    LIST_ENTRY(rcu_route) list;   /* 链表节点 */
+    struct easeds_rcu_head rcu;   /* 延迟释放回调 */
+    uint64_t               magic; /* 有效标记 */
+    uint64_t               value; /* 路由数据 */
+};
+
+TAILQ_HEAD(rcu_route_tailq, rcu_route);
+LIST_HEAD(rcu_route_list, rcu_route);
+
+static uint64_t g_rcu_freed;
+
+static struct rcu_route *rcu_route_new(uint64_t value)
+{
+    struct rcu_route *route = malloc(sizeof(struct rcu_route));
+    assert_non_null(route);
+    memset(route, 0, sizeof(struct rcu_route));
+    route->magic = RCU_ROUTE_MAGIC;
+    route->value = value;
+    return route;
+}
+
+// 延迟释放回调: 改写标记后释放
+static void rcu_route_free(struct easeds_rcu_head *head)
+{
+    struct rcu_route *route =
+        (struct rcu_route *)((uint8_t *)head - offsetof(struct rcu_route, rcu));
+    route->magic = 0;
+    free(route);
+    __atomic_add_fetch(&g_rcu_freed, 1, __ATOMIC_RELAXED);
+}
+
+// 读者遍历尾队列, 返回数据之和
+static uint64_t rcu_tailq_sum(struct rcu_route_tailq *head, uint64_t *count)
+{
+    struct rcu_route *route;
+    uint64_t          sum = 0;
+
+    *count = 0;
+    TAILQ_FOREACH_RCU (route, head, tq) {
+        sum += route->value;
+        (*count)++;
+    }
+    return sum;
+}
+
+// 基本功能测试: RCU 链表宏的插入/替换/删除和普通遍历结果一致, 同步后释放, 延迟回调执行
+static void test_easeds_rcu_basic(void **state)
+{
+    easeds_unused(state);
+
+    struct easeds_rcu *rcu = easeds_rcu_create("basic");
+    assert_non_null(rcu);
+    struct easeds_rcu_reader *reader = easeds_rcu_register(rcu);
+    assert_non_null(reader);
+
+    struct rcu_route_tailq head = TAILQ_HEAD_INITIALIZER(head);
+    struct rcu_route      *routes[8];
+    uint64_t               count = 0;
+
+    for (uint64_t i = 0; i < 8; i++) {
+        routes[i] = rcu_route_new(i + 1);
+        TAILQ_INSERT_TAIL_RCU(&head, routes[i], tq);
+    }
+    assert_int_equal(rcu_tailq_sum(&head, &count), 36);
+    assert_int_equal(count, 8);
+    assert_ptr_equal(TAILQ_LAST(&head, rcu_route_tailq), routes[7]);
+
+    // 删除中间和尾部元素, 普通 TAILQ 宏仍然能正确遍历
+    TAILQ_REMOVE_RCU(&head, routes[3], tq);
+    TAILQ_REMOVE_RCU(&head, routes[7], tq);
+    assert_int_equal(rcu_tailq_sum(&head, &count), 36 - 4 - 8);
+    assert_ptr_equal(TAILQ_LAST(&head, rcu_route_tailq), routes[6]);
+    assert_ptr_equal(TAILQ_PREV(routes[4], rcu_route_tailq, tq), routes[2]);
+
+    // 读者离线后同步, 删除的元素可以直接释放
+    easeds_rcu_offline(reader);
+    easeds_rcu_synchronize(rcu);
+    easeds_rcu_online(reader);
+    free(routes[3]);
+
+    // 替换后通过延迟回调释放旧元素
+    struct rcu_route *route = rcu_route_new(100);
+    TAILQ_REPLACE_RCU(&head, routes[0], route, tq);
+    assert_int_equal(rcu_tailq_sum(&head, &count), 36 - 4 - 8 - 1 + 100);
+    assert_ptr_equal(TAILQ_FIRST(&head), route);
+    assert_int_equal(easeds_rcu_call(rcu, &routes[0]->rcu, rcu_route_free), 0);
+    assert_int_equal(easeds_rcu_call(rcu, &routes[7]->rcu, rcu_route_free), 0);
+
+    g_rcu_freed = 0;
+    easeds_rcu_quiescent(reader);
+    easeds_rcu_offline(reader);
+    easeds_rcu_barrier(rcu);
+    assert_int_equal(g_rcu_freed, 2);
+
+    struct easeds_rcu_stats stats;
+    easeds_rcu_stats(rcu, &stats);
+    assert_int_equal(stats.readers, 1);
+    assert_true(stats.grace_periods >= 2);
+    assert_int_equal(stats.queued, 2);
+    assert_int_equal(stats.invoked, 2);
+
+    // LIST 版本
+    struct rcu_route_list list = LIST_HEAD_INITIALIZER(list);
+    struct rcu_route     *next;
+    TAILQ_FOREACH_SAFE (route, &head, tq, next) {
+        TAILQ_REMOVE_RCU(&head, route, tq);
+        LIST_INSERT_HEAD_RCU(&list, route, list);
+    }
+    assert_true(TAILQ_EMPTY(&head));
+    struct rcu_route *first = LIST_FIRST_RCU(&list);
+    route                   = rcu_route_new(1000);
+    LIST_INSERT_AFTER_RCU(first, route, list);
+    LIST_REMOVE_RCU(first, list);
+
+    uint64_t sum = 0;
+    count        = 0;
+    LIST_FOREACH_RCU (route, &list, list) {
+        sum += route->value;
+        count++;
+    }
+    assert_int_equal(count, 6);
+    assert_int_equal(sum, 100 + 2 + 3 + 5 + 6 + 7 + 1000 - first->value);
+    free(first);
+
+    LIST_FOREACH_SAFE (route, &list, list, next) {
+        LIST_REMOVE_RCU(route, list);
+        free(route);
+    }
+    assert_true(LIST_EMPTY(&list));
+
+    easeds_rcu_unregister(reader);
+    easeds_rcu_destroy(rcu);
+}
+
+// 并发测试参数
+struct rcu_stress_ctx {
+    struct easeds_rcu     *rcu;     /* RCU 域 */
+    struct rcu_route_tailq head;    /* 共享尾队列 */
+    uint32_t               stop;    /* 停止标志 */
+    uint32_t               started; /* 已注册的读者数量 */
+    uint64_t               loops;   /* 读者遍历次数 */
+    uint64_t               errors;  /* 读到已释放元素的次数 */
+    uint64_t               offline; /* 读者离线休眠的次数 */
+};
+
+// 读者线程: 持续遍历尾队列, 每次遍历后报告静止状态, 偶尔离线短暂休眠
+static void *rcu_reader_fn(void *arg)
+{
+    struct rcu_stress_ctx    *ctx    = arg;
+    struct easeds_rcu_reader *reader = easeds_rcu_register(ctx->rcu);
+    uint64_t                  loops   = 0;
+    uint64_t                  errors  = 0;
+    uint64_t                  offline = 0;
+
+    __atomic_add_fetch(&ctx->started, 1, __ATOMIC_RELEASE);
+    while (!__atomic_load_n(&ctx->stop, __ATOMIC_ACQUIRE)) {
+        struct rcu_route *route;
+        TAILQ_FOREACH_RCU (route, &ctx->head, tq) {
+            errors += route->magic != RCU_ROUTE_MAGIC;
+        }
+        easeds_rcu_quiescent(reader);
+
+        if (++loops % 1024 == 0) {
+            easeds_rcu_offline(reader);
+            usleep(10);
+            easeds_rcu_online(reader);
+            offline++;
+        }
+    }
+
+    easeds_rcu_unregister(reader);
+    __atomic_add_fetch(&ctx->loops, loops, __ATOMIC_RELAXED);
+    __atomic_add_fetch(&ctx->errors, errors, __ATOMIC_RELAXED);
+    __atomic_add_fetch(&ctx->offline, offline, __ATOMIC_RELAXED);
+    return NULL;
+}
+
+// 操作测试: 读者并发遍历时写者持续替换/删除/插入, 交替使用同步释放和延迟回调
+static void test_easeds_rcu_operations(void **state)
+{
+    easeds_unused(state);
+
+    struct rcu_stress_ctx ctx = {.rcu = easeds_rcu_create("ops")};
+    pthread_t             threads[3];
+    assert_non_null(ctx.rcu);
+    TAILQ_INIT(&ctx.head);
+    for (uint64_t i = 0; i < 32; i++) {
+        struct rcu_route *route = rcu_route_new(i);
+        TAILQ_INSERT_TAIL_RCU(&ctx.head, route, tq);
+    }
+
+    for (uint32_t t = 0; t < 3; t++) {
+        assert_int_equal(pthread_create(&threads[t], NULL, rcu_reader_fn, &ctx), 0);
+    }
+    while (__atomic_load_n(&ctx.started, __ATOMIC_ACQUIRE) != 3) {
+        usleep(100);
+    }
+
+    g_rcu_freed     = 0;
+    uint64_t seed   = 88172645463325252ULL;
+    uint64_t called = 0;
+    for (uint32_t i = 0; i < 2000; i++) {
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+
+        // 选一个元素, 替换或删除后在头部插入新元素
+        struct rcu_route *old = TAILQ_FIRST(&ctx.head);
+        for (uint64_t k = seed % 32; k > 0; k--) {
+            old = TAILQ_NEXT(old, tq);
+        }
+
+        struct rcu_route *route = rcu_route_new(seed);
+        if ((seed >> 8) & 1) {
+            TAILQ_REPLACE_RCU(&ctx.head, old, route, tq);
+        } else {
+            TAILQ_REMOVE_RCU(&ctx.head, old, tq);
+            TAILQ_INSERT_HEAD_RCU(&ctx.head, route, tq);
+        }
+
+        if ((seed >> 16) % 8 == 0) {
+            easeds_rcu_synchronize(ctx.rcu);
+            old->magic = 0;
+            free(old);
+        } else {
+            assert_int_equal(easeds_rcu_call(ctx.rcu, &old->rcu, rcu_route_free), 0);
+            called++;
+        }
+    }
+
+    __atomic_store_n(&ctx.stop, 1, __ATOMIC_RELEASE);
+    for (uint32_t t = 0; t < 3; t++) {
+        pthread_join(threads[t], NULL);
+    }
+    easeds_rcu_barrier(ctx.rcu);
+    assert_int_equal(ctx.errors, 0);
+    assert_int_equal(g_rcu_freed, called);
+    assert_true(ctx.loops > 0);
+
+    struct easeds_rcu_stats stats;
+    easeds_rcu_stats(ctx.rcu, &stats);
+    assert_int_equal(stats.readers, 0);
+    assert_int_equal(stats.invoked, called);
+    PFL_DEBUG("[rcu ops]: loops %lu, offline %lu, grace periods %lu, callbacks %lu.", ctx.loops,
+        ctx.offline, stats.grace_periods, stats.invoked);
+
+    uint64_t count = 0;
+    rcu_tailq_sum(&ctx.head, &count);
+    assert_int_equal(count, 32);
+    while (!TAILQ_EMPTY(&ctx.head)) {
+        struct rcu_route *route = TAILQ_FIRST(&ctx.head);
+        TAILQ_REMOVE(&ctx.head, route, tq);
+        free(route);
+    }
+    easeds_rcu_destroy(ctx.rcu);
+}
+
+// 离线读者线程参数
+struct rcu_offline_ctx {
+    struct easeds_rcu        *rcu;    /* RCU 域 */
+    struct easeds_rcu_reader *reader; /* 读者 */
+    uint32_t                  phase;  /* 0: 注册中, 1: 已注册, 2: 退出 */
+    uint32_t                  pad;    /* 对齐填充 */
+};
+
+// 注册后立即离线并等待, 模拟长时间阻塞的读者
+static void *rcu_offline_fn(void *arg)
+{
+    struct rcu_offline_ctx *ctx = arg;
+
+    ctx->reader = easeds_rcu_register(ctx->rcu);
+    easeds_rcu_offline(ctx->reader);
+    __atomic_store_n(&ctx->phase, 1, __ATOMIC_RELEASE);
+    while (__atomic_load_n(&ctx->phase, __ATOMIC_ACQUIRE) != 2) {
+        usleep(100);
+    }
+    easeds_rcu_online(ctx->reader);
+    easeds_rcu_unregister(ctx->reader);
+    return NULL;
+}
+
+// 在线但长时间不报告静止状态的读者, 由主线程控制何时报告
+static void *rcu_stall_fn(void *arg)
+{
+    struct rcu_offline_ctx *ctx = arg;
+
+    ctx->reader = easeds_rcu_register(ctx->rcu);
+    __atomic_store_n(&ctx->phase, 1, __ATOMIC_RELEASE);
+    while (__atomic_load_n(&ctx->phase, __ATOMIC_ACQUIRE) != 2) {
+        usleep(100);
+    }
+    easeds_rcu_quiescent(ctx->reader);
+    easeds_rcu_unregister(ctx->reader);
+    return NULL;
+}
+
+// 边界测试: 空链表, 无读者同步, 离线读者不阻塞, 停滞读者阻塞宽限期, 销毁时执行剩余回调
+static void test_easeds_rcu_boundary(void **state)
+{
+    easeds_unused(state);
+
+    struct easeds_rcu      *rcu = easeds_rcu_create(NULL);
+    struct easeds_rcu_stats stats;
+    assert_non_null(rcu);
+
+    // 空链表遍历, 唯一元素的插入和删除
+    struct rcu_route_tailq head = TAILQ_HEAD_INITIALIZER(head);
+    uint64_t               count = 1;
+    assert_int_equal(rcu_tailq_sum(&head, &count), 0);
+    assert_int_equal(count, 0);
+    struct rcu_route *route = rcu_route_new(5);
+    TAILQ_INSERT_HEAD_RCU(&head, route, tq);
+    assert_ptr_equal(TAILQ_LAST(&head, rcu_route_tailq), route);
+    struct rcu_route *after = rcu_route_new(6);
+    TAILQ_INSERT_AFTER_RCU(&head, route, after, tq);
+    assert_ptr_equal(TAILQ_LAST(&head, rcu_route_tailq), after);
+    TAILQ_REMOVE_RCU(&head, after, tq);
+    TAILQ_REMOVE_RCU(&head, route, tq);
+    assert_true(TAILQ_EMPTY(&head));
+    assert_ptr_equal(head.tqh_last, &head.tqh_first);
+    free(after);
+
+    // 没有读者时同步立即返回, 没有回调时 barrier 立即返回
+    easeds_rcu_synchronize(rcu);
+    easeds_rcu_barrier(rcu);
+    easeds_rcu_stats(rcu, &stats);
+    assert_int_equal(stats.grace_periods, 1);
+    assert_int_equal(stats.readers, 0);
+
+    // 离线读者不阻塞宽限期
+    struct rcu_offline_ctx offline = {.rcu = rcu};
+    pthread_t              thread;
+    assert_int_equal(pthread_create(&thread, NULL, rcu_offline_fn, &offline), 0);
+    while (__atomic_load_n(&offline.phase, __ATOMIC_ACQUIRE) != 1) {
+        usleep(100);
+    }
+    easeds_rcu_synchronize(rcu);
+    __atomic_store_n(&offline.phase, 2, __ATOMIC_RELEASE);
+    pthread_join(thread, NULL);
+
+    // 在线读者不报告静止状态时, 延迟回调不会执行
+    struct rcu_offline_ctx stall = {.rcu = rcu};
+    assert_int_equal(pthread_create(&thread, NULL, rcu_stall_fn, &stall), 0);
+    while (__atomic_load_n(&stall.phase, __ATOMIC_ACQUIRE) != 1) {
+        usleep(100);
+    }
+    g_rcu_freed = 0;
+    assert_int_equal(easeds_rcu_call(rcu, &route->rcu, rcu_route_free), 0);
+    usleep(20000);
+    assert_int_equal(__atomic_load_n(&g_rcu_freed, __ATOMIC_RELAXED), 0);
+    __atomic_store_n(&stall.phase, 2, __ATOMIC_RELEASE);
+    easeds_rcu_barrier(rcu);
+    assert_int_equal(g_rcu_freed, 1);
+    pthread_join(thread, NULL);
+
+    // 销毁时执行队列中剩余的回调
+    for (uint32_t i = 0; i < 100; i++) {
+        route = rcu_route_new(i);
+        assert_int_equal(easeds_rcu_call(rcu, &route->rcu, rcu_route_free), 0);
+    }
+    easeds_rcu_destroy(rcu);
+    assert_int_equal(g_rcu_freed, 101);
+}
+
+// 错误处理测试: 非法参数
+static void test_easeds_rcu_error(void **state)
+{
+    easeds_unused(state);
+
+    struct easeds_rcu_stats stats;
+    struct easeds_rcu_head  head;
+
+    assert_null(easeds_rcu_register(NULL));
+    easeds_rcu_unregister(NULL);
+    easeds_rcu_synchronize(NULL);
+    easeds_rcu_barrier(NULL);
+    assert_int_equal(easeds_rcu_call(NULL, &head, rcu_route_free), -1);
+    easeds_rcu_stats(NULL, &stats);
+    easeds_rcu_destroy(NULL);
+
+    struct easeds_rcu *rcu = easeds_rcu_create("error");
+    assert_non_null(rcu);
+    assert_int_equal(easeds_rcu_call(rcu, NULL, rcu_route_free), -1);
+    assert_int_equal(easeds_rcu_call(rcu, &head, NULL), -1);
+    easeds_rcu_stats(rcu, NULL);
+
+    // 销毁时仍注册的读者会被释放并记录错误
+    assert_non_null(easeds_rcu_register(rcu));
+    easeds_rcu_stats(rcu, &stats);
+    assert_int_equal(stats.readers, 1);
+    assert_int_equal(stats.queued, 0);
+    easeds_rcu_destroy(rcu);
+}
+
+// 性能测试参数
+struct rcu_perf_ctx {
+    struct easeds_rcu     *rcu;    /* RCU 域, 为NULL时使用读写锁 */
+    pthread_rwlock_t      *rwlock; /* 读写锁 */
+    struct rcu_route_tailq head;   /* 共享尾队列 */
+    uint64_t               ops;    /* 每个线程的查找次数 */
+    uint64_t               sum;    /* 防止查找被优化掉 */
+};
+
+// 性能测试线程: 每次查找遍历整个尾队列, RCU 读者每次查找后报告静止状态
+static void *rcu_perf_fn(void *arg)
+{
+    struct rcu_perf_ctx      *ctx    = arg;
+    struct easeds_rcu_reader *reader = ctx->rcu != NULL ? easeds_rcu_register(ctx->rcu) : NULL;
+    uint64_t                  sum    = 0;
+
+    for (uint64_t i = 0; i < ctx->ops; i++) {
+        struct rcu_route *route;
+        if (reader != NULL) {
+            TAILQ_FOREACH_RCU (route, &ctx->head, tq) {
+                sum += route->value;
+            }
+            easeds_rcu_quiescent(reader);
+        } else {
+            pthread_rwlock_rdlock(ctx->rwlock);
+            TAILQ_FOREACH (route, &ctx->head, tq) {
+                sum += route->value;
+            }
+            pthread_rwlock_unlock(ctx->rwlock);
+        }
+    }
+
+    easeds_rcu_unregister(reader);
+    __atomic_add_fetch(&ctx->sum, sum, __ATOMIC_RELAXED);
+    return NULL;
+}
+
+// 运行一轮查找测试, 返回每次查找的平均耗时
+static double rcu_perf_run(struct rcu_perf_ctx *ctx, uint32_t nthreads)
+{
+    pthread_t threads[4];
+
+    int64_t start = easeds_get_current_time_ns();
+    for (uint32_t t = 0; t < nthreads; t++) {
+        assert_int_equal(pthread_create(&threads[t], NULL, rcu_perf_fn, ctx), 0);
+    }
+    for (uint32_t t = 0; t < nthreads; t++) {
+        pthread_join(threads[t], NULL);
+    }
+    return (double)(easeds_get_current_time_ns() - start) / (double)(ctx->ops * nthreads);
+}
+
+// 性能测试: 8 个元素的路由表查找, RCU 和读写锁对比, 以及无读者时的同步开销
+static void test_easeds_rcu_perf(void **state)
+{
+    easeds_unused(state);
+
+    const uint32_t   threads[] = {1, 4};
+    pthread_rwlock_t rwlock;
+
+    pthread_rwlock_init(&rwlock, NULL);
+    for (uint32_t t = 0; t < 2; t++) {
+        struct rcu_perf_ctx ctx = {.rwlock = &rwlock, .ops = 2000000};
+        TAILQ_INIT(&ctx.head);
+        for (uint64_t i = 0; i < 8; i++) {
+            struct rcu_route *route = rcu_route_new(i);
+            TAILQ_INSERT_TAIL_RCU(&ctx.head, route, tq);
+        }
+
+        ctx.rcu        = easeds_rcu_create("perf");
+        double rcu_ns  = rcu_perf_run(&ctx, threads[t]);
+        easeds_rcu_destroy(ctx.rcu);
+        ctx.rcu        = NULL;
+        double lock_ns = rcu_perf_run(&ctx, threads[t]);
+        assert_int_equal(ctx.sum, 28 * ctx.ops * threads[t] * 2);
+
+        MEASURE("[rcu perf]: %u threads, 8 routes lookup, rcu %.1f ns/op, rwlock %.1f ns/op.",
+            threads[t], rcu_ns, lock_ns);
+        while (!TAILQ_EMPTY(&ctx.head)) {
+            struct rcu_route *route = TAILQ_FIRST(&ctx.head);
+            TAILQ_REMOVE(&ctx.head, route, tq);
+            free(route);
+        }
+    }
+    pthread_rwlock_destroy(&rwlock);
+
+    struct easeds_rcu *rcu   = easeds_rcu_create("perf");
+    int64_t            start = easeds_get_current_time_ns();
+    for (uint32_t i = 0; i < 100000; i++) {
+        easeds_rcu_synchronize(rcu);
+    }
+    MEASURE("[rcu perf]: synchronize without readers %.1f ns/op.",
+        (double)(easeds_get_current_time_ns() - start) / 100000.0);
+    easeds_rcu_destroy(rcu);
+}
+
+// 注册单元测试用例
+EASEDS_UNITTEST_REGISTER(easeds_unittest_rcu){
+    cmocka_unit_test(test_easeds_rcu_basic),
+    cmocka_unit_test(test_easeds_rcu_operations),
+    cmocka_unit_test(test_easeds_rcu_boundary),
+    cmocka_unit_test(test_easeds_rcu_error),
+    cmocka_unit_test(test_easeds_rcu_perf),
+    easeds_unit_test_end,
+};
@@ -0,0 +1,287 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-rcu.c
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-18 22:40
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  基于静止状态(QSBR)的 RCU 运行时实现文件.
+ *
+ * @History:
+ *  2026年10月18日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#include "easeds-rcu.h"
+
+// 标准库头文件
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// 项目内部头文件
+#include "easeds-log.h"
+#include "easeds-utils.h"
+
+/* 等待读者时先让出 CPU 的次数, 超过后每次休眠 RCU_WAIT_SLEEP_NS */
+#define RCU_WAIT_YIELDS   1000
+#define RCU_WAIT_SLEEP_NS 1000000L
+
+/* RCU 域按缓存行对齐分配, 大小向上取整 */
+#define RCU_ALLOC_SIZE                                         \
+    ((sizeof(struct easeds_rcu) + EASEDS_CACHE_LINE_SIZE - 1) \
+        & ~(size_t)(EASEDS_CACHE_LINE_SIZE - 1))
+
+// 等待读者离线或报告过 gp 之后的静止状态
+static void rcu_wait_reader(struct easeds_rcu_reader *reader, uint64_t gp)
+{
+    uint32_t waits = 0;
+
+    while (true) {
+        uint64_t ctr = __atomic_load_n(&reader->ctr, __ATOMIC_ACQUIRE);
+        if (ctr == 0 || ctr == gp) {
+            return;
+        }
+
+        if (waits < RCU_WAIT_YIELDS) {
+            waits++;
+            sched_yield();
+        } else {
+            struct timespec ts = {.tv_sec = 0, .tv_nsec = RCU_WAIT_SLEEP_NS};
+            nanosleep(&ts, NULL);
+        }
+    }
+}
+
+// 回调线程主循环: 每次取走队列中的全部回调, 等待一个宽限期后按提交顺序执行
+static void *rcu_worker_main(void *arg)
+{
+    struct easeds_rcu *rcu = arg;
+    char               name[EASEDS_THREAD_NAME_LEN];
+
+    easeds_snprintf(
+        name, (int32_t)sizeof(name), "%.10s-rcu", rcu->name != NULL ? rcu->name : "easeds");
+    easeds_set_current_thread_name(name);
+
+    pthread_mutex_lock(&rcu->cb_lock);
+    while (true) {
+        while (STAILQ_EMPTY(&rcu->callbacks) && !rcu->stop) {
+            pthread_cond_wait(&rcu->cb_cond, &rcu->cb_lock);
+        }
+        if (STAILQ_EMPTY(&rcu->callbacks)) {
+            break;
+        }
+
+        struct easeds_rcu_head_list batch = STAILQ_HEAD_INITIALIZER(batch);
+        STAILQ_CONCAT(&batch, &rcu->callbacks);
+        pthread_mutex_unlock(&rcu->cb_lock);
+
+        easeds_rcu_synchronize(rcu);
+
+        uint64_t count = 0;
+        while (!STAILQ_EMPTY(&batch)) {
+            struct easeds_rcu_head *head = STAILQ_FIRST(&batch);
+            STAILQ_REMOVE_HEAD(&batch, entry);
+            head->func(head);
+            count++;
+        }
+
+        pthread_mutex_lock(&rcu->cb_lock);
+        rcu->invoked += count;
+        pthread_cond_broadcast(&rcu->done_cond);
+    }
+    pthread_mutex_unlock(&rcu->cb_lock);
+    return NULL;
+}
+
+// 创建 RCU 域, 失败返回NULL
+struct easeds_rcu *easeds_rcu_create(const char *name)
+{
+    struct easeds_rcu *rcu = __easeds_aligned_alloc(EASEDS_CACHE_LINE_SIZE, RCU_ALLOC_SIZE);
+    if (unlikely(rcu == NULL)) {
+        EASEDS_ERR("[easeds_rcu_create]: Malloc rcu failed.");
+        return NULL;
+    }
+
+    memset(rcu, 0, sizeof(struct easeds_rcu));
+    rcu->name = name;
+    rcu->gp   = 1;
+    pthread_mutex_init(&rcu->lock, NULL);
+    pthread_mutex_init(&rcu->cb_lock, NULL);
+    pthread_cond_init(&rcu->cb_cond, NULL);
+    pthread_cond_init(&rcu->done_cond, NULL);
+    LIST_INIT(&rcu->readers);
+    STAILQ_INIT(&rcu->callbacks);
+
+    PFL_DEBUG("[easeds_rcu_create]: name=%s.", name != NULL ? name : "(null)");
+    return rcu;
+}
+
+// 停止回调线程, 等待一个宽限期后执行剩余回调, 销毁 RCU 域, 调用时所有读者必须已注销
+void easeds_rcu_destroy(struct easeds_rcu *rcu)
+{
+    if (unlikely(rcu == NULL)) {
+        return;
+    }
+
+    /* 回调线程退出前会执行完队列中剩余的回调 */
+    pthread_mutex_lock(&rcu->cb_lock);
+    rcu->stop = 1;
+    pthread_cond_signal(&rcu->cb_cond);
+    pthread_mutex_unlock(&rcu->cb_lock);
+    if (rcu->started) {
+        pthread_join(rcu->worker, NULL);
+    }
+
+    while (!LIST_EMPTY(&rcu->readers)) {
+        struct easeds_rcu_reader *reader = LIST_FIRST(&rcu->readers);
+        EASEDS_ERR("[easeds_rcu_destroy]: Reader %p is still registered.", (void *)reader);
+        LIST_REMOVE(reader, entry);
+        __easeds_free(reader);
+    }
+
+    pthread_cond_destroy(&rcu->done_cond);
+    pthread_cond_destroy(&rcu->cb_cond);
+    pthread_mutex_destroy(&rcu->cb_lock);
+    pthread_mutex_destroy(&rcu->lock);
+    __easeds_free(rcu);
+}
+
+// 注册当前线程为读者, 注册后处于在线状态, 失败返回NULL
+struct easeds_rcu_reader *easeds_rcu_register(struct easeds_rcu *rcu)
+{
+    if (unlikely(rcu == NULL)) {
+        EASEDS_ERR("[easeds_rcu_register]: Invalid rcu pointer.");
+        return NULL;
+    }
+
+    struct easeds_rcu_reader *reader =
+        __easeds_aligned_alloc(EASEDS_CACHE_LINE_SIZE, sizeof(struct easeds_rcu_reader));
+    if (unlikely(reader == NULL)) {
+        EASEDS_ERR("[easeds_rcu_register]: Malloc reader failed.");
+        return NULL;
+    }
+
+    memset(reader, 0, sizeof(struct easeds_rcu_reader));
+    reader->rcu = rcu;
+
+    /* 持有读者锁时没有进行中的宽限期, 新读者不会被漏掉 */
+    pthread_mutex_lock(&rcu->lock);
+    LIST_INSERT_HEAD(&rcu->readers, reader, entry);
+    __atomic_add_fetch(&rcu->nreaders, 1, __ATOMIC_RELAXED);
+    easeds_rcu_online(reader);
+    pthread_mutex_unlock(&rcu->lock);
+    return reader;
+}
+
+// 注销读者, 注销后读者不能再访问 RCU 数据
+void easeds_rcu_unregister(struct easeds_rcu_reader *reader)
+{
+    if (unlikely(reader == NULL)) {
+        return;
+    }
+
+    /* 先离线, 正在等待该读者的宽限期可以结束并释放读者锁 */
+    struct easeds_rcu *rcu = reader->rcu;
+    easeds_rcu_offline(reader);
+
+    pthread_mutex_lock(&rcu->lock);
+    LIST_REMOVE(reader, entry);
+    __atomic_sub_fetch(&rcu->nreaders, 1, __ATOMIC_RELAXED);
+    pthread_mutex_unlock(&rcu->lock);
+    __easeds_free(reader);
+}
+
+// 等待一个宽限期结束, 返回时调用前删除的元素不再被任何读者引用, 已注册的读者线程必须先离线
+void easeds_rcu_synchronize(struct easeds_rcu *rcu)
+{
+    if (unlikely(rcu == NULL)) {
+        EASEDS_ERR("[easeds_rcu_synchronize]: Invalid rcu pointer.");
+        return;
+    }
+
+    pthread_mutex_lock(&rcu->lock);
+    uint64_t gp = __atomic_add_fetch(&rcu->gp, 1, __ATOMIC_SEQ_CST);
+
+    /* 和 online 中的 fence 配对, 删除操作在递增计数之前已经完成 */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    struct easeds_rcu_reader *reader;
+    LIST_FOREACH (reader, &rcu->readers, entry) {
+        rcu_wait_reader(reader, gp);
+    }
+
+    __atomic_add_fetch(&rcu->grace_periods, 1, __ATOMIC_RELAXED);
+    pthread_mutex_unlock(&rcu->lock);
+}
+
+// 提交一个回调, 宽限期结束后在回调线程中执行, 成功返回0, 失败返回-1
+int32_t easeds_rcu_call(
+    struct easeds_rcu *rcu, struct easeds_rcu_head *head, void (*func)(struct easeds_rcu_head *))
+{
+    if (unlikely(rcu == NULL || head == NULL || func == NULL)) {
+        EASEDS_ERR("[easeds_rcu_call]: Invalid rcu, head or callback pointer.");
+        return -1;
+    }
+
+    pthread_mutex_lock(&rcu->cb_lock);
+    if (unlikely(rcu->stop)) {
+        pthread_mutex_unlock(&rcu->cb_lock);
+        EASEDS_ERR("[easeds_rcu_call]: RCU is being destroyed.");
+        return -1;
+    }
+
+    /* 第一次提交回调时启动回调线程 */
+    if (unlikely(!rcu->started)) {
+        if (unlikely(pthread_create(&rcu->worker, NULL, rcu_worker_main, rcu) != 0)) {
+            pthread_mutex_unlock(&rcu->cb_lock);
+            EASEDS_ERR("[easeds_rcu_call]: Create callback thread failed.");
+            return -1;
+        }
+        rcu->started = 1;
+    }
+
+    head->func = func;
+    STAILQ_INSERT_TAIL(&rcu->callbacks, head, entry);
+    rcu->queued++;
+    pthread_cond_signal(&rcu->cb_cond);
+    pthread_mutex_unlock(&rcu->cb_lock);
+    return 0;
+}
+
+// 等待之前提交的所有回调执行完毕, 已注册的读者线程必须先离线
+void easeds_rcu_barrier(struct easeds_rcu *rcu)
+{
+    if (unlikely(rcu == NULL)) {
+        EASEDS_ERR("[easeds_rcu_barrier]: Invalid rcu pointer.");
+        return;
+    }
+
+    pthread_mutex_lock(&rcu->cb_lock);
+    uint64_t target = rcu->queued;
+    while (rcu->invoked < target) {
+        pthread_cond_wait(&rcu->done_cond, &rcu->cb_lock);
+    }
+    pthread_mutex_unlock(&rcu->cb_lock);
+}
+
+// 获取统计信息
+void easeds_rcu_stats(struct easeds_rcu *rcu, struct easeds_rcu_stats *stats)
+{
+    if (unlikely(rcu == NULL || stats == NULL)) {
+        return;
+    }
+
+    /* 不取读者锁, 宽限期等待读者时也能获取统计 */
+    stats->readers       = __atomic_load_n(&rcu->nreaders, __ATOMIC_RELAXED);
+    stats->grace_periods = __atomic_load_n(&rcu->grace_periods, __ATOMIC_RELAXED);
+
+    pthread_mutex_lock(&rcu->cb_lock);
+    stats->queued  = rcu->queued;
+    stats->invoked = rcu->invoked;
+    pthread_mutex_unlock(&rcu->cb_lock);
+}
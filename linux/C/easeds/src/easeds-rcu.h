@@ -0,0 +1,280 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-rcu.h
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-18 22:40
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  基于静止状态(QSBR)的 RCU 运行时, 以及 easeds-queue.h 中 TAILQ/LIST 的 RCU 版本宏定义.
+ *
+ * @History:
+ *  2026年10月18日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#ifndef __EASEDS_RCU_H__
+#define __EASEDS_RCU_H__
+
+/* C 标准库头文件 */
+#include <pthread.h>
+#include <stdint.h>
+
+/* 项目内部头文件 */
+#include "easeds-environment.h"
+#include "easeds-public.h"
+#include "easeds-queue.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * RCU 链表宏, 用于读多写少的共享链表(路由表, 配置列表等):
+ *  (1) 读者用 *_FOREACH_RCU 遍历, 不加锁, 在 x86 等强内存序平台上只是普通加载.
+ *  (2) 写者之间需要用户自行加锁互斥, 修改宏先初始化新元素, 最后用 release 语义发布, 读者要么看到
+ *      完整的新元素, 要么看不到.
+ *  (3) *_REMOVE_RCU 不修改被删除元素的 next 指针, 正在访问该元素的读者可以继续向后遍历;
+ *      被删除的元素要等 easeds_rcu_synchronize 返回或 easeds_rcu_call 的回调执行后才能释放或复用.
+ *  (4) 只有前向遍历是 RCU 安全的, 读者不能使用 prev 指针和逆序遍历.
+ *
+ * 宏名称                       功能描述
+ * ------------------------     ------------------------------------------------------
+ * EASEDS_RCU_ASSIGN            发布指针(release 存储)
+ * EASEDS_RCU_DEREFERENCE       读取被发布的指针(consume 加载)
+ * TAILQ_FIRST_RCU/NEXT_RCU     读者获取第一个/下一个元素
+ * TAILQ_FOREACH_RCU            读者遍历
+ * TAILQ_INSERT_HEAD_RCU        写者在头部插入
+ * TAILQ_INSERT_TAIL_RCU        写者在尾部插入
+ * TAILQ_INSERT_AFTER_RCU       写者在指定元素后插入
+ * TAILQ_REPLACE_RCU            写者用新元素原子地替换旧元素
+ * TAILQ_REMOVE_RCU             写者删除元素
+ * LIST_FIRST_RCU/NEXT_RCU      读者获取第一个/下一个元素
+ * LIST_FOREACH_RCU             读者遍历
+ * LIST_INSERT_HEAD_RCU         写者在头部插入
+ * LIST_INSERT_AFTER_RCU        写者在指定元素后插入
+ * LIST_REMOVE_RCU              写者删除元素
+ */
+
+#define EASEDS_RCU_ASSIGN(ptr, val) __atomic_store_n(&(ptr), (val), __ATOMIC_RELEASE)
+
+#define EASEDS_RCU_DEREFERENCE(ptr) __atomic_load_n(&(ptr), __ATOMIC_CONSUME)
+
+#define TAILQ_FIRST_RCU(head) EASEDS_RCU_DEREFERENCE((head)->tqh_first)
+
+#define TAILQ_NEXT_RCU(elm, field) EASEDS_RCU_DEREFERENCE((elm)->field.tqe_next)
+
+#define TAILQ_FOREACH_RCU(var, head, field) \
+    for ((var) = TAILQ_FIRST_RCU((head)); (var); (var) = TAILQ_NEXT_RCU((var), field))
+
+#define TAILQ_INSERT_HEAD_RCU(head, elm, field)                              \
+    do {                                                                     \
+        if ((TAILQ_NEXT((elm), field) = TAILQ_FIRST((head))) != NULL)        \
+            TAILQ_FIRST((head))->field.tqe_prev = &TAILQ_NEXT((elm), field); \
+        else                                                                 \
+            (head)->tqh_last = &TAILQ_NEXT((elm), field);                    \
+        (elm)->field.tqe_prev = &TAILQ_FIRST((head));                        \
+        EASEDS_RCU_ASSIGN(TAILQ_FIRST((head)), (elm));                       \
+    } while (0)
+
+#define TAILQ_INSERT_TAIL_RCU(head, elm, field)               \
+    do {                                                      \
+        TAILQ_NEXT((elm), field) = NULL;                      \
+        (elm)->field.tqe_prev    = (head)->tqh_last;          \
+        EASEDS_RCU_ASSIGN(*(head)->tqh_last, (elm));          \
+        (head)->tqh_last = &TAILQ_NEXT((elm), field);         \
+    } while (0)
+
+#define TAILQ_INSERT_AFTER_RCU(head, listelm, elm, field)                         \
+    do {                                                                          \
+        if ((TAILQ_NEXT((elm), field) = TAILQ_NEXT((listelm), field)) != NULL)    \
+            TAILQ_NEXT((elm), field)->field.tqe_prev = &TAILQ_NEXT((elm), field); \
+        else                                                                      \
+            (head)->tqh_last = &TAILQ_NEXT((elm), field);                         \
+        (elm)->field.tqe_prev = &TAILQ_NEXT((listelm), field);                    \
+        EASEDS_RCU_ASSIGN(TAILQ_NEXT((listelm), field), (elm));                   \
+    } while (0)
+
+#define TAILQ_REPLACE_RCU(head, elm, elm2, field)                                   \
+    do {                                                                            \
+        if ((TAILQ_NEXT((elm2), field) = TAILQ_NEXT((elm), field)) != NULL)         \
+            TAILQ_NEXT((elm2), field)->field.tqe_prev = &TAILQ_NEXT((elm2), field); \
+        else                                                                        \
+            (head)->tqh_last = &TAILQ_NEXT((elm2), field);                          \
+        (elm2)->field.tqe_prev = (elm)->field.tqe_prev;                             \
+        EASEDS_RCU_ASSIGN(*(elm2)->field.tqe_prev, (elm2));                         \
+    } while (0)
+
+#define TAILQ_REMOVE_RCU(head, elm, field)                                    \
+    do {                                                                      \
+        if ((TAILQ_NEXT((elm), field)) != NULL)                               \
+            TAILQ_NEXT((elm), field)->field.tqe_prev = (elm)->field.tqe_prev; \
+        else                                                                  \
+            (head)->tqh_last = (elm)->field.tqe_prev;                         \
+        EASEDS_RCU_ASSIGN(*(elm)->field.tqe_prev, TAILQ_NEXT((elm), field));  \
+    } while (0)
+
+#define LIST_FIRST_RCU(head) EASEDS_RCU_DEREFERENCE((head)->lh_first)
+
+#define LIST_NEXT_RCU(elm, field) EASEDS_RCU_DEREFERENCE((elm)->field.le_next)
+
+#define LIST_FOREACH_RCU(var, head, field) \
+    for ((var) = LIST_FIRST_RCU((head)); (var); (var) = LIST_NEXT_RCU((var), field))
+
+#define LIST_INSERT_HEAD_RCU(head, elm, field)                            \
+    do {                                                                  \
+        if ((LIST_NEXT((elm), field) = LIST_FIRST((head))) != NULL)       \
+            LIST_FIRST((head))->field.le_prev = &LIST_NEXT((elm), field); \
+        (elm)->field.le_prev = &LIST_FIRST((head));                       \
+        EASEDS_RCU_ASSIGN(LIST_FIRST((head)), (elm));                     \
+    } while (0)
+
+#define LIST_INSERT_AFTER_RCU(listelm, elm, field)                                 \
+    do {                                                                           \
+        if ((LIST_NEXT((elm), field) = LIST_NEXT((listelm), field)) != NULL)       \
+            LIST_NEXT((listelm), field)->field.le_prev = &LIST_NEXT((elm), field); \
+        (elm)->field.le_prev = &LIST_NEXT((listelm), field);                       \
+        EASEDS_RCU_ASSIGN(LIST_NEXT((listelm), field), (elm));                     \
+    } while (0)
+
+#define LIST_REMOVE_RCU(elm, field)                                        \
+    do {                                                                   \
+        if (LIST_NEXT((elm), field) != NULL)                               \
+            LIST_NEXT((elm), field)->field.le_prev = (elm)->field.le_prev; \
+        EASEDS_RCU_ASSIGN(*(elm)->field.le_prev, LIST_NEXT((elm), field)); \
+    } while (0)
+
+/* 延迟回调节点, 嵌入到待释放的对象中 */
+struct easeds_rcu_head {
+    STAILQ_ENTRY(easeds_rcu_head) entry;        /* 回调队列 */
+    void (*func)(struct easeds_rcu_head *head); /* 宽限期结束后调用的函数 */
+};
+
+STAILQ_HEAD(easeds_rcu_head_list, easeds_rcu_head);
+
+/* 读者, 每个读者线程注册一个, 独占一个缓存行 */
+struct easeds_rcu_reader {
+    uint64_t           ctr;                              /* 最近看到的宽限期计数, 0 表示离线 */
+    struct easeds_rcu *rcu;                              /* 所属 RCU 域 */
+    LIST_ENTRY(easeds_rcu_reader) entry;                 /* 读者链表 */
+    uint8_t            pad[EASEDS_CACHE_LINE_SIZE - 32]; /* 缓存行填充 */
+};
+
+LIST_HEAD(easeds_rcu_reader_list, easeds_rcu_reader);
+
+/* RCU 域统计信息 */
+struct easeds_rcu_stats {
+    uint64_t readers;       /* 注册的读者数量 */
+    uint64_t grace_periods; /* 完成的宽限期数量 */
+    uint64_t queued;        /* easeds_rcu_call 提交的回调数量 */
+    uint64_t invoked;       /* 已执行的回调数量 */
+};
+
+/**
+ * 实现一个基于静止状态(Quiescent-State-Based Reclamation)的 RCU, 读端没有任何原子操作和内存屏障.
+ *  (1) 读者线程调用 easeds_rcu_register 注册, 之后两次 easeds_rcu_quiescent 之间就是读端临界区,
+ *      不需要 read_lock/read_unlock. 静止状态只是读取全局宽限期计数并写入自己的缓存行.
+ *  (2) 读者必须周期性地进入静止状态(例如每处理完一个请求), 长时间阻塞前调用 easeds_rcu_offline,
+ *      恢复后调用 easeds_rcu_online, 离线的读者不会阻塞宽限期, 但离线期间不能访问 RCU 数据.
+ *  (3) easeds_rcu_synchronize 递增宽限期计数, 等待所有在线读者都报告过新的计数后返回, 此时之前删除的
+ *      元素不再被任何读者引用. 已注册的读者线程调用前必须先离线, 否则会等待自己.
+ *  (4) easeds_rcu_call 把回调放入队列后立即返回, 后台线程批量等待一个宽限期后按提交顺序执行回调,
+ *      一次宽限期可以覆盖任意多个回调. easeds_rcu_barrier 等待之前提交的所有回调执行完毕.
+ *  (5) 写者更新宏见上方 RCU 链表宏, 写者之间的互斥由用户负责.
+ *  (6) 注册/注销/同步/提交回调都是线程安全的; 每个读者只能被注册它的线程使用.
+ */
+struct easeds_rcu {
+    uint64_t                      gp;      /* 宽限期计数, 从1开始 */
+    uint8_t                       pad0[EASEDS_CACHE_LINE_SIZE - 8]; /* 缓存行填充 */
+    const char                   *name;    /* 名称, 用作回调线程名 */
+    pthread_mutex_t               lock;    /* 读者锁, 保护读者链表并串行化宽限期 */
+    struct easeds_rcu_reader_list readers; /* 读者链表 */
+    uint64_t                      nreaders;      /* 注册的读者数量 */
+    uint64_t                      grace_periods; /* 完成的宽限期数量 */
+    pthread_mutex_t               cb_lock;       /* 回调锁, 保护以下字段 */
+    pthread_cond_t                cb_cond;       /* 通知回调线程 */
+    pthread_cond_t                done_cond;     /* 通知等待回调执行完毕的线程 */
+    struct easeds_rcu_head_list   callbacks;     /* 等待执行的回调 */
+    uint64_t                      queued;        /* 提交的回调数量 */
+    uint64_t                      invoked;       /* 已执行的回调数量 */
+    pthread_t                     worker;        /* 回调线程 */
+    uint32_t                      started;       /* 回调线程是否已启动 */
+    uint32_t                      stop;          /* 回调线程停止标志 */
+};
+
+/**
+ * 常见 RCU 操作函数:
+ *
+ * 函数名                       功能描述
+ * ------------------------     ------------------------------------------------------
+ * easeds_rcu_create            创建 RCU 域, 失败返回NULL
+ * easeds_rcu_destroy           停止回调线程, 执行剩余回调, 销毁 RCU 域
+ * easeds_rcu_register          注册当前线程为读者, 失败返回NULL
+ * easeds_rcu_unregister        注销读者
+ * easeds_rcu_quiescent         读者报告静止状态
+ * easeds_rcu_offline           读者离线, 不再阻塞宽限期
+ * easeds_rcu_online            读者恢复在线
+ * easeds_rcu_synchronize       等待一个宽限期结束
+ * easeds_rcu_call              提交一个宽限期结束后执行的回调
+ * easeds_rcu_barrier           等待之前提交的所有回调执行完毕
+ * easeds_rcu_stats             获取统计信息
+ */
+
+// 创建 RCU 域, 失败返回NULL
+struct easeds_rcu *easeds_rcu_create(const char *name);
+
+// 停止回调线程, 等待一个宽限期后执行剩余回调, 销毁 RCU 域, 调用时所有读者必须已注销
+void easeds_rcu_destroy(struct easeds_rcu *rcu);
+
+// 注册当前线程为读者, 注册后处于在线状态, 失败返回NULL
+struct easeds_rcu_reader *easeds_rcu_register(struct easeds_rcu *rcu);
+
+// 注销读者, 注销后读者不能再访问 RCU 数据
+void easeds_rcu_unregister(struct easeds_rcu_reader *reader);
+
+// 等待一个宽限期结束, 返回时调用前删除的元素不再被任何读者引用, 已注册的读者线程必须先离线
+void easeds_rcu_synchronize(struct easeds_rcu *rcu);
+
+// 提交一个回调, 宽限期结束后在回调线程中执行, 成功返回0, 失败返回-1
+int32_t easeds_rcu_call(
+    struct easeds_rcu *rcu, struct easeds_rcu_head *head, void (*func)(struct easeds_rcu_head *));
+
+// 等待之前提交的所有回调执行完毕, 已注册的读者线程必须先离线
+void easeds_rcu_barrier(struct easeds_rcu *rcu);
+
+// 获取统计信息
+void easeds_rcu_stats(struct easeds_rcu *rcu, struct easeds_rcu_stats *stats);
+
+// 读者报告静止状态, 调用时不能持有任何 RCU 数据的引用
+static inline void easeds_rcu_quiescent(struct easeds_rcu_reader *reader)
+{
+    /* acquire 保证之后的读取能看到宽限期开始前的删除, release 保证之前的读取已完成 */
+    uint64_t gp = __atomic_load_n(&reader->rcu->gp, __ATOMIC_ACQUIRE);
+    if (gp != reader->ctr) {
+        __atomic_store_n(&reader->ctr, gp, __ATOMIC_RELEASE);
+    }
+}
+
+// 读者离线, 离线期间不阻塞宽限期, 也不能访问 RCU 数据
+static inline void easeds_rcu_offline(struct easeds_rcu_reader *reader)
+{
+    __atomic_store_n(&reader->ctr, 0, __ATOMIC_RELEASE);
+}
+
+// 读者恢复在线
+static inline void easeds_rcu_online(struct easeds_rcu_reader *reader)
+{
+    __atomic_store_n(&reader->ctr, __atomic_load_n(&reader->rcu->gp, __ATOMIC_ACQUIRE),
+        __ATOMIC_RELAXED);
+    /* 和 synchronize 中的 fence 配对: 要么宽限期看到读者在线, 要么读者之后能看到删除 */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __EASEDS_RCU_H__ */
@@ -0,0 +1,536 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-reclaim-unittest.c
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-18 22:25
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  Easeds 安全内存回收单元测试实现文件, 包含了临界区阻塞/风险指针保护/线程退出移交/并发替换和读端开销测试.
+ *
+ * @History:
+ *  2026年10月18日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#include "easeds-unittest.h"
+
+// 标准库头文件
+#include <pthread.h>
+
+// 项目内部头文件
+#include "easeds-reclaim.h"
+#include "easeds-utils.h"
+
+/* 测试节点的有效标记, 释放时改写 */
+#define RECLAIM_MAGIC 0x5EC1A1A5C0FFEE00ULL
+
+// 测试节点
+struct reclaim_node {
+    uint64_t magic; /* 有效标记 */
+    uint64_t value; /* 数据 */
+};
+
+// 计数分配器上下文
+struct reclaim_counter {
+    uint64_t frees; /* 释放的对象数量 */
+    uint64_t bytes; /* 释放的字节数 */
+    void    *watch; /* 被监视的对象, 释放时清零 */
+};
+
+// 计数分配器: 释放前改写节点标记, 统计释放数量
+static void reclaim_counter_free(void *ctx, void *ptr, size_t size)
+{
+    struct reclaim_counter *counter = ctx;
+
+    if (size >= sizeof(struct reclaim_node)) {
+        ((struct reclaim_node *)ptr)->magic = 0;
+    }
+    if (__atomic_load_n(&counter->watch, __ATOMIC_RELAXED) == ptr) {
+        __atomic_store_n(&counter->watch, NULL, __ATOMIC_RELAXED);
+    }
+    __atomic_add_fetch(&counter->frees, 1, __ATOMIC_RELAXED);
+    __atomic_add_fetch(&counter->bytes, size, __ATOMIC_RELAXED);
+    free(ptr);
+}
+
+static void *reclaim_counter_alloc(void *ctx, size_t size)
+{
+    easeds_unused(ctx);
+    return malloc(size);
+}
+
+// 创建一个带计数分配器的回收域
+static struct easeds_reclaim *reclaim_create_counted(
+    uint32_t mode, struct easeds_allocator *allocator, struct reclaim_counter *counter)
+{
+    memset(counter, 0, sizeof(struct reclaim_counter));
+    allocator->alloc_fn   = reclaim_counter_alloc;
+    allocator->realloc_fn = NULL;
+    allocator->free_fn    = reclaim_counter_free;
+    allocator->ctx        = counter;
+    return easeds_reclaim_create("test", mode, allocator);
+}
+
+static struct reclaim_node *reclaim_node_new(uint64_t value)
+{
+    struct reclaim_node *node = malloc(sizeof(struct reclaim_node));
+    assert_non_null(node);
+    node->magic = RECLAIM_MAGIC;
+    node->value = value;
+    return node;
+}
+
+// 基本功能测试: 退休对象在 flush 后通过分配器全部释放
+static void test_easeds_reclaim_basic(void **state)
+{
+    easeds_unused(state);
+
+    for (uint32_t mode = EASEDS_RECLAIM_EBR; mode <= EASEDS_RECLAIM_HP; mode++) {
+        struct easeds_allocator allocator;
+        struct reclaim_counter  counter;
+        struct easeds_reclaim  *reclaim = reclaim_create_counted(mode, &allocator, &counter);
+        assert_non_null(reclaim);
+
+        assert_int_equal(easeds_reclaim_enter(reclaim), 0);
+        for (uint64_t i = 0; i < 10; i++) {
+            assert_int_equal(
+                easeds_reclaim_retire(reclaim, reclaim_node_new(i), sizeof(struct reclaim_node)),
+                0);
+        }
+        easeds_reclaim_exit(reclaim);
+
+        struct easeds_reclaim_stats stats;
+        easeds_reclaim_stats(reclaim, &stats);
+        assert_int_equal(stats.threads, 1);
+        assert_int_equal(stats.records, 1);
+        assert_int_equal(stats.retires, 10);
+        assert_int_equal(stats.pending, 10 - counter.frees);
+
+        easeds_reclaim_flush(reclaim);
+        assert_int_equal(counter.frees, 10);
+        assert_int_equal(counter.bytes, 10 * sizeof(struct reclaim_node));
+
+        easeds_reclaim_stats(reclaim, &stats);
+        assert_int_equal(stats.frees, 10);
+        assert_int_equal(stats.pending, 0);
+        easeds_reclaim_destroy(reclaim);
+    }
+
+    // 未指定分配器时使用 __easeds_free
+    struct easeds_reclaim *reclaim = easeds_reclaim_create("free", EASEDS_RECLAIM_EBR, NULL);
+    assert_non_null(reclaim);
+    assert_int_equal(easeds_reclaim_retire(reclaim, malloc(100), 100), 0);
+    easeds_reclaim_flush(reclaim);
+    assert_int_equal(easeds_reclaim_retire(reclaim, malloc(100), 100), 0);
+    easeds_reclaim_destroy(reclaim);
+}
+
+// 退休线程参数
+struct reclaim_retire_ctx {
+    struct easeds_reclaim *reclaim; /* 回收域 */
+    uint32_t               count;   /* 退休对象数量 */
+    uint32_t               enter;   /* 是否进入临界区后不退出就结束线程 */
+    uint64_t               freed;   /* 线程内回收到的对象数量 */
+};
+
+// 退休线程: 退休若干对象并尝试回收, 然后直接退出
+static void *reclaim_retire_fn(void *arg)
+{
+    struct reclaim_retire_ctx *ctx = arg;
+
+    if (ctx->enter) {
+        easeds_reclaim_enter(ctx->reclaim);
+    }
+    for (uint32_t i = 0; i < ctx->count; i++) {
+        easeds_reclaim_retire(ctx->reclaim, reclaim_node_new(i), sizeof(struct reclaim_node));
+    }
+    for (uint32_t i = 0; i < 4; i++) {
+        ctx->freed += easeds_reclaim_poll(ctx->reclaim);
+    }
+    return NULL;
+}
+
+// 并发替换测试参数
+struct reclaim_stress_ctx {
+    struct easeds_reclaim *reclaim;   /* 回收域 */
+    struct reclaim_node   *slots[16]; /* 共享槽位 */
+    uint64_t               ops;       /* 每个线程的操作数量 */
+    uint32_t               update;    /* 每 update 次操作中有一次替换 */
+    uint32_t               pad;       /* 对齐填充 */
+    uint64_t               errors;    /* 读到已释放节点的次数 */
+    uint64_t               allocs;    /* 替换时新建的节点数量 */
+};
+
+// 并发替换线程: 大部分操作读取槽位中的节点, 少部分操作用新节点替换并退休旧节点
+static void *reclaim_stress_fn(void *arg)
+{
+    struct reclaim_stress_ctx *ctx    = arg;
+    uint64_t                   seed   = 88172645463325252ULL ^ (uint64_t)(uintptr_t)&ctx;
+    uint64_t                   errors = 0;
+    uint64_t                   allocs = 0;
+
+    for (uint64_t i = 0; i < ctx->ops; i++) {
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+
+        void **slot = (void **)&ctx->slots[seed & 15];
+        easeds_reclaim_enter(ctx->reclaim);
+        if ((seed >> 8) % ctx->update == 0) {
+            struct reclaim_node *node = reclaim_node_new(i);
+            struct reclaim_node *old  = __atomic_exchange_n(slot, node, __ATOMIC_ACQ_REL);
+            easeds_reclaim_retire(ctx->reclaim, old, sizeof(struct reclaim_node));
+            allocs++;
+        } else {
+            const struct reclaim_node *node = easeds_reclaim_protect(ctx->reclaim, 0, slot);
+            errors += __atomic_load_n(&node->magic, __ATOMIC_RELAXED) != RECLAIM_MAGIC;
+        }
+        easeds_reclaim_exit(ctx->reclaim);
+    }
+
+    __atomic_add_fetch(&ctx->errors, errors, __ATOMIC_RELAXED);
+    __atomic_add_fetch(&ctx->allocs, allocs, __ATOMIC_RELAXED);
+    return NULL;
+}
+
+// 运行一轮并发替换, 返回每次操作的平均耗时
+static double reclaim_stress_run(struct reclaim_stress_ctx *ctx, uint32_t nthreads)
+{
+    pthread_t threads[4];
+
+    int64_t start = easeds_get_current_time_ns();
+    for (uint32_t t = 0; t < nthreads; t++) {
+        assert_int_equal(pthread_create(&threads[t], NULL, reclaim_stress_fn, ctx), 0);
+    }
+    for (uint32_t t = 0; t < nthreads; t++) {
+        pthread_join(threads[t], NULL);
+    }
+    return (double)(easeds_get_current_time_ns() - start) / (double)(ctx->ops * nthreads);
+}
+
+// 操作测试: 风险指针阻止回收, 临界区阻止回收, 线程退出移交, 并发替换
+static void test_easeds_reclaim_operations(void **state)
+{
+    easeds_unused(state);
+
+    struct easeds_allocator     allocator;
+    struct reclaim_counter      counter;
+    struct easeds_reclaim_stats stats;
+
+    // 风险指针保护的对象在清除前不会被释放
+    struct easeds_reclaim *reclaim =
+        reclaim_create_counted(EASEDS_RECLAIM_HP, &allocator, &counter);
+    assert_non_null(reclaim);
+    struct reclaim_node *shared = reclaim_node_new(1);
+    struct reclaim_node *other  = reclaim_node_new(2);
+
+    assert_int_equal(easeds_reclaim_enter(reclaim), 0);
+    struct reclaim_node *node = easeds_reclaim_protect(reclaim, 1, (void *const *)&shared);
+    assert_ptr_equal(node, shared);
+    shared = NULL;
+    assert_int_equal(easeds_reclaim_retire(reclaim, node, sizeof(struct reclaim_node)), 0);
+    assert_int_equal(easeds_reclaim_retire(reclaim, other, sizeof(struct reclaim_node)), 0);
+    assert_int_equal(easeds_reclaim_poll(reclaim), 1);
+    assert_int_equal(easeds_reclaim_poll(reclaim), 0);
+    assert_int_equal(node->magic, RECLAIM_MAGIC);
+
+    easeds_reclaim_unprotect(reclaim, 1);
+    assert_int_equal(easeds_reclaim_poll(reclaim), 1);
+    assert_int_equal(counter.frees, 2);
+    easeds_reclaim_exit(reclaim);
+    easeds_reclaim_destroy(reclaim);
+
+    // EBR: 当前线程停在临界区内时其他线程退休的对象不会被释放, 线程退出后对象移交给回收域
+    reclaim = reclaim_create_counted(EASEDS_RECLAIM_EBR, &allocator, &counter);
+    assert_non_null(reclaim);
+    assert_int_equal(easeds_reclaim_enter(reclaim), 0);
+
+    struct reclaim_retire_ctx retire = {.reclaim = reclaim, .count = 200};
+    pthread_t                 thread;
+    assert_int_equal(pthread_create(&thread, NULL, reclaim_retire_fn, &retire), 0);
+    pthread_join(thread, NULL);
+    assert_int_equal(retire.freed, 0);
+    assert_int_equal(counter.frees, 0);
+
+    easeds_reclaim_stats(reclaim, &stats);
+    assert_int_equal(stats.threads, 1);
+    assert_int_equal(stats.records, 2);
+    assert_int_equal(stats.retires, 200);
+    assert_int_equal(stats.pending, 200);
+
+    // 临界区内也不能回收, 退出后由当前线程接管并释放
+    assert_int_equal(easeds_reclaim_poll(reclaim), 0);
+    easeds_reclaim_exit(reclaim);
+    easeds_reclaim_flush(reclaim);
+    assert_int_equal(counter.frees, 200);
+    easeds_reclaim_stats(reclaim, &stats);
+    assert_int_equal(stats.pending, 0);
+    easeds_reclaim_destroy(reclaim);
+
+    // 并发替换: 读者不会读到已释放的节点, 销毁后所有节点都已释放
+    for (uint32_t mode = EASEDS_RECLAIM_EBR; mode <= EASEDS_RECLAIM_HP; mode++) {
+        struct reclaim_stress_ctx ctx = {.ops = 200000, .update = 4};
+        ctx.reclaim = reclaim_create_counted(mode, &allocator, &counter);
+        assert_non_null(ctx.reclaim);
+        for (uint32_t i = 0; i < 16; i++) {
+            ctx.slots[i] = reclaim_node_new(i);
+        }
+
+        reclaim_stress_run(&ctx, 4);
+        assert_int_equal(ctx.errors, 0);
+
+        easeds_reclaim_stats(ctx.reclaim, &stats);
+        assert_int_equal(stats.retires, ctx.allocs);
+        assert_int_equal(stats.threads, 0);
+        assert_int_equal(stats.frees + stats.pending, ctx.allocs);
+
+        easeds_reclaim_destroy(ctx.reclaim);
+        assert_int_equal(counter.frees, ctx.allocs);
+        for (uint32_t i = 0; i < 16; i++) {
+            free(ctx.slots[i]);
+        }
+    }
+}
+
+// 边界测试: 风险指针模式未释放对象数量有上界, 嵌套临界区, 线程在临界区内退出, 记录复用
+static void test_easeds_reclaim_boundary(void **state)
+{
+    easeds_unused(state);
+
+    struct easeds_allocator     allocator;
+    struct reclaim_counter      counter;
+    struct easeds_reclaim_stats stats;
+
+    // HP: 一个对象一直被保护, 其余对象持续退休, 未释放数量始终有上界
+    struct easeds_reclaim *reclaim =
+        reclaim_create_counted(EASEDS_RECLAIM_HP, &allocator, &counter);
+    assert_non_null(reclaim);
+    struct reclaim_node *shared = reclaim_node_new(0);
+    counter.watch               = shared;
+
+    assert_int_equal(easeds_reclaim_enter(reclaim), 0);
+    struct reclaim_node *pinned = easeds_reclaim_protect(reclaim, 0, (void *const *)&shared);
+    assert_int_equal(easeds_reclaim_retire(reclaim, pinned, sizeof(struct reclaim_node)), 0);
+
+    uint64_t hazards = EASEDS_RECLAIM_HP_SLOTS;
+    uint64_t bound   = hazards + (hazards > EASEDS_RECLAIM_BATCH ? hazards : EASEDS_RECLAIM_BATCH);
+    for (uint32_t i = 0; i < 10000; i++) {
+        assert_int_equal(
+            easeds_reclaim_retire(reclaim, reclaim_node_new(i), sizeof(struct reclaim_node)), 0);
+        easeds_reclaim_stats(reclaim, &stats);
+        assert_true(stats.pending <= bound);
+    }
+    assert_ptr_equal(counter.watch, pinned);
+    assert_int_equal(pinned->magic, RECLAIM_MAGIC);
+
+    easeds_reclaim_exit(reclaim);
+    easeds_reclaim_flush(reclaim);
+    assert_null(counter.watch);
+    assert_int_equal(counter.frees, 10001);
+    easeds_reclaim_destroy(reclaim);
+
+    // EBR: 没有线程停在临界区内时, 纪元持续推进, 未释放数量保持在几个批量以内
+    reclaim = reclaim_create_counted(EASEDS_RECLAIM_EBR, &allocator, &counter);
+    assert_non_null(reclaim);
+    for (uint32_t i = 0; i < 10000; i++) {
+        assert_int_equal(easeds_reclaim_enter(reclaim), 0);
+        assert_int_equal(
+            easeds_reclaim_retire(reclaim, reclaim_node_new(i), sizeof(struct reclaim_node)), 0);
+        easeds_reclaim_exit(reclaim);
+        easeds_reclaim_stats(reclaim, &stats);
+        assert_true(stats.pending <= 3 * EASEDS_RECLAIM_BATCH);
+    }
+    assert_true(stats.epoch > 100);
+
+    // 嵌套临界区: 内层退出后仍然阻止回收
+    assert_int_equal(easeds_reclaim_enter(reclaim), 0);
+    assert_int_equal(easeds_reclaim_enter(reclaim), 0);
+    easeds_reclaim_exit(reclaim);
+    uint64_t epoch = stats.epoch;
+    for (uint32_t i = 0; i < 8; i++) {
+        easeds_reclaim_poll(reclaim);
+    }
+    easeds_reclaim_stats(reclaim, &stats);
+    assert_true(stats.epoch <= epoch + 1);
+    easeds_reclaim_exit(reclaim);
+    easeds_reclaim_flush(reclaim);
+    assert_int_equal(counter.frees, 10000);
+
+    // 线程在临界区内退出: 析构函数退出临界区, 不会阻止回收, 记录被后续线程复用
+    struct reclaim_retire_ctx retire = {.reclaim = reclaim, .count = 10, .enter = 1};
+    pthread_t                 thread;
+    for (uint32_t i = 0; i < 3; i++) {
+        assert_int_equal(pthread_create(&thread, NULL, reclaim_retire_fn, &retire), 0);
+        pthread_join(thread, NULL);
+    }
+    easeds_reclaim_flush(reclaim);
+    assert_int_equal(counter.frees, 10030);
+
+    easeds_reclaim_stats(reclaim, &stats);
+    assert_int_equal(stats.records, 2);
+    assert_int_equal(stats.threads, 1);
+    assert_int_equal(stats.pending, 0);
+
+    // 销毁时释放未回收的对象
+    assert_int_equal(
+        easeds_reclaim_retire(reclaim, reclaim_node_new(0), sizeof(struct reclaim_node)), 0);
+    easeds_reclaim_destroy(reclaim);
+    assert_int_equal(counter.frees, 10031);
+}
+
+// 错误处理测试: 非法参数, 未进入临界区就退出, 临界区内 flush
+static void test_easeds_reclaim_error(void **state)
+{
+    easeds_unused(state);
+
+    struct easeds_reclaim_stats stats;
+    void                       *shared = &stats;
+
+    assert_null(easeds_reclaim_create("error", 2, NULL));
+    assert_int_equal(easeds_reclaim_enter(NULL), -1);
+    easeds_reclaim_exit(NULL);
+    assert_null(easeds_reclaim_protect(NULL, 0, &shared));
+    easeds_reclaim_unprotect(NULL, 0);
+    assert_int_equal(easeds_reclaim_retire(NULL, shared, 8), -1);
+    assert_int_equal(easeds_reclaim_poll(NULL), 0);
+    easeds_reclaim_flush(NULL);
+    easeds_reclaim_stats(NULL, &stats);
+    easeds_reclaim_destroy(NULL);
+
+    for (uint32_t mode = EASEDS_RECLAIM_EBR; mode <= EASEDS_RECLAIM_HP; mode++) {
+        struct easeds_reclaim *reclaim = easeds_reclaim_create("error", mode, NULL);
+        assert_non_null(reclaim);
+
+        easeds_reclaim_stats(reclaim, NULL);
+        easeds_reclaim_exit(reclaim);
+        assert_null(easeds_reclaim_protect(reclaim, EASEDS_RECLAIM_HP_SLOTS, &shared));
+        assert_null(easeds_reclaim_protect(reclaim, 0, NULL));
+        easeds_reclaim_unprotect(reclaim, EASEDS_RECLAIM_HP_SLOTS);
+        assert_int_equal(easeds_reclaim_retire(reclaim, NULL, 8), -1);
+
+        // 临界区内 flush 直接返回, 不会死等
+        assert_int_equal(easeds_reclaim_enter(reclaim), 0);
+        assert_int_equal(easeds_reclaim_retire(reclaim, malloc(8), 8), 0);
+        easeds_reclaim_flush(reclaim);
+        easeds_reclaim_exit(reclaim);
+        easeds_reclaim_exit(reclaim);
+
+        easeds_reclaim_stats(reclaim, &stats);
+        assert_int_equal(stats.retires, 1);
+        easeds_reclaim_destroy(reclaim);
+    }
+}
+
+// 读端开销测试参数
+struct reclaim_read_ctx {
+    struct easeds_reclaim *reclaim; /* 回收域, 为NULL时使用读写锁 */
+    pthread_rwlock_t      *rwlock;  /* 读写锁 */
+    void                  *shared;  /* 共享指针 */
+    uint64_t               ops;     /* 读取次数 */
+    uint64_t               sum;     /* 防止读取被优化掉 */
+};
+
+// 读端开销测试线程: 进入临界区, 读取共享指针, 退出临界区
+static void *reclaim_read_fn(void *arg)
+{
+    struct reclaim_read_ctx *ctx = arg;
+    uint64_t                 sum = 0;
+
+    for (uint64_t i = 0; i < ctx->ops; i++) {
+        if (ctx->reclaim != NULL) {
+            easeds_reclaim_enter(ctx->reclaim);
+            const struct reclaim_node *node = easeds_reclaim_protect(ctx->reclaim, 0, &ctx->shared);
+            sum += node->value;
+            easeds_reclaim_exit(ctx->reclaim);
+        } else {
+            pthread_rwlock_rdlock(ctx->rwlock);
+            sum += ((const struct reclaim_node *)ctx->shared)->value;
+            pthread_rwlock_unlock(ctx->rwlock);
+        }
+    }
+    __atomic_add_fetch(&ctx->sum, sum, __ATOMIC_RELAXED);
+    return NULL;
+}
+
+// 运行一轮读端测试, 返回每次读取的平均耗时
+static double reclaim_read_run(struct reclaim_read_ctx *ctx, uint32_t nthreads)
+{
+    pthread_t threads[4];
+
+    int64_t start = easeds_get_current_time_ns();
+    for (uint32_t t = 0; t < nthreads; t++) {
+        assert_int_equal(pthread_create(&threads[t], NULL, reclaim_read_fn, ctx), 0);
+    }
+    for (uint32_t t = 0; t < nthreads; t++) {
+        pthread_join(threads[t], NULL);
+    }
+    return (double)(easeds_get_current_time_ns() - start) / (double)(ctx->ops * nthreads);
+}
+
+// 性能测试: 读端开销(EBR/HP/读写锁)和读多写少的并发替换
+static void test_easeds_reclaim_perf(void **state)
+{
+    easeds_unused(state);
+
+    const uint32_t threads[] = {1, 4};
+
+    for (uint32_t t = 0; t < 2; t++) {
+        pthread_rwlock_t        rwlock;
+        struct reclaim_node    *node = reclaim_node_new(7);
+        struct reclaim_read_ctx ctx  = {.rwlock = &rwlock, .shared = node, .ops = 2000000};
+        double                  read_ns[3];
+
+        pthread_rwlock_init(&rwlock, NULL);
+        for (uint32_t mode = EASEDS_RECLAIM_EBR; mode <= EASEDS_RECLAIM_HP; mode++) {
+            ctx.reclaim   = easeds_reclaim_create("perf", mode, NULL);
+            read_ns[mode] = reclaim_read_run(&ctx, threads[t]);
+            easeds_reclaim_destroy(ctx.reclaim);
+        }
+        ctx.reclaim = NULL;
+        read_ns[2]  = reclaim_read_run(&ctx, threads[t]);
+        assert_int_equal(ctx.sum, 7 * ctx.ops * threads[t] * 3);
+
+        MEASURE("[reclaim perf]: %u threads read, ebr %.1f ns/op, hp %.1f ns/op, "
+                "rwlock %.1f ns/op.",
+            threads[t], read_ns[0], read_ns[1], read_ns[2]);
+        pthread_rwlock_destroy(&rwlock);
+        free(node);
+    }
+
+    for (uint32_t mode = EASEDS_RECLAIM_EBR; mode <= EASEDS_RECLAIM_HP; mode++) {
+        struct reclaim_stress_ctx ctx = {.ops = 1000000, .update = 16};
+        ctx.reclaim = easeds_reclaim_create("perf", mode, NULL);
+        for (uint32_t i = 0; i < 16; i++) {
+            ctx.slots[i] = reclaim_node_new(i);
+        }
+
+        double ns = reclaim_stress_run(&ctx, 4);
+        assert_int_equal(ctx.errors, 0);
+
+        struct easeds_reclaim_stats stats;
+        easeds_reclaim_stats(ctx.reclaim, &stats);
+        MEASURE("[reclaim perf]: %s, 4 threads, 1/16 update, %.1f ns/op, retires %lu, "
+                "pending %lu, scans %lu, epoch %lu.",
+            mode == EASEDS_RECLAIM_EBR ? "ebr" : "hp", ns, stats.retires, stats.pending,
+            stats.scans, stats.epoch);
+
+        easeds_reclaim_destroy(ctx.reclaim);
+        for (uint32_t i = 0; i < 16; i++) {
+            free(ctx.slots[i]);
+        }
+    }
+}
+
+// 注册单元测试用例
+EASEDS_UNITTEST_REGISTER(easeds_unittest_reclaim){
+    cmocka_unit_test(test_easeds_reclaim_basic),
+    cmocka_unit_test(test_easeds_reclaim_operations),
+    cmocka_unit_test(test_easeds_reclaim_boundary),
+    cmocka_unit_test(test_easeds_reclaim_error),
+    cmocka_unit_test(test_easeds_reclaim_perf),
+    easeds_unit_test_end,
+};
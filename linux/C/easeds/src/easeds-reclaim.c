@@ -0,0 +1,535 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-reclaim.c
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-18 22:25
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  无锁结构的安全内存回收实现文件.
+ *
+ * @History:
+ *  2026年10月18日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#include "easeds-reclaim.h"
+
+// 标准库头文件
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+
+// 项目内部头文件
+#include "easeds-log.h"
+
+/* 回收域结构体按缓存行对齐分配, 大小向上取整 */
+#define RECLAIM_ALLOC_SIZE(type) \
+    ((sizeof(type) + EASEDS_CACHE_LINE_SIZE - 1) & ~(size_t)(EASEDS_CACHE_LINE_SIZE - 1))
+
+// 通过回收域的分配器释放对象
+static inline void reclaim_free_entry(
+    struct easeds_reclaim *reclaim, const struct easeds_reclaim_entry *entry)
+{
+    if (reclaim->allocator == NULL) {
+        __easeds_free(entry->ptr);
+    } else {
+        reclaim->allocator->free_fn(reclaim->allocator->ctx, entry->ptr, entry->size);
+    }
+}
+
+// 保证退休数组至少能容纳 need 个对象, 成功返回0, 失败返回-1
+static int32_t reclaim_entries_reserve(
+    struct easeds_reclaim_entry **entries, uint32_t *capacity, uint64_t need)
+{
+    if (likely(need <= *capacity)) {
+        return 0;
+    }
+
+    uint64_t new_capacity = *capacity != 0 ? *capacity : EASEDS_RECLAIM_BATCH;
+    while (new_capacity < need) {
+        new_capacity *= 2;
+    }
+    if (unlikely(new_capacity > UINT32_MAX)) {
+        EASEDS_ERR("[reclaim_entries_reserve]: Too many retired objects %lu.", need);
+        return -1;
+    }
+
+    struct easeds_reclaim_entry *new_entries =
+        realloc(*entries, new_capacity * sizeof(struct easeds_reclaim_entry));
+    if (unlikely(new_entries == NULL)) {
+        EASEDS_ERR("[reclaim_entries_reserve]: Realloc %lu retired entries failed.", new_capacity);
+        return -1;
+    }
+
+    *entries  = new_entries;
+    *capacity = (uint32_t)new_capacity;
+    return 0;
+}
+
+// 线程退出时退出临界区, 把未释放的对象移交给回收域, 记录标记为空闲供新线程复用
+static void reclaim_record_destructor(void *arg)
+{
+    struct easeds_reclaim_record *rec     = arg;
+    struct easeds_reclaim        *reclaim = rec->domain;
+
+    rec->nest = 0;
+    __atomic_store_n(&rec->epoch, 0, __ATOMIC_RELEASE);
+    for (uint32_t i = 0; i < EASEDS_RECLAIM_HP_SLOTS; i++) {
+        __atomic_store_n(&rec->hazards[i], NULL, __ATOMIC_RELEASE);
+    }
+
+    if (rec->count != 0) {
+        pthread_mutex_lock(&reclaim->lock);
+        /* 扩容失败时对象留在记录中, 由复用该记录的线程或销毁回收域时释放 */
+        if (likely(reclaim_entries_reserve(&reclaim->orphans, &reclaim->orphan_capacity,
+                       (uint64_t)reclaim->orphan_count + rec->count)
+                   == 0)) {
+            memcpy(reclaim->orphans + reclaim->orphan_count, rec->retired,
+                rec->count * sizeof(struct easeds_reclaim_entry));
+            __atomic_store_n(
+                &reclaim->orphan_count, reclaim->orphan_count + rec->count, __ATOMIC_RELAXED);
+            rec->count = 0;
+        }
+        pthread_mutex_unlock(&reclaim->lock);
+    }
+
+    rec->limit = rec->count + EASEDS_RECLAIM_BATCH;
+    __atomic_sub_fetch(&reclaim->threads, 1, __ATOMIC_RELAXED);
+    __atomic_store_n(&rec->in_use, 0, __ATOMIC_RELEASE);
+}
+
+// 为当前线程占用一个线程记录, 优先复用空闲记录, 失败返回NULL
+static struct easeds_reclaim_record *reclaim_record_acquire(struct easeds_reclaim *reclaim)
+{
+    struct easeds_reclaim_record *rec = __atomic_load_n(&reclaim->records, __ATOMIC_ACQUIRE);
+    for (; rec != NULL; rec = rec->next) {
+        uint32_t expected = 0;
+        if (__atomic_load_n(&rec->in_use, __ATOMIC_RELAXED) == 0
+            && __atomic_compare_exchange_n(
+                &rec->in_use, &expected, 1, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+            break;
+        }
+    }
+
+    if (rec == NULL) {
+        rec = __easeds_aligned_alloc(
+            EASEDS_CACHE_LINE_SIZE, RECLAIM_ALLOC_SIZE(struct easeds_reclaim_record));
+        if (unlikely(rec == NULL)) {
+            EASEDS_ERR("[reclaim_record_acquire]: Malloc thread record failed.");
+            return NULL;
+        }
+
+        memset(rec, 0, sizeof(struct easeds_reclaim_record));
+        rec->in_use = 1;
+        rec->domain = reclaim;
+        rec->limit  = EASEDS_RECLAIM_BATCH;
+        rec->next   = __atomic_load_n(&reclaim->records, __ATOMIC_RELAXED);
+        while (!__atomic_compare_exchange_n(
+            &reclaim->records, &rec->next, rec, true, __ATOMIC_RELEASE, __ATOMIC_RELAXED)) {
+        }
+    }
+
+    __atomic_add_fetch(&reclaim->threads, 1, __ATOMIC_RELAXED);
+    if (unlikely(pthread_setspecific(reclaim->key, rec) != 0)) {
+        EASEDS_ERR("[reclaim_record_acquire]: Set thread specific data failed.");
+        reclaim_record_destructor(rec);
+        return NULL;
+    }
+    return rec;
+}
+
+// 获取当前线程的记录, 第一次访问时占用一个
+static inline struct easeds_reclaim_record *reclaim_record(struct easeds_reclaim *reclaim)
+{
+    struct easeds_reclaim_record *rec = pthread_getspecific(reclaim->key);
+    if (unlikely(rec == NULL)) {
+        rec = reclaim_record_acquire(reclaim);
+    }
+    return rec;
+}
+
+// 接管已退出线程留下的对象
+static void reclaim_adopt(struct easeds_reclaim *reclaim, struct easeds_reclaim_record *rec)
+{
+    if (likely(__atomic_load_n(&reclaim->orphan_count, __ATOMIC_RELAXED) == 0)) {
+        return;
+    }
+
+    pthread_mutex_lock(&reclaim->lock);
+    if (reclaim_entries_reserve(
+            &rec->retired, &rec->capacity, (uint64_t)rec->count + reclaim->orphan_count)
+        == 0) {
+        memcpy(rec->retired + rec->count, reclaim->orphans,
+            reclaim->orphan_count * sizeof(struct easeds_reclaim_entry));
+        rec->count += reclaim->orphan_count;
+        __atomic_store_n(&reclaim->orphan_count, 0, __ATOMIC_RELAXED);
+    }
+    pthread_mutex_unlock(&reclaim->lock);
+}
+
+// 所有临界区内的线程都已看到当前全局纪元时推进全局纪元, 返回推进后(或未推进)的全局纪元
+static uint64_t reclaim_try_advance(struct easeds_reclaim *reclaim)
+{
+    uint64_t epoch = __atomic_load_n(&reclaim->epoch, __ATOMIC_SEQ_CST);
+
+    /* 和 enter 中的 fence 配对: 要么看到线程已进入临界区, 要么该线程进入后能看到之前的摘除 */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    for (struct easeds_reclaim_record *rec = __atomic_load_n(&reclaim->records, __ATOMIC_ACQUIRE);
+         rec != NULL; rec = rec->next) {
+        uint64_t local = __atomic_load_n(&rec->epoch, __ATOMIC_SEQ_CST);
+        if ((local & 1) != 0 && (local >> 1) != epoch) {
+            return epoch;
+        }
+    }
+
+    if (__atomic_compare_exchange_n(
+            &reclaim->epoch, &epoch, epoch + 1, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST)) {
+        epoch++;
+    }
+    return epoch;
+}
+
+// 风险指针排序比较函数
+static int reclaim_hazard_cmp(const void *a, const void *b)
+{
+    uintptr_t x = *(const uintptr_t *)a;
+    uintptr_t y = *(const uintptr_t *)b;
+    return x < y ? -1 : (x > y ? 1 : 0);
+}
+
+// 收集所有线程发布的风险指针并排序, 返回数量, hazards 由调用者释放, 失败返回 UINT64_MAX
+static uint64_t reclaim_hazards_collect(struct easeds_reclaim *reclaim, uintptr_t **hazards)
+{
+    struct easeds_reclaim_record *head = __atomic_load_n(&reclaim->records, __ATOMIC_ACQUIRE);
+    uint64_t                      slots = 0;
+
+    for (struct easeds_reclaim_record *rec = head; rec != NULL; rec = rec->next) {
+        slots += EASEDS_RECLAIM_HP_SLOTS;
+    }
+    if (unlikely(slots == 0)) {
+        return 0;
+    }
+
+    *hazards = __easeds_malloc(slots * sizeof(uintptr_t));
+    if (unlikely(*hazards == NULL)) {
+        EASEDS_ERR("[reclaim_hazards_collect]: Malloc %lu hazard slots failed.", slots);
+        return UINT64_MAX;
+    }
+
+    /* 和 protect 中的 fence 配对: 要么看到发布的风险指针, 要么读者重新读取时发现对象已被摘除 */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    uint64_t count = 0;
+    for (struct easeds_reclaim_record *rec = head; rec != NULL; rec = rec->next) {
+        for (uint32_t i = 0; i < EASEDS_RECLAIM_HP_SLOTS; i++) {
+            void *hazard = __atomic_load_n(&rec->hazards[i], __ATOMIC_SEQ_CST);
+            if (hazard != NULL) {
+                (*hazards)[count++] = (uintptr_t)hazard;
+            }
+        }
+    }
+
+    qsort(*hazards, count, sizeof(uintptr_t), reclaim_hazard_cmp);
+    return count;
+}
+
+// 批量回收当前线程退休列表中不再被访问的对象, 返回释放的对象数量
+static uint64_t reclaim_collect(struct easeds_reclaim *reclaim, struct easeds_reclaim_record *rec)
+{
+    reclaim_adopt(reclaim, rec);
+    __atomic_add_fetch(&reclaim->scans, 1, __ATOMIC_RELAXED);
+
+    uintptr_t *hazards = NULL;
+    uint64_t   nhazard = 0;
+    uint64_t   epoch   = 0;
+    uint64_t   window  = EASEDS_RECLAIM_BATCH;
+
+    if (reclaim->mode == EASEDS_RECLAIM_EBR) {
+        epoch = reclaim_try_advance(reclaim);
+    } else {
+        nhazard = reclaim_hazards_collect(reclaim, &hazards);
+        if (unlikely(nhazard == UINT64_MAX)) {
+            return 0;
+        }
+        window = nhazard > window ? nhazard : window;
+    }
+
+    /* 原地压缩退休列表, 保留仍可能被访问的对象 */
+    uint32_t keep = 0;
+    for (uint32_t i = 0; i < rec->count; i++) {
+        const struct easeds_reclaim_entry *entry = &rec->retired[i];
+        bool                               safe  = false;
+
+        if (reclaim->mode == EASEDS_RECLAIM_EBR) {
+            safe = entry->epoch + 2 <= epoch;
+        } else {
+            uintptr_t key = (uintptr_t)entry->ptr;
+            safe          = nhazard == 0
+                   || bsearch(&key, hazards, nhazard, sizeof(key), reclaim_hazard_cmp) == NULL;
+        }
+
+        if (safe) {
+            reclaim_free_entry(reclaim, entry);
+        } else {
+            rec->retired[keep++] = *entry;
+        }
+    }
+
+    uint64_t freed = rec->count - keep;
+    __easeds_free(hazards);
+    rec->count = keep;
+    rec->limit = keep + (uint32_t)window;
+    __atomic_store_n(&rec->frees, rec->frees + freed, __ATOMIC_RELAXED);
+    return freed;
+}
+
+// 创建回收域, mode 为 EASEDS_RECLAIM_EBR 或 EASEDS_RECLAIM_HP, allocator 为NULL时使用 __easeds_free
+struct easeds_reclaim *easeds_reclaim_create(
+    const char *name, uint32_t mode, const struct easeds_allocator *allocator)
+{
+    if (unlikely(mode != EASEDS_RECLAIM_EBR && mode != EASEDS_RECLAIM_HP)) {
+        EASEDS_ERR("[easeds_reclaim_create]: Invalid reclaim mode %u.", mode);
+        return NULL;
+    }
+
+    struct easeds_reclaim *reclaim = __easeds_aligned_alloc(
+        EASEDS_CACHE_LINE_SIZE, RECLAIM_ALLOC_SIZE(struct easeds_reclaim));
+    if (unlikely(reclaim == NULL)) {
+        EASEDS_ERR("[easeds_reclaim_create]: Malloc reclaim domain failed.");
+        return NULL;
+    }
+
+    memset(reclaim, 0, sizeof(struct easeds_reclaim));
+    if (unlikely(pthread_key_create(&reclaim->key, reclaim_record_destructor) != 0)) {
+        EASEDS_ERR("[easeds_reclaim_create]: Create thread specific key failed.");
+        __easeds_free(reclaim);
+        return NULL;
+    }
+
+    reclaim->name      = name;
+    reclaim->mode      = mode;
+    reclaim->allocator = allocator;
+    reclaim->epoch     = 1;
+    pthread_mutex_init(&reclaim->lock, NULL);
+
+    PFL_DEBUG("[easeds_reclaim_create]: name=%s, mode=%s.", name != NULL ? name : "(null)",
+        mode == EASEDS_RECLAIM_EBR ? "ebr" : "hp");
+    return reclaim;
+}
+
+// 销毁回收域, 释放所有退休对象和线程记录, 调用时不能有其他线程访问
+void easeds_reclaim_destroy(struct easeds_reclaim *reclaim)
+{
+    if (unlikely(reclaim == NULL)) {
+        return;
+    }
+
+    /* 先清除当前线程的私有数据, 再删除键, 其他线程退出时不会再调用析构函数 */
+    pthread_setspecific(reclaim->key, NULL);
+    pthread_key_delete(reclaim->key);
+
+    struct easeds_reclaim_record *rec = reclaim->records;
+    while (rec != NULL) {
+        struct easeds_reclaim_record *next = rec->next;
+        for (uint32_t i = 0; i < rec->count; i++) {
+            reclaim_free_entry(reclaim, &rec->retired[i]);
+        }
+        __easeds_free(rec->retired);
+        __easeds_free(rec);
+        rec = next;
+    }
+
+    for (uint32_t i = 0; i < reclaim->orphan_count; i++) {
+        reclaim_free_entry(reclaim, &reclaim->orphans[i]);
+    }
+    __easeds_free(reclaim->orphans);
+
+    pthread_mutex_destroy(&reclaim->lock);
+    __easeds_free(reclaim);
+}
+
+// 进入读端临界区, 可以嵌套, 成功返回0, 失败返回-1
+int32_t easeds_reclaim_enter(struct easeds_reclaim *reclaim)
+{
+    if (unlikely(reclaim == NULL)) {
+        EASEDS_ERR("[easeds_reclaim_enter]: Invalid reclaim pointer.");
+        return -1;
+    }
+
+    struct easeds_reclaim_record *rec = reclaim_record(reclaim);
+    if (unlikely(rec == NULL)) {
+        return -1;
+    }
+
+    if (rec->nest++ == 0 && reclaim->mode == EASEDS_RECLAIM_EBR) {
+        uint64_t epoch = __atomic_load_n(&reclaim->epoch, __ATOMIC_RELAXED);
+        __atomic_store_n(&rec->epoch, (epoch << 1) | 1, __ATOMIC_RELAXED);
+        /* 发布纪元之后才能读取共享结构 */
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    }
+    return 0;
+}
+
+// 退出读端临界区, 最外层退出时 HP 模式清除当前线程的所有风险指针
+void easeds_reclaim_exit(struct easeds_reclaim *reclaim)
+{
+    if (unlikely(reclaim == NULL)) {
+        return;
+    }
+
+    struct easeds_reclaim_record *rec = pthread_getspecific(reclaim->key);
+    if (unlikely(rec == NULL || rec->nest == 0)) {
+        EASEDS_ERR("[easeds_reclaim_exit]: Exit without enter.");
+        return;
+    }
+
+    if (--rec->nest != 0) {
+        return;
+    }
+
+    if (reclaim->mode == EASEDS_RECLAIM_EBR) {
+        __atomic_store_n(&rec->epoch, 0, __ATOMIC_RELEASE);
+    } else {
+        for (uint32_t i = 0; i < EASEDS_RECLAIM_HP_SLOTS; i++) {
+            __atomic_store_n(&rec->hazards[i], NULL, __ATOMIC_RELEASE);
+        }
+    }
+}
+
+// 读取 *src 并保护读到的对象, 必须在临界区内调用, HP 模式下 slot 小于 EASEDS_RECLAIM_HP_SLOTS
+void *easeds_reclaim_protect(struct easeds_reclaim *reclaim, uint32_t slot, void *const *src)
+{
+    if (unlikely(reclaim == NULL || src == NULL || slot >= EASEDS_RECLAIM_HP_SLOTS)) {
+        EASEDS_ERR("[easeds_reclaim_protect]: Invalid reclaim, source pointer or slot %u.", slot);
+        return NULL;
+    }
+
+    /* EBR 模式下临界区已经保护了所有对象 */
+    if (reclaim->mode == EASEDS_RECLAIM_EBR) {
+        return __atomic_load_n(src, __ATOMIC_ACQUIRE);
+    }
+
+    struct easeds_reclaim_record *rec = reclaim_record(reclaim);
+    if (unlikely(rec == NULL)) {
+        return NULL;
+    }
+
+    /* 发布后重新读取, 指针没有变化说明发布时对象仍在结构中, 回收扫描一定能看到该风险指针 */
+    void *ptr = __atomic_load_n(src, __ATOMIC_RELAXED);
+    while (true) {
+        __atomic_store_n(&rec->hazards[slot], ptr, __ATOMIC_RELAXED);
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+        void *again = __atomic_load_n(src, __ATOMIC_ACQUIRE);
+        if (likely(again == ptr)) {
+            return ptr;
+        }
+        ptr = again;
+    }
+}
+
+// 清除 slot 号风险指针, 之后该槽位保护的对象可以被回收, EBR 模式下不做任何操作
+void easeds_reclaim_unprotect(struct easeds_reclaim *reclaim, uint32_t slot)
+{
+    if (unlikely(reclaim == NULL || slot >= EASEDS_RECLAIM_HP_SLOTS)) {
+        EASEDS_ERR("[easeds_reclaim_unprotect]: Invalid reclaim pointer or slot %u.", slot);
+        return;
+    }
+
+    if (reclaim->mode == EASEDS_RECLAIM_EBR) {
+        return;
+    }
+
+    struct easeds_reclaim_record *rec = pthread_getspecific(reclaim->key);
+    if (likely(rec != NULL)) {
+        __atomic_store_n(&rec->hazards[slot], NULL, __ATOMIC_RELEASE);
+    }
+}
+
+// 退休一个已从共享结构中摘除的对象, size 传给分配器的 free_fn, 成功返回0, 失败返回-1
+int32_t easeds_reclaim_retire(struct easeds_reclaim *reclaim, void *ptr, uint64_t size)
+{
+    if (unlikely(reclaim == NULL || ptr == NULL)) {
+        EASEDS_ERR("[easeds_reclaim_retire]: Invalid reclaim or object pointer.");
+        return -1;
+    }
+
+    struct easeds_reclaim_record *rec = reclaim_record(reclaim);
+    if (unlikely(rec == NULL
+                 || reclaim_entries_reserve(&rec->retired, &rec->capacity, (uint64_t)rec->count + 1)
+                        != 0)) {
+        return -1;
+    }
+
+    /* 摘除发生在读取纪元之前, 之后进入临界区的线程不可能再看到该对象 */
+    struct easeds_reclaim_entry *entry = &rec->retired[rec->count++];
+    entry->ptr                         = ptr;
+    entry->size                        = size;
+    entry->epoch                       = __atomic_load_n(&reclaim->epoch, __ATOMIC_SEQ_CST);
+    __atomic_store_n(&rec->retires, rec->retires + 1, __ATOMIC_RELAXED);
+
+    if (unlikely(rec->count >= rec->limit)) {
+        reclaim_collect(reclaim, rec);
+    }
+    return 0;
+}
+
+// 尝试回收当前线程退休列表中的对象, 返回释放的对象数量
+uint64_t easeds_reclaim_poll(struct easeds_reclaim *reclaim)
+{
+    if (unlikely(reclaim == NULL)) {
+        EASEDS_ERR("[easeds_reclaim_poll]: Invalid reclaim pointer.");
+        return 0;
+    }
+
+    struct easeds_reclaim_record *rec = reclaim_record(reclaim);
+    if (unlikely(rec == NULL)) {
+        return 0;
+    }
+
+    return reclaim_collect(reclaim, rec);
+}
+
+// 等待并释放当前线程退休的所有对象, 不能在临界区内调用, 其他线程长时间停在临界区内时会一直等待
+void easeds_reclaim_flush(struct easeds_reclaim *reclaim)
+{
+    if (unlikely(reclaim == NULL)) {
+        EASEDS_ERR("[easeds_reclaim_flush]: Invalid reclaim pointer.");
+        return;
+    }
+
+    struct easeds_reclaim_record *rec = reclaim_record(reclaim);
+    if (unlikely(rec == NULL || rec->nest != 0)) {
+        EASEDS_ERR("[easeds_reclaim_flush]: Flush inside critical section would never finish.");
+        return;
+    }
+
+    reclaim_collect(reclaim, rec);
+    while (rec->count != 0) {
+        sched_yield();
+        reclaim_collect(reclaim, rec);
+    }
+}
+
+// 获取统计信息
+void easeds_reclaim_stats(struct easeds_reclaim *reclaim, struct easeds_reclaim_stats *stats)
+{
+    if (unlikely(reclaim == NULL || stats == NULL)) {
+        return;
+    }
+
+    memset(stats, 0, sizeof(struct easeds_reclaim_stats));
+    for (struct easeds_reclaim_record *rec = __atomic_load_n(&reclaim->records, __ATOMIC_ACQUIRE);
+         rec != NULL; rec = rec->next) {
+        stats->records++;
+        stats->retires += __atomic_load_n(&rec->retires, __ATOMIC_RELAXED);
+        stats->frees += __atomic_load_n(&rec->frees, __ATOMIC_RELAXED);
+    }
+
+    stats->threads = __atomic_load_n(&reclaim->threads, __ATOMIC_RELAXED);
+    stats->epoch   = __atomic_load_n(&reclaim->epoch, __ATOMIC_RELAXED);
+    stats->scans   = __atomic_load_n(&reclaim->scans, __ATOMIC_RELAXED);
+    stats->pending = stats->retires - stats->frees;
+}
@@ -0,0 +1,169 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-reclaim.h
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-18 22:25
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  无锁结构的安全内存回收, 提供基于纪元的回收(EBR)和风险指针(Hazard Pointer)两种模式.
+ *
+ * @History:
+ *  2026年10月18日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#ifndef __EASEDS_RECLAIM_H__
+#define __EASEDS_RECLAIM_H__
+
+/* C 标准库头文件 */
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/* 项目内部头文件 */
+#include "easeds-environment.h"
+#include "easeds-public.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 回收模式 */
+#define EASEDS_RECLAIM_EBR 0 /* 基于纪元的回收, 读端开销最小, 停在临界区内的线程会阻止所有回收 */
+#define EASEDS_RECLAIM_HP  1 /* 风险指针, 每次访问都要发布指针, 未回收的对象数量有上界 */
+
+/* 每个线程的风险指针槽位数量 */
+#define EASEDS_RECLAIM_HP_SLOTS 4
+
+/* 退休列表达到该数量时尝试批量回收 */
+#define EASEDS_RECLAIM_BATCH 64
+
+/* 退休对象, 等待没有线程可能访问后释放 */
+struct easeds_reclaim_entry {
+    void    *ptr;   /* 对象地址 */
+    uint64_t size;  /* 对象大小, 传给分配器的 free_fn */
+    uint64_t epoch; /* 退休时的全局纪元, 仅 EBR 模式使用 */
+};
+
+/**
+ * 线程记录, 每个线程每个回收域一个, 占用两个缓存行:
+ *  (1) 第一个缓存行是其他线程扫描时读取的字段: 纪元和风险指针.
+ *  (2) 第二个缓存行是只被所属线程访问的退休列表和计数.
+ *  (3) 线程退出后记录不释放, 标记为空闲供新线程复用, 扫描线程可以无锁遍历记录链表.
+ */
+struct easeds_reclaim_record {
+    uint64_t                      epoch;   /* 临界区内为 (纪元 << 1) | 1, 临界区外为0 */
+    uint32_t                      in_use;  /* 是否被线程占用 */
+    uint32_t                      nest;    /* 临界区嵌套层数 */
+    void                         *hazards[EASEDS_RECLAIM_HP_SLOTS]; /* 风险指针 */
+    struct easeds_reclaim_record *next;    /* 记录链表 */
+    struct easeds_reclaim        *domain;  /* 所属回收域, 线程退出时使用 */
+    struct easeds_reclaim_entry  *retired; /* 退休列表 */
+    uint32_t                      count;   /* 退休列表中的对象数量 */
+    uint32_t                      capacity; /* 退休列表容量 */
+    uint32_t                      limit;    /* 下一次尝试回收时的对象数量 */
+    uint32_t                      pad0;     /* 对齐填充 */
+    uint64_t                      retires;  /* 退休的对象数量 */
+    uint64_t                      frees;    /* 释放的对象数量 */
+    uint8_t                       pad1[EASEDS_CACHE_LINE_SIZE - 40]; /* 缓存行填充 */
+};
+
+/* 回收域统计信息 */
+struct easeds_reclaim_stats {
+    uint64_t threads; /* 占用线程记录的线程数量 */
+    uint64_t records; /* 线程记录数量, 包含空闲记录 */
+    uint64_t epoch;   /* 全局纪元 */
+    uint64_t retires; /* 退休的对象数量 */
+    uint64_t frees;   /* 释放的对象数量 */
+    uint64_t pending; /* 等待释放的对象数量, 包含已退出线程留下的对象 */
+    uint64_t scans;   /* 扫描所有线程记录的次数 */
+};
+
+/**
+ * 实现无锁数据结构的安全内存回收, 解决"摘除的节点可能仍被其他线程读取, 何时可以释放"的问题.
+ *  (1) 读者访问共享结构前调用 easeds_reclaim_enter, 结束后调用 easeds_reclaim_exit, 可以嵌套.
+ *      写者把节点从结构中摘除后调用 easeds_reclaim_retire, 节点进入当前线程的退休列表, 延迟释放.
+ *  (2) EBR 模式: 进入临界区时记录全局纪元, 所有临界区内的线程都已看到当前纪元时全局纪元加一,
+ *      纪元 e 退休的对象在全局纪元达到 e + 2 后释放. 读取共享指针只是一次 acquire 加载.
+ *  (3) HP 模式: 读取共享指针通过 easeds_reclaim_protect 发布到风险指针槽位, 回收时扫描所有线程的
+ *      风险指针, 只释放没有被发布的对象. 每个线程未释放的对象不超过 H + max(批量, H), H 为风险指针槽位总数.
+ *  (4) 退休列表达到 EASEDS_RECLAIM_BATCH 时批量回收, 回收不掉的对象留在列表中, 下次列表再增长
+ *      一个批量时重试; 线程退出时未释放的对象移交给回收域, 由其他线程回收时接管.
+ *  (5) 对象通过 struct easeds_allocator 的 free_fn 释放, 创建时未指定分配器则使用 __easeds_free;
+ *      释放发生在调用 retire/poll/flush 的线程中, 分配器的 free_fn 必须是线程安全的.
+ *  (6) 线程记录通过 pthread 线程私有数据查找; 除创建和销毁外所有接口都是线程安全的.
+ */
+struct easeds_reclaim {
+    uint64_t                       epoch;   /* 全局纪元 */
+    uint8_t                        pad0[EASEDS_CACHE_LINE_SIZE - 8]; /* 缓存行填充 */
+    const char                    *name;    /* 名称, 预留字段, 可用于调试和日志输出 */
+    uint32_t                       mode;    /* 回收模式, EASEDS_RECLAIM_EBR 或 EASEDS_RECLAIM_HP */
+    uint32_t                       threads; /* 占用线程记录的线程数量 */
+    const struct easeds_allocator *allocator; /* 释放对象使用的分配器, NULL 表示 __easeds_free */
+    struct easeds_reclaim_record  *records;   /* 线程记录链表, 只增不减 */
+    uint64_t                       scans;     /* 扫描所有线程记录的次数 */
+    pthread_key_t                  key;       /* 线程记录的线程私有数据键 */
+    uint32_t                       orphan_count; /* 已退出线程留下的对象数量 */
+    pthread_mutex_t                lock;         /* 保护以下字段 */
+    struct easeds_reclaim_entry   *orphans;      /* 已退出线程留下的对象 */
+    uint32_t                       orphan_capacity; /* orphans 容量 */
+    uint32_t                       pad1;            /* 对齐填充 */
+};
+
+/**
+ * 常见回收操作函数:
+ *
+ * 函数名                       功能描述
+ * ------------------------     ------------------------------------------------------
+ * easeds_reclaim_create        创建回收域, 指定模式和释放对象的分配器, 失败返回NULL
+ * easeds_reclaim_destroy       销毁回收域, 释放所有退休对象, 调用时不能有其他线程访问
+ * easeds_reclaim_enter         进入读端临界区
+ * easeds_reclaim_exit          退出读端临界区, HP 模式下清除所有风险指针
+ * easeds_reclaim_protect       安全地读取一个共享指针
+ * easeds_reclaim_unprotect     清除一个风险指针槽位
+ * easeds_reclaim_retire        退休一个已摘除的对象, 延迟释放
+ * easeds_reclaim_poll          尝试回收当前线程退休列表中的对象, 不等待
+ * easeds_reclaim_flush         等待并释放当前线程退休的所有对象
+ * easeds_reclaim_stats         获取统计信息
+ */
+
+// 创建回收域, mode 为 EASEDS_RECLAIM_EBR 或 EASEDS_RECLAIM_HP, allocator 为NULL时使用 __easeds_free
+struct easeds_reclaim *easeds_reclaim_create(
+    const char *name, uint32_t mode, const struct easeds_allocator *allocator);
+
+// 销毁回收域, 释放所有退休对象和线程记录, 调用时不能有其他线程访问
+void easeds_reclaim_destroy(struct easeds_reclaim *reclaim);
+
+// 进入读端临界区, 可以嵌套, 成功返回0, 失败返回-1
+int32_t easeds_reclaim_enter(struct easeds_reclaim *reclaim);
+
+// 退出读端临界区, 最外层退出时 HP 模式清除当前线程的所有风险指针
+void easeds_reclaim_exit(struct easeds_reclaim *reclaim);
+
+// 读取 *src 并保护读到的对象, 必须在临界区内调用, HP 模式下 slot 小于 EASEDS_RECLAIM_HP_SLOTS
+void *easeds_reclaim_protect(struct easeds_reclaim *reclaim, uint32_t slot, void *const *src);
+
+// 清除 slot 号风险指针, 之后该槽位保护的对象可以被回收, EBR 模式下不做任何操作
+void easeds_reclaim_unprotect(struct easeds_reclaim *reclaim, uint32_t slot);
+
+// 退休一个已从共享结构中摘除的对象, size 传给分配器的 free_fn, 成功返回0, 失败返回-1
+int32_t easeds_reclaim_retire(struct easeds_reclaim *reclaim, void *ptr, uint64_t size);
+
+// 尝试回收当前线程退休列表中的对象, 返回释放的对象数量
+uint64_t easeds_reclaim_poll(struct easeds_reclaim *reclaim);
+
+// 等待并释放当前线程退休的所有对象, 不能在临界区内调用, 其他线程长时间停在临界区内时会一直等待
+void easeds_reclaim_flush(struct easeds_reclaim *reclaim);
+
+// 获取统计信息
+void easeds_reclaim_stats(struct easeds_reclaim *reclaim, struct easeds_reclaim_stats *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __EASEDS_RECLAIM_H__ */
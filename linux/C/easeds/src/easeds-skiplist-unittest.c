@@ -0,0 +1,433 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-skiplist-unittest.c
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-18 22:55
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  Easeds 无锁跳表单元测试实现文件, 包含了增删查/区间遍历/层数分布/并发修改和性能测试.
+ *
+ * @History:
+ *  2026年10月18日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#include "easeds-unittest.h"
+
+// 标准库头文件
+#include <pthread.h>
+
+// 项目内部头文件
+#include "easeds-art.h"
+#include "easeds-skiplist.h"
+#include "easeds-utils.h"
+
+/* 并发测试的线程数量 */
+#define SKIPLIST_THREADS 4
+
+// 区间遍历回调上下文
+struct skiplist_range_ctx {
+    uint64_t last;   /* 上一个键 */
+    uint64_t count;  /* 遍历数量 */
+    uint64_t errors; /* 键不递增或值与键不一致的次数 */
+};
+
+// 区间遍历回调: 检查键严格递增, 值等于键加一
+static void skiplist_range_cb(uint64_t key, void *value, void *user_data)
+{
+    struct skiplist_range_ctx *ctx = user_data;
+
+    if ((ctx->count != 0 && key <= ctx->last) || (uint64_t)(uintptr_t)value != key + 1) {
+        ctx->errors++;
+    }
+    ctx->last = key;
+    ctx->count++;
+}
+
+// xorshift 随机数
+static uint64_t skiplist_rand(uint64_t *seed)
+{
+    *seed ^= *seed << 13;
+    *seed ^= *seed >> 7;
+    *seed ^= *seed << 17;
+    return *seed;
+}
+
+// 基本功能测试: 插入/查找/覆盖/删除
+static void test_easeds_skiplist_basic(void **state)
+{
+    easeds_unused(state);
+
+    struct easeds_skiplist *list = easeds_skiplist_create("test");
+    assert_non_null(list);
+    assert_int_equal(easeds_skiplist_size(list), 0);
+    assert_int_equal(easeds_skiplist_find(list, 1, NULL), -1);
+
+    for (uint64_t key = 0; key < 1000; key++) {
+        assert_int_equal(easeds_skiplist_insert(list, key * 7 % 1000, (void *)(uintptr_t)key), 0);
+    }
+    assert_int_equal(easeds_skiplist_size(list), 1000);
+    assert_int_equal(easeds_skiplist_verify(list), 0);
+
+    for (uint64_t key = 0; key < 1000; key++) {
+        void *value = NULL;
+        assert_int_equal(easeds_skiplist_find(list, key * 7 % 1000, &value), 0);
+        assert_ptr_equal(value, (void *)(uintptr_t)key);
+    }
+    assert_int_equal(easeds_skiplist_find(list, 1000, NULL), -1);
+
+    /* 覆盖旧值不改变数量 */
+    void *value = NULL;
+    assert_int_equal(easeds_skiplist_insert(list, 500, (void *)(uintptr_t)12345), 0);
+    assert_int_equal(easeds_skiplist_size(list), 1000);
+    assert_int_equal(easeds_skiplist_find(list, 500, &value), 0);
+    assert_ptr_equal(value, (void *)(uintptr_t)12345);
+
+    for (uint64_t key = 0; key < 1000; key += 2) {
+        assert_int_equal(easeds_skiplist_remove(list, key, NULL), 0);
+        assert_int_equal(easeds_skiplist_remove(list, key, NULL), -1);
+    }
+    assert_int_equal(easeds_skiplist_size(list), 500);
+    assert_int_equal(easeds_skiplist_verify(list), 0);
+    for (uint64_t key = 0; key < 1000; key++) {
+        assert_int_equal(easeds_skiplist_find(list, key, NULL), key % 2 == 0 ? -1 : 0);
+    }
+
+    assert_int_equal(easeds_skiplist_remove(list, 1, &value), 0);
+    assert_ptr_equal(value, (void *)(uintptr_t)143);
+    easeds_skiplist_destroy(list);
+}
+
+// 操作测试: 随机操作与位图对照, 区间遍历和层数分布
+static void test_easeds_skiplist_operations(void **state)
+{
+    easeds_unused(state);
+
+    const uint64_t          space   = 4096;
+    uint8_t                *present = calloc(space, 1);
+    uint64_t                seed    = 88172645463325252ULL;
+    uint64_t                size    = 0;
+    struct easeds_skiplist *list    = easeds_skiplist_create("test");
+    assert_non_null(list);
+    assert_non_null(present);
+
+    for (uint32_t i = 0; i < 100000; i++) {
+        uint64_t r   = skiplist_rand(&seed);
+        uint64_t key = (r >> 8) % space;
+        if ((r & 3) != 0) {
+            assert_int_equal(easeds_skiplist_insert(list, key, (void *)(uintptr_t)(key + 1)), 0);
+            size += present[key] ? 0 : 1;
+            present[key] = 1;
+        } else {
+            void *value = NULL;
+            assert_int_equal(easeds_skiplist_remove(list, key, &value), present[key] ? 0 : -1);
+            if (present[key]) {
+                assert_ptr_equal(value, (void *)(uintptr_t)(key + 1));
+                size--;
+            }
+            present[key] = 0;
+        }
+    }
+    assert_int_equal(easeds_skiplist_size(list), size);
+    assert_int_equal(easeds_skiplist_verify(list), 0);
+
+    /* 区间遍历按升序返回区间内的全部键 */
+    for (uint32_t i = 0; i < 100; i++) {
+        uint64_t low      = skiplist_rand(&seed) % space;
+        uint64_t high     = low + skiplist_rand(&seed) % 256;
+        uint64_t expected = 0;
+        for (uint64_t key = low; key <= high && key < space; key++) {
+            expected += present[key];
+        }
+
+        struct skiplist_range_ctx ctx = {0};
+        assert_int_equal(easeds_skiplist_range(list, low, high, skiplist_range_cb, &ctx), expected);
+        assert_int_equal(ctx.count, expected);
+        assert_int_equal(ctx.errors, 0);
+    }
+
+    /* 层数分布: 总数等于键数量, 晋升概率 1/4, 第一层约占 3/4 */
+    struct easeds_skiplist_stats stats;
+    easeds_skiplist_stats(list, &stats);
+    uint64_t total = 0;
+    for (uint32_t level = 0; level < EASEDS_SKIPLIST_MAX_LEVEL; level++) {
+        total += stats.levels[level];
+        if (stats.levels[level] != 0) {
+            assert_true(level < stats.max_level);
+        }
+    }
+    assert_int_equal(total, size);
+    assert_int_equal(stats.size, size);
+    assert_true(stats.levels[0] * 10 > size * 6 && stats.levels[0] * 10 < size * 9);
+    assert_true(stats.levels[1] > stats.levels[2]);
+
+    easeds_skiplist_destroy(list);
+    free(present);
+}
+
+// 边界测试: 极值键, 空表和空区间
+static void test_easeds_skiplist_boundary(void **state)
+{
+    easeds_unused(state);
+
+    struct easeds_skiplist   *list = easeds_skiplist_create(NULL);
+    struct skiplist_range_ctx ctx  = {0};
+    assert_non_null(list);
+
+    /* 空表 */
+    assert_int_equal(easeds_skiplist_range(list, 0, UINT64_MAX, skiplist_range_cb, &ctx), 0);
+    assert_int_equal(easeds_skiplist_remove(list, 0, NULL), -1);
+    assert_int_equal(easeds_skiplist_verify(list), 0);
+
+    /* 极值键 */
+    assert_int_equal(easeds_skiplist_insert(list, 0, (void *)(uintptr_t)1), 0);
+    assert_int_equal(easeds_skiplist_insert(list, UINT64_MAX, (void *)(uintptr_t)0), 0);
+    assert_int_equal(easeds_skiplist_find(list, 0, NULL), 0);
+    assert_int_equal(easeds_skiplist_find(list, UINT64_MAX, NULL), 0);
+    assert_int_equal(easeds_skiplist_find(list, UINT64_MAX - 1, NULL), -1);
+
+    /* UINT64_MAX 的值为 0 = key + 1 回绕 */
+    memset(&ctx, 0, sizeof(ctx));
+    assert_int_equal(easeds_skiplist_range(list, 0, UINT64_MAX, skiplist_range_cb, &ctx), 2);
+    assert_int_equal(ctx.errors, 0);
+    assert_int_equal(ctx.last, UINT64_MAX);
+
+    /* 单点区间和反向区间 */
+    memset(&ctx, 0, sizeof(ctx));
+    assert_int_equal(easeds_skiplist_range(list, 0, 0, skiplist_range_cb, &ctx), 1);
+    assert_int_equal(easeds_skiplist_range(list, 1, UINT64_MAX - 1, skiplist_range_cb, &ctx), 0);
+    assert_int_equal(easeds_skiplist_range(list, UINT64_MAX, 0, skiplist_range_cb, &ctx), 0);
+
+    /* 删除后重新插入同一个键 */
+    for (uint32_t i = 0; i < 1000; i++) {
+        assert_int_equal(easeds_skiplist_remove(list, UINT64_MAX, NULL), 0);
+        assert_int_equal(easeds_skiplist_insert(list, UINT64_MAX, (void *)(uintptr_t)0), 0);
+    }
+    assert_int_equal(easeds_skiplist_size(list), 2);
+    assert_int_equal(easeds_skiplist_verify(list), 0);
+
+    struct easeds_skiplist_stats stats;
+    easeds_skiplist_stats(list, &stats);
+    assert_int_equal(stats.size, 2);
+    assert_true(stats.memory >= 2 * (sizeof(struct easeds_skiplist_node) + sizeof(void *)));
+    assert_true(stats.max_level >= 1 && stats.max_level <= EASEDS_SKIPLIST_MAX_LEVEL);
+    easeds_skiplist_destroy(list);
+}
+
+// 错误处理测试: 空指针参数
+static void test_easeds_skiplist_error(void **state)
+{
+    easeds_unused(state);
+
+    struct easeds_skiplist_stats stats;
+    void                        *value = NULL;
+
+    easeds_skiplist_destroy(NULL);
+    assert_int_equal(easeds_skiplist_size(NULL), 0);
+    assert_int_equal(easeds_skiplist_insert(NULL, 1, NULL), -1);
+    assert_int_equal(easeds_skiplist_remove(NULL, 1, &value), -1);
+    assert_int_equal(easeds_skiplist_find(NULL, 1, &value), -1);
+    assert_int_equal(easeds_skiplist_range(NULL, 0, 1, skiplist_range_cb, NULL), 0);
+    assert_int_equal(easeds_skiplist_verify(NULL), -1);
+    easeds_skiplist_stats(NULL, &stats);
+
+    struct easeds_skiplist *list = easeds_skiplist_create("test");
+    assert_non_null(list);
+    assert_int_equal(easeds_skiplist_range(list, 0, 1, NULL, NULL), 0);
+    easeds_skiplist_stats(list, NULL);
+    easeds_skiplist_destroy(list);
+}
+
+// 并发测试上下文
+struct skiplist_stress_ctx {
+    struct easeds_skiplist *list;    /* 跳表 */
+    uint64_t                space;   /* 键空间大小 */
+    uint64_t                ops;     /* 每个线程的操作次数 */
+    uint32_t                shared;  /* 是否所有线程操作同一组键 */
+    uint32_t                id;      /* 线程编号分配 */
+    uint64_t                errors;  /* 结果与预期不一致的次数 */
+    uint64_t                present; /* 私有键模式下各线程结束时存在的键数量 */
+};
+
+// 并发测试线程: 私有键模式下每个线程只修改 key % 线程数 == id 的键, 可以精确检查结果;
+// 共享键模式下所有线程争用同一组键, 只检查值和键一致, 同时做区间遍历检查顺序
+static void *skiplist_stress_fn(void *arg)
+{
+    struct skiplist_stress_ctx *ctx     = arg;
+    uint32_t                    id      = __atomic_fetch_add(&ctx->id, 1, __ATOMIC_RELAXED);
+    uint64_t                    seed    = 88172645463325252ULL + id;
+    uint64_t                    errors  = 0;
+    uint8_t                    *present = calloc(ctx->space, 1);
+
+    for (uint64_t i = 0; i < ctx->ops; i++) {
+        uint64_t r   = skiplist_rand(&seed);
+        uint64_t key = (r >> 8) % ctx->space;
+        if (!ctx->shared) {
+            key = key - key % SKIPLIST_THREADS + id;
+            if (key >= ctx->space) {
+                continue;
+            }
+        }
+
+        void   *value = NULL;
+        int32_t ret;
+        switch (r & 7) {
+        case 0:
+        case 1:
+            ret = easeds_skiplist_remove(ctx->list, key, &value);
+            if ((ret == 0 && value != (void *)(uintptr_t)(key + 1))
+                || (!ctx->shared && ret != (present[key] ? 0 : -1))) {
+                errors++;
+            }
+            present[key] = 0;
+            break;
+        case 2:
+        case 3:
+            ret = easeds_skiplist_insert(ctx->list, key, (void *)(uintptr_t)(key + 1));
+            errors += ret != 0;
+            present[key] = 1;
+            break;
+        case 7: {
+            struct skiplist_range_ctx range = {0};
+            easeds_skiplist_range(ctx->list, key, key + 64, skiplist_range_cb, &range);
+            errors += range.errors;
+            break;
+        }
+        default:
+            ret = easeds_skiplist_find(ctx->list, key, &value);
+            if ((ret == 0 && value != (void *)(uintptr_t)(key + 1))
+                || (!ctx->shared && ret != (present[key] ? 0 : -1))) {
+                errors++;
+            }
+            break;
+        }
+    }
+
+    uint64_t count = 0;
+    for (uint64_t key = 0; key < ctx->space; key++) {
+        count += present[key];
+    }
+    __atomic_add_fetch(&ctx->present, count, __ATOMIC_RELAXED);
+    __atomic_add_fetch(&ctx->errors, errors, __ATOMIC_RELAXED);
+    free(present);
+    return NULL;
+}
+
+// 运行一轮并发测试, 返回每次操作的平均耗时
+static double skiplist_stress_run(struct skiplist_stress_ctx *ctx)
+{
+    pthread_t threads[SKIPLIST_THREADS];
+
+    int64_t start = easeds_get_current_time_ns();
+    for (uint32_t t = 0; t < SKIPLIST_THREADS; t++) {
+        assert_int_equal(pthread_create(&threads[t], NULL, skiplist_stress_fn, ctx), 0);
+    }
+    for (uint32_t t = 0; t < SKIPLIST_THREADS; t++) {
+        pthread_join(threads[t], NULL);
+    }
+    return (double)(easeds_get_current_time_ns() - start)
+           / (double)(ctx->ops * SKIPLIST_THREADS);
+}
+
+// 性能测试: 单线程与自适应基数树对比, 多线程私有键和共享键并发修改
+static void test_easeds_skiplist_perf(void **state)
+{
+    easeds_unused(state);
+
+    const uint64_t          count = 1000000;
+    uint64_t                seed  = 88172645463325252ULL;
+    uint64_t               *keys  = malloc(count * sizeof(uint64_t));
+    struct easeds_skiplist *list  = easeds_skiplist_create("perf");
+    struct easeds_art      *tree  = easeds_art_create("perf");
+    assert_non_null(keys);
+    assert_non_null(list);
+    assert_non_null(tree);
+
+    for (uint64_t i = 0; i < count; i++) {
+        keys[i] = skiplist_rand(&seed);
+    }
+
+    int64_t start = easeds_get_current_time_ns();
+    for (uint64_t i = 0; i < count; i++) {
+        easeds_skiplist_insert(list, keys[i], (void *)(uintptr_t)(keys[i] + 1));
+    }
+    double insert_ns = (double)(easeds_get_current_time_ns() - start) / (double)count;
+
+    start = easeds_get_current_time_ns();
+    for (uint64_t i = 0; i < count; i++) {
+        assert_int_equal(easeds_skiplist_find(list, keys[i], NULL), 0);
+    }
+    double find_ns = (double)(easeds_get_current_time_ns() - start) / (double)count;
+
+    for (uint64_t i = 0; i < count; i++) {
+        easeds_art_insert(tree, keys[i], (void *)(uintptr_t)(keys[i] + 1));
+    }
+    start = easeds_get_current_time_ns();
+    for (uint64_t i = 0; i < count; i++) {
+        assert_int_equal(easeds_art_find(tree, keys[i], NULL), 0);
+    }
+    double art_ns = (double)(easeds_get_current_time_ns() - start) / (double)count;
+
+    struct skiplist_range_ctx range = {0};
+    start = easeds_get_current_time_ns();
+    assert_int_equal(easeds_skiplist_range(list, 0, UINT64_MAX, skiplist_range_cb, &range), count);
+    double range_ns = (double)(easeds_get_current_time_ns() - start) / (double)count;
+    assert_int_equal(range.errors, 0);
+    assert_int_equal(easeds_skiplist_verify(list), 0);
+
+    struct easeds_skiplist_stats stats;
+    easeds_skiplist_stats(list, &stats);
+    MEASURE("[skiplist perf]: %lu keys, insert %.1f ns/op, find %.1f ns/op (art %.1f ns/op), "
+            "range %.1f ns/key, memory %.1f bytes/key.",
+        count, insert_ns, find_ns, art_ns, range_ns, (double)stats.memory / (double)count);
+    MEASURE("[skiplist perf]: max level %lu, levels 1-6: %lu %lu %lu %lu %lu %lu.",
+        stats.max_level, stats.levels[0], stats.levels[1], stats.levels[2], stats.levels[3],
+        stats.levels[4], stats.levels[5]);
+
+    start = easeds_get_current_time_ns();
+    for (uint64_t i = 0; i < count; i++) {
+        easeds_skiplist_remove(list, keys[i], NULL);
+    }
+    double remove_ns = (double)(easeds_get_current_time_ns() - start) / (double)count;
+    assert_int_equal(easeds_skiplist_size(list), 0);
+    MEASURE("[skiplist perf]: remove %.1f ns/op.", remove_ns);
+
+    easeds_art_destroy(tree);
+    easeds_skiplist_destroy(list);
+    free(keys);
+
+    /* 私有键: 每个线程的结果可以精确检查, 结束后数量等于各线程存在的键之和 */
+    for (uint32_t shared = 0; shared <= 1; shared++) {
+        struct skiplist_stress_ctx ctx = {
+            .space  = shared ? 256 : 65536,
+            .ops    = 500000,
+            .shared = shared,
+        };
+        ctx.list  = easeds_skiplist_create("stress");
+        double ns = skiplist_stress_run(&ctx);
+        assert_int_equal(ctx.errors, 0);
+        assert_int_equal(easeds_skiplist_verify(ctx.list), 0);
+        if (!shared) {
+            assert_int_equal(easeds_skiplist_size(ctx.list), ctx.present);
+        }
+
+        easeds_skiplist_stats(ctx.list, &stats);
+        MEASURE("[skiplist perf]: %u threads, %s keys, %.1f ns/op, size %lu, retries %lu.",
+            SKIPLIST_THREADS, shared ? "shared" : "private", ns, stats.size, stats.retries);
+        easeds_skiplist_destroy(ctx.list);
+    }
+}
+
+// 注册单元测试用例
+EASEDS_UNITTEST_REGISTER(easeds_unittest_skiplist){
+    cmocka_unit_test(test_easeds_skiplist_basic),
+    cmocka_unit_test(test_easeds_skiplist_operations),
+    cmocka_unit_test(test_easeds_skiplist_boundary),
+    cmocka_unit_test(test_easeds_skiplist_error),
+    cmocka_unit_test(test_easeds_skiplist_perf),
+    easeds_unit_test_end,
+};
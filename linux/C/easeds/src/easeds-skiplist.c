@@ -0,0 +1,552 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-skiplist.c
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-18 22:55
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  无锁并发跳表实现文件.
+ *
+ * @History:
+ *  2026年10月18日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#include "easeds-skiplist.h"
+
+// 标准库头文件
+#include <stdlib.h>
+#include <string.h>
+
+// 项目内部头文件
+#include "easeds-log.h"
+#include "easeds-utils.h"
+
+/* 跳表结构体按缓存行对齐分配, 大小向上取整 */
+#define SKIPLIST_ALLOC_SIZE                                         \
+    ((sizeof(struct easeds_skiplist) + EASEDS_CACHE_LINE_SIZE - 1) \
+        & ~(size_t)(EASEDS_CACHE_LINE_SIZE - 1))
+
+/* 层数为 level 的节点大小 */
+#define SKIPLIST_NODE_SIZE(level) \
+    (sizeof(struct easeds_skiplist_node) + (level) * sizeof(struct easeds_skiplist_node *))
+
+/* 每个线程的随机数状态, 0 表示尚未初始化 */
+static EASEDS_THREAD_DEFINE(uint64_t, easeds_skiplist_seed) = 0;
+
+// 判断 next 指针是否带删除标记
+static inline bool skiplist_is_marked(struct easeds_skiplist_node *next)
+{
+    return ((uintptr_t)next & 1) != 0;
+}
+
+// 去掉 next 指针的删除标记
+static inline struct easeds_skiplist_node *skiplist_unmark(struct easeds_skiplist_node *next)
+{
+    return (struct easeds_skiplist_node *)((uintptr_t)next & ~(uintptr_t)1);
+}
+
+// 给 next 指针加上删除标记
+static inline struct easeds_skiplist_node *skiplist_mark(struct easeds_skiplist_node *next)
+{
+    return (struct easeds_skiplist_node *)((uintptr_t)next | 1);
+}
+
+// 用线程私有的 xorshift 随机数生成节点层数, 每层晋升概率 1/4
+static uint32_t skiplist_random_level(void)
+{
+    uint64_t x = EASEDS_THREAD_VAR(easeds_skiplist_seed);
+    if (unlikely(x == 0)) {
+        /* 首次使用时用时间和线程私有变量地址初始化, 不同线程的序列互不相同 */
+        x = (uint64_t)easeds_get_current_time_ns()
+            ^ (uint64_t)(uintptr_t)&EASEDS_THREAD_VAR(easeds_skiplist_seed);
+        x |= 1;
+    }
+
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    EASEDS_THREAD_VAR(easeds_skiplist_seed) = x;
+
+    /* 每两个连续的低位 0 晋升一层, 预先置位的高位限制最高层数 */
+    x |= 1ULL << (2 * (EASEDS_SKIPLIST_MAX_LEVEL - 1));
+    return 1 + (uint32_t)__builtin_ctzll(x) / 2;
+}
+
+// 提升跳表的最高层数, 必须在节点链接到新的层之前完成, 查找才能从足够高的层开始
+static void skiplist_raise_level(struct easeds_skiplist *list, uint32_t level)
+{
+    uint32_t top = __atomic_load_n(&list->max_level, __ATOMIC_SEQ_CST);
+    while (top < level) {
+        if (__atomic_compare_exchange_n(
+                &list->max_level, &top, level, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST)) {
+            break;
+        }
+    }
+}
+
+// 一次自顶向下的查找, 记录每层最后一个键小于 key 的节点和它的后继, 沿途摘除已标记的节点,
+// 摘除失败说明前驱已被修改, 返回 false, 需要从头重新查找
+static bool skiplist_find_once(struct easeds_skiplist *list, uint64_t key,
+    struct easeds_skiplist_node **preds, struct easeds_skiplist_node **succs)
+{
+    uint32_t                     top  = __atomic_load_n(&list->max_level, __ATOMIC_SEQ_CST);
+    struct easeds_skiplist_node *pred = list->head;
+
+    /* 高于最高层数的层还没有节点, 插入时在头节点上 CAS 失败会重新查找 */
+    for (uint32_t level = top; level < EASEDS_SKIPLIST_MAX_LEVEL; level++) {
+        preds[level] = pred;
+        succs[level] = NULL;
+    }
+
+    for (uint32_t level = top; level-- > 0;) {
+        struct easeds_skiplist_node *curr =
+            skiplist_unmark(__atomic_load_n(&pred->next[level], __ATOMIC_ACQUIRE));
+        while (curr != NULL) {
+            struct easeds_skiplist_node *succ =
+                __atomic_load_n(&curr->next[level], __ATOMIC_ACQUIRE);
+            if (skiplist_is_marked(succ)) {
+                /* curr 已被删除, 把它从这一层摘除, pred 被修改或删除时 CAS 失败 */
+                struct easeds_skiplist_node *expected = curr;
+                if (!__atomic_compare_exchange_n(&pred->next[level], &expected,
+                        skiplist_unmark(succ), false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED)) {
+                    return false;
+                }
+                curr = skiplist_unmark(succ);
+                continue;
+            }
+            if (curr->key >= key) {
+                break;
+            }
+            pred = curr;
+            curr = succ;
+        }
+        preds[level] = pred;
+        succs[level] = curr;
+    }
+    return true;
+}
+
+// 查找 key 在各层的前驱和后继, 返回最底层后继的键是否等于 key
+static bool skiplist_find(struct easeds_skiplist *list, uint64_t key,
+    struct easeds_skiplist_node **preds, struct easeds_skiplist_node **succs)
+{
+    while (!skiplist_find_once(list, key, preds, succs)) {
+        __atomic_add_fetch(&list->retries, 1, __ATOMIC_RELAXED);
+    }
+    return succs[0] != NULL && succs[0]->key == key;
+}
+
+// 只读地定位最底层第一个键不小于 key 的节点, 跳过已标记的节点但不摘除, 返回的节点之后可能被标记
+static struct easeds_skiplist_node *skiplist_lower_bound(struct easeds_skiplist *list, uint64_t key)
+{
+    uint32_t                     top  = __atomic_load_n(&list->max_level, __ATOMIC_ACQUIRE);
+    struct easeds_skiplist_node *pred = list->head;
+    struct easeds_skiplist_node *curr = NULL;
+
+    for (uint32_t level = top; level-- > 0;) {
+        curr = skiplist_unmark(__atomic_load_n(&pred->next[level], __ATOMIC_ACQUIRE));
+        while (curr != NULL) {
+            struct easeds_skiplist_node *succ =
+                __atomic_load_n(&curr->next[level], __ATOMIC_ACQUIRE);
+            if (skiplist_is_marked(succ)) {
+                curr = skiplist_unmark(succ);
+                continue;
+            }
+            if (curr->key >= key) {
+                break;
+            }
+            pred = curr;
+            curr = succ;
+        }
+    }
+    return curr;
+}
+
+// 释放一个节点引用, 插入线程和删除线程都释放后节点已从所有层摘除, 交给回收域延迟释放
+static void skiplist_node_put(struct easeds_skiplist *list, struct easeds_skiplist_node *node)
+{
+    if (__atomic_sub_fetch(&node->refs, 1, __ATOMIC_ACQ_REL) != 0) {
+        return;
+    }
+    uint64_t size = SKIPLIST_NODE_SIZE(node->level);
+    if (unlikely(easeds_reclaim_retire(list->reclaim, node, size) != 0)) {
+        EASEDS_ERR("[easeds_skiplist]: Retire node %p failed, leaked.", (void *)node);
+    }
+}
+
+// 自底向上把已发布的节点链接到第 1 层及以上, 节点被并发删除时停止链接
+static void skiplist_link_upper(struct easeds_skiplist *list, struct easeds_skiplist_node *node,
+    struct easeds_skiplist_node **preds, struct easeds_skiplist_node **succs)
+{
+    for (uint32_t level = 1; level < node->level; level++) {
+        while (true) {
+            /* 先让节点指向最新的后继, 节点在这一层已被标记时 CAS 失败, 不能再链接 */
+            struct easeds_skiplist_node *next =
+                __atomic_load_n(&node->next[level], __ATOMIC_ACQUIRE);
+            if (skiplist_is_marked(next)) {
+                return;
+            }
+            if (next != succs[level]
+                && !__atomic_compare_exchange_n(&node->next[level], &next, succs[level], false,
+                    __ATOMIC_SEQ_CST, __ATOMIC_RELAXED)) {
+                return;
+            }
+
+            struct easeds_skiplist_node *expected = succs[level];
+            if (__atomic_compare_exchange_n(&preds[level]->next[level], &expected, node, false,
+                    __ATOMIC_SEQ_CST, __ATOMIC_RELAXED)) {
+                break;
+            }
+
+            /* 前驱已被修改, 重新查找; 最底层找不到节点说明它已被删除并摘除 */
+            __atomic_add_fetch(&list->retries, 1, __ATOMIC_RELAXED);
+            skiplist_find(list, node->key, preds, succs);
+            if (succs[0] != node) {
+                return;
+            }
+        }
+    }
+}
+
+// 插入或覆盖键值对, 调用时已在回收域临界区内
+static int32_t skiplist_insert(struct easeds_skiplist *list, uint64_t key, void *value)
+{
+    struct easeds_skiplist_node *preds[EASEDS_SKIPLIST_MAX_LEVEL];
+    struct easeds_skiplist_node *succs[EASEDS_SKIPLIST_MAX_LEVEL];
+    struct easeds_skiplist_node *node = NULL;
+
+    while (true) {
+        if (skiplist_find(list, key, preds, succs)) {
+            /* 覆盖旧值, 覆盖期间节点被删除时重新插入, 否则这次写入会随删除一起丢失 */
+            struct easeds_skiplist_node *found = succs[0];
+            __atomic_store_n(&found->value, value, __ATOMIC_RELEASE);
+            if (!skiplist_is_marked(__atomic_load_n(&found->next[0], __ATOMIC_SEQ_CST))) {
+                if (node != NULL) {
+                    __easeds_free(node);
+                }
+                return 0;
+            }
+            continue;
+        }
+
+        if (node == NULL) {
+            uint32_t level = skiplist_random_level();
+            node           = __easeds_malloc(SKIPLIST_NODE_SIZE(level));
+            if (unlikely(node == NULL)) {
+                EASEDS_ERR("[easeds_skiplist_insert]: Malloc node failed.");
+                return -1;
+            }
+            node->key   = key;
+            node->value = value;
+            node->level = level;
+            /* 插入线程和删除线程各持有一个引用, 发布前设置, 节点在两个线程都完成后才退休 */
+            node->refs  = 2;
+            skiplist_raise_level(list, level);
+        }
+
+        /* 节点发布前可以直接写入后继 */
+        for (uint32_t level = 0; level < node->level; level++) {
+            node->next[level] = succs[level];
+        }
+
+        /* 最底层链接成功即完成插入 */
+        struct easeds_skiplist_node *expected = succs[0];
+        if (__atomic_compare_exchange_n(&preds[0]->next[0], &expected, node, false,
+                __ATOMIC_SEQ_CST, __ATOMIC_RELAXED)) {
+            break;
+        }
+        __atomic_add_fetch(&list->retries, 1, __ATOMIC_RELAXED);
+    }
+
+    __atomic_add_fetch(&list->size, 1, __ATOMIC_RELAXED);
+    __atomic_add_fetch(&list->memory, SKIPLIST_NODE_SIZE(node->level), __ATOMIC_RELAXED);
+
+    skiplist_link_upper(list, node, preds, succs);
+
+    /* 链接期间节点已被删除时, 删除线程的查找可能早于上层链接, 再查找一次摘除所有层 */
+    if (skiplist_is_marked(__atomic_load_n(&node->next[0], __ATOMIC_SEQ_CST))) {
+        skiplist_find(list, key, preds, succs);
+    }
+    skiplist_node_put(list, node);
+    return 0;
+}
+
+// 删除键值对, 调用时已在回收域临界区内
+static int32_t skiplist_remove(struct easeds_skiplist *list, uint64_t key, void **value)
+{
+    struct easeds_skiplist_node *preds[EASEDS_SKIPLIST_MAX_LEVEL];
+    struct easeds_skiplist_node *succs[EASEDS_SKIPLIST_MAX_LEVEL];
+
+    if (!skiplist_find(list, key, preds, succs)) {
+        return -1;
+    }
+
+    /* 自顶向下标记各层, 上层标记后插入线程不会再把节点链接到这一层 */
+    struct easeds_skiplist_node *node = succs[0];
+    for (uint32_t level = node->level - 1; level > 0; level--) {
+        struct easeds_skiplist_node *next = __atomic_load_n(&node->next[level], __ATOMIC_ACQUIRE);
+        while (!skiplist_is_marked(next)) {
+            __atomic_compare_exchange_n(&node->next[level], &next, skiplist_mark(next), false,
+                __ATOMIC_SEQ_CST, __ATOMIC_ACQUIRE);
+        }
+    }
+
+    /* 最底层标记成功的线程完成删除, 失败说明其他线程已删除该键 */
+    struct easeds_skiplist_node *next = __atomic_load_n(&node->next[0], __ATOMIC_ACQUIRE);
+    while (true) {
+        if (skiplist_is_marked(next)) {
+            return -1;
+        }
+        if (__atomic_compare_exchange_n(&node->next[0], &next, skiplist_mark(next), false,
+                __ATOMIC_SEQ_CST, __ATOMIC_ACQUIRE)) {
+            break;
+        }
+    }
+
+    if (value != NULL) {
+        *value = __atomic_load_n(&node->value, __ATOMIC_ACQUIRE);
+    }
+    __atomic_sub_fetch(&list->size, 1, __ATOMIC_RELAXED);
+    __atomic_sub_fetch(&list->memory, SKIPLIST_NODE_SIZE(node->level), __ATOMIC_RELAXED);
+
+    /* 查找过程摘除所有层上的已标记节点 */
+    skiplist_find(list, key, preds, succs);
+    skiplist_node_put(list, node);
+    return 0;
+}
+
+// 创建一个空跳表, 失败返回NULL
+struct easeds_skiplist *easeds_skiplist_create(const char *name)
+{
+    struct easeds_skiplist *list =
+        __easeds_aligned_alloc(EASEDS_CACHE_LINE_SIZE, SKIPLIST_ALLOC_SIZE);
+    if (unlikely(list == NULL)) {
+        EASEDS_ERR("[easeds_skiplist_create]: Malloc skiplist failed.");
+        return NULL;
+    }
+    memset(list, 0, sizeof(struct easeds_skiplist));
+
+    list->head = __easeds_malloc(SKIPLIST_NODE_SIZE(EASEDS_SKIPLIST_MAX_LEVEL));
+    if (unlikely(list->head == NULL)) {
+        EASEDS_ERR("[easeds_skiplist_create]: Malloc head node failed.");
+        __easeds_free(list);
+        return NULL;
+    }
+    memset(list->head, 0, SKIPLIST_NODE_SIZE(EASEDS_SKIPLIST_MAX_LEVEL));
+    list->head->level = EASEDS_SKIPLIST_MAX_LEVEL;
+
+    list->reclaim = easeds_reclaim_create(name, EASEDS_RECLAIM_EBR, NULL);
+    if (unlikely(list->reclaim == NULL)) {
+        EASEDS_ERR("[easeds_skiplist_create]: Create reclaim domain failed.");
+        __easeds_free(list->head);
+        __easeds_free(list);
+        return NULL;
+    }
+
+    list->name = name;
+    PFL_DEBUG("[easeds_skiplist_create]: name=%s.", name != NULL ? name : "(null)");
+    return list;
+}
+
+// 销毁跳表, 释放所有节点, 值由用户管理, 调用时不能有其他线程访问
+void easeds_skiplist_destroy(struct easeds_skiplist *list)
+{
+    if (unlikely(list == NULL)) {
+        return;
+    }
+
+    /* 没有并发操作时已删除的节点都已摘除并退休, 最底层剩下的都是有效节点 */
+    struct easeds_skiplist_node *node = list->head->next[0];
+    while (node != NULL) {
+        struct easeds_skiplist_node *next = skiplist_unmark(node->next[0]);
+        __easeds_free(node);
+        node = next;
+    }
+
+    easeds_reclaim_destroy(list->reclaim);
+    __easeds_free(list->head);
+    __easeds_free(list);
+}
+
+// 获取键值对数量, 并发修改时为近似值
+uint64_t easeds_skiplist_size(struct easeds_skiplist *list)
+{
+    if (unlikely(list == NULL)) {
+        return 0;
+    }
+    return __atomic_load_n(&list->size, __ATOMIC_RELAXED);
+}
+
+// 插入键值对, 键已存在时覆盖旧值, 成功返回0, 失败返回-1
+int32_t easeds_skiplist_insert(struct easeds_skiplist *list, uint64_t key, void *value)
+{
+    if (unlikely(list == NULL)) {
+        EASEDS_ERR("[easeds_skiplist_insert]: Invalid skiplist pointer.");
+        return -1;
+    }
+    if (unlikely(easeds_reclaim_enter(list->reclaim) != 0)) {
+        return -1;
+    }
+
+    int32_t ret = skiplist_insert(list, key, value);
+    easeds_reclaim_exit(list->reclaim);
+    return ret;
+}
+
+// 删除键值对, value 非空时返回被删除的值, 成功返回0, 键不存在返回-1
+int32_t easeds_skiplist_remove(struct easeds_skiplist *list, uint64_t key, void **value)
+{
+    if (unlikely(list == NULL)) {
+        EASEDS_ERR("[easeds_skiplist_remove]: Invalid skiplist pointer.");
+        return -1;
+    }
+    if (unlikely(easeds_reclaim_enter(list->reclaim) != 0)) {
+        return -1;
+    }
+
+    int32_t ret = skiplist_remove(list, key, value);
+    easeds_reclaim_exit(list->reclaim);
+    return ret;
+}
+
+// 查找键对应的值, value 非空时返回找到的值, 成功返回0, 键不存在返回-1
+int32_t easeds_skiplist_find(struct easeds_skiplist *list, uint64_t key, void **value)
+{
+    if (unlikely(list == NULL)) {
+        EASEDS_ERR("[easeds_skiplist_find]: Invalid skiplist pointer.");
+        return -1;
+    }
+    if (unlikely(easeds_reclaim_enter(list->reclaim) != 0)) {
+        return -1;
+    }
+
+    int32_t                      ret  = -1;
+    struct easeds_skiplist_node *node = skiplist_lower_bound(list, key);
+    if (node != NULL && node->key == key) {
+        if (value != NULL) {
+            *value = __atomic_load_n(&node->value, __ATOMIC_ACQUIRE);
+        }
+        ret = 0;
+    }
+    easeds_reclaim_exit(list->reclaim);
+    return ret;
+}
+
+// 按升序遍历 [low, high] 区间内的键值对, 对每个键值对执行回调函数, 返回遍历数量
+uint64_t easeds_skiplist_range(struct easeds_skiplist *list, uint64_t low, uint64_t high,
+    void (*callback)(uint64_t key, void *value, void *user_data), void *user_data)
+{
+    if (unlikely(list == NULL || callback == NULL || low > high)) {
+        return 0;
+    }
+    if (unlikely(easeds_reclaim_enter(list->reclaim) != 0)) {
+        return 0;
+    }
+
+    /* 回调在临界区内执行, 不能调用 easeds_reclaim_flush 之类会等待宽限期的接口 */
+    uint64_t                     count = 0;
+    struct easeds_skiplist_node *node  = skiplist_lower_bound(list, low);
+    while (node != NULL && node->key <= high) {
+        struct easeds_skiplist_node *next = __atomic_load_n(&node->next[0], __ATOMIC_ACQUIRE);
+        if (!skiplist_is_marked(next)) {
+            callback(node->key, __atomic_load_n(&node->value, __ATOMIC_ACQUIRE), user_data);
+            count++;
+        }
+        node = skiplist_unmark(next);
+    }
+
+    easeds_reclaim_exit(list->reclaim);
+    return count;
+}
+
+// 获取统计信息, 层数分布需要遍历最底层, 并发修改时为近似值
+void easeds_skiplist_stats(struct easeds_skiplist *list, struct easeds_skiplist_stats *stats)
+{
+    if (unlikely(list == NULL || stats == NULL)) {
+        return;
+    }
+
+    memset(stats, 0, sizeof(struct easeds_skiplist_stats));
+    stats->size      = __atomic_load_n(&list->size, __ATOMIC_RELAXED);
+    stats->memory    = __atomic_load_n(&list->memory, __ATOMIC_RELAXED);
+    stats->retries   = __atomic_load_n(&list->retries, __ATOMIC_RELAXED);
+    stats->max_level = __atomic_load_n(&list->max_level, __ATOMIC_RELAXED);
+
+    if (unlikely(easeds_reclaim_enter(list->reclaim) != 0)) {
+        return;
+    }
+    struct easeds_skiplist_node *node =
+        skiplist_unmark(__atomic_load_n(&list->head->next[0], __ATOMIC_ACQUIRE));
+    while (node != NULL) {
+        struct easeds_skiplist_node *next = __atomic_load_n(&node->next[0], __ATOMIC_ACQUIRE);
+        if (!skiplist_is_marked(next)) {
+            stats->levels[node->level - 1]++;
+        }
+        node = skiplist_unmark(next);
+    }
+    easeds_reclaim_exit(list->reclaim);
+}
+
+// 校验跳表结构不变量(各层有序, 上层节点在下层可达, 统计信息), 调用时不能有并发修改
+int32_t easeds_skiplist_verify(struct easeds_skiplist *list)
+{
+    if (unlikely(list == NULL)) {
+        EASEDS_ERR("[easeds_skiplist_verify]: Invalid skiplist pointer.");
+        return -1;
+    }
+
+    for (uint32_t level = 0; level < EASEDS_SKIPLIST_MAX_LEVEL; level++) {
+        struct easeds_skiplist_node *lower = list->head->next[0];
+        struct easeds_skiplist_node *node  = list->head->next[level];
+        uint64_t                     count = 0;
+        uint64_t                     bytes = 0;
+
+        if (level >= list->max_level && node != NULL) {
+            EASEDS_ERR("[easeds_skiplist_verify]: Level %u above max level %u is not empty.",
+                level, list->max_level);
+            return -1;
+        }
+
+        while (node != NULL) {
+            struct easeds_skiplist_node *next = node->next[level];
+            if (skiplist_is_marked(next) || node->level <= level) {
+                EASEDS_ERR("[easeds_skiplist_verify]: Node 0x%lx level %u invalid at level %u.",
+                    node->key, node->level, level);
+                return -1;
+            }
+            if (next != NULL && next->key <= node->key) {
+                EASEDS_ERR("[easeds_skiplist_verify]: Keys not ascending at level %u, 0x%lx "
+                           "after 0x%lx.",
+                    level, next->key, node->key);
+                return -1;
+            }
+
+            /* 上层的每个节点都必须出现在最底层 */
+            while (lower != NULL && lower->key < node->key) {
+                lower = lower->next[0];
+            }
+            if (lower != node) {
+                EASEDS_ERR("[easeds_skiplist_verify]: Node 0x%lx at level %u missing at level 0.",
+                    node->key, level);
+                return -1;
+            }
+
+            count++;
+            bytes += SKIPLIST_NODE_SIZE(node->level);
+            node = next;
+        }
+
+        if (level == 0 && (count != list->size || bytes != list->memory)) {
+            EASEDS_ERR("[easeds_skiplist_verify]: Size %lu memory %lu but found %lu nodes %lu "
+                       "bytes.",
+                list->size, list->memory, count, bytes);
+            return -1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,130 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-skiplist.h
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-18 22:55
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  无锁并发跳表, 基于 CAS 的插入和查找, 删除通过逻辑标记完成, 支持有序区间遍历.
+ *
+ * @History:
+ *  2026年10月18日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#ifndef __EASEDS_SKIPLIST_H__
+#define __EASEDS_SKIPLIST_H__
+
+/* C 标准库头文件 */
+#include <stdbool.h>
+#include <stdint.h>
+
+/* 项目内部头文件 */
+#include "easeds-environment.h"
+#include "easeds-public.h"
+#include "easeds-reclaim.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 最大层数, 每层晋升概率 1/4, 足够容纳 4^24 个键 */
+#define EASEDS_SKIPLIST_MAX_LEVEL 24
+
+/* 跳表节点, next 指针最低位为 1 表示该层已被逻辑删除, 节点发布后只有 value 和 next 会被修改 */
+struct easeds_skiplist_node {
+    uint64_t                     key;    /* 键 */
+    void                        *value;  /* 值, 原子读写 */
+    uint32_t                     level;  /* 层数, 1 ~ EASEDS_SKIPLIST_MAX_LEVEL */
+    uint32_t                     refs;   /* 插入线程和删除线程各持有一个引用, 归零后退休 */
+    struct easeds_skiplist_node *next[]; /* 各层后继节点, 最低位为删除标记 */
+};
+
+/* 跳表统计信息 */
+struct easeds_skiplist_stats {
+    uint64_t size;                              /* 键值对数量 */
+    uint64_t memory;                            /* 节点占用的字节数, 不包含头节点 */
+    uint64_t retries;                           /* CAS 失败后重新查找的次数 */
+    uint64_t max_level;                         /* 当前节点的最高层数 */
+    uint64_t levels[EASEDS_SKIPLIST_MAX_LEVEL]; /* 层数为 i + 1 的节点数量 */
+};
+
+/**
+ * 实现一个面向 64 位整数键的无锁并发跳表, 插入/删除/查找都不需要锁, 适合读多写少的有序索引.
+ *  (1) 每个节点的层数由线程私有的 xorshift 随机数决定, 晋升概率 1/4, 平均每个节点 4/3 个指针,
+ *      生成层数不需要任何共享状态.
+ *  (2) 插入先用 CAS 链接最底层, 链接成功即对其他线程可见, 然后自底向上逐层链接.
+ *      键已存在时原子地覆盖旧值.
+ *  (3) 删除自顶向下在各层 next 指针上设置删除标记, 最底层标记成功的线程即完成删除,
+ *      随后的查找过程会用 CAS 摘除沿途已标记的节点.
+ *  (4) 节点的插入线程和删除线程都完成后节点才会退休, 通过 EBR 回收域延迟释放,
+ *      每次操作都在回收域临界区内进行, 不会访问已释放的节点.
+ *  (5) 区间遍历沿最底层按升序进行, 跳过已标记的节点, 与并发修改同时进行时不保证快照一致.
+ *  (6) 除创建和销毁外所有接口都是线程安全的, 值由用户管理.
+ */
+struct easeds_skiplist {
+    struct easeds_skiplist_node *head;      /* 头节点, 拥有 EASEDS_SKIPLIST_MAX_LEVEL 层 */
+    struct easeds_reclaim       *reclaim;   /* 删除节点的 EBR 回收域 */
+    const char                  *name;      /* 名称, 预留字段, 可用于调试和日志 */
+    uint32_t                     max_level; /* 当前节点的最高层数, 查找从这一层开始 */
+    uint32_t                     pad0;      /* 对齐填充 */
+    uint8_t                      pad1[EASEDS_CACHE_LINE_SIZE - 32]; /* 缓存行填充 */
+    uint64_t                     size;      /* 键值对数量, 频繁修改, 单独占用缓存行 */
+    uint64_t                     memory;    /* 节点占用的字节数 */
+    uint64_t                     retries;   /* CAS 失败后重新查找的次数 */
+    uint8_t                      pad2[EASEDS_CACHE_LINE_SIZE - 24]; /* 缓存行填充 */
+};
+
+/**
+ * 常见跳表操作函数:
+ *
+ * 函数名                       功能描述
+ * ------------------------     ------------------------------------------------------
+ * easeds_skiplist_create       创建一个空跳表, 失败返回NULL
+ * easeds_skiplist_destroy      销毁跳表, 释放所有节点, 调用时不能有其他线程访问
+ * easeds_skiplist_size         获取键值对数量, 并发修改时为近似值
+ * easeds_skiplist_insert       插入键值对, 键已存在时覆盖旧值, 成功返回0, 失败返回-1
+ * easeds_skiplist_remove       删除键值对, 成功返回0, 键不存在返回-1
+ * easeds_skiplist_find         查找键对应的值, 成功返回0, 键不存在返回-1
+ * easeds_skiplist_range        按升序遍历 [low, high] 区间内的键值对, 返回遍历数量
+ * easeds_skiplist_stats        获取统计信息和层数分布
+ * easeds_skiplist_verify       校验跳表结构不变量, 正确返回0, 异常返回-1
+ */
+
+// 创建一个空跳表, 失败返回NULL
+struct easeds_skiplist *easeds_skiplist_create(const char *name);
+
+// 销毁跳表, 释放所有节点, 值由用户管理, 调用时不能有其他线程访问
+void easeds_skiplist_destroy(struct easeds_skiplist *list);
+
+// 获取键值对数量, 并发修改时为近似值
+uint64_t easeds_skiplist_size(struct easeds_skiplist *list);
+
+// 插入键值对, 键已存在时覆盖旧值, 成功返回0, 失败返回-1
+int32_t easeds_skiplist_insert(struct easeds_skiplist *list, uint64_t key, void *value);
+
+// 删除键值对, value 非空时返回被删除的值, 成功返回0, 键不存在返回-1
+int32_t easeds_skiplist_remove(struct easeds_skiplist *list, uint64_t key, void **value);
+
+// 查找键对应的值, value 非空时返回找到的值, 成功返回0, 键不存在返回-1
+int32_t easeds_skiplist_find(struct easeds_skiplist *list, uint64_t key, void **value);
+
+// 按升序遍历 [low, high] 区间内的键值对, 对每个键值对执行回调函数, 返回遍历数量
+uint64_t easeds_skiplist_range(struct easeds_skiplist *list, uint64_t low, uint64_t high,
+    void (*callback)(uint64_t key, void *value, void *user_data), void *user_data);
+
+// 获取统计信息, 层数分布需要遍历最底层, 并发修改时为近似值
+void easeds_skiplist_stats(struct easeds_skiplist *list, struct easeds_skiplist_stats *stats);
+
+// 校验跳表结构不变量(各层有序, 上层节点在下层可达, 统计信息), 调用时不能有并发修改
+int32_t easeds_skiplist_verify(struct easeds_skiplist *list);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __EASEDS_SKIPLIST_H__ */
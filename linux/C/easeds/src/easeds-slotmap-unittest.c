@@ -0,0 +1,330 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-slotmap-unittest.c
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-18 23:25
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  Easeds 槽位映射单元测试实现文件, 包含了句柄有效性/过期检测/紧密排列/代数耗尽和性能测试.
+ *
+ * @History:
+ *  2026年10月18日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#include "easeds-unittest.h"
+
+// 项目内部头文件
+#include "easeds-slotmap.h"
+#include "easeds-utils.h"
+
+// 测试对象
+struct slotmap_obj {
+    uint64_t id;      /* 对象编号 */
+    uint64_t payload; /* 数据 */
+};
+
+// 遍历回调上下文
+struct slotmap_walk_ctx {
+    struct easeds_slotmap *map;    /* 槽位映射 */
+    uint64_t               count;  /* 遍历数量 */
+    uint64_t               sum;    /* 对象编号之和 */
+    uint64_t               errors; /* 句柄与对象不一致的次数 */
+};
+
+// 遍历回调: 检查句柄查找到的就是当前对象
+static void slotmap_walk_cb(uint64_t handle, void *element, void *user_data)
+{
+    struct slotmap_walk_ctx *ctx = user_data;
+
+    if (easeds_slotmap_get(ctx->map, handle) != element) {
+        ctx->errors++;
+    }
+    ctx->sum += ((struct slotmap_obj *)element)->id;
+    ctx->count++;
+}
+
+// xorshift 随机数
+static uint64_t slotmap_rand(uint64_t *seed)
+{
+    *seed ^= *seed << 13;
+    *seed ^= *seed >> 7;
+    *seed ^= *seed << 17;
+    return *seed;
+}
+
+// 基本功能测试: 插入/查找/删除, 删除后旧句柄失效
+static void test_easeds_slotmap_basic(void **state)
+{
+    easeds_unused(state);
+
+    struct easeds_slotmap *map = easeds_slotmap_create("test", sizeof(struct slotmap_obj), 4);
+    uint64_t               handles[3];
+    assert_non_null(map);
+    assert_int_equal(easeds_slotmap_size(map), 0);
+
+    for (uint64_t i = 0; i < 3; i++) {
+        struct slotmap_obj obj = {.id = i, .payload = i * 10};
+        handles[i]             = easeds_slotmap_insert(map, &obj);
+        assert_int_not_equal(handles[i], EASEDS_SLOTMAP_INVALID);
+    }
+    assert_int_equal(easeds_slotmap_size(map), 3);
+
+    for (uint64_t i = 0; i < 3; i++) {
+        struct slotmap_obj *obj = easeds_slotmap_get(map, handles[i]);
+        assert_non_null(obj);
+        assert_int_equal(obj->id, i);
+        assert_true(easeds_slotmap_contains(map, handles[i]));
+    }
+
+    /* 删除第一个对象, 最后一个对象移到下标 0, 句柄仍然有效 */
+    assert_int_equal(easeds_slotmap_remove(map, handles[0]), 0);
+    assert_int_equal(easeds_slotmap_remove(map, handles[0]), -1);
+    assert_null(easeds_slotmap_get(map, handles[0]));
+    assert_false(easeds_slotmap_contains(map, handles[0]));
+    assert_int_equal(easeds_slotmap_size(map), 2);
+    assert_int_equal(((struct slotmap_obj *)easeds_slotmap_data(map))[0].id, 2);
+    assert_int_equal(easeds_slotmap_handle_at(map, 0), handles[2]);
+    assert_int_equal(((struct slotmap_obj *)easeds_slotmap_get(map, handles[2]))->payload, 20);
+
+    /* 复用的槽位代数不同, 旧句柄不会指向新对象 */
+    uint64_t reused = easeds_slotmap_insert(map, NULL);
+    assert_int_equal(EASEDS_SLOTMAP_SLOT(reused), EASEDS_SLOTMAP_SLOT(handles[0]));
+    assert_int_not_equal(reused, handles[0]);
+    assert_null(easeds_slotmap_get(map, handles[0]));
+    assert_int_equal(((struct slotmap_obj *)easeds_slotmap_get(map, reused))->id, 0);
+
+    easeds_slotmap_destroy(map);
+}
+
+// 操作测试: 随机插入删除, 与句柄表对照, 检查紧密排列和遍历
+static void test_easeds_slotmap_operations(void **state)
+{
+    easeds_unused(state);
+
+    const uint32_t         max     = 2048;
+    uint64_t              *handles = calloc(max, sizeof(uint64_t));
+    uint64_t              *stale   = calloc(max, sizeof(uint64_t));
+    uint64_t               seed    = 88172645463325252ULL;
+    uint64_t               live    = 0;
+    uint64_t               sum     = 0;
+    struct easeds_slotmap *map     = easeds_slotmap_create("test", sizeof(struct slotmap_obj), 0);
+    assert_non_null(handles);
+    assert_non_null(stale);
+    assert_non_null(map);
+
+    for (uint32_t i = 0; i < 200000; i++) {
+        uint64_t id = slotmap_rand(&seed) % max;
+        if (handles[id] == EASEDS_SLOTMAP_INVALID) {
+            struct slotmap_obj obj = {.id = id, .payload = i};
+            handles[id]            = easeds_slotmap_insert(map, &obj);
+            assert_int_not_equal(handles[id], EASEDS_SLOTMAP_INVALID);
+            live++;
+            sum += id;
+        } else {
+            assert_int_equal(easeds_slotmap_remove(map, handles[id]), 0);
+            stale[id]   = handles[id];
+            handles[id] = EASEDS_SLOTMAP_INVALID;
+            live--;
+            sum -= id;
+        }
+
+        /* 过期句柄始终无效 */
+        if (stale[id] != EASEDS_SLOTMAP_INVALID) {
+            assert_null(easeds_slotmap_get(map, stale[id]));
+        }
+    }
+    assert_int_equal(easeds_slotmap_size(map), live);
+
+    for (uint64_t id = 0; id < max; id++) {
+        if (handles[id] != EASEDS_SLOTMAP_INVALID) {
+            struct slotmap_obj *obj = easeds_slotmap_get(map, handles[id]);
+            assert_non_null(obj);
+            assert_int_equal(obj->id, id);
+        }
+    }
+
+    /* 紧密数组的前 size 个元素就是全部对象 */
+    struct slotmap_walk_ctx ctx   = {.map = map};
+    struct slotmap_obj     *data  = easeds_slotmap_data(map);
+    uint64_t                dense = 0;
+    easeds_slotmap_foreach(map, slotmap_walk_cb, &ctx);
+    assert_int_equal(ctx.count, live);
+    assert_int_equal(ctx.sum, sum);
+    assert_int_equal(ctx.errors, 0);
+    for (uint32_t i = 0; i < easeds_slotmap_size(map); i++) {
+        dense += data[i].id;
+        assert_int_equal(easeds_slotmap_handle_at(map, i), handles[data[i].id]);
+    }
+    assert_int_equal(dense, sum);
+
+    /* 清空后所有句柄失效, 可以继续插入 */
+    easeds_slotmap_clear(map);
+    assert_int_equal(easeds_slotmap_size(map), 0);
+    for (uint64_t id = 0; id < max; id++) {
+        if (handles[id] != EASEDS_SLOTMAP_INVALID) {
+            assert_false(easeds_slotmap_contains(map, handles[id]));
+        }
+    }
+    assert_int_not_equal(easeds_slotmap_insert(map, NULL), EASEDS_SLOTMAP_INVALID);
+    assert_int_equal(easeds_slotmap_size(map), 1);
+
+    easeds_slotmap_destroy(map);
+    free(stale);
+    free(handles);
+}
+
+// 边界测试: 容量为1时扩容, 伪造句柄, 代数耗尽的槽位不再复用
+static void test_easeds_slotmap_boundary(void **state)
+{
+    easeds_unused(state);
+
+    struct easeds_slotmap *map = easeds_slotmap_create(NULL, 1, 1);
+    uint64_t               handles[100];
+    assert_non_null(map);
+
+    for (uint8_t i = 0; i < 100; i++) {
+        handles[i] = easeds_slotmap_insert(map, &i);
+        assert_int_not_equal(handles[i], EASEDS_SLOTMAP_INVALID);
+    }
+    for (uint8_t i = 0; i < 100; i++) {
+        assert_int_equal(*(uint8_t *)easeds_slotmap_get(map, handles[i]), i);
+    }
+    assert_true(map->capacity >= 100 && map->slot_capacity >= 100);
+
+    /* 无效句柄, 越界槽位, 代数为偶数的伪造句柄 */
+    assert_null(easeds_slotmap_get(map, EASEDS_SLOTMAP_INVALID));
+    assert_null(easeds_slotmap_get(map, EASEDS_SLOTMAP_HANDLE(1, 100)));
+    assert_null(easeds_slotmap_get(map, EASEDS_SLOTMAP_HANDLE(2, 0)));
+    assert_null(easeds_slotmap_get(map, handles[0] + (2ULL << 32)));
+    assert_int_equal(easeds_slotmap_remove(map, EASEDS_SLOTMAP_HANDLE(1, 1000)), -1);
+    assert_int_equal(easeds_slotmap_handle_at(map, 100), EASEDS_SLOTMAP_INVALID);
+
+    /* 删除最后一个对象不需要移动 */
+    assert_int_equal(easeds_slotmap_remove(map, handles[99]), 0);
+    assert_int_equal(easeds_slotmap_size(map), 99);
+    assert_int_equal(easeds_slotmap_handle_at(map, 98), handles[98]);
+
+    /* 代数即将回绕的槽位删除后不再复用 */
+    uint32_t slot               = EASEDS_SLOTMAP_SLOT(handles[5]);
+    map->slots[slot].generation = UINT32_MAX;
+    uint64_t old                = EASEDS_SLOTMAP_HANDLE(UINT32_MAX, slot);
+    assert_non_null(easeds_slotmap_get(map, old));
+    assert_int_equal(easeds_slotmap_remove(map, old), 0);
+    assert_int_equal(map->retired, 1);
+    for (uint32_t i = 0; i < 10; i++) {
+        uint64_t handle = easeds_slotmap_insert(map, NULL);
+        assert_int_not_equal(EASEDS_SLOTMAP_SLOT(handle), slot);
+    }
+    assert_null(easeds_slotmap_get(map, old));
+    assert_null(easeds_slotmap_get(map, EASEDS_SLOTMAP_HANDLE(1, slot)));
+
+    easeds_slotmap_destroy(map);
+}
+
+// 错误处理测试: 空指针和非法参数
+static void test_easeds_slotmap_error(void **state)
+{
+    easeds_unused(state);
+
+    struct slotmap_walk_ctx ctx = {0};
+
+    assert_null(easeds_slotmap_create("test", 0, 16));
+    assert_null(easeds_slotmap_create("test", 8, UINT32_MAX));
+    easeds_slotmap_destroy(NULL);
+    easeds_slotmap_clear(NULL);
+    assert_int_equal(easeds_slotmap_size(NULL), 0);
+    assert_int_equal(easeds_slotmap_insert(NULL, NULL), EASEDS_SLOTMAP_INVALID);
+    assert_int_equal(easeds_slotmap_remove(NULL, 1), -1);
+    assert_null(easeds_slotmap_get(NULL, 1));
+    assert_false(easeds_slotmap_contains(NULL, 1));
+    assert_null(easeds_slotmap_data(NULL));
+    assert_int_equal(easeds_slotmap_handle_at(NULL, 0), EASEDS_SLOTMAP_INVALID);
+    easeds_slotmap_foreach(NULL, slotmap_walk_cb, &ctx);
+    assert_int_equal(ctx.count, 0);
+
+    struct easeds_slotmap *map = easeds_slotmap_create("test", 8, 0);
+    assert_non_null(map);
+    easeds_slotmap_foreach(map, NULL, NULL);
+    easeds_slotmap_destroy(map);
+}
+
+// 性能测试: 插入/句柄查找/紧密遍历/删除
+static void test_easeds_slotmap_perf(void **state)
+{
+    easeds_unused(state);
+
+    const uint32_t         count   = 1000000;
+    uint64_t              *handles = malloc(count * sizeof(uint64_t));
+    uint32_t              *order   = malloc(count * sizeof(uint32_t));
+    uint64_t               seed    = 88172645463325252ULL;
+    struct easeds_slotmap *map = easeds_slotmap_create("perf", sizeof(struct slotmap_obj), 0);
+    assert_non_null(handles);
+    assert_non_null(order);
+    assert_non_null(map);
+
+    for (uint32_t i = 0; i < count; i++) {
+        order[i] = i;
+    }
+    for (uint32_t i = count - 1; i > 0; i--) {
+        uint32_t j = (uint32_t)(slotmap_rand(&seed) % (i + 1));
+        uint32_t t = order[i];
+        order[i]   = order[j];
+        order[j]   = t;
+    }
+
+    int64_t start = easeds_get_current_time_ns();
+    for (uint32_t i = 0; i < count; i++) {
+        struct slotmap_obj obj = {.id = i, .payload = i};
+        handles[i]             = easeds_slotmap_insert(map, &obj);
+    }
+    double insert_ns = (double)(easeds_get_current_time_ns() - start) / (double)count;
+
+    uint64_t sum = 0;
+    start        = easeds_get_current_time_ns();
+    for (uint32_t i = 0; i < count; i++) {
+        sum += ((struct slotmap_obj *)easeds_slotmap_get(map, handles[order[i]]))->payload;
+    }
+    double get_ns = (double)(easeds_get_current_time_ns() - start) / (double)count;
+    assert_int_equal(sum, (uint64_t)count * (count - 1) / 2);
+
+    /* 随机删除一半, 剩余对象仍然紧密排列 */
+    start = easeds_get_current_time_ns();
+    for (uint32_t i = 0; i < count / 2; i++) {
+        assert_int_equal(easeds_slotmap_remove(map, handles[order[i]]), 0);
+    }
+    double remove_ns = (double)(easeds_get_current_time_ns() - start) / (double)(count / 2);
+
+    const struct slotmap_obj *data = easeds_slotmap_data(map);
+    uint32_t                  size = easeds_slotmap_size(map);
+    sum                            = 0;
+    start                          = easeds_get_current_time_ns();
+    for (uint32_t i = 0; i < size; i++) {
+        sum += data[i].payload;
+    }
+    double iter_ns = (double)(easeds_get_current_time_ns() - start) / (double)size;
+    assert_int_equal(size, count / 2);
+    assert_true(sum > 0);
+
+    MEASURE("[slotmap perf]: %u objects, insert %.1f ns/op, random get %.1f ns/op, "
+            "remove %.1f ns/op, dense iterate %.2f ns/object.",
+        count, insert_ns, get_ns, remove_ns, iter_ns);
+
+    easeds_slotmap_destroy(map);
+    free(order);
+    free(handles);
+}
+
+// 注册单元测试用例
+EASEDS_UNITTEST_REGISTER(easeds_unittest_slotmap){
+    cmocka_unit_test(test_easeds_slotmap_basic),
+    cmocka_unit_test(test_easeds_slotmap_operations),
+    cmocka_unit_test(test_easeds_slotmap_boundary),
+    cmocka_unit_test(test_easeds_slotmap_error),
+    cmocka_unit_test(test_easeds_slotmap_perf),
+    easeds_unit_test_end,
+};
@@ -0,0 +1,313 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-slotmap.c
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-18 23:25
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  槽位映射实现文件.
+ *
+ * @History:
+ *  2026年10月18日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#include "easeds-slotmap.h"
+
+// 标准库头文件
+#include <stdlib.h>
+#include <string.h>
+
+// 项目内部头文件
+#include "easeds-log.h"
+
+/* 空闲槽位链表结束标记, 也是槽位下标的上限 */
+#define SLOTMAP_NIL UINT32_MAX
+
+// 扩容紧密数组和 erase 数组, 成功返回0, 失败返回-1
+static int32_t slotmap_grow_dense(struct easeds_slotmap *map)
+{
+    if (unlikely(map->capacity >= SLOTMAP_NIL / 2)) {
+        return -1;
+    }
+
+    uint32_t capacity = map->capacity * 2;
+    uint8_t *data     = realloc(map->data, (size_t)map->element_size * capacity);
+    if (unlikely(data == NULL)) {
+        return -1;
+    }
+    map->data = data;
+
+    uint32_t *erase = realloc(map->erase, sizeof(uint32_t) * capacity);
+    if (unlikely(erase == NULL)) {
+        return -1;
+    }
+    map->erase    = erase;
+    map->capacity = capacity;
+    return 0;
+}
+
+// 扩容槽位数组, 成功返回0, 失败返回-1
+static int32_t slotmap_grow_slots(struct easeds_slotmap *map)
+{
+    if (unlikely(map->slot_capacity >= SLOTMAP_NIL / 2)) {
+        return -1;
+    }
+
+    uint32_t                    capacity = map->slot_capacity * 2;
+    struct easeds_slotmap_slot *slots =
+        realloc(map->slots, sizeof(struct easeds_slotmap_slot) * capacity);
+    if (unlikely(slots == NULL)) {
+        return -1;
+    }
+    map->slots         = slots;
+    map->slot_capacity = capacity;
+    return 0;
+}
+
+// 分配一个空闲槽位, 优先复用空闲链表, 失败返回 SLOTMAP_NIL
+static uint32_t slotmap_alloc_slot(struct easeds_slotmap *map)
+{
+    if (map->free_head != SLOTMAP_NIL) {
+        uint32_t slot  = map->free_head;
+        map->free_head = map->slots[slot].index;
+        return slot;
+    }
+
+    if (map->slot_count == map->slot_capacity && slotmap_grow_slots(map) != 0) {
+        return SLOTMAP_NIL;
+    }
+    uint32_t slot               = map->slot_count++;
+    map->slots[slot].generation = 0;
+    return slot;
+}
+
+// 释放一个槽位: 代数加一使旧句柄失效, 代数回绕到0的槽位不再复用
+static void slotmap_free_slot(struct easeds_slotmap *map, uint32_t slot)
+{
+    struct easeds_slotmap_slot *entry = &map->slots[slot];
+
+    entry->generation++;
+    if (unlikely(entry->generation == 0)) {
+        map->retired++;
+        return;
+    }
+    entry->index   = map->free_head;
+    map->free_head = slot;
+}
+
+// 检查句柄, 有效时返回槽位, 无效返回NULL
+static inline struct easeds_slotmap_slot *slotmap_lookup(
+    struct easeds_slotmap *map, uint64_t handle)
+{
+    uint32_t slot = EASEDS_SLOTMAP_SLOT(handle);
+    if (unlikely(slot >= map->slot_count)) {
+        return NULL;
+    }
+
+    /* 空闲槽位的代数为偶数, 有效句柄的代数为奇数, 相等即说明槽位被占用且没有被复用过 */
+    struct easeds_slotmap_slot *entry = &map->slots[slot];
+    if (entry->generation != EASEDS_SLOTMAP_GEN(handle) || (entry->generation & 1) == 0) {
+        return NULL;
+    }
+    return entry;
+}
+
+// 创建一个槽位映射, initial_capacity 为0时使用默认初始容量, 失败返回NULL
+struct easeds_slotmap *easeds_slotmap_create(
+    const char *name, uint32_t element_size, uint32_t initial_capacity)
+{
+    if (unlikely(element_size == 0)) {
+        EASEDS_ERR("[easeds_slotmap_create]: Invalid element size 0.");
+        return NULL;
+    }
+    if (initial_capacity == 0) {
+        initial_capacity = EASEDS_SLOTMAP_DEFAULT_INITIAL_CAPACITY;
+    }
+    if (unlikely(initial_capacity >= SLOTMAP_NIL / 2)) {
+        EASEDS_ERR("[easeds_slotmap_create]: Initial capacity %u too large.", initial_capacity);
+        return NULL;
+    }
+
+    struct easeds_slotmap *map = __easeds_malloc(sizeof(struct easeds_slotmap));
+    if (unlikely(map == NULL)) {
+        EASEDS_ERR("[easeds_slotmap_create]: Malloc slotmap failed.");
+        return NULL;
+    }
+    memset(map, 0, sizeof(struct easeds_slotmap));
+
+    map->data  = __easeds_malloc((size_t)element_size * initial_capacity);
+    map->erase = __easeds_malloc(sizeof(uint32_t) * initial_capacity);
+    map->slots = __easeds_malloc(sizeof(struct easeds_slotmap_slot) * initial_capacity);
+    if (unlikely(map->data == NULL || map->erase == NULL || map->slots == NULL)) {
+        EASEDS_ERR("[easeds_slotmap_create]: Malloc slotmap arrays failed.");
+        easeds_slotmap_destroy(map);
+        return NULL;
+    }
+
+    map->name          = name;
+    map->element_size  = element_size;
+    map->capacity      = initial_capacity;
+    map->slot_capacity = initial_capacity;
+    map->free_head     = SLOTMAP_NIL;
+
+    PFL_DEBUG("[easeds_slotmap_create]: element_size=%u, initial_capacity=%u.", element_size,
+        initial_capacity);
+    return map;
+}
+
+// 销毁槽位映射, 释放内存
+void easeds_slotmap_destroy(struct easeds_slotmap *map)
+{
+    if (unlikely(map == NULL)) {
+        return;
+    }
+
+    __easeds_free(map->slots);
+    __easeds_free(map->erase);
+    __easeds_free(map->data);
+    __easeds_free(map);
+}
+
+// 删除所有对象, 所有旧句柄失效, 不释放内存
+void easeds_slotmap_clear(struct easeds_slotmap *map)
+{
+    if (unlikely(map == NULL)) {
+        return;
+    }
+
+    for (uint32_t i = 0; i < map->size; i++) {
+        slotmap_free_slot(map, map->erase[i]);
+    }
+    map->size = 0;
+}
+
+// 获取对象数量
+uint32_t easeds_slotmap_size(struct easeds_slotmap *map)
+{
+    if (unlikely(map == NULL)) {
+        return 0;
+    }
+    return map->size;
+}
+
+// 插入一个对象, element 为NULL时对象清零, 返回句柄, 失败返回 EASEDS_SLOTMAP_INVALID
+uint64_t easeds_slotmap_insert(struct easeds_slotmap *map, const void *element)
+{
+    if (unlikely(map == NULL)) {
+        EASEDS_ERR("[easeds_slotmap_insert]: Invalid slotmap pointer.");
+        return EASEDS_SLOTMAP_INVALID;
+    }
+
+    /* 先保证紧密数组有空间, 槽位分配之后不会再失败 */
+    if (map->size == map->capacity && slotmap_grow_dense(map) != 0) {
+        EASEDS_ERR("[easeds_slotmap_insert]: Grow dense array failed, size %u.", map->size);
+        return EASEDS_SLOTMAP_INVALID;
+    }
+
+    uint32_t slot = slotmap_alloc_slot(map);
+    if (unlikely(slot == SLOTMAP_NIL)) {
+        EASEDS_ERR("[easeds_slotmap_insert]: Grow slot array failed, slots %u.", map->slot_count);
+        return EASEDS_SLOTMAP_INVALID;
+    }
+
+    uint32_t index = map->size++;
+    uint8_t *dst   = map->data + (size_t)index * map->element_size;
+    if (element != NULL) {
+        memcpy(dst, element, map->element_size);
+    } else {
+        memset(dst, 0, map->element_size);
+    }
+
+    struct easeds_slotmap_slot *entry = &map->slots[slot];
+    entry->index                      = index;
+    entry->generation++;
+    map->erase[index] = slot;
+    return EASEDS_SLOTMAP_HANDLE(entry->generation, slot);
+}
+
+// 删除句柄对应的对象, 最后一个对象移到空洞处, 成功返回0, 句柄无效返回-1
+int32_t easeds_slotmap_remove(struct easeds_slotmap *map, uint64_t handle)
+{
+    if (unlikely(map == NULL)) {
+        EASEDS_ERR("[easeds_slotmap_remove]: Invalid slotmap pointer.");
+        return -1;
+    }
+
+    struct easeds_slotmap_slot *entry = slotmap_lookup(map, handle);
+    if (entry == NULL) {
+        return -1;
+    }
+
+    /* 最后一个对象移到空洞处, 并让它的槽位指向新位置 */
+    uint32_t index = entry->index;
+    uint32_t last  = --map->size;
+    if (index != last) {
+        memcpy(map->data + (size_t)index * map->element_size,
+            map->data + (size_t)last * map->element_size, map->element_size);
+        map->erase[index]                   = map->erase[last];
+        map->slots[map->erase[index]].index = index;
+    }
+
+    slotmap_free_slot(map, EASEDS_SLOTMAP_SLOT(handle));
+    return 0;
+}
+
+// 获取句柄对应的对象指针, 句柄无效或过期返回NULL
+void *easeds_slotmap_get(struct easeds_slotmap *map, uint64_t handle)
+{
+    if (unlikely(map == NULL)) {
+        return NULL;
+    }
+
+    struct easeds_slotmap_slot *entry = slotmap_lookup(map, handle);
+    if (entry == NULL) {
+        return NULL;
+    }
+    return map->data + (size_t)entry->index * map->element_size;
+}
+
+// 判断句柄是否有效
+bool easeds_slotmap_contains(struct easeds_slotmap *map, uint64_t handle)
+{
+    return map != NULL && slotmap_lookup(map, handle) != NULL;
+}
+
+// 获取紧密数组的起始地址, 前 size 个元素为全部对象, 插入和删除后可能改变
+void *easeds_slotmap_data(struct easeds_slotmap *map)
+{
+    if (unlikely(map == NULL)) {
+        return NULL;
+    }
+    return map->data;
+}
+
+// 获取紧密数组第 index 个对象的句柄, 越界返回 EASEDS_SLOTMAP_INVALID
+uint64_t easeds_slotmap_handle_at(struct easeds_slotmap *map, uint32_t index)
+{
+    if (unlikely(map == NULL || index >= map->size)) {
+        return EASEDS_SLOTMAP_INVALID;
+    }
+
+    uint32_t slot = map->erase[index];
+    return EASEDS_SLOTMAP_HANDLE(map->slots[slot].generation, slot);
+}
+
+// 按紧密数组顺序遍历所有对象, 回调中不能插入或删除对象
+void easeds_slotmap_foreach(struct easeds_slotmap *map,
+    void (*callback)(uint64_t handle, void *element, void *user_data), void *user_data)
+{
+    if (unlikely(map == NULL || callback == NULL)) {
+        return;
+    }
+
+    uint8_t *element = map->data;
+    for (uint32_t i = 0; i < map->size; i++, element += map->element_size) {
+        uint32_t slot = map->erase[i];
+        callback(EASEDS_SLOTMAP_HANDLE(map->slots[slot].generation, slot), element, user_data);
+    }
+}
@@ -0,0 +1,133 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-slotmap.h
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-18 23:25
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  槽位映射(Slot Map), 通过带代数的 64 位句柄访问对象, 能检测过期句柄, 对象在内存中紧密排列.
+ *
+ * @History:
+ *  2026年10月18日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#ifndef __EASEDS_SLOTMAP_H__
+#define __EASEDS_SLOTMAP_H__
+
+/* C 标准库头文件 */
+#include <stdbool.h>
+#include <stdint.h>
+
+/* 项目内部头文件 */
+#include "easeds-public.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 无效句柄, 有效句柄的代数总是奇数, 不会等于0 */
+#define EASEDS_SLOTMAP_INVALID 0ULL
+
+/* 槽位映射默认初始容量 */
+#define EASEDS_SLOTMAP_DEFAULT_INITIAL_CAPACITY 64
+
+/* 句柄的组成: 高 32 位为代数, 低 32 位为槽位下标 */
+#define EASEDS_SLOTMAP_HANDLE(gen, slot) (((uint64_t)(gen) << 32) | (uint64_t)(slot))
+#define EASEDS_SLOTMAP_SLOT(handle)      ((uint32_t)((handle) & 0xffffffffULL))
+#define EASEDS_SLOTMAP_GEN(handle)       ((uint32_t)((handle) >> 32))
+
+/* 槽位, 代数为奇数时占用, index 为对象在紧密数组中的位置; 为偶数时空闲, index 为下一个空闲槽位 */
+struct easeds_slotmap_slot {
+    uint32_t index;      /* 紧密数组下标或下一个空闲槽位 */
+    uint32_t generation; /* 代数, 每次插入和删除都加一 */
+};
+
+/**
+ * 实现一个槽位映射, 解决"动态数组交换删除后下标失效, 旧下标指向了别的对象"的问题.
+ *  (1) 插入返回 64 位句柄, 由槽位下标和代数组成; 槽位被删除或复用后代数改变, 旧句柄查找返回NULL.
+ *  (2) 对象紧密存放在 data 数组中, 删除时把最后一个对象移到空洞处并更新它的槽位,
+ *      遍历 data 的前 size 个元素就是全部对象, 没有空洞, 对缓存友好.
+ *  (3) erase 数组记录紧密数组每个位置对应的槽位, 用于删除时回填被移动对象的槽位, 以及遍历时取句柄.
+ *  (4) 插入/删除/查找都是 O(1): 查找只需访问一个槽位和一个对象.
+ *  (5) 空闲槽位组成后进先出链表; 代数即将回绕的槽位不再复用, 保证过期句柄永远不会重新生效.
+ *  (6) 对象在删除或扩容时会移动, 不要长期持有 get 返回的指针, 应该保存句柄.
+ *  (7) 非线程安全, 需要用户自行保证线程安全性.
+ */
+struct easeds_slotmap {
+    const char                 *name;          /* 名称, 预留字段, 可用于调试和日志输出 */
+    uint8_t                    *data;          /* 紧密排列的对象 */
+    uint32_t                   *erase;         /* 紧密数组下标对应的槽位 */
+    struct easeds_slotmap_slot *slots;         /* 槽位数组 */
+    uint32_t                    element_size;  /* 对象大小 */
+    uint32_t                    size;          /* 对象数量 */
+    uint32_t                    capacity;      /* data 和 erase 的容量 */
+    uint32_t                    slot_count;    /* 已使用过的槽位数量 */
+    uint32_t                    slot_capacity; /* 槽位数组容量 */
+    uint32_t                    free_head;     /* 空闲槽位链表头, UINT32_MAX 表示空 */
+    uint32_t                    retired;       /* 代数耗尽不再复用的槽位数量 */
+    uint32_t                    pad;           /* 对齐填充 */
+};
+
+/**
+ * 常见槽位映射操作函数:
+ *
+ * 函数名                       功能描述
+ * ------------------------     ------------------------------------------------------
+ * easeds_slotmap_create        创建一个槽位映射, 失败返回NULL
+ * easeds_slotmap_destroy       销毁槽位映射, 释放内存
+ * easeds_slotmap_clear         删除所有对象, 所有旧句柄失效, 不释放内存
+ * easeds_slotmap_size          获取对象数量
+ * easeds_slotmap_insert        插入一个对象, 返回句柄, 失败返回 EASEDS_SLOTMAP_INVALID
+ * easeds_slotmap_remove        删除句柄对应的对象, 成功返回0, 句柄无效返回-1
+ * easeds_slotmap_get           获取句柄对应的对象指针, 句柄无效返回NULL
+ * easeds_slotmap_contains      判断句柄是否有效
+ * easeds_slotmap_data          获取紧密数组的起始地址, 前 size 个元素为全部对象
+ * easeds_slotmap_handle_at     获取紧密数组第 index 个对象的句柄
+ * easeds_slotmap_foreach       按紧密数组顺序遍历所有对象
+ */
+
+// 创建一个槽位映射, initial_capacity 为0时使用默认初始容量, 失败返回NULL
+struct easeds_slotmap *easeds_slotmap_create(
+    const char *name, uint32_t element_size, uint32_t initial_capacity);
+
+// 销毁槽位映射, 释放内存
+void easeds_slotmap_destroy(struct easeds_slotmap *map);
+
+// 删除所有对象, 所有旧句柄失效, 不释放内存
+void easeds_slotmap_clear(struct easeds_slotmap *map);
+
+// 获取对象数量
+uint32_t easeds_slotmap_size(struct easeds_slotmap *map);
+
+// 插入一个对象, element 为NULL时对象清零, 返回句柄, 失败返回 EASEDS_SLOTMAP_INVALID
+uint64_t easeds_slotmap_insert(struct easeds_slotmap *map, const void *element);
+
+// 删除句柄对应的对象, 最后一个对象移到空洞处, 成功返回0, 句柄无效返回-1
+int32_t easeds_slotmap_remove(struct easeds_slotmap *map, uint64_t handle);
+
+// 获取句柄对应的对象指针, 句柄无效或过期返回NULL
+void *easeds_slotmap_get(struct easeds_slotmap *map, uint64_t handle);
+
+// 判断句柄是否有效
+bool easeds_slotmap_contains(struct easeds_slotmap *map, uint64_t handle);
+
+// 获取紧密数组的起始地址, 前 size 个元素为全部对象, 插入和删除后可能改变
+void *easeds_slotmap_data(struct easeds_slotmap *map);
+
+// 获取紧密数组第 index 个对象的句柄, 越界返回 EASEDS_SLOTMAP_INVALID
+uint64_t easeds_slotmap_handle_at(struct easeds_slotmap *map, uint32_t index);
+
+// 按紧密数组顺序遍历所有对象, 回调中不能插入或删除对象
+void easeds_slotmap_foreach(struct easeds_slotmap *map,
+    void (*callback)(uint64_t handle, void *element, void *user_data), void *user_data);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __EASEDS_SLOTMAP_H__ */
@@ -0,0 +1,279 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-smallvec-unittest.c
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-18 23:40
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  Easeds 小数组单元测试实现文件, 包含了内联存储/溢出到堆/搬回内联存储/栈上定义和性能测试.
+ *
+ * @History:
+ *  2026年10月18日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#include "easeds-unittest.h"
+
+// 项目内部头文件
+#include "easeds-array.h"
+#include "easeds-smallvec.h"
+#include "easeds-utils.h"
+
+// 遍历回调: 累加元素值
+static void smallvec_sum_cb(void *element, void *user_data)
+{
+    *(uint64_t *)user_data += *(uint32_t *)element;
+}
+
+// 查找回调: 元素值等于目标值
+static bool smallvec_equal_cb(void *element, void *user_data)
+{
+    return *(uint32_t *)element == *(uint32_t *)user_data;
+}
+
+// 获取第 index 个元素的值, 失败返回 UINT32_MAX
+static uint32_t smallvec_value(struct easeds_smallvec *vec, uint32_t index)
+{
+    uint32_t *pvalue = NULL;
+    if (easeds_smallvec_get(vec, index, (void **)&pvalue) != 0 || pvalue == NULL) {
+        return UINT32_MAX;
+    }
+    return *pvalue;
+}
+
+// 基本功能测试: 创建/内联存储/栈上定义/销毁
+static void test_easeds_smallvec_basic(void **state)
+{
+    easeds_unused(state);
+
+    struct easeds_smallvec *vec = easeds_smallvec_create("basic", sizeof(uint32_t), 4);
+    assert_non_null(vec);
+    assert_int_equal(easeds_smallvec_size(vec), 0);
+    assert_int_equal(easeds_smallvec_capacity(vec), 4);
+    assert_true(easeds_smallvec_is_empty(vec));
+    assert_true(easeds_smallvec_is_inline(vec));
+
+    /* 内联存储紧跟在结构体之后 */
+    assert_ptr_equal(vec->inline_elements, vec + 1);
+    easeds_smallvec_destroy(vec);
+
+    /* 栈上定义, 不超过内联容量时不申请任何内存 */
+    EASEDS_SMALLVEC_DEFINE(local, uint32_t, 8);
+    for (uint32_t i = 0; i < 8; i++) {
+        assert_int_equal(easeds_smallvec_push_back(&local, &i), EASEDS_OK);
+    }
+    assert_true(easeds_smallvec_is_inline(&local));
+    assert_ptr_equal(local.elements, local_inline);
+    assert_int_equal(local_inline[7], 7);
+    easeds_smallvec_fini(&local);
+}
+
+// 基本功能测试: 溢出到堆, 插入/删除/修改/遍历/查找
+static void test_easeds_smallvec_operations(void **state)
+{
+    easeds_unused(state);
+
+    EASEDS_SMALLVEC_DEFINE(vec, uint32_t, 4);
+
+    for (uint32_t i = 0; i < 10; i++) {
+        uint32_t value = i * 10;
+        assert_int_equal(easeds_smallvec_push_back(&vec, &value), EASEDS_OK);
+        assert_int_equal(easeds_smallvec_size(&vec), i + 1);
+        assert_int_equal(easeds_smallvec_is_inline(&vec), i < 4);
+    }
+    assert_int_equal(easeds_smallvec_capacity(&vec), 16);
+    for (uint32_t i = 0; i < 10; i++) {
+        assert_int_equal(smallvec_value(&vec, i), i * 10);
+    }
+
+    /* 头部插入, 中间删除, 修改 */
+    uint32_t value = 1000;
+    assert_int_equal(easeds_smallvec_insert(&vec, 0, &value), EASEDS_OK);
+    assert_int_equal(smallvec_value(&vec, 0), 1000);
+    assert_int_equal(smallvec_value(&vec, 1), 0);
+    assert_int_equal(easeds_smallvec_remove(&vec, 5), EASEDS_OK);
+    assert_int_equal(smallvec_value(&vec, 5), 50);
+    value = 7;
+    assert_int_equal(easeds_smallvec_set(&vec, 9, &value), EASEDS_OK);
+    assert_int_equal(smallvec_value(&vec, 9), 7);
+    assert_int_equal(easeds_smallvec_size(&vec), 10);
+
+    uint64_t sum = 0;
+    easeds_smallvec_foreach(&vec, smallvec_sum_cb, &sum);
+    assert_int_equal(sum, 1000 + 0 + 10 + 20 + 30 + 50 + 60 + 70 + 80 + 7);
+
+    value           = 60;
+    uint32_t *found = easeds_smallvec_find(&vec, smallvec_equal_cb, &value);
+    assert_non_null(found);
+    assert_int_equal(*found, 60);
+    value = 40;
+    assert_null(easeds_smallvec_find(&vec, smallvec_equal_cb, &value));
+
+    assert_int_equal(easeds_smallvec_pop_back(&vec), EASEDS_OK);
+    assert_int_equal(easeds_smallvec_size(&vec), 9);
+    easeds_smallvec_fini(&vec);
+    assert_true(easeds_smallvec_is_inline(&vec));
+    assert_int_equal(easeds_smallvec_size(&vec), 0);
+}
+
+// 边界测试: 搬回内联存储, 默认内联容量, 无内联存储, 嵌入结构体, 清空
+static void test_easeds_smallvec_boundary(void **state)
+{
+    easeds_unused(state);
+
+    struct easeds_smallvec *vec = easeds_smallvec_create("boundary", sizeof(uint32_t), 0);
+    assert_non_null(vec);
+    assert_int_equal(easeds_smallvec_capacity(vec), EASEDS_SMALLVEC_DEFAULT_INLINE_CAPACITY);
+
+    for (uint32_t i = 0; i < 20; i++) {
+        assert_int_equal(easeds_smallvec_push_back(vec, &i), EASEDS_OK);
+    }
+    assert_false(easeds_smallvec_is_inline(vec));
+
+    /* 删除到内联容量以内后缩容, 元素搬回内联存储 */
+    while (easeds_smallvec_size(vec) > 5) {
+        assert_int_equal(easeds_smallvec_pop_back(vec), EASEDS_OK);
+    }
+    assert_int_equal(easeds_smallvec_resize(vec, 5), EASEDS_OK);
+    assert_true(easeds_smallvec_is_inline(vec));
+    assert_int_equal(easeds_smallvec_capacity(vec), EASEDS_SMALLVEC_DEFAULT_INLINE_CAPACITY);
+    for (uint32_t i = 0; i < 5; i++) {
+        assert_int_equal(smallvec_value(vec, i), i);
+    }
+
+    /* 在内联存储中扩容到指定容量, 再缩回 */
+    assert_int_equal(easeds_smallvec_resize(vec, 100), EASEDS_OK);
+    assert_false(easeds_smallvec_is_inline(vec));
+    assert_int_equal(easeds_smallvec_capacity(vec), 100);
+    assert_int_equal(smallvec_value(vec, 4), 4);
+    assert_int_equal(easeds_smallvec_resize(vec, 8), EASEDS_OK);
+    assert_true(easeds_smallvec_is_inline(vec));
+
+    easeds_smallvec_clear(vec);
+    assert_true(easeds_smallvec_is_empty(vec));
+    easeds_smallvec_destroy(vec);
+
+    /* 没有内联存储时退化为普通动态数组 */
+    struct easeds_smallvec heap;
+    assert_int_equal(easeds_smallvec_init(&heap, "heap", sizeof(uint64_t), NULL, 0, NULL), 0);
+    for (uint64_t i = 0; i < 100; i++) {
+        assert_int_equal(easeds_smallvec_push_back(&heap, &i), EASEDS_OK);
+    }
+    assert_int_equal(easeds_smallvec_size(&heap), 100);
+    assert_false(easeds_smallvec_is_inline(&heap));
+    easeds_smallvec_destroy(&heap);
+    assert_int_equal(easeds_smallvec_capacity(&heap), 0);
+
+    /* 嵌入其他结构体 */
+    struct {
+        struct easeds_smallvec vec;
+        uint16_t               buf[4];
+    } holder;
+    assert_int_equal(
+        easeds_smallvec_init(&holder.vec, "holder", sizeof(uint16_t), holder.buf, 4, NULL), 0);
+    uint16_t half = 0xbeef;
+    assert_int_equal(easeds_smallvec_insert(&holder.vec, 0, &half), EASEDS_OK);
+    assert_int_equal(holder.buf[0], 0xbeef);
+    easeds_smallvec_fini(&holder.vec);
+}
+
+// 失效测试: 空指针, 越界, 空数组, 非法容量
+static void test_easeds_smallvec_error(void **state)
+{
+    easeds_unused(state);
+
+    uint32_t  value  = 7;
+    uint32_t *pvalue = NULL;
+
+    assert_null(easeds_smallvec_create("error", 0, 4));
+    assert_int_equal(easeds_smallvec_init(NULL, "error", 4, NULL, 0, NULL), -1);
+
+    struct easeds_smallvec vec;
+    assert_int_equal(easeds_smallvec_init(&vec, "error", 4, NULL, 4, NULL), -1);
+    assert_int_equal(easeds_smallvec_push_back(NULL, &value), -1);
+    assert_int_equal(easeds_smallvec_pop_back(NULL), -1);
+    assert_int_equal(easeds_smallvec_get(NULL, 0, (void **)&pvalue), -1);
+    assert_int_equal(easeds_smallvec_size(NULL), 0);
+    assert_true(easeds_smallvec_is_empty(NULL));
+    assert_false(easeds_smallvec_is_inline(NULL));
+    easeds_smallvec_destroy(NULL);
+    easeds_smallvec_fini(NULL);
+
+    EASEDS_SMALLVEC_DEFINE(local, uint32_t, 2);
+    assert_int_equal(easeds_smallvec_push_back(&local, NULL), -1);
+    assert_int_equal(easeds_smallvec_pop_back(&local), -1);
+    assert_int_equal(easeds_smallvec_get(&local, 0, (void **)&pvalue), -1);
+    assert_int_equal(easeds_smallvec_get(&local, 0, NULL), -1);
+    assert_int_equal(easeds_smallvec_set(&local, 0, &value), -1);
+    assert_int_equal(easeds_smallvec_remove(&local, 0), -1);
+    assert_int_equal(easeds_smallvec_insert(&local, 1, &value), -1);
+    assert_int_equal(easeds_smallvec_push_back(&local, &value), EASEDS_OK);
+    assert_int_equal(easeds_smallvec_resize(&local, 0), -1);
+    assert_null(easeds_smallvec_find(&local, NULL, NULL));
+    easeds_smallvec_foreach(&local, NULL, NULL);
+    assert_int_equal(easeds_smallvec_size(&local), 1);
+    easeds_smallvec_fini(&local);
+}
+
+// 性能测试: 每次请求构造一个少量元素的数组, 对比小数组和动态数组
+static void test_easeds_smallvec_perf(void **state)
+{
+    easeds_unused(state);
+
+    const uint32_t rounds = 1000000;
+    uint64_t       seed   = 88172645463325252ULL;
+    uint64_t       sum    = 0;
+
+    /* 每轮元素数量 1~8, 绝大部分落在内联存储中 */
+    int64_t start = easeds_get_current_time_ns();
+    for (uint32_t r = 0; r < rounds; r++) {
+        EASEDS_SMALLVEC_DEFINE(vec, uint32_t, 8);
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+        uint32_t n = (uint32_t)(seed & 7) + 1;
+        for (uint32_t i = 0; i < n; i++) {
+            (void)easeds_smallvec_push_back(&vec, &i);
+        }
+        easeds_smallvec_foreach(&vec, smallvec_sum_cb, &sum);
+        easeds_smallvec_fini(&vec);
+    }
+    double smallvec_ns = (double)(easeds_get_current_time_ns() - start) / rounds;
+
+    uint64_t array_sum = 0;
+    seed               = 88172645463325252ULL;
+    start              = easeds_get_current_time_ns();
+    for (uint32_t r = 0; r < rounds; r++) {
+        struct easeds_array *array = easeds_array_create("perf", sizeof(uint32_t), 0);
+        assert_non_null(array);
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+        uint32_t n = (uint32_t)(seed & 7) + 1;
+        for (uint32_t i = 0; i < n; i++) {
+            (void)easeds_array_push_back(array, &i);
+        }
+        easeds_array_foreach(array, smallvec_sum_cb, &array_sum);
+        easeds_array_destroy(array);
+    }
+    double array_ns = (double)(easeds_get_current_time_ns() - start) / rounds;
+    assert_int_equal(sum, array_sum);
+
+    MEASURE("[smallvec perf]: %u rounds of 1~8 elements, smallvec %.1f ns/round, "
+            "array %.1f ns/round.",
+        rounds, smallvec_ns, array_ns);
+}
+
+// 注册单元测试用例
+EASEDS_UNITTEST_REGISTER(easeds_unittest_smallvec){
+    cmocka_unit_test(test_easeds_smallvec_basic),
+    cmocka_unit_test(test_easeds_smallvec_operations),
+    cmocka_unit_test(test_easeds_smallvec_boundary),
+    cmocka_unit_test(test_easeds_smallvec_error),
+    cmocka_unit_test(test_easeds_smallvec_perf),
+    easeds_unit_test_end,
+};
@@ -0,0 +1,456 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-smallvec.c
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-18 23:40
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  小数组常见操作实现.
+ *
+ * @History:
+ *  2026年10月18日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#include "easeds-smallvec.h"
+
+// 标准库头文件
+#include <stdlib.h>
+#include <string.h>
+
+// 项目内部头文件
+#include "easeds-log.h"
+
+// 从小数组的分配器申请内存
+static inline void *smallvec_mem_alloc(const struct easeds_allocator *allocator, size_t size)
+{
+    if (allocator == NULL) {
+        return __easeds_malloc(size);
+    }
+    return allocator->alloc_fn(allocator->ctx, size);
+}
+
+// 从小数组的分配器重新申请内存, 失败时原内存保持不变
+static inline void *smallvec_mem_realloc(
+    const struct easeds_allocator *allocator, void *ptr, size_t old_size, size_t size)
+{
+    if (allocator == NULL) {
+        return realloc(ptr, size);
+    }
+    return allocator->realloc_fn(allocator->ctx, ptr, old_size, size);
+}
+
+// 释放小数组分配器申请的内存
+static inline void smallvec_mem_free(
+    const struct easeds_allocator *allocator, void *ptr, size_t size)
+{
+    if (allocator == NULL) {
+        __easeds_free(ptr);
+        return;
+    }
+    allocator->free_fn(allocator->ctx, ptr, size);
+}
+
+// 判断元素是否存放在内联存储中
+static inline bool smallvec_on_inline(const struct easeds_smallvec *vec)
+{
+    return vec->elements == vec->inline_elements;
+}
+
+// 获取第 index 个元素的地址
+static inline uint8_t *smallvec_at(const struct easeds_smallvec *vec, uint32_t index)
+{
+    return (uint8_t *)vec->elements + (size_t)index * vec->element_size;
+}
+
+// 调整元素内存, 不超过内联容量时搬回内联存储, 否则搬到堆内存或重新申请, 成功返回0, 失败返回-1
+static int32_t smallvec_mem_grow(struct easeds_smallvec *vec, uint32_t new_capacity)
+{
+    size_t bytes = (size_t)vec->element_size * vec->size;
+
+    if (new_capacity <= vec->inline_capacity) {
+        if (!smallvec_on_inline(vec)) {
+            memcpy(vec->inline_elements, vec->elements, bytes);
+            smallvec_mem_free(
+                vec->allocator, vec->elements, (size_t)vec->element_size * vec->capacity);
+            vec->elements = vec->inline_elements;
+        }
+        vec->capacity = vec->inline_capacity;
+        return 0;
+    }
+
+    void *new_elements;
+    if (smallvec_on_inline(vec)) {
+        /* 第一次溢出内联存储, 元素整体搬到堆内存上 */
+        new_elements = smallvec_mem_alloc(vec->allocator, (size_t)vec->element_size * new_capacity);
+        if (unlikely(new_elements == NULL)) {
+            return -1;
+        }
+        if (bytes != 0) {
+            memcpy(new_elements, vec->elements, bytes);
+        }
+    } else {
+        new_elements = smallvec_mem_realloc(vec->allocator, vec->elements,
+            (size_t)vec->element_size * vec->capacity, (size_t)vec->element_size * new_capacity);
+        if (unlikely(new_elements == NULL)) {
+            return -1;
+        }
+    }
+
+    vec->elements = new_elements;
+    vec->capacity = new_capacity;
+    return 0;
+}
+
+// 保证还能再放入一个元素, 容量不足时按2倍扩容, 成功返回0, 失败返回-1
+static inline int32_t smallvec_reserve_one(struct easeds_smallvec *vec)
+{
+    if (likely(vec->size < vec->capacity)) {
+        return 0;
+    }
+    if (unlikely(vec->capacity >= UINT32_MAX / 2)) {
+        return -1;
+    }
+
+    uint32_t new_capacity =
+        vec->capacity != 0 ? vec->capacity * 2 : EASEDS_SMALLVEC_DEFAULT_INLINE_CAPACITY;
+    if (unlikely(smallvec_mem_grow(vec, new_capacity) != 0)) {
+        return -1;
+    }
+
+    PFL_DEBUG("Expanded smallvec capacity to %u.", new_capacity);
+    return 0;
+}
+
+/**
+ * @description: 创建一个小数组, 结构体和内联存储一次申请, 返回小数组指针, 失败返回NULL.
+ * @param name 名称, 预留字段, 可用于调试和日志输出
+ * @param element_size 元素大小, 单位字节
+ * @param inline_capacity 内联容量, 如果为0则使用默认内联容量
+ * @return 成功返回小数组指针, 失败返回NULL
+ */
+struct easeds_smallvec *easeds_smallvec_create(
+    const char *name, uint32_t element_size, uint32_t inline_capacity)
+{
+    return easeds_smallvec_create_alloc(name, element_size, inline_capacity, NULL);
+}
+
+/**
+ * @description: 使用指定的内存分配器创建小数组, 结构体, 内联存储和堆内存都从分配器申请.
+ * @param name 名称, 预留字段, 可用于调试和日志输出
+ * @param element_size 元素大小, 单位字节
+ * @param inline_capacity 内联容量, 如果为0则使用默认内联容量
+ * @param allocator 内存分配器, 为NULL时使用 __easeds_malloc, 生命周期需要长于小数组
+ * @return 成功返回小数组指针, 失败返回NULL
+ */
+struct easeds_smallvec *easeds_smallvec_create_alloc(const char *name, uint32_t element_size,
+    uint32_t inline_capacity, const struct easeds_allocator *allocator)
+{
+    if (unlikely(element_size == 0)) {
+        EASEDS_ERR("[easeds_smallvec_create]: Invalid element size 0.");
+        return NULL;
+    }
+    if (inline_capacity == 0) {
+        inline_capacity = EASEDS_SMALLVEC_DEFAULT_INLINE_CAPACITY;
+    }
+
+    /* 内联存储紧跟在结构体之后, 结构体大小是8的倍数, 内联存储按8字节对齐 */
+    size_t bytes = sizeof(struct easeds_smallvec) + (size_t)element_size * inline_capacity;
+    struct easeds_smallvec *vec = smallvec_mem_alloc(allocator, bytes);
+    if (unlikely(vec == NULL)) {
+        EASEDS_ERR("[easeds_smallvec_create]: Failed to allocate memory for smallvec.");
+        return NULL;
+    }
+
+    (void)easeds_smallvec_init(vec, name, element_size, vec + 1, inline_capacity, allocator);
+    vec->flags |= EASEDS_SMALLVEC_F_OWNED;
+    return vec;
+}
+
+// 使用用户提供的内联存储初始化小数组, inline_elements 至少容纳 inline_capacity 个元素, 成功返回0
+int32_t easeds_smallvec_init(struct easeds_smallvec *vec, const char *name, uint32_t element_size,
+    void *inline_elements, uint32_t inline_capacity, const struct easeds_allocator *allocator)
+{
+    if (unlikely(vec == NULL || element_size == 0)) {
+        EASEDS_ERR("[easeds_smallvec_init]: Invalid smallvec pointer or element size.");
+        return -1;
+    }
+    if (unlikely(inline_elements == NULL && inline_capacity != 0)) {
+        EASEDS_ERR("[easeds_smallvec_init]: Invalid inline storage for capacity %u.",
+            inline_capacity);
+        return -1;
+    }
+
+    vec->name            = name;
+    vec->elements        = inline_elements;
+    vec->inline_elements = inline_elements;
+    vec->allocator       = allocator;
+    vec->element_size    = element_size;
+    vec->size            = 0;
+    vec->capacity        = inline_capacity;
+    vec->inline_capacity = inline_capacity;
+    vec->flags           = 0;
+    vec->pad             = 0;
+
+    PFL_DEBUG("Initialized smallvec: element_size=%u, inline_capacity=%u", element_size,
+        inline_capacity);
+    return 0;
+}
+
+// 释放小数组申请的堆内存, 元素清空并回到内联存储, 不释放结构体和内联存储
+void easeds_smallvec_fini(struct easeds_smallvec *vec)
+{
+    if (unlikely(vec == NULL)) {
+        return;
+    }
+
+    if (!smallvec_on_inline(vec)) {
+        smallvec_mem_free(vec->allocator, vec->elements, (size_t)vec->element_size * vec->capacity);
+    }
+    vec->elements = vec->inline_elements;
+    vec->size     = 0;
+    vec->capacity = vec->inline_capacity;
+}
+
+// 销毁小数组, 释放堆内存, 结构体由 create 申请时一并释放
+void easeds_smallvec_destroy(struct easeds_smallvec *vec)
+{
+    if (unlikely(vec == NULL)) {
+        return;
+    }
+
+    easeds_smallvec_fini(vec);
+    if (vec->flags & EASEDS_SMALLVEC_F_OWNED) {
+        size_t bytes =
+            sizeof(struct easeds_smallvec) + (size_t)vec->element_size * vec->inline_capacity;
+        smallvec_mem_free(vec->allocator, vec, bytes);
+    }
+
+    PFL_DEBUG("Destroyed smallvec.");
+}
+
+// 清空小数组, 删除所有元素, 但不释放内存
+void easeds_smallvec_clear(struct easeds_smallvec *vec)
+{
+    if (unlikely(vec == NULL)) {
+        return;
+    }
+
+    vec->size = 0; /* 仅重置元素数量, 不释放内存 */
+}
+
+// 获取当前元素数量
+uint32_t easeds_smallvec_size(struct easeds_smallvec *vec)
+{
+    if (unlikely(vec == NULL)) {
+        EASEDS_ERR("[easeds_smallvec_size]: Invalid smallvec pointer.");
+        return 0;
+    }
+
+    return vec->size;
+}
+
+// 获取当前容量
+uint32_t easeds_smallvec_capacity(struct easeds_smallvec *vec)
+{
+    if (unlikely(vec == NULL)) {
+        EASEDS_ERR("[easeds_smallvec_capacity]: Invalid smallvec pointer.");
+        return 0;
+    }
+
+    return vec->capacity;
+}
+
+// 判断小数组是否为空, 为空返回true, 否则返回false
+bool easeds_smallvec_is_empty(struct easeds_smallvec *vec)
+{
+    return vec == NULL || vec->size == 0;
+}
+
+// 判断元素是否存放在内联存储中
+bool easeds_smallvec_is_inline(struct easeds_smallvec *vec)
+{
+    return vec != NULL && smallvec_on_inline(vec);
+}
+
+// 调整容量, 新容量不能小于当前元素数量, 不超过内联容量时搬回内联存储, 成功返回0, 失败返回-1
+int32_t easeds_smallvec_resize(struct easeds_smallvec *vec, uint32_t new_capacity)
+{
+    if (unlikely(vec == NULL)) {
+        EASEDS_ERR("[easeds_smallvec_resize]: Invalid smallvec pointer.");
+        return -1;
+    }
+
+    if (new_capacity == 0 || new_capacity < vec->size) {
+        EASEDS_ERR("[easeds_smallvec_resize]: Invalid capacity %u, size is %u.", new_capacity,
+            vec->size);
+        return -1;
+    }
+
+    if (new_capacity == vec->capacity) {
+        return 0;
+    }
+
+    if (unlikely(smallvec_mem_grow(vec, new_capacity) != 0)) {
+        EASEDS_ERR("[easeds_smallvec_resize]: Failed to reallocate memory for capacity %u.",
+            new_capacity);
+        return -1;
+    }
+
+    PFL_DEBUG("Resized smallvec capacity to %u.", vec->capacity);
+    return 0;
+}
+
+// 在末尾添加一个元素, 成功返回0, 失败返回-1
+int32_t easeds_smallvec_push_back(struct easeds_smallvec *vec, const void *element)
+{
+    if (unlikely(vec == NULL || element == NULL)) {
+        EASEDS_ERR("[easeds_smallvec_push_back]: Invalid smallvec or element pointer.");
+        return -1;
+    }
+
+    if (unlikely(smallvec_reserve_one(vec) != 0)) {
+        EASEDS_ERR("[easeds_smallvec_push_back]: Failed to expand smallvec, size is %u.",
+            vec->size);
+        return -1;
+    }
+
+    memcpy(smallvec_at(vec, vec->size), element, vec->element_size);
+    vec->size++;
+    return 0;
+}
+
+// 删除末尾的一个元素, 成功返回0, 失败返回-1
+int32_t easeds_smallvec_pop_back(struct easeds_smallvec *vec)
+{
+    if (unlikely(vec == NULL)) {
+        EASEDS_ERR("[easeds_smallvec_pop_back]: Invalid smallvec pointer.");
+        return -1;
+    }
+
+    if (vec->size == 0) {
+        EASEDS_ERR("[easeds_smallvec_pop_back]: Cannot pop from an empty smallvec.");
+        return -1;
+    }
+
+    vec->size--;
+    return 0;
+}
+
+// 在指定索引位置插入一个元素, 成功返回0, 失败返回-1
+int32_t easeds_smallvec_insert(struct easeds_smallvec *vec, uint32_t index, const void *element)
+{
+    if (unlikely(vec == NULL || element == NULL)) {
+        EASEDS_ERR("[easeds_smallvec_insert]: Invalid smallvec or element pointer.");
+        return -1;
+    }
+
+    if (index > vec->size) {
+        EASEDS_ERR(
+            "[easeds_smallvec_insert]: Index %u out of bounds, size is %u.", index, vec->size);
+        return -1;
+    }
+
+    if (unlikely(smallvec_reserve_one(vec) != 0)) {
+        EASEDS_ERR("[easeds_smallvec_insert]: Failed to expand smallvec, size is %u.", vec->size);
+        return -1;
+    }
+
+    /* 后面的元素整体后移一个位置, element 不能指向小数组内部 */
+    uint8_t *dest = smallvec_at(vec, index);
+    memmove(dest + vec->element_size, dest, (size_t)(vec->size - index) * vec->element_size);
+    memcpy(dest, element, vec->element_size);
+    vec->size++;
+    return 0;
+}
+
+// 删除指定索引位置的元素, 成功返回0, 失败返回-1
+int32_t easeds_smallvec_remove(struct easeds_smallvec *vec, uint32_t index)
+{
+    if (unlikely(vec == NULL)) {
+        EASEDS_ERR("[easeds_smallvec_remove]: Invalid smallvec pointer.");
+        return -1;
+    }
+
+    if (index >= vec->size) {
+        EASEDS_ERR(
+            "[easeds_smallvec_remove]: Index %u out of bounds, size is %u.", index, vec->size);
+        return -1;
+    }
+
+    uint8_t *dest = smallvec_at(vec, index);
+    memmove(dest, dest + vec->element_size, (size_t)(vec->size - index - 1) * vec->element_size);
+    vec->size--;
+    return 0;
+}
+
+// 获取指定索引位置的元素指针, 成功返回0, 失败返回-1
+int32_t easeds_smallvec_get(struct easeds_smallvec *vec, uint32_t index, void **element)
+{
+    if (unlikely(vec == NULL || element == NULL)) {
+        EASEDS_ERR("[easeds_smallvec_get]: Invalid smallvec or element pointer.");
+        return -1;
+    }
+
+    if (index >= vec->size) {
+        EASEDS_ERR("[easeds_smallvec_get]: Index %u out of bounds, size is %u.", index, vec->size);
+        return -1;
+    }
+
+    *element = smallvec_at(vec, index);
+    return 0;
+}
+
+// 设置指定索引位置的元素值, 成功返回0, 失败返回-1
+int32_t easeds_smallvec_set(struct easeds_smallvec *vec, uint32_t index, const void *element)
+{
+    if (unlikely(vec == NULL || element == NULL)) {
+        EASEDS_ERR("[easeds_smallvec_set]: Invalid smallvec or element pointer.");
+        return -1;
+    }
+
+    if (index >= vec->size) {
+        EASEDS_ERR("[easeds_smallvec_set]: Index %u out of bounds, size is %u.", index, vec->size);
+        return -1;
+    }
+
+    memcpy(smallvec_at(vec, index), element, vec->element_size);
+    return 0;
+}
+
+// 遍历元素, 对每个元素执行指定的回调函数
+void easeds_smallvec_foreach(struct easeds_smallvec *vec,
+    void (*callback)(void *element, void *user_data), void *user_data)
+{
+    if (unlikely(vec == NULL || callback == NULL)) {
+        EASEDS_ERR("[easeds_smallvec_foreach]: Invalid smallvec pointer or callback function.");
+        return;
+    }
+
+    uint8_t *element = vec->elements;
+    for (uint32_t i = 0; i < vec->size; i++, element += vec->element_size) {
+        callback(element, user_data);
+    }
+}
+
+// 查找满足条件的元素, 返回元素指针, 未找到返回NULL
+void *easeds_smallvec_find(struct easeds_smallvec *vec,
+    bool (*predicate)(void *element, void *user_data), void *user_data)
+{
+    if (unlikely(vec == NULL || predicate == NULL)) {
+        EASEDS_ERR("[easeds_smallvec_find]: Invalid smallvec pointer or predicate function.");
+        return NULL;
+    }
+
+    uint8_t *element = vec->elements;
+    for (uint32_t i = 0; i < vec->size; i++, element += vec->element_size) {
+        if (predicate(element, user_data)) {
+            return element;
+        }
+    }
+    return NULL;
+}
@@ -0,0 +1,170 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-smallvec.h
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-18 23:40
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  小数组(Small Vector), 前 N 个元素存放在内联存储中, 超过 N 个才申请堆内存, 可以直接定义在栈上.
+ *
+ * @History:
+ *  2026年10月18日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#ifndef __EASEDS_SMALLVEC_H__
+#define __EASEDS_SMALLVEC_H__
+
+/* C 标准库头文件 */
+#include <stdbool.h>
+#include <stdint.h>
+
+/* 项目内部头文件 */
+#include "easeds-public.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// 小数组默认内联容量, 仅在 easeds_smallvec_create 传入0时使用
+#define EASEDS_SMALLVEC_DEFAULT_INLINE_CAPACITY 8
+
+// 小数组标志位: 结构体由 easeds_smallvec_create 申请, 销毁时需要释放
+#define EASEDS_SMALLVEC_F_OWNED 0x1U
+
+/**
+ * 实现一个带内联存储的动态数组, 操作集合和 easeds_array 一致, 适合大多数情况下只有少量元素的场景.
+ *  (1) 前 inline_capacity 个元素存放在内联存储中, 没有任何堆内存申请; 元素数量超过内联容量时,
+ *      才把元素整体搬到堆内存上, 之后按2倍扩容.
+ *  (2) 通过 EASEDS_SMALLVEC_DEFINE 可以直接在栈上定义小数组, 内联存储和结构体都在栈上,
+ *      使用完毕后调用 easeds_smallvec_fini 释放可能申请的堆内存.
+ *  (3) 也可以把内联存储和结构体嵌入其他结构体中, 通过 easeds_smallvec_init 初始化.
+ *  (4) easeds_smallvec_create 一次申请结构体和内联存储, 只需要一次内存申请, 通过 destroy 释放.
+ *  (5) easeds_smallvec_resize 的新容量不超过内联容量时, 元素搬回内联存储并释放堆内存.
+ *  (6) 元素在扩容和搬回内联存储时会移动, 不要长期持有 get 返回的指针.
+ *  (7) 小数组非线程安全, 需要用户自行保证线程安全性.
+ *  (8) 可以指定内存分配器(如 arena), 堆内存从分配器申请, 未指定时使用 __easeds_malloc.
+ */
+struct easeds_smallvec {
+    const char                    *name;            /* 名称, 预留字段, 可用于调试和日志输出 */
+    void                          *elements;        /* 当前元素地址, 指向内联存储或堆内存 */
+    void                          *inline_elements; /* 内联存储 */
+    const struct easeds_allocator *allocator;       /* 内存分配器, NULL 表示使用 __easeds_malloc */
+    uint32_t                       element_size;    /* 元素大小 */
+    uint32_t                       size;            /* 当前元素数量 */
+    uint32_t                       capacity;        /* 当前容量 */
+    uint32_t                       inline_capacity; /* 内联存储容量 */
+    uint32_t                       flags;           /* 标志位, EASEDS_SMALLVEC_F_* */
+    uint32_t                       pad;             /* 对齐填充 */
+};
+
+// 小数组静态初始化, buf 为内联存储数组, n 为内联容量
+#define EASEDS_SMALLVEC_INITIALIZER(vec_name, type, buf, n)                                 \
+    {                                                                                       \
+        .name = (vec_name), .elements = (buf), .inline_elements = (buf), .allocator = NULL, \
+        .element_size = (uint32_t)sizeof(type), .size = 0, .capacity = (uint32_t)(n),       \
+        .inline_capacity = (uint32_t)(n), .flags = 0, .pad = 0,                             \
+    }
+
+// 在当前作用域定义一个内联 n 个 type 元素的小数组 var, 使用完毕后需要调用 easeds_smallvec_fini
+#define EASEDS_SMALLVEC_DEFINE(var, type, n)                                              \
+    type                   var##_inline[n];                                               \
+    struct easeds_smallvec var = EASEDS_SMALLVEC_INITIALIZER(#var, type, var##_inline, n)
+
+/**
+ * 常见小数组操作函数:
+ *
+ * 函数名                       功能描述
+ * ------------------------     ------------------------------------------------------
+ * easeds_smallvec_create       创建一个小数组, 结构体和内联存储一次申请, 失败返回NULL
+ * easeds_smallvec_create_alloc 使用指定的内存分配器创建小数组, 失败返回NULL
+ * easeds_smallvec_init         使用用户提供的内联存储初始化小数组
+ * easeds_smallvec_fini         释放小数组申请的堆内存, 不释放结构体和内联存储
+ * easeds_smallvec_destroy      销毁小数组, 释放堆内存和 create 申请的结构体
+ * easeds_smallvec_clear        清空小数组, 删除所有元素, 但不释放内存
+ * easeds_smallvec_size         获取当前元素数量
+ * easeds_smallvec_capacity     获取当前容量
+ * easeds_smallvec_is_empty     判断小数组是否为空, 为空返回true, 否则返回false
+ * easeds_smallvec_is_inline    判断元素是否存放在内联存储中
+ * easeds_smallvec_resize       调整容量, 成功返回0, 失败返回-1
+ * easeds_smallvec_push_back    在末尾添加一个元素, 成功返回0, 失败返回-1
+ * easeds_smallvec_pop_back     删除末尾的一个元素, 成功返回0, 失败返回-1
+ * easeds_smallvec_insert       在指定索引位置插入一个元素, 成功返回0, 失败返回-1
+ * easeds_smallvec_remove       删除指定索引位置的元素, 成功返回0, 失败返回-1
+ * easeds_smallvec_get          获取指定索引位置的元素指针, 成功返回0, 失败返回-1
+ * easeds_smallvec_set          设置指定索引位置的元素值, 成功返回0, 失败返回-1
+ * easeds_smallvec_foreach      遍历元素, 对每个元素执行指定的回调函数
+ * easeds_smallvec_find         查找满足条件的元素, 返回元素指针, 未找到返回NULL
+ */
+
+// 创建一个小数组, 结构体和内联存储一次申请, inline_capacity 为0时使用默认内联容量, 失败返回NULL
+struct easeds_smallvec *easeds_smallvec_create(
+    const char *name, uint32_t element_size, uint32_t inline_capacity);
+
+// 使用指定的内存分配器创建小数组, allocator 为NULL时等同于 easeds_smallvec_create, 失败返回NULL
+struct easeds_smallvec *easeds_smallvec_create_alloc(const char *name, uint32_t element_size,
+    uint32_t inline_capacity, const struct easeds_allocator *allocator);
+
+// 使用用户提供的内联存储初始化小数组, inline_elements 至少容纳 inline_capacity 个元素, 成功返回0
+int32_t easeds_smallvec_init(struct easeds_smallvec *vec, const char *name, uint32_t element_size,
+    void *inline_elements, uint32_t inline_capacity, const struct easeds_allocator *allocator);
+
+// 释放小数组申请的堆内存, 元素清空并回到内联存储, 不释放结构体和内联存储
+void easeds_smallvec_fini(struct easeds_smallvec *vec);
+
+// 销毁小数组, 释放堆内存, 结构体由 create 申请时一并释放
+void easeds_smallvec_destroy(struct easeds_smallvec *vec);
+
+// 清空小数组, 删除所有元素, 但不释放内存
+void easeds_smallvec_clear(struct easeds_smallvec *vec);
+
+// 获取当前元素数量
+uint32_t easeds_smallvec_size(struct easeds_smallvec *vec);
+
+// 获取当前容量
+uint32_t easeds_smallvec_capacity(struct easeds_smallvec *vec);
+
+// 判断小数组是否为空, 为空返回true, 否则返回false
+bool easeds_smallvec_is_empty(struct easeds_smallvec *vec);
+
+// 判断元素是否存放在内联存储中
+bool easeds_smallvec_is_inline(struct easeds_smallvec *vec);
+
+// 调整容量, 新容量不能小于当前元素数量, 不超过内联容量时搬回内联存储, 成功返回0, 失败返回-1
+int32_t easeds_smallvec_resize(struct easeds_smallvec *vec, uint32_t new_capacity);
+
+// 在末尾添加一个元素, 成功返回0, 失败返回-1
+int32_t easeds_smallvec_push_back(struct easeds_smallvec *vec, const void *element);
+
+// 删除末尾的一个元素, 成功返回0, 失败返回-1
+int32_t easeds_smallvec_pop_back(struct easeds_smallvec *vec);
+
+// 在指定索引位置插入一个元素, 成功返回0, 失败返回-1
+int32_t easeds_smallvec_insert(struct easeds_smallvec *vec, uint32_t index, const void *element);
+
+// 删除指定索引位置的元素, 成功返回0, 失败返回-1
+int32_t easeds_smallvec_remove(struct easeds_smallvec *vec, uint32_t index);
+
+// 获取指定索引位置的元素指针, 成功返回0, 失败返回-1
+int32_t easeds_smallvec_get(struct easeds_smallvec *vec, uint32_t index, void **element);
+
+// 设置指定索引位置的元素值, 成功返回0, 失败返回-1
+int32_t easeds_smallvec_set(struct easeds_smallvec *vec, uint32_t index, const void *element);
+
+// 遍历元素, 对每个元素执行指定的回调函数
+void easeds_smallvec_foreach(struct easeds_smallvec *vec,
+    void (*callback)(void *element, void *user_data), void *user_data);
+
+// 查找满足条件的元素, 返回元素指针, 未找到返回NULL
+void *easeds_smallvec_find(struct easeds_smallvec *vec,
+    bool (*predicate)(void *element, void *user_data), void *user_data);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __EASEDS_SMALLVEC_H__ */
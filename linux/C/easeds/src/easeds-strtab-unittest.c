@@ -0,0 +1,544 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-strtab-unittest.c
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-19 00:55
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  Easeds 字符串表单元测试实现文件, 包含了追加/访问/排序查找/删除压缩和性能测试.
+ *
+ * @History:
+ *  2026年10月19日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#include "easeds-unittest.h"
+
+#include <malloc.h>
+
+// 项目内部头文件
+#include "easeds-strtab.h"
+#include "easeds-utils.h"
+
+// xorshift 伪随机数
+static uint64_t strtab_rand(uint64_t *seed)
+{
+    *seed ^= *seed << 13;
+    *seed ^= *seed >> 7;
+    *seed ^= *seed << 17;
+    return *seed;
+}
+
+// 生成第 i 个互不相同的随机字符串, 返回长度
+static uint32_t strtab_make_key(char *buf, size_t size, uint64_t *seed, uint32_t i)
+{
+    uint32_t prefix = (uint32_t)(strtab_rand(seed) % 4096);
+    return (uint32_t)snprintf(buf, size, "%x.%u", prefix, i);
+}
+
+// qsort 比较函数: 比较两个 C 字符串指针
+static int strtab_ptr_compare(const void *a, const void *b)
+{
+    return strcmp(*(char *const *)a, *(char *const *)b);
+}
+
+// 校验索引按字节序排列, 且未删除的字符串在字符串区中按下标顺序连续存放
+static void strtab_check_sorted(struct easeds_strtab *tab, bool packed)
+{
+    const char *prev = NULL, *str = NULL;
+    uint32_t    prev_len = 0, len = 0;
+    for (uint32_t i = 0; i < easeds_strtab_size(tab); i++) {
+        if (easeds_strtab_get(tab, i, &str, &len) != 0) {
+            continue;
+        }
+        if (prev != NULL) {
+            int cmp = memcmp(prev, str, prev_len < len ? prev_len : len);
+            assert_true(cmp < 0 || (cmp == 0 && prev_len <= len));
+            if (packed) {
+                assert_ptr_equal(prev + prev_len + 1, str);
+            }
+        }
+        prev     = str;
+        prev_len = len;
+    }
+}
+
+// 基本功能测试: 创建/追加/访问/删除/原地压缩/销毁
+static void test_easeds_strtab_basic(void **state)
+{
+    easeds_unused(state);
+
+    struct easeds_strtab *tab = easeds_strtab_create("basic", 0, 0);
+    assert_non_null(tab);
+    assert_int_equal(easeds_strtab_size(tab), 0);
+    assert_true(easeds_strtab_is_empty(tab));
+    assert_true(easeds_strtab_is_sorted(tab));
+
+    const char *words[] = {"apple", "banana", "cherry", "date", "elderberry", "fig"};
+    uint32_t    index   = UINT32_MAX;
+    for (uint32_t i = 0; i < 6; i++) {
+        assert_int_equal(easeds_strtab_append(tab, words[i], (uint32_t)strlen(words[i]), &index),
+            0);
+        assert_int_equal(index, i);
+    }
+    assert_int_equal(easeds_strtab_size(tab), 6);
+    assert_false(easeds_strtab_is_empty(tab));
+    assert_true(easeds_strtab_is_sorted(tab));
+
+    /* 返回的字符串以 '\0' 结尾, 并且首尾相接存放 */
+    const char *str = NULL, *first = NULL;
+    uint32_t    len = 0;
+    for (uint32_t i = 0; i < 6; i++) {
+        assert_int_equal(easeds_strtab_get(tab, i, &str, &len), 0);
+        assert_string_equal(str, words[i]);
+        assert_int_equal(len, strlen(words[i]));
+        if (i == 0) {
+            first = str;
+        }
+    }
+    assert_int_equal(easeds_strtab_get(tab, 5, &str, NULL), 0);
+    assert_ptr_equal(str, first + strlen("apple") + strlen("banana") + strlen("cherry")
+                              + strlen("date") + strlen("elderberry") + 5);
+
+    assert_int_equal(easeds_strtab_find(tab, "date", 4, &index), 0);
+    assert_int_equal(index, 3);
+    assert_int_equal(easeds_strtab_find(tab, "dat", 3, &index), -1);
+
+    struct easeds_strtab_stats stats;
+    assert_int_equal(easeds_strtab_stats(tab, &stats), 0);
+    assert_int_equal(stats.count, 6);
+    assert_int_equal(stats.removed, 0);
+    assert_int_equal(stats.bytes, 40);
+    assert_int_equal(stats.dead_bytes, 0);
+
+    /* 删除后下标不变, 压缩后回收空间, 后面的下标前移 */
+    assert_int_equal(easeds_strtab_remove(tab, 1), 0);
+    assert_int_equal(easeds_strtab_remove(tab, 4), 0);
+    assert_int_equal(easeds_strtab_get(tab, 1, &str, &len), -1);
+    assert_int_equal(easeds_strtab_get(tab, 2, &str, &len), 0);
+    assert_string_equal(str, "cherry");
+    assert_int_equal(easeds_strtab_find(tab, "banana", 6, &index), -1);
+    assert_int_equal(easeds_strtab_stats(tab, &stats), 0);
+    assert_int_equal(stats.count, 6);
+    assert_int_equal(stats.removed, 2);
+    assert_int_equal(stats.dead_bytes, 18);
+
+    assert_int_equal(easeds_strtab_compact(tab), 0);
+    assert_int_equal(easeds_strtab_size(tab), 4);
+    assert_int_equal(easeds_strtab_stats(tab, &stats), 0);
+    assert_int_equal(stats.removed, 0);
+    assert_int_equal(stats.bytes, 22);
+    assert_int_equal(stats.dead_bytes, 0);
+
+    const char *expect[] = {"apple", "cherry", "date", "fig"};
+    for (uint32_t i = 0; i < 4; i++) {
+        assert_int_equal(easeds_strtab_get(tab, i, &str, &len), 0);
+        assert_string_equal(str, expect[i]);
+        assert_int_equal(easeds_strtab_find(tab, expect[i], len, &index), 0);
+        assert_int_equal(index, i);
+    }
+    strtab_check_sorted(tab, true);
+
+    easeds_strtab_clear(tab);
+    assert_true(easeds_strtab_is_empty(tab));
+    assert_int_equal(easeds_strtab_stats(tab, &stats), 0);
+    assert_int_equal(stats.bytes, 0);
+
+    easeds_strtab_destroy(tab);
+}
+
+// 操作测试: 大量随机字符串追加/排序/查找/删除/压缩, 与参考数组对比
+static void test_easeds_strtab_operations(void **state)
+{
+    easeds_unused(state);
+
+    const uint32_t count = 20000;
+    char         **ref   = malloc(count * sizeof(char *));
+    assert_non_null(ref);
+
+    struct easeds_strtab *tab = easeds_strtab_create("operations", 16, 64);
+    assert_non_null(tab);
+
+    uint64_t seed = 88172645463325252ULL;
+    char     buf[32];
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t len = strtab_make_key(buf, sizeof(buf), &seed, i);
+        ref[i]       = strdup(buf);
+        assert_non_null(ref[i]);
+        assert_int_equal(easeds_strtab_append(tab, buf, len, NULL), 0);
+    }
+    assert_int_equal(easeds_strtab_size(tab), count);
+    assert_false(easeds_strtab_is_sorted(tab));
+
+    const char *str = NULL;
+    uint32_t    len = 0, index = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        assert_int_equal(easeds_strtab_get(tab, i, &str, &len), 0);
+        assert_string_equal(str, ref[i]);
+        assert_int_equal(len, strlen(ref[i]));
+    }
+
+    /* 排序结果与 qsort 一致, 所有字符串都能查到, 不存在的字符串查不到 */
+    assert_int_equal(easeds_strtab_sort(tab), 0);
+    assert_true(easeds_strtab_is_sorted(tab));
+    qsort(ref, count, sizeof(char *), strtab_ptr_compare);
+    for (uint32_t i = 0; i < count; i++) {
+        assert_int_equal(easeds_strtab_get(tab, i, &str, &len), 0);
+        assert_string_equal(str, ref[i]);
+        assert_int_equal(easeds_strtab_find(tab, ref[i], len, &index), 0);
+        assert_int_equal(index, i);
+    }
+    for (uint32_t i = 0; i < 1000; i++) {
+        len = (uint32_t)snprintf(buf, sizeof(buf), "%x.%u", i, count + i);
+        assert_int_equal(easeds_strtab_find(tab, buf, len, &index), -1);
+    }
+
+    /* 随机删除约三分之一, 查找跳过已删除的字符串 */
+    uint32_t removed = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        if (strtab_rand(&seed) % 3 == 0) {
+            assert_int_equal(easeds_strtab_remove(tab, i), 0);
+            free(ref[i]);
+            ref[i] = NULL;
+            removed++;
+        }
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        if (ref[i] == NULL) {
+            assert_int_equal(easeds_strtab_get(tab, i, &str, &len), -1);
+        } else {
+            assert_int_equal(easeds_strtab_find(tab, ref[i], (uint32_t)strlen(ref[i]), &index),
+                0);
+            assert_int_equal(index, i);
+        }
+    }
+
+    /* 排序后压缩复制到新字符串区, 字符串区也按字节序连续排列 */
+    struct easeds_strtab_stats before, after;
+    assert_int_equal(easeds_strtab_stats(tab, &before), 0);
+    assert_int_equal(before.removed, removed);
+    assert_int_equal(easeds_strtab_compact(tab), 0);
+    assert_int_equal(easeds_strtab_stats(tab, &after), 0);
+    assert_int_equal(after.count, count - removed);
+    assert_int_equal(after.bytes, before.bytes - before.dead_bytes);
+    assert_int_equal(after.capacity, after.bytes);
+    assert_true(easeds_strtab_is_sorted(tab));
+    strtab_check_sorted(tab, true);
+
+    uint32_t live = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        if (ref[i] != NULL) {
+            assert_int_equal(easeds_strtab_get(tab, live, &str, &len), 0);
+            assert_string_equal(str, ref[i]);
+            live++;
+            free(ref[i]);
+        }
+    }
+    assert_int_equal(live, count - removed);
+
+    /* 压缩后继续追加, 升序追加保持有序 */
+    assert_int_equal(easeds_strtab_append(tab, "~~~", 3, &index), 0);
+    assert_int_equal(index, live);
+    assert_true(easeds_strtab_is_sorted(tab));
+    assert_int_equal(easeds_strtab_find(tab, "~~~", 3, &index), 0);
+    assert_int_equal(index, live);
+
+    easeds_strtab_destroy(tab);
+    free(ref);
+}
+
+// 边界条件测试: 空字符串/内嵌 '\0'/长字符串/追加自身字符串/重复字符串/全部删除
+static void test_easeds_strtab_boundary(void **state)
+{
+    easeds_unused(state);
+
+    struct easeds_strtab *tab = easeds_strtab_create("boundary", 1, 1);
+    assert_non_null(tab);
+
+    const char *str = NULL;
+    uint32_t    len = 0, index = 0;
+    assert_int_equal(easeds_strtab_find(tab, "a", 1, &index), -1);
+    assert_int_equal(easeds_strtab_compact(tab), 0);
+    assert_int_equal(easeds_strtab_sort(tab), 0);
+
+    /* 空字符串可以传 NULL, 占用一个 '\0' 字节 */
+    assert_int_equal(easeds_strtab_append(tab, NULL, 0, &index), 0);
+    assert_int_equal(easeds_strtab_get(tab, index, &str, &len), 0);
+    assert_int_equal(len, 0);
+    assert_string_equal(str, "");
+    assert_int_equal(easeds_strtab_find(tab, NULL, 0, &index), 0);
+    assert_int_equal(index, 0);
+
+    /* 内嵌 '\0' 的字符串按长度比较 */
+    assert_int_equal(easeds_strtab_append(tab, "a\0b", 3, NULL), 0);
+    assert_int_equal(easeds_strtab_append(tab, "a\0c", 3, NULL), 0);
+    assert_true(easeds_strtab_is_sorted(tab));
+    assert_int_equal(easeds_strtab_find(tab, "a\0c", 3, &index), 0);
+    assert_int_equal(index, 2);
+    assert_int_equal(easeds_strtab_find(tab, "a", 1, &index), -1);
+    assert_int_equal(easeds_strtab_get(tab, 1, &str, &len), 0);
+    assert_int_equal(len, 3);
+    assert_memory_equal(str, "a\0b", 4);
+
+    /* 超过当前容量的长字符串, 以及来源指向字符串区内部时扩容后仍然正确 */
+    const uint32_t long_len = 100000;
+    char          *big      = malloc(long_len);
+    assert_non_null(big);
+    memset(big, 'z', long_len);
+    assert_int_equal(easeds_strtab_append(tab, big, long_len, &index), 0);
+    assert_int_equal(easeds_strtab_get(tab, index, &str, &len), 0);
+    assert_int_equal(len, long_len);
+    assert_memory_equal(str, big, long_len);
+    assert_int_equal(str[long_len], '\0');
+    for (uint32_t i = 0; i < 4; i++) {
+        assert_int_equal(easeds_strtab_get(tab, 3 + i, &str, &len), 0);
+        assert_int_equal(easeds_strtab_append(tab, str, len, &index), 0);
+        assert_int_equal(easeds_strtab_get(tab, index, &str, &len), 0);
+        assert_int_equal(len, long_len);
+        assert_memory_equal(str, big, long_len);
+    }
+    free(big);
+    assert_int_equal(easeds_strtab_size(tab), 8);
+
+    /* 重复字符串稳定排序, 查找返回第一个未删除的 */
+    easeds_strtab_clear(tab);
+    const char *dups[] = {"b", "a", "b", "a", "b"};
+    for (uint32_t i = 0; i < 5; i++) {
+        assert_int_equal(easeds_strtab_append(tab, dups[i], 1, NULL), 0);
+    }
+    assert_false(easeds_strtab_is_sorted(tab));
+    assert_int_equal(easeds_strtab_sort(tab), 0);
+    const char *prev = NULL;
+    for (uint32_t i = 0; i < 5; i++) {
+        assert_int_equal(easeds_strtab_get(tab, i, &str, &len), 0);
+        assert_int_equal(str[0], i < 2 ? 'a' : 'b');
+        if (i != 2) {
+            assert_true(prev == NULL || prev < str);
+        }
+        prev = str;
+    }
+    assert_int_equal(easeds_strtab_find(tab, "b", 1, &index), 0);
+    assert_int_equal(index, 2);
+    assert_int_equal(easeds_strtab_remove(tab, 2), 0);
+    assert_int_equal(easeds_strtab_remove(tab, 3), 0);
+    assert_int_equal(easeds_strtab_find(tab, "b", 1, &index), 0);
+    assert_int_equal(index, 4);
+    assert_int_equal(easeds_strtab_remove(tab, 4), 0);
+    assert_int_equal(easeds_strtab_find(tab, "b", 1, &index), -1);
+
+    /* 全部删除后压缩, 字符串表为空并且可以继续使用 */
+    assert_int_equal(easeds_strtab_remove(tab, 0), 0);
+    assert_int_equal(easeds_strtab_remove(tab, 1), 0);
+    assert_int_equal(easeds_strtab_compact(tab), 0);
+    assert_true(easeds_strtab_is_empty(tab));
+
+    struct easeds_strtab_stats stats;
+    assert_int_equal(easeds_strtab_stats(tab, &stats), 0);
+    assert_int_equal(stats.bytes, 0);
+    assert_int_equal(stats.dead_bytes, 0);
+    assert_int_equal(easeds_strtab_append(tab, "x", 1, &index), 0);
+    assert_int_equal(index, 0);
+    assert_int_equal(easeds_strtab_get(tab, 0, &str, &len), 0);
+    assert_string_equal(str, "x");
+
+    easeds_strtab_destroy(tab);
+}
+
+// 错误处理测试: 无效参数/越界下标/重复删除/无序查找
+static void test_easeds_strtab_error(void **state)
+{
+    easeds_unused(state);
+
+    struct easeds_strtab      *tab = easeds_strtab_create("error", 0, 0);
+    struct easeds_strtab_stats stats;
+    const char                *str = NULL;
+    uint32_t                   len = 0, index = 0;
+    assert_non_null(tab);
+
+    assert_int_equal(easeds_strtab_append(NULL, "a", 1, NULL), -1);
+    assert_int_equal(easeds_strtab_append(tab, NULL, 1, NULL), -1);
+    assert_int_equal(easeds_strtab_append(tab, "a", UINT32_MAX, NULL), -1);
+    assert_int_equal(easeds_strtab_get(NULL, 0, &str, &len), -1);
+    assert_int_equal(easeds_strtab_get(tab, 0, &str, &len), -1);
+    assert_int_equal(easeds_strtab_remove(NULL, 0), -1);
+    assert_int_equal(easeds_strtab_remove(tab, 0), -1);
+    assert_int_equal(easeds_strtab_sort(NULL), -1);
+    assert_int_equal(easeds_strtab_find(NULL, "a", 1, &index), -1);
+    assert_int_equal(easeds_strtab_find(tab, NULL, 1, &index), -1);
+    assert_int_equal(easeds_strtab_compact(NULL), -1);
+    assert_int_equal(easeds_strtab_stats(NULL, &stats), -1);
+    assert_int_equal(easeds_strtab_stats(tab, NULL), -1);
+    assert_int_equal(easeds_strtab_size(NULL), 0);
+    assert_false(easeds_strtab_is_sorted(NULL));
+    easeds_strtab_clear(NULL);
+    easeds_strtab_destroy(NULL);
+    assert_int_equal(easeds_strtab_size(tab), 0);
+
+    /* 越界下标, NULL 输出, 重复删除 */
+    assert_int_equal(easeds_strtab_append(tab, "b", 1, NULL), 0);
+    assert_int_equal(easeds_strtab_get(tab, 1, &str, &len), -1);
+    assert_int_equal(easeds_strtab_get(tab, 0, NULL, &len), -1);
+    assert_int_equal(easeds_strtab_remove(tab, 1), -1);
+    assert_int_equal(easeds_strtab_remove(tab, 0), 0);
+    assert_int_equal(easeds_strtab_remove(tab, 0), -1);
+    assert_int_equal(easeds_strtab_get(tab, 0, &str, &len), -1);
+
+    /* 追加一个更小的字符串后不再有序, 拒绝二分查找, 排序后恢复 */
+    assert_int_equal(easeds_strtab_append(tab, "a", 1, NULL), 0);
+    assert_false(easeds_strtab_is_sorted(tab));
+    assert_int_equal(easeds_strtab_find(tab, "a", 1, &index), -1);
+    assert_int_equal(easeds_strtab_sort(tab), 0);
+    assert_int_equal(easeds_strtab_find(tab, "a", 1, &index), 0);
+    assert_int_equal(index, 0);
+    assert_int_equal(easeds_strtab_find(tab, "b", 1, &index), -1);
+
+    easeds_strtab_destroy(tab);
+}
+
+// 性能测试: 与逐个 malloc 再放入 easeds_array 的做法对比追加/内存/遍历/排序/查找
+static void test_easeds_strtab_perf(void **state)
+{
+    easeds_unused(state);
+
+    const uint32_t count  = 1000000;
+    const uint32_t probes = 1000000;
+    char         **keys   = malloc(count * sizeof(char *));
+    uint32_t      *lens   = malloc(count * sizeof(uint32_t));
+    assert_non_null(keys);
+    assert_non_null(lens);
+
+    /* 预先生成 8~23 字节的短字符串, 不计入计时 */
+    uint64_t seed = 88172645463325252ULL;
+    char     buf[32];
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t pad = (uint32_t)(strtab_rand(&seed) % 12);
+        lens[i]      = (uint32_t)snprintf(buf, sizeof(buf), "k%07x%.*s", i, pad, "abcdefghijkl");
+        keys[i]      = strdup(buf);
+        assert_non_null(keys[i]);
+    }
+    for (uint32_t i = count - 1; i > 0; i--) {
+        uint32_t j   = (uint32_t)(strtab_rand(&seed) % (i + 1));
+        char    *tmp = keys[i];
+        keys[i]      = keys[j];
+        keys[j]      = tmp;
+        uint32_t len = lens[i];
+        lens[i]      = lens[j];
+        lens[j]      = len;
+    }
+
+    /* 逐个 malloc, 指针放入 easeds_array */
+    struct easeds_array *array = easeds_array_create("perf", sizeof(char *), 0);
+    assert_non_null(array);
+    int64_t start = easeds_get_current_time_ns();
+    for (uint32_t i = 0; i < count; i++) {
+        char *copy = malloc((size_t)lens[i] + 1);
+        memcpy(copy, keys[i], (size_t)lens[i] + 1);
+        assert_int_equal(easeds_array_push_back(array, &copy), 0);
+    }
+    double   malloc_ns  = (double)(easeds_get_current_time_ns() - start) / (double)count;
+    uint64_t malloc_mem = (uint64_t)array->capacity * sizeof(char *);
+    char   **ptrs       = (char **)array->elements;
+    for (uint32_t i = 0; i < count; i++) {
+        /* 每次分配另有 8 字节的块头 */
+        malloc_mem += malloc_usable_size(ptrs[i]) + sizeof(size_t);
+    }
+
+    /* 字符串表 */
+    struct easeds_strtab *tab = easeds_strtab_create("perf", 0, 0);
+    assert_non_null(tab);
+    start = easeds_get_current_time_ns();
+    for (uint32_t i = 0; i < count; i++) {
+        assert_int_equal(easeds_strtab_append(tab, keys[i], lens[i], NULL), 0);
+    }
+    double strtab_ns = (double)(easeds_get_current_time_ns() - start) / (double)count;
+
+    struct easeds_strtab_stats stats;
+    assert_int_equal(easeds_strtab_stats(tab, &stats), 0);
+
+    /* 顺序遍历计算总长度 */
+    uint64_t total = 0, expect_total = 0;
+    start          = easeds_get_current_time_ns();
+    for (uint32_t i = 0; i < count; i++) {
+        expect_total += strlen(ptrs[i]);
+    }
+    double malloc_scan_ns = (double)(easeds_get_current_time_ns() - start) / (double)count;
+
+    const char *str = NULL;
+    uint32_t    len = 0, index = 0;
+
+    start = easeds_get_current_time_ns();
+    for (uint32_t i = 0; i < count; i++) {
+        easeds_strtab_get(tab, i, &str, &len);
+        total += strlen(str);
+    }
+    double strtab_scan_ns = (double)(easeds_get_current_time_ns() - start) / (double)count;
+    assert_int_equal(total, expect_total);
+
+    /* 排序 */
+    start = easeds_get_current_time_ns();
+    qsort(ptrs, count, sizeof(char *), strtab_ptr_compare);
+    double qsort_ms = (double)(easeds_get_current_time_ns() - start) / 1e6;
+    start           = easeds_get_current_time_ns();
+    assert_int_equal(easeds_strtab_sort(tab), 0);
+    double sort_ms = (double)(easeds_get_current_time_ns() - start) / 1e6;
+
+    /* 随机查找 */
+    uint32_t found = 0;
+    start          = easeds_get_current_time_ns();
+    for (uint32_t i = 0; i < probes; i++) {
+        uint32_t k = (uint32_t)(strtab_rand(&seed) % count);
+        if (bsearch(&keys[k], ptrs, count, sizeof(char *), strtab_ptr_compare) != NULL) {
+            found++;
+        }
+    }
+    double bsearch_ns = (double)(easeds_get_current_time_ns() - start) / (double)probes;
+    assert_int_equal(found, probes);
+    found = 0;
+    start = easeds_get_current_time_ns();
+    for (uint32_t i = 0; i < probes; i++) {
+        uint32_t k = (uint32_t)(strtab_rand(&seed) % count);
+        if (easeds_strtab_find(tab, keys[k], lens[k], &index) == 0) {
+            found++;
+        }
+    }
+    double find_ns = (double)(easeds_get_current_time_ns() - start) / (double)probes;
+    assert_int_equal(found, probes);
+
+    /* 删除一半后压缩, 压缩后的字符串区按字节序排列 */
+    for (uint32_t i = 0; i < count; i += 2) {
+        assert_int_equal(easeds_strtab_remove(tab, i), 0);
+    }
+    start = easeds_get_current_time_ns();
+    assert_int_equal(easeds_strtab_compact(tab), 0);
+    double compact_ms = (double)(easeds_get_current_time_ns() - start) / 1e6;
+    assert_int_equal(easeds_strtab_size(tab), count / 2);
+
+    MEASURE("[strtab perf]: %u strings, memory %lu bytes (malloc %lu), append %.1f ns (malloc "
+            "%.1f ns), scan %.2f ns (malloc %.2f ns), sort %.1f ms (qsort %.1f ms), find %.1f "
+            "ns (bsearch %.1f ns), compact half %.1f ms.",
+        count, stats.memory_bytes, malloc_mem, strtab_ns, malloc_ns, strtab_scan_ns,
+        malloc_scan_ns, sort_ms, qsort_ms, find_ns, bsearch_ns, compact_ms);
+
+    for (uint32_t i = 0; i < count; i++) {
+        free(ptrs[i]);
+        free(keys[i]);
+    }
+    easeds_array_destroy(array);
+    easeds_strtab_destroy(tab);
+    free(keys);
+    free(lens);
+}
+
+// 注册单元测试用例
+EASEDS_UNITTEST_REGISTER(easeds_unittest_strtab){
+    cmocka_unit_test(test_easeds_strtab_basic),
+    cmocka_unit_test(test_easeds_strtab_operations),
+    cmocka_unit_test(test_easeds_strtab_boundary),
+    cmocka_unit_test(test_easeds_strtab_error),
+    cmocka_unit_test(test_easeds_strtab_perf),
+    easeds_unit_test_end,
+};
@@ -0,0 +1,518 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-strtab.c
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-19 00:55
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  字符串表实现, 字符串区连续扩容, 删除打标记, 压缩时统一回收, 索引使用稳定归并排序.
+ *
+ * @History:
+ *  2026年10月19日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#include "easeds-strtab.h"
+
+// 标准库头文件
+#include <stdlib.h>
+#include <string.h>
+
+// 项目内部头文件
+#include "easeds-log.h"
+
+// 字符串区默认初始容量, 单位字节
+#define STRTAB_DEFAULT_INITIAL_BYTES 4096
+
+// 归并排序前先用插入排序处理的小段长度
+#define STRTAB_SORT_RUN 16
+
+// 获取第 index 个索引项
+static inline struct easeds_strtab_entry *strtab_entry(
+    const struct easeds_strtab *tab, uint32_t index)
+{
+    return (struct easeds_strtab_entry *)tab->index->elements + index;
+}
+
+// 按字节序比较两个字符串, 公共前缀相同时较短的字符串较小
+static inline int strtab_compare(const char *a, uint32_t alen, const char *b, uint32_t blen)
+{
+    int cmp = memcmp(a, b, alen < blen ? alen : blen);
+    if (cmp != 0) {
+        return cmp;
+    }
+    return (alen > blen) - (alen < blen);
+}
+
+// 比较两个索引项对应的字符串
+static inline int strtab_entry_compare(
+    const char *bytes, const struct easeds_strtab_entry *a, const struct easeds_strtab_entry *b)
+{
+    return strtab_compare(bytes + a->offset, a->length, bytes + b->offset, b->length);
+}
+
+// 确保字符串区至少可以容纳 need 字节, 按2倍扩容, 成功返回0, 失败返回-1
+static int32_t strtab_reserve(struct easeds_strtab *tab, uint64_t need)
+{
+    if (need <= tab->capacity) {
+        return 0;
+    }
+
+    uint64_t capacity = tab->capacity ? tab->capacity : STRTAB_DEFAULT_INITIAL_BYTES;
+    while (capacity < need) {
+        capacity *= 2;
+    }
+
+    char *bytes = realloc(tab->bytes, capacity);
+    if (unlikely(bytes == NULL)) {
+        return -1;
+    }
+    tab->bytes    = bytes;
+    tab->capacity = capacity;
+
+    PFL_DEBUG("Expanded strtab bytes capacity to %lu.", capacity);
+    return 0;
+}
+
+// 对 [0, count) 范围的索引项做插入排序, 相同字符串保持原顺序
+static void strtab_insertion_sort(
+    const char *bytes, struct easeds_strtab_entry *entries, uint64_t count)
+{
+    for (uint64_t i = 1; i < count; i++) {
+        struct easeds_strtab_entry key = entries[i];
+        uint64_t                   j   = i;
+        while (j > 0 && strtab_entry_compare(bytes, &key, &entries[j - 1]) < 0) {
+            entries[j] = entries[j - 1];
+            j--;
+        }
+        entries[j] = key;
+    }
+}
+
+// 合并 src 中有序的 [lo, mid) 和 [mid, hi) 到 dst 的 [lo, hi), 相等时左侧优先, 保证稳定
+static void strtab_merge(const char *bytes, const struct easeds_strtab_entry *src,
+    struct easeds_strtab_entry *dst, uint64_t lo, uint64_t mid, uint64_t hi)
+{
+    uint64_t i = lo, j = mid, k = lo;
+
+    /* 两段已经整体有序时直接复制, 升序追加的数据不需要逐个比较 */
+    if (mid > lo && mid < hi && strtab_entry_compare(bytes, &src[mid - 1], &src[mid]) <= 0) {
+        memcpy(dst + lo, src + lo, (size_t)(hi - lo) * sizeof(*src));
+        return;
+    }
+
+    while (i < mid && j < hi) {
+        if (strtab_entry_compare(bytes, &src[j], &src[i]) < 0) {
+            dst[k++] = src[j++];
+        } else {
+            dst[k++] = src[i++];
+        }
+    }
+    while (i < mid) {
+        dst[k++] = src[i++];
+    }
+    while (j < hi) {
+        dst[k++] = src[j++];
+    }
+}
+
+/**
+ * @description: 创建一个空字符串表.
+ * @param {const char} *name 名称, 预留字段, 可用于调试和日志输出
+ * @param {uint32_t} initial_count 索引初始容量, 为0时使用默认容量
+ * @param {uint64_t} initial_bytes 字符串区初始容量, 为0时使用默认容量
+ * @return {struct easeds_strtab *} 成功返回字符串表指针, 失败返回NULL
+ */
+struct easeds_strtab *easeds_strtab_create(
+    const char *name, uint32_t initial_count, uint64_t initial_bytes)
+{
+    struct easeds_strtab *tab = __easeds_malloc(sizeof(struct easeds_strtab));
+    if (unlikely(tab == NULL)) {
+        EASEDS_ERR("[easeds_strtab_create]: Failed to allocate memory for strtab struct.");
+        return NULL;
+    }
+
+    tab->index = easeds_array_create(name, sizeof(struct easeds_strtab_entry), initial_count);
+    if (unlikely(tab->index == NULL)) {
+        __easeds_free(tab);
+        return NULL;
+    }
+
+    tab->capacity = initial_bytes ? initial_bytes : STRTAB_DEFAULT_INITIAL_BYTES;
+    tab->bytes    = __easeds_malloc(tab->capacity);
+    if (unlikely(tab->bytes == NULL)) {
+        EASEDS_ERR("[easeds_strtab_create]: Failed to allocate memory for string bytes.");
+        easeds_array_destroy(tab->index);
+        __easeds_free(tab);
+        return NULL;
+    }
+
+    tab->name    = name;
+    tab->used    = 0;
+    tab->dead    = 0;
+    tab->removed = 0;
+    tab->flags   = EASEDS_STRTAB_F_SORTED;
+
+    PFL_DEBUG("Created strtab: bytes_capacity=%lu.", tab->capacity);
+    return tab;
+}
+
+// 销毁字符串表, 释放内存
+void easeds_strtab_destroy(struct easeds_strtab *tab)
+{
+    if (unlikely(tab == NULL)) {
+        return;
+    }
+
+    easeds_array_destroy(tab->index);
+    __easeds_free(tab->bytes);
+    __easeds_free(tab);
+
+    PFL_DEBUG("Destroyed strtab.");
+}
+
+// 清空字符串表, 删除所有字符串, 但不释放内存
+void easeds_strtab_clear(struct easeds_strtab *tab)
+{
+    if (unlikely(tab == NULL)) {
+        return;
+    }
+
+    easeds_array_clear(tab->index);
+    tab->used    = 0;
+    tab->dead    = 0;
+    tab->removed = 0;
+    tab->flags   = EASEDS_STRTAB_F_SORTED;
+}
+
+// 获取索引项数量, 包括已删除未压缩的索引项
+uint32_t easeds_strtab_size(struct easeds_strtab *tab)
+{
+    if (unlikely(tab == NULL)) {
+        EASEDS_ERR("[easeds_strtab_size]: Invalid strtab pointer.");
+        return 0;
+    }
+
+    return tab->index->size;
+}
+
+// 判断字符串表是否没有索引项, 为空返回true, 否则返回false
+bool easeds_strtab_is_empty(struct easeds_strtab *tab)
+{
+    return easeds_strtab_size(tab) == 0;
+}
+
+// 判断索引是否按字节序排列
+bool easeds_strtab_is_sorted(struct easeds_strtab *tab)
+{
+    if (unlikely(tab == NULL)) {
+        EASEDS_ERR("[easeds_strtab_is_sorted]: Invalid strtab pointer.");
+        return false;
+    }
+
+    return (tab->flags & EASEDS_STRTAB_F_SORTED) != 0;
+}
+
+/**
+ * @description: 追加一个字符串, 字符串内容复制到字符串区末尾并补 '\0', 不单独申请内存.
+ *  str 可以指向本字符串表中的字符串, 字符串区扩容后会重新定位.
+ * @param {struct easeds_strtab} *tab 字符串表指针
+ * @param {const char} *str 字符串, length 为0时可以为NULL
+ * @param {uint32_t} length 字符串长度, 不含结尾的 '\0'
+ * @param {uint32_t} *index 非空时返回新字符串的下标
+ * @return {int32_t} 成功返回0, 失败返回-1
+ */
+int32_t easeds_strtab_append(
+    struct easeds_strtab *tab, const char *str, uint32_t length, uint32_t *index)
+{
+    if (unlikely(tab == NULL || (str == NULL && length > 0))) {
+        EASEDS_ERR("[easeds_strtab_append]: Invalid strtab or string pointer.");
+        return -1;
+    }
+    if (unlikely(length == UINT32_MAX || tab->index->size == UINT32_MAX)) {
+        EASEDS_ERR("[easeds_strtab_append]: String too long or strtab full.");
+        return -1;
+    }
+
+    /* 来源位于字符串区内部时记录偏移, 扩容后重新定位 */
+    const bool     inner  = str != NULL && str >= tab->bytes && str < tab->bytes + tab->used;
+    const uint64_t source = inner ? (uint64_t)(str - tab->bytes) : 0;
+
+    if (unlikely(strtab_reserve(tab, tab->used + length + 1) != 0)) {
+        EASEDS_ERR("[easeds_strtab_append]: Failed to expand string bytes.");
+        return -1;
+    }
+    if (inner) {
+        str = tab->bytes + source;
+    }
+
+    struct easeds_strtab_entry entry = {.offset = tab->used, .length = length, .flags = 0};
+    if (unlikely(easeds_array_push_back(tab->index, &entry) != 0)) {
+        return -1;
+    }
+
+    char *dst = tab->bytes + tab->used;
+    if (length > 0) {
+        memcpy(dst, str, length);
+    }
+    dst[length] = '\0';
+    tab->used += (uint64_t)length + 1;
+
+    /* 新字符串小于前一个字符串时不再有序 */
+    const uint32_t size = tab->index->size;
+    if ((tab->flags & EASEDS_STRTAB_F_SORTED) && size > 1
+        && strtab_entry_compare(tab->bytes, strtab_entry(tab, size - 2), &entry) > 0) {
+        tab->flags &= ~EASEDS_STRTAB_F_SORTED;
+    }
+
+    if (index != NULL) {
+        *index = size - 1;
+    }
+    return 0;
+}
+
+// 获取指定下标的字符串, 字符串以 '\0' 结尾, length 非空时返回长度, 成功返回0, 已删除或失败返回-1
+int32_t easeds_strtab_get(
+    struct easeds_strtab *tab, uint32_t index, const char **str, uint32_t *length)
+{
+    if (unlikely(tab == NULL || str == NULL)) {
+        EASEDS_ERR("[easeds_strtab_get]: Invalid strtab or output pointer.");
+        return -1;
+    }
+    if (unlikely(index >= tab->index->size)) {
+        EASEDS_ERR("[easeds_strtab_get]: Index %u out of range.", index);
+        return -1;
+    }
+
+    const struct easeds_strtab_entry *entry = strtab_entry(tab, index);
+    if (entry->flags & EASEDS_STRTAB_ENTRY_F_REMOVED) {
+        return -1;
+    }
+
+    *str = tab->bytes + entry->offset;
+    if (length != NULL) {
+        *length = entry->length;
+    }
+    return 0;
+}
+
+// 删除指定下标的字符串, 下标保持不变直到压缩, 成功返回0, 失败返回-1
+int32_t easeds_strtab_remove(struct easeds_strtab *tab, uint32_t index)
+{
+    if (unlikely(tab == NULL)) {
+        EASEDS_ERR("[easeds_strtab_remove]: Invalid strtab pointer.");
+        return -1;
+    }
+    if (unlikely(index >= tab->index->size)) {
+        EASEDS_ERR("[easeds_strtab_remove]: Index %u out of range.", index);
+        return -1;
+    }
+
+    struct easeds_strtab_entry *entry = strtab_entry(tab, index);
+    if (unlikely(entry->flags & EASEDS_STRTAB_ENTRY_F_REMOVED)) {
+        EASEDS_ERR("[easeds_strtab_remove]: Index %u already removed.", index);
+        return -1;
+    }
+
+    /* 字符串内容保留到压缩, 有序索引中的相对位置不变 */
+    entry->flags |= EASEDS_STRTAB_ENTRY_F_REMOVED;
+    tab->dead += (uint64_t)entry->length + 1;
+    tab->removed++;
+    return 0;
+}
+
+/**
+ * @description: 按字节序稳定排序索引, 只移动索引项, 不移动字符串区的内容.
+ *  先对每 STRTAB_SORT_RUN 个索引项做插入排序, 再自底向上两两归并, 需要一个和索引等大的临时数组.
+ * @param {struct easeds_strtab} *tab 字符串表指针
+ * @return {int32_t} 成功返回0, 失败返回-1
+ */
+int32_t easeds_strtab_sort(struct easeds_strtab *tab)
+{
+    if (unlikely(tab == NULL)) {
+        EASEDS_ERR("[easeds_strtab_sort]: Invalid strtab pointer.");
+        return -1;
+    }
+
+    const uint64_t count = tab->index->size;
+    if ((tab->flags & EASEDS_STRTAB_F_SORTED) || count < 2) {
+        tab->flags |= EASEDS_STRTAB_F_SORTED;
+        return 0;
+    }
+
+    struct easeds_strtab_entry *tmp = __easeds_malloc(count * sizeof(struct easeds_strtab_entry));
+    if (unlikely(tmp == NULL)) {
+        EASEDS_ERR("[easeds_strtab_sort]: Failed to allocate memory for merge buffer.");
+        return -1;
+    }
+
+    struct easeds_strtab_entry *src = strtab_entry(tab, 0);
+    struct easeds_strtab_entry *dst = tmp;
+
+    for (uint64_t lo = 0; lo < count; lo += STRTAB_SORT_RUN) {
+        uint64_t n = count - lo < STRTAB_SORT_RUN ? count - lo : STRTAB_SORT_RUN;
+        strtab_insertion_sort(tab->bytes, src + lo, n);
+    }
+
+    for (uint64_t width = STRTAB_SORT_RUN; width < count; width *= 2) {
+        for (uint64_t lo = 0; lo < count; lo += 2 * width) {
+            uint64_t mid = lo + width < count ? lo + width : count;
+            uint64_t hi  = lo + 2 * width < count ? lo + 2 * width : count;
+            strtab_merge(tab->bytes, src, dst, lo, mid, hi);
+        }
+        struct easeds_strtab_entry *swap = src;
+        src                              = dst;
+        dst                              = swap;
+    }
+
+    /* 最后一轮结果在临时数组中时复制回索引 */
+    if (src == tmp) {
+        memcpy(strtab_entry(tab, 0), tmp, count * sizeof(struct easeds_strtab_entry));
+    }
+    __easeds_free(tmp);
+
+    tab->flags |= EASEDS_STRTAB_F_SORTED;
+    PFL_DEBUG("Sorted strtab index: count=%lu.", count);
+    return 0;
+}
+
+/**
+ * @description: 在有序索引中二分查找字符串. 已删除的索引项在压缩前仍保留内容和位置,
+ *  可以参与二分比较, 找到第一个相同的字符串后跳过已删除的索引项.
+ * @param {struct easeds_strtab} *tab 字符串表指针
+ * @param {const char} *str 字符串, length 为0时可以为NULL
+ * @param {uint32_t} length 字符串长度
+ * @param {uint32_t} *index 非空时返回找到的下标
+ * @return {int32_t} 找到返回0, 不存在, 索引无序或失败返回-1
+ */
+int32_t easeds_strtab_find(
+    struct easeds_strtab *tab, const char *str, uint32_t length, uint32_t *index)
+{
+    if (unlikely(tab == NULL || (str == NULL && length > 0))) {
+        EASEDS_ERR("[easeds_strtab_find]: Invalid strtab or string pointer.");
+        return -1;
+    }
+    if (unlikely((tab->flags & EASEDS_STRTAB_F_SORTED) == 0)) {
+        EASEDS_ERR("[easeds_strtab_find]: Strtab is not sorted.");
+        return -1;
+    }
+
+    const struct easeds_strtab_entry *entries = strtab_entry(tab, 0);
+    const uint32_t                    size    = tab->index->size;
+    const char                       *key     = str != NULL ? str : "";
+    uint32_t                          lo = 0, hi = size;
+
+    while (lo < hi) {
+        uint32_t                          mid   = lo + (hi - lo) / 2;
+        const struct easeds_strtab_entry *entry = &entries[mid];
+        if (strtab_compare(tab->bytes + entry->offset, entry->length, key, length) < 0) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    for (; lo < size; lo++) {
+        const struct easeds_strtab_entry *entry = &entries[lo];
+        if (entry->length != length || memcmp(tab->bytes + entry->offset, key, length) != 0) {
+            break;
+        }
+        if ((entry->flags & EASEDS_STRTAB_ENTRY_F_REMOVED) == 0) {
+            if (index != NULL) {
+                *index = lo;
+            }
+            return 0;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @description: 回收已删除字符串的空间, 并从索引中移除已删除的索引项, 存活字符串的下标前移.
+ *  索引项的偏移递增(没有排序过)时在原字符串区内前移; 否则按索引顺序复制到新的字符串区,
+ *  排序后压缩可以让字符串区按字节序排列. 失败时字符串表保持不变.
+ * @param {struct easeds_strtab} *tab 字符串表指针
+ * @return {int32_t} 成功返回0, 失败返回-1
+ */
+int32_t easeds_strtab_compact(struct easeds_strtab *tab)
+{
+    if (unlikely(tab == NULL)) {
+        EASEDS_ERR("[easeds_strtab_compact]: Invalid strtab pointer.");
+        return -1;
+    }
+
+    struct easeds_strtab_entry *entries = strtab_entry(tab, 0);
+    const uint32_t              size    = tab->index->size;
+    const uint64_t              live    = tab->used - tab->dead;
+    bool                        inplace = true;
+
+    for (uint32_t i = 1; i < size && inplace; i++) {
+        inplace = entries[i].offset > entries[i - 1].offset;
+    }
+    if (inplace && tab->removed == 0) {
+        return 0;
+    }
+
+    char *bytes = tab->bytes;
+    if (!inplace) {
+        bytes = __easeds_malloc(live > 0 ? live : 1);
+        if (unlikely(bytes == NULL)) {
+            EASEDS_ERR("[easeds_strtab_compact]: Failed to allocate memory for string bytes.");
+            return -1;
+        }
+    }
+
+    /* 原地压缩时目标偏移不会超过来源偏移, 按顺序前移不会覆盖未处理的字符串 */
+    uint64_t used = 0;
+    uint32_t kept = 0;
+    for (uint32_t i = 0; i < size; i++) {
+        struct easeds_strtab_entry entry = entries[i];
+        if (entry.flags & EASEDS_STRTAB_ENTRY_F_REMOVED) {
+            continue;
+        }
+        if (!inplace || used != entry.offset) {
+            memmove(bytes + used, tab->bytes + entry.offset, (size_t)entry.length + 1);
+        }
+        entry.offset    = used;
+        entries[kept++] = entry;
+        used += (uint64_t)entry.length + 1;
+    }
+
+    PFL_DEBUG("Compacted strtab: reclaimed %lu bytes, %u entries, inplace=%d.", tab->dead,
+        tab->removed, inplace);
+
+    if (!inplace) {
+        __easeds_free(tab->bytes);
+        tab->bytes    = bytes;
+        tab->capacity = live > 0 ? live : 1;
+    }
+    tab->index->size = kept;
+    tab->used        = used;
+    tab->dead        = 0;
+    tab->removed     = 0;
+    return 0;
+}
+
+// 获取统计信息, 成功返回0, 失败返回-1
+int32_t easeds_strtab_stats(struct easeds_strtab *tab, struct easeds_strtab_stats *stats)
+{
+    if (unlikely(tab == NULL || stats == NULL)) {
+        EASEDS_ERR("[easeds_strtab_stats]: Invalid strtab or stats pointer.");
+        return -1;
+    }
+
+    memset(stats, 0, sizeof(*stats));
+    stats->count        = tab->index->size;
+    stats->removed      = tab->removed;
+    stats->bytes        = tab->used;
+    stats->dead_bytes   = tab->dead;
+    stats->capacity     = tab->capacity;
+    stats->memory_bytes = sizeof(struct easeds_strtab) + sizeof(struct easeds_array)
+                          + tab->capacity
+                          + (uint64_t)tab->index->capacity * sizeof(struct easeds_strtab_entry);
+    return 0;
+}
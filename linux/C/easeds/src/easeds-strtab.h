@@ -0,0 +1,148 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-strtab.h
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-19 00:55
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  字符串表数据结构定义, 字符串连续存放在同一块字符串区中, 用 (偏移, 长度) 索引数组访问.
+ *
+ * @History:
+ *  2026年10月19日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#ifndef __EASEDS_STRTAB_H__
+#define __EASEDS_STRTAB_H__
+
+/* C 标准库头文件 */
+#include <stdbool.h>
+#include <stdint.h>
+
+/* 项目内部头文件 */
+#include "easeds-array.h"
+#include "easeds-public.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * 实现一个字符串表, 用于保存大量短字符串, 替代逐个 malloc 再把指针放入 easeds_array 的做法.
+ *  (1) 所有字符串首尾相接存放在一块连续的字符串区中, 每个字符串后面补一个 '\0', 可以直接当作
+ *      C 字符串使用; 字符串区按2倍扩容, 追加字符串不会单独申请内存, 没有内存碎片和分配头开销.
+ *  (2) 索引数组保存每个字符串的 (偏移, 长度), 按下标访问为 O(1). 字符串按长度处理,
+ *      可以包含 '\0'. 字符串区扩容后地址可能变化, 之前获取的字符串指针失效.
+ *  (3) 删除只把索引项标记为已删除, 下标保持不变, 字符串区空间在压缩时统一回收.
+ *      压缩按索引顺序把存活的字符串复制到新的字符串区, 并移除已删除的索引项, 之后的下标前移.
+ *  (4) 按字节序排序索引(不移动字符串), 排序后或者按升序追加时, 支持二分查找.
+ *      排序后压缩可以让字符串区也按字节序排列, 顺序遍历时访问连续内存.
+ *  (5) 非线程安全, 需要用户自行保证线程安全性.
+ */
+
+/* 索引项, 每个字符串 16 字节 */
+struct easeds_strtab_entry {
+    uint64_t offset; /* 字符串在字符串区中的偏移 */
+    uint32_t length; /* 字符串长度, 不含结尾的 '\0' */
+    uint32_t flags;  /* 标志位, 见 EASEDS_STRTAB_ENTRY_F_* */
+};
+
+/* 索引项已删除 */
+#define EASEDS_STRTAB_ENTRY_F_REMOVED 0x1U
+
+struct easeds_strtab {
+    const char          *name;     /* 名称, 预留字段, 可用于调试和日志输出 */
+    struct easeds_array *index;    /* 索引数组, 元素为 struct easeds_strtab_entry */
+    char                *bytes;    /* 字符串区 */
+    uint64_t             used;     /* 字符串区已使用字节数, 包括已删除的字符串 */
+    uint64_t             capacity; /* 字符串区容量 */
+    uint64_t             dead;     /* 已删除字符串占用的字节数 */
+    uint32_t             removed;  /* 已删除未压缩的索引项数量 */
+    uint32_t             flags;    /* 标志位, 见 EASEDS_STRTAB_F_* */
+};
+
+/* 索引按字节序排列, 可以二分查找 */
+#define EASEDS_STRTAB_F_SORTED 0x1U
+
+/* 字符串表统计信息 */
+struct easeds_strtab_stats {
+    uint32_t count;        /* 索引项数量, 包括已删除未压缩的索引项 */
+    uint32_t removed;      /* 已删除未压缩的索引项数量 */
+    uint64_t bytes;        /* 字符串区已使用字节数, 包括结尾的 '\0' */
+    uint64_t dead_bytes;   /* 已删除字符串占用的字节数, 压缩后回收 */
+    uint64_t capacity;     /* 字符串区容量 */
+    uint64_t memory_bytes; /* 字符串区和索引数组实际申请的内存字节数 */
+};
+
+/**
+ * 常见字符串表操作函数:
+ *
+ * 函数名                       功能描述
+ * ------------------------     ------------------------------------------------------
+ * easeds_strtab_create         创建一个空字符串表, 返回字符串表指针, 失败返回NULL
+ * easeds_strtab_destroy        销毁字符串表, 释放内存
+ * easeds_strtab_clear          清空字符串表, 删除所有字符串, 但不释放内存
+ * easeds_strtab_size           获取索引项数量, 包括已删除未压缩的索引项
+ * easeds_strtab_is_empty       判断字符串表是否没有索引项
+ * easeds_strtab_is_sorted      判断索引是否按字节序排列
+ * easeds_strtab_append         追加一个字符串, 成功返回0, 失败返回-1
+ * easeds_strtab_get            获取指定下标的字符串, 成功返回0, 已删除或失败返回-1
+ * easeds_strtab_remove         删除指定下标的字符串, 成功返回0, 失败返回-1
+ * easeds_strtab_sort           按字节序稳定排序索引, 成功返回0, 失败返回-1
+ * easeds_strtab_find           在有序索引中查找字符串, 成功返回0, 不存在或失败返回-1
+ * easeds_strtab_compact        回收已删除字符串的空间, 成功返回0, 失败返回-1
+ * easeds_strtab_stats          获取统计信息, 成功返回0, 失败返回-1
+ */
+
+// 创建一个空字符串表, initial_count 和 initial_bytes 为0时使用默认容量, 失败返回NULL
+struct easeds_strtab *easeds_strtab_create(
+    const char *name, uint32_t initial_count, uint64_t initial_bytes);
+
+// 销毁字符串表, 释放内存
+void easeds_strtab_destroy(struct easeds_strtab *tab);
+
+// 清空字符串表, 删除所有字符串, 但不释放内存
+void easeds_strtab_clear(struct easeds_strtab *tab);
+
+// 获取索引项数量, 包括已删除未压缩的索引项
+uint32_t easeds_strtab_size(struct easeds_strtab *tab);
+
+// 判断字符串表是否没有索引项, 为空返回true, 否则返回false
+bool easeds_strtab_is_empty(struct easeds_strtab *tab);
+
+// 判断索引是否按字节序排列
+bool easeds_strtab_is_sorted(struct easeds_strtab *tab);
+
+// 追加一个长度为 length 的字符串, index 非空时返回下标, 成功返回0, 失败返回-1
+int32_t easeds_strtab_append(
+    struct easeds_strtab *tab, const char *str, uint32_t length, uint32_t *index);
+
+// 获取指定下标的字符串, 字符串以 '\0' 结尾, length 非空时返回长度, 成功返回0, 已删除或失败返回-1
+int32_t easeds_strtab_get(
+    struct easeds_strtab *tab, uint32_t index, const char **str, uint32_t *length);
+
+// 删除指定下标的字符串, 下标保持不变直到压缩, 成功返回0, 失败返回-1
+int32_t easeds_strtab_remove(struct easeds_strtab *tab, uint32_t index);
+
+// 按字节序稳定排序索引, 相同字符串保持追加顺序, 成功返回0, 失败返回-1
+int32_t easeds_strtab_sort(struct easeds_strtab *tab);
+
+// 在有序索引中查找字符串, 返回第一个未删除的相同字符串的下标, 成功返回0, 不存在或失败返回-1
+int32_t easeds_strtab_find(
+    struct easeds_strtab *tab, const char *str, uint32_t length, uint32_t *index);
+
+// 回收已删除字符串的空间并移除已删除的索引项, 之后的下标前移, 成功返回0, 失败返回-1
+int32_t easeds_strtab_compact(struct easeds_strtab *tab);
+
+// 获取统计信息, 成功返回0, 失败返回-1
+int32_t easeds_strtab_stats(struct easeds_strtab *tab, struct easeds_strtab_stats *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __EASEDS_STRTAB_H__ */
@@ -0,0 +1,350 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-task-unittest.c
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-18 16:50
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  Easeds 任务调度器单元测试实现文件, 包含了 spawn/sync/嵌套 fork-join/队列扩容/性能测试.
+ *
+ * @History:
+ *  2026年10月18日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#include "easeds-unittest.h"
+
+// 系统库头文件
+#include <unistd.h>
+
+// 项目内部头文件
+#include "easeds-task.h"
+#include "easeds-utils.h"
+
+// 计数任务
+struct task_counter {
+    struct easeds_task task;     /* 任务节点 */
+    uint64_t          *counter;  /* 共享计数 */
+    int32_t            worker;   /* 执行任务的工作线程编号 */
+    char               name[16]; /* 执行任务的线程名 */
+    uint32_t           pad;      /* 对齐填充 */
+};
+
+static struct easeds_task_sched *g_task_sched = NULL;
+
+static void task_counter_func(struct easeds_task *task, void *arg)
+{
+    struct task_counter *item = (struct task_counter *)task;
+
+    easeds_unused(arg);
+    __atomic_fetch_add(item->counter, 1, __ATOMIC_RELAXED);
+    item->worker = easeds_task_current_worker(g_task_sched);
+    easeds_snprintf(
+        item->name, (int32_t)sizeof(item->name), "%s", easeds_get_current_thread_name());
+}
+
+// 递归斐波那契任务, 一个子问题 spawn, 另一个子问题在当前线程计算
+struct task_fib {
+    struct easeds_task task;   /* 任务节点 */
+    uint64_t           n;      /* 输入 */
+    uint64_t           result; /* 结果 */
+};
+
+static uint64_t task_fib_serial(uint64_t n)
+{
+    return n < 2 ? n : task_fib_serial(n - 1) + task_fib_serial(n - 2);
+}
+
+static void task_fib_func(struct easeds_task *task, void *arg)
+{
+    struct task_fib *fib = (struct task_fib *)task;
+
+    easeds_unused(arg);
+    if (fib->n < 12) {
+        fib->result = task_fib_serial(fib->n);
+        return;
+    }
+
+    struct easeds_task_group group = EASEDS_TASK_GROUP_INITIALIZER;
+    struct task_fib          left  = {.n = fib->n - 1};
+    struct task_fib          right = {.n = fib->n - 2};
+
+    easeds_task_init(&left.task, task_fib_func, NULL);
+    assert_int_equal(easeds_task_spawn(g_task_sched, &group, &left.task), EASEDS_OK);
+    task_fib_func(&right.task, NULL);
+    easeds_task_sync(g_task_sched, &group);
+
+    fib->result = left.result + right.result;
+}
+
+// 并行求和任务, 区间足够小时直接计算, 否则二分
+struct task_sum {
+    struct easeds_task task;   /* 任务节点 */
+    const uint64_t    *data;   /* 数据 */
+    uint64_t           count;  /* 数量 */
+    uint64_t           result; /* 结果 */
+};
+
+static void task_sum_func(struct easeds_task *task, void *arg)
+{
+    struct task_sum *sum = (struct task_sum *)task;
+
+    easeds_unused(arg);
+    if (sum->count <= 4096) {
+        uint64_t total = 0;
+        for (uint64_t i = 0; i < sum->count; i++) {
+            total += sum->data[i];
+        }
+        sum->result = total;
+        return;
+    }
+
+    struct easeds_task_group group = EASEDS_TASK_GROUP_INITIALIZER;
+    struct task_sum          left  = {.data = sum->data, .count = sum->count / 2};
+    struct task_sum          right = {
+                 .data = sum->data + sum->count / 2, .count = sum->count - sum->count / 2};
+
+    easeds_task_init(&left.task, task_sum_func, NULL);
+    assert_int_equal(easeds_task_spawn(g_task_sched, &group, &left.task), EASEDS_OK);
+    task_sum_func(&right.task, NULL);
+    easeds_task_sync(g_task_sched, &group);
+
+    sum->result = left.result + right.result;
+}
+
+// 基本功能测试: 外部线程批量 spawn 后 sync, 工作线程命名
+static void test_easeds_task_basic(void **state)
+{
+    easeds_unused(state);
+
+    const uint32_t       count   = 10000;
+    uint64_t             counter = 0;
+    struct task_counter *items   = calloc(count, sizeof(struct task_counter));
+    assert_non_null(items);
+
+    g_task_sched = easeds_task_sched_create("ut", 4);
+    assert_non_null(g_task_sched);
+    assert_int_equal(easeds_task_sched_workers(g_task_sched), 4);
+    assert_int_equal(easeds_task_current_worker(g_task_sched), -1);
+
+    struct easeds_task_group group;
+    easeds_task_group_init(&group);
+    for (uint32_t i = 0; i < count; i++) {
+        items[i].counter = &counter;
+        easeds_task_init(&items[i].task, task_counter_func, NULL);
+        assert_int_equal(easeds_task_spawn(g_task_sched, &group, &items[i].task), EASEDS_OK);
+    }
+    easeds_task_sync(g_task_sched, &group);
+    assert_int_equal(counter, count);
+    assert_int_equal(group.state, 0);
+
+    for (uint32_t i = 0; i < count; i++) {
+        assert_true(items[i].worker >= 0 && items[i].worker < 4);
+        assert_int_equal(strncmp(items[i].name, "ut-", 3), 0);
+    }
+
+    struct easeds_task_stats stats;
+    easeds_task_sched_get_stats(g_task_sched, &stats);
+    assert_int_equal(stats.executed, count);
+
+    // 任务组可以复用
+    counter = 0;
+    for (uint32_t i = 0; i < 100; i++) {
+        assert_int_equal(easeds_task_spawn(g_task_sched, &group, &items[i].task), EASEDS_OK);
+    }
+    easeds_task_sync(g_task_sched, &group);
+    assert_int_equal(counter, 100);
+
+    easeds_task_sched_destroy(g_task_sched);
+    g_task_sched = NULL;
+    free(items);
+}
+
+// 基本功能测试: 嵌套 fork-join, 工作线程内 sync 时继续执行其他任务
+static void test_easeds_task_operations(void **state)
+{
+    easeds_unused(state);
+
+    g_task_sched = easeds_task_sched_create("fib", 4);
+    assert_non_null(g_task_sched);
+
+    for (uint64_t n = 0; n <= 25; n++) {
+        struct easeds_task_group group = EASEDS_TASK_GROUP_INITIALIZER;
+        struct task_fib          fib   = {.n = n};
+
+        easeds_task_init(&fib.task, task_fib_func, NULL);
+        assert_int_equal(easeds_task_spawn(g_task_sched, &group, &fib.task), EASEDS_OK);
+        easeds_task_sync(g_task_sched, &group);
+        assert_int_equal(fib.result, task_fib_serial(n));
+    }
+
+    // 空闲一段时间后工作线程休眠, 新任务能够唤醒它们
+    usleep(20000);
+    struct easeds_task_stats stats;
+    easeds_task_sched_get_stats(g_task_sched, &stats);
+    MEASURE("[task operations]: executed %lu, steals %lu, parks %lu.", stats.executed,
+        stats.steals, stats.parks);
+
+    struct easeds_task_group group = EASEDS_TASK_GROUP_INITIALIZER;
+    struct task_fib          fib   = {.n = 20};
+    easeds_task_init(&fib.task, task_fib_func, NULL);
+    assert_int_equal(easeds_task_spawn(g_task_sched, &group, &fib.task), EASEDS_OK);
+    easeds_task_sync(g_task_sched, &group);
+    assert_int_equal(fib.result, 6765);
+
+    easeds_task_sched_destroy(g_task_sched);
+    g_task_sched = NULL;
+}
+
+// 在工作线程内一次 spawn 大量任务, 触发双端队列扩容
+static void task_spawn_many_func(struct easeds_task *task, void *arg)
+{
+    struct task_counter     *items = arg;
+    struct easeds_task_group group = EASEDS_TASK_GROUP_INITIALIZER;
+
+    easeds_unused(task);
+    for (uint32_t i = 0; i < 5000; i++) {
+        easeds_task_init(&items[i].task, task_counter_func, NULL);
+        assert_int_equal(easeds_task_spawn(g_task_sched, &group, &items[i].task), EASEDS_OK);
+    }
+    easeds_task_sync(g_task_sched, &group);
+}
+
+// 边界测试: 单个工作线程, 队列扩容, 空任务组
+static void test_easeds_task_boundary(void **state)
+{
+    easeds_unused(state);
+
+    uint64_t             counter = 0;
+    struct task_counter *items   = calloc(5000, sizeof(struct task_counter));
+    assert_non_null(items);
+    for (uint32_t i = 0; i < 5000; i++) {
+        items[i].counter = &counter;
+    }
+
+    for (uint32_t workers = 1; workers <= 3; workers += 2) {
+        g_task_sched = easeds_task_sched_create("edge", workers);
+        assert_non_null(g_task_sched);
+
+        // 空任务组立即返回
+        struct easeds_task_group group = EASEDS_TASK_GROUP_INITIALIZER;
+        easeds_task_sync(g_task_sched, &group);
+
+        struct easeds_task root;
+        counter = 0;
+        easeds_task_init(&root, task_spawn_many_func, items);
+        assert_int_equal(easeds_task_spawn(g_task_sched, &group, &root), EASEDS_OK);
+        easeds_task_sync(g_task_sched, &group);
+        assert_int_equal(counter, 5000);
+        if (workers == 1) {
+            /* 没有窃取线程, 5000 个任务全部压入同一个队列 */
+            assert_true(g_task_sched->workers[0].ring->mask + 1 >= 5000);
+        }
+
+        easeds_task_sched_destroy(g_task_sched);
+        g_task_sched = NULL;
+    }
+
+    // 默认工作线程数量为在线 CPU 数量
+    struct easeds_task_sched *sched = easeds_task_sched_create(NULL, 0);
+    assert_non_null(sched);
+    assert_true(easeds_task_sched_workers(sched) >= 1);
+    easeds_task_sched_destroy(sched);
+
+    free(items);
+}
+
+// 失效测试: 非法参数
+static void test_easeds_task_error(void **state)
+{
+    easeds_unused(state);
+
+    assert_null(easeds_task_sched_create("error", EASEDS_TASK_MAX_WORKERS + 1));
+
+    struct easeds_task_sched *sched = easeds_task_sched_create("error", 1);
+    assert_non_null(sched);
+
+    struct easeds_task       task;
+    struct easeds_task_group group = EASEDS_TASK_GROUP_INITIALIZER;
+    easeds_task_init(&task, NULL, NULL);
+    assert_int_equal(easeds_task_spawn(sched, &group, &task), EASEDS_ERROR);
+    assert_int_equal(easeds_task_spawn(NULL, &group, &task), EASEDS_ERROR);
+    assert_int_equal(easeds_task_spawn(sched, NULL, &task), EASEDS_ERROR);
+    assert_int_equal(easeds_task_spawn(sched, &group, NULL), EASEDS_ERROR);
+    assert_int_equal(group.state, 0);
+
+    easeds_task_sync(NULL, &group);
+    easeds_task_sync(sched, NULL);
+    assert_int_equal(easeds_task_sched_workers(NULL), 0);
+    assert_int_equal(easeds_task_current_worker(NULL), -1);
+    easeds_task_sched_destroy(sched);
+    easeds_task_sched_destroy(NULL);
+}
+
+// 性能测试: 并行求和对比单线程, spawn/sync 开销
+static void test_easeds_task_perf(void **state)
+{
+    easeds_unused(state);
+
+    const uint64_t count = 1 << 24;
+    uint64_t      *data  = malloc(count * sizeof(uint64_t));
+    assert_non_null(data);
+    for (uint64_t i = 0; i < count; i++) {
+        data[i] = i;
+    }
+
+    int64_t  start  = easeds_get_current_time_ns();
+    uint64_t serial = 0;
+    for (uint64_t i = 0; i < count; i++) {
+        serial += data[i];
+    }
+    int64_t serial_ns = easeds_get_current_time_ns() - start;
+
+    g_task_sched = easeds_task_sched_create("perf", 0);
+    assert_non_null(g_task_sched);
+
+    struct easeds_task_group group = EASEDS_TASK_GROUP_INITIALIZER;
+    struct task_sum          sum   = {.data = data, .count = count};
+    easeds_task_init(&sum.task, task_sum_func, NULL);
+    start = easeds_get_current_time_ns();
+    assert_int_equal(easeds_task_spawn(g_task_sched, &group, &sum.task), EASEDS_OK);
+    easeds_task_sync(g_task_sched, &group);
+    int64_t parallel_ns = easeds_get_current_time_ns() - start;
+    assert_int_equal(sum.result, serial);
+
+    MEASURE("[task perf]: sum %lu elements, %u workers, serial %.3f ms, parallel %.3f ms.", count,
+        easeds_task_sched_workers(g_task_sched), (double)serial_ns / 1e6,
+        (double)parallel_ns / 1e6);
+
+    // 细粒度任务: fib(30) 在 n < 12 时串行, 约 1.3 万个任务
+    struct task_fib fib = {.n = 30};
+    easeds_task_init(&fib.task, task_fib_func, NULL);
+    start = easeds_get_current_time_ns();
+    assert_int_equal(easeds_task_spawn(g_task_sched, &group, &fib.task), EASEDS_OK);
+    easeds_task_sync(g_task_sched, &group);
+    int64_t fib_ns = easeds_get_current_time_ns() - start;
+    assert_int_equal(fib.result, 832040);
+
+    struct easeds_task_stats stats;
+    easeds_task_sched_get_stats(g_task_sched, &stats);
+    MEASURE("[task perf]: fib(30) %.3f ms, executed %lu, steals %lu, parks %lu.",
+        (double)fib_ns / 1e6, stats.executed, stats.steals, stats.parks);
+
+    easeds_task_sched_destroy(g_task_sched);
+    g_task_sched = NULL;
+    free(data);
+}
+
+// 注册单元测试用例
+EASEDS_UNITTEST_REGISTER(easeds_unittest_task){
+    cmocka_unit_test(test_easeds_task_basic),
+    cmocka_unit_test(test_easeds_task_operations),
+    cmocka_unit_test(test_easeds_task_boundary),
+    cmocka_unit_test(test_easeds_task_error),
+    cmocka_unit_test(test_easeds_task_perf),
+    easeds_unit_test_end,
+};
@@ -0,0 +1,587 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-task.c
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-18 16:10
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  基于 Chase-Lev 工作窃取双端队列的任务调度器实现文件.
+ *
+ * @History:
+ *  2026年10月18日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#include "easeds-task.h"
+
+// 系统库头文件
+#include <linux/futex.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+// 标准库头文件
+#include <stdlib.h>
+#include <string.h>
+
+// 项目内部头文件
+#include "easeds-log.h"
+#include "easeds-utils.h"
+
+/* 双端队列初始槽位数量 */
+#define TASK_RING_INIT_SIZE 256
+
+/* 空闲工作线程进入休眠前让出 CPU 的次数 */
+#define TASK_IDLE_SPIN 64
+
+/* 当前线程所属的工作线程, 非工作线程为 NULL */
+static EASEDS_THREAD_DEFINE(struct easeds_task_worker *, easeds_task_current) = NULL;
+
+// 在 addr 上休眠, 值不等于 val 时立即返回
+static void task_futex_wait(uint32_t *addr, uint32_t val)
+{
+    (void)syscall(SYS_futex, addr, FUTEX_WAIT_PRIVATE, val, NULL, NULL, 0);
+}
+
+// 唤醒在 addr 上休眠的最多 count 个线程
+static void task_futex_wake(uint32_t *addr, int32_t count)
+{
+    (void)syscall(SYS_futex, addr, FUTEX_WAKE_PRIVATE, count, NULL, NULL, 0);
+}
+
+// 分配环形数组
+static struct easeds_task_ring *task_ring_alloc(int64_t size)
+{
+    struct easeds_task_ring *ring = __easeds_malloc(
+        sizeof(struct easeds_task_ring) + (uint64_t)size * sizeof(struct easeds_task *));
+    if (unlikely(ring == NULL)) {
+        return NULL;
+    }
+
+    ring->prev = NULL;
+    ring->mask = size - 1;
+    return ring;
+}
+
+// 所有者扩容环形数组, 旧数组可能仍被窃取线程读取, 挂到 prev 链表上延迟释放
+static struct easeds_task_ring *task_ring_grow(
+    struct easeds_task_worker *worker, struct easeds_task_ring *ring, int64_t top, int64_t bottom)
+{
+    struct easeds_task_ring *bigger = task_ring_alloc((ring->mask + 1) * 2);
+    if (unlikely(bigger == NULL)) {
+        EASEDS_ERR("[task_ring_grow]: Worker %u malloc ring failed.", worker->id);
+        return NULL;
+    }
+
+    for (int64_t i = top; i < bottom; i++) {
+        bigger->slots[i & bigger->mask] =
+            __atomic_load_n(&ring->slots[i & ring->mask], __ATOMIC_RELAXED);
+    }
+    bigger->prev = ring;
+
+    __atomic_store_n(&worker->ring, bigger, __ATOMIC_RELEASE);
+    return bigger;
+}
+
+// 所有者从 bottom 端压入任务
+static int32_t task_deque_push(struct easeds_task_worker *worker, struct easeds_task *task)
+{
+    int64_t                  bottom = __atomic_load_n(&worker->bottom, __ATOMIC_RELAXED);
+    int64_t                  top    = __atomic_load_n(&worker->top, __ATOMIC_ACQUIRE);
+    struct easeds_task_ring *ring   = __atomic_load_n(&worker->ring, __ATOMIC_RELAXED);
+
+    if (unlikely(bottom - top > ring->mask)) {
+        ring = task_ring_grow(worker, ring, top, bottom);
+        if (unlikely(ring == NULL)) {
+            return -1;
+        }
+    }
+
+    /* release 语义保证窃取线程看到新的 bottom 时, 也能看到任务节点和槽位的内容 */
+    __atomic_store_n(&ring->slots[bottom & ring->mask], task, __ATOMIC_RELAXED);
+    __atomic_store_n(&worker->bottom, bottom + 1, __ATOMIC_RELEASE);
+    return 0;
+}
+
+// 所有者从 bottom 端弹出任务, 只剩最后一个任务时和窃取线程通过 CAS top 竞争
+static struct easeds_task *task_deque_pop(struct easeds_task_worker *worker)
+{
+    int64_t                  bottom = __atomic_load_n(&worker->bottom, __ATOMIC_RELAXED) - 1;
+    struct easeds_task_ring *ring   = __atomic_load_n(&worker->ring, __ATOMIC_RELAXED);
+    struct easeds_task      *task   = NULL;
+    int64_t                  top;
+
+    __atomic_store_n(&worker->bottom, bottom, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    top = __atomic_load_n(&worker->top, __ATOMIC_RELAXED);
+
+    if (top <= bottom) {
+        task = __atomic_load_n(&ring->slots[bottom & ring->mask], __ATOMIC_RELAXED);
+        if (top == bottom) {
+            if (!__atomic_compare_exchange_n(
+                    &worker->top, &top, top + 1, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED)) {
+                /* 被窃取线程抢走 */
+                task = NULL;
+            }
+            __atomic_store_n(&worker->bottom, bottom + 1, __ATOMIC_RELAXED);
+        }
+    } else {
+        __atomic_store_n(&worker->bottom, bottom + 1, __ATOMIC_RELAXED);
+    }
+
+    return task;
+}
+
+// 其他线程从 top 端窃取任务, 竞争失败返回NULL
+static struct easeds_task *task_deque_steal(struct easeds_task_worker *victim)
+{
+    int64_t top = __atomic_load_n(&victim->top, __ATOMIC_ACQUIRE);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    int64_t bottom = __atomic_load_n(&victim->bottom, __ATOMIC_ACQUIRE);
+
+    if (top >= bottom) {
+        return NULL;
+    }
+
+    struct easeds_task_ring *ring = __atomic_load_n(&victim->ring, __ATOMIC_ACQUIRE);
+    struct easeds_task      *task =
+        __atomic_load_n(&ring->slots[top & ring->mask], __ATOMIC_RELAXED);
+    if (!__atomic_compare_exchange_n(
+            &victim->top, &top, top + 1, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED)) {
+        return NULL;
+    }
+
+    return task;
+}
+
+// 从注入队列取出一个任务
+static struct easeds_task *task_inject_pop(struct easeds_task_sched *sched)
+{
+    struct easeds_task *task;
+
+    if (__atomic_load_n(&sched->inject_count, __ATOMIC_RELAXED) == 0) {
+        return NULL;
+    }
+
+    pthread_mutex_lock(&sched->inject_lock);
+    task = STAILQ_FIRST(&sched->inject);
+    if (task != NULL) {
+        STAILQ_REMOVE_HEAD(&sched->inject, entry);
+        __atomic_fetch_sub(&sched->inject_count, 1, __ATOMIC_RELAXED);
+    }
+    pthread_mutex_unlock(&sched->inject_lock);
+
+    return task;
+}
+
+// 查找下一个任务: 自己的队列, 注入队列, 从随机工作线程开始依次窃取
+static struct easeds_task *task_find(struct easeds_task_worker *worker)
+{
+    struct easeds_task_sched *sched = worker->sched;
+    struct easeds_task       *task  = task_deque_pop(worker);
+
+    if (task != NULL) {
+        return task;
+    }
+
+    task = task_inject_pop(sched);
+    if (task != NULL) {
+        return task;
+    }
+
+    worker->seed ^= worker->seed << 13;
+    worker->seed ^= worker->seed >> 7;
+    worker->seed ^= worker->seed << 17;
+
+    uint32_t start = (uint32_t)(worker->seed % sched->nworkers);
+    for (uint32_t i = 0; i < sched->nworkers; i++) {
+        uint32_t victim = start + i < sched->nworkers ? start + i : start + i - sched->nworkers;
+        if (victim == worker->id) {
+            continue;
+        }
+        task = task_deque_steal(&sched->workers[victim]);
+        if (task != NULL) {
+            __atomic_store_n(&worker->steals, worker->steals + 1, __ATOMIC_RELAXED);
+            return task;
+        }
+    }
+
+    return NULL;
+}
+
+// 任务完成, 最后一个任务完成且有外部线程等待时唤醒, 之后不再访问任务组以外的内存
+static void task_group_done(struct easeds_task_group *group)
+{
+    uint32_t old = __atomic_fetch_sub(&group->state, 1, __ATOMIC_ACQ_REL);
+
+    if ((old & EASEDS_TASK_GROUP_WAITER) != 0 && (old & EASEDS_TASK_GROUP_PENDING) == 1) {
+        /* 等待线程返回后任务组可能被释放, futex 唤醒只使用地址, 不访问内存内容 */
+        task_futex_wake(&group->state, INT32_MAX);
+    }
+}
+
+// 执行任务, 任务函数返回后任务节点可能被释放, 先保存任务组
+static void task_run(struct easeds_task_worker *worker, struct easeds_task *task)
+{
+    struct easeds_task_group *group = task->group;
+
+    task->func(task, task->arg);
+    __atomic_store_n(&worker->executed, worker->executed + 1, __ATOMIC_RELAXED);
+    task_group_done(group);
+}
+
+// 判断是否有待执行的任务
+static bool task_has_work(struct easeds_task_sched *sched)
+{
+    if (__atomic_load_n(&sched->inject_count, __ATOMIC_SEQ_CST) != 0) {
+        return true;
+    }
+
+    for (uint32_t i = 0; i < sched->nworkers; i++) {
+        struct easeds_task_worker *worker = &sched->workers[i];
+        if (__atomic_load_n(&worker->bottom, __ATOMIC_SEQ_CST)
+            > __atomic_load_n(&worker->top, __ATOMIC_SEQ_CST)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * 空闲工作线程休眠, 和 spawn 组成 Dekker 式同步, 避免丢失唤醒:
+ *  休眠方先增加 sleepers, 再读取 wake_seq 并检查所有队列;
+ *  提交方先发布任务, 再读取 sleepers, 非零时递增 wake_seq 并唤醒.
+ *  两边都是顺序一致的操作, 要么提交方看到 sleepers, 要么休眠方看到新任务.
+ */
+static void task_park(struct easeds_task_worker *worker)
+{
+    struct easeds_task_sched *sched = worker->sched;
+
+    __atomic_fetch_add(&sched->sleepers, 1, __ATOMIC_SEQ_CST);
+    uint32_t seq = __atomic_load_n(&sched->wake_seq, __ATOMIC_SEQ_CST);
+
+    if (!__atomic_load_n(&sched->stop, __ATOMIC_SEQ_CST) && !task_has_work(sched)) {
+        __atomic_store_n(&worker->parks, worker->parks + 1, __ATOMIC_RELAXED);
+        task_futex_wait(&sched->wake_seq, seq);
+    }
+
+    __atomic_fetch_sub(&sched->sleepers, 1, __ATOMIC_RELAXED);
+}
+
+// 唤醒 count 个休眠的工作线程
+static void task_wake(struct easeds_task_sched *sched, int32_t count)
+{
+    __atomic_fetch_add(&sched->wake_seq, 1, __ATOMIC_SEQ_CST);
+    task_futex_wake(&sched->wake_seq, count);
+}
+
+// 工作线程主循环
+static void *task_worker_main(void *arg)
+{
+    struct easeds_task_worker *worker = arg;
+    struct easeds_task_sched  *sched  = worker->sched;
+    char                       name[EASEDS_THREAD_NAME_LEN];
+    uint32_t                   idle = 0;
+
+    easeds_snprintf(name, (int32_t)sizeof(name), "%.10s-%u",
+        sched->name != NULL ? sched->name : "task", worker->id);
+    easeds_set_current_thread_name(name);
+    EASEDS_THREAD_VAR(easeds_task_current) = worker;
+
+    while (!__atomic_load_n(&sched->stop, __ATOMIC_ACQUIRE)) {
+        struct easeds_task *task = task_find(worker);
+        if (task != NULL) {
+            task_run(worker, task);
+            idle = 0;
+            continue;
+        }
+
+        if (++idle < TASK_IDLE_SPIN) {
+            sched_yield();
+            continue;
+        }
+
+        task_park(worker);
+        idle = 0;
+    }
+
+    EASEDS_THREAD_VAR(easeds_task_current) = NULL;
+    return NULL;
+}
+
+// 获取当前线程在 sched 中对应的工作线程, 不是该调度器的工作线程返回NULL
+static struct easeds_task_worker *task_current(struct easeds_task_sched *sched)
+{
+    struct easeds_task_worker *worker = EASEDS_THREAD_VAR(easeds_task_current);
+    return (worker != NULL && worker->sched == sched) ? worker : NULL;
+}
+
+/**
+ * @description: 创建调度器并启动工作线程, 返回调度器指针, 失败返回NULL.
+ * @param name 调度器名称, 用作工作线程名前缀, 超过 10 个字符时截断
+ * @param nworkers 工作线程数量, 为 0 时使用在线 CPU 数量, 不超过 EASEDS_TASK_MAX_WORKERS
+ * @return 成功返回调度器指针, 失败返回NULL
+ */
+struct easeds_task_sched *easeds_task_sched_create(const char *name, uint32_t nworkers)
+{
+    if (nworkers == 0) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        nworkers  = cpus > 0 ? (uint32_t)cpus : 1;
+        if (nworkers > EASEDS_TASK_MAX_WORKERS) {
+            nworkers = EASEDS_TASK_MAX_WORKERS;
+        }
+    }
+
+    if (unlikely(nworkers > EASEDS_TASK_MAX_WORKERS)) {
+        EASEDS_ERR("[easeds_task_sched_create]: Invalid workers %u, max %u.", nworkers,
+            EASEDS_TASK_MAX_WORKERS);
+        return NULL;
+    }
+
+    struct easeds_task_sched *sched = __easeds_malloc(sizeof(struct easeds_task_sched));
+    if (unlikely(sched == NULL)) {
+        EASEDS_ERR("[easeds_task_sched_create]: Malloc sched failed.");
+        return NULL;
+    }
+    memset(sched, 0, sizeof(struct easeds_task_sched));
+
+    sched->name     = name;
+    sched->nworkers = nworkers;
+    STAILQ_INIT(&sched->inject);
+    pthread_mutex_init(&sched->inject_lock, NULL);
+
+    sched->workers = __easeds_aligned_alloc(
+        EASEDS_CACHE_LINE_SIZE, nworkers * sizeof(struct easeds_task_worker));
+    if (unlikely(sched->workers == NULL)) {
+        EASEDS_ERR("[easeds_task_sched_create]: Malloc %u workers failed.", nworkers);
+        pthread_mutex_destroy(&sched->inject_lock);
+        __easeds_free(sched);
+        return NULL;
+    }
+    memset(sched->workers, 0, nworkers * sizeof(struct easeds_task_worker));
+
+    /* 先初始化全部队列, 工作线程启动后会访问其他工作线程的队列 */
+    for (uint32_t i = 0; i < nworkers; i++) {
+        struct easeds_task_worker *worker = &sched->workers[i];
+
+        worker->sched = sched;
+        worker->id    = i;
+        worker->seed  = 0x9E3779B97F4A7C15ULL * (i + 1);
+        worker->ring  = task_ring_alloc(TASK_RING_INIT_SIZE);
+        if (unlikely(worker->ring == NULL)) {
+            EASEDS_ERR("[easeds_task_sched_create]: Malloc ring failed.");
+            easeds_task_sched_destroy(sched);
+            return NULL;
+        }
+    }
+
+    for (uint32_t i = 0; i < nworkers; i++) {
+        struct easeds_task_worker *worker = &sched->workers[i];
+
+        if (unlikely(pthread_create(&worker->thread, NULL, task_worker_main, worker) != 0)) {
+            EASEDS_ERR("[easeds_task_sched_create]: Create worker %u failed.", i);
+            easeds_task_sched_destroy(sched);
+            return NULL;
+        }
+        worker->started = 1;
+    }
+
+    PFL_DEBUG("[easeds_task_sched_create]: Create sched %s with %u workers.",
+        name != NULL ? name : "", nworkers);
+    return sched;
+}
+
+/**
+ * @description: 停止并等待工作线程退出, 销毁调度器.
+ *  调用前需要 sync 所有任务组, 队列中尚未执行的任务被丢弃.
+ * @param sched 调度器指针
+ * @return 无
+ */
+void easeds_task_sched_destroy(struct easeds_task_sched *sched)
+{
+    if (unlikely(sched == NULL)) {
+        return;
+    }
+
+    __atomic_store_n(&sched->stop, 1, __ATOMIC_SEQ_CST);
+    task_wake(sched, INT32_MAX);
+
+    for (uint32_t i = 0; i < sched->nworkers; i++) {
+        struct easeds_task_worker *worker = &sched->workers[i];
+
+        if (worker->started) {
+            pthread_join(worker->thread, NULL);
+        }
+
+        struct easeds_task_ring *ring = worker->ring;
+        while (ring != NULL) {
+            struct easeds_task_ring *prev = ring->prev;
+            __easeds_free(ring);
+            ring = prev;
+        }
+    }
+
+    pthread_mutex_destroy(&sched->inject_lock);
+    __easeds_free(sched->workers);
+    __easeds_free(sched);
+}
+
+// 获取工作线程数量
+uint32_t easeds_task_sched_workers(struct easeds_task_sched *sched)
+{
+    if (unlikely(sched == NULL)) {
+        return 0;
+    }
+
+    return sched->nworkers;
+}
+
+// 获取统计计数, 工作线程运行中读取时为近似值
+void easeds_task_sched_get_stats(struct easeds_task_sched *sched, struct easeds_task_stats *stats)
+{
+    if (unlikely(sched == NULL || stats == NULL)) {
+        return;
+    }
+
+    memset(stats, 0, sizeof(struct easeds_task_stats));
+    for (uint32_t i = 0; i < sched->nworkers; i++) {
+        struct easeds_task_worker *worker = &sched->workers[i];
+        stats->executed += __atomic_load_n(&worker->executed, __ATOMIC_RELAXED);
+        stats->steals += __atomic_load_n(&worker->steals, __ATOMIC_RELAXED);
+        stats->parks += __atomic_load_n(&worker->parks, __ATOMIC_RELAXED);
+    }
+}
+
+// 获取当前线程在调度器中的编号, 非该调度器的工作线程返回-1
+int32_t easeds_task_current_worker(struct easeds_task_sched *sched)
+{
+    struct easeds_task_worker *worker = task_current(sched);
+    return worker != NULL ? (int32_t)worker->id : -1;
+}
+
+// 初始化任务节点, 设置任务函数和用户数据
+void easeds_task_init(
+    struct easeds_task *task, void (*func)(struct easeds_task *task, void *arg), void *arg)
+{
+    if (unlikely(task == NULL)) {
+        return;
+    }
+
+    memset(task, 0, sizeof(struct easeds_task));
+    task->func = func;
+    task->arg  = arg;
+}
+
+// 初始化任务组
+void easeds_task_group_init(struct easeds_task_group *group)
+{
+    if (unlikely(group == NULL)) {
+        return;
+    }
+
+    group->state = 0;
+}
+
+/**
+ * @description: 提交任务到任务组.
+ *  工作线程提交的任务压入自己的双端队列, 外部线程提交的任务放入注入队列.
+ * @param sched 调度器指针
+ * @param group 任务组指针, 任务完成前必须保持有效
+ * @param task 任务节点指针, 任务开始执行前必须保持有效
+ * @return 成功返回0, 失败返回-1
+ */
+int32_t easeds_task_spawn(
+    struct easeds_task_sched *sched, struct easeds_task_group *group, struct easeds_task *task)
+{
+    if (unlikely(sched == NULL || group == NULL || task == NULL || task->func == NULL)) {
+        EASEDS_ERR("[easeds_task_spawn]: Invalid sched %p, group %p or task %p.", (void *)sched,
+            (void *)group, (void *)task);
+        return -1;
+    }
+
+    if (unlikely((__atomic_load_n(&group->state, __ATOMIC_RELAXED) & EASEDS_TASK_GROUP_PENDING)
+                 == EASEDS_TASK_GROUP_PENDING)) {
+        EASEDS_ERR("[easeds_task_spawn]: Too many pending tasks in group.");
+        return -1;
+    }
+
+    task->group = group;
+    __atomic_fetch_add(&group->state, 1, __ATOMIC_RELAXED);
+
+    struct easeds_task_worker *worker = task_current(sched);
+    if (worker != NULL) {
+        if (unlikely(task_deque_push(worker, task) != 0)) {
+            __atomic_fetch_sub(&group->state, 1, __ATOMIC_RELAXED);
+            return -1;
+        }
+    } else {
+        pthread_mutex_lock(&sched->inject_lock);
+        STAILQ_INSERT_TAIL(&sched->inject, task, entry);
+        __atomic_fetch_add(&sched->inject_count, 1, __ATOMIC_RELAXED);
+        pthread_mutex_unlock(&sched->inject_lock);
+    }
+
+    /* 发布任务后再检查休眠线程, 见 task_park 的说明 */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&sched->sleepers, __ATOMIC_RELAXED) != 0) {
+        task_wake(sched, 1);
+    }
+
+    return 0;
+}
+
+/**
+ * @description: 等待任务组内所有任务完成.
+ *  工作线程等待期间继续执行自己队列中的任务或窃取其他任务, 外部线程在任务组上 futex 休眠.
+ * @param sched 调度器指针
+ * @param group 任务组指针
+ * @return 无
+ */
+void easeds_task_sync(struct easeds_task_sched *sched, struct easeds_task_group *group)
+{
+    if (unlikely(sched == NULL || group == NULL)) {
+        EASEDS_ERR("[easeds_task_sync]: Invalid sched %p or group %p.", (void *)sched,
+            (void *)group);
+        return;
+    }
+
+    struct easeds_task_worker *worker = task_current(sched);
+    if (worker != NULL) {
+        while ((__atomic_load_n(&group->state, __ATOMIC_ACQUIRE) & EASEDS_TASK_GROUP_PENDING)
+               != 0) {
+            struct easeds_task *task = task_find(worker);
+            if (task != NULL) {
+                task_run(worker, task);
+            } else {
+                sched_yield();
+            }
+        }
+        return;
+    }
+
+    for (;;) {
+        uint32_t state = __atomic_load_n(&group->state, __ATOMIC_ACQUIRE);
+        if ((state & EASEDS_TASK_GROUP_PENDING) == 0) {
+            break;
+        }
+
+        if ((state & EASEDS_TASK_GROUP_WAITER) == 0) {
+            if (!__atomic_compare_exchange_n(&group->state, &state,
+                    state | EASEDS_TASK_GROUP_WAITER, false, __ATOMIC_ACQ_REL,
+                    __ATOMIC_ACQUIRE)) {
+                continue;
+            }
+            state |= EASEDS_TASK_GROUP_WAITER;
+        }
+
+        task_futex_wait(&group->state, state);
+    }
+
+    /* 所有任务已完成, 不会再有线程修改状态, 清除等待标志以便复用 */
+    __atomic_store_n(&group->state, 0, __ATOMIC_RELAXED);
+}
@@ -0,0 +1,170 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-task.h
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-18 16:10
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  基于 Chase-Lev 工作窃取双端队列的任务调度器, 支持 spawn/sync 形式的 fork-join 并行.
+ *
+ * @History:
+ *  2026年10月18日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#ifndef __EASEDS_TASK_H__
+#define __EASEDS_TASK_H__
+
+/* C 标准库头文件 */
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/* 项目内部头文件 */
+#include "easeds-environment.h"
+#include "easeds-public.h"
+#include "easeds-queue.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 工作线程数量上限 */
+#define EASEDS_TASK_MAX_WORKERS 256
+
+/* 任务组状态中的等待标志位, 其余位为未完成的任务数量 */
+#define EASEDS_TASK_GROUP_WAITER  (1U << 31)
+#define EASEDS_TASK_GROUP_PENDING (EASEDS_TASK_GROUP_WAITER - 1)
+
+/* 任务组, 记录一组任务的完成情况, sync 等待组内所有任务完成 */
+struct easeds_task_group {
+    uint32_t state; /* 未完成任务数量和等待标志位 */
+};
+
+#define EASEDS_TASK_GROUP_INITIALIZER {0}
+
+/* 任务节点, 由用户嵌入到自己的结构体中, 调度器不负责分配和释放, 完成前必须保持有效 */
+struct easeds_task {
+    STAILQ_ENTRY(easeds_task) entry;                   /* 外部线程提交时使用的注入队列节点 */
+    void (*func)(struct easeds_task *task, void *arg); /* 任务函数 */
+    void                     *arg;                     /* 任务函数的用户数据 */
+    struct easeds_task_group *group;                   /* 所属任务组 */
+};
+
+STAILQ_HEAD(easeds_task_list, easeds_task);
+
+/* 工作窃取双端队列的环形数组, 扩容后旧数组挂到 prev 链表上, 销毁调度器时统一释放 */
+struct easeds_task_ring {
+    struct easeds_task_ring *prev;    /* 扩容前的旧数组 */
+    int64_t                  mask;    /* 槽位数量减一, 槽位数量为 2 的幂 */
+    struct easeds_task      *slots[]; /* 任务指针槽位 */
+};
+
+/**
+ * 工作线程, 每个工作线程拥有一个 Chase-Lev 双端队列:
+ *  (1) 所有者从 bottom 端压入和弹出(LIFO), 其他线程从 top 端窃取(FIFO).
+ *  (2) top 被窃取线程频繁修改, 单独占用一个缓存行, 避免和所有者字段伪共享.
+ *  (3) 结构体大小为缓存行的整数倍, 数组中相邻工作线程之间也不会伪共享.
+ */
+struct easeds_task_worker {
+    int64_t                   top;                              /* 窃取端下标 */
+    uint8_t                   pad0[EASEDS_CACHE_LINE_SIZE - 8]; /* 缓存行填充 */
+    int64_t                   bottom;                           /* 所有者端下标 */
+    struct easeds_task_ring  *ring;                             /* 当前环形数组 */
+    struct easeds_task_sched *sched;                            /* 所属调度器 */
+    pthread_t                 thread;                           /* 线程句柄 */
+    uint64_t                  seed;     /* 随机选择窃取对象的 xorshift 状态 */
+    uint64_t                  executed; /* 执行的任务数量 */
+    uint64_t                  steals;   /* 成功窃取的任务数量 */
+    uint64_t                  parks;    /* 休眠次数 */
+    uint32_t                  id;       /* 工作线程编号 */
+    uint32_t                  started;  /* 线程是否已启动 */
+    uint8_t                   pad1[EASEDS_CACHE_LINE_SIZE - 8]; /* 缓存行填充 */
+};
+
+/* 调度器统计计数, 所有工作线程之和 */
+struct easeds_task_stats {
+    uint64_t executed; /* 工作线程执行的任务数量 */
+    uint64_t steals;   /* 成功窃取的任务数量 */
+    uint64_t parks;    /* 空闲休眠次数 */
+};
+
+/**
+ * 实现一个工作窃取(work-stealing)任务调度器, 用于把细粒度任务分散到多个 CPU 上执行.
+ *  (1) 每个工作线程拥有一个 Chase-Lev 双端队列, 工作线程内 spawn 的任务压入自己的队列,
+ *      优先执行最近 spawn 的任务, 缓存局部性好; 外部线程 spawn 的任务放入加锁的注入队列.
+ *  (2) 自己的队列为空时, 先检查注入队列, 再从随机选择的工作线程开始依次尝试窃取.
+ *  (3) sync 等待任务组完成: 工作线程在等待期间继续执行其他任务, 不会阻塞也不会死锁;
+ *      外部线程在任务组状态上通过 futex 休眠, 最后一个任务完成时唤醒.
+ *  (4) 空闲工作线程短暂让出 CPU 后在 futex 上休眠, 不会空转; spawn 只在存在休眠线程时
+ *      才执行唤醒系统调用, 繁忙时没有额外开销.
+ *  (5) 工作线程通过 easeds_set_current_thread_name 命名为 "名称-编号", 日志前缀可以区分.
+ *  (6) 任务节点和任务组由用户管理, 调度器内部不为每个任务分配内存.
+ */
+struct easeds_task_sched {
+    const char                *name;         /* 名称, 用作工作线程名前缀 */
+    struct easeds_task_worker *workers;      /* 工作线程数组 */
+    pthread_mutex_t            inject_lock;  /* 注入队列锁 */
+    struct easeds_task_list    inject;       /* 外部线程提交的任务 */
+    uint32_t                   nworkers;     /* 工作线程数量 */
+    uint32_t                   inject_count; /* 注入队列中的任务数量 */
+    uint32_t                   wake_seq;     /* 休眠 futex 序号, 唤醒时递增 */
+    uint32_t                   sleepers;     /* 正在休眠或准备休眠的工作线程数量 */
+    uint32_t                   stop;         /* 停止标志 */
+    uint32_t                   pad;          /* 对齐填充 */
+};
+
+/**
+ * 常见任务调度操作函数:
+ *
+ * 函数名                       功能描述
+ * ------------------------     ------------------------------------------------------
+ * easeds_task_sched_create     创建调度器并启动工作线程, 失败返回NULL
+ * easeds_task_sched_destroy    停止并等待工作线程退出, 销毁调度器
+ * easeds_task_sched_workers    获取工作线程数量
+ * easeds_task_sched_get_stats  获取统计计数
+ * easeds_task_current_worker   获取当前线程在调度器中的编号, 非工作线程返回-1
+ * easeds_task_init             初始化任务节点, 设置任务函数和用户数据
+ * easeds_task_group_init       初始化任务组
+ * easeds_task_spawn            提交任务到任务组, 成功返回0, 失败返回-1
+ * easeds_task_sync             等待任务组内所有任务完成
+ */
+
+// 创建调度器并启动 nworkers 个工作线程, nworkers 为 0 时使用在线 CPU 数量, 失败返回NULL
+struct easeds_task_sched *easeds_task_sched_create(const char *name, uint32_t nworkers);
+
+// 停止并等待工作线程退出, 销毁调度器, 调用前需要 sync 所有任务组, 未执行的任务被丢弃
+void easeds_task_sched_destroy(struct easeds_task_sched *sched);
+
+// 获取工作线程数量
+uint32_t easeds_task_sched_workers(struct easeds_task_sched *sched);
+
+// 获取统计计数, 工作线程运行中读取时为近似值
+void easeds_task_sched_get_stats(struct easeds_task_sched *sched, struct easeds_task_stats *stats);
+
+// 获取当前线程在调度器中的编号, 非该调度器的工作线程返回-1
+int32_t easeds_task_current_worker(struct easeds_task_sched *sched);
+
+// 初始化任务节点, 设置任务函数和用户数据
+void easeds_task_init(
+    struct easeds_task *task, void (*func)(struct easeds_task *task, void *arg), void *arg);
+
+// 初始化任务组
+void easeds_task_group_init(struct easeds_task_group *group);
+
+// 提交任务到任务组, 任务完成前任务节点必须保持有效, 成功返回0, 失败返回-1
+int32_t easeds_task_spawn(
+    struct easeds_task_sched *sched, struct easeds_task_group *group, struct easeds_task *task);
+
+// 等待任务组内所有任务完成, 工作线程等待期间继续执行其他任务, 外部线程休眠等待
+void easeds_task_sync(struct easeds_task_sched *sched, struct easeds_task_group *group);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __EASEDS_TASK_H__ */
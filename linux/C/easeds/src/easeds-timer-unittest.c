@@ -0,0 +1,288 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-timer-unittest.c
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-18 14:05
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  Easeds 时间轮定时器单元测试实现文件, 包含了到期精度/级联/取消/回调中重新添加测试.
+ *
+ * @History:
+ *  2026年10月18日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#include "easeds-unittest.h"
+
+// 项目内部头文件
+#include "easeds-timer.h"
+#include "easeds-utils.h"
+
+#define TIMER_TEST_TICK_NS 1000
+
+// 测试定时器, 记录期望到期 tick 和实际执行时的 tick
+struct timer_item {
+    struct easeds_timer        timer;
+    struct easeds_timer_wheel *wheel;
+    uint64_t                   expect;   /* 期望执行时 wheel->current 的值 */
+    uint64_t                   fired_at; /* 实际执行时 wheel->current 的值 */
+    uint32_t                   fired;    /* 执行次数 */
+    uint32_t                   period;   /* 周期 tick 数, 非0时在回调中重新添加 */
+};
+
+static void timer_item_cb(struct easeds_timer *timer, void *data)
+{
+    struct timer_item *item = data;
+    assert_ptr_equal(&item->timer, timer);
+    assert_false(easeds_timer_pending(timer));
+
+    item->fired_at = item->wheel->current;
+    item->fired++;
+    if (item->period != 0) {
+        item->expect = item->wheel->current + item->period;
+        easeds_timer_wheel_add(item->wheel, timer, (uint64_t)item->period * TIMER_TEST_TICK_NS);
+    }
+}
+
+// 推进到指定 tick
+static uint64_t timer_advance_to(struct easeds_timer_wheel *wheel, uint64_t tick)
+{
+    return easeds_timer_wheel_advance(
+        wheel, wheel->start_ns + (int64_t)(tick * TIMER_TEST_TICK_NS));
+}
+
+// 基本功能测试: 添加定时器, 逐 tick 推进, 校验每个定时器恰好在期望 tick 执行
+static void test_easeds_timer_basic(void **state)
+{
+    easeds_unused(state);
+
+    const uint32_t             count = 4096;
+    struct easeds_timer_wheel *wheel = easeds_timer_wheel_create("basic", TIMER_TEST_TICK_NS);
+    struct timer_item         *items = calloc(count, sizeof(struct timer_item));
+    assert_non_null(wheel);
+    assert_non_null(items);
+
+    // 超时覆盖第 0~2 层, 部分超时不是 tick 的整数倍, 需要向上取整
+    uint64_t max_tick = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        uint64_t timeout_ns = ((uint64_t)i * 7919 % 300000) * 37 + i % 3;
+        items[i].wheel      = wheel;
+        items[i].expect     = (timeout_ns + TIMER_TEST_TICK_NS - 1) / TIMER_TEST_TICK_NS + 1;
+        easeds_timer_init(&items[i].timer, timer_item_cb, &items[i]);
+        assert_int_equal(easeds_timer_wheel_add(wheel, &items[i].timer, timeout_ns), EASEDS_OK);
+        assert_true(easeds_timer_pending(&items[i].timer));
+        if (items[i].expect > max_tick) {
+            max_tick = items[i].expect;
+        }
+    }
+    assert_int_equal(easeds_timer_wheel_count(wheel), count);
+
+    // 先推进到 tick 0, 之后逐 tick 推进
+    uint64_t fired = timer_advance_to(wheel, 0);
+    for (uint64_t tick = 1; tick <= max_tick; tick++) {
+        fired += timer_advance_to(wheel, tick);
+    }
+    assert_int_equal(fired, count);
+    assert_int_equal(easeds_timer_wheel_count(wheel), 0);
+
+    for (uint32_t i = 0; i < count; i++) {
+        assert_int_equal(items[i].fired, 1);
+        assert_int_equal(items[i].fired_at, items[i].expect);
+    }
+
+    free(items);
+    easeds_timer_wheel_destroy(wheel);
+}
+
+// 取消指定定时器的回调
+static void timer_cancel_cb(struct easeds_timer *timer, void *data)
+{
+    struct timer_item *victim = data;
+    easeds_unused(timer);
+    assert_int_equal(easeds_timer_wheel_cancel(victim->wheel, &victim->timer), EASEDS_OK);
+}
+
+// 基本功能测试: 取消, 重新添加, 周期定时器, 回调中取消同批次的定时器, 批量推进
+static void test_easeds_timer_operations(void **state)
+{
+    easeds_unused(state);
+
+    struct easeds_timer_wheel *wheel = easeds_timer_wheel_create("ops", TIMER_TEST_TICK_NS);
+    assert_non_null(wheel);
+    timer_advance_to(wheel, 0);
+
+    struct timer_item items[4];
+    memset(items, 0, sizeof(items));
+    for (uint32_t i = 0; i < 4; i++) {
+        items[i].wheel = wheel;
+        easeds_timer_init(&items[i].timer, timer_item_cb, &items[i]);
+    }
+
+    // 取消后不会执行, 重复取消返回失败
+    assert_int_equal(easeds_timer_wheel_add(wheel, &items[0].timer, 10 * TIMER_TEST_TICK_NS), 0);
+    assert_int_equal(easeds_timer_wheel_cancel(wheel, &items[0].timer), EASEDS_OK);
+    assert_int_equal(easeds_timer_wheel_cancel(wheel, &items[0].timer), EASEDS_ERROR);
+    assert_int_equal(timer_advance_to(wheel, 20), 0);
+    assert_int_equal(items[0].fired, 0);
+
+    // 已挂载的定时器重新添加, 以最后一次为准
+    assert_int_equal(easeds_timer_wheel_add(wheel, &items[0].timer, 5 * TIMER_TEST_TICK_NS), 0);
+    assert_int_equal(easeds_timer_wheel_add(wheel, &items[0].timer, 100 * TIMER_TEST_TICK_NS), 0);
+    assert_int_equal(easeds_timer_wheel_count(wheel), 1);
+    assert_int_equal(timer_advance_to(wheel, 120), 1);
+    assert_int_equal(items[0].fired_at, 121);
+
+    // 周期定时器, 一次大步推进中多次执行
+    items[1].period = 10;
+    assert_int_equal(easeds_timer_wheel_add(wheel, &items[1].timer, 10 * TIMER_TEST_TICK_NS), 0);
+    assert_int_equal(timer_advance_to(wheel, 1120), 100);
+    assert_int_equal(items[1].fired, 100);
+    assert_int_equal(items[1].fired_at, 1121);
+    assert_true(easeds_timer_pending(&items[1].timer));
+    assert_int_equal(easeds_timer_wheel_cancel(wheel, &items[1].timer), EASEDS_OK);
+
+    // 同一 tick 到期的定时器, 先执行的回调取消后执行的定时器
+    easeds_timer_init(&items[2].timer, timer_cancel_cb, &items[3]);
+    assert_int_equal(easeds_timer_wheel_add(wheel, &items[2].timer, 50 * TIMER_TEST_TICK_NS), 0);
+    assert_int_equal(easeds_timer_wheel_add(wheel, &items[3].timer, 50 * TIMER_TEST_TICK_NS), 0);
+    assert_int_equal(timer_advance_to(wheel, 2000), 1);
+    assert_int_equal(items[3].fired, 0);
+    assert_false(easeds_timer_pending(&items[3].timer));
+    assert_int_equal(easeds_timer_wheel_count(wheel), 0);
+
+    easeds_timer_wheel_destroy(wheel);
+}
+
+// 边界测试: 0 超时, 超出覆盖范围的超时, 时间回退, 销毁时摘除定时器
+static void test_easeds_timer_boundary(void **state)
+{
+    easeds_unused(state);
+
+    struct easeds_timer_wheel *wheel = easeds_timer_wheel_create("boundary", TIMER_TEST_TICK_NS);
+    assert_non_null(wheel);
+
+    struct timer_item items[3];
+    memset(items, 0, sizeof(items));
+    for (uint32_t i = 0; i < 3; i++) {
+        items[i].wheel = wheel;
+        easeds_timer_init(&items[i].timer, timer_item_cb, &items[i]);
+    }
+
+    // 早于起点的时间不推进
+    assert_int_equal(easeds_timer_wheel_advance(wheel, wheel->start_ns - 1), 0);
+    assert_int_equal(wheel->current, 0);
+
+    // 0 超时在下一次推进时执行
+    assert_int_equal(easeds_timer_wheel_add(wheel, &items[0].timer, 0), EASEDS_OK);
+    assert_int_equal(timer_advance_to(wheel, 0), 1);
+    assert_int_equal(items[0].fired_at, 1);
+
+    // 时间回退不执行任何定时器
+    assert_int_equal(easeds_timer_wheel_add(wheel, &items[0].timer, 0), EASEDS_OK);
+    assert_int_equal(easeds_timer_wheel_advance(wheel, wheel->start_ns), 0);
+    assert_int_equal(timer_advance_to(wheel, 1), 1);
+
+    // 超出覆盖范围的定时器不会提前执行
+    const uint64_t range = 1ULL << (EASEDS_TIMER_WHEEL_BITS * EASEDS_TIMER_WHEEL_LEVELS);
+    assert_int_equal(
+        easeds_timer_wheel_add(wheel, &items[1].timer, range * 3 * TIMER_TEST_TICK_NS), 0);
+    assert_int_equal(timer_advance_to(wheel, range * 3), 0);
+    assert_true(easeds_timer_pending(&items[1].timer));
+    assert_int_equal(timer_advance_to(wheel, range * 3 + 2), 1);
+    assert_int_equal(items[1].fired_at, range * 3 + 2);
+
+    // 销毁时间轮, 挂载的定时器被摘除
+    assert_int_equal(easeds_timer_wheel_add(wheel, &items[2].timer, UINT64_MAX), EASEDS_OK);
+    easeds_timer_wheel_destroy(wheel);
+    assert_false(easeds_timer_pending(&items[2].timer));
+    assert_int_equal(items[2].fired, 0);
+}
+
+// 失效测试: 非法参数
+static void test_easeds_timer_error(void **state)
+{
+    easeds_unused(state);
+
+    struct easeds_timer timer;
+    easeds_timer_init(&timer, NULL, NULL);
+
+    assert_null(easeds_timer_wheel_create("error", 0));
+    assert_int_equal(easeds_timer_wheel_add(NULL, &timer, 0), EASEDS_ERROR);
+    assert_int_equal(easeds_timer_wheel_cancel(NULL, &timer), EASEDS_ERROR);
+    assert_int_equal(easeds_timer_wheel_advance(NULL, 0), 0);
+    assert_int_equal(easeds_timer_wheel_count(NULL), 0);
+
+    struct easeds_timer_wheel *wheel = easeds_timer_wheel_create("error", TIMER_TEST_TICK_NS);
+    assert_non_null(wheel);
+    assert_int_equal(easeds_timer_wheel_add(wheel, NULL, 0), EASEDS_ERROR);
+    assert_int_equal(easeds_timer_wheel_add(wheel, &timer, 0), EASEDS_ERROR);
+    assert_int_equal(easeds_timer_wheel_cancel(wheel, &timer), EASEDS_ERROR);
+    assert_int_equal(easeds_timer_wheel_count(wheel), 0);
+    easeds_timer_wheel_destroy(wheel);
+}
+
+static void timer_perf_cb(struct easeds_timer *timer, void *data)
+{
+    easeds_unused(timer);
+    (*(uint64_t *)data)++;
+}
+
+// 性能测试: 大量定时器添加/取消/批量到期
+static void test_easeds_timer_perf(void **state)
+{
+    easeds_unused(state);
+
+    const uint32_t             count  = 1000000;
+    uint64_t                   fired  = 0;
+    struct easeds_timer_wheel *wheel  = easeds_timer_wheel_create("perf", TIMER_TEST_TICK_NS);
+    struct easeds_timer       *timers = calloc(count, sizeof(struct easeds_timer));
+    assert_non_null(wheel);
+    assert_non_null(timers);
+
+    for (uint32_t i = 0; i < count; i++) {
+        easeds_timer_init(&timers[i], timer_perf_cb, &fired);
+    }
+
+    // 超时分布在 [0, 100000) tick, 覆盖前三层
+    int64_t start = easeds_get_current_time_ns();
+    for (uint32_t i = 0; i < count; i++) {
+        uint64_t timeout = ((uint64_t)i * 2654435761ULL % 100000) * TIMER_TEST_TICK_NS;
+        easeds_timer_wheel_add(wheel, &timers[i], timeout);
+    }
+    int64_t add_ns = easeds_get_current_time_ns() - start;
+
+    start = easeds_get_current_time_ns();
+    for (uint32_t i = 0; i < count; i += 2) {
+        easeds_timer_wheel_cancel(wheel, &timers[i]);
+    }
+    int64_t cancel_ns = easeds_get_current_time_ns() - start;
+
+    start = easeds_get_current_time_ns();
+    for (uint64_t tick = 0; tick <= 100000; tick += 10) {
+        timer_advance_to(wheel, tick);
+    }
+    int64_t advance_ns = easeds_get_current_time_ns() - start;
+    assert_int_equal(fired, count / 2);
+    assert_int_equal(easeds_timer_wheel_count(wheel), 0);
+
+    MEASURE("[timer perf]: %u timers, add %.1f ns/op, cancel %.1f ns/op, expire %.1f ns/timer.",
+        count, (double)add_ns / count, (double)cancel_ns / (count / 2),
+        (double)advance_ns / (count / 2));
+
+    free(timers);
+    easeds_timer_wheel_destroy(wheel);
+}
+
+// 注册单元测试用例
+EASEDS_UNITTEST_REGISTER(easeds_unittest_timer){
+    cmocka_unit_test(test_easeds_timer_basic),
+    cmocka_unit_test(test_easeds_timer_operations),
+    cmocka_unit_test(test_easeds_timer_boundary),
+    cmocka_unit_test(test_easeds_timer_error),
+    cmocka_unit_test(test_easeds_timer_perf),
+    easeds_unit_test_end,
+};
@@ -0,0 +1,328 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-timer.c
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-18 13:40
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  分层时间轮定时器实现.
+ *
+ * @History:
+ *  2026年10月18日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#include "easeds-timer.h"
+
+// 标准库头文件
+#include <stdlib.h>
+#include <string.h>
+
+// 项目内部头文件
+#include "easeds-log.h"
+#include "easeds-utils.h"
+
+/* 时间轮最大覆盖的 tick 数 */
+#define TIMER_WHEEL_MAX_DELTA ((1ULL << (EASEDS_TIMER_WHEEL_BITS * EASEDS_TIMER_WHEEL_LEVELS)) - 1)
+
+// 根据到期 tick 和当前 tick 选择层和槽位, 并挂到槽位链表末尾
+static void timer_wheel_insert(struct easeds_timer_wheel *wheel, struct easeds_timer *timer)
+{
+    uint64_t expire = timer->expire;
+    uint64_t delta;
+
+    if (expire < wheel->current) {
+        /* 已经过期, 下一个 tick 立即处理 */
+        expire = wheel->current;
+    }
+
+    delta = expire - wheel->current;
+    if (delta > TIMER_WHEEL_MAX_DELTA) {
+        /* 超出范围, 放到最高层最远的槽位, 到达后重新计算 */
+        expire = wheel->current + TIMER_WHEEL_MAX_DELTA;
+        delta  = TIMER_WHEEL_MAX_DELTA;
+    }
+
+    uint32_t level = 0;
+    while (delta >= (1ULL << (EASEDS_TIMER_WHEEL_BITS * (level + 1)))) {
+        level++;
+    }
+
+    uint32_t slot =
+        (uint32_t)(expire >> (EASEDS_TIMER_WHEEL_BITS * level)) & EASEDS_TIMER_WHEEL_MASK;
+    timer->head = &wheel->slots[level][slot];
+    TAILQ_INSERT_TAIL(timer->head, timer, entry);
+    wheel->bitmap[level] |= 1ULL << slot;
+}
+
+// 从所在链表摘除定时器, 槽位变空时清除位图
+static void timer_wheel_unlink(struct easeds_timer_wheel *wheel, struct easeds_timer *timer)
+{
+    struct easeds_timer_list *head = timer->head;
+
+    TAILQ_REMOVE(head, timer, entry);
+    timer->head = NULL;
+    wheel->count--;
+
+    if (head != &wheel->expired && TAILQ_EMPTY(head)) {
+        size_t index = (size_t)(head - &wheel->slots[0][0]);
+        wheel->bitmap[index / EASEDS_TIMER_WHEEL_SLOTS] &=
+            ~(1ULL << (index % EASEDS_TIMER_WHEEL_SLOTS));
+    }
+}
+
+/**
+ * 计算下一个需要处理的 tick, 没有定时器时返回 UINT64_MAX.
+ * 第 n 层槽位 j 只在满足 (t >> 6n) & 63 == j 且低 6n 位全为0的 tick t 上级联(第 0 层为到期),
+ * 对每层非空位图循环右移到当前位置后取最低位, 即可得到该层最近的处理时刻, 各层取最小值.
+ */
+static uint64_t timer_wheel_next_tick(struct easeds_timer_wheel *wheel)
+{
+    uint64_t next = UINT64_MAX;
+
+    for (uint32_t level = 0; level < EASEDS_TIMER_WHEEL_LEVELS; level++) {
+        uint64_t bitmap = wheel->bitmap[level];
+        if (bitmap == 0) {
+            continue;
+        }
+
+        uint32_t shift = EASEDS_TIMER_WHEEL_BITS * level;
+        uint64_t block = (wheel->current + (1ULL << shift) - 1) >> shift;
+        uint32_t pos   = (uint32_t)block & EASEDS_TIMER_WHEEL_MASK;
+        if (pos != 0) {
+            bitmap = (bitmap >> pos) | (bitmap << (EASEDS_TIMER_WHEEL_SLOTS - pos));
+        }
+
+        uint64_t tick = (block + (uint64_t)__builtin_ctzll(bitmap)) << shift;
+        if (tick < next) {
+            next = tick;
+        }
+    }
+
+    return next;
+}
+
+// 级联: 把指定层槽位中的定时器按剩余时间重新分配到下层
+static void timer_wheel_cascade(struct easeds_timer_wheel *wheel, uint32_t level, uint32_t slot)
+{
+    struct easeds_timer_list list = TAILQ_HEAD_INITIALIZER(list);
+    struct easeds_timer     *timer;
+
+    /* 先整体摘下, 避免重新插入到同一个槽位时重复遍历 */
+    TAILQ_CONCAT(&list, &wheel->slots[level][slot], entry);
+    wheel->bitmap[level] &= ~(1ULL << slot);
+
+    while ((timer = TAILQ_FIRST(&list)) != NULL) {
+        TAILQ_REMOVE(&list, timer, entry);
+        timer_wheel_insert(wheel, timer);
+    }
+}
+
+// 创建时间轮, tick_ns 为 tick 粒度, 以当前时间作为起点, 失败返回NULL
+struct easeds_timer_wheel *easeds_timer_wheel_create(const char *name, uint64_t tick_ns)
+{
+    if (unlikely(tick_ns == 0)) {
+        EASEDS_ERR("[easeds_timer_wheel_create]: Invalid tick %lu ns.", tick_ns);
+        return NULL;
+    }
+
+    struct easeds_timer_wheel *wheel = __easeds_malloc(sizeof(struct easeds_timer_wheel));
+    if (unlikely(wheel == NULL)) {
+        EASEDS_ERR("[easeds_timer_wheel_create]: Failed to allocate memory for timer wheel.");
+        return NULL;
+    }
+
+    wheel->name     = name;
+    wheel->start_ns = easeds_get_current_time_ns();
+    wheel->tick_ns  = tick_ns;
+    wheel->current  = 0;
+    wheel->count    = 0;
+    TAILQ_INIT(&wheel->expired);
+    memset(wheel->bitmap, 0, sizeof(wheel->bitmap));
+    for (uint32_t level = 0; level < EASEDS_TIMER_WHEEL_LEVELS; level++) {
+        for (uint32_t slot = 0; slot < EASEDS_TIMER_WHEEL_SLOTS; slot++) {
+            TAILQ_INIT(&wheel->slots[level][slot]);
+        }
+    }
+
+    PFL_DEBUG("Created timer wheel: tick_ns=%lu, start_ns=%ld.", tick_ns, wheel->start_ns);
+    return wheel;
+}
+
+// 摘除链表中的全部定时器, 不执行回调
+static void timer_wheel_detach_all(struct easeds_timer_list *list)
+{
+    struct easeds_timer *timer;
+
+    while ((timer = TAILQ_FIRST(list)) != NULL) {
+        TAILQ_REMOVE(list, timer, entry);
+        timer->head = NULL;
+    }
+}
+
+// 销毁时间轮, 挂载的定时器被摘除但不执行回调
+void easeds_timer_wheel_destroy(struct easeds_timer_wheel *wheel)
+{
+    if (unlikely(wheel == NULL)) {
+        return;
+    }
+
+    timer_wheel_detach_all(&wheel->expired);
+    for (uint32_t level = 0; level < EASEDS_TIMER_WHEEL_LEVELS; level++) {
+        for (uint32_t slot = 0; slot < EASEDS_TIMER_WHEEL_SLOTS; slot++) {
+            timer_wheel_detach_all(&wheel->slots[level][slot]);
+        }
+    }
+
+    __easeds_free(wheel);
+
+    PFL_DEBUG("Destroyed timer wheel.");
+}
+
+// 获取挂载的定时器数量
+uint64_t easeds_timer_wheel_count(struct easeds_timer_wheel *wheel)
+{
+    if (unlikely(wheel == NULL)) {
+        EASEDS_ERR("[easeds_timer_wheel_count]: Invalid timer wheel pointer.");
+        return 0;
+    }
+
+    return wheel->count;
+}
+
+// 初始化定时器节点, 设置回调函数和用户数据
+void easeds_timer_init(struct easeds_timer *timer,
+    void (*callback)(struct easeds_timer *timer, void *data), void *data)
+{
+    if (unlikely(timer == NULL)) {
+        EASEDS_ERR("[easeds_timer_init]: Invalid timer pointer.");
+        return;
+    }
+
+    memset(timer, 0, sizeof(struct easeds_timer));
+    timer->callback = callback;
+    timer->data     = data;
+}
+
+/**
+ * @description: 添加定时器, 相对时间轮当前时间 timeout_ns 后到期.
+ *  时间轮当前时间指最近一次推进处理过的 tick, 超时向上取整到 tick, 到期精度为一个 tick.
+ * @param wheel 时间轮指针
+ * @param timer 定时器指针, 需要先调用 easeds_timer_init 初始化, 已挂载时先取消再重新添加
+ * @param timeout_ns 超时时间, 纳秒
+ * @return 成功返回0, 失败返回-1
+ */
+int32_t easeds_timer_wheel_add(
+    struct easeds_timer_wheel *wheel, struct easeds_timer *timer, uint64_t timeout_ns)
+{
+    if (unlikely(wheel == NULL || timer == NULL || timer->callback == NULL)) {
+        EASEDS_ERR("[easeds_timer_wheel_add]: Invalid timer wheel, timer or callback pointer.");
+        return -1;
+    }
+
+    if (timer->head != NULL) {
+        timer_wheel_unlink(wheel, timer);
+    }
+
+    /* 以最近一次处理过的 tick 为基准, 回调中重新添加时基准即为正在处理的 tick, 周期不会漂移 */
+    uint64_t now   = wheel->current > 0 ? wheel->current - 1 : 0;
+    uint64_t ticks = timeout_ns / wheel->tick_ns + (timeout_ns % wheel->tick_ns != 0 ? 1 : 0);
+    timer->expire  = ticks > UINT64_MAX - now ? UINT64_MAX : now + ticks;
+    timer_wheel_insert(wheel, timer);
+    wheel->count++;
+
+    return 0;
+}
+
+// 取消定时器, 成功返回0, 定时器未挂载返回-1
+int32_t easeds_timer_wheel_cancel(struct easeds_timer_wheel *wheel, struct easeds_timer *timer)
+{
+    if (unlikely(wheel == NULL || timer == NULL)) {
+        EASEDS_ERR("[easeds_timer_wheel_cancel]: Invalid timer wheel or timer pointer.");
+        return -1;
+    }
+
+    if (timer->head == NULL) {
+        return -1;
+    }
+
+    timer_wheel_unlink(wheel, timer);
+    return 0;
+}
+
+/**
+ * @description: 推进时间轮到 now_ns, 执行所有到期定时器的回调函数.
+ *  根据位图直接跳到下一个需要处理的 tick: 第 0 层转完一圈时逐层级联, 然后把第 0 层当前槽位
+ *  整体移到 expired 链表, 再逐个摘除并执行回调. 跳过的 tick 上没有需要到期或级联的定时器.
+ * @param wheel 时间轮指针
+ * @param now_ns 当前时间, 与 easeds_get_current_time_ns 同一时间基准
+ * @return 执行的定时器数量
+ */
+uint64_t easeds_timer_wheel_advance(struct easeds_timer_wheel *wheel, int64_t now_ns)
+{
+    if (unlikely(wheel == NULL)) {
+        EASEDS_ERR("[easeds_timer_wheel_advance]: Invalid timer wheel pointer.");
+        return 0;
+    }
+
+    if (now_ns < wheel->start_ns) {
+        return 0;
+    }
+
+    uint64_t target = (uint64_t)(now_ns - wheel->start_ns) / wheel->tick_ns;
+    uint64_t fired  = 0;
+
+    /* 时间回退或者重复推进到同一个 tick, 不需要处理 */
+    if (wheel->current > target) {
+        return 0;
+    }
+
+    for (;;) {
+        uint64_t current = timer_wheel_next_tick(wheel);
+        if (current > target) {
+            wheel->current = target + 1;
+            break;
+        }
+        wheel->current = current;
+
+        uint32_t index = (uint32_t)current & EASEDS_TIMER_WHEEL_MASK;
+        if (index == 0) {
+            for (uint32_t level = 1; level < EASEDS_TIMER_WHEEL_LEVELS; level++) {
+                uint32_t slot = (uint32_t)(current >> (EASEDS_TIMER_WHEEL_BITS * level)) &
+                                EASEDS_TIMER_WHEEL_MASK;
+                timer_wheel_cascade(wheel, level, slot);
+                if (slot != 0) {
+                    break;
+                }
+            }
+        }
+
+        /* 到期定时器整体移到 expired 链表, 回调期间取消这些定时器也能正确摘除 */
+        struct easeds_timer *timer;
+        TAILQ_CONCAT(&wheel->expired, &wheel->slots[0][index], entry);
+        wheel->bitmap[0] &= ~(1ULL << index);
+        TAILQ_FOREACH(timer, &wheel->expired, entry)
+        {
+            timer->head = &wheel->expired;
+        }
+        wheel->current = current + 1;
+
+        while ((timer = TAILQ_FIRST(&wheel->expired)) != NULL) {
+            timer_wheel_unlink(wheel, timer);
+            fired++;
+            timer->callback(timer, timer->data);
+        }
+    }
+
+    return fired;
+}
+
+// 以 easeds_get_current_time_ns 推进时间轮, 返回执行数量
+uint64_t easeds_timer_wheel_run(struct easeds_timer_wheel *wheel)
+{
+    return easeds_timer_wheel_advance(wheel, easeds_get_current_time_ns());
+}
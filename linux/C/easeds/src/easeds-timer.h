@@ -0,0 +1,131 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-timer.h
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-18 13:20
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  基于 TAILQ 的分层时间轮定时器, 适用于大量连接超时等高频增删的定时场景.
+ *
+ * @History:
+ *  2026年10月18日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#ifndef __EASEDS_TIMER_H__
+#define __EASEDS_TIMER_H__
+
+/* C 标准库头文件 */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* 项目内部头文件 */
+#include "easeds-public.h"
+#include "easeds-queue.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 时间轮层数和每层槽位数, 每层覆盖上一层的 64 倍时间, 总共覆盖 2^36 个 tick */
+#define EASEDS_TIMER_WHEEL_BITS   6
+#define EASEDS_TIMER_WHEEL_SLOTS  (1U << EASEDS_TIMER_WHEEL_BITS)
+#define EASEDS_TIMER_WHEEL_MASK   (EASEDS_TIMER_WHEEL_SLOTS - 1)
+#define EASEDS_TIMER_WHEEL_LEVELS 6
+
+/* 定时器节点, 由用户嵌入到自己的结构体中, 时间轮不负责分配和释放 */
+struct easeds_timer {
+    TAILQ_ENTRY(easeds_timer) entry;   /* 槽位链表节点 */
+    struct easeds_timer_list *head;    /* 所在的槽位链表, NULL 表示未挂载 */
+    uint64_t                  expire;  /* 到期 tick */
+    /* 到期回调函数, 回调中可以重新添加当前定时器, 也可以取消其他定时器 */
+    void (*callback)(struct easeds_timer *timer, void *data);
+    void *data; /* 回调函数的用户数据 */
+};
+
+TAILQ_HEAD(easeds_timer_list, easeds_timer);
+
+/**
+ * 实现一个分层时间轮(Hierarchical Timing Wheel), 添加和取消定时器复杂度 O(1).
+ *  (1) 时间按 tick_ns 粒度离散为 tick, 共 EASEDS_TIMER_WHEEL_LEVELS 层, 每层 64 个槽位,
+ *      第 n 层每个槽位覆盖 64^n 个 tick, 定时器根据剩余 tick 数放入对应层的槽位.
+ *  (2) 第 0 层转完一圈时, 把上一层当前槽位中的定时器重新分配到下层(级联), 逐层向上同理.
+ *      每个定时器最多级联 EASEDS_TIMER_WHEEL_LEVELS - 1 次.
+ *  (3) advance(now_ns) 推进到 now_ns 对应的 tick, 到期定时器先批量移到 expired 链表,
+ *      再逐个摘除并执行回调, 回调中可以安全地添加和取消任意定时器.
+ *  (4) 每层用 64 位位图记录非空槽位, 推进时直接跳到下一个需要到期或级联的 tick,
+ *      长时间没有定时器到期时不需要逐 tick 空转.
+ *  (5) 超出最大覆盖范围的定时器放到最高层最远的槽位, 到达后重新计算, 不会丢失.
+ *  (6) 非线程安全, 需要用户自行保证线程安全性.
+ */
+struct easeds_timer_wheel {
+    const char              *name;     /* 名称, 预留字段, 可用于调试和日志输出 */
+    int64_t                  start_ns; /* tick 0 对应的时间, 纳秒 */
+    uint64_t                 tick_ns;  /* tick 粒度, 纳秒 */
+    uint64_t                 current;  /* 下一个待处理的 tick */
+    uint64_t                 count;    /* 挂载的定时器数量 */
+    struct easeds_timer_list expired;  /* 本次推进中已到期, 等待执行回调的定时器 */
+    /* 各层非空槽位位图 */
+    uint64_t bitmap[EASEDS_TIMER_WHEEL_LEVELS];
+    /* 各层槽位链表 */
+    struct easeds_timer_list slots[EASEDS_TIMER_WHEEL_LEVELS][EASEDS_TIMER_WHEEL_SLOTS];
+};
+
+/**
+ * 常见时间轮操作函数:
+ *
+ * 函数名                       功能描述
+ * ------------------------     ------------------------------------------------------
+ * easeds_timer_wheel_create    创建时间轮, 以当前时间作为起点, 失败返回NULL
+ * easeds_timer_wheel_destroy   销毁时间轮, 挂载的定时器被摘除但不执行回调
+ * easeds_timer_wheel_count     获取挂载的定时器数量
+ * easeds_timer_init            初始化定时器节点, 设置回调函数和用户数据
+ * easeds_timer_pending         判断定时器是否已挂载到时间轮
+ * easeds_timer_wheel_add       添加定时器, timeout_ns 后到期, 成功返回0, 失败返回-1
+ * easeds_timer_wheel_cancel    取消定时器, 成功返回0, 定时器未挂载返回-1
+ * easeds_timer_wheel_advance   推进时间轮到 now_ns, 执行所有到期定时器, 返回执行数量
+ * easeds_timer_wheel_run       以当前时间推进时间轮, 返回执行数量
+ */
+
+// 创建时间轮, tick_ns 为 tick 粒度, 以当前时间作为起点, 失败返回NULL
+struct easeds_timer_wheel *easeds_timer_wheel_create(const char *name, uint64_t tick_ns);
+
+// 销毁时间轮, 挂载的定时器被摘除但不执行回调
+void easeds_timer_wheel_destroy(struct easeds_timer_wheel *wheel);
+
+// 获取挂载的定时器数量
+uint64_t easeds_timer_wheel_count(struct easeds_timer_wheel *wheel);
+
+// 初始化定时器节点, 设置回调函数和用户数据
+void easeds_timer_init(struct easeds_timer *timer,
+    void (*callback)(struct easeds_timer *timer, void *data), void *data);
+
+// 判断定时器是否已挂载到时间轮
+static inline bool easeds_timer_pending(const struct easeds_timer *timer)
+{
+    return timer->head != NULL;
+}
+
+// 添加定时器, 相对时间轮当前时间 timeout_ns 后到期, 已挂载时先取消, 成功返回0, 失败返回-1
+int32_t easeds_timer_wheel_add(
+    struct easeds_timer_wheel *wheel, struct easeds_timer *timer, uint64_t timeout_ns);
+
+// 取消定时器, 成功返回0, 定时器未挂载返回-1
+int32_t easeds_timer_wheel_cancel(struct easeds_timer_wheel *wheel, struct easeds_timer *timer);
+
+// 推进时间轮到 now_ns, 执行所有到期定时器的回调函数, 返回执行数量
+uint64_t easeds_timer_wheel_advance(struct easeds_timer_wheel *wheel, int64_t now_ns);
+
+// 以 easeds_get_current_time_ns 推进时间轮, 返回执行数量
+uint64_t easeds_timer_wheel_run(struct easeds_timer_wheel *wheel);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __EASEDS_TIMER_H__ */
@@ -0,0 +1,302 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-tree-unittest.c
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-18 09:48
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  Easeds 红黑树单元测试实现文件, 包含了插入/删除/查找/遍历和红黑性质校验.
+ *
+ * @History:
+ *  2026年10月18日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#include "easeds-unittest.h"
+
+// 项目内部头文件
+#include "easeds-tree.h"
+#include "easeds-utils.h"
+
+// 测试节点
+struct tree_node {
+    RB_ENTRY(tree_node) entry;
+    int32_t key;
+    int32_t pad;
+};
+
+static int32_t tree_node_cmp(const struct tree_node *a, const struct tree_node *b)
+{
+    return (a->key > b->key) - (a->key < b->key);
+}
+
+RB_HEAD(tree_test, tree_node);
+RB_GENERATE_STATIC(tree_test, tree_node, entry, tree_node_cmp)
+
+// 校验红黑性质, 返回黑高, 失败返回 -1
+static int32_t tree_check_node(struct tree_node *node)
+{
+    if (node == NULL) {
+        return 1;
+    }
+
+    struct tree_node *left  = RB_LEFT(node, entry);
+    struct tree_node *right = RB_RIGHT(node, entry);
+
+    if (left != NULL && (RB_PARENT(left, entry) != node || left->key >= node->key)) {
+        return -1;
+    }
+    if (right != NULL && (RB_PARENT(right, entry) != node || right->key <= node->key)) {
+        return -1;
+    }
+    if (RB_COLOR(node, entry) == RB_RED && (RB_IS_RED(left, entry) || RB_IS_RED(right, entry))) {
+        return -1;
+    }
+
+    int32_t lh = tree_check_node(left);
+    int32_t rh = tree_check_node(right);
+    if (lh < 0 || rh < 0 || lh != rh) {
+        return -1;
+    }
+
+    return lh + (RB_COLOR(node, entry) == RB_BLACK ? 1 : 0);
+}
+
+static bool tree_check(struct tree_test *head)
+{
+    if (RB_ROOT(head) == NULL) {
+        return true;
+    }
+    if (RB_COLOR(RB_ROOT(head), entry) != RB_BLACK || RB_PARENT(RB_ROOT(head), entry) != NULL) {
+        return false;
+    }
+    return tree_check_node(RB_ROOT(head)) > 0;
+}
+
+// 基本功能测试: 插入, 查找, 顺序遍历, 删除
+static void test_easeds_tree_basic(void **state)
+{
+    easeds_unused(state);
+
+    struct tree_test head = RB_HEAD_INITIALIZER(head);
+    struct tree_node nodes[16];
+    struct tree_node *node;
+
+    assert_true(RB_EMPTY(&head));
+
+    for (int32_t i = 0; i < 16; i++) {
+        nodes[i].key = (i * 7) % 16;
+        assert_null(RB_INSERT(tree_test, &head, &nodes[i]));
+        assert_true(tree_check(&head));
+    }
+    assert_false(RB_EMPTY(&head));
+
+    // 顺序遍历
+    int32_t expect = 0;
+    RB_FOREACH(node, tree_test, &head)
+    {
+        assert_int_equal(node->key, expect++);
+    }
+    assert_int_equal(expect, 16);
+
+    // 逆序遍历
+    RB_FOREACH_REVERSE(node, tree_test, &head)
+    {
+        assert_int_equal(node->key, --expect);
+    }
+    assert_int_equal(expect, 0);
+
+    // 查找
+    struct tree_node key = {.key = 5};
+    node                 = RB_FIND(tree_test, &head, &key);
+    assert_ptr_equal(node, &nodes[3]);
+    assert_ptr_equal(RB_NEXT(tree_test, &head, node), &nodes[10]);
+    assert_ptr_equal(RB_PREV(tree_test, &head, node), &nodes[12]);
+
+    // 删除全部节点
+    for (int32_t i = 0; i < 16; i++) {
+        assert_ptr_equal(RB_REMOVE(tree_test, &head, &nodes[i]), &nodes[i]);
+        assert_true(tree_check(&head));
+    }
+    assert_true(RB_EMPTY(&head));
+}
+
+// 基本功能测试: 下界查找和从指定节点开始的范围遍历
+static void test_easeds_tree_operations(void **state)
+{
+    easeds_unused(state);
+
+    struct tree_test  head;
+    struct tree_node  nodes[10];
+    struct tree_node *node;
+    struct tree_node  key;
+
+    RB_INIT(&head);
+
+    // 插入 0, 10, 20, ..., 90
+    for (int32_t i = 0; i < 10; i++) {
+        nodes[i].key = i * 10;
+        assert_null(RB_INSERT(tree_test, &head, &nodes[i]));
+    }
+
+    // 下界查找
+    key.key = 25;
+    node    = RB_NFIND(tree_test, &head, &key);
+    assert_ptr_equal(node, &nodes[3]);
+    assert_null(RB_FIND(tree_test, &head, &key));
+
+    key.key = 30;
+    assert_ptr_equal(RB_NFIND(tree_test, &head, &key), &nodes[3]);
+
+    key.key = 91;
+    assert_null(RB_NFIND(tree_test, &head, &key));
+
+    key.key = -5;
+    assert_ptr_equal(RB_NFIND(tree_test, &head, &key), &nodes[0]);
+
+    // 范围遍历 [25, 60)
+    int32_t count = 0;
+    key.key       = 25;
+    RB_FOREACH_FROM(node, tree_test, RB_NFIND(tree_test, &head, &key))
+    {
+        if (node->key >= 60) {
+            break;
+        }
+        count++;
+    }
+    assert_int_equal(count, 3);
+
+    // 逆序范围遍历, 从 50 开始
+    key.key = 50;
+    count   = 0;
+    RB_FOREACH_REVERSE_FROM(node, tree_test, RB_FIND(tree_test, &head, &key))
+    {
+        count++;
+    }
+    assert_int_equal(count, 6);
+
+    // 重复插入返回已有节点
+    struct tree_node dup = {.key = 40};
+    assert_ptr_equal(RB_INSERT(tree_test, &head, &dup), &nodes[4]);
+
+    // 遍历中删除偶数下标节点
+    struct tree_node *tmp;
+    RB_FOREACH_SAFE(node, tree_test, &head, tmp)
+    {
+        if ((node->key / 10) % 2 == 0) {
+            RB_REMOVE(tree_test, &head, node);
+        }
+    }
+    assert_true(tree_check(&head));
+
+    count = 0;
+    RB_FOREACH_REVERSE_SAFE(node, tree_test, &head, tmp)
+    {
+        assert_int_equal((node->key / 10) % 2, 1);
+        RB_REMOVE(tree_test, &head, node);
+        count++;
+    }
+    assert_int_equal(count, 5);
+    assert_true(RB_EMPTY(&head));
+}
+
+// 边界测试: 空树, 单节点, 最小最大值
+static void test_easeds_tree_boundary(void **state)
+{
+    easeds_unused(state);
+
+    struct tree_test  head = RB_HEAD_INITIALIZER(head);
+    struct tree_node  one  = {.key = 1};
+    struct tree_node *node;
+
+    assert_null(RB_MIN(tree_test, &head));
+    assert_null(RB_MAX(tree_test, &head));
+    assert_null(RB_FIND(tree_test, &head, &one));
+    assert_null(RB_NFIND(tree_test, &head, &one));
+
+    int32_t count = 0;
+    RB_FOREACH(node, tree_test, &head)
+    {
+        count++;
+    }
+    assert_int_equal(count, 0);
+
+    assert_null(RB_INSERT(tree_test, &head, &one));
+    assert_ptr_equal(RB_ROOT(&head), &one);
+    assert_int_equal(RB_COLOR(&one, entry), RB_BLACK);
+    assert_ptr_equal(RB_MIN(tree_test, &head), &one);
+    assert_ptr_equal(RB_MAX(tree_test, &head), &one);
+    assert_null(RB_NEXT(tree_test, &head, &one));
+    assert_null(RB_PREV(tree_test, &head, &one));
+
+    assert_ptr_equal(RB_REMOVE(tree_test, &head, &one), &one);
+    assert_true(RB_EMPTY(&head));
+}
+
+// 性能测试: 随机插入/查找/删除, 并与红黑性质校验结合
+static void test_easeds_tree_perf(void **state)
+{
+    easeds_unused(state);
+
+    const int32_t     count = 100000;
+    struct tree_test  head  = RB_HEAD_INITIALIZER(head);
+    struct tree_node *nodes = calloc((size_t)count, sizeof(struct tree_node));
+    struct tree_node *node;
+    assert_non_null(nodes);
+
+    // 乘以与 count 互质的数再取模, 得到 [0, count) 的一个乱序排列, 保证没有重复键
+    int64_t start = easeds_get_current_time_ns();
+    for (int32_t i = 0; i < count; i++) {
+        nodes[i].key = (int32_t)(((int64_t)i * 7919) % count);
+        assert_null(RB_INSERT(tree_test, &head, &nodes[i]));
+    }
+    int64_t insert_ns = easeds_get_current_time_ns() - start;
+    assert_true(tree_check(&head));
+
+    start = easeds_get_current_time_ns();
+    for (int32_t i = 0; i < count; i++) {
+        struct tree_node key = {.key = i};
+        node                 = RB_FIND(tree_test, &head, &key);
+        assert_true(node != NULL && node->key == i);
+    }
+    int64_t find_ns = easeds_get_current_time_ns() - start;
+
+    start          = easeds_get_current_time_ns();
+    int32_t expect = 0;
+    RB_FOREACH(node, tree_test, &head)
+    {
+        assert_int_equal(node->key, expect++);
+    }
+    int64_t iter_ns = easeds_get_current_time_ns() - start;
+
+    start = easeds_get_current_time_ns();
+    for (int32_t i = 0; i < count; i += 2) {
+        RB_REMOVE(tree_test, &head, &nodes[i]);
+    }
+    assert_true(tree_check(&head));
+    for (int32_t i = 1; i < count; i += 2) {
+        RB_REMOVE(tree_test, &head, &nodes[i]);
+    }
+    int64_t remove_ns = easeds_get_current_time_ns() - start;
+    assert_true(RB_EMPTY(&head));
+
+    MEASURE("[rbtree perf]: %d nodes, insert %.1f ns/op, find %.1f ns/op, iterate %.1f ns/op, "
+            "remove %.1f ns/op.",
+        count, (double)insert_ns / count, (double)find_ns / count, (double)iter_ns / count,
+        (double)remove_ns / count);
+
+    free(nodes);
+}
+
+// 注册单元测试用例
+EASEDS_UNITTEST_REGISTER(easeds_unittest_tree){
+    cmocka_unit_test(test_easeds_tree_basic),
+    cmocka_unit_test(test_easeds_tree_operations),
+    cmocka_unit_test(test_easeds_tree_boundary),
+    cmocka_unit_test(test_easeds_tree_perf),
+    easeds_unit_test_end,
+};
@@ -0,0 +1,507 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-tree.h
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-18 09:12
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  侵入式红黑树宏定义, 接口风格参考 BSD tree.h, 与 easeds-queue.h 配合使用.
+ *
+ * @History:
+ *  2026年10月18日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#ifndef __EASEDS_TREE_H__
+#define __EASEDS_TREE_H__
+
+/* C 标准库头文件 */
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * 红黑树是一棵自平衡二叉搜索树, 每个节点额外记录一个颜色位, 保证:
+ *  (1) 根节点和所有空叶子节点为黑色.
+ *  (2) 红色节点的子节点必须是黑色.
+ *  (3) 从任一节点到其所有叶子节点的路径上, 黑色节点数目相同.
+ * 因此树高不超过 2*log2(n+1), 插入/删除/查找都是 O(log n), 插入最多旋转 2 次, 删除最多 3 次.
+ *
+ * 本文件实现的是侵入式红黑树, 树节点(RB_ENTRY)嵌入到用户结构体中, 树本身不申请任何内存.
+ * 与 BSD tree.h 一样, 通过 RB_GENERATE 宏为每种树生成一组专用函数, 比较函数在生成时直接展开,
+ * 编译器可以内联比较逻辑, 而不是运行时通过函数指针间接调用.
+ *
+ * 使用方法:
+ *  struct node {
+ *      RB_ENTRY(node) entry;
+ *      int32_t        key;
+ *  };
+ *  static int32_t node_cmp(const struct node *a, const struct node *b) { ... }
+ *  RB_HEAD(node_tree, node);
+ *  RB_GENERATE_STATIC(node_tree, node, entry, node_cmp)
+ *
+ * 比较函数返回值 <0 / 0 / >0, 分别表示第一个参数小于/等于/大于第二个参数.
+ * 树中不允许存在相等的键值, RB_INSERT 遇到重复键会返回已有节点且不插入.
+ *
+ * 支持的操作如下:
+ *
+ * 宏名称                       功能描述
+ * ------------------------     ------------------------------------------------------
+ * RB_HEAD                      定义红黑树头部结构体
+ * RB_HEAD_INITIALIZER          红黑树头部静态初始化
+ * RB_ENTRY                     定义嵌入用户结构体的树节点
+ * RB_INIT                      初始化红黑树头部
+ * RB_EMPTY                     判断红黑树是否为空
+ * RB_ROOT                      获取根节点
+ * RB_LEFT/RB_RIGHT/RB_PARENT   获取左子节点/右子节点/父节点
+ * RB_INSERT                    插入节点, 成功返回 NULL, 键值已存在返回已有节点
+ * RB_REMOVE                    删除节点, 返回被删除的节点
+ * RB_FIND                      精确查找, 未找到返回 NULL
+ * RB_NFIND                     下界查找(lower bound), 返回第一个 >= 给定键值的节点
+ * RB_MIN/RB_MAX                获取最小/最大节点
+ * RB_NEXT/RB_PREV              获取后继/前驱节点, 完整遍历时均摊 O(1)
+ * RB_FOREACH                   顺序遍历
+ * RB_FOREACH_FROM              从指定节点开始顺序遍历
+ * RB_FOREACH_SAFE              顺序遍历, 允许在遍历过程中删除当前节点
+ * RB_FOREACH_REVERSE           逆序遍历
+ * RB_FOREACH_REVERSE_FROM      从指定节点开始逆序遍历
+ * RB_FOREACH_REVERSE_SAFE      逆序遍历, 允许在遍历过程中删除当前节点
+ */
+
+/* 节点颜色定义 */
+#define RB_BLACK 0U
+#define RB_RED   1U
+
+/* 红黑树头部, 只包含一个根节点指针 */
+#define RB_HEAD(name, type)       \
+    struct name {                 \
+        struct type *rbh_root;    \
+    }
+
+#define RB_HEAD_INITIALIZER(root) {NULL}
+
+#define RB_INIT(root)               \
+    do {                            \
+        (root)->rbh_root = NULL;    \
+    } while (0)
+
+/* 红黑树节点, 颜色单独存放, 额外填充保证 64 位平台下没有隐式对齐空洞 */
+#define RB_ENTRY(type)                                  \
+    struct {                                            \
+        struct type *rbe_left;   /* 左子节点 */         \
+        struct type *rbe_right;  /* 右子节点 */         \
+        struct type *rbe_parent; /* 父节点 */           \
+        uint32_t     rbe_color;  /* 节点颜色 */         \
+        uint32_t     rbe_pad;    /* 填充 */             \
+    }
+
+#define RB_LEFT(elm, field)   (elm)->field.rbe_left
+#define RB_RIGHT(elm, field)  (elm)->field.rbe_right
+#define RB_PARENT(elm, field) (elm)->field.rbe_parent
+#define RB_COLOR(elm, field)  (elm)->field.rbe_color
+#define RB_ROOT(head)         (head)->rbh_root
+#define RB_EMPTY(head)        (RB_ROOT(head) == NULL)
+
+/* 判断节点是否为红色, 空节点视为黑色 */
+#define RB_IS_RED(elm, field) ((elm) != NULL && RB_COLOR(elm, field) == RB_RED)
+
+#define RB_SET(elm, parent, field)               \
+    do {                                         \
+        RB_PARENT(elm, field) = parent;          \
+        RB_LEFT(elm, field)   = NULL;            \
+        RB_RIGHT(elm, field)  = NULL;            \
+        RB_COLOR(elm, field)  = RB_RED;          \
+        (elm)->field.rbe_pad  = 0;               \
+    } while (0)
+
+/* 将 elm 的父节点中指向 old 的子节点指针替换为 elm, old 为根节点时更新根节点 */
+#define RB_REPLACE_CHILD(head, parent, old, elm, field)    \
+    do {                                                   \
+        if ((parent) == NULL) {                            \
+            RB_ROOT(head) = (elm);                         \
+        } else if (RB_LEFT(parent, field) == (old)) {      \
+            RB_LEFT(parent, field) = (elm);                \
+        } else {                                           \
+            RB_RIGHT(parent, field) = (elm);               \
+        }                                                  \
+    } while (0)
+
+/* 左旋: elm 的右子节点成为 elm 的父节点 */
+#define RB_ROTATE_LEFT(head, elm, tmp, field)                                 \
+    do {                                                                      \
+        (tmp) = RB_RIGHT(elm, field);                                         \
+        if ((RB_RIGHT(elm, field) = RB_LEFT(tmp, field)) != NULL) {           \
+            RB_PARENT(RB_LEFT(tmp, field), field) = (elm);                    \
+        }                                                                     \
+        RB_PARENT(tmp, field) = RB_PARENT(elm, field);                        \
+        RB_REPLACE_CHILD(head, RB_PARENT(tmp, field), elm, tmp, field);       \
+        RB_LEFT(tmp, field)   = (elm);                                        \
+        RB_PARENT(elm, field) = (tmp);                                        \
+    } while (0)
+
+/* 右旋: elm 的左子节点成为 elm 的父节点 */
+#define RB_ROTATE_RIGHT(head, elm, tmp, field)                                \
+    do {                                                                      \
+        (tmp) = RB_LEFT(elm, field);                                          \
+        if ((RB_LEFT(elm, field) = RB_RIGHT(tmp, field)) != NULL) {           \
+            RB_PARENT(RB_RIGHT(tmp, field), field) = (elm);                   \
+        }                                                                     \
+        RB_PARENT(tmp, field) = RB_PARENT(elm, field);                        \
+        RB_REPLACE_CHILD(head, RB_PARENT(tmp, field), elm, tmp, field);       \
+        RB_RIGHT(tmp, field)  = (elm);                                        \
+        RB_PARENT(elm, field) = (tmp);                                        \
+    } while (0)
+
+/* 生成函数原型声明, 在头文件里使用, 对应的实现由 RB_GENERATE 生成 */
+#define RB_PROTOTYPE(name, type, field, cmp) RB_PROTOTYPE_INTERNAL(name, type, field, cmp, )
+#define RB_PROTOTYPE_STATIC(name, type, field, cmp) \
+    RB_PROTOTYPE_INTERNAL(name, type, field, cmp, __attribute__((unused)) static)
+#define RB_PROTOTYPE_INTERNAL(name, type, field, cmp, attr)                                \
+    attr void         name##_RB_INSERT_COLOR(struct name *, struct type *);                \
+    attr void         name##_RB_REMOVE_COLOR(struct name *, struct type *, struct type *); \
+    attr struct type *name##_RB_REMOVE(struct name *, struct type *);                      \
+    attr struct type *name##_RB_INSERT(struct name *, struct type *);                      \
+    attr struct type *name##_RB_FIND(struct name *, const struct type *);                  \
+    attr struct type *name##_RB_NFIND(struct name *, const struct type *);                 \
+    attr struct type *name##_RB_NEXT(struct type *);                                       \
+    attr struct type *name##_RB_PREV(struct type *);                                       \
+    attr struct type *name##_RB_MINMAX(struct name *, int32_t);
+
+/* 生成红黑树操作函数, cmp 为比较函数(或函数式宏), 直接在生成代码中展开调用 */
+#define RB_GENERATE(name, type, field, cmp) RB_GENERATE_INTERNAL(name, type, field, cmp, )
+#define RB_GENERATE_STATIC(name, type, field, cmp) \
+    RB_GENERATE_INTERNAL(name, type, field, cmp, __attribute__((unused)) static)
+#define RB_GENERATE_INTERNAL(name, type, field, cmp, attr) \
+    RB_PROTOTYPE_INTERNAL(name, type, field, cmp, attr)    \
+    RB_GENERATE_INSERT_COLOR(name, type, field, attr)      \
+    RB_GENERATE_REMOVE_COLOR(name, type, field, attr)      \
+    RB_GENERATE_INSERT(name, type, field, cmp, attr)       \
+    RB_GENERATE_REMOVE(name, type, field, attr)            \
+    RB_GENERATE_FIND(name, type, field, cmp, attr)         \
+    RB_GENERATE_NFIND(name, type, field, cmp, attr)        \
+    RB_GENERATE_NEXT(name, type, field, attr)              \
+    RB_GENERATE_PREV(name, type, field, attr)              \
+    RB_GENERATE_MINMAX(name, type, field, attr)
+
+/* 插入后修复颜色: 父节点为红色时, 根据叔节点颜色进行重新着色或者旋转 */
+#define RB_GENERATE_INSERT_COLOR(name, type, field, attr)                       \
+    attr void name##_RB_INSERT_COLOR(struct name *head, struct type *elm)       \
+    {                                                                           \
+        struct type *parent, *gparent, *tmp;                                    \
+        while ((parent = RB_PARENT(elm, field)) != NULL &&                      \
+               RB_COLOR(parent, field) == RB_RED) {                             \
+            gparent = RB_PARENT(parent, field);                                 \
+            if (parent == RB_LEFT(gparent, field)) {                            \
+                tmp = RB_RIGHT(gparent, field);                                 \
+                if (RB_IS_RED(tmp, field)) {                                    \
+                    RB_COLOR(tmp, field)     = RB_BLACK;                        \
+                    RB_COLOR(parent, field)  = RB_BLACK;                        \
+                    RB_COLOR(gparent, field) = RB_RED;                          \
+                    elm                      = gparent;                         \
+                    continue;                                                   \
+                }                                                               \
+                if (RB_RIGHT(parent, field) == elm) {                           \
+                    RB_ROTATE_LEFT(head, parent, tmp, field);                   \
+                    tmp    = parent;                                            \
+                    parent = elm;                                               \
+                    elm    = tmp;                                               \
+                }                                                               \
+                RB_COLOR(parent, field)  = RB_BLACK;                            \
+                RB_COLOR(gparent, field) = RB_RED;                              \
+                RB_ROTATE_RIGHT(head, gparent, tmp, field);                     \
+            } else {                                                            \
+                tmp = RB_LEFT(gparent, field);                                  \
+                if (RB_IS_RED(tmp, field)) {                                    \
+                    RB_COLOR(tmp, field)     = RB_BLACK;                        \
+                    RB_COLOR(parent, field)  = RB_BLACK;                        \
+                    RB_COLOR(gparent, field) = RB_RED;                          \
+                    elm                      = gparent;                         \
+                    continue;                                                   \
+                }                                                               \
+                if (RB_LEFT(parent, field) == elm) {                            \
+                    RB_ROTATE_RIGHT(head, parent, tmp, field);                  \
+                    tmp    = parent;                                            \
+                    parent = elm;                                               \
+                    elm    = tmp;                                               \
+                }                                                               \
+                RB_COLOR(parent, field)  = RB_BLACK;                            \
+                RB_COLOR(gparent, field) = RB_RED;                              \
+                RB_ROTATE_LEFT(head, gparent, tmp, field);                      \
+            }                                                                   \
+        }                                                                       \
+        RB_COLOR(RB_ROOT(head), field) = RB_BLACK;                              \
+    }
+
+/* 删除后修复颜色: elm 所在路径少了一个黑色节点, 通过兄弟节点借色或者向上传递 */
+#define RB_GENERATE_REMOVE_COLOR(name, type, field, attr)                                     \
+    attr void name##_RB_REMOVE_COLOR(                                                         \
+        struct name *head, struct type *parent, struct type *elm)                             \
+    {                                                                                         \
+        struct type *tmp, *rot;                                                               \
+        while (!RB_IS_RED(elm, field) && elm != RB_ROOT(head)) {                              \
+            if (RB_LEFT(parent, field) == elm) {                                              \
+                tmp = RB_RIGHT(parent, field);                                                \
+                if (RB_COLOR(tmp, field) == RB_RED) {                                         \
+                    RB_COLOR(tmp, field)    = RB_BLACK;                                       \
+                    RB_COLOR(parent, field) = RB_RED;                                         \
+                    RB_ROTATE_LEFT(head, parent, rot, field);                                 \
+                    tmp = RB_RIGHT(parent, field);                                            \
+                }                                                                             \
+                if (!RB_IS_RED(RB_LEFT(tmp, field), field) &&                                 \
+                    !RB_IS_RED(RB_RIGHT(tmp, field), field)) {                                \
+                    RB_COLOR(tmp, field) = RB_RED;                                            \
+                    elm                  = parent;                                            \
+                    parent               = RB_PARENT(elm, field);                             \
+                    continue;                                                                 \
+                }                                                                             \
+                if (!RB_IS_RED(RB_RIGHT(tmp, field), field)) {                                \
+                    RB_COLOR(RB_LEFT(tmp, field), field) = RB_BLACK;                          \
+                    RB_COLOR(tmp, field)                 = RB_RED;                            \
+                    RB_ROTATE_RIGHT(head, tmp, rot, field);                                   \
+                    tmp = RB_RIGHT(parent, field);                                            \
+                }                                                                             \
+                RB_COLOR(tmp, field)    = RB_COLOR(parent, field);                            \
+                RB_COLOR(parent, field) = RB_BLACK;                                           \
+                if (RB_RIGHT(tmp, field) != NULL) {                                           \
+                    RB_COLOR(RB_RIGHT(tmp, field), field) = RB_BLACK;                         \
+                }                                                                             \
+                RB_ROTATE_LEFT(head, parent, rot, field);                                     \
+            } else {                                                                          \
+                tmp = RB_LEFT(parent, field);                                                 \
+                if (RB_COLOR(tmp, field) == RB_RED) {                                         \
+                    RB_COLOR(tmp, field)    = RB_BLACK;                                       \
+                    RB_COLOR(parent, field) = RB_RED;                                         \
+                    RB_ROTATE_RIGHT(head, parent, rot, field);                                \
+                    tmp = RB_LEFT(parent, field);                                             \
+                }                                                                             \
+                if (!RB_IS_RED(RB_LEFT(tmp, field), field) &&                                 \
+                    !RB_IS_RED(RB_RIGHT(tmp, field), field)) {                                \
+                    RB_COLOR(tmp, field) = RB_RED;                                            \
+                    elm                  = parent;                                            \
+                    parent               = RB_PARENT(elm, field);                             \
+                    continue;                                                                 \
+                }                                                                             \
+                if (!RB_IS_RED(RB_LEFT(tmp, field), field)) {                                 \
+                    RB_COLOR(RB_RIGHT(tmp, field), field) = RB_BLACK;                         \
+                    RB_COLOR(tmp, field)                  = RB_RED;                           \
+                    RB_ROTATE_LEFT(head, tmp, rot, field);                                    \
+                    tmp = RB_LEFT(parent, field);                                             \
+                }                                                                             \
+                RB_COLOR(tmp, field)    = RB_COLOR(parent, field);                            \
+                RB_COLOR(parent, field) = RB_BLACK;                                           \
+                if (RB_LEFT(tmp, field) != NULL) {                                            \
+                    RB_COLOR(RB_LEFT(tmp, field), field) = RB_BLACK;                          \
+                }                                                                             \
+                RB_ROTATE_RIGHT(head, parent, rot, field);                                    \
+            }                                                                                 \
+            elm = RB_ROOT(head);                                                              \
+            break;                                                                            \
+        }                                                                                     \
+        if (elm != NULL) {                                                                    \
+            RB_COLOR(elm, field) = RB_BLACK;                                                  \
+        }                                                                                     \
+    }
+
+/* 删除节点, 存在两个子节点时使用后继节点替换被删除节点的位置 */
+#define RB_GENERATE_REMOVE(name, type, field, attr)                              \
+    attr struct type *name##_RB_REMOVE(struct name *head, struct type *elm)      \
+    {                                                                            \
+        struct type *child, *parent, *old = elm;                                 \
+        uint32_t     color;                                                      \
+        if (RB_LEFT(elm, field) == NULL) {                                       \
+            child = RB_RIGHT(elm, field);                                        \
+        } else if (RB_RIGHT(elm, field) == NULL) {                               \
+            child = RB_LEFT(elm, field);                                         \
+        } else {                                                                 \
+            elm = RB_RIGHT(elm, field);                                          \
+            while (RB_LEFT(elm, field) != NULL) {                                \
+                elm = RB_LEFT(elm, field);                                       \
+            }                                                                    \
+            child  = RB_RIGHT(elm, field);                                       \
+            parent = RB_PARENT(elm, field);                                      \
+            color  = RB_COLOR(elm, field);                                       \
+            if (child != NULL) {                                                 \
+                RB_PARENT(child, field) = parent;                                \
+            }                                                                    \
+            RB_REPLACE_CHILD(head, parent, elm, child, field);                   \
+            if (RB_PARENT(elm, field) == old) {                                  \
+                parent = elm;                                                    \
+            }                                                                    \
+            (elm)->field = (old)->field;                                         \
+            RB_REPLACE_CHILD(head, RB_PARENT(old, field), old, elm, field);      \
+            RB_PARENT(RB_LEFT(old, field), field) = elm;                         \
+            if (RB_RIGHT(old, field) != NULL) {                                  \
+                RB_PARENT(RB_RIGHT(old, field), field) = elm;                    \
+            }                                                                    \
+            goto fixup;                                                          \
+        }                                                                        \
+        parent = RB_PARENT(elm, field);                                          \
+        color  = RB_COLOR(elm, field);                                           \
+        if (child != NULL) {                                                     \
+            RB_PARENT(child, field) = parent;                                    \
+        }                                                                        \
+        RB_REPLACE_CHILD(head, parent, elm, child, field);                       \
+    fixup:                                                                       \
+        if (color == RB_BLACK) {                                                 \
+            name##_RB_REMOVE_COLOR(head, parent, child);                         \
+        }                                                                        \
+        return old;                                                              \
+    }
+
+/* 插入节点, 键值已存在时返回已有节点, 否则返回 NULL */
+#define RB_GENERATE_INSERT(name, type, field, cmp, attr)                         \
+    attr struct type *name##_RB_INSERT(struct name *head, struct type *elm)      \
+    {                                                                            \
+        struct type *tmp    = RB_ROOT(head);                                     \
+        struct type *parent = NULL;                                              \
+        int32_t      comp   = 0;                                                 \
+        while (tmp != NULL) {                                                    \
+            parent = tmp;                                                        \
+            comp   = cmp(elm, parent);                                           \
+            if (comp < 0) {                                                      \
+                tmp = RB_LEFT(tmp, field);                                       \
+            } else if (comp > 0) {                                               \
+                tmp = RB_RIGHT(tmp, field);                                      \
+            } else {                                                             \
+                return tmp;                                                      \
+            }                                                                    \
+        }                                                                        \
+        RB_SET(elm, parent, field);                                              \
+        if (parent == NULL) {                                                    \
+            RB_ROOT(head) = elm;                                                 \
+        } else if (comp < 0) {                                                   \
+            RB_LEFT(parent, field) = elm;                                        \
+        } else {                                                                 \
+            RB_RIGHT(parent, field) = elm;                                       \
+        }                                                                        \
+        name##_RB_INSERT_COLOR(head, elm);                                       \
+        return NULL;                                                             \
+    }
+
+/* 精确查找, 未找到返回 NULL */
+#define RB_GENERATE_FIND(name, type, field, cmp, attr)                             \
+    attr struct type *name##_RB_FIND(struct name *head, const struct type *elm)    \
+    {                                                                              \
+        struct type *tmp = RB_ROOT(head);                                          \
+        int32_t      comp;                                                         \
+        while (tmp != NULL) {                                                      \
+            comp = cmp(elm, tmp);                                                  \
+            if (comp < 0) {                                                        \
+                tmp = RB_LEFT(tmp, field);                                         \
+            } else if (comp > 0) {                                                 \
+                tmp = RB_RIGHT(tmp, field);                                        \
+            } else {                                                               \
+                return tmp;                                                        \
+            }                                                                      \
+        }                                                                          \
+        return NULL;                                                               \
+    }
+
+/* 下界查找, 返回第一个大于等于 elm 的节点, 不存在时返回 NULL */
+#define RB_GENERATE_NFIND(name, type, field, cmp, attr)                            \
+    attr struct type *name##_RB_NFIND(struct name *head, const struct type *elm)   \
+    {                                                                              \
+        struct type *tmp = RB_ROOT(head);                                          \
+        struct type *res = NULL;                                                   \
+        int32_t      comp;                                                         \
+        while (tmp != NULL) {                                                      \
+            comp = cmp(elm, tmp);                                                  \
+            if (comp < 0) {                                                        \
+                res = tmp;                                                         \
+                tmp = RB_LEFT(tmp, field);                                         \
+            } else if (comp > 0) {                                                 \
+                tmp = RB_RIGHT(tmp, field);                                        \
+            } else {                                                               \
+                return tmp;                                                        \
+            }                                                                      \
+        }                                                                          \
+        return res;                                                                \
+    }
+
+/* 中序后继, 每条边在完整遍历中最多经过两次, 因此均摊 O(1) */
+#define RB_GENERATE_NEXT(name, type, field, attr)                                   \
+    attr struct type *name##_RB_NEXT(struct type *elm)                              \
+    {                                                                               \
+        if (RB_RIGHT(elm, field) != NULL) {                                         \
+            elm = RB_RIGHT(elm, field);                                             \
+            while (RB_LEFT(elm, field) != NULL) {                                   \
+                elm = RB_LEFT(elm, field);                                          \
+            }                                                                       \
+        } else {                                                                    \
+            while (RB_PARENT(elm, field) != NULL &&                                 \
+                   elm == RB_RIGHT(RB_PARENT(elm, field), field)) {                 \
+                elm = RB_PARENT(elm, field);                                        \
+            }                                                                       \
+            elm = RB_PARENT(elm, field);                                            \
+        }                                                                           \
+        return elm;                                                                 \
+    }
+
+/* 中序前驱, 与后继对称 */
+#define RB_GENERATE_PREV(name, type, field, attr)                                   \
+    attr struct type *name##_RB_PREV(struct type *elm)                              \
+    {                                                                               \
+        if (RB_LEFT(elm, field) != NULL) {                                          \
+            elm = RB_LEFT(elm, field);                                              \
+            while (RB_RIGHT(elm, field) != NULL) {                                  \
+                elm = RB_RIGHT(elm, field);                                         \
+            }                                                                       \
+        } else {                                                                    \
+            while (RB_PARENT(elm, field) != NULL &&                                 \
+                   elm == RB_LEFT(RB_PARENT(elm, field), field)) {                  \
+                elm = RB_PARENT(elm, field);                                        \
+            }                                                                       \
+            elm = RB_PARENT(elm, field);                                            \
+        }                                                                           \
+        return elm;                                                                 \
+    }
+
+/* 获取最小(RB_NEGINF)或者最大(RB_INF)节点 */
+#define RB_GENERATE_MINMAX(name, type, field, attr)                                 \
+    attr struct type *name##_RB_MINMAX(struct name *head, int32_t val)              \
+    {                                                                               \
+        struct type *tmp    = RB_ROOT(head);                                        \
+        struct type *parent = NULL;                                                 \
+        while (tmp != NULL) {                                                       \
+            parent = tmp;                                                           \
+            tmp    = (val < 0) ? RB_LEFT(tmp, field) : RB_RIGHT(tmp, field);        \
+        }                                                                           \
+        return parent;                                                              \
+    }
+
+#define RB_NEGINF (-1)
+#define RB_INF    1
+
+#define RB_INSERT(name, x, y) name##_RB_INSERT(x, y)
+#define RB_REMOVE(name, x, y) name##_RB_REMOVE(x, y)
+#define RB_FIND(name, x, y)   name##_RB_FIND(x, y)
+#define RB_NFIND(name, x, y)  name##_RB_NFIND(x, y)
+#define RB_NEXT(name, x, y)   name##_RB_NEXT(y)
+#define RB_PREV(name, x, y)   name##_RB_PREV(y)
+#define RB_MIN(name, x)       name##_RB_MINMAX(x, RB_NEGINF)
+#define RB_MAX(name, x)       name##_RB_MINMAX(x, RB_INF)
+
+#define RB_FOREACH(x, name, head) \
+    for ((x) = RB_MIN(name, head); (x) != NULL; (x) = name##_RB_NEXT(x))
+
+#define RB_FOREACH_FROM(x, name, y) \
+    for ((x) = (y); (x) != NULL; (x) = name##_RB_NEXT(x))
+
+#define RB_FOREACH_SAFE(x, name, head, y)                                   \
+    for ((x) = RB_MIN(name, head); ((x) != NULL) && ((y) = name##_RB_NEXT(x), (x) != NULL); \
+         (x) = (y))
+
+#define RB_FOREACH_REVERSE(x, name, head) \
+    for ((x) = RB_MAX(name, head); (x) != NULL; (x) = name##_RB_PREV(x))
+
+#define RB_FOREACH_REVERSE_FROM(x, name, y) \
+    for ((x) = (y); (x) != NULL; (x) = name##_RB_PREV(x))
+
+#define RB_FOREACH_REVERSE_SAFE(x, name, head, y)                           \
+    for ((x) = RB_MAX(name, head); ((x) != NULL) && ((y) = name##_RB_PREV(x), (x) != NULL); \
+         (x) = (y))
+
+#endif /* __EASEDS_TREE_H__ */
@@ -0,0 +1,377 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-ulist-unittest.c
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-18 18:10
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  Easeds 展开链表单元测试实现文件, 包含了两端插入删除/中间插入删除/迭代器/遍历性能测试.
+ *
+ * @History:
+ *  2026年10月18日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#include "easeds-unittest.h"
+
+// 项目内部头文件
+#include "easeds-array.h"
+#include "easeds-ulist.h"
+#include "easeds-utils.h"
+
+// 对照链表节点, 用于遍历性能对比
+struct ulist_tailq_node {
+    TAILQ_ENTRY(ulist_tailq_node) entry; /* 链表节点 */
+    uint64_t value;                      /* 元素值 */
+};
+
+TAILQ_HEAD(ulist_tailq_head, ulist_tailq_node);
+
+// 大元素, 用于测试节点按最小元素数量扩展
+struct ulist_big_elem {
+    uint64_t key;        /* 键 */
+    uint8_t  blob[1000]; /* 填充内容 */
+};
+
+static void ulist_sum_cb(void *element, void *user_data)
+{
+    *(uint64_t *)user_data += *(uint64_t *)element;
+}
+
+// 对比展开链表和参照数组的全部元素
+static void ulist_check_equal(struct easeds_ulist *list, const uint64_t *ref, uint32_t size)
+{
+    struct easeds_ulist_iter iter;
+    void                    *elem;
+    uint32_t                 i = 0;
+
+    assert_int_equal(easeds_ulist_verify(list), EASEDS_OK);
+    assert_int_equal(easeds_ulist_size(list), size);
+
+    easeds_ulist_iter_init(list, &iter);
+    while (easeds_ulist_iter_next(&iter, &elem)) {
+        assert_true(i < size && *(uint64_t *)elem == ref[i]);
+        i++;
+    }
+    assert_int_equal(i, size);
+}
+
+// 基本功能测试: 两端插入删除, 下标访问, 遍历
+static void test_easeds_ulist_basic(void **state)
+{
+    easeds_unused(state);
+
+    struct easeds_ulist *list = easeds_ulist_create("basic", sizeof(uint64_t), 0);
+    assert_non_null(list);
+    assert_true(easeds_ulist_is_empty(list));
+    assert_int_equal(list->node_bytes, EASEDS_ULIST_NODE_SIZE);
+    assert_int_equal(list->node_capacity, (EASEDS_ULIST_NODE_SIZE - 24) / sizeof(uint64_t));
+
+    // 尾部插入 0..9999, 头部插入 -1..-10000 (按 uint64 回绕)
+    for (uint64_t i = 0; i < 10000; i++) {
+        assert_int_equal(easeds_ulist_push_back(list, &i), EASEDS_OK);
+        uint64_t neg = ~i;
+        assert_int_equal(easeds_ulist_push_front(list, &neg), EASEDS_OK);
+    }
+    assert_int_equal(easeds_ulist_size(list), 20000);
+    assert_int_equal(easeds_ulist_verify(list), EASEDS_OK);
+
+    // 两端插入时节点总是填满, 节点数量接近 n/k
+    uint32_t min_nodes = (20000 + list->node_capacity - 1) / list->node_capacity;
+    assert_true(easeds_ulist_node_count(list) <= min_nodes + 2);
+
+    void *elem = NULL;
+    for (uint32_t i = 0; i < 20000; i += 37) {
+        assert_int_equal(easeds_ulist_get(list, i, &elem), EASEDS_OK);
+        uint64_t expect = i < 10000 ? ~(uint64_t)(9999 - i) : (uint64_t)(i - 10000);
+        assert_true(elem != NULL && *(uint64_t *)elem == expect);
+    }
+
+    uint64_t sum = 0;
+    easeds_ulist_foreach(list, ulist_sum_cb, &sum);
+    uint64_t expect_sum = 0;
+    for (uint64_t i = 0; i < 10000; i++) {
+        expect_sum += i + ~i;
+    }
+    assert_int_equal(sum, expect_sum);
+
+    // 两端弹出
+    uint64_t value = 0;
+    for (uint64_t i = 0; i < 10000; i++) {
+        assert_int_equal(easeds_ulist_pop_back(list, &value), EASEDS_OK);
+        assert_int_equal(value, 9999 - i);
+        assert_int_equal(easeds_ulist_pop_front(list, &value), EASEDS_OK);
+        assert_int_equal(value, ~(9999 - i));
+    }
+    assert_true(easeds_ulist_is_empty(list));
+    assert_int_equal(easeds_ulist_node_count(list), 0);
+    assert_int_equal(easeds_ulist_pop_front(list, NULL), EASEDS_ERROR);
+
+    easeds_ulist_destroy(list);
+}
+
+// 基本功能测试: 随机位置插入删除, 和参照数组逐个对照
+static void test_easeds_ulist_operations(void **state)
+{
+    easeds_unused(state);
+
+    const uint32_t node_elements[] = {0, 2, 3, 16};
+    uint64_t      *ref             = malloc(20000 * sizeof(uint64_t));
+    assert_non_null(ref);
+
+    for (uint32_t c = 0; c < 4; c++) {
+        struct easeds_ulist *list =
+            easeds_ulist_create("ops", sizeof(uint64_t), node_elements[c]);
+        uint32_t size = 0;
+        assert_non_null(list);
+
+        uint64_t seed = 0x2545F4914F6CDD1DULL + c;
+        for (uint64_t i = 0; i < 20000; i++) {
+            seed ^= seed << 13;
+            seed ^= seed >> 7;
+            seed ^= seed << 17;
+
+            uint32_t op  = (uint32_t)(seed % 8);
+            uint32_t idx = (uint32_t)((seed >> 8) % (size + 1));
+            if (op < 5 || size == 0) {
+                assert_int_equal(easeds_ulist_insert(list, idx, &i), EASEDS_OK);
+                memmove(&ref[idx + 1], &ref[idx], (size - idx) * sizeof(uint64_t));
+                ref[idx] = i;
+                size++;
+            } else if (op < 7) {
+                idx = idx == size ? size - 1 : idx;
+                assert_int_equal(easeds_ulist_remove(list, idx), EASEDS_OK);
+                memmove(&ref[idx], &ref[idx + 1], (size - idx - 1) * sizeof(uint64_t));
+                size--;
+            } else {
+                idx = idx == size ? size - 1 : idx;
+                assert_int_equal(easeds_ulist_set(list, idx, &i), EASEDS_OK);
+                ref[idx] = i;
+            }
+
+            if (i % 1000 == 0) {
+                ulist_check_equal(list, ref, size);
+            }
+        }
+        ulist_check_equal(list, ref, size);
+
+        // 随机删除后节点利用率仍然不低于约三分之一
+        MEASURE("[ulist operations]: node capacity %u, %u elements in %u nodes.",
+            list->node_capacity, size, easeds_ulist_node_count(list));
+        assert_true((uint64_t)easeds_ulist_node_count(list) * list->node_capacity
+                    <= (uint64_t)size * 3 + list->node_capacity * 2);
+
+        // 全部从中间删除
+        while (size > 0) {
+            uint32_t idx = size / 2;
+            assert_int_equal(easeds_ulist_remove(list, idx), EASEDS_OK);
+            memmove(&ref[idx], &ref[idx + 1], (size - idx - 1) * sizeof(uint64_t));
+            size--;
+            if (size % 1000 == 0) {
+                ulist_check_equal(list, ref, size);
+            }
+        }
+        assert_int_equal(easeds_ulist_node_count(list), 0);
+
+        easeds_ulist_destroy(list);
+    }
+
+    free(ref);
+}
+
+// 边界测试: 大元素, 1 字节元素, 清空后复用, 空链表迭代
+static void test_easeds_ulist_boundary(void **state)
+{
+    easeds_unused(state);
+
+    // 大元素, 每个节点至少容纳 EASEDS_ULIST_MIN_NODE_ELEMENTS 个
+    struct easeds_ulist *big = easeds_ulist_create("big", sizeof(struct ulist_big_elem), 0);
+    assert_non_null(big);
+    assert_int_equal(big->node_capacity, EASEDS_ULIST_MIN_NODE_ELEMENTS);
+    assert_int_equal(big->node_bytes % EASEDS_CACHE_LINE_SIZE, 0);
+
+    struct ulist_big_elem elem;
+    memset(&elem, 0xA5, sizeof(elem));
+    for (uint64_t i = 0; i < 100; i++) {
+        elem.key = i;
+        assert_int_equal(easeds_ulist_insert(big, (uint32_t)(i / 2), &elem), EASEDS_OK);
+    }
+    assert_int_equal(easeds_ulist_verify(big), EASEDS_OK);
+    void *ptr = NULL;
+    assert_int_equal(easeds_ulist_get(big, 0, &ptr), EASEDS_OK);
+    assert_true(ptr != NULL && ((struct ulist_big_elem *)ptr)->key == 1);
+    assert_int_equal(easeds_ulist_get(big, 99, &ptr), EASEDS_OK);
+    assert_true(ptr != NULL && ((struct ulist_big_elem *)ptr)->blob[999] == 0xA5);
+    easeds_ulist_destroy(big);
+
+    // 1 字节元素
+    struct easeds_ulist *bytes = easeds_ulist_create("bytes", 1, 0);
+    assert_non_null(bytes);
+    assert_int_equal(bytes->node_capacity, EASEDS_ULIST_NODE_SIZE - 24);
+    for (uint32_t i = 0; i < 1000; i++) {
+        uint8_t c = (uint8_t)i;
+        assert_int_equal(easeds_ulist_push_back(bytes, &c), EASEDS_OK);
+    }
+    assert_int_equal(easeds_ulist_node_count(bytes), 5);
+
+    // 清空后复用
+    easeds_ulist_clear(bytes);
+    assert_int_equal(easeds_ulist_size(bytes), 0);
+    assert_int_equal(easeds_ulist_node_count(bytes), 0);
+
+    struct easeds_ulist_iter iter;
+    easeds_ulist_iter_init(bytes, &iter);
+    assert_false(easeds_ulist_iter_next(&iter, &ptr));
+
+    uint8_t c = 7;
+    assert_int_equal(easeds_ulist_insert(bytes, 0, &c), EASEDS_OK);
+    assert_int_equal(easeds_ulist_pop_back(bytes, &c), EASEDS_OK);
+    assert_int_equal(c, 7);
+    easeds_ulist_destroy(bytes);
+}
+
+// 失效测试: 非法参数和越界
+static void test_easeds_ulist_error(void **state)
+{
+    easeds_unused(state);
+
+    assert_null(easeds_ulist_create("error", 0, 0));
+    assert_null(easeds_ulist_create("error", 8, 1));
+    assert_null(easeds_ulist_create("error", UINT32_MAX, 4));
+
+    uint64_t value = 1;
+    void    *ptr   = NULL;
+    assert_int_equal(easeds_ulist_push_back(NULL, &value), EASEDS_ERROR);
+    assert_int_equal(easeds_ulist_push_front(NULL, &value), EASEDS_ERROR);
+    assert_int_equal(easeds_ulist_pop_back(NULL, NULL), EASEDS_ERROR);
+    assert_int_equal(easeds_ulist_verify(NULL), EASEDS_ERROR);
+    assert_int_equal(easeds_ulist_size(NULL), 0);
+    assert_true(easeds_ulist_is_empty(NULL));
+
+    struct easeds_ulist *list = easeds_ulist_create("error", sizeof(uint64_t), 0);
+    assert_non_null(list);
+    assert_int_equal(easeds_ulist_push_back(list, NULL), EASEDS_ERROR);
+    assert_int_equal(easeds_ulist_insert(list, 1, &value), EASEDS_ERROR);
+    assert_int_equal(easeds_ulist_remove(list, 0), EASEDS_ERROR);
+    assert_int_equal(easeds_ulist_get(list, 0, &ptr), EASEDS_ERROR);
+    assert_int_equal(easeds_ulist_set(list, 0, &value), EASEDS_ERROR);
+    assert_int_equal(easeds_ulist_pop_back(list, &value), EASEDS_ERROR);
+    assert_int_equal(easeds_ulist_insert(list, 0, &value), EASEDS_OK);
+    assert_int_equal(easeds_ulist_get(list, 1, &ptr), EASEDS_ERROR);
+    easeds_ulist_destroy(list);
+}
+
+// 性能测试: 顺序遍历对比 TAILQ 和数组, 两端插入和中间插入
+static void test_easeds_ulist_perf(void **state)
+{
+    easeds_unused(state);
+
+    const uint32_t count = 1000000;
+
+    // 模拟长期运行后的堆: 先打乱节点地址, 再按顺序链接
+    struct ulist_tailq_node **nodes = malloc(count * sizeof(struct ulist_tailq_node *));
+    assert_non_null(nodes);
+    for (uint32_t i = 0; i < count; i++) {
+        nodes[i] = malloc(sizeof(struct ulist_tailq_node));
+        assert_non_null(nodes[i]);
+    }
+    uint64_t seed = 88172645463325252ULL;
+    for (uint32_t i = count - 1; i > 0; i--) {
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+        uint32_t                 j   = (uint32_t)(seed % (i + 1));
+        struct ulist_tailq_node *tmp = nodes[i];
+        nodes[i]                     = nodes[j];
+        nodes[j]                     = tmp;
+    }
+
+    struct ulist_tailq_head head = TAILQ_HEAD_INITIALIZER(head);
+    struct easeds_ulist    *list = easeds_ulist_create("perf", sizeof(uint64_t), 0);
+    struct easeds_array    *array = easeds_array_create("perf", sizeof(uint64_t), count);
+    assert_non_null(list);
+    assert_non_null(array);
+
+    int64_t start = easeds_get_current_time_ns();
+    for (uint64_t i = 0; i < count; i++) {
+        assert_int_equal(easeds_ulist_push_back(list, &i), EASEDS_OK);
+    }
+    int64_t push_ns = easeds_get_current_time_ns() - start;
+
+    for (uint64_t i = 0; i < count; i++) {
+        nodes[i]->value = i;
+        TAILQ_INSERT_TAIL(&head, nodes[i], entry);
+        assert_int_equal(easeds_array_push_back(array, &i), EASEDS_OK);
+    }
+
+    // 遍历求和
+    uint64_t                 sum_tailq = 0, sum_ulist = 0, sum_array = 0;
+    struct ulist_tailq_node *tnode;
+    start = easeds_get_current_time_ns();
+    TAILQ_FOREACH(tnode, &head, entry)
+    {
+        sum_tailq += tnode->value;
+    }
+    int64_t tailq_ns = easeds_get_current_time_ns() - start;
+
+    struct easeds_ulist_iter iter;
+    void                    *elem;
+    start = easeds_get_current_time_ns();
+    easeds_ulist_iter_init(list, &iter);
+    while (easeds_ulist_iter_next(&iter, &elem)) {
+        sum_ulist += *(uint64_t *)elem;
+    }
+    int64_t ulist_ns = easeds_get_current_time_ns() - start;
+
+    start = easeds_get_current_time_ns();
+    for (uint32_t i = 0; i < count; i++) {
+        sum_array += ((uint64_t *)array->elements)[i];
+    }
+    int64_t array_ns = easeds_get_current_time_ns() - start;
+
+    assert_int_equal(sum_tailq, sum_ulist);
+    assert_int_equal(sum_array, sum_ulist);
+    MEASURE("[ulist perf]: traverse %u elements, TAILQ %.2f ns/elem, ulist %.2f ns/elem "
+            "(%u nodes), array %.2f ns/elem.",
+        count, (double)tailq_ns / count, (double)ulist_ns / count, easeds_ulist_node_count(list),
+        (double)array_ns / count);
+    MEASURE("[ulist perf]: push_back %.2f ns/op.", (double)push_ns / count);
+
+    // 中间插入, 对比数组整体搬移
+    const uint32_t inserts = 2000;
+    start                  = easeds_get_current_time_ns();
+    for (uint64_t i = 0; i < inserts; i++) {
+        assert_int_equal(easeds_ulist_insert(list, easeds_ulist_size(list) / 2, &i), EASEDS_OK);
+    }
+    int64_t ulist_insert_ns = easeds_get_current_time_ns() - start;
+
+    start = easeds_get_current_time_ns();
+    for (uint64_t i = 0; i < inserts; i++) {
+        assert_int_equal(
+            easeds_array_insert(array, easeds_array_size(array) / 2, &i), EASEDS_OK);
+    }
+    int64_t array_insert_ns = easeds_get_current_time_ns() - start;
+    MEASURE("[ulist perf]: insert middle of %u, ulist %.2f ns/op, array %.2f ns/op.", count,
+        (double)ulist_insert_ns / inserts, (double)array_insert_ns / inserts);
+
+    easeds_array_destroy(array);
+    easeds_ulist_destroy(list);
+    for (uint32_t i = 0; i < count; i++) {
+        free(nodes[i]);
+    }
+    free(nodes);
+}
+
+// 注册单元测试用例
+EASEDS_UNITTEST_REGISTER(easeds_unittest_ulist){
+    cmocka_unit_test(test_easeds_ulist_basic),
+    cmocka_unit_test(test_easeds_ulist_operations),
+    cmocka_unit_test(test_easeds_ulist_boundary),
+    cmocka_unit_test(test_easeds_ulist_error),
+    cmocka_unit_test(test_easeds_ulist_perf),
+    easeds_unit_test_end,
+};
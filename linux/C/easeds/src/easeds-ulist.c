@@ -0,0 +1,499 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-ulist.c
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-18 17:40
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  展开链表(Unrolled Linked List)实现文件.
+ *
+ * @History:
+ *  2026年10月18日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#include "easeds-ulist.h"
+
+// 标准库头文件
+#include <stdlib.h>
+#include <string.h>
+
+// 项目内部头文件
+#include "easeds-log.h"
+
+/* 节点头部大小, 元素从该偏移开始存放 */
+#define ULIST_NODE_HEADER_SIZE ((uint32_t)offsetof(struct easeds_ulist_node, data))
+
+// 获取节点内指定下标的元素地址
+static uint8_t *ulist_elem(struct easeds_ulist *list, struct easeds_ulist_node *node, uint32_t i)
+{
+    return node->data + (size_t)i * list->element_size;
+}
+
+// 分配一个空节点, 按缓存行对齐
+static struct easeds_ulist_node *ulist_node_alloc(struct easeds_ulist *list)
+{
+    struct easeds_ulist_node *node =
+        __easeds_aligned_alloc(EASEDS_CACHE_LINE_SIZE, list->node_bytes);
+    if (unlikely(node == NULL)) {
+        EASEDS_ERR("[ulist_node_alloc]: Malloc node %u bytes failed.", list->node_bytes);
+        return NULL;
+    }
+
+    node->count = 0;
+    node->pad   = 0;
+    list->node_count++;
+    return node;
+}
+
+// 从链表中摘除并释放节点
+static void ulist_node_free(struct easeds_ulist *list, struct easeds_ulist_node *node)
+{
+    TAILQ_REMOVE(&list->nodes, node, entry);
+    __easeds_free(node);
+    list->node_count--;
+}
+
+// 定位下标所在的节点, 从较近的一端按节点跳跃, offset 返回节点内下标, 越界返回NULL
+static struct easeds_ulist_node *ulist_locate(
+    struct easeds_ulist *list, uint32_t index, uint32_t *offset)
+{
+    struct easeds_ulist_node *node;
+
+    if (index < list->size / 2) {
+        TAILQ_FOREACH(node, &list->nodes, entry)
+        {
+            if (index < node->count) {
+                break;
+            }
+            index -= node->count;
+        }
+    } else {
+        uint32_t rest = list->size - index; /* 从尾部数的位置, 至少为 1 */
+        TAILQ_FOREACH_REVERSE(node, &list->nodes, easeds_ulist_nodes, entry)
+        {
+            if (rest <= node->count) {
+                break;
+            }
+            rest -= node->count;
+        }
+        if (node != NULL) {
+            index = node->count - rest;
+        }
+    }
+
+    *offset = index;
+    return node;
+}
+
+// 在节点内 pos 位置插入元素, 节点必须还有空位
+static void ulist_node_insert(
+    struct easeds_ulist *list, struct easeds_ulist_node *node, uint32_t pos, const void *element)
+{
+    uint8_t *slot = ulist_elem(list, node, pos);
+
+    if (pos < node->count) {
+        memmove(slot + list->element_size, slot, (size_t)(node->count - pos) * list->element_size);
+    }
+    memcpy(slot, element, list->element_size);
+    node->count++;
+    list->size++;
+}
+
+// 把已满节点的后一半元素移动到新节点, 新节点插入到原节点之后, 失败返回NULL
+static struct easeds_ulist_node *ulist_node_split(
+    struct easeds_ulist *list, struct easeds_ulist_node *node)
+{
+    struct easeds_ulist_node *next = ulist_node_alloc(list);
+    if (unlikely(next == NULL)) {
+        return NULL;
+    }
+
+    uint32_t keep = node->count / 2;
+    next->count   = node->count - keep;
+    memcpy(next->data, ulist_elem(list, node, keep), (size_t)next->count * list->element_size);
+    node->count = keep;
+
+    TAILQ_INSERT_AFTER(&list->nodes, node, next, entry);
+    return next;
+}
+
+// 删除节点内 pos 位置的元素, 节点变空时释放, 少于半满时尝试和相邻节点合并
+static void ulist_node_erase(
+    struct easeds_ulist *list, struct easeds_ulist_node *node, uint32_t pos)
+{
+    uint8_t *slot = ulist_elem(list, node, pos);
+
+    node->count--;
+    list->size--;
+    if (pos < node->count) {
+        memmove(slot, slot + list->element_size, (size_t)(node->count - pos) * list->element_size);
+    }
+
+    if (node->count == 0) {
+        ulist_node_free(list, node);
+        return;
+    }
+
+    if (node->count >= list->node_capacity / 2) {
+        return;
+    }
+
+    /* 把后一个节点的元素追加到前一个节点, 然后释放后一个节点 */
+    struct easeds_ulist_node *prev = node;
+    struct easeds_ulist_node *next = TAILQ_NEXT(node, entry);
+    if (next == NULL) {
+        prev = TAILQ_PREV(node, easeds_ulist_nodes, entry);
+        next = node;
+    }
+
+    if (prev == NULL || prev->count + next->count > list->node_capacity) {
+        return;
+    }
+
+    memcpy(ulist_elem(list, prev, prev->count), next->data,
+        (size_t)next->count * list->element_size);
+    prev->count += next->count;
+    ulist_node_free(list, next);
+}
+
+/**
+ * @description: 创建展开链表, 返回链表指针, 失败返回NULL.
+ * @param name 链表名称, 预留字段, 可用于调试和日志输出
+ * @param element_size 元素大小, 单位字节
+ * @param node_elements 每个节点的元素容量, 至少为2; 为0时按 EASEDS_ULIST_NODE_SIZE 计算,
+ *        且不少于 EASEDS_ULIST_MIN_NODE_ELEMENTS
+ * @return 成功返回链表指针, 失败返回NULL
+ */
+struct easeds_ulist *easeds_ulist_create(
+    const char *name, uint32_t element_size, uint32_t node_elements)
+{
+    uint64_t node_bytes;
+
+    if (unlikely(element_size == 0 || node_elements == 1)) {
+        EASEDS_ERR("[easeds_ulist_create]: Invalid element size %u or node elements %u.",
+            element_size, node_elements);
+        return NULL;
+    }
+
+    if (node_elements == 0) {
+        node_elements = (EASEDS_ULIST_NODE_SIZE - ULIST_NODE_HEADER_SIZE) / element_size;
+        if (node_elements < EASEDS_ULIST_MIN_NODE_ELEMENTS) {
+            node_elements = EASEDS_ULIST_MIN_NODE_ELEMENTS;
+        }
+    }
+
+    /* 节点大小向上取整到缓存行, 满足 aligned_alloc 的要求 */
+    node_bytes = ULIST_NODE_HEADER_SIZE + (uint64_t)node_elements * element_size;
+    node_bytes = (node_bytes + EASEDS_CACHE_LINE_SIZE - 1)
+                 & ~(uint64_t)(EASEDS_CACHE_LINE_SIZE - 1);
+    if (unlikely(node_bytes > UINT32_MAX)) {
+        EASEDS_ERR("[easeds_ulist_create]: Node too large, element size %u, node elements %u.",
+            element_size, node_elements);
+        return NULL;
+    }
+
+    struct easeds_ulist *list = __easeds_malloc(sizeof(struct easeds_ulist));
+    if (unlikely(list == NULL)) {
+        EASEDS_ERR("[easeds_ulist_create]: Malloc list failed.");
+        return NULL;
+    }
+
+    list->name          = name;
+    list->size          = 0;
+    list->element_size  = element_size;
+    list->node_capacity = node_elements;
+    list->node_bytes    = (uint32_t)node_bytes;
+    list->node_count    = 0;
+    list->flags         = 0;
+    TAILQ_INIT(&list->nodes);
+
+    PFL_DEBUG("[easeds_ulist_create]: element_size=%u, node_capacity=%u, node_bytes=%u.",
+        element_size, node_elements, list->node_bytes);
+    return list;
+}
+
+// 销毁展开链表, 释放内存
+void easeds_ulist_destroy(struct easeds_ulist *list)
+{
+    if (unlikely(list == NULL)) {
+        return;
+    }
+
+    easeds_ulist_clear(list);
+    __easeds_free(list);
+}
+
+// 清空展开链表, 释放所有节点
+void easeds_ulist_clear(struct easeds_ulist *list)
+{
+    struct easeds_ulist_node *node;
+
+    if (unlikely(list == NULL)) {
+        return;
+    }
+
+    while ((node = TAILQ_FIRST(&list->nodes)) != NULL) {
+        ulist_node_free(list, node);
+    }
+    list->size = 0;
+}
+
+// 获取元素数量
+uint32_t easeds_ulist_size(struct easeds_ulist *list)
+{
+    if (unlikely(list == NULL)) {
+        return 0;
+    }
+
+    return list->size;
+}
+
+// 判断是否为空, 为空返回true, 否则返回false
+bool easeds_ulist_is_empty(struct easeds_ulist *list)
+{
+    if (unlikely(list == NULL)) {
+        return true;
+    }
+
+    return list->size == 0;
+}
+
+// 获取节点数量
+uint32_t easeds_ulist_node_count(struct easeds_ulist *list)
+{
+    if (unlikely(list == NULL)) {
+        return 0;
+    }
+
+    return list->node_count;
+}
+
+// 在头部插入元素, 头部节点已满时新建节点, 成功返回0, 失败返回-1
+int32_t easeds_ulist_push_front(struct easeds_ulist *list, const void *element)
+{
+    if (unlikely(list == NULL || element == NULL || list->size == UINT32_MAX)) {
+        EASEDS_ERR("[easeds_ulist_push_front]: Invalid list or element pointer, or list full.");
+        return -1;
+    }
+
+    struct easeds_ulist_node *node = TAILQ_FIRST(&list->nodes);
+    if (node == NULL || node->count == list->node_capacity) {
+        node = ulist_node_alloc(list);
+        if (unlikely(node == NULL)) {
+            return -1;
+        }
+        TAILQ_INSERT_HEAD(&list->nodes, node, entry);
+    }
+
+    ulist_node_insert(list, node, 0, element);
+    return 0;
+}
+
+// 在尾部插入元素, 尾部节点已满时新建节点, 成功返回0, 失败返回-1
+int32_t easeds_ulist_push_back(struct easeds_ulist *list, const void *element)
+{
+    if (unlikely(list == NULL || element == NULL || list->size == UINT32_MAX)) {
+        EASEDS_ERR("[easeds_ulist_push_back]: Invalid list or element pointer, or list full.");
+        return -1;
+    }
+
+    struct easeds_ulist_node *node = TAILQ_LAST(&list->nodes, easeds_ulist_nodes);
+    if (node == NULL || node->count == list->node_capacity) {
+        node = ulist_node_alloc(list);
+        if (unlikely(node == NULL)) {
+            return -1;
+        }
+        TAILQ_INSERT_TAIL(&list->nodes, node, entry);
+    }
+
+    ulist_node_insert(list, node, node->count, element);
+    return 0;
+}
+
+// 删除头部元素, element 非空时复制到 element, 成功返回0, 失败返回-1
+int32_t easeds_ulist_pop_front(struct easeds_ulist *list, void *element)
+{
+    if (unlikely(list == NULL)) {
+        return -1;
+    }
+
+    struct easeds_ulist_node *node = TAILQ_FIRST(&list->nodes);
+    if (node == NULL) {
+        return -1;
+    }
+    if (element != NULL) {
+        memcpy(element, node->data, list->element_size);
+    }
+    ulist_node_erase(list, node, 0);
+    return 0;
+}
+
+// 删除尾部元素, element 非空时复制到 element, 成功返回0, 失败返回-1
+int32_t easeds_ulist_pop_back(struct easeds_ulist *list, void *element)
+{
+    if (unlikely(list == NULL)) {
+        return -1;
+    }
+
+    struct easeds_ulist_node *node = TAILQ_LAST(&list->nodes, easeds_ulist_nodes);
+    if (node == NULL) {
+        return -1;
+    }
+    if (element != NULL) {
+        memcpy(element, ulist_elem(list, node, node->count - 1), list->element_size);
+    }
+    ulist_node_erase(list, node, node->count - 1);
+    return 0;
+}
+
+/**
+ * @description: 在指定下标插入元素, 所在节点已满时先分裂为两个半满节点.
+ * @param list 链表指针
+ * @param index 插入位置, 等于元素数量时插入到尾部
+ * @param element 元素指针
+ * @return 成功返回0, 失败返回-1
+ */
+int32_t easeds_ulist_insert(struct easeds_ulist *list, uint32_t index, const void *element)
+{
+    uint32_t pos;
+
+    if (unlikely(list == NULL || element == NULL || index > list->size)) {
+        EASEDS_ERR("[easeds_ulist_insert]: Invalid list or element pointer, or index %u.", index);
+        return -1;
+    }
+
+    if (index == list->size) {
+        return easeds_ulist_push_back(list, element);
+    }
+
+    struct easeds_ulist_node *node = ulist_locate(list, index, &pos);
+    if (unlikely(node == NULL)) {
+        return -1;
+    }
+    if (node->count == list->node_capacity) {
+        struct easeds_ulist_node *next = ulist_node_split(list, node);
+        if (unlikely(next == NULL)) {
+            return -1;
+        }
+        if (pos > node->count) {
+            pos -= node->count;
+            node = next;
+        }
+    }
+
+    ulist_node_insert(list, node, pos, element);
+    return 0;
+}
+
+// 删除指定下标的元素, 成功返回0, 失败返回-1
+int32_t easeds_ulist_remove(struct easeds_ulist *list, uint32_t index)
+{
+    uint32_t pos;
+
+    if (unlikely(list == NULL || index >= list->size)) {
+        EASEDS_ERR("[easeds_ulist_remove]: Invalid list pointer or index %u.", index);
+        return -1;
+    }
+
+    struct easeds_ulist_node *node = ulist_locate(list, index, &pos);
+    if (unlikely(node == NULL)) {
+        return -1;
+    }
+    ulist_node_erase(list, node, pos);
+    return 0;
+}
+
+// 获取指定下标的元素指针, 成功返回0, 失败返回-1
+int32_t easeds_ulist_get(struct easeds_ulist *list, uint32_t index, void **element)
+{
+    uint32_t pos;
+
+    if (unlikely(list == NULL || element == NULL || index >= list->size)) {
+        EASEDS_ERR("[easeds_ulist_get]: Invalid list or element pointer, or index %u.", index);
+        return -1;
+    }
+
+    struct easeds_ulist_node *node = ulist_locate(list, index, &pos);
+    if (unlikely(node == NULL)) {
+        return -1;
+    }
+    *element = ulist_elem(list, node, pos);
+    return 0;
+}
+
+// 设置指定下标的元素值, 成功返回0, 失败返回-1
+int32_t easeds_ulist_set(struct easeds_ulist *list, uint32_t index, const void *element)
+{
+    uint32_t pos;
+
+    if (unlikely(list == NULL || element == NULL || index >= list->size)) {
+        EASEDS_ERR("[easeds_ulist_set]: Invalid list or element pointer, or index %u.", index);
+        return -1;
+    }
+
+    struct easeds_ulist_node *node = ulist_locate(list, index, &pos);
+    if (unlikely(node == NULL)) {
+        return -1;
+    }
+    memcpy(ulist_elem(list, node, pos), element, list->element_size);
+    return 0;
+}
+
+// 遍历所有元素, 对每个元素执行回调函数
+void easeds_ulist_foreach(
+    struct easeds_ulist *list, void (*callback)(void *element, void *user_data), void *user_data)
+{
+    struct easeds_ulist_node *node;
+
+    if (unlikely(list == NULL || callback == NULL)) {
+        return;
+    }
+
+    TAILQ_FOREACH(node, &list->nodes, entry)
+    {
+        uint8_t *elem = node->data;
+        for (uint32_t i = 0; i < node->count; i++, elem += list->element_size) {
+            callback(elem, user_data);
+        }
+    }
+}
+
+// 校验节点计数和链表结构, 正确返回0, 异常返回-1
+int32_t easeds_ulist_verify(struct easeds_ulist *list)
+{
+    struct easeds_ulist_node *node;
+    uint64_t                  size  = 0;
+    uint32_t                  nodes = 0;
+
+    if (unlikely(list == NULL)) {
+        EASEDS_ERR("[easeds_ulist_verify]: Invalid list pointer.");
+        return -1;
+    }
+
+    TAILQ_FOREACH(node, &list->nodes, entry)
+    {
+        if (node->count == 0 || node->count > list->node_capacity) {
+            EASEDS_ERR("[easeds_ulist_verify]: Node %u has invalid count %u.", nodes, node->count);
+            return -1;
+        }
+        if (((uintptr_t)node & (EASEDS_CACHE_LINE_SIZE - 1)) != 0) {
+            EASEDS_ERR("[easeds_ulist_verify]: Node %u is not cache line aligned.", nodes);
+            return -1;
+        }
+        size += node->count;
+        nodes++;
+    }
+
+    if (size != list->size || nodes != list->node_count) {
+        EASEDS_ERR("[easeds_ulist_verify]: Counted %lu elements in %u nodes, expect %u in %u.",
+            size, nodes, list->size, list->node_count);
+        return -1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,187 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2026 Once Day <once_day@qq.com>, All rights reserved.
+ *
+ * @FilePath: /linux/C/easeds/src/easeds-ulist.h
+ * @Author: Once Day <once_day@qq.com>.
+ * @Date: 2026-10-18 17:40
+ * @info: Encoder=utf-8, TabSize=4, Eol=\n.
+ *
+ * @Description:
+ *  展开链表(Unrolled Linked List), 每个节点按缓存行对齐并存放多个元素, 元素大小运行时指定.
+ *
+ * @History:
+ *  2026年10月18日, Once Day <once_day@qq.com>, 创建此文件.
+ *
+ */
+
+#ifndef __EASEDS_ULIST_H__
+#define __EASEDS_ULIST_H__
+
+/* C 标准库头文件 */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* 项目内部头文件 */
+#include "easeds-environment.h"
+#include "easeds-public.h"
+#include "easeds-queue.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 默认节点大小, 节点内元素数量由节点大小和元素大小计算 */
+#define EASEDS_ULIST_NODE_SIZE (4 * EASEDS_CACHE_LINE_SIZE)
+
+/* 每个节点至少容纳的元素数量, 元素较大时节点大小按缓存行向上扩展 */
+#define EASEDS_ULIST_MIN_NODE_ELEMENTS 4
+
+/* 展开链表节点, 元素紧跟在节点头部后面连续存放 */
+struct easeds_ulist_node {
+    TAILQ_ENTRY(easeds_ulist_node) entry; /* 节点链表 */
+    uint32_t count;                       /* 节点内元素数量 */
+    uint32_t pad;                         /* 对齐填充 */
+    uint8_t  data[];                      /* 元素内容 */
+};
+
+TAILQ_HEAD(easeds_ulist_nodes, easeds_ulist_node);
+
+/**
+ * 实现一个展开链表, 每个节点存放最多 node_capacity 个元素, 兼顾链表的插入删除和数组的局部性.
+ *  (1) 节点按缓存行对齐分配, 默认节点大小为 EASEDS_ULIST_NODE_SIZE, 元素大小运行时指定.
+ *  (2) 两端插入和删除复杂度 O(1), 尾部插入时节点总是填满, 头部插入时节点满了才新建节点.
+ *  (3) 中间插入时节点已满则分裂为两个半满节点; 删除后节点少于半满时,
+ *      如果和相邻节点的元素总数不超过节点容量则合并, 保证节点平均利用率.
+ *  (4) 按下标定位时从较近的一端按节点跳跃, 复杂度 O(n/k); 顺序遍历访问约 n/k 个节点.
+ *  (5) 插入和删除会移动节点内的元素, 元素指针在修改操作后失效.
+ *  (6) 非线程安全, 需要用户自行保证线程安全性.
+ */
+struct easeds_ulist {
+    const char               *name;          /* 名称, 预留字段, 可用于调试和日志输出 */
+    struct easeds_ulist_nodes nodes;         /* 节点链表 */
+    uint32_t                  size;          /* 元素总数 */
+    uint32_t                  element_size;  /* 元素大小 */
+    uint32_t                  node_capacity; /* 每个节点的元素容量 */
+    uint32_t                  node_bytes;    /* 每个节点的分配大小, 缓存行的整数倍 */
+    uint32_t                  node_count;    /* 节点数量 */
+    uint32_t                  flags;         /* 标志位, 预留字段 */
+};
+
+/* 展开链表迭代器, 顺序遍历时只在节点之间跳转 */
+struct easeds_ulist_iter {
+    struct easeds_ulist      *list;  /* 所属链表 */
+    struct easeds_ulist_node *node;  /* 当前节点, NULL 表示遍历结束 */
+    uint32_t                  index; /* 当前节点内下标 */
+    uint32_t                  pad;   /* 对齐填充 */
+};
+
+/**
+ * 常见展开链表操作函数:
+ *
+ * 函数名                       功能描述
+ * ------------------------     ------------------------------------------------------
+ * easeds_ulist_create          创建展开链表, 返回链表指针, 失败返回NULL
+ * easeds_ulist_destroy         销毁展开链表, 释放内存
+ * easeds_ulist_clear           清空展开链表, 释放所有节点
+ * easeds_ulist_size            获取元素数量
+ * easeds_ulist_is_empty        判断是否为空, 为空返回true, 否则返回false
+ * easeds_ulist_node_count      获取节点数量
+ * easeds_ulist_push_front      在头部插入元素, 成功返回0, 失败返回-1
+ * easeds_ulist_push_back       在尾部插入元素, 成功返回0, 失败返回-1
+ * easeds_ulist_pop_front       删除头部元素, element 非空时复制到 element, 成功返回0, 失败返回-1
+ * easeds_ulist_pop_back        删除尾部元素, element 非空时复制到 element, 成功返回0, 失败返回-1
+ * easeds_ulist_insert          在指定下标插入元素, 成功返回0, 失败返回-1
+ * easeds_ulist_remove          删除指定下标的元素, 成功返回0, 失败返回-1
+ * easeds_ulist_get             获取指定下标的元素指针, 成功返回0, 失败返回-1
+ * easeds_ulist_set             设置指定下标的元素值, 成功返回0, 失败返回-1
+ * easeds_ulist_foreach         遍历所有元素, 对每个元素执行回调函数
+ * easeds_ulist_iter_init       初始化迭代器, 指向第一个元素
+ * easeds_ulist_iter_next       获取迭代器当前元素并前进, 遍历结束返回false
+ * easeds_ulist_verify          校验节点计数和链表结构, 正确返回0, 异常返回-1
+ */
+
+// 创建展开链表, node_elements 为每个节点的元素容量, 为0时按默认节点大小计算, 失败返回NULL
+struct easeds_ulist *easeds_ulist_create(
+    const char *name, uint32_t element_size, uint32_t node_elements);
+
+// 销毁展开链表, 释放内存
+void easeds_ulist_destroy(struct easeds_ulist *list);
+
+// 清空展开链表, 释放所有节点
+void easeds_ulist_clear(struct easeds_ulist *list);
+
+// 获取元素数量
+uint32_t easeds_ulist_size(struct easeds_ulist *list);
+
+// 判断是否为空, 为空返回true, 否则返回false
+bool easeds_ulist_is_empty(struct easeds_ulist *list);
+
+// 获取节点数量
+uint32_t easeds_ulist_node_count(struct easeds_ulist *list);
+
+// 在头部插入元素, 成功返回0, 失败返回-1
+int32_t easeds_ulist_push_front(struct easeds_ulist *list, const void *element);
+
+// 在尾部插入元素, 成功返回0, 失败返回-1
+int32_t easeds_ulist_push_back(struct easeds_ulist *list, const void *element);
+
+// 删除头部元素, element 非空时复制到 element, 成功返回0, 失败返回-1
+int32_t easeds_ulist_pop_front(struct easeds_ulist *list, void *element);
+
+// 删除尾部元素, element 非空时复制到 element, 成功返回0, 失败返回-1
+int32_t easeds_ulist_pop_back(struct easeds_ulist *list, void *element);
+
+// 在指定下标插入元素, index 等于元素数量时插入到尾部, 成功返回0, 失败返回-1
+int32_t easeds_ulist_insert(struct easeds_ulist *list, uint32_t index, const void *element);
+
+// 删除指定下标的元素, 成功返回0, 失败返回-1
+int32_t easeds_ulist_remove(struct easeds_ulist *list, uint32_t index);
+
+// 获取指定下标的元素指针, 成功返回0, 失败返回-1
+int32_t easeds_ulist_get(struct easeds_ulist *list, uint32_t index, void **element);
+
+// 设置指定下标的元素值, 成功返回0, 失败返回-1
+int32_t easeds_ulist_set(struct easeds_ulist *list, uint32_t index, const void *element);
+
+// 遍历所有元素, 对每个元素执行回调函数
+void easeds_ulist_foreach(
+    struct easeds_ulist *list, void (*callback)(void *element, void *user_data), void *user_data);
+
+// 初始化迭代器, 指向第一个元素
+static inline void easeds_ulist_iter_init(struct easeds_ulist *list, struct easeds_ulist_iter *iter)
+{
+    iter->list  = list;
+    iter->node  = TAILQ_FIRST(&list->nodes);
+    iter->index = 0;
+    iter->pad   = 0;
+}
+
+// 获取迭代器当前元素并前进, 遍历结束返回false, 遍历期间不能修改链表
+static inline bool easeds_ulist_iter_next(struct easeds_ulist_iter *iter, void **element)
+{
+    struct easeds_ulist_node *node = iter->node;
+
+    if (node == NULL) {
+        return false;
+    }
+
+    *element = node->data + (size_t)iter->index * iter->list->element_size;
+    if (++iter->index == node->count) {
+        iter->node  = TAILQ_NEXT(node, entry);
+        iter->index = 0;
+    }
+
+    return true;
+}
+
+// 校验节点计数和链表结构, 正确返回0, 异常返回-1
+int32_t easeds_ulist_verify(struct easeds_ulist *list);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __EASEDS_ULIST_H__ */
@@ -32,6 +32,7 @@
 #include <pthread.h>
 #include <stdarg.h>
 #include <stdio.h>
+#include <string.h>
 
 /* 项目内头文件 */
 #include "easeds-log.h"
@@ -424,3 +425,40 @@ const char *easeds_get_random_path_name(char *buffer, int32_t min, int32_t max)
     *p = '\0';
     return buffer;
 }
+
+/**
+ * 计算字节串的 64 位哈希值, 每次处理 8 字节, 最后做一次雪崩混合, 高位和低位都可以直接使用.
+ * @attention 外部函数, 线程安全, 可重入.
+ * @param key 键, len 为0时可以为 NULL
+ * @param len 键长度
+ * @return 哈希值
+ */
+uint64_t easeds_hash_bytes(const void *key, uint32_t len)
+{
+    const uint8_t *p    = key;
+    const uint64_t mul  = 0x9E3779B97F4A7C15ULL;
+    uint64_t       hash = len * mul;
+    uint64_t       word;
+
+    while (len >= 8) {
+        memcpy(&word, p, 8);
+        hash = (hash ^ word) * mul;
+        hash ^= hash >> 29;
+        p += 8;
+        len -= 8;
+    }
+
+    if (len > 0) {
+        word = 0;
+        memcpy(&word, p, len);
+        hash = (hash ^ word) * mul;
+    }
+
+    /* murmur3 fmix64 */
+    hash ^= hash >> 33;
+    hash *= 0xFF51AFD7ED558CCDULL;
+    hash ^= hash >> 33;
+    hash *= 0xC4CEB9FE1A85EC53ULL;
+    hash ^= hash >> 33;
+    return hash;
+}
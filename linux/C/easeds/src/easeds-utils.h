@@ -123,6 +123,17 @@ const char *easeds_get_random_string(char *buffer, int32_t min, int32_t max);
  */
 const char *easeds_get_random_path_name(char *buffer, int32_t min, int32_t max);
 
+/**
+ * 计算字节串的 64 位哈希值, 每次处理 8 字节, 最后做一次雪崩混合, 高位和低位都可以直接使用.
+ * 可以作为 easeds_bloom_add_hash 等按哈希值操作的接口的输入.
+ * 布隆过滤器序列化后的位图依赖该算法, 修改算法需要同时提升序列化版本.
+ * @attention 外部函数, 线程安全, 可重入.
+ * @param key 键, len 为0时可以为 NULL
+ * @param len 键长度
+ * @return 哈希值
+ */
+uint64_t easeds_hash_bytes(const void *key, uint32_t len);
+
 #ifdef __cplusplus
 }
 #endif